@@ -0,0 +1,463 @@
+/*
+ * Dusty Mabe - 2014
+ * Bench.cc - Microbenchmarks for the core data structures: the cache
+ *            lookups, the directory (one benchmark per message type),
+ *            the BitVector, the network hop calculations, flushing
+ *            a tile and the synthetic workloads. Each runs on a synthetic address stream of a
+ *            fixed size and is repeated a number of times. The mean
+ *            ns/op is printed with its standard deviation (and the
+ *            fastest and slowest repetition).
+ *
+ *            Time spent running the events that the operations queue
+ *            up (see Event.h) is not counted except by the flush
+ *            benchmark, which runs them itself.
+ *
+ *            usage: ./bench [ops/rep] [reps] [name filter]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+#include <chrono>
+#include "BitVector.h"
+#include "Cache.h"
+#include "CacheLine.h"
+#include "CCSM.h"
+#include "Dir.h"
+#include "Tile.h"
+#include "Net.h"
+#include "MemCtrl.h"
+#include "Event.h"
+#include "Workload.h"
+#include "params.h"
+
+// Globals the simulator code refers to. They are defined in
+// simulator.cc, which isn't linked in here.
+Net *NETWORK;
+thread_local EventQueue *EVENTQ;
+ulong PARTSHARING = 0;
+ulong PROTOCOL    = MESI;
+const char *PROTOCOLNAMES[] = { "MESI", "MOESI", "MESIF" };
+ulong MEMMODEL    = MEMFLAT;
+ulong MEMDRAIN    = DRAINWATERMARK;
+
+// Addresses in each synthetic stream (must be a power of 2)
+#define BENCHADDRS (1 << 16)
+#define BENCHMASK  (BENCHADDRS - 1)
+
+// Operations between running the queued up events
+#define BENCHBATCH 256
+
+// Blocks the directory benchmarks use
+#define BENCHBLOCKS 4096
+
+// The simulated system
+static Dir  *dir;
+static Tile *tiles[NPROCS];
+
+// Address streams
+static ulong hitaddrs[BENCHADDRS];  // Fit in half of an L1
+static ulong missaddrs[BENCHADDRS]; // 16 L2s worth of blocks
+static ulong dirblocks[BENCHADDRS]; // BENCHBLOCKS blocks
+
+// Results are added here so the compiler can't throw the work away
+static volatile ulong sink;
+
+typedef std::chrono::steady_clock Clock;
+
+/*
+ * nsSince
+ *     - Nanoseconds since start.
+ */
+static ulong nsSince(Clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now() - start).count();
+}
+
+/*
+ * makeStreams
+ *     - Fill in the address streams. Always the same for a given
+ *       build so runs can be compared.
+ */
+static void makeStreams() {
+    ulong i;
+    unsigned int seed = 1;
+
+    for (i=0; i < BENCHADDRS; i++) {
+        hitaddrs[i]  = (rand_r(&seed) % (L1SIZE / 2 / BLKSIZE)) * BLKSIZE;
+        missaddrs[i] = (rand_r(&seed) % (16 * L2SIZE / BLKSIZE)) * BLKSIZE;
+        dirblocks[i] = (rand_r(&seed) % BENCHBLOCKS) * BLKSIZE;
+    }
+}
+
+/*
+ * makeSystem
+ *     - Build the directory, tiles and network the same way the
+ *       simulator does with its default options.
+ */
+static void makeSystem() {
+    int i, partid;
+
+    dir = new Dir(1);
+    for (i=0; i < NPROCS; i++) {
+        partid = dir->mapTileToPart(i);
+        tiles[i] = new Tile(i, 1, dir->parttable[partid]->getVector());
+    }
+    EVENTQ  = new EventQueue();
+    NETWORK = new Net(dir, tiles, NETCONTEND, TOPOMESH);
+}
+
+
+/*
+ * Cache benchmarks. Each uses its own L1 sized cache.
+ */
+static Cache *cache;
+
+static void newCache() {
+    ulong i;
+
+    delete cache;
+    cache = new Cache(tiles[0], L1, L1SIZE, L1ASSOC, BLKSIZE);
+    for (i=0; i < BENCHADDRS; i++)
+        cache->fillLine(hitaddrs[i]);
+}
+
+static ulong cacheAccess(ulong n, ulong *addrs) {
+    ulong i, j, ns = 0, hits = 0;
+
+    newCache();
+    for (i=0; i < n; i += BENCHBATCH) {
+        EVENTQ->begin(0);
+        Clock::time_point start = Clock::now();
+        for (j=i; j < i + BENCHBATCH && j < n; j++)
+            hits += cache->Access(addrs[j & BENCHMASK], 'r') == HIT;
+        ns += nsSince(start);
+        EVENTQ->run();
+    }
+    sink += hits;
+    return ns;
+}
+
+static ulong benchAccessHit(ulong n)  { return cacheAccess(n, hitaddrs);  }
+static ulong benchAccessMiss(ulong n) { return cacheAccess(n, missaddrs); }
+
+static ulong cacheFind(ulong n, ulong *addrs) {
+    ulong i, found = 0;
+
+    newCache();
+    Clock::time_point start = Clock::now();
+    for (i=0; i < n; i++)
+        found += cache->findLine(addrs[i & BENCHMASK]) != NULL;
+    ulong ns = nsSince(start);
+    sink += found;
+    return ns;
+}
+
+static ulong benchFindHit(ulong n)  { return cacheFind(n, hitaddrs);  }
+static ulong benchFindMiss(ulong n) { return cacheFind(n, missaddrs); }
+
+static ulong benchGetLRU(ulong n) {
+    ulong i;
+
+    // Fill every way of every set so there are no invalid lines
+    newCache();
+    for (i=0; i < L1SIZE / BLKSIZE; i++)
+        cache->fillLine(missaddrs[i]);
+
+    Clock::time_point start = Clock::now();
+    for (i=0; i < n; i++)
+        sink += (ulong)cache->getLRU(missaddrs[i & BENCHMASK]);
+    return nsSince(start);
+}
+
+
+/*
+ * Directory benchmarks. The requests come from the tiles in turn.
+ * UPGR and WB are only legal in some states so their blocks are put
+ * in that state first (not timed).
+ */
+static ulong dirStream(ulong n, int msg) {
+    ulong i, j, ns = 0;
+
+    for (i=0; i < n; i += BENCHBATCH) {
+        EVENTQ->begin(0);
+        Clock::time_point start = Clock::now();
+        for (j=i; j < i + BENCHBATCH && j < n; j++)
+            sink += dir->getFromNetwork(msg, dirblocks[j & BENCHMASK], j % NPROCS);
+        ns += nsSince(start);
+        EVENTQ->run();
+    }
+    return ns;
+}
+
+static ulong benchDirRd(ulong n)  { return dirStream(n, RD);  }
+static ulong benchDirRdX(ulong n) { return dirStream(n, RDX); }
+
+static ulong dirPrepared(ulong n, int msg) {
+    ulong i, j, b, ns = 0;
+    int t;
+
+    for (i=0; i < n; i += BENCHBLOCKS) {
+
+        // UPGR needs the block shared and WB needs it owned
+        EVENTQ->begin(0);
+        for (b=0; b < BENCHBLOCKS && i + b < n; b++) {
+            t = (i + b) % NPROCS;
+            if (msg == UPGR) {
+                dir->getFromNetwork(RD, b * BLKSIZE, (t + 1) % NPROCS);
+                dir->getFromNetwork(RD, b * BLKSIZE, t);
+            } else {
+                dir->getFromNetwork(RDX, b * BLKSIZE, t);
+            }
+        }
+        EVENTQ->run();
+
+        for (b=0; b < BENCHBLOCKS && i + b < n; b += BENCHBATCH) {
+            EVENTQ->begin(0);
+            Clock::time_point start = Clock::now();
+            for (j=b; j < b + BENCHBATCH && i + j < n; j++)
+                sink += dir->getFromNetwork(msg, j * BLKSIZE, (i + j) % NPROCS);
+            ns += nsSince(start);
+            EVENTQ->run();
+        }
+
+        // Leave the blocks invalid for the next round
+        if (msg == UPGR) {
+            EVENTQ->begin(0);
+            for (b=0; b < BENCHBLOCKS && i + b < n; b++)
+                dir->getFromNetwork(WB, b * BLKSIZE, (i + b) % NPROCS);
+            EVENTQ->run();
+        }
+    }
+    return ns;
+}
+
+static ulong benchDirUpgr(ulong n) { return dirPrepared(n, UPGR); }
+static ulong benchDirWB(ulong n)   { return dirPrepared(n, WB);   }
+
+
+/*
+ * BitVector benchmarks.
+ */
+static ulong benchBVSetClear(ulong n) {
+    ulong i;
+    BitVector bv(0);
+
+    Clock::time_point start = Clock::now();
+    for (i=0; i < n; i++) {
+        bv.setBit(i % NPROCS);
+        bv.clearBit((i * 7) % NPROCS);
+    }
+    ulong ns = nsSince(start);
+    sink += bv.getVector();
+    return ns;
+}
+
+static ulong benchBVCount(ulong n) {
+    ulong i, bits = 0;
+    BitVector bv(0);
+
+    Clock::time_point start = Clock::now();
+    for (i=0; i < n; i++) {
+        bv.setVector(i);
+        bits += bv.getNumSetBits();
+    }
+    ulong ns = nsSince(start);
+    sink += bits;
+    return ns;
+}
+
+static ulong benchBVFirst(ulong n) {
+    ulong i, bits = 0;
+    BitVector bv(0);
+
+    Clock::time_point start = Clock::now();
+    for (i=0; i < n; i++) {
+        bv.setVector((i & 0xffff) | 0x8000);
+        bits += bv.getFirstSetBit();
+    }
+    ulong ns = nsSince(start);
+    sink += bits;
+    return ns;
+}
+
+static ulong benchBVNth(ulong n) {
+    ulong i, bits = 0;
+    BitVector bv(0xffff);
+
+    Clock::time_point start = Clock::now();
+    for (i=0; i < n; i++)
+        bits += bv.getNthSetBit(i % NPROCS + 1);
+    ulong ns = nsSince(start);
+    sink += bits;
+    return ns;
+}
+
+
+/*
+ * Network benchmarks.
+ */
+static ulong benchTileHops(ulong n) {
+    ulong i, hops = 0;
+
+    Clock::time_point start = Clock::now();
+    for (i=0; i < n; i++)
+        hops += NETWORK->calcTileToTileHops(i % NPROCS, (i / NPROCS) % NPROCS);
+    ulong ns = nsSince(start);
+    sink += hops;
+    return ns;
+}
+
+static ulong benchDirHops(ulong n) {
+    ulong i, hops = 0;
+
+    Clock::time_point start = Clock::now();
+    for (i=0; i < n; i++)
+        hops += NETWORK->calcTileToDirHops(missaddrs[i & BENCHMASK], i % NPROCS);
+    ulong ns = nsSince(start);
+    sink += hops;
+    return ns;
+}
+
+
+/*
+ * Flush benchmark. Each op writes BENCHFLUSH blocks in a tile (not
+ * timed) and then flushes them.
+ */
+#define BENCHFLUSH 1024
+
+static ulong benchFlush(ulong n) {
+    ulong i, j, ns = 0;
+    Tile *t = tiles[NPROCS-1];
+
+    for (i=0; i < n; i++) {
+        for (j=0; j < BENCHFLUSH; j++)
+            t->Access(missaddrs[(i * BENCHFLUSH + j) & BENCHMASK], 'w');
+
+        Clock::time_point start = Clock::now();
+        t->FlushDirtyBlocks();
+        ns += nsSince(start);
+    }
+    return ns;
+}
+
+
+/*
+ * Workload benchmarks. Each op is one record taken with
+ * Workload::next() (the way the simulator takes them). Building the
+ * workload isn't timed.
+ */
+static ulong workNext(ulong n, const char *kind) {
+    char spec[128];
+    ulong i, addr = 0, sum = 0;
+    uchar op = 0;
+    int tid = 0;
+    Workload *w;
+
+    sprintf(spec, "%s,n=%lu,fp=64M", kind, n);
+    w = Workload::create(spec);
+
+    Clock::time_point start = Clock::now();
+    for (i=0; i < n; i++) {
+        w->next(&tid, &op, &addr);
+        sum += addr + op + tid;
+    }
+    ulong ns = nsSince(start);
+    sink += sum;
+    delete w;
+    return ns;
+}
+
+static ulong benchWorkStream(ulong n)    { return workNext(n, "stream");     }
+static ulong benchWorkRandom(ulong n)    { return workNext(n, "random");     }
+static ulong benchWorkZipf(ulong n)      { return workNext(n, "zipf");       }
+static ulong benchWorkProdCons(ulong n)  { return workNext(n, "prodcons");   }
+static ulong benchWorkMigratory(ulong n) { return workNext(n, "migratory");  }
+static ulong benchWorkFalseShare(ulong n){ return workNext(n, "falseshare"); }
+
+
+// The benchmarks. ops is how many operations one repetition does
+// for each op asked for on the command line (scaled down for the
+// slow ones).
+static struct {
+    const char *name;
+    ulong (*run)(ulong n); // Returns the ns n operations took
+    ulong scale;           // Divide the ops per rep by this
+} benches[] = {
+    { "cache.access.hit",   benchAccessHit,  1 },
+    { "cache.access.miss",  benchAccessMiss, 1 },
+    { "cache.findLine.hit", benchFindHit,    1 },
+    { "cache.findLine.miss",benchFindMiss,   1 },
+    { "cache.getLRU",       benchGetLRU,     1 },
+    { "dir.RD",             benchDirRd,      4 },
+    { "dir.RDX",            benchDirRdX,     4 },
+    { "dir.UPGR",           benchDirUpgr,    4 },
+    { "dir.WB",             benchDirWB,      4 },
+    { "bitvector.setclear", benchBVSetClear, 1 },
+    { "bitvector.count",    benchBVCount,    1 },
+    { "bitvector.first",    benchBVFirst,    1 },
+    { "bitvector.nth",      benchBVNth,      1 },
+    { "net.tiletotile",     benchTileHops,   1 },
+    { "net.tiletodir",      benchDirHops,    1 },
+    { "tile.flush",         benchFlush,      10000 },
+    { "workload.stream",    benchWorkStream,    1 },
+    { "workload.random",    benchWorkRandom,    1 },
+    { "workload.zipf",      benchWorkZipf,      1 },
+    { "workload.prodcons",  benchWorkProdCons,  1 },
+    { "workload.migratory", benchWorkMigratory, 1 },
+    { "workload.falseshare",benchWorkFalseShare,1 },
+};
+
+int main(int argc, char *argv[]) {
+    int b, r;
+    ulong ops     = 1000000;
+    int reps      = 10;
+    char *filter  = NULL;
+    ulong n;
+    double x, sum, sumsq, mean, dev, lo, hi;
+
+    if (argc > 1) ops    = atol(argv[1]);
+    if (argc > 2) reps   = atoi(argv[2]);
+    if (argc > 3) filter = argv[3];
+    assert(ops > 0 && reps > 0);
+
+    makeStreams();
+    makeSystem();
+
+    printf("===== Microbenchmarks =====\n");
+    printf("Ops per rep:      %lu\n", ops);
+    printf("Reps:             %d\n", reps);
+    printf("%-20s %10s %10s %10s %8s %10s %10s\n",
+           "benchmark", "ops/rep", "ns/op", "stddev", "cv", "min", "max");
+
+    for (b=0; b < sizeof(benches) / sizeof(benches[0]); b++) {
+        if (filter && !strstr(benches[b].name, filter))
+            continue;
+
+        n = ops / benches[b].scale;
+        if (n == 0)
+            n = 1;
+
+        // One untimed rep to warm up the caches (ours and the host's)
+        benches[b].run(n);
+
+        sum = sumsq = 0;
+        lo  = 1e30;
+        hi  = 0;
+        for (r=0; r < reps; r++) {
+            x = (double)benches[b].run(n) / n;
+            sum   += x;
+            sumsq += x * x;
+            lo = (x < lo) ? x : lo;
+            hi = (x > hi) ? x : hi;
+        }
+        mean = sum / reps;
+        dev  = sqrt(MAX(sumsq / reps - mean * mean, 0.0));
+
+        printf("%-20s %10lu %10.2f %10.2f %7.1f%% %10.2f %10.2f\n",
+               benches[b].name, n, mean, dev, mean ? 100 * dev / mean : 0, lo, hi);
+    }
+
+    return 0;
+}
@@ -33,14 +33,24 @@ int BitVector::getFirstSetBit() {
     }
 }
 
+/*
+ * BitVector::getNextSetBit
+ *     - Find the first set bit at or after bit.
+ *
+ * Returns the bit or -1 if there are no more.
+ */
+int BitVector::getNextSetBit(int bit) {
+    unsigned int rest;
+
+    if (bit >= size)
+        return -1;
+    rest = ((unsigned int)vector & ((1U << size) - 1)) >> bit;
+    return rest ? bit + __builtin_ctz(rest) : -1;
+}
+
 int BitVector::getNumSetBits() {
-    int i;
-    int count = 0;
-    for(i=0; i < size; i++) {
-        if (vector & (1 << i))
-            count++;
-    }
-    return count;
+    // Only the low size bits count
+    return __builtin_popcount(vector & ((1U << size) - 1));
 }
 
 void BitVector::setBit(int bit) {
@@ -17,6 +17,7 @@ class BitVector {
         ~BitVector() {};
 
         int getFirstSetBit();
+        int getNextSetBit(int bit);
         int getNumSetBits();
         int getBit(int bit);
         int getNthSetBit(int n);
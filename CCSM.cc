@@ -1,6 +1,7 @@
 /*
  * Dusty Mabe - 2014
  * CCSM.cc - Implementation of a MESI Cache Coherence State Machine (CCSM).
+ *           The MOESI and MESIF variants are selected with PROTOCOL.
  */
 
 #include <assert.h>
@@ -10,10 +11,17 @@
 #include "Tile.h"
 #include "Dir.h"
 #include "Net.h"
+#include "Stats.h"
 
 // Global NETWORK is defined in simulator.cc
 extern Net *NETWORK;
 
+// Coherence protocol in use (MESI, MOESI or MESIF)
+extern ulong PROTOCOL;
+
+// Names of the states (indexed by STATEI, STATEM, ...)
+const char *STATENAMES[] = { "I", "M", "E", "S", "O", "F" };
+
 CCSM::CCSM(Tile * t, Cache *c, CacheLine *l) {
     tile  = t;
     cache = c;
@@ -21,6 +29,9 @@ CCSM::CCSM(Tile * t, Cache *c, CacheLine *l) {
     state = STATEI;
 }
 
+CCSM::~CCSM() {
+}
+
 /*
  * CCSM:setState
  *     - This function serves to change the state of the CCSM
@@ -57,6 +68,9 @@ void CCSM::setState(int s) {
     if (state == STATEM && s == STATES)
         line->setFlags(VALID);
 
+    if (state != s)
+        STAT_INC(cache->transitions[state][s]);
+
     state = s; // Set the new state
 }
 
@@ -67,34 +81,44 @@ void CCSM::evict() {
 
 void CCSM::writeback() {
 
-    int addr = cache->getBaseAddr(line->getTag(), line->getIndex());
+    ulong addr = cache->getBaseAddr(line->getTag(), line->getIndex());
 
-    // Should not get here unless we are in modified state
-    assert(state == STATEM);
+    // Should not get here unless we own dirty data (M or O)
+    assert(state == STATEM || state == STATEO);
 
     // On eviction set the state to invalid
     setState(STATEI);
 
-    // Send notification to the directory
+    // Send the dirty block to the directory (the WB carries the data)
     NETWORK->sendReqTileToDir(WB, addr, tile->index);
-    // What about data?
 }
 
 void CCSM::netInitInv() {
 
-    int addr = cache->getBaseAddr(line->getTag(), line->getIndex());
+    ulong addr = cache->getBaseAddr(line->getTag(), line->getIndex());
 
     switch (state) {
 
         // For M we need to transition to Invalid state and flush. 
         case STATEM: 
             NETWORK->flushToMem(addr, tile->index);
+            STAT_INC(cache->flushes);
+            setState(STATEI);
+            break;
+
+        // For O the dirty data goes to the requester, which is
+        // about to become the new M owner, so there is no need
+        // to write it back to memory.
+        case STATEO:
+            cache->avoidWriteBack();
+            line->setFlags(VALID);
             setState(STATEI);
             break;
 
-        // For E&S we need to transistion to Invalid state
+        // For E&S&F we need to transistion to Invalid state
         case STATEE: 
         case STATES: 
+        case STATEF: 
             setState(STATEI);
             break;
 
@@ -108,27 +132,64 @@ void CCSM::netInitInv() {
     }
 }
 
+/*
+ * CCSM::netInitBackInv
+ *     - The directory evicted its entry for this block. This is the
+ *       same as an invalidation except that nobody takes over an
+ *       Owned block so its dirty data has to go back to memory.
+ */
+void CCSM::netInitBackInv() {
+
+    ulong addr = cache->getBaseAddr(line->getTag(), line->getIndex());
+
+    if (state == STATEO) {
+        NETWORK->flushToMem(addr, tile->index);
+        STAT_INC(cache->flushes);
+        setState(STATEI);
+        return;
+    }
+
+    netInitInv();
+}
+
 void CCSM::netInitInt() {
 
-    int addr = cache->getBaseAddr(line->getTag(), line->getIndex());
+    ulong addr = cache->getBaseAddr(line->getTag(), line->getIndex());
 
     switch (state) {
 
         // For M we need to transistion to Shared state and flush. 
+        // With MOESI we instead keep the dirty data in Owned state
+        // and supply it to the sharers ourselves.
         case STATEM: 
-            NETWORK->flushToMem(addr, tile->index);
-            setState(STATES);
+            if (PROTOCOL == MOESI) {
+                cache->avoidWriteBack();
+                setState(STATEO);
+            } else {
+                NETWORK->flushToMem(addr, tile->index);
+                STAT_INC(cache->flushes);
+                setState(STATES);
+            }
             break;
 
         // For E we transition to Shared
         case STATEE:
             setState(STATES);
             break;
+
+        // For F, the requester becomes the new forwarder
+        case STATEF:
+            setState(STATES);
+            break;
         
         // For S, no need to change state, but we can optionally flush
         case STATES: 
             break;
 
+        // For O, no need to change state. We supply the data.
+        case STATEO: 
+            break;
+
         // Nothing to do for I
         case STATEI: 
             break;
@@ -150,8 +211,10 @@ void CCSM::procInitWr(ulong addr) {
             setState(STATEM);
             break;
 
-        // For S need to send UPGR and go to modified
+        // For S&O&F need to send UPGR and go to modified
         case STATES: 
+        case STATEO: 
+        case STATEF: 
             NETWORK->sendReqTileToDir(UPGR, addr, tile->index);
             setState(STATEM);
             break;
@@ -170,18 +233,22 @@ void CCSM::procInitWr(ulong addr) {
 void CCSM::procInitRd(ulong addr) {
     int dirstate;
     switch (state) {
-        // Nothing to do for M&E&S states
+        // Nothing to do for M&E&S&O&F states
         case STATEM: 
         case STATEE: 
         case STATES: 
+        case STATEO: 
+        case STATEF: 
             break;
 
         // For I, Send RD request to directory and then check
-        // response to see if we should go to E or S states.:
+        // response to see if we should go to E, F or S states.
         case STATEI: 
             dirstate = NETWORK->sendReqTileToDir(RD, addr, tile->index);
             if (dirstate == DSTATEEM)
                 setState(STATEE);
+            else if (dirstate == DSTATEF)
+                setState(STATEF);
             else
                 setState(STATES);
             break;
@@ -191,16 +258,31 @@ void CCSM::procInitRd(ulong addr) {
     }
 }
 
-void CCSM::getFromNetwork(ulong msg) {
+/*
+ * CCSM::getFromNetwork
+ *     - Handle a message from the directory. 
+ *
+ * Returns the state the line was in before the message was handled
+ * so the directory knows whether we could supply the data.
+ */
+int CCSM::getFromNetwork(ulong msg) {
+    int oldstate = state;
+
     switch (msg) {
 
         // These come from directory
         case INV: 
+            STAT_INC(cache->invalidations);
             netInitInv();
             break;
         case INT: 
+            STAT_INC(cache->interventions);
             netInitInt();
             break;
+        case BINV: 
+            STAT_INC(cache->invalidations);
+            netInitBackInv();
+            break;
      ///case REPLY: 
      ///    netInitReply();
      ///    break;
@@ -215,4 +297,6 @@ void CCSM::getFromNetwork(ulong msg) {
         default :
             assert(0); // should not get here
     }
+
+    return oldstate;
 }
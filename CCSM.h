@@ -1,7 +1,7 @@
 /*
  * Dusty Mabe - 2014
  * CCSM.h - Header file for Cache Coherence State Machine for
- *          the MESI protocol.
+ *          the MESI protocol and its MOESI/MESIF variants.
  */
 #ifndef CCSM_H
 #define CCSM_H
@@ -17,6 +17,21 @@ enum{
     STATEM,
     STATEE,
     STATES,
+    STATEO, // Owned     (MOESI only) - dirty, supplies data to sharers
+    STATEF, // Forwarder (MESIF only) - clean, supplies data to sharers
+};
+
+#define NSTATES (STATEF + 1)
+
+// Names of the states (indexed by STATEI, STATEM, ...)
+extern const char *STATENAMES[];
+
+// Coherence protocols. The protocol in use is selected per run
+// and stored in the global PROTOCOL (see simulator.cc).
+enum{
+    MESI = 0,
+    MOESI,
+    MESIF,
 };
 
 class CCSM {
@@ -31,8 +46,9 @@ class CCSM {
         ~CCSM();
         void setState(int s);
         void evict();
-        void getFromNetwork(ulong msg);
+        int getFromNetwork(ulong msg);
         void netInitInv();
+        void netInitBackInv();
         void netInitInt();
         void procInitRd(ulong addr);
         void procInitWr(ulong addr);
@@ -12,9 +12,26 @@
 #include "CCSM.h"
 #include "Tile.h"
 #include "params.h"
-
-// Global delay counter for the current outstanding memory request.
-extern int CURRENTDELAY;
+#include "Event.h"
+#include "Checkpoint.h"
+
+// Global event queue is defined in simulator.cc
+extern thread_local EventQueue *EVENTQ;
+
+// Coherence protocol in use (MESI, MOESI or MESIF)
+extern ulong PROTOCOL;
+
+#ifdef STATS
+// Names of the state transitions for the stats registry
+static const char *TRANSNAMES[NSTATES][NSTATES] = {
+    { "ItoI", "ItoM", "ItoE", "ItoS", "ItoO", "ItoF" },
+    { "MtoI", "MtoM", "MtoE", "MtoS", "MtoO", "MtoF" },
+    { "EtoI", "EtoM", "EtoE", "EtoS", "EtoO", "EtoF" },
+    { "StoI", "StoM", "StoE", "StoS", "StoO", "StoF" },
+    { "OtoI", "OtoM", "OtoE", "OtoS", "OtoO", "OtoF" },
+    { "FtoI", "FtoM", "FtoE", "FtoS", "FtoO", "FtoF" },
+};
+#endif
 
 /*
  * Cache::Cache - create a new cache object.
@@ -33,10 +50,34 @@ Cache::Cache(Tile * t, int l, int s, int a, int b) {
     // Initialize all counters
     lruCounter   = 0;
     writeBacks   = 0;
+    wbAvoided    = 0;
     readMisses   = 0;
     writeMisses  = 0;
     reads = writes = 0;
 
+#ifdef STATS
+    char group[32];
+
+    flushes       = 0;
+    interventions = 0;
+    invalidations = 0;
+    transfers     = 0;
+    memset(transitions, 0, sizeof(transitions));
+
+    // Only the L2 has a CCSM so only it has anything to count
+    if (l == L2) {
+        sprintf(group, "tile%d.L2", t->index);
+        for (i=0; i < NSTATES; i++)
+            for (j=0; j < NSTATES; j++)
+                if (i != j)
+                    STAT_REGISTER(group, TRANSNAMES[i][j], &transitions[i][j]);
+        STAT_REGISTER(group, "transfers",     &transfers);
+        STAT_REGISTER(group, "interventions", &interventions);
+        STAT_REGISTER(group, "invalidations", &invalidations);
+        STAT_REGISTER(group, "flushes",       &flushes);
+    }
+#endif
+
     // Process arguments
     tile       = t;
     cacheLevel = l;
@@ -119,9 +160,12 @@ ulong Cache::getBaseAddr(ulong tag, ulong index) {
 
 /*
  * Cache::FlushDirtyBlocks
- *     - Flush all dirty blocks in the cache to memory.
+ *     - Flush all dirty blocks in the cache to memory. If parallel
+ *       is set the caller has fork()ed the event queue and each
+ *       block goes out in its own branch rather than one after
+ *       the other.
  */
-void Cache::FlushDirtyBlocks() {
+void Cache::FlushDirtyBlocks(int parallel) {
     CacheLine * line;
     int i,j;
 
@@ -131,6 +175,9 @@ void Cache::FlushDirtyBlocks() {
             line = &cacheArray[i][j];
             if (line->isValid()) {
 
+                if (parallel)
+                    EVENTQ->branch();
+
                 // For all we need update cache counter
                 // if this is a writeback
                 if (line->getFlags() == DIRTY)
@@ -164,11 +211,11 @@ ulong Cache::Access(ulong addr, uchar op) {
     CacheLine * line;
     int state;
 
-    // Update global delay counter with access time
+    // Add the access time to the request
     if (cacheLevel == L2)
-        CURRENTDELAY += L2ATIME;
+        EVENTQ->delay(L2ATIME);
     else
-        CURRENTDELAY += L1ATIME;
+        EVENTQ->delay(L1ATIME);
 
     // Per cache global counter to maintain LRU order
     // among cache ways; updated on every cache access.
@@ -361,6 +408,77 @@ void Cache::invalidateLineIfExists(ulong addr) {
 }
 
 
+/*
+ * Cache::resetStats
+ *     - Zero the counters (the contents of the cache stay).
+ */
+void Cache::resetStats() {
+    reads = writes = 0;
+    readMisses  = 0;
+    writeMisses = 0;
+    writeBacks  = 0;
+    wbAvoided   = 0;
+}
+
+/*
+ * Cache::addStats
+ *     - Add the counters of c (times times) to this cache's.
+ */
+void Cache::addStats(Cache *c, double times) {
+    reads       += (ulong)(c->reads * times + 0.5);
+    writes      += (ulong)(c->writes * times + 0.5);
+    readMisses  += (ulong)(c->readMisses * times + 0.5);
+    writeMisses += (ulong)(c->writeMisses * times + 0.5);
+    writeBacks  += (ulong)(c->writeBacks * times + 0.5);
+    wbAvoided   += (ulong)(c->wbAvoided * times + 0.5);
+}
+
+/*
+ * Cache::checkpoint
+ *     - Save or restore the lines (tags, LRU order and coherence
+ *       state) and the counters.
+ */
+void Cache::checkpoint(Checkpoint *ck) {
+    ulong i, j, *v, *lines;
+    CacheLine *line;
+
+    ck->section(CKSECTION('C', 'a', 'c', 'h'));
+    CKIO(ck, lruCounter);
+    CKIO(ck, reads);
+    CKIO(ck, readMisses);
+    CKIO(ck, writes);
+    CKIO(ck, writeMisses);
+    CKIO(ck, writeBacks);
+    CKIO(ck, wbAvoided);
+
+    // All of the lines go in one array, 5 words (tag, index, flags,
+    // LRU seq, coherence state) per line
+    lines = new ulong[5*numSets*assoc];
+    for (i=0, v=lines; ck->saving && i < numSets; i++) {
+        for (j=0; j < assoc; j++, v += 5) {
+            line = &cacheArray[i][j];
+            v[0] = line->getTag();
+            v[1] = line->getIndex();
+            v[2] = line->getFlags();
+            v[3] = line->getSeq();
+            v[4] = line->ccsm ? line->ccsm->state : STATEI;
+        }
+    }
+    ck->io(lines, 5*numSets*assoc*sizeof(ulong));
+    for (i=0, v=lines; !ck->saving && i < numSets; i++) {
+        for (j=0; j < assoc; j++, v += 5) {
+            line = &cacheArray[i][j];
+            line->setTag(v[0]);
+            line->setIndex(v[1]);
+            line->setFlags(v[2]);
+            line->setSeq(v[3]);
+            if (line->ccsm)
+                line->ccsm->state = v[4];
+        }
+    }
+    delete[] lines;
+}
+
 /*
  * Cache::PrintStats
  *     - Print statistics for this cache.
@@ -371,21 +489,8 @@ void Cache::PrintStats() {
     printf("03. number of writes:                           %lu\n", writes);
     printf("04. number of write misses:                     %lu\n", writeMisses);
     printf("05. number of write backs:                      %lu\n", writeBacks);
-////printf("06. number of invalid to exclusive (INV->EXC):  %lu\n", ItoE);
-////printf("07. number of invalid to shared (INV->SHD):     %lu\n", ItoS);
-////printf("08. number of modified to shared (MOD->SHD):    %lu\n", MtoS);
-////printf("09. number of exclusive to shared (EXC->SHD):   %lu\n", EtoS);
-////printf("10. number of shared to modified (SHD->MOD):    %lu\n", StoM);
-////printf("11. number of invalid to modified (INV->MOD):   %lu\n", ItoM);
-////printf("12. number of exclusive to modified (EXC->MOD): %lu\n", EtoM);
-////printf("13. number of owned to modified (OWN->MOD):     %lu\n", OtoM);
-////printf("14. number of modified to owned (MOD->OWN):     %lu\n", MtoO);
-////printf("15. number of shared to invalid (SHD->INV):     %lu\n", StoI);
-////printf("16. number of cache to cache transfers:         %lu\n", transfers);
-////printf("17. number of interventions:                    %lu\n", interventions);
-////printf("18. number of invalidations:                    %lu\n", invalidations);
-////printf("19. number of flushes:                          %lu\n", flushes);
-
+    if (cacheLevel == L2 && PROTOCOL != MESI)
+        printf("06. number of write backs avoided (MOESI):      %lu\n", wbAvoided);
 }
 
 /*
@@ -432,6 +537,16 @@ void Cache::PrintStatsTabular(int printhead) {
     sprintf(buftemp, "%15lu", writeBacks);
     strcat(bufbody, buftemp);
 
+    // Only the L2 has a CCSM so only it can avoid writebacks. Keep
+    // the MESI output identical to what it has always been.
+    if (cacheLevel == L2 && PROTOCOL != MESI) {
+        sprintf(level+2, "%s", "wbAvoid");
+        sprintf(buftemp, "%15s", level);
+        strcat(bufhead, buftemp);
+        sprintf(buftemp, "%15lu", wbAvoided);
+        strcat(bufbody, buftemp);
+    }
+
     if (printhead)
         printf("%s", bufhead);
     else
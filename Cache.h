@@ -6,6 +6,8 @@
 #define CACHE_H
 
 #include "types.h"
+#include "CCSM.h"
+#include "Stats.h"
 
 #define L1 0
 #define L2 1
@@ -16,6 +18,7 @@
 class CacheLine; // Forward Declaration
 class CCSM;      // Forward Declaration
 class Tile;      // Forward Declaration  
+class Checkpoint; // Forward Declaration
 
 class Cache {
 protected:
@@ -28,9 +31,8 @@ protected:
     // Some counters
     ulong reads, readMisses;
     ulong writes, writeMisses;
-    ulong flushes, writeBacks;
-    ulong interventions, invalidations;
-    ulong transfers;
+    ulong writeBacks;
+    ulong wbAvoided; // Writebacks avoided by MOESI Owned state
 
     // The 2-dimensional cache
     CacheLine **cacheArray;
@@ -41,6 +43,16 @@ protected:
 public:
     // Variable to keep up with global LRU
     ulong lruCounter;  
+
+#ifdef STATS
+    // Optional counters (see Stats.h). Only the L2 has a CCSM so
+    // only the L2 registers them.
+    ulong flushes;       // Dirty blocks flushed to memory
+    ulong interventions; // Interventions received
+    ulong invalidations; // Invalidations received
+    ulong transfers;     // Blocks supplied to another cache
+    ulong transitions[NSTATES][NSTATES]; // [from][to] CCSM state changes
+#endif
      
     Cache(Tile * t, int l, int s, int a, int b);
     ~Cache();
@@ -57,12 +69,17 @@ public:
     ulong getWrites()   { return writes;      }
     ulong getWB()       { return writeBacks;  }
     void writeBack()    { writeBacks++;       }
+    ulong getWBAvoided(){ return wbAvoided;   }
+    void avoidWriteBack(){ wbAvoided++;       }
 
     ulong Access(ulong, uchar);
     void PrintStats();
     void PrintStatsTabular(int printhead); 
+    void resetStats();
+    void addStats(Cache *c, double times);
+    void checkpoint(Checkpoint *ck);
     void updateLRU(CacheLine *);
-    void FlushDirtyBlocks();
+    void FlushDirtyBlocks(int parallel=0);
 
     ulong calcTag(ulong addr);
     ulong calcIndex(ulong addr);
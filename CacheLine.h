@@ -6,6 +6,7 @@
 #ifndef CACHELINE_H
 #define CACHELINE_H
 
+#include <stddef.h>
 #include "types.h"
 
 class CCSM; // Forward Declaration
@@ -27,7 +28,7 @@ protected:
  
 public:
     CCSM * ccsm;
-    CacheLine()                 { tag = 0; Flags = 0; }
+    CacheLine()                 { tag = 0; Flags = 0; ccsm = NULL; }
     ~CacheLine()                { if (ccsm) delete ccsm; }
     ulong getTag()              { return tag; }
     ulong getIndex()            { return index; }
@@ -0,0 +1,121 @@
+/*
+ * Dusty Mabe - 2014
+ * Checkpoint.cc - Implementation of saving and restoring the state of
+ *                 the simulator.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "Checkpoint.h"
+
+/*
+ * Checkpoint::Checkpoint
+ *     - Open file to save a checkpoint to (save = 1) or restore one
+ *       from (save = 0).
+ */
+Checkpoint::Checkpoint(const char *file, int save) {
+    struct stat st;
+    ulong magic = CKPTMAGIC;
+    ulong version = CKPTVERSION;
+    int fd;
+
+    name   = file;
+    saving = save;
+    fp     = NULL;
+    map    = NULL;
+    size   = 0;
+    pos    = 0;
+
+    if (saving) {
+        fp = fopen(file, "w");
+        if (fp == NULL) {
+            printf("Checkpoint file problem (%s)\n", file);
+            exit(1);
+        }
+    } else {
+        fd = open(file, O_RDONLY);
+        if (fd < 0 || fstat(fd, &st) != 0 || st.st_size == 0) {
+            printf("Checkpoint file problem (%s)\n", file);
+            exit(1);
+        }
+        size = st.st_size;
+        map  = (uchar *)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (map == MAP_FAILED) {
+            printf("Checkpoint file problem (%s)\n", file);
+            exit(1);
+        }
+    }
+
+    CKIO(this, magic);
+    CKIO(this, version);
+    if (magic != CKPTMAGIC || version != CKPTVERSION) {
+        printf("%s is not a checkpoint (or is from another version)\n", file);
+        exit(1);
+    }
+}
+
+Checkpoint::~Checkpoint() {
+    if (fp && fclose(fp) != 0) {
+        printf("Checkpoint file problem (%s)\n", name);
+        exit(1);
+    }
+    if (map)
+        munmap(map, size);
+}
+
+/*
+ * Checkpoint::io
+ *     - Save or restore n bytes at p. The next field starts on an 8
+ *       byte boundary.
+ */
+void Checkpoint::io(void *p, ulong n) {
+    static const uchar zeros[8] = { 0 };
+    ulong pad = (8 - n % 8) % 8;
+
+    if (saving) {
+        if (fwrite(p, 1, n, fp) != n || fwrite(zeros, 1, pad, fp) != pad) {
+            printf("Checkpoint file problem (%s)\n", name);
+            exit(1);
+        }
+    } else {
+        if (pos + n > size) {
+            printf("Checkpoint %s is cut short\n", name);
+            exit(1);
+        }
+        memcpy(p, map + pos, n);
+    }
+    pos += n + pad;
+}
+
+/*
+ * Checkpoint::io
+ *     - Save or restore a counter that is shared between threads.
+ */
+void Checkpoint::io(std::atomic<ulong> *a) {
+    ulong v = a->load();
+    CKIO(this, v);
+    a->store(v);
+}
+
+/*
+ * Checkpoint::section
+ *     - Mark the start of a part of the checkpoint. When restoring
+ *       the file must have the same part next.
+ */
+void Checkpoint::section(ulong tag) {
+    ulong t = tag;
+
+    CKIO(this, t);
+    if (t != tag) {
+        printf("Checkpoint %s doesn't match this simulator (section %.4s at byte %lu)\n",
+               name, (char *)&tag, pos - sizeof(t));
+        exit(1);
+    }
+}
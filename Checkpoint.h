@@ -0,0 +1,59 @@
+/*
+ * Dusty Mabe - 2014
+ * Checkpoint.h - Header file for saving the state of the whole
+ *                simulator to a file and loading it back. A run can
+ *                then start in the middle of a trace with the caches,
+ *                directory and counters just as a full run would have
+ *                had them.
+ *
+ *                Each class that has state has a checkpoint() method
+ *                that goes over its fields with io(). When saving io()
+ *                writes the field out and when restoring it reads it
+ *                back in, so the same code does both and the two can't
+ *                get out of step. Each part starts with a section()
+ *                tag so a file that doesn't match the code is caught
+ *                right away.
+ *
+ *                The file is plain binary. Every field starts on an
+ *                8 byte boundary so the (mostly array) contents can be
+ *                used right out of the mapped file. Restoring maps the
+ *                file and copies out of it.
+ */
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <stdio.h>
+#include <atomic>
+#include "types.h"
+
+#define CKPTMAGIC   0x54504b4336303730UL // "0706CKPT"
+#define CKPTVERSION 2
+
+// Go over a field (that isn't a pointer)
+#define CKIO(ck, x) (ck)->io(&(x), sizeof(x))
+
+// Section tags (four characters each)
+#define CKSECTION(a, b, c, d) \
+    ((ulong)(a) | (ulong)(b) << 8 | (ulong)(c) << 16 | (ulong)(d) << 24)
+
+class Checkpoint {
+    private:
+        FILE  *fp;   // File being saved to
+        uchar *map;  // File being restored from (mapped)
+        ulong  size; // .. and how big it is
+        ulong  pos;  // Bytes saved or restored so far
+
+    public:
+        const char *name;
+        int saving;  // Saving (1) or restoring (0)?
+
+        Checkpoint(const char *file, int save);
+        ~Checkpoint();
+
+        void  io(void *p, ulong n);
+        void  io(std::atomic<ulong> *a);
+        void  section(ulong tag);
+        ulong bytes() { return pos; }
+};
+
+#endif
@@ -6,32 +6,51 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <assert.h>
 #include "Dir.h"
+#include "CCSM.h"
 #include "BitVector.h"
+#include "Sharers.h"
 #include "Net.h"
 #include "Tile.h"
 #include "types.h"
+#include "Event.h"
+#include "MemCtrl.h"
+#include "Profile.h"
+#include "Checkpoint.h"
 
 
 // Global NETWORK is defined in simulator.cc
 extern Net *NETWORK;
 
-// Global delay counter for the current outstanding memory request.
-extern int CURRENTDELAY;
-extern int CURRENTMEMDELAY;
+// Global event queue is defined in simulator.cc
+extern thread_local EventQueue *EVENTQ;
+
 extern int PARTSHARING;
 
+// Coherence protocol in use (MESI, MOESI or MESIF)
+extern ulong PROTOCOL;
+
+// Memory model and write drain policy (see MemCtrl.h)
+extern ulong MEMMODEL;
+extern ulong MEMDRAIN;
+
+// Names of the mapping policies (indexed by MAPBLOCK, MAPPAGE, ...)
+const char *MAPNAMES[] = { "block", "page", "firsttouch", "migrate" };
+
 /*
  * DirEntry constructor
  *    - Build up the data structures that belong to a
  *      directory entry pertaining to the block with base
  *      address blockaddr.
  */
-DirEntry::DirEntry(ulong blockaddr) {
-    blockaddr = blockaddr;
+DirEntry::DirEntry(ulong blockaddr, Sharers *s) {
+    this->blockaddr = blockaddr;
     state     = DSTATEI;
-    sharers   = new BitVector(0);
+    location  = -1;
+    sharers   = s;
+    next      = NULL;
 }
 
 /*
@@ -46,29 +65,52 @@ DirEntry::~DirEntry() {
 /*
  * Dir constructor
  *    - Build up the data structures that belong to a
- *      directory.
+ *      directory. If entries is non-zero then the directory
+ *      can only track that many blocks at once (see SparseDir).
  */
-Dir::Dir(int partscheme) {
+Dir::Dir(int partscheme, ulong entries, ulong assoc, int policy,
+         int encoding, int ptrs, int locks, int map) {
+    ulong page;
     int i;
 
-    // We need a directory for every block. How many do we need
-    // for a 32 bit address space and 64 byte blocks?
-    //
-    //      2^32 bytes * (1 block / 2^6 bytes) = 2^26 blocks
-    //
-    // Therefore we need 2^26 directory entries. What we will
-    // do now is just allocoate the pointers for that many 
-    // directories but we won't allocate the directories until
-    // they are accessed.  
-    directory = new DirEntry*[(1 << 26) - 1];
-
-    // Verify each direntry is initialized to NULL
-    for (i=0; i < (1<<26); i++)
-        assert(directory[i] == NULL);
+    // The directory is split into NDIRS shards, one for each memory
+    // controller. Each shard only allocates entries for the blocks
+    // that map to it as they are accessed. If the directory is
+    // finite then each shard gets an equal slice of the entries.
+    assert(entries % NDIRS == 0);
+    locking = locks;
+    epoch   = new EpochManager();
+    shards  = new DirShard*[NDIRS];
+    for (i=0; i < NDIRS; i++)
+        shards[i] = new DirShard(i, entries/NDIRS, assoc, policy, locks, epoch);
 
     // Calculate the # of partitions in the system.
     numparts = NPROCS/partscheme;
 
+    // Initialize counters
+    memsaved  = 0;
+    invs      = 0;
+    extrainvs = 0;
+    live      = 0;
+    peaklive  = 0;
+
+    // How are sharers encoded in each entry?
+    sharerenc  = encoding;
+    sharerptrs = ptrs;
+
+    // Where does memory go? The first touch policies start out with
+    // no pages placed.
+    mapping   = map;
+    pagetable = NULL;
+    if (mapping >= MAPFIRSTTOUCH) {
+        pagetable = new std::atomic<uchar>[NPAGES];
+        for (page=0; page < NPAGES; page++)
+            pagetable[page].store(PAGEUNMAPPED, std::memory_order_relaxed);
+    }
+    pagesplaced  = 0;
+    pagesmoved   = 0;
+    entriesmoved = 0;
+
     // We need a table of partition vectors.
     parttable = new BitVector*[numparts];
 
@@ -115,18 +157,183 @@ Dir::Dir(int partscheme) {
  */
 Dir::~Dir() {
     int i;
-    delete[] directory;
+    for (i=0; i < NDIRS; i++)
+        delete shards[i];
+    delete[] shards;
+    delete epoch;
+    delete[] pagetable;
     for (i=0; i < numparts; i++)
         delete parttable[i];
     delete[] parttable;
 }
 
+/*
+ * Dir::mapAddrToDir
+ *     - Given an address find the memory controller (and therefore
+ *       the directory shard) that is responsible for it. A page that
+ *       hasn't been placed yet is treated as page interleaved.
+ */
+int Dir::mapAddrToDir(ulong addr) {
+    ulong page = PAGEADDR(addr);
+    int dirnum;
+
+    switch (mapping) {
+        case MAPBLOCK:
+            return BLKADDR(addr) % NDIRS;
+        case MAPPAGE:
+            return page % NDIRS;
+        default:
+            // Another thread may be placing the page (see touchPage)
+            assert(page < NPAGES);
+            dirnum = pagetable[page].load(std::memory_order_acquire);
+            if (dirnum == PAGEUNMAPPED)
+                return page % NDIRS;
+            return dirnum;
+    }
+}
+
+/*
+ * Dir::touchPage
+ *     - A tile is about to send a request for addr to its memory
+ *       controller. With first touch placement a new page goes on the
+ *       controller closest to the tile. With migration the page also
+ *       follows the process: the first request for it from a tile
+ *       with a closer controller moves it there (see movePage).
+ */
+void Dir::touchPage(ulong addr, int tile) {
+    ulong page = PAGEADDR(addr);
+    int to;
+
+    if (mapping < MAPFIRSTTOUCH)
+        return;
+
+    assert(page < NPAGES);
+    to = NETWORK->nearestDir(tile);
+
+    // Two tiles may touch a new page at once
+    std::unique_lock<std::mutex> guard;
+    if (locking)
+        guard = std::unique_lock<std::mutex>(pagelock);
+
+    if (pagetable[page].load(std::memory_order_relaxed) == PAGEUNMAPPED) {
+        pagetable[page].store(to, std::memory_order_release);
+        pagesplaced++;
+        return;
+    }
+
+    if (mapping == MAPMIGRATE && pagetable[page].load(std::memory_order_relaxed) != to)
+        movePage(page, to);
+}
+
+/*
+ * Dir::movePage
+ *     - Move a page to another controller. The directory entries of
+ *       its blocks move to the new shard and each block is read out
+ *       of the old controller and sent to the new one. The request
+ *       that caused the move waits for the copy.
+ */
+void Dir::movePage(ulong page, int to) {
+    ulong b;
+    int from = pagetable[page].load(std::memory_order_relaxed);
+    DirEntry *de;
+
+    // With the zeroload network copy the blocks one after the other
+    // (see Tile::FlushDirtyBlocks)
+    int parallel = (NETWORK->model == NETCONTEND);
+
+    // Entries can't move under a lock-free reader and a finite
+    // directory would have to make room for them. The page stays put
+    // (main() doesn't allow this combination).
+    if (locking || shards[0]->sparse)
+        return;
+
+    pagetable[page].store(to, std::memory_order_release);
+    pagesmoved++;
+
+    if (parallel)
+        EVENTQ->fork();
+
+    for (b = page*BLKSPERPAGE; b < (page+1)*BLKSPERPAGE; b++) {
+        de = shards[from]->unlink(b);
+        if (de) {
+            shards[to]->insert(de);
+            entriesmoved++;
+        }
+
+        // Not an EVMEM event. The copy isn't the request's own
+        // memory access.
+        if (parallel)
+            EVENTQ->branch();
+        EVENTQ->delay(MEMATIME, shards[from]->mem, EVLOCAL, b << OFFSETBITS);
+        NETWORK->copyDirToDir(b << OFFSETBITS, from, to);
+    }
+
+    if (parallel)
+        EVENTQ->join();
+}
+
+/*
+ * Dir::getShard
+ *     - Find the shard (memory controller) that owns addr.
+ */
+DirShard * Dir::getShard(ulong addr) {
+    return shards[mapAddrToDir(addr)];
+}
+
+/*
+ * Dir::getEntry
+ *     - Find the directory entry for addr in the shard that owns it.
+ *
+ * Returns the DirEntry or NULL if the block isn't tracked.
+ */
+DirEntry * Dir::getEntry(ulong addr) {
+    return shards[mapAddrToDir(addr)]->lookup(BLKADDR(addr));
+}
+
+/*
+ * Dir::sharerTiles
+ *     - Find the tiles a request for addr might send messages to:
+ *       all tiles of every partition the directory entry says (or,
+ *       with an imprecise encoding, can't rule out) has the block. A
+ *       sparse directory may evict any other entry to make room so
+ *       then it could be any tile.
+ *
+ * Returns a mask with a bit set for each tile.
+ */
+ulong Dir::sharerTiles(ulong addr) {
+    ulong blockaddr = BLKADDR(addr);
+    ulong mask = 0;
+    int partid, t;
+    DirEntry *de;
+    DirShard *shard = shards[mapAddrToDir(addr)];
+
+    if (shard->sparse)
+        return (1UL << NPROCS) - 1;
+
+    std::unique_lock<std::mutex> guard;
+    if (locking) {
+        guard = std::unique_lock<std::mutex>(*shard->lockFor(blockaddr));
+        epoch->enter();
+    }
+
+    de = shard->lookup(blockaddr);
+    for (partid = de ? de->sharers->getNextSetBit(0) : -1; partid != -1;
+         partid = de->sharers->getNextSetBit(partid+1))
+        for (t = parttable[partid]->getNextSetBit(0); t != -1;
+             t = parttable[partid]->getNextSetBit(t+1))
+            mask |= 1UL << t;
+
+    if (locking)
+        epoch->exit();
+    return mask;
+}
+
 /*
  * Dir::mapAddrToTile
  *     - Given an address and a partition ID, map them
  *       to a specific tile within the partition. 
  */
-int Dir::mapAddrToTile(int partid, int addr) {
+int Dir::mapAddrToTile(int partid, ulong addr) {
 
     // Get the vector representing the partition
     BitVector *bv = parttable[partid];
@@ -168,49 +375,87 @@ int Dir::mapTileToPart(int tileid) {
  *     - Given a block address use the partitions vectors to determine
  *       what partitions share the block and send invalidations to all
  *       of them. Skip the pid partition.
+ *
+ * Returns the state the owner/forwarder (MOESI/MESIF) was in before
+ * it was invalidated or -1 if it no longer had the block. If hits is
+ * given it is set to the # of sharers that still had the block.
  */
-int Dir::invalidateSharers(int addr, int pid) {
-    int max = 0;
-
-    // Lets play a game with CURRENTDELAY. Since this stuff is
-    // done in parallel we will save off the original value and
-    // then find the max delay of all parallel requests. 
-    ulong origDelay = CURRENTDELAY;
-    CURRENTDELAY  = 0;
+int Dir::invalidateSharers(ulong addr, int pid, int msg, int *hits) {
+    int state;
+    int ownerstate = -1;
+    int invhits = 0;
 
-    // Get the bitvector of sharers.
-    DirEntry  *de = directory[BLKADDR(addr)];
-    BitVector *bv = de->sharers;
+    // Get the sharers.
+    DirEntry  *de = getEntry(addr);
+    Sharers   *bv = de->sharers;
 
     //printf("Sharers are %x\n", bv->vector);
 
     int tileid;
     int partid;
+    int prevtile = -1;
+    int keep = (pid >= 0) ? bv->getBit(pid) : 0;
+    int serial = bv->serial();
+
+    // The invalidations are sent out in parallel so each one is its
+    // own branch. With a sharing list the invalidation is passed from
+    // one sharer on to the next so they happen one after the other.
+    if (!serial)
+        EVENTQ->fork();
 
     // Iterate over sharers and send INV to any that
     // exist. Also clear bit from vector.
-    for(partid=0; partid < bv->size; partid++) {
+    for(partid = bv->getNextSetBit(0); partid != -1;
+        partid = bv->getNextSetBit(partid+1)) {
 
         if (partid == pid)
             continue;
 
-        if (bv->getBit(partid)) {
-
-            // Get the actual tileid of the tile within the
-            // partition that is responsible for addr
-            tileid = mapAddrToTile(partid, addr);
-            NETWORK->sendReqDirToTile(INV, addr, tileid);
-            bv->clearBit(partid);
+        // Imprecise encodings may point at partitions that
+        // currently have no tiles. Skip those.
+        if (parttable[partid]->getNumSetBits() == 0)
+            continue;
 
-            // Update max and reset
-            max = MAX(max, CURRENTDELAY);
-            CURRENTDELAY = 0; // Reset for next iter
-        }
+        if (!serial)
+            EVENTQ->branch();
+
+        // Count invalidations a full bit-vector wouldn't send
+        invs++;
+        if (!bv->isSharer(partid))
+            extrainvs++;
+
+        // Get the actual tileid of the tile within the
+        // partition that is responsible for addr. With a
+        // sharing list the invalidation is passed from one
+        // sharer on to the next rather than sent by the dir.
+        tileid = mapAddrToTile(partid, addr);
+        if (serial && prevtile != -1)
+            state = NETWORK->sendReqTileToTile(msg, addr, prevtile, tileid);
+        else
+            state = NETWORK->sendReqDirToTile(msg, addr, tileid);
+        prevtile = tileid;
+        bv->clearBit(partid);
+        if (state != -1)
+            invhits++;
+
+        // Remember what the owner/forwarder had
+        if (partid == de->location)
+            ownerstate = state;
     }
 
-    // Add the max to the original delay
-    CURRENTDELAY = origDelay + max;
+    // Wait for the last invalidation to be delivered
+    if (!serial)
+        EVENTQ->join();
 
+    // At most pid is left. Imprecise encodings can't clear single
+    // partitions so start them over knowing exactly who is left.
+    bv->clearAllBits();
+    if (keep)
+        bv->setBit(pid);
+
+    if (hits)
+        *hits = invhits;
+    return ownerstate;
 }
 
 /*
@@ -221,7 +466,7 @@ int Dir::invalidateSharers(int addr, int pid) {
  * returns the tile that originally had block in shared state that is
  * the closest to tile.
  */
-int Dir::findClosestSharer(int addr, int tile) {
+int Dir::findClosestSharer(ulong addr, int tile) {
     int minhops = 10000;  // min tile to tile hops
     int closest = -1; // Tile that is closest to tile 
     int distance, tileid, partid;
@@ -229,21 +474,26 @@ int Dir::findClosestSharer(int addr, int tile) {
     // Get the partition that the tile belongs to
     ulong pid = mapTileToPart(tile); 
 
-    // Get the bitvector of sharers.
-    DirEntry  *de = directory[BLKADDR(addr)];
-    BitVector *bv = de->sharers;
+    // Get the sharers.
+    DirEntry  *de = getEntry(addr);
+    Sharers   *bv = de->sharers;
 
     // Iterate over sharers 
-    for(partid=0; partid < bv->size; partid++) {
+    for(partid = bv->getNextSetBit(0); partid != -1;
+        partid = bv->getNextSetBit(partid+1)) {
 
         if (partid == pid)
             continue;
 
-        if (bv->getBit(partid)) {
+        if (parttable[partid]->getNumSetBits()) {
             // Get the actual tileid of the tile within the
             // partition that is responsible for addr
             tileid = mapAddrToTile(partid, addr);
 
+            // Any sharer will do when nothing is timed
+            if (EVENTQ->functional)
+                return tileid;
+
             // Is it the closest tile?
             distance=NETWORK->calcTileToTileHops(tileid, tile);
             if (distance < minhops) {
@@ -264,25 +514,54 @@ int Dir::findClosestSharer(int addr, int tile) {
  *       to find the partition that owns the block. Map the addr
  *       and partid to a specific tile and then send an intervention
  *       to the tile.
+ *
+ * Returns the state the owner was in before the intervention or -1
+ * if no tile had the block.
  */
-int Dir::interveneOwner(int addr) {
-    // Get the bitvector of sharers.
-    DirEntry  *de = directory[BLKADDR(addr)];
-    BitVector *bv = de->sharers;
+int Dir::interveneOwner(ulong addr) {
+    // Get the sharers.
+    DirEntry  *de = getEntry(addr);
+    Sharers   *bv = de->sharers;
 
     int tileid;
     int partid;
+    int state;
+    int ownerstate = -1;
 
     // Iterate over sharers and send INT to any that
     // exist.
-    for(partid=0; partid < bv->size; partid++) {
-        if (bv->getBit(partid)) {
+    for(partid = bv->getNextSetBit(0); partid != -1;
+        partid = bv->getNextSetBit(partid+1)) {
+        if (parttable[partid]->getNumSetBits()) {
             // Get the actual tileid of the tile within the
             // partition that is responsible for addr
             tileid = mapAddrToTile(partid, addr);
-            NETWORK->sendReqDirToTile(INT, addr, tileid);
+            state  = NETWORK->sendReqDirToTile(INT, addr, tileid);
+            if (state != -1)
+                ownerstate = state;
         }
     }
+
+    return ownerstate;
+}
+
+/*
+ * Dir::interveneForwarder
+ *     - Send an intervention to the partition recorded as the owner
+ *       (MOESI) or forwarder (MESIF) of the block so that it will
+ *       supply the data to the requester.
+ *
+ * Returns the state the owner/forwarder was in before the intervention
+ * or -1 if it no longer has the block (i.e. silently evicted).
+ */
+int Dir::interveneForwarder(ulong addr) {
+    DirEntry *de = getEntry(addr);
+
+    if (de->location == -1)
+        return -1;
+
+    int tileid = mapAddrToTile(de->location, addr);
+    return NETWORK->sendReqDirToTile(INT, addr, tileid);
 }
 
 /*
@@ -291,43 +570,53 @@ int Dir::interveneOwner(int addr) {
  *       entry for this given block.
  */
 void Dir::clearStaleSharers(ulong addr) {
-    // Get the bitvector of sharers.
-    DirEntry  *de = directory[BLKADDR(addr)];
-    BitVector *bv = de->sharers;
+    // Get the sharers.
+    DirEntry  *de = getEntry(addr);
+    Sharers   *bv = de->sharers;
 
 
     // Iterate over sharers and clear bit for any that 
     // point to invalid partitions
     int partid;
-    for(partid=0; partid < bv->size; partid++)
-        if (bv->getBit(partid)) 
-            if (parttable[partid]->getNumSetBits() == 0)
-                bv->clearBit(partid);
+    for(partid = bv->getNextSetBit(0); partid != -1;
+        partid = bv->getNextSetBit(partid+1))
+        if (parttable[partid]->getNumSetBits() == 0)
+            bv->clearBit(partid);
+
+    // Forget the owner/forwarder if its partition went away
+    if (de->location != -1 && !bv->getBit(de->location))
+        de->location = -1;
 }
 
 /*
  * Dir::replyData
- *     - Reply data to a requesting block
+ *     - Reply data to a requesting block. If owner is set then
+ *       fromtile is the owner (MOESI) or forwarder (MESIF) of the
+ *       block and will supply the data rather than memory.
  */
-void Dir::replyData(int addr, int fromtile, int totile) {
+void Dir::replyData(ulong addr, int fromtile, int totile, int owner) {
 
     // Is forwarding data requests to other partitions allowed? 
     // If not then just set fromtile to -1
-    if (PARTSHARING == 0)
+    if (PARTSHARING == 0 && !owner)
         fromtile = -1;
 
     // If fromtile == -1 then there is no sharer
     if (fromtile == -1) {
 
         // Had to access memory so add in the delay
-        CURRENTMEMDELAY += MEMATIME;
+        EVENTQ->delay(MEMATIME, getShard(addr)->mem, EVMEM, addr);
         // Reply Data
         NETWORK->fakeDataDirToTile(addr, totile);
 
     } else {
 
+        // Memory did not have to be accessed
+        if (owner)
+            memsaved++;
+
         // Accessed the L2 $ of sending tile
-        CURRENTDELAY += L2ATIME;
+        EVENTQ->delay(L2ATIME);
         // Reply Data - simulate sending from closesttile;
         NETWORK->fakeReqDirToTile(addr, fromtile);     // Fwd req to fromtile
         NETWORK->fakeDataTileToTile(fromtile, totile); // Data fromtile totile
@@ -343,7 +632,7 @@ void Dir::replyData(int addr, int fromtile, int totile) {
  */
 void Dir::setState(ulong addr, int s) {
 
-    DirEntry * de = directory[BLKADDR(addr)];
+    DirEntry * de = getEntry(addr);
     assert(de); // verify de is not NULL
 
     de->state = s; // Set the new state
@@ -351,11 +640,38 @@ void Dir::setState(ulong addr, int s) {
     // If we are going to the invalid state then delete the
     // memory associated with the directory entry.
     if (s == DSTATEI) {
-        delete de;
-        directory[BLKADDR(addr)] = NULL;
+        shards[mapAddrToDir(addr)]->remove(BLKADDR(addr));
+        live--;
     }
 }
 
+/*
+ * Dir::evictEntry
+ *     - The sparse directory needs the entry for blockaddr to make
+ *       room for another block. Back-invalidate every sharer since
+ *       the directory will no longer be able to track them and then
+ *       free the entry.
+ */
+void Dir::evictEntry(ulong blockaddr) {
+
+    ulong addr = blockaddr << OFFSETBITS;
+    DirShard *shard = shards[mapAddrToDir(addr)];
+    int invhits;
+
+    // Send a back-invalidation to all sharers. Skip no partition.
+    ulong sent = invs;
+    invalidateSharers(addr, -1, BINV, &invhits);
+    shard->backinvs += invs - sent;
+
+    // Remember the block was lost to a directory eviction if
+    // any of the sharers actually still had it.
+    if (invhits)
+        shard->markLost(blockaddr);
+
+    shard->remove(blockaddr);
+    live--;
+}
+
 /*
  * Dir::getFromNetwork
  *     - This function serves to receive messages from the
@@ -365,11 +681,49 @@ void Dir::setState(ulong addr, int s) {
  */
 ulong Dir::getFromNetwork(ulong msg, ulong addr, ulong fromtile) {
 
-    // Get the blockaddr
+    // Get the blockaddr and the shard that tracks it
     ulong blockaddr = BLKADDR(addr);
+    ulong victim;
+    ulong l, p;
+    ulong state;
+    DirEntry *de;
+    DirShard *shard = shards[mapAddrToDir(addr)];
+    PROF_SCOPE(PHASEDIR);
+
+    // With locking on, hold the lock that covers this block for the
+    // whole request and don't let entries we look at be freed.
+    std::unique_lock<std::mutex> guard;
+    if (locking) {
+        shard->maybeGrow();
+        guard = std::unique_lock<std::mutex>(*shard->lockFor(blockaddr));
+        epoch->enter();
+    }
+
+    shard->countRequest(msg);
+
+    // Allocate an entry if this block is not tracked yet. A finite
+    // sparse directory may have to evict another block to make room.
+    de = shard->lookup(blockaddr);
+    if (de == NULL) {
+
+        if (shard->sparse && shard->sparse->allocate(blockaddr, &victim))
+            evictEntry(victim);
 
-    if (directory[blockaddr] == NULL)
-        directory[blockaddr] = new DirEntry(blockaddr);
+        shard->insert(new DirEntry(blockaddr,
+            Sharers::create(sharerenc, numparts, sharerptrs)));
+        l = ++live;
+        p = peaklive;
+        while (l > p && !peaklive.compare_exchange_weak(p, l))
+            ;
+
+        // Was this block lost to a back-invalidation? If so then
+        // this is a directory-induced miss.
+        if (shard->checkLost(blockaddr))
+            shard->dirmisses++;
+
+    } else if (shard->sparse) {
+        shard->sparse->touch(blockaddr);
+    }
 
     // Kill any inaccurate sharer information
     clearStaleSharers(addr);
@@ -391,10 +745,12 @@ ulong Dir::getFromNetwork(ulong msg, ulong addr, ulong fromtile) {
             assert(0); // should not get here
     }
 
-    if (directory[blockaddr] == NULL)
-        return DSTATEI;
-    else
-        return directory[blockaddr]->state;
+    de    = shard->lookup(blockaddr);
+    state = de ? de->state : (ulong)DSTATEI;
+
+    if (locking)
+        epoch->exit();
+    return state;
 }
 
 /*
@@ -404,8 +760,10 @@ ulong Dir::getFromNetwork(ulong msg, ulong addr, ulong fromtile) {
  */
 void Dir::netInitRdX(ulong addr, ulong fromtile) {
     int closesttile;
+    int ownertile;
+    int ownerstate;
 
-    DirEntry * de = directory[BLKADDR(addr)];
+    DirEntry * de = getEntry(addr);
 
     // Get the partition that the tile belongs to
     ulong partid = mapTileToPart(fromtile); 
@@ -440,6 +798,30 @@ void Dir::netInitRdX(ulong addr, ulong fromtile) {
             setState(addr, DSTATEEM);
             break;
 
+        // For O (MOESI) and F (MESIF) we need to transition to M
+        // and invalidate all sharers. The owner/forwarder supplies
+        // the data if it still has the block. 
+        case DSTATEO: 
+        case DSTATEF: 
+            // Find the closest sharer and the owner/forwarder
+            closesttile = findClosestSharer(addr, fromtile);
+            ownertile   = -1;
+            if (de->location != -1)
+                ownertile = mapAddrToTile(de->location, addr);
+            // Invalidate all sharers (including owner/forwarder)
+            ownerstate = invalidateSharers(addr, partid);
+            // Reply Data
+            if (ownerstate == STATEO || ownerstate == STATEF)
+                replyData(addr, ownertile, fromtile, 1);
+            else
+                replyData(addr, closesttile, fromtile);
+            // Add new owner to bit map.
+            de->sharers->setBit(partid);
+            de->location = -1;
+            // Transition to EM
+            setState(addr, DSTATEEM);
+            break;
+
         // For invalid state just transition to M
         case DSTATEI: 
             // Reply Data
@@ -463,8 +845,10 @@ void Dir::netInitRdX(ulong addr, ulong fromtile) {
  */
 void Dir::netInitRd(ulong addr, ulong fromtile) {
     int closesttile;
+    int ownerstate;
+    int owner;
 
-    DirEntry * de = directory[BLKADDR(addr)];
+    DirEntry * de = getEntry(addr);
 
     // Get the partition that the tile belongs to
     ulong partid = mapTileToPart(fromtile); 
@@ -477,21 +861,37 @@ void Dir::netInitRd(ulong addr, ulong fromtile) {
         //       information (i.e silently evicted E). Before
         //       transition to S check to see how many sharers
         //       and only go to S if there is more than 1. 
+        // 
+        //       With MOESI/MESIF the previous owner supplies the
+        //       data (if it still has it). With MOESI a dirty owner
+        //       keeps the data in O state rather than flushing it.
+        //       With MESIF the requester becomes the forwarder.
         case DSTATEEM: 
             // Find the closest sharer
             closesttile = findClosestSharer(addr, fromtile);
             // send intervention
-            interveneOwner(addr);
+            ownerstate = interveneOwner(addr);
             // Reply Data
-            replyData(addr, closesttile, fromtile);
+            owner = (PROTOCOL != MESI && closesttile != -1 && ownerstate != -1);
+            replyData(addr, closesttile, fromtile, owner);
             // Add new sharer to bit map.
             de->sharers->setBit(partid);
-            // Transition to S if more than 1 sharer.
-            if (de->sharers->getNumSetBits() > 1)
-                setState(addr, DSTATES);
+            // Transition to S (or O/F) if more than 1 sharer.
+            if (de->sharers->getNumSetBits() > 1) {
+                if (PROTOCOL == MOESI && owner && ownerstate == STATEM) {
+                    de->location = mapTileToPart(closesttile);
+                    setState(addr, DSTATEO);
+                } else if (PROTOCOL == MESIF) {
+                    de->location = partid;
+                    setState(addr, DSTATEF);
+                } else {
+                    setState(addr, DSTATES);
+                }
+            }
             break;
 
-        // For S, no need to change state
+        // For S, no need to change state (unless MESIF, in which
+        // case the requester becomes the forwarder)
         case DSTATES: 
             // Find the closest sharer
             closesttile = findClosestSharer(addr, fromtile);
@@ -499,6 +899,48 @@ void Dir::netInitRd(ulong addr, ulong fromtile) {
             replyData(addr, closesttile, fromtile);
             // Add new sharer to bit map.
             de->sharers->setBit(partid);
+            // Transition to F
+            if (PROTOCOL == MESIF) {
+                de->location = partid;
+                setState(addr, DSTATEF);
+            }
+            break;
+
+        // For O the owner supplies the data and stays the owner.
+        // If the owner no longer has the block then memory
+        // supplies it and we fall back to S.
+        case DSTATEO: 
+            // Find the closest sharer
+            closesttile = findClosestSharer(addr, fromtile);
+            // send intervention to owner
+            ownerstate = interveneForwarder(addr);
+            // Reply Data
+            if (ownerstate == STATEO) {
+                replyData(addr, mapAddrToTile(de->location, addr), fromtile, 1);
+            } else {
+                replyData(addr, closesttile, fromtile);
+                de->location = -1;
+                setState(addr, DSTATES);
+            }
+            // Add new sharer to bit map.
+            de->sharers->setBit(partid);
+            break;
+
+        // For F the forwarder supplies the data (if it still has
+        // it) and then the requester becomes the new forwarder.
+        case DSTATEF: 
+            // Find the closest sharer
+            closesttile = findClosestSharer(addr, fromtile);
+            // send intervention to forwarder
+            ownerstate = interveneForwarder(addr);
+            // Reply Data
+            if (ownerstate == STATEF)
+                replyData(addr, mapAddrToTile(de->location, addr), fromtile, 1);
+            else
+                replyData(addr, closesttile, fromtile);
+            // Add new sharer to bit map. It is the new forwarder.
+            de->sharers->setBit(partid);
+            de->location = partid;
             break;
 
         // For I, transition to EM
@@ -523,7 +965,7 @@ void Dir::netInitRd(ulong addr, ulong fromtile) {
  */
 void Dir::netInitUpgr(ulong addr, ulong fromtile) {
 
-    DirEntry * de = directory[BLKADDR(addr)];
+    DirEntry * de = getEntry(addr);
     // Get the partition that the tile belongs to
     ulong partid = mapTileToPart(fromtile); 
 
@@ -549,6 +991,21 @@ void Dir::netInitUpgr(ulong addr, ulong fromtile) {
             de->sharers->setBit(partid);
             break;
 
+        // For O&F, same as S. Requester (maybe the owner/forwarder
+        // itself) is the only one left with the block. 
+        case DSTATEO:
+        case DSTATEF:
+            de->sharers->clearBit(partid);
+            invalidateSharers(addr, partid);
+            // Reply - no data
+            NETWORK->fakeReqDirToTile(addr, fromtile);
+            // Transition to EM
+            de->location = -1;
+            setState(addr, DSTATEEM);
+            // Add partid back into sharers bit map.
+            de->sharers->setBit(partid);
+            break;
+
         // For I we should never get UPGR because there are
         // no copies in the system.
         case DSTATEI: 
@@ -567,7 +1024,7 @@ void Dir::netInitUpgr(ulong addr, ulong fromtile) {
  */
 void Dir::netInitWB(ulong addr, ulong fromtile) {
 
-    DirEntry * de = directory[BLKADDR(addr)];
+    DirEntry * de = getEntry(addr);
     // Get the partition that the tile belongs to
     ulong partid = mapTileToPart(fromtile); 
 
@@ -582,8 +1039,21 @@ void Dir::netInitWB(ulong addr, ulong fromtile) {
             // XXX need to add mem access time?
             break;
 
-        // For S,I should never get here
+        // For O the owner is writing back its dirty data. Any
+        // sharers left can now get the block from memory.
+        case DSTATEO: 
+            assert(de->location == partid);
+            de->sharers->clearBit(partid);
+            de->location = -1;
+            if (de->sharers->getNumSetBits() == 0)
+                setState(addr, DSTATEI);
+            else
+                setState(addr, DSTATES);
+            break;
+
+        // For S,F,I should never get here
         case DSTATES:
+        case DSTATEF:
         case DSTATEI:
             assert(0);
             break;
@@ -592,3 +1062,167 @@ void Dir::netInitWB(ulong addr, ulong fromtile) {
             assert(0); // should not get here
     }
 }
+
+/*
+ * Dir::resetStats
+ *     - Zero the counters (the directory entries are left alone).
+ */
+void Dir::resetStats() {
+    int i;
+
+    memsaved     = 0;
+    invs         = 0;
+    extrainvs    = 0;
+    peaklive     = live.load();
+    pagesplaced  = 0;
+    pagesmoved   = 0;
+    entriesmoved = 0;
+    for (i=0; i < NDIRS; i++)
+        shards[i]->resetStats();
+}
+
+/*
+ * Dir::checkpoint
+ *     - Save or restore the counters, the page table, the partition
+ *       table and every shard.
+ */
+void Dir::checkpoint(Checkpoint *ck) {
+    int i;
+
+    ck->section(CKSECTION('D','i','r',' '));
+    ck->io(&memsaved);
+    ck->io(&invs);
+    ck->io(&extrainvs);
+    ck->io(&live);
+    ck->io(&peaklive);
+    CKIO(ck, pagesplaced);
+    CKIO(ck, pagesmoved);
+    CKIO(ck, entriesmoved);
+    if (pagetable)
+        ck->io(pagetable, NPAGES * sizeof(pagetable[0]));
+    for (i=0; i < numparts; i++)
+        ck->io(parttable[i], sizeof(BitVector));
+    for (i=0; i < NDIRS; i++)
+        shards[i]->checkpoint(ck, sharerenc, numparts, sharerptrs);
+}
+
+/*
+ * Dir::hasStats
+ *     - Is there anything for PrintStats() to report? A MESI run with
+ *       the default directory and memory prints only the tile stats,
+ *       the same as it always has.
+ */
+int Dir::hasStats() {
+    return PROTOCOL != MESI || memsaved || shards[0]->sparse ||
+           sharerenc != SHRFULL || mapping != MAPBLOCK ||
+           MEMMODEL != MEMFLAT;
+}
+
+/*
+ * Dir::PrintStats
+ *     - Print statistics for the directory.
+ */
+void Dir::PrintStats() {
+    int i, j;
+    ulong reqs, maxreqs = 0, totreqs = 0;
+    ulong maxpeak = 0, totpeak = 0;
+    ulong entries = 0, peak = 0, evictions = 0;
+    ulong backinvs = 0, dirmisses = 0;
+    DirShard *shard;
+
+    // Add up the totals across all shards
+    for (i=0; i < NDIRS; i++) {
+        shard      = shards[i];
+        reqs       = shard->getRequests();
+        totreqs   += reqs;
+        maxreqs    = MAX(maxreqs, reqs);
+        totpeak   += shard->peaklive;
+        maxpeak    = MAX(maxpeak, shard->peaklive.load());
+        backinvs  += shard->backinvs;
+        dirmisses += shard->dirmisses;
+        if (shard->sparse) {
+            entries   += shard->sparse->numEntries;
+            peak      += shard->sparse->peak;
+            evictions += shard->sparse->evictions;
+        }
+    }
+
+    printf("========================================================== (Directory)\n");
+    printf("01. data supplied by owner/forwarder (no mem)   %lu\n",  memsaved.load());
+    if (shards[0]->sparse) {
+        printf("02. sparse directory entries                    %lu\n",  entries);
+        printf("03. sparse directory associativity              %lu\n",  shards[0]->sparse->assoc);
+        printf("04. sparse directory peak occupancy             %lu\n",  peak);
+        printf("05. directory evictions                         %lu\n",  evictions);
+        printf("06. back-invalidations sent                     %lu\n",  backinvs);
+        printf("07. directory-induced misses                    %lu\n",  dirmisses);
+    }
+
+    // Storage for the sharer encoding and the extra invalidations
+    // it caused compared to a full bit-vector.
+    Sharers *s = Sharers::create(sharerenc, numparts, sharerptrs);
+    printf("08. sharer encoding                             %s\n",   SHARERNAMES[sharerenc]);
+    printf("09. sharer bits per directory entry             %d\n",   s->storageBits());
+    printf("10. sharer bits per cached copy                 %d\n",   s->lineBits());
+    printf("11. peak directory entries                      %lu\n",  peaklive.load());
+    printf("12. sharer bits at peak (directory only)        %lu\n",  peaklive * s->storageBits());
+    printf("13. invalidations sent                          %lu\n",  invs.load());
+    printf("14. extra invalidations (imprecise sharers)     %lu\n",  extrainvs.load());
+    delete s;
+
+    // Per shard (memory controller) statistics. The imbalance is the
+    // busiest shard compared to the average (1.00 is perfect balance).
+    printf("15. directory shards                            %d\n",   NDIRS);
+    printf("16. request imbalance (max/mean)                %.2f\n",
+        totreqs ? (double)maxreqs * NDIRS / totreqs : 0.0);
+    printf("17. occupancy imbalance (max/mean peak)         %.2f\n",
+        totpeak ? (double)maxpeak * NDIRS / totpeak : 0.0);
+    printf("    shard         RD        RDX       UPGR         WB       peak    backinv    dirmiss\n");
+    for (i=0; i < NDIRS; i++) {
+        shard = shards[i];
+        printf("    %5d", i);
+        for (j=0; j < NDIRMSGS; j++)
+            printf(" %10lu", shard->requests[j].load());
+        printf(" %10lu %10lu %10lu\n", shard->peaklive.load(), shard->backinvs.load(),
+            shard->dirmisses.load());
+    }
+
+    // Memory controllers. The hops saved are compared to the same
+    // messages going to the controller picked by block interleaving.
+    ulong msgs = NETWORK->memmsgs;
+    printf("========================================================== (Memory)\n");
+    printf("01. memory model                                %s\n",   MEMNAMES[MEMMODEL]);
+    if (MEMMODEL == MEMDRAM)
+        printf("02. write drain policy                          %s\n",   DRAINNAMES[MEMDRAIN]);
+    printf("03. address mapping                             %s\n",   MAPNAMES[mapping]);
+    if (mapping >= MAPFIRSTTOUCH)
+        printf("04. pages placed on first touch                 %lu\n",  pagesplaced);
+    if (mapping == MAPMIGRATE) {
+        printf("05. pages migrated                              %lu\n",  pagesmoved);
+        printf("06. directory entries migrated                  %lu\n",  entriesmoved);
+        printf("07. blocks copied between controllers           %lu\n",  pagesmoved * BLKSPERPAGE);
+    }
+    printf("08. messages to/from memory controllers         %lu\n",  msgs);
+    printf("09. avg hops to/from memory controllers         %.3f\n",
+        msgs ? (double)NETWORK->memhops / msgs : 0.0);
+    printf("10. avg hops with block interleaving            %.3f\n",
+        msgs ? (double)NETWORK->blockhops / msgs : 0.0);
+    printf("11. hop cycles saved vs block interleaving      %ld\n",
+        ((long)NETWORK->blockhops - (long)NETWORK->memhops) * HOPTIME);
+
+    // Per controller DRAM statistics. Bandwidth is over the time
+    // between the first and the last access the controller saw.
+    if (MEMMODEL == MEMFLAT)
+        return;
+    printf("    mc      reads     writes    rowhit   rowmiss  rowconf   passed  avgread  maxread  maxwq  drains  B/kcycle\n");
+    for (i=0; i < NDIRS; i++) {
+        MemCtrl *mc = shards[i]->mem;
+        ulong accesses = mc->reads + mc->writes;
+        ulong span = (accesses && mc->lasttime > mc->firsttime) ? mc->lasttime - mc->firsttime : 0;
+        printf("    %2d %10lu %10lu %9lu %9lu %8lu %8lu %8.1f %8lu %6lu %7lu %9.1f\n",
+            i, mc->reads, mc->writes, mc->rowhits, mc->rowmisses, mc->rowconflicts, mc->passed,
+            mc->reads ? (double)mc->readcycles / mc->reads : 0.0, mc->maxread,
+            mc->maxwq, mc->drains,
+            span ? (double)accesses * BLKSIZE * 1000 / span : 0.0);
+    }
+}
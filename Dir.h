@@ -7,51 +7,118 @@
 #ifndef DIR_H
 #define DIR_H
 
+#include <atomic>
+#include <mutex>
 #include "types.h"
+#include "Net.h"
+#include "SparseDir.h"
+#include "Sharers.h"
+#include "DirShard.h"
 
 class BitVector; // Forward Declaration
+class Checkpoint; // Forward Declaration
 
 // Directory states
 enum {
     DSTATEEM = 100,
     DSTATES,
     DSTATEI,
+    DSTATEO,   // MOESI: dirty owner (location) plus sharers
+    DSTATEF,   // MESIF: clean forwarder (location) plus sharers
 };
 
+// Policies for placing memory on the controllers
+enum {
+    MAPBLOCK = 0,  // Blocks interleaved across the controllers
+    MAPPAGE,       // Pages interleaved across the controllers
+    MAPFIRSTTOUCH, // A page goes to the controller closest to the
+                   // tile that touches it first
+    MAPMIGRATE,    // First touch, and pages follow the process to the
+                   // controller closest to it when it migrates
+};
+
+// Names of the mapping policies (indexed by MAPBLOCK, MAPPAGE, ...)
+extern const char *MAPNAMES[];
+
+// Page table entry for a page that hasn't been placed yet
+#define PAGEUNMAPPED 0xff
+
 class DirEntry {
 
     public:
         ulong blockaddr;
         ulong state;
-        ulong location;
-        BitVector * sharers;
+        int   location; // Owner/forwarder partition (-1 if none)
+        Sharers * sharers;
+        std::atomic<DirEntry*> next; // Next entry in the same shard bucket
 
-        DirEntry(ulong blockaddr);
+        DirEntry(ulong blockaddr, Sharers *s);
         ~DirEntry();
 };
 
 class Dir {
     private:
 
-        DirEntry  **directory;
+        // One shard per memory controller. Each holds the directory
+        // entries (sharers, M/S/I states) for the blocks that map to
+        // its controller.
+        DirShard **shards;
+
+        // Reclaims entries removed while other threads may be
+        // looking at them (only used with locking on)
+        EpochManager *epoch;
+        int           locking;
 
-        // Array of directory entires (1 for each mem block) each containing
-        //  - bitvector representing which parts cache the block
-        //  - M/S/I states
+        // How sharers are encoded in each entry (see Sharers.h)
+        int sharerenc;
+        int sharerptrs;
+
+        // How addresses map to the controllers and, for the first
+        // touch policies, the controller each page was placed on.
+        // Pages are placed under pagelock but looked up without it.
+        int    mapping;
+        std::atomic<uchar> *pagetable;
+        std::mutex pagelock;
+
+        void movePage(ulong page, int to);
+
+        void evictEntry(ulong blockaddr);
 
     public:
         BitVector **parttable; // Table of partitions.
 
         int numparts; // # of partitions in the system
 
-        Dir(int partscheme);
+        std::atomic<ulong> memsaved; // Replies supplied by an owner/forwarder
+                                     // rather than by memory (MOESI/MESIF)
+        std::atomic<ulong> invs;      // Invalidations sent (incl. back-invalidations)
+        std::atomic<ulong> extrainvs; // Invalidations sent to partitions that weren't
+                                      // sharers because of an imprecise encoding
+        std::atomic<ulong> live;      // Directory entries currently allocated
+        std::atomic<ulong> peaklive;  // Max directory entries allocated at once
+
+        // Page placement counters. With locking on pages are placed
+        // under pagelock (and never moved).
+        ulong pagesplaced;  // Pages placed on first touch
+        ulong pagesmoved;   // Pages migrated to another controller
+        ulong entriesmoved; // Directory entries that went with them
+
+        Dir(int partscheme, ulong entries=0, ulong assoc=8, int policy=SDIRLRU,
+            int encoding=SHRFULL, int ptrs=4, int locks=0, int map=MAPBLOCK);
         ~Dir();
-        int mapAddrToTile(int partid, int blockaddr);
+        int mapAddrToDir(ulong addr);
+        void touchPage(ulong addr, int tile);
+        DirEntry * getEntry(ulong addr);
+        DirShard * getShard(ulong addr);
+        ulong sharerTiles(ulong addr);
+        int getLocking() { return locking; }
+        int mapAddrToTile(int partid, ulong addr);
         int mapTileToPart(int tileid);
-        int invalidateSharers(int addr, int partid);
-        int interveneOwner(int addr);
-        int findClosestSharer(int addr, int tile);
-        void replyData(int addr, int fromtile, int totile);
+        int invalidateSharers(ulong addr, int partid, int msg=INV, int *hits=NULL);
+        int interveneOwner(ulong addr);
+        int interveneForwarder(ulong addr);
+        int findClosestSharer(ulong addr, int tile);
+        void replyData(ulong addr, int fromtile, int totile, int owner=0);
         void setState(ulong blockaddr, int s);
         ulong getFromNetwork(ulong msg, ulong addr, ulong fromtile);
         void netInitRdX(ulong blockaddr, ulong partid);
@@ -59,6 +126,10 @@ class Dir {
         void netInitUpgr(ulong blockaddr, ulong partid);
         void netInitWB(ulong addr, ulong fromtile);
         void clearStaleSharers(ulong addr);
+        int  hasStats();
+        void PrintStats();
+        void resetStats();
+        void checkpoint(Checkpoint *ck);
 };
 
 #endif
@@ -0,0 +1,148 @@
+/*
+ * Dusty Mabe - 2014
+ * DirBench.cc - Contention benchmark for a directory shard. Threads
+ *               hammer one shard with a mix of lookups, inserts and
+ *               removes, first with every operation under the shard
+ *               lock (coarse) and then with lock-free lookups and
+ *               stripe locks for updates (fine). Throughput is
+ *               printed for 1, 2, 4, ... threads.
+ *
+ *               usage: ./dirbench [maxthreads] [ops/thread] [% lookups]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <thread>
+#include <chrono>
+#include "CCSM.h"
+#include "Dir.h"
+#include "DirShard.h"
+#include "Epoch.h"
+#include "Event.h"
+#include "params.h"
+
+// Globals the directory code refers to. They are defined in
+// simulator.cc, which isn't linked in here.
+Net *NETWORK;
+thread_local EventQueue *EVENTQ;
+ulong PARTSHARING = 0;
+ulong PROTOCOL    = MESI;
+const char *PROTOCOLNAMES[] = { "MESI", "MOESI", "MESIF" };
+ulong MEMMODEL    = MEMFLAT;
+ulong MEMDRAIN    = DRAINWATERMARK;
+
+// Blocks the threads pick from. Half of them are in the shard at
+// any given time.
+#define BENCHBLOCKS (1 << 16)
+
+enum {
+    BENCHCOARSE = 0,
+    BENCHFINE,
+};
+
+/*
+ * benchThread
+ *     - Run ops random operations against the shard.
+ */
+static void benchThread(DirShard *shard, EpochManager *epoch, int mode,
+                        int id, ulong ops, int lookups, ulong *found) {
+    ulong i, blockaddr;
+    unsigned int seed = id + 1;
+    int r;
+    ulong hits = 0;
+
+    for (i=0; i < ops; i++) {
+        r = rand_r(&seed) % 100;
+        blockaddr = rand_r(&seed) % BENCHBLOCKS;
+
+        // Lookup
+        if (r < lookups) {
+            if (mode == BENCHCOARSE) {
+                std::lock_guard<std::mutex> guard(shard->lock);
+                hits += shard->lookup(blockaddr) != NULL;
+            } else {
+                epoch->enter();
+                hits += shard->lookup(blockaddr) != NULL;
+                epoch->exit();
+            }
+            continue;
+        }
+
+        // Insert or remove (whichever applies) the block
+        shard->maybeGrow();
+        std::mutex *m = (mode == BENCHCOARSE) ? &shard->lock : shard->lockFor(blockaddr);
+        std::lock_guard<std::mutex> guard(*m);
+        if (mode == BENCHFINE)
+            epoch->enter();
+        if (shard->lookup(blockaddr))
+            shard->remove(blockaddr);
+        else
+            shard->insert(new DirEntry(blockaddr, NULL));
+        if (mode == BENCHFINE)
+            epoch->exit();
+    }
+
+    *found = hits;
+}
+
+/*
+ * runBench
+ *     - Time nthreads threads running against a fresh shard.
+ *
+ * Returns millions of operations per second.
+ */
+static double runBench(int mode, int nthreads, ulong ops, int lookups) {
+    int i;
+    ulong b;
+    ulong found[MAXEPOCHTHREADS];
+    EpochManager *epoch = new EpochManager();
+    DirShard *shard = new DirShard(0, 0, 8, 0, 1, epoch);
+    std::thread **threads = new std::thread*[nthreads];
+
+    for (b=0; b < BENCHBLOCKS; b += 2)
+        shard->insert(new DirEntry(b, NULL));
+
+    auto start = std::chrono::steady_clock::now();
+    for (i=0; i < nthreads; i++)
+        threads[i] = new std::thread(benchThread, shard, epoch, mode,
+                                     i, ops, lookups, &found[i]);
+    for (i=0; i < nthreads; i++) {
+        threads[i]->join();
+        delete threads[i];
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    delete[] threads;
+    delete shard;
+    delete epoch;
+
+    double secs = std::chrono::duration<double>(end - start).count();
+    return (nthreads * ops) / secs / 1e6;
+}
+
+int main(int argc, char *argv[]) {
+    int n;
+    int maxthreads = 8;
+    ulong ops      = 1000000;
+    int lookups    = 90;
+
+    if (argc > 1) maxthreads = atoi(argv[1]);
+    if (argc > 2) ops        = atol(argv[2]);
+    if (argc > 3) lookups    = atoi(argv[3]);
+    assert(maxthreads > 0 && maxthreads <= MAXEPOCHTHREADS);
+    assert(lookups >= 0 && lookups <= 100);
+
+    printf("===== Directory shard contention benchmark =====\n");
+    printf("Ops per thread:   %lu\n", ops);
+    printf("Lookups:          %d%%\n", lookups);
+    printf("Host CPUs:        %u\n", std::thread::hardware_concurrency());
+    printf("%8s %14s %14s %8s\n", "threads", "coarse Mops/s", "fine Mops/s", "fine/crs");
+
+    for (n=1; n <= maxthreads; n *= 2) {
+        double coarse = runBench(BENCHCOARSE, n, ops, lookups);
+        double fine   = runBench(BENCHFINE,   n, ops, lookups);
+        printf("%8d %14.2f %14.2f %8.2f\n", n, coarse, fine, fine / coarse);
+    }
+
+    return 0;
+}
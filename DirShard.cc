@@ -0,0 +1,463 @@
+/*
+ * Dusty Mabe - 2014
+ * DirShard.cc - Implementation of one shard (memory controller) of
+ *               the directory.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <thread>
+#include "DirShard.h"
+#include "Dir.h"
+#include "SparseDir.h"
+#include "Sharers.h"
+#include "Checkpoint.h"
+
+// Initial # of hash buckets (log2) for each shard
+#define SHARDBUCKETBITS 16
+
+/*
+ * DirTable constructor/destructor
+ */
+DirTable::DirTable(ulong b) {
+    ulong i;
+
+    bits    = b;
+    buckets = new std::atomic<DirEntry*>[1UL << bits];
+    for (i=0; i < (1UL << bits); i++)
+        buckets[i].store(NULL, std::memory_order_relaxed);
+}
+
+DirTable::~DirTable() {
+    delete[] buckets;
+}
+
+// Functions handed to the EpochManager to free retired objects
+static void freeEntry(void *p) { delete (DirEntry *)p; }
+static void freeTable(void *p) { delete (DirTable *)p; }
+
+/*
+ * DirShard::DirShard - create a new directory shard.
+ * Arguments:
+ *      - i       - the memory controller this shard is for
+ *      - entries - sparse directory entries for this shard (0 = unbounded)
+ *      - assoc   - sparse directory associativity
+ *      - policy  - sparse directory replacement policy
+ *      - locks   - can the shard be used by several threads at once?
+ *      - e       - reclaims removed entries when locks is set
+ */
+DirShard::DirShard(int i, ulong entries, ulong assoc, int policy, int locks,
+                   EpochManager *e) {
+    int j;
+
+    id       = i;
+    locking  = locks;
+    epoch    = e;
+    mem      = new MemCtrl(i);
+    mem->locking = locks;
+    needgrow = 0;
+
+    assert(!locking || epoch);
+    assert(SHARDBUCKETBITS >= STRIPEBITS);
+
+    table   = new DirTable(SHARDBUCKETBITS);
+    version = 0;
+
+    // Initialize counters
+    for (j=0; j < NDIRMSGS; j++)
+        requests[j] = 0;
+    live      = 0;
+    peaklive  = 0;
+    backinvs  = 0;
+    dirmisses = 0;
+
+    lastde     = NULL;
+    sparse     = NULL;
+    lostblocks = NULL;
+    if (entries) {
+        sparse     = new SparseDir(entries, assoc, policy);
+        lostblocks = new ulong[(1 << 26) / (8*sizeof(ulong))]();
+    }
+}
+
+DirShard::~DirShard() {
+    ulong i;
+    DirTable *t = table.load();
+    DirEntry *de, *next;
+
+    for (i=0; i < (1UL << t->bits); i++) {
+        for (de = t->buckets[i].load(); de; de = next) {
+            next = de->next.load();
+            delete de;
+        }
+    }
+    delete t;
+    delete mem;
+    delete sparse;
+    delete[] lostblocks;
+}
+
+/*
+ * DirShard::hash
+ *     - Map a block address to one of 2^bits buckets. The low bits
+ *       of the block address pick the shard so mix all of the bits
+ *       together and use the top bits of the product.
+ */
+ulong DirShard::hash(ulong blockaddr, ulong bits) {
+    return (blockaddr * 0x9E3779B97F4A7C15UL) >> (64 - bits);
+}
+
+/*
+ * DirShard::lockFor
+ *     - Get the lock a request for blockaddr has to hold. This is the
+ *       stripe that covers the block's bucket or, with a sparse
+ *       directory, the lock for the whole shard.
+ */
+std::mutex * DirShard::lockFor(ulong blockaddr) {
+    if (sparse)
+        return &lock;
+    return &stripes[hash(blockaddr, STRIPEBITS)];
+}
+
+/*
+ * DirShard::grow
+ *     - Double the # of buckets and rehash all entries. The caller
+ *       must make sure nobody else is changing the table.
+ */
+void DirShard::grow() {
+    ulong i, b;
+    DirTable *old = table.load(std::memory_order_relaxed);
+    DirTable *t   = new DirTable(old->bits + 1);
+    DirEntry *de, *next;
+
+    // Let lookups know the chains are about to be moved around
+    version.fetch_add(1, std::memory_order_acq_rel);
+
+    for (i=0; i < (1UL << old->bits); i++) {
+        for (de = old->buckets[i].load(std::memory_order_relaxed); de; de = next) {
+            next = de->next.load(std::memory_order_relaxed);
+            b    = hash(de->blockaddr, t->bits);
+            de->next.store(t->buckets[b].load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+            t->buckets[b].store(de, std::memory_order_relaxed);
+        }
+    }
+
+    table.store(t, std::memory_order_release);
+    version.fetch_add(1, std::memory_order_release);
+
+    if (locking)
+        epoch->retire(old, freeTable);
+    else
+        delete old;
+}
+
+/*
+ * DirShard::maybeGrow
+ *     - With locking on, an insert can't grow the table itself (it
+ *       only holds one stripe). Instead it asks for the table to be
+ *       grown and the next request does it before taking any locks.
+ */
+void DirShard::maybeGrow() {
+    int i;
+
+    if (!locking || !needgrow)
+        return;
+
+    // Take every lock in a fixed order. Requests only ever hold one
+    // lock so this can't deadlock.
+    lock.lock();
+    for (i=0; i < NSTRIPES; i++)
+        stripes[i].lock();
+
+    if (needgrow) {
+        grow();
+        needgrow = 0;
+    }
+
+    for (i=NSTRIPES-1; i >= 0; i--)
+        stripes[i].unlock();
+    lock.unlock();
+}
+
+/*
+ * DirShard::lookup
+ *     - Find the entry for blockaddr. This takes no locks.
+ *
+ * Returns the DirEntry or NULL if the block isn't tracked.
+ */
+DirEntry * DirShard::lookup(ulong blockaddr) {
+    DirTable *t;
+    DirEntry *de;
+    ulong v;
+
+    if (!locking && lastde && lastde->blockaddr == blockaddr)
+        return lastde;
+
+    while (1) {
+
+        // Wait out a resize
+        v = version.load(std::memory_order_acquire);
+        if (v & 1) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        t  = table.load(std::memory_order_acquire);
+        de = t->buckets[hash(blockaddr, t->bits)].load(std::memory_order_acquire);
+        for (; de; de = de->next.load(std::memory_order_acquire))
+            if (de->blockaddr == blockaddr)
+                break;
+
+        // If the table wasn't resized underneath us we are done
+        if (version.load(std::memory_order_acquire) == v) {
+            if (!locking && de)
+                lastde = de;
+            return de;
+        }
+    }
+}
+
+/*
+ * DirShard::insert
+ *     - Add a new entry to the shard. With locking on the caller
+ *       must hold lockFor(de->blockaddr).
+ */
+void DirShard::insert(DirEntry *de) {
+    DirTable *t;
+    ulong b, l, p;
+
+    assert(lookup(de->blockaddr) == NULL);
+
+    t = table.load(std::memory_order_acquire);
+    if (live >= 2*(1UL << t->bits)) {
+        if (locking) {
+            needgrow = 1;
+        } else {
+            grow();
+            t = table.load(std::memory_order_acquire);
+        }
+    }
+
+    // Publish the entry at the head of its chain
+    b = hash(de->blockaddr, t->bits);
+    de->next.store(t->buckets[b].load(std::memory_order_relaxed),
+                   std::memory_order_relaxed);
+    t->buckets[b].store(de, std::memory_order_release);
+
+    l = ++live;
+    p = peaklive.load(std::memory_order_relaxed);
+    while (l > p && !peaklive.compare_exchange_weak(p, l))
+        ;
+}
+
+/*
+ * DirShard::unlink
+ *     - Take the entry for blockaddr out of the shard without
+ *       freeing it. With locking on the caller must hold
+ *       lockFor(blockaddr).
+ *
+ * Returns the entry or NULL if blockaddr isn't tracked.
+ */
+DirEntry * DirShard::unlink(ulong blockaddr) {
+    DirTable *t = table.load(std::memory_order_acquire);
+    std::atomic<DirEntry*> *pde;
+    DirEntry *de;
+
+    if (lastde && lastde->blockaddr == blockaddr)
+        lastde = NULL;
+
+    pde = &t->buckets[hash(blockaddr, t->bits)];
+    for (; (de = pde->load(std::memory_order_relaxed)); pde = &de->next) {
+        if (de->blockaddr == blockaddr) {
+            pde->store(de->next.load(std::memory_order_relaxed),
+                       std::memory_order_release);
+            live--;
+            if (sparse)
+                sparse->remove(blockaddr);
+            return de;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * DirShard::remove
+ *     - Remove and free the entry for blockaddr. With locking on the
+ *       caller must hold lockFor(blockaddr) and the entry is freed
+ *       once no reader can still be looking at it.
+ */
+void DirShard::remove(ulong blockaddr) {
+    DirEntry *de = unlink(blockaddr);
+
+    assert(de); // Should be there
+    if (locking)
+        epoch->retire(de, freeEntry);
+    else
+        delete de;
+}
+
+/*
+ * DirShard::markLost
+ *     - Remember that blockaddr was lost to a back-invalidation.
+ */
+void DirShard::markLost(ulong blockaddr) {
+    lostblocks[blockaddr / (8*sizeof(ulong))] |= 1UL << (blockaddr % (8*sizeof(ulong)));
+}
+
+/*
+ * DirShard::checkLost
+ *     - Was blockaddr lost to a back-invalidation? If so then forget
+ *       about it (it is being brought back in now).
+ */
+int DirShard::checkLost(ulong blockaddr) {
+    ulong word = blockaddr / (8*sizeof(ulong));
+    ulong bit  = 1UL << (blockaddr % (8*sizeof(ulong)));
+
+    if (!lostblocks || !(lostblocks[word] & bit))
+        return 0;
+
+    lostblocks[word] &= ~bit;
+    return 1;
+}
+
+/*
+ * DirShard::countRequest
+ *     - Bump the counter for a request of type msg.
+ */
+void DirShard::countRequest(ulong msg) {
+    switch (msg) {
+        case RD:   requests[0]++; break;
+        case RDX:  requests[1]++; break;
+        case UPGR: requests[2]++; break;
+        case WB:   requests[3]++; break;
+        default:
+            assert(0); // Should not get here
+    }
+}
+
+/*
+ * DirShard::getRequests
+ *     - Total requests handled by this shard.
+ */
+ulong DirShard::getRequests() {
+    int i;
+    ulong total = 0;
+    for (i=0; i < NDIRMSGS; i++)
+        total += requests[i];
+    return total;
+}
+
+/*
+ * DirShard::resetStats
+ *     - Zero the counters of the shard, its sparse directory and its
+ *       memory controller. The peaks start over from what is live now.
+ */
+void DirShard::resetStats() {
+    int i;
+    for (i=0; i < NDIRMSGS; i++)
+        requests[i] = 0;
+    peaklive  = live.load();
+    backinvs  = 0;
+    dirmisses = 0;
+    if (sparse) {
+        sparse->allocations = 0;
+        sparse->evictions   = 0;
+        sparse->peak        = sparse->occupancy;
+    }
+    mem->resetStats();
+}
+
+/*
+ * DirShard::checkpoint
+ *     - Save or restore the entries, the lost block bitmap, the
+ *       sparse directory, the memory controller and the counters.
+ *       The entries are saved as one array of fixed size records
+ *       (block, state, location, sharers) and the bitmap as the
+ *       (index, word) pairs that aren't zero. encoding, numparts and
+ *       ptrs are what the Dir creates the sharers of an entry with.
+ */
+void DirShard::checkpoint(Checkpoint *ck, int encoding, int numparts, int ptrs) {
+    ulong i, j, n, nlost;
+    ulong nwords = (1 << 26) / (8*sizeof(ulong));
+    DirTable *t = table.load();
+    DirEntry *de;
+    Sharers  *tmp = Sharers::create(encoding, numparts, ptrs);
+    ulong stride = 3 + (tmp->words() + 1) / 2; // ulongs per entry
+    ulong *recs, *r;
+
+    assert(!locking);
+    delete tmp;
+
+    ck->section(CKSECTION('S','h','r','d'));
+
+    // Directory entries
+    n = live.load();
+    CKIO(ck, n);
+    recs = new ulong[n*stride + 1]();
+    if (ck->saving) {
+        r = recs;
+        for (i=0; i < (1UL << t->bits); i++) {
+            for (de = t->buckets[i].load(); de; de = de->next.load()) {
+                r[0] = de->blockaddr;
+                r[1] = de->state;
+                r[2] = (ulong)(long)de->location;
+                de->sharers->pack((int *)&r[3], 1);
+                r += stride;
+            }
+        }
+        assert(r == recs + n*stride);
+    }
+    ck->io(recs, n*stride*sizeof(ulong));
+    if (!ck->saving) {
+        assert(live == 0); // Restore into a new shard only
+        for (r=recs; r < recs + n*stride; r += stride) {
+            de = new DirEntry(r[0], Sharers::create(encoding, numparts, ptrs));
+            de->state    = r[1];
+            de->location = (int)(long)r[2];
+            de->sharers->pack((int *)&r[3], 0);
+            insert(de);
+        }
+        lastde = NULL;
+    }
+    delete[] recs;
+
+    // Blocks lost to back-invalidations
+    if (sparse) {
+        nlost = 0;
+        if (ck->saving)
+            for (i=0; i < nwords; i++)
+                if (lostblocks[i])
+                    nlost++;
+        CKIO(ck, nlost);
+        recs = new ulong[2*nlost + 1];
+        if (ck->saving) {
+            for (i=0, j=0; i < nwords; i++) {
+                if (lostblocks[i]) {
+                    recs[j++] = i;
+                    recs[j++] = lostblocks[i];
+                }
+            }
+        }
+        ck->io(recs, 2*nlost*sizeof(ulong));
+        if (!ck->saving) {
+            memset(lostblocks, 0, nwords*sizeof(ulong));
+            for (j=0; j < 2*nlost; j += 2)
+                lostblocks[recs[j]] = recs[j+1];
+        }
+        delete[] recs;
+        sparse->checkpoint(ck);
+    }
+
+    // Counters (after the entries since insert() bumps them)
+    for (i=0; i < NDIRMSGS; i++)
+        ck->io(&requests[i]);
+    ck->io(&live);
+    ck->io(&peaklive);
+    ck->io(&backinvs);
+    ck->io(&dirmisses);
+
+    mem->checkpoint(ck);
+}
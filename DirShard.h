@@ -0,0 +1,117 @@
+/*
+ * Dusty Mabe - 2014
+ * DirShard.h - Header file for one shard of the directory. There is
+ *              one shard per memory controller. Each shard has its own
+ *              storage for directory entries, its own (optional) sparse
+ *              directory, its own statistics and optional locks so
+ *              shards can be accessed independently of each other.
+ *
+ *              When locking is on, the shard can be used by several
+ *              threads at once:
+ *                - lookups take no locks. The table has a version
+ *                  number that is odd while it is being resized, and
+ *                  a lookup that overlaps a resize tries again.
+ *                - a request for a block holds the stripe lock that
+ *                  covers the block's bucket. With a finite sparse
+ *                  directory, allocating an entry can evict any block
+ *                  in the shard, so requests take the shard lock.
+ *                - removed entries and old tables are retired through
+ *                  epoch based reclamation (see Epoch.h). A reader
+ *                  never sees freed memory.
+ */
+#ifndef DIRSHARD_H
+#define DIRSHARD_H
+
+#include <mutex>
+#include <atomic>
+#include "types.h"
+#include "Net.h"
+#include "Event.h"
+#include "Epoch.h"
+#include "MemCtrl.h"
+
+class DirEntry;  // Forward Declaration
+class SparseDir; // Forward Declaration
+class Checkpoint; // Forward Declaration
+
+// Number of message types a shard counts (RD, RDX, UPGR, WB)
+#define NDIRMSGS 4
+
+// Number of stripe locks per shard (log2). A stripe covers every
+// bucket whose index has the same top bits, whatever the table size.
+#define STRIPEBITS 6
+#define NSTRIPES   (1 << STRIPEBITS)
+
+// A hash table of directory entries. Entries that hash to the same
+// bucket are chained through DirEntry::next.
+class DirTable {
+    public:
+        ulong bits;                       // log2(# buckets)
+        std::atomic<DirEntry*> *buckets;
+
+        DirTable(ulong b);
+        ~DirTable();
+};
+
+class DirShard {
+    private:
+
+        // The current table. It doubles in size when it gets too full.
+        std::atomic<DirTable*> table;
+        std::atomic<ulong>     version; // Odd while resizing
+        std::atomic<int>       needgrow;
+
+        EpochManager *epoch;
+
+        // Entry found by the last lookup. A request looks its block up
+        // several times so this saves walking the chain again. Only
+        // used without locking (one thread at a time in the shard).
+        DirEntry *lastde;
+
+        ulong hash(ulong blockaddr, ulong bits);
+        void  grow();
+
+    public:
+        int id;          // Which memory controller this shard is for
+        MemCtrl *mem;    // Memory controller (receives the messages
+                         // sent to this shard)
+
+        // Optional finite sparse directory (NULL if unbounded) and a
+        // bitmap of blocks that lost their copies to a back-invalidation
+        // so we can count directory-induced misses.
+        SparseDir *sparse;
+        ulong     *lostblocks;
+
+        // Optional locks for accessing the shard
+        std::mutex lock;
+        std::mutex stripes[NSTRIPES];
+        int        locking;
+
+        // Some counters
+        std::atomic<ulong> requests[NDIRMSGS]; // Requests by type (RD, RDX, UPGR, WB)
+        std::atomic<ulong> live;               // Entries currently allocated
+        std::atomic<ulong> peaklive;           // Max entries allocated at once
+        std::atomic<ulong> backinvs;           // Back-invalidations sent on evictions
+        std::atomic<ulong> dirmisses;          // Misses to blocks lost to a back-inv
+
+        DirShard(int i, ulong entries, ulong assoc, int policy, int locks,
+                 EpochManager *e=NULL);
+        ~DirShard();
+
+        DirEntry * lookup(ulong blockaddr);
+        void insert(DirEntry *de);
+        void remove(ulong blockaddr);
+        DirEntry * unlink(ulong blockaddr);
+
+        std::mutex * lockFor(ulong blockaddr);
+        void maybeGrow();
+
+        void markLost(ulong blockaddr);
+        int  checkLost(ulong blockaddr);
+        void countRequest(ulong msg);
+        ulong getRequests();
+        void  resetStats();
+        void  checkpoint(Checkpoint *ck, int encoding, int numparts, int ptrs);
+};
+
+#endif
@@ -0,0 +1,152 @@
+/*
+ * Dusty Mabe - 2014
+ * Epoch.cc - Implementation of epoch based reclamation.
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include "Epoch.h"
+
+// Each thread's slot in the EpochManager it last used. Managers are
+// numbered so a new one at the same address isn't mistaken for an
+// old one.
+static thread_local ulong EPOCHOWNER = 0;
+static thread_local int   EPOCHID    = -1;
+static std::atomic<ulong> EPOCHSERIALS(0);
+
+EpochManager::EpochManager() {
+    int i, j;
+
+    serial   = ++EPOCHSERIALS;
+    global   = 2;
+    nthreads = 0;
+    freed    = 0;
+    for (i=0; i < MAXEPOCHTHREADS; i++) {
+        announce[i] = 0;
+        retires[i]  = 0;
+        for (j=0; j < 3; j++) {
+            limbo[i][j]      = NULL;
+            limboepoch[i][j] = 0;
+        }
+    }
+}
+
+EpochManager::~EpochManager() {
+    int i, j;
+
+    // Nobody can be looking any more so free everything
+    for (i=0; i < MAXEPOCHTHREADS; i++)
+        for (j=0; j < 3; j++)
+            freeLimbo(i, j);
+}
+
+/*
+ * EpochManager::threadId
+ *     - Get the slot for the calling thread.
+ */
+int EpochManager::threadId() {
+    if (EPOCHOWNER != serial) {
+        EPOCHOWNER = serial;
+        EPOCHID    = nthreads.fetch_add(1);
+        assert(EPOCHID < MAXEPOCHTHREADS);
+    }
+    return EPOCHID;
+}
+
+/*
+ * EpochManager::freeLimbo
+ *     - Free all the objects on one of a thread's limbo lists.
+ */
+void EpochManager::freeLimbo(int id, int slot) {
+    Retired *r, *next;
+
+    for (r = limbo[id][slot]; r; r = next) {
+        next = r->next;
+        r->freefn(r->ptr);
+        delete r;
+        freed++;
+    }
+    limbo[id][slot] = NULL;
+}
+
+/*
+ * EpochManager::collect
+ *     - Free the calling thread's objects that were retired two or
+ *       more epochs ago.
+ */
+void EpochManager::collect(int id) {
+    int j;
+    ulong e = global.load(std::memory_order_acquire);
+
+    for (j=0; j < 3; j++)
+        if (limbo[id][j] && limboepoch[id][j] + 2 <= e)
+            freeLimbo(id, j);
+}
+
+/*
+ * EpochManager::tryAdvance
+ *     - Move the global epoch forward if every thread that is inside
+ *       a critical section has seen the current epoch.
+ */
+void EpochManager::tryAdvance() {
+    int i;
+    ulong a;
+    ulong e = global.load(std::memory_order_acquire);
+    int   n = nthreads.load(std::memory_order_acquire);
+
+    for (i=0; i < n; i++) {
+        a = announce[i].load(std::memory_order_acquire);
+        if ((a & 1) && (a >> 1) != e)
+            return;
+    }
+
+    global.compare_exchange_strong(e, e + 1);
+}
+
+/*
+ * EpochManager::enter
+ *     - Start a critical section.
+ */
+void EpochManager::enter() {
+    int id = threadId();
+    ulong e = global.load(std::memory_order_acquire);
+
+    announce[id].store((e << 1) | 1, std::memory_order_seq_cst);
+    collect(id);
+}
+
+/*
+ * EpochManager::exit
+ *     - End a critical section.
+ */
+void EpochManager::exit() {
+    announce[threadId()].store(0, std::memory_order_release);
+}
+
+/*
+ * EpochManager::retire
+ *     - ptr has been unlinked. Free it (by calling freefn) once no
+ *       thread can still be looking at it.
+ */
+void EpochManager::retire(void *ptr, void (*freefn)(void *)) {
+    int id = threadId();
+    ulong e = global.load(std::memory_order_acquire);
+    int slot = e % 3;
+    Retired *r;
+
+    // The slot may still hold objects from 3 epochs ago
+    if (limbo[id][slot] && limboepoch[id][slot] != e)
+        freeLimbo(id, slot);
+
+    r         = new Retired;
+    r->ptr    = ptr;
+    r->freefn = freefn;
+    r->next   = limbo[id][slot];
+    limbo[id][slot]      = r;
+    limboepoch[id][slot] = e;
+
+    if (++retires[id] % EPOCHRETIRES == 0) {
+        tryAdvance();
+        collect(id);
+    }
+}
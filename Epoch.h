@@ -0,0 +1,61 @@
+/*
+ * Dusty Mabe - 2014
+ * Epoch.h - Header file for epoch based reclamation (EBR).
+ *
+ *           Threads that look at shared objects without taking a lock
+ *           do so inside enter()/exit(). An object that has been
+ *           unlinked is retire()d rather than freed and is only freed
+ *           once every thread that might still be looking at it has
+ *           left its critical section. That happens once the global
+ *           epoch has moved two past the epoch it was retired in.
+ */
+#ifndef EPOCH_H
+#define EPOCH_H
+
+#include <atomic>
+#include "types.h"
+
+// Max # of threads that can use an EpochManager
+#define MAXEPOCHTHREADS 256
+
+// Try to advance the epoch every this many retires
+#define EPOCHRETIRES 64
+
+class Retired {
+    public:
+        void    *ptr;
+        void   (*freefn)(void *);
+        Retired *next;
+};
+
+class EpochManager {
+    private:
+        ulong              serial; // Unique # for this manager
+        std::atomic<ulong> global;
+
+        // Each thread announces the epoch it entered in (shifted left
+        // by one with the low bit set) or 0 if it is not inside.
+        std::atomic<ulong> announce[MAXEPOCHTHREADS];
+        std::atomic<int>   nthreads;
+
+        // Objects each thread retired, one list per epoch (mod 3)
+        Retired *limbo[MAXEPOCHTHREADS][3];
+        ulong    limboepoch[MAXEPOCHTHREADS][3];
+        ulong    retires[MAXEPOCHTHREADS];
+
+        int  threadId();
+        void freeLimbo(int id, int slot);
+        void collect(int id);
+        void tryAdvance();
+
+    public:
+        std::atomic<ulong> freed; // Objects actually freed
+
+        EpochManager();
+        ~EpochManager();
+        void enter();
+        void exit();
+        void retire(void *ptr, void (*freefn)(void *));
+};
+
+#endif
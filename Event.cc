@@ -0,0 +1,382 @@
+/*
+ * Dusty Mabe - 2014
+ * Event.cc - Implementation of the event queue that times requests.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "Event.h"
+#include "Checkpoint.h"
+
+EventQueue::EventQueue() {
+    memset(wheel, 0, sizeof(wheel));
+    memset(wheeltail, 0, sizeof(wheeltail));
+    overflow   = NULL;
+    noverflow  = 0;
+    pending    = 0;
+    freeevents = NULL;
+    freeedges  = NULL;
+    cursor     = NULL;
+    last       = NULL;
+    start      = 0;
+    now        = 0;
+    memtime    = 0;
+    memaccess  = 0;
+    processed  = 0;
+    functional = 0;
+
+    nforks   = 0;
+    maxforks = 16;
+    forkpts  = new Event*[maxforks];
+    joins    = new Event*[maxforks];
+}
+
+EventQueue::~EventQueue() {
+    Event *ev;
+    EventEdge *e;
+
+    while ((ev = freeevents)) {
+        freeevents = ev->next;
+        delete ev;
+    }
+    while ((e = freeedges)) {
+        freeedges = e->next;
+        delete e;
+    }
+    delete[] forkpts;
+    delete[] joins;
+}
+
+/*
+ * EventQueue::newEvent
+ *     - Get an event from the pool (or allocate one if the pool
+ *       is empty) and initialize it.
+ */
+Event * EventQueue::newEvent(int kind, ulong lat, Port *port) {
+    Event *ev = freeevents;
+
+    if (ev)
+        freeevents = ev->next;
+    else
+        ev = new Event;
+
+    ev->kind   = kind;
+    ev->msg    = 0;
+    ev->src    = -1;
+    ev->dst    = -1;
+    ev->addr   = 0;
+    ev->lat    = lat;
+    ev->ready  = 0;
+    ev->time   = 0;
+    ev->npreds = 0;
+    ev->port   = port;
+    ev->succs  = NULL;
+    ev->next   = NULL;
+    return ev;
+}
+
+/*
+ * EventQueue::freeEvent
+ *     - Return an event and its edges to the pools.
+ */
+void EventQueue::freeEvent(Event *ev) {
+    EventEdge *e, *next;
+
+    for (e = ev->succs; e; e = next) {
+        next      = e->next;
+        e->next   = freeedges;
+        freeedges = e;
+    }
+
+    ev->next   = freeevents;
+    freeevents = ev;
+}
+
+/*
+ * EventQueue::addEdge
+ *     - Make event to depend on event from.
+ */
+void EventQueue::addEdge(Event *from, Event *to) {
+    EventEdge *e = freeedges;
+
+    if (e)
+        freeedges = e->next;
+    else
+        e = new EventEdge;
+
+    e->to       = to;
+    e->next     = from->succs;
+    from->succs = e;
+    to->npreds++;
+}
+
+/*
+ * EventQueue::ready
+ *     - All events ev depends on are done at time t. Ask the port
+ *       when it will complete and put it on the queue.
+ */
+void EventQueue::ready(Event *ev, ulong t) {
+    ev->ready = t;
+    if (ev->port)
+        ev->time = ev->port->readyEvent(ev);
+    else
+        ev->time = ev->ready + ev->lat;
+    schedule(ev);
+}
+
+/*
+ * EventQueue::schedule
+ *     - Put an event on the timing wheel (or the overflow list
+ *       if it is too far in the future).
+ */
+void EventQueue::schedule(Event *ev) {
+    Event **pev;
+    ulong slot;
+
+    assert(ev->time >= now); // Can't go back in time
+
+    pending++;
+    ev->next = NULL;
+
+    if (ev->time < now + WHEELSIZE) {
+        slot = ev->time & (WHEELSIZE - 1);
+        if (wheel[slot])
+            wheeltail[slot]->next = ev;
+        else
+            wheel[slot] = ev;
+        wheeltail[slot] = ev;
+        return;
+    }
+
+    // Keep overflow sorted. Events at the same time stay in order.
+    noverflow++;
+    for (pev = &overflow; *pev && (*pev)->time <= ev->time; pev = &(*pev)->next)
+        ;
+    ev->next = *pev;
+    *pev     = ev;
+}
+
+/*
+ * EventQueue::complete
+ *     - Deliver an event and then wake up any events that were
+ *       waiting on it.
+ */
+void EventQueue::complete(Event *ev) {
+    EventEdge *e;
+    Event *to;
+
+    processed++;
+
+    if (ev->port)
+        ev->port->recvEvent(ev);
+
+    if (ev->kind == EVMEM)
+        memtime += ev->time - ev->ready;
+
+    for (e = ev->succs; e; e = e->next) {
+        to = e->to;
+        if (ev->time > to->ready)
+            to->ready = ev->time;
+        if (--to->npreds == 0)
+            ready(to, to->ready);
+    }
+
+    freeEvent(ev);
+}
+
+/*
+ * EventQueue::begin
+ *     - Start building the events for a new request that is
+ *       issued at time t.
+ */
+void EventQueue::begin(ulong t) {
+    Event *root;
+
+    assert(nforks == 0);
+
+    if (functional) {
+        memtime   = 0;
+        memaccess = 0;
+        return;
+    }
+
+    // Nothing is in flight so we are free to move the clock.
+    if (pending == 0)
+        now = t;
+
+    start     = t;
+    memtime   = 0;
+    memaccess = 0;
+
+    root   = newEvent(EVROOT, 0, NULL);
+    cursor = root;
+    last   = root;
+    ready(root, t);
+}
+
+/*
+ * EventQueue::delay
+ *     - Add an event with latency lat that happens after the
+ *       cursor. addr is the address it is about (if any).
+ */
+void EventQueue::delay(ulong lat, Port *port, int kind, ulong addr) {
+    Event *ev;
+
+    // Still count memory accesses so the data can be traced back
+    // to where it came from
+    if (functional) {
+        if (kind == EVMEM)
+            memaccess++;
+        return;
+    }
+
+    ev = newEvent(kind, lat, port);
+
+    ev->addr = addr;
+
+    if (kind == EVMEM)
+        memaccess++;
+
+    addEdge(cursor, ev);
+    cursor = ev;
+    last   = ev;
+}
+
+/*
+ * EventQueue::send
+ *     - Add a network message from endpoint src to endpoint dst
+ *       that takes lat cycles (with no contention) to be delivered.
+ */
+void EventQueue::send(int msg, ulong addr, int src, int dst, ulong lat, Port *port) {
+    if (functional)
+        return;
+    delay(lat, port, EVNET);
+    cursor->msg  = msg;
+    cursor->addr = addr;
+    cursor->src  = src;
+    cursor->dst  = dst;
+}
+
+/*
+ * EventQueue::fork
+ *     - Start a set of parallel branches from the cursor. Each
+ *       branch starts with a call to branch() and the set of
+ *       branches ends with a call to join().
+ */
+void EventQueue::fork() {
+    Event **f, **j;
+
+    if (functional)
+        return;
+
+    if (nforks == maxforks) {
+        maxforks *= 2;
+        f = new Event*[maxforks];
+        j = new Event*[maxforks];
+        memcpy(f, forkpts, nforks * sizeof(Event*));
+        memcpy(j, joins,   nforks * sizeof(Event*));
+        delete[] forkpts;
+        delete[] joins;
+        forkpts = f;
+        joins   = j;
+    }
+
+    forkpts[nforks] = cursor;
+    joins[nforks]   = newEvent(EVJOIN, 0, NULL);
+    nforks++;
+}
+
+/*
+ * EventQueue::branch
+ *     - Start a new branch. The branch before it (if it did
+ *       anything) has to finish before the join.
+ */
+void EventQueue::branch() {
+    if (functional)
+        return;
+    assert(nforks > 0);
+
+    if (cursor != forkpts[nforks-1])
+        addEdge(cursor, joins[nforks-1]);
+    cursor = forkpts[nforks-1];
+}
+
+/*
+ * EventQueue::join
+ *     - Wait for all branches of the innermost fork to finish.
+ */
+void EventQueue::join() {
+    if (functional)
+        return;
+    branch();
+    nforks--;
+    addEdge(forkpts[nforks], joins[nforks]);
+    cursor = joins[nforks];
+    last   = cursor;
+}
+
+/*
+ * EventQueue::run
+ *     - Process events until there are none left.
+ *
+ * Returns the # of cycles from the start of the request until its
+ * last event completed.
+ */
+ulong EventQueue::run() {
+    Event *ev;
+    ulong slot;
+    ulong end = start;
+
+    assert(nforks == 0);
+
+    if (functional)
+        return 0;
+
+    while (pending) {
+
+        // Deliver everything that completes now. Completing an event
+        // may schedule more events for now so keep checking the slot.
+        slot = now & (WHEELSIZE - 1);
+        while ((ev = wheel[slot])) {
+            wheel[slot] = ev->next;
+            pending--;
+            if (ev == last)
+                end = ev->time;
+            complete(ev);
+        }
+
+        if (pending == 0)
+            break;
+
+        // Advance the clock. If only overflow events are left then
+        // jump straight to the first one.
+        if (noverflow == pending)
+            now = overflow->time;
+        else
+            now++;
+
+        // Pull in overflow events that are now within the wheel
+        while (overflow && overflow->time < now + WHEELSIZE) {
+            ev       = overflow;
+            overflow = ev->next;
+            noverflow--;
+            pending--;
+            schedule(ev);
+        }
+    }
+
+    return end - start;
+}
+
+/*
+ * EventQueue::checkpoint
+ *     - Save or restore the clock. This is only done between requests
+ *       when no events are left.
+ */
+void EventQueue::checkpoint(Checkpoint *ck) {
+    assert(pending == 0 && nforks == 0);
+    ck->section(CKSECTION('E','v','Q',' '));
+    CKIO(ck, now);
+    CKIO(ck, processed);
+}
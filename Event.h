@@ -0,0 +1,156 @@
+/*
+ * Dusty Mabe - 2014
+ * Event.h - Header file for the event queue that times memory
+ *           requests. It is a timing model only; the coherence
+ *           protocol is not event-driven.
+ *
+ *           The directory and CCSMs carry out the protocol
+ *           functionally: they change state as soon as a message is
+ *           sent. Every latency along the way is then recorded as a
+ *           timed event. Events depend on each other: a message can't
+ *           be delivered before the message that caused it, and the
+ *           messages that are sent out in parallel (invalidations to
+ *           all sharers, L1 invalidations across a partition) only
+ *           join back up when the last one has been delivered. Running
+ *           the event queue then tells us when the request completed.
+ *           Delivering an event never changes coherence state; ports
+ *           only use it for timing (link and bank reservations).
+ *
+ *           Since the state changes when a message is sent, a tile has
+ *           only one request outstanding. Tile::Access runs the queue
+ *           until the request is done, and only then does the next
+ *           access start. Requests from different tiles do overlap in
+ *           time: the network links and the memory controllers remember
+ *           what they have reserved. Two requests from one tile never
+ *           overlap. That would need transient states in the CCSMs and
+ *           the directory, so the state could change when the messages
+ *           arrive.
+ *
+ *           In functional mode (used to warm the caches while sampling,
+ *           see Sample.h, and to fast-forward) no events are made at
+ *           all. The protocol still runs but every request takes 0
+ *           cycles. The network doesn't look up routes and the
+ *           directory doesn't look for the closest sharer then either.
+ */
+#ifndef EVENT_H
+#define EVENT_H
+
+#include <stddef.h>
+#include "types.h"
+
+class Port;       // Forward Declaration
+class EventEdge;  // Forward Declaration
+class Checkpoint; // Forward Declaration
+
+// Kinds of events
+enum {
+    EVROOT = 0, // Start of a request
+    EVLOCAL,    // Local latency (cache lookup, etc)
+    EVNET,      // Message delivered over the interconnect
+    EVMEM,      // Memory (DRAM) access
+    EVJOIN,     // All parallel branches of a fork have completed
+};
+
+// Size of the timing wheel (must be a power of 2). Events further in
+// the future than this go on a (sorted) overflow list.
+#define WHEELSIZE 1024
+
+class Event {
+    public:
+        int   kind;     // EVROOT, EVLOCAL, EVNET, ..
+        int   msg;      // Network message type (EVNET only)
+        int   src;      // Endpoint sending the message (EVNET only)
+        int   dst;      // Endpoint receiving the message (EVNET only)
+        ulong addr;     // Address the message is about
+        ulong lat;      // Latency of the event when there is no contention
+        ulong ready;    // Time all events this one depends on completed
+        ulong time;     // Time the event completes
+        int   npreds;   // # of events not yet completed that this needs
+        Port *port;     // Component that receives the event (may be NULL)
+
+        EventEdge *succs; // Events that depend on this one
+        Event     *next;  // Next event in wheel slot or free list
+};
+
+// An edge in the dependence graph (from an event to its successor)
+class EventEdge {
+    public:
+        Event     *to;
+        EventEdge *next;
+};
+
+/*
+ * Port - a component that receives events. By default an event
+ *        completes lat cycles after it is ready (no contention).
+ *        Components that model contention override readyEvent to
+ *        push the completion time out.
+ */
+class Port {
+    public:
+        virtual ~Port() {}
+
+        // Called when all events that ev depends on are done.
+        // Returns the time ev will complete.
+        virtual ulong readyEvent(Event *ev) { return ev->ready + ev->lat; }
+
+        // Called when ev completes (is delivered)
+        virtual void recvEvent(Event *) {}
+};
+
+class EventQueue {
+    private:
+
+        // Timing wheel. Slot (t % WHEELSIZE) holds the events that
+        // complete at time t for now <= t < now + WHEELSIZE.
+        Event *wheel[WHEELSIZE];
+        Event *wheeltail[WHEELSIZE];
+        Event *overflow;  // Events beyond the wheel sorted by time
+        ulong  noverflow; // # events on the overflow list
+        ulong  pending;   // Events in the wheel or overflow
+
+        // Pools of free events and edges so we don't hit the allocator
+        Event     *freeevents;
+        EventEdge *freeedges;
+
+        // Cursor used while building up the events of a request. New
+        // events depend on the cursor and then become the cursor.
+        Event *cursor;
+
+        // Stack of open forks. Each holds the event the branches start
+        // from and the join event they all lead to.
+        Event **forkpts;
+        Event **joins;
+        int     nforks;
+        int     maxforks;
+
+        Event *last;   // Last event of the current request
+        ulong  start;  // Time the current request started
+
+        Event *newEvent(int kind, ulong lat, Port *port);
+        void   freeEvent(Event *ev);
+        void   addEdge(Event *from, Event *to);
+        void   ready(Event *ev, ulong t);
+        void   schedule(Event *ev);
+        void   complete(Event *ev);
+
+    public:
+        ulong now;       // Current simulated time
+        ulong memtime;   // Cycles spent in memory by the current request
+        ulong memaccess; // Memory accesses made by the current request
+        ulong processed; // Total events processed
+        int   functional; // Skip the timing (see above)?
+
+        EventQueue();
+        ~EventQueue();
+
+        void  begin(ulong t);
+        void  delay(ulong lat, Port *port=NULL, int kind=EVLOCAL, ulong addr=0);
+        void  send(int msg, ulong addr, int src, int dst, ulong lat, Port *port);
+        void  fork();
+        void  branch();
+        void  join();
+        ulong run();
+        void  checkpoint(Checkpoint *ck);
+};
+
+#endif
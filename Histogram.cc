@@ -0,0 +1,110 @@
+/*
+ * Dusty Mabe - 2014
+ * Histogram.cc - Implementation of the latency histograms.
+ */
+
+#include <string.h>
+#include <assert.h>
+#include "Histogram.h"
+
+Histogram::Histogram() {
+    memset(counts, 0, sizeof(counts));
+    count = 0;
+    sum   = 0;
+    max   = 0;
+}
+
+/*
+ * Histogram::bucket
+ *     - Find the bucket for v. The top bit of v picks the power of
+ *       two and the HISTSUBBITS bits below it pick the bucket within.
+ */
+int Histogram::bucket(ulong v) {
+    int msb;
+
+    if (v < HISTSUB)
+        return v;
+
+    msb = 63 - __builtin_clzl(v);
+    assert(msb < HISTMAXBITS);
+    return (msb - HISTSUBBITS + 1) * HISTSUB + ((v >> (msb - HISTSUBBITS)) & (HISTSUB - 1));
+}
+
+/*
+ * Histogram::bucketTop
+ *     - The largest value that falls in bucket b.
+ */
+ulong Histogram::bucketTop(int b) {
+    int shift;
+
+    if (b < HISTSUB)
+        return b;
+
+    shift = b / HISTSUB - 1;
+    return (((ulong)(HISTSUB + b % HISTSUB) + 1) << shift) - 1;
+}
+
+/*
+ * Histogram::record
+ *     - Count one value.
+ */
+void Histogram::record(ulong v) {
+    counts[bucket(v)]++;
+    count++;
+    sum += v;
+    if (v > max)
+        max = v;
+}
+
+/*
+ * Histogram::add
+ *     - Add the values recorded in h to this histogram (as if each
+ *       had been recorded times times).
+ */
+void Histogram::add(Histogram *h, double times) {
+    int i;
+
+    for (i=0; i < HISTBUCKETS; i++)
+        counts[i] += (ulong)(h->counts[i] * times + 0.5);
+    count += (ulong)(h->count * times + 0.5);
+    sum   += (ulong)(h->sum * times + 0.5);
+    if (h->max > max)
+        max = h->max;
+}
+
+/*
+ * Histogram::reset
+ *     - Forget everything recorded.
+ */
+void Histogram::reset() {
+    memset(counts, 0, sizeof(counts));
+    count = 0;
+    sum   = 0;
+    max   = 0;
+}
+
+/*
+ * Histogram::percentile
+ *     - Find the value that p percent of the recorded values are at
+ *       or below. This is the top of its bucket (but never more than
+ *       the largest value recorded).
+ *
+ * Returns the value or 0 if nothing was recorded.
+ */
+ulong Histogram::percentile(double p) {
+    int i;
+    ulong seen = 0;
+    ulong want = (ulong)(p / 100.0 * count + 0.5);
+
+    if (count == 0)
+        return 0;
+    if (want < 1)
+        want = 1;
+
+    for (i=0; i < HISTBUCKETS; i++) {
+        seen += counts[i];
+        if (seen >= want)
+            return (bucketTop(i) < max) ? bucketTop(i) : max;
+    }
+    return max;
+}
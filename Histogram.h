@@ -0,0 +1,40 @@
+/*
+ * Dusty Mabe - 2014
+ * Histogram.h - Header file for log-bucketed latency histograms (in
+ *               the style of HdrHistogram). Values below 2^HISTSUBBITS
+ *               get a bucket each. Above that every power of two is
+ *               split into 2^HISTSUBBITS buckets, so a bucket is never
+ *               wider than 1/2^HISTSUBBITS of its value. Recording a
+ *               value costs the same no matter how big it is.
+ */
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include "types.h"
+
+#define HISTSUBBITS 4                      // 16 buckets per power of 2
+#define HISTSUB     (1 << HISTSUBBITS)
+#define HISTMAXBITS 40                     // Values up to 2^40 cycles
+#define HISTBUCKETS ((HISTMAXBITS - HISTSUBBITS + 1) * HISTSUB)
+
+class Histogram {
+    private:
+        ulong counts[HISTBUCKETS];
+
+        int   bucket(ulong v);
+        ulong bucketTop(int b);
+
+    public:
+        ulong count; // Values recorded
+        ulong sum;   // Sum of the values
+        ulong max;   // Largest value
+
+        Histogram();
+        void  record(ulong v);
+        void  add(Histogram *h, double times=1.0);
+        void  reset();
+        ulong percentile(double p);
+        double mean() { return count ? (double)sum / count : 0.0; }
+};
+
+#endif
@@ -0,0 +1,116 @@
+/*
+ * Dusty Mabe - 2014
+ * IntervalStats.cc - Implementation of the interval statistics.
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include <chrono>
+#include "IntervalStats.h"
+#include "Tile.h"
+
+// Names of the reasons (indexed by SNAPINTERVAL, SNAPMIGRATE, ...)
+const char *SNAPNAMES[] = { "interval", "migrate", "end" };
+
+/*
+ * IntervalStats constructor
+ *     - Open the file, write the header and start the writer thread.
+ *       A snapshot is taken every n records (0 = only when asked).
+ */
+IntervalStats::IntervalStats(const char *fname, ulong n) {
+    fp = fopen(fname, "w");
+    if (fp == NULL) {
+        printf("Can't open %s\n", fname);
+        exit(1);
+    }
+    fprintf(fp, "seq,records,reason,tile,cycle,accesses,locxfer,ctocxfer,"
+                "ptopxfer,memxfer,l1misses,l2misses,l1wbacks,l2wbacks,flushcycles\n");
+
+    ring   = new TileSnap[SNAPRING];
+    head   = 0;
+    tail   = 0;
+    done   = 0;
+    every  = n;
+    next   = n;
+    seq    = 0;
+    stalls = 0;
+
+    writer = std::thread(&IntervalStats::writeLoop, this);
+}
+
+/*
+ * IntervalStats destructor
+ *     - Let the writer drain the ring and wait for it.
+ */
+IntervalStats::~IntervalStats() {
+    done.store(1, std::memory_order_release);
+    writer.join();
+    fclose(fp);
+    delete[] ring;
+}
+
+/*
+ * IntervalStats::take
+ *     - Copy the counters of every tile into the ring. If the writer
+ *       has fallen a whole ring behind then wait for it.
+ */
+void IntervalStats::take(Tile **tiles, ulong records, int reason) {
+    int i;
+    ulong t = tail.load(std::memory_order_relaxed);
+    TileSnap *s;
+
+    for (i=0; i < NPROCS; i++) {
+        if (t - head.load(std::memory_order_acquire) == SNAPRING) {
+            stalls++;
+            while (t - head.load(std::memory_order_acquire) == SNAPRING)
+                std::this_thread::yield();
+        }
+
+        s = &ring[t % SNAPRING];
+        tiles[i]->Snapshot(s);
+        s->seq     = seq;
+        s->records = records;
+        s->reason  = reason;
+        t++;
+    }
+    tail.store(t, std::memory_order_release);
+
+    seq++;
+    if (every)
+        next = (records / every + 1) * every;
+}
+
+/*
+ * IntervalStats::writeLoop
+ *     - Body of the writer thread. Write out whatever is in the ring
+ *       and sleep when it is empty until told we are done.
+ */
+void IntervalStats::writeLoop() {
+    ulong h = head.load(std::memory_order_relaxed);
+    ulong t;
+    TileSnap *s;
+
+    while (1) {
+        t = tail.load(std::memory_order_acquire);
+        if (h == t) {
+            // Check the tail again after seeing done so nothing
+            // pushed just before it is lost
+            if (done.load(std::memory_order_acquire)) {
+                if (tail.load(std::memory_order_acquire) == h)
+                    break;
+                continue;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        for (; h != t; h++) {
+            s = &ring[h % SNAPRING];
+            fprintf(fp, "%lu,%lu,%s,%d,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu\n",
+                s->seq, s->records, SNAPNAMES[s->reason], s->tile, s->cycle,
+                s->accesses, s->locxfer, s->ctocxfer, s->ptopxfer, s->memxfer,
+                s->l1misses, s->l2misses, s->l1wbacks, s->l2wbacks, s->flushcycles);
+        }
+        head.store(h, std::memory_order_release);
+    }
+}
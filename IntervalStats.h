@@ -0,0 +1,95 @@
+/*
+ * Dusty Mabe - 2014
+ * IntervalStats.h - Header file for interval statistics. Every N trace
+ *                   records (and at every migration) the counters of
+ *                   each tile are copied into a ring buffer that was
+ *                   allocated up front. A background thread drains
+ *                   the ring into a CSV file so the simulation thread
+ *                   only pays for the copy:
+ *
+ *                   seq,records,reason,tile,cycle,accesses,...
+ *
+ *                   The counters are running totals. Take the
+ *                   difference of two snapshots to get an interval.
+ */
+#ifndef INTERVALSTATS_H
+#define INTERVALSTATS_H
+
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+#include "types.h"
+#include "params.h"
+
+class Tile; // Forward Declaration
+
+// Records in the ring (must be a power of 2)
+#define SNAPRING 4096
+
+// Default # of trace records between snapshots
+#define SNAPEVERY 10000
+
+// Why a snapshot was taken
+enum {
+    SNAPINTERVAL = 0, // Another N records were simulated
+    SNAPMIGRATE,      // The process is about to migrate
+    SNAPEND,          // End of the trace
+};
+
+// Names of the reasons (indexed by SNAPINTERVAL, SNAPMIGRATE, ...)
+extern const char *SNAPNAMES[];
+
+// The counters of one tile at one point in time
+class TileSnap {
+    public:
+        ulong seq;         // Snapshot #
+        ulong records;     // Trace records simulated so far
+        int   reason;      // SNAPINTERVAL, SNAPMIGRATE, ...
+        int   tile;
+        ulong cycle;
+        ulong accesses;
+        ulong locxfer;
+        ulong ctocxfer;
+        ulong ptopxfer;
+        ulong memxfer;
+        ulong l1misses;
+        ulong l2misses;
+        ulong l1wbacks;
+        ulong l2wbacks;
+        ulong flushcycles;
+};
+
+class IntervalStats {
+    private:
+        FILE     *fp;
+        TileSnap *ring;
+
+        // Single producer (the simulation) / single consumer (the
+        // writer thread). Slots head..tail-1 hold records to write.
+        std::atomic<ulong> head;
+        std::atomic<ulong> tail;
+        std::atomic<int>   done;
+        std::thread        writer;
+
+        ulong next; // Records at which the next interval snapshot is due
+
+        void writeLoop();
+
+    public:
+        ulong every;  // Records between snapshots (0 = migrations only)
+        ulong seq;    // Snapshots taken
+        ulong stalls; // Times the simulation waited for the writer
+
+        IntervalStats(const char *fname, ulong n);
+        ~IntervalStats();
+        void take(Tile **tiles, ulong records, int reason);
+
+        // Called after every record (or every quantum). Cheap unless
+        // a snapshot is due.
+        void tick(Tile **tiles, ulong records) {
+            if (every && records >= next)
+                take(tiles, records, SNAPINTERVAL);
+        }
+};
+
+#endif
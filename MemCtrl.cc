@@ -0,0 +1,413 @@
+/*
+ * Dusty Mabe - 2014
+ * MemCtrl.cc - Implementation of the DRAM timing model of a memory
+ *              controller.
+ */
+
+#include <stdio.h>
+#include <assert.h>
+#include "MemCtrl.h"
+#include "Net.h"
+#include "Checkpoint.h"
+
+extern ulong MEMMODEL;
+extern ulong MEMDRAIN;
+
+// Names of the memory models and drain policies
+const char *MEMNAMES[]   = { "flat", "dram" };
+const char *DRAINNAMES[] = { "watermark", "eager" };
+
+/*
+ * MemCtrl constructor
+ *     - All banks start out idle with no row open.
+ */
+MemCtrl::MemCtrl(int i) {
+    int j;
+
+    id = i;
+    locking = 0;
+    for (j=0; j < MEMBANKS; j++) {
+        banks[j].openrow = -1;
+        banks[j].readyat = 0;
+        banks[j].nq      = 0;
+        banks[j].donerow = -1;
+        banks[j].doneat  = 0;
+    }
+    busfree = 0;
+    nwq     = 0;
+    last    = 0;
+
+    // Initialize counters
+    reads        = 0;
+    writes       = 0;
+    rowhits      = 0;
+    rowmisses    = 0;
+    rowconflicts = 0;
+    passed       = 0;
+    readcycles   = 0;
+    maxread      = 0;
+    drains       = 0;
+    maxwq        = 0;
+    firsttime    = (ulong)-1;
+    lasttime     = 0;
+}
+
+/*
+ * MemCtrl::resetStats
+ *     - Zero the counters. The banks and write queue are left alone.
+ */
+void MemCtrl::resetStats() {
+    reads        = 0;
+    writes       = 0;
+    rowhits      = 0;
+    rowmisses    = 0;
+    rowconflicts = 0;
+    passed       = 0;
+    readcycles   = 0;
+    maxread      = 0;
+    drains       = 0;
+    maxwq        = nwq;
+    firsttime    = (ulong)-1;
+    lasttime     = 0;
+}
+
+/*
+ * MemCtrl::checkpoint
+ *     - Save or restore the banks, the write queue and the counters.
+ */
+void MemCtrl::checkpoint(Checkpoint *ck) {
+    ck->section(CKSECTION('M','e','m','C'));
+    CKIO(ck, banks);
+    CKIO(ck, busfree);
+    CKIO(ck, wqaddr);
+    CKIO(ck, wqtime);
+    CKIO(ck, nwq);
+    CKIO(ck, last);
+    CKIO(ck, reads);
+    CKIO(ck, writes);
+    CKIO(ck, rowhits);
+    CKIO(ck, rowmisses);
+    CKIO(ck, rowconflicts);
+    CKIO(ck, passed);
+    CKIO(ck, readcycles);
+    CKIO(ck, maxread);
+    CKIO(ck, drains);
+    CKIO(ck, maxwq);
+    CKIO(ck, firsttime);
+    CKIO(ck, lasttime);
+}
+
+/*
+ * MemCtrl::mapAddr
+ *     - Find the bank and row of a block. The low bits of the block
+ *       address picked this controller so drop them. Consecutive
+ *       blocks then fill a row before moving on to the next bank.
+ */
+void MemCtrl::mapAddr(ulong blockaddr, int *bank, long *row) {
+    ulong local = blockaddr / NDIRS;
+
+    *bank = (local / MEMROWBLKS) % MEMBANKS;
+    *row  = local / (MEMROWBLKS * MEMBANKS);
+}
+
+/*
+ * MemCtrl::access
+ *     - Work out when an access to blockaddr that reaches the
+ *       controller at time t would finish. If commit is set then
+ *       the access is carried out: the bank and bus are taken, the
+ *       row stays open and the access goes on the bank's queue.
+ *       read says whether it is a read or a write.
+ *
+ * Returns the time the last of the data is on the bus.
+ */
+ulong MemCtrl::access(ulong blockaddr, ulong t, int commit, int read) {
+    MemBank *b;
+    int bank;
+    long row;
+    ulong start, lat, data;
+
+    mapAddr(blockaddr, &bank, &row);
+    b = &banks[bank];
+
+    start = MAX(t + MEMCTRLTIME, b->readyat);
+    if (b->openrow == row)
+        lat = MEMTCAS;
+    else if (b->openrow == -1)
+        lat = MEMTRCD + MEMTCAS;
+    else
+        lat = MEMTRP + MEMTRCD + MEMTCAS;
+
+    // Wait for the data bus
+    data = MAX(start + lat, busfree) + MEMTBURST;
+
+    if (commit) {
+        if (b->openrow == row)
+            rowhits++;
+        else if (b->openrow == -1)
+            rowmisses++;
+        else
+            rowconflicts++;
+
+        // Make room on the queue by forgetting the oldest access
+        if (b->nq == MEMBQSIZE)
+            retire(b, b->qstart[0]);
+        b->qrow[b->nq]   = row;
+        b->qstart[b->nq] = start;
+        b->qdone[b->nq]  = data;
+        b->qread[b->nq]  = read;
+        b->nq++;
+
+        b->openrow = row;
+        b->readyat = data;
+        busfree    = data;
+    }
+
+    return data;
+}
+
+/*
+ * MemCtrl::retire
+ *     - Drop the accesses at the front of bank b's queue that have
+ *       started by time t. Nothing can go ahead of them any more.
+ */
+void MemCtrl::retire(MemBank *b, ulong t) {
+    int i, n = 0;
+
+    while (n < b->nq && b->qstart[n] <= t) {
+        b->donerow = b->qrow[n];
+        b->doneat  = b->qdone[n];
+        n++;
+    }
+    if (n == 0)
+        return;
+
+    b->nq -= n;
+    for (i=0; i < b->nq; i++) {
+        b->qrow[i]   = b->qrow[i+n];
+        b->qstart[i] = b->qstart[i+n];
+        b->qdone[i]  = b->qdone[i+n];
+        b->qread[i]  = b->qread[i+n];
+    }
+}
+
+/*
+ * MemCtrl::passRead
+ *     - A read of blockaddr reaches the controller at time t. If
+ *       reads to other rows are waiting in its bank's queue and the
+ *       row open ahead of them is the one it wants then serve it
+ *       first (FR-FCFS). The reads it passed, and everything after
+ *       them, are pushed back.
+ *
+ * Returns the time the data is on the bus, or 0 if the read has to
+ * wait its turn.
+ */
+ulong MemCtrl::passRead(ulong blockaddr, ulong t) {
+    MemBank *b;
+    int bank, i, p;
+    long row, prevrow;
+    ulong start, data, shift;
+
+    mapAddr(blockaddr, &bank, &row);
+    b = &banks[bank];
+
+    retire(b, t + MEMCTRLTIME);
+    if (b->nq == MEMBQSIZE)
+        return 0;
+
+    // Go back over the waiting reads to other rows
+    for (p = b->nq; p > 0; p--)
+        if (!b->qread[p-1] || b->qrow[p-1] == row)
+            break;
+    if (p == b->nq)
+        return 0;
+
+    // Only worth it if the row is still open there
+    prevrow = p ? b->qrow[p-1] : b->donerow;
+    if (prevrow != row)
+        return 0;
+
+    start = MAX(t + MEMCTRLTIME, p ? b->qdone[p-1] : b->doneat);
+    data  = start + MEMTCAS + MEMTBURST;
+
+    // Push back the reads that were passed
+    shift = data > b->qstart[p] ? data - b->qstart[p] : 0;
+    for (i = b->nq; i > p; i--) {
+        b->qrow[i]   = b->qrow[i-1];
+        b->qstart[i] = b->qstart[i-1] + shift;
+        b->qdone[i]  = b->qdone[i-1] + shift;
+        b->qread[i]  = b->qread[i-1];
+    }
+    b->qrow[p]   = row;
+    b->qstart[p] = start;
+    b->qdone[p]  = data;
+    b->qread[p]  = 1;
+    b->nq++;
+
+    b->readyat += shift;
+    busfree     = MAX(busfree, b->readyat);
+
+    rowhits++;
+    passed++;
+    return data;
+}
+
+/*
+ * MemCtrl::pickWrite
+ *     - Pick the next write to do (FR-FCFS): the oldest write to a
+ *       row that is open, or else the oldest write.
+ *
+ * Returns the index of the write in the queue.
+ */
+int MemCtrl::pickWrite() {
+    int i, bank;
+    long row;
+
+    assert(nwq > 0);
+    for (i=0; i < nwq; i++) {
+        mapAddr(wqaddr[i], &bank, &row);
+        if (banks[bank].openrow == row)
+            return i;
+    }
+    return 0;
+}
+
+/*
+ * MemCtrl::doWrite
+ *     - Carry out queued write i no earlier than time t and take it
+ *       off the queue.
+ */
+void MemCtrl::doWrite(int i, ulong t) {
+    access(wqaddr[i], MAX(t, wqtime[i]), 1);
+    writes++;
+
+    // Keep the rest in arrival order
+    nwq--;
+    for (; i < nwq; i++) {
+        wqaddr[i] = wqaddr[i+1];
+        wqtime[i] = wqtime[i+1];
+    }
+}
+
+/*
+ * MemCtrl::drainWrites
+ *     - Do queued writes starting at time t until only upto are left.
+ */
+void MemCtrl::drainWrites(ulong t, int upto) {
+    while (nwq > upto)
+        doWrite(pickWrite(), t);
+}
+
+/*
+ * MemCtrl::idleWrites
+ *     - Something arrives at time t. Do the queued writes that the
+ *       controller could have finished while it was idle before then.
+ */
+void MemCtrl::idleWrites(ulong t) {
+    int i;
+
+    while (nwq > 0) {
+        i = pickWrite();
+        if (access(wqaddr[i], wqtime[i], 0) > t)
+            break;
+        doWrite(i, wqtime[i]);
+    }
+}
+
+/*
+ * MemCtrl::catchUp
+ *     - Note that an access reached the controller at time t. If the
+ *       clock went back (another tile that is behind is running)
+ *       then forget when the banks and bus are busy. The open rows
+ *       and queued writes are kept.
+ */
+void MemCtrl::catchUp(ulong t) {
+    int i;
+
+    if (t + MEMWINDOW < last) {
+        for (i=0; i < MEMBANKS; i++) {
+            banks[i].readyat = 0;
+            banks[i].nq      = 0;
+            banks[i].donerow = banks[i].openrow;
+            banks[i].doneat  = 0;
+        }
+        busfree = 0;
+        for (i=0; i < nwq; i++)
+            wqtime[i] = MIN(wqtime[i], t);
+    }
+
+    last      = t;
+    firsttime = MIN(firsttime, t);
+    lasttime  = MAX(lasttime, t);
+}
+
+/*
+ * MemCtrl::readyEvent
+ *     - A read (EVMEM event) is ready to go to memory.
+ *
+ * Returns the time the data is read out.
+ */
+ulong MemCtrl::readyEvent(Event *ev) {
+    ulong t = ev->ready;
+    ulong done;
+
+    if (MEMMODEL == MEMFLAT)
+        return ev->ready + ev->lat;
+
+    std::unique_lock<std::mutex> guard;
+    if (locking)
+        guard = std::unique_lock<std::mutex>(lock);
+
+    catchUp(t);
+    if (MEMDRAIN == DRAINWATERMARK)
+        idleWrites(t);
+
+    done = passRead(BLKADDR(ev->addr), t);
+    if (!done)
+        done = access(BLKADDR(ev->addr), t, 1, 1);
+
+    reads++;
+    readcycles += done - t;
+    maxread     = MAX(maxread, done - t);
+    return done;
+}
+
+/*
+ * MemCtrl::recvEvent
+ *     - A message for this controller was delivered. Dirty blocks
+ *       that are written back (WB) or flushed (FLUSH) to memory
+ *       become writes.
+ */
+void MemCtrl::recvEvent(Event *ev) {
+    ulong t = ev->time;
+
+    if (MEMMODEL == MEMFLAT || ev->kind != EVNET)
+        return;
+    if (ev->msg != WB && ev->msg != FLUSH)
+        return;
+
+    std::unique_lock<std::mutex> guard;
+    if (locking)
+        guard = std::unique_lock<std::mutex>(lock);
+
+    catchUp(t);
+
+    if (MEMDRAIN == DRAINEAGER) {
+        access(BLKADDR(ev->addr), t, 1);
+        writes++;
+        return;
+    }
+
+    idleWrites(t);
+
+    assert(nwq < MEMWQSIZE);
+    wqaddr[nwq] = BLKADDR(ev->addr);
+    wqtime[nwq] = t;
+    nwq++;
+    maxwq = MAX(maxwq, (ulong)nwq);
+
+    // Too many writes waiting. Drain them now and make reads wait.
+    if (nwq >= MEMWQHIGH) {
+        drains++;
+        drainWrites(t, MEMWQLOW);
+    }
+}
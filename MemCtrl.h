@@ -0,0 +1,129 @@
+/*
+ * Dusty Mabe - 2014
+ * MemCtrl.h - Header file for the DRAM timing model of a memory
+ *             controller. There is one controller per directory shard.
+ *
+ *             Reads are the EVMEM events of requests that had to go to
+ *             memory. Writes are the dirty blocks that arrive in WB and
+ *             FLUSH messages. Nobody waits for a write, so writes sit
+ *             in a write queue until the controller gets to them:
+ *               - watermark - writes are done while the controller
+ *                             would otherwise be idle. If the queue
+ *                             reaches MEMWQHIGH it is drained down to
+ *                             MEMWQLOW and reads wait for the drain.
+ *               - eager     - writes are done as soon as they arrive.
+ *             Queued writes are picked FR-FCFS: the oldest write to an
+ *             open row first, else the oldest write.
+ *
+ *             Each bank keeps its row open after an access, so an
+ *             access is a row hit, a miss (no row open) or a conflict
+ *             (another row open). All banks share one data bus.
+ *
+ *             Each bank also keeps a queue of the accesses it has been
+ *             given. Reads are picked FR-FCFS too: a read that hits the
+ *             row open ahead of reads still waiting in its bank's queue
+ *             goes before them (but never before a write or an older
+ *             read to the same row). The waiting reads then start
+ *             later, and so does anything after them. Their own finish
+ *             times were handed back to the event engine as soon as
+ *             they were ready, though, so that part of the cost isn't
+ *             charged to them. It shows up in the later accesses to the
+ *             bank instead.
+ */
+#ifndef MEMCTRL_H
+#define MEMCTRL_H
+
+#include <mutex>
+#include "types.h"
+#include "params.h"
+#include "Event.h"
+
+class Checkpoint; // Forward Declaration
+
+// Memory models
+enum {
+    MEMFLAT = 0, // Every read takes MEMATIME. Writes are free.
+    MEMDRAM,     // Banks, row buffers and queues
+};
+
+// Write drain policies for the dram model
+enum {
+    DRAINWATERMARK = 0,
+    DRAINEAGER,
+};
+
+// Names of the memory models and drain policies
+extern const char *MEMNAMES[];
+extern const char *DRAINNAMES[];
+
+// If a controller sees an access this many cycles before the last
+// one then the clock went backwards (a tile that is behind the others
+// is running) and the bank and bus timing is forgotten.
+#define MEMWINDOW 4096
+
+class MemBank {
+    public:
+        long  openrow; // Row in the row buffer (-1 if none)
+        ulong readyat; // Time the bank can start another access
+
+        // Accesses scheduled on the bank in the order it does them.
+        // The ones that have started are dropped from the front.
+        long  qrow[MEMBQSIZE];   // Row of the access
+        ulong qstart[MEMBQSIZE]; // Time the access starts
+        ulong qdone[MEMBQSIZE];  // Time its data is on the bus
+        int   qread[MEMBQSIZE];  // Is it a read?
+        int   nq;
+        long  donerow; // Row open once the dropped accesses are done
+        ulong doneat;  // Time the dropped accesses are done
+};
+
+class MemCtrl : public Port {
+    private:
+        MemBank banks[MEMBANKS];
+        ulong   busfree;  // Time the data bus is free
+
+        // Write queue in arrival order
+        ulong wqaddr[MEMWQSIZE];
+        ulong wqtime[MEMWQSIZE];
+        int   nwq;
+
+        ulong last; // Time of the latest access seen
+
+        std::mutex lock; // Held for each access (with locking on)
+
+        void  mapAddr(ulong blockaddr, int *bank, long *row);
+        ulong access(ulong blockaddr, ulong t, int commit, int read=0);
+        void  retire(MemBank *b, ulong t);
+        ulong passRead(ulong blockaddr, ulong t);
+        int   pickWrite();
+        void  doWrite(int i, ulong t);
+        void  drainWrites(ulong t, int upto);
+        void  idleWrites(ulong t);
+        void  catchUp(ulong t);
+
+    public:
+        int id;      // Which controller this is
+        int locking; // Can several threads use the controller at once?
+
+        // Some counters
+        ulong reads;        // Reads done
+        ulong writes;       // Writes done
+        ulong rowhits;      // Accesses to the open row
+        ulong rowmisses;    // Accesses to a bank with no open row
+        ulong rowconflicts; // Accesses that had to close another row
+        ulong passed;       // Reads served ahead of older reads
+        ulong readcycles;   // Total cycles from read ready to data
+        ulong maxread;      // Longest read
+        ulong drains;       // Times the write queue hit MEMWQHIGH
+        ulong maxwq;        // Deepest the write queue got
+        ulong firsttime;    // Time of the earliest access
+        ulong lasttime;     // Time of the latest access
+
+        MemCtrl(int i);
+        void  resetStats();
+        void  checkpoint(Checkpoint *ck);
+        ulong readyEvent(Event *ev);
+        void  recvEvent(Event *ev);
+};
+
+#endif
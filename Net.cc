@@ -3,66 +3,393 @@
  * Net.cc - Implementation of interconnection network.
  */
 
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include "Net.h"
 #include "Dir.h"
 #include "Tile.h"
+#include "Cache.h"
 #include "types.h"
 #include "params.h"
+#include "Event.h"
+#include "Profile.h"
+#include "Checkpoint.h"
 
-// Global delay counter for the current outstanding memory request.
-extern int CURRENTDELAY;
+// Global event queue is defined in simulator.cc
+extern thread_local EventQueue *EVENTQ;
 
-Net::Net(Dir * dirr, Tile ** tiless) {
+const char *NETNAMES[] = { "zeroload", "contention" };
+
+const char *MSGNAMES[] = {
+    "INV", "INT", "BINV", "RD", "RDX", "UPGR", "WB", "L1INV",
+    "L2RD", "L2WR", "XFER", "REPLY", "DATA", "FLUSH"
+};
+
+Link::Link() {
+    base    = 0;
+    flits   = 0;
+    waited  = 0;
+    dropped = 0;
+    memset(slots, 0, sizeof(slots));
+    memset(msgflits, 0, sizeof(msgflits));
+}
+
+/*
+ * Link::busy
+ *     - Is a flit crossing the link in cycle c? c must be in the window.
+ */
+int Link::busy(ulong c) {
+    return (slots[(c / 64) % LINKWORDS] >> (c % 64)) & 1;
+}
+
+/*
+ * Link::take
+ *     - Mark cycle c as used. c must be in the window.
+ */
+void Link::take(ulong c) {
+    slots[(c / 64) % LINKWORDS] |= 1UL << (c % 64);
+}
+
+/*
+ * Link::slide
+ *     - Move the window forward so that it ends with cycle c. The
+ *       words that fall off the front get reused for the new cycles.
+ *       Reservations in them at or after t (the time the message
+ *       asking for c is ready) were still to come and are counted
+ *       as forgotten.
+ */
+void Link::slide(ulong c, ulong t) {
+    ulong w, first;
+    ulong newbase = (c / 64 + 1) * 64 - LINKWINDOW;
+
+    first = base / 64;
+    if (newbase - base >= LINKWINDOW)
+        newbase = base + LINKWINDOW;
+    for (w = first; w < newbase / 64; w++) {
+        if ((w + 1) * 64 > t)
+            dropped += __builtin_popcountl(slots[w % LINKWORDS]);
+        slots[w % LINKWORDS] = 0;
+    }
+    base = (c / 64 + 1) * 64 - LINKWINDOW;
+}
+
+/*
+ * Link::slideBack
+ *     - Move the window back so that it starts with cycle c. The
+ *       words at the end of the window get reused for the new
+ *       cycles and the reservations in them are forgotten.
+ */
+void Link::slideBack(ulong c) {
+    ulong w;
+    ulong newbase = c / 64 * 64;
+
+    if (base - newbase >= LINKWINDOW) {
+        for (w=0; w < LINKWORDS; w++)
+            dropped += __builtin_popcountl(slots[w]);
+        memset(slots, 0, sizeof(slots));
+    } else {
+        for (w = newbase / 64; w < base / 64; w++) {
+            dropped += __builtin_popcountl(slots[w % LINKWORDS]);
+            slots[w % LINKWORDS] = 0;
+        }
+    }
+    base = newbase;
+}
+
+/*
+ * Link::reserve
+ *     - Find the first cycle at or after t where nflits flits can
+ *       cross the link back to back and reserve them.
+ *
+ * Returns the cycle the first flit crosses the link.
+ */
+ulong Link::reserve(ulong t, int nflits) {
+    ulong s, c;
+    int i;
+
+    // If t is before the window then the clock went backwards (i.e.
+    // a tile that is behind the others is running). Move the window
+    // back to t. Only the reservations that no longer fit at the end
+    // of it are forgotten.
+    if (t < base)
+        slideBack(t);
+
+    for (s = t, i = 0; i < nflits; ) {
+        c = s + i;
+        if (c >= base + LINKWINDOW)
+            slide(c, t);
+        if (busy(c)) {
+            s = c + 1;
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+
+    for (i=0; i < nflits; i++)
+        take(s + i);
+
+    waited += s - t;
+    return s;
+}
+
+/*
+ * Net constructor
+ *     - m is the network model to use (NETZEROLOAD or NETCONTEND) and
+ *       topology the way the routers are connected (TOPOMESH, ..).
+ */
+Net::Net(Dir * dirr, Tile ** tiless, int m, int topology) {
     dir   = dirr;
     tiles = tiless;
+    model = m;
+    locking = 0;
+
+    topo   = Topology::create(topology);
+    nlinks = topo->numLinks();
+    links  = new Link[nlinks];
+
+    msgs    = 0;
+    flits   = 0;
+    queued  = 0;
+    qcycles = 0;
+    memmsgs   = 0;
+    memhops   = 0;
+    blockhops = 0;
+
+#ifdef STATS
+    memset(msgcount, 0, sizeof(msgcount));
+    for (int i=0; i < NMSGTYPES; i++)
+        STAT_REGISTER("net", MSGNAMES[i], &msgcount[i]);
+#endif
+
+    series     = NULL;
+    nintervals = 0;
+    interval   = 0;
+}
+
+Net::~Net() {
+    delete[] links;
+    delete topo;
+    free(series);
+}
+
+/*
+ * Net::trackSeries
+ *     - Start keeping a time series of the flits that cross each
+ *       link in every interval of the given # of cycles.
+ */
+void Net::trackSeries(ulong cycles) {
+    assert(cycles > 0);
+    interval = cycles;
+}
+
+/*
+ * Net::addToSeries
+ *     - Count nflits crossing link at time t in the time series.
+ */
+void Net::addToSeries(int link, ulong t, int nflits) {
+    ulong i = t / interval;
+    ulong n;
+
+    // Make room for interval i (and then some)
+    if (i >= nintervals) {
+        n = nintervals ? nintervals : 64;
+        while (n <= i)
+            n *= 2;
+        series = (ulong *)realloc(series, n * nlinks * sizeof(ulong));
+        assert(series);
+        memset(series + nintervals*nlinks, 0, (n - nintervals) * nlinks * sizeof(ulong));
+        nintervals = n;
+    }
+
+    series[i*nlinks + link] += nflits;
+}
+
+/*
+ * Net::hop
+ *     - A message of type msg whose head reaches link at time t
+ *       crosses it. Only the contention model makes it wait for the
+ *       link.
+ *
+ * Returns the time the head reaches the next router.
+ */
+ulong Net::hop(int link, ulong t, int nflits, int msg) {
+    Link *l = &links[link];
+    ulong s = t;
+
+    l->flits += nflits;
+    l->msgflits[MSGINDEX(msg)] += nflits;
+
+    if (model == NETCONTEND) {
+        s = l->reserve(t, nflits);
+        qcycles += s - t;
+    }
+
+    if (interval)
+        addToSeries(link, s, nflits);
+    return s + HOPTIME;
+}
+
+/*
+ * Net::route
+ *     - Send ev over the links of its route (see Topology.h). Every
+ *       link on the way counts the flits.
+ *
+ * Returns the time the tail of the message is delivered (only
+ * meaningful for the contention model).
+ */
+ulong Net::route(Event *ev) {
+    int i;
+    int msg    = ev->msg;
+    int nflits = HASDATA(msg) ? DATAFLITS : 1;
+    int nhops  = topo->hops(ev->src, ev->dst);
+    int *path  = topo->path(ev->src, ev->dst);
+    ulong t    = ev->ready;
+    ulong qc   = qcycles;
+
+    for (i=0; i < nhops; i++)
+        t = hop(path[i], t, nflits, msg);
+
+    flits += nflits;
+    STAT_INC(msgcount[MSGINDEX(msg)]);
+    if (qcycles != qc)
+        queued++;
+
+    // Between a tile and a memory controller? How far would it have
+    // gone if the blocks were interleaved?
+    if ((ev->src >= NPROCS) != (ev->dst >= NPROCS)) {
+        memmsgs++;
+        memhops += nhops;
+        if (ev->src < NPROCS)
+            blockhops += topo->hops(ev->src, NPROCS + BLKADDR(ev->addr) % NDIRS);
+        else
+            blockhops += topo->hops(NPROCS + BLKADDR(ev->addr) % NDIRS, ev->dst);
+    }
+
+    // With no queueing we must agree with the zeroload model
+    assert(qcycles != qc || t + nflits - 1 == ev->ready + ev->lat);
+
+    // The tail follows the head nflits-1 cycles behind
+    return t + nflits - 1;
 }
 
+/*
+ * Net::readyEvent
+ *     - A message is ready to be sent. Work out when it will be
+ *       delivered.
+ */
+ulong Net::readyEvent(Event *ev) {
+    PROF_SCOPE(PHASENET);
+    std::unique_lock<std::mutex> guard;
+    if (locking)
+        guard = std::unique_lock<std::mutex>(lock);
+    ulong t = route(ev);
+
+    msgs++;
+    if (model == NETZEROLOAD)
+        return ev->ready + ev->lat;
+    return t;
+}
+
+/*
+ * Net::recvEvent
+ *     - A message was delivered. Pass it on to whoever it was for.
+ */
+void Net::recvEvent(Event *ev) {
+    if (ev->dst < NPROCS)
+        tiles[ev->dst]->port->recvEvent(ev);
+    else
+        dir->getShard(ev->addr)->mem->recvEvent(ev);
+}
+
+/*
+ * Net::dirEndpoint
+ *     - Network endpoints 0..NPROCS-1 are the tiles. The memory
+ *       controllers (directory shards) come after them. Return the
+ *       endpoint of the controller responsible for addr.
+ */
+int Net::dirEndpoint(ulong addr) {
+    return NPROCS + dir->mapAddrToDir(addr);
+}
+
+/*
+ * Net::sendReq*, Net::fake*, Net::flushToMem
+ *     - Schedule the delivery of a message (and for requests have
+ *       the receiver service it). While the event queue is functional
+ *       (fast-forwarding) nothing is timed so the route isn't even
+ *       looked up.
+ */
 ulong Net::sendReqTileToTile(ulong msg, ulong addr, ulong fromtile, ulong totile) {
-    // Add in the delay
-    if (fromtile != totile)
-        CURRENTDELAY += HOPDELAY(calcTileToTileHops(fromtile, totile));
+    // Schedule the delivery
+    if (fromtile != totile && !EVENTQ->functional)
+        EVENTQ->send(msg, addr, fromtile, totile,
+                     HOPDELAY(calcTileToTileHops(fromtile, totile)), this);
 
     // Service the request
     return tiles[totile]->getFromNetwork(msg, addr, fromtile);
 }
 
 ulong Net::sendReqDirToTile(ulong msg, ulong addr, ulong totile) {
-    // Add in the delay
-    CURRENTDELAY += HOPDELAY(calcTileToDirHops(addr, totile));
-    // Service the request
-    tiles[totile]->getFromNetwork(msg, addr, -1); // Use invalid tile
-    return 1;
+    // Schedule the delivery
+    if (!EVENTQ->functional)
+        EVENTQ->send(msg, addr, dirEndpoint(addr), totile,
+                     HOPDELAY(calcTileToDirHops(addr, totile)), this);
+    // Service the request. Use invalid tile (-1) as the sender.
+    return tiles[totile]->getFromNetwork(msg, addr, -1);
 }
 
 ulong Net::sendReqTileToDir(ulong msg, ulong addr, ulong fromtile) {
-    // Add in the delay
-    CURRENTDELAY += HOPDELAY(calcTileToDirHops(addr, fromtile));
+    ulong hops;
+
+    // Place (or with migration, move) the page. Writebacks don't
+    // move pages.
+    if (msg != WB)
+        dir->touchPage(addr, fromtile);
+
+    // Schedule the delivery
+    if (!EVENTQ->functional) {
+        hops = calcTileToDirHops(addr, fromtile);
+        EVENTQ->send(msg, addr, fromtile, dirEndpoint(addr),
+                     HASDATA(msg) ? DATAHOPDELAY(hops) : HOPDELAY(hops), this);
+    }
     // Service the request
     return dir->getFromNetwork(msg, addr, fromtile);
 }
 
 ulong Net::fakeReqDirToTile(ulong addr, ulong totile) {
-    // Add in the delay
-    CURRENTDELAY += HOPDELAY(calcTileToDirHops(addr, totile));
+    if (EVENTQ->functional)
+        return 1;
+    // Schedule the delivery
+    EVENTQ->send(REPLY, addr, dirEndpoint(addr), totile,
+                 HOPDELAY(calcTileToDirHops(addr, totile)), this);
     return 1;
 }
 
 ulong Net::fakeDataTileToTile(ulong fromtile, ulong totile) {
-    // Add in the delay
-    if (fromtile != totile)
-        CURRENTDELAY += DATAHOPDELAY(calcTileToTileHops(fromtile, totile));
+    // Schedule the delivery
+    if (fromtile != totile) {
+        if (!EVENTQ->functional)
+            EVENTQ->send(DATA, 0, fromtile, totile,
+                         DATAHOPDELAY(calcTileToTileHops(fromtile, totile)), this);
+        STAT_INC(tiles[fromtile]->getL2()->transfers);
+    }
     return 1;
 }
 
 ulong Net::fakeDataDirToTile(ulong addr, ulong totile) {
-    // Add in the delay
-    CURRENTDELAY += DATAHOPDELAY(calcTileToDirHops(addr, totile));
+    if (EVENTQ->functional)
+        return 1;
+    // Schedule the delivery
+    EVENTQ->send(DATA, addr, dirEndpoint(addr), totile,
+                 DATAHOPDELAY(calcTileToDirHops(addr, totile)), this);
     return 1;
 }
 
 ulong Net::flushToMem(ulong addr, ulong fromtile) {
+    if (EVENTQ->functional)
+        return 1;
 
     // Don't add mem access time to delay because
     // we don't need to wait.. just calculate time to
@@ -73,41 +400,231 @@ ulong Net::flushToMem(ulong addr, ulong fromtile) {
     int hops  = calcTileToDirHops(addr, fromtile);
     int delay = DATAHOPDELAY(hops);
 
-    CURRENTDELAY += delay; 
+    EVENTQ->send(FLUSH, addr, fromtile, dirEndpoint(addr), delay, this);
+    return 1;
+}
+
+/*
+ * Net::copyDirToDir
+ *     - Send a block of memory from one memory controller to another
+ *       (page migration). It is written to memory at the other end.
+ */
+ulong Net::copyDirToDir(ulong addr, int fromdir, int todir) {
+    int hops = topo->hops(NPROCS + fromdir, NPROCS + todir);
+
+    EVENTQ->send(FLUSH, addr, NPROCS + fromdir, NPROCS + todir,
+                 DATAHOPDELAY(hops), this);
+    return 1;
+}
+
+/*
+ * Net::nearestDir
+ *     - Find the memory controller the fewest hops away from tile
+ *       (the lowest numbered one if there is a tie).
+ */
+int Net::nearestDir(int tile) {
+    int i, best = 0;
+
+    for (i=1; i < NDIRS; i++)
+        if (topo->hops(tile, NPROCS + i) < topo->hops(tile, NPROCS + best))
+            best = i;
+    return best;
 }
 
+/*
+ * Net::calcTileToDirHops
+ *     - # of hops between tile and the memory controller of addr.
+ */
 ulong Net::calcTileToDirHops(ulong addr, ulong tile) {
+    return topo->hops(tile, dirEndpoint(addr));
+}
 
-    int dirnum = BLKADDR(addr) % 4;
-    int hops   = 0;
-    switch (dirnum) {
-        case 0: // Attached to tile 0. 1 hop to the left
-            hops = calcDistance(-1, 0, tiles[tile]->xindex, tiles[tile]->yindex);
-            break;
-        case 1: // Attached to tile 3. 1 hop to the right
-            hops = calcDistance(4, 0, tiles[tile]->xindex, tiles[tile]->yindex);
-            break;
-        case 2: // Attached to tile 12. 1 hop to the left
-            hops = calcDistance(-1, 3, tiles[tile]->xindex, tiles[tile]->yindex);
-            break;
-        case 3: // Attached to tile 15. 1 hop to the right
-            hops = calcDistance(4, 3, tiles[tile]->xindex, tiles[tile]->yindex);
-            break;
-        default :
-            assert(0); // Should not get here.
+ulong Net::calcTileToTileHops(ulong fromtile, ulong totile) {
+    return topo->hops(fromtile, totile);
+}
+
+/*
+ * Net::resetStats
+ *     - Zero the counters. The links stay reserved so messages already
+ *       in flight still hold them up.
+ */
+void Net::resetStats() {
+    int i;
+
+    msgs      = 0;
+    flits     = 0;
+    queued    = 0;
+    qcycles   = 0;
+    memmsgs   = 0;
+    memhops   = 0;
+    blockhops = 0;
+    for (i=0; i < nlinks; i++) {
+        links[i].flits  = 0;
+        links[i].waited = 0;
+        links[i].dropped = 0;
+        memset(links[i].msgflits, 0, sizeof(links[i].msgflits));
     }
+    if (series)
+        memset(series, 0, nintervals * nlinks * sizeof(ulong));
+}
+
+/*
+ * Net::checkpoint
+ *     - Save or restore the counters, the link reservations and the
+ *       time series. The per type message counts (STATS) are saved
+ *       with the StatRegistry.
+ */
+void Net::checkpoint(Checkpoint *ck) {
+    ulong n = nintervals;
+
+    ck->section(CKSECTION('N','e','t',' '));
+    CKIO(ck, msgs);
+    CKIO(ck, flits);
+    CKIO(ck, queued);
+    CKIO(ck, qcycles);
+    CKIO(ck, memmsgs);
+    CKIO(ck, memhops);
+    CKIO(ck, blockhops);
+    ck->io(links, nlinks*sizeof(Link));
 
-    return hops;
+    CKIO(ck, n);
+    if (!ck->saving && n != nintervals) {
+        series = (ulong *)realloc(series, n * nlinks * sizeof(ulong));
+        assert(series || n == 0);
+        nintervals = n;
+    }
+    ck->io(series, nintervals * nlinks * sizeof(ulong));
 }
 
-ulong Net::calcTileToTileHops(ulong fromtile, ulong totile) {
-    int x0 = tiles[fromtile]->xindex;
-    int y0 = tiles[fromtile]->yindex;
-    int x1 = tiles[totile]->xindex;
-    int y1 = tiles[totile]->yindex;
-    return calcDistance(x0, x1, y0, y1);
+/*
+ * Net::PrintStats
+ *     - Print statistics for the interconnect.
+ */
+void Net::PrintStats() {
+    int i, d, x, y, g, l, r;
+    ulong out, sent, recvd;
+    ulong maxflits = 0, maxwaited = 0, dropped = 0;
+    const char *dirnames[NLINKDIRS] = { "x+", "x-", "y+", "y-" };
+
+    for (i=0; i < nlinks; i++) {
+        maxflits  = MAX(maxflits,  links[i].flits);
+        maxwaited = MAX(maxwaited, links[i].waited);
+        dropped  += links[i].dropped;
+    }
+
+    printf("========================================================== (Network)\n");
+    printf("00. network model (topology)                    %s (%s)\n", NETNAMES[model],
+           TOPONAMES[topo->kind]);
+    printf("01. messages sent                               %lu\n",  msgs);
+    printf("02. flits sent                                  %lu\n",  flits);
+    printf("03. messages that waited for a link             %lu\n",  queued);
+    printf("04. cycles spent waiting for links              %lu\n",  qcycles);
+    printf("05. average queueing delay (cycles/message)     %f\n" ,  msgs ? (float)qcycles / (float)msgs : 0.0);
+    printf("06. flits on busiest link                       %lu\n",  maxflits);
+    printf("07. most cycles waited for one link             %lu\n",  maxwaited);
+
+    // Heatmap of the flits leaving each router. For a grid show each
+    // direction laid out like the grid (x is the row, y the column).
+    g = topo->gridSize();
+    if (g) {
+        printf("08. flits leaving each router by direction\n");
+        for (d=0; d < NLINKDIRS; d++) {
+            printf("    %s:", dirnames[d]);
+            for (x=0; x < g; x++) {
+                if (x)
+                    printf("       ");
+                for (y=0; y < g; y++) {
+                    l = topo->gridLink(x, y, d);
+                    printf(" %10lu", (l >= 0) ? links[l].flits : 0);
+                }
+                printf("\n");
+            }
+        }
+    } else {
+        printf("08. flits leaving each router\n");
+        for (r=0; r < topo->numRouters(); r++) {
+            out = 0;
+            for (l=0; l < nlinks; l++)
+                if (topo->linkFrom(l) == r)
+                    out += links[l].flits;
+            printf("%s %10lu", (r % SQRTNPROCS) ? "" : "   ", out);
+            if (r % SQRTNPROCS == SQRTNPROCS-1 || r == topo->numRouters()-1)
+                printf("\n");
+        }
+    }
+
+    printf("09. flits sent/received by each memory controller\n");
+    for (i=0; i < NDIRS; i++) {
+        sent = recvd = 0;
+        for (l=0; l < nlinks; l++) {
+            if (topo->linkFrom(l) == -1-i)
+                sent  += links[l].flits;
+            if (topo->linkTo(l) == -1-i)
+                recvd += links[l].flits;
+        }
+        printf("    mc%d: %10lu %10lu\n", i, sent, recvd);
+    }
+    printf("10. reserved link cycles forgotten              %lu\n",  dropped);
 }
 
-ulong Net::calcDistance(int x0, int x1, int y0, int y1) {
-    return (abs(x1-x0) + abs(y1-y0));
+/*
+ * Net::WriteStats
+ *     - Write the link traffic out to files:
+ *         <prefix>.links  - flits on each link by message type
+ *         <prefix>.series - flits on each link in each interval
+ *                           (if trackSeries() was called)
+ */
+void Net::WriteStats(const char *prefix) {
+    int i, j;
+    ulong k, last;
+    char fname[1024];
+    char name[32];
+    FILE *fp;
+
+    snprintf(fname, sizeof(fname), "%s.links", prefix);
+    fp = fopen(fname, "w");
+    assert(fp);
+
+    fprintf(fp, "%-12s %10s", "link", "total");
+    for (j=0; j < NMSGTYPES; j++)
+        fprintf(fp, " %10s", MSGNAMES[j]);
+    fprintf(fp, "\n");
+    for (i=0; i < nlinks; i++) {
+        topo->linkName(i, name);
+        fprintf(fp, "%-12s %10lu", name, links[i].flits);
+        for (j=0; j < NMSGTYPES; j++)
+            fprintf(fp, " %10lu", links[i].msgflits[j]);
+        fprintf(fp, "\n");
+    }
+    fclose(fp);
+
+    if (!interval)
+        return;
+
+    snprintf(fname, sizeof(fname), "%s.series", prefix);
+    fp = fopen(fname, "w");
+    assert(fp);
+
+    // Don't write out the empty intervals at the end
+    for (last = nintervals; last > 0; last--) {
+        for (i=0; i < nlinks; i++)
+            if (series[(last-1)*nlinks + i])
+                break;
+        if (i < nlinks)
+            break;
+    }
+
+    fprintf(fp, "%12s", "cycle");
+    for (i=0; i < nlinks; i++) {
+        topo->linkName(i, name);
+        fprintf(fp, " %12s", name);
+    }
+    fprintf(fp, "\n");
+    for (k=0; k < last; k++) {
+        fprintf(fp, "%12lu", k*interval);
+        for (i=0; i < nlinks; i++)
+            fprintf(fp, " %12lu", series[k*nlinks + i]);
+        fprintf(fp, "\n");
+    }
+    fclose(fp);
 }
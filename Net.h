@@ -11,14 +11,30 @@
  *         The network is global in that everything will have access to
  *         it without having to explicity have it be a part of their
  *         class data. 
+ *
+ *         Two models of the interconnect are available:
+ *           - zeroload - a message takes HOPDELAY/DATAHOPDELAY of the
+ *                        # of hops. Bandwidth is infinite.
+ *           - contention - messages are routed over the links of the
+ *                        topology (see Topology.h). A link carries one
+ *                        flit per cycle so messages that need the same
+ *                        link at the same time queue up behind each
+ *                        other. With nothing else on the network a
+ *                        message takes exactly as long as it does with
+ *                        zeroload.
  */
 #ifndef NET_H
 #define NET_H
 
+#include <mutex>
 #include "types.h"
+#include "Event.h"
+#include "Topology.h"
+#include "Stats.h"
 
 class Dir;  // Forward Declaration
 class Tile; // Forward Declaration
+class Checkpoint; // Forward Declaration
 
 
 // Message types to be passed back and forth over the network. 
@@ -29,6 +45,7 @@ enum {
     // Dir -> Tile (L2 CCSM) messages
     INV=100, // Invalidation
     INT,     // Intervention
+    BINV,    // Back-invalidation (sparse directory evicted the entry)
 
     // Tile (L2 CCSM) -> Dir messages
     RD,      // Read
@@ -47,17 +64,115 @@ enum {
 
     // Tile (L1/L2) -> Tile (L2) messages
     XFER,
+
+    // Replies and data. These are only modeled for timing.
+    REPLY,   // Reply without data (i.e. UPGR ack, forwarded request)
+    DATA,    // Data block
+    FLUSH,   // Data block written back to memory
 };
 
+// # of message types and the index of message type m in per type
+// counters
+#define NMSGTYPES   (FLUSH - INV + 1)
+#define MSGINDEX(m) ((m) - INV)
+
+// Messages that carry a data block (DATAFLITS flits, the rest are 1).
+// A WB is a dirty block going back to memory.
+#define HASDATA(m) ((m) == DATA || (m) == FLUSH || (m) == WB)
+
+// Names of the message types (indexed by MSGINDEX)
+extern const char *MSGNAMES[];
+
+// Network models
+enum {
+    NETZEROLOAD = 0,
+    NETCONTEND,
+};
+
+// Names of the network models (indexed by NETZEROLOAD, NETCONTEND)
+extern const char *NETNAMES[];
+
+// # of cycles a link remembers reservations for (a multiple of 64)
+#define LINKWINDOW 4096
+#define LINKWORDS  (LINKWINDOW / 64)
+
+// Default # of cycles in each interval of the link traffic time series
+#define NETINTERVAL 10000
+
+/*
+ * Link - one direction of a link in the network. It keeps a bit for
+ *        each cycle in a window of LINKWINDOW cycles that says if a
+ *        flit is crossing the link in that cycle. Messages don't have
+ *        to reserve the link in time order. An earlier message can use
+ *        a gap left between later ones.
+ */
+class Link {
+    private:
+        ulong base;             // First cycle in the window
+        ulong slots[LINKWORDS]; // One bit per cycle
+
+        int  busy(ulong c);
+        void take(ulong c);
+        void slide(ulong c, ulong t);
+        void slideBack(ulong c);
+
+    public:
+        ulong flits;                // Flits that crossed the link
+        ulong msgflits[NMSGTYPES];  // .. broken down by message type
+        ulong waited;               // Cycles messages waited for the link
+        ulong dropped;              // Reserved cycles that were forgotten
+
+        Link();
+        ulong reserve(ulong t, int nflits);
+};
 
-class Net {
+class Net : public Port {
 private:
     Tile ** tiles;
     Dir  *  dir;
 
+    // Links of the topology (indexed the same way)
+    Topology * topo;
+    Link *     links;
+    int        nlinks;
+
+    // Optional time series of the flits that crossed each link in
+    // each interval. series[i*nlinks + l] is for interval i and link l.
+    ulong * series;
+    ulong   nintervals; // Intervals allocated
+    ulong   interval;   // Cycles per interval (0 = no time series)
+
+    void  addToSeries(int link, ulong t, int nflits);
+    ulong hop(int link, ulong t, int nflits, int type);
+    ulong route(Event *ev);
+
+    std::mutex lock; // Held while routing (with locking on)
+
 public:
-    Net(Dir * dirr, Tile ** tiless);
+    int model;   // NETZEROLOAD or NETCONTEND
+    int locking; // Can several threads send messages at once?
+
+    // Some counters
+    ulong msgs;    // Messages sent
+    ulong flits;   // Flits sent
+    ulong queued;  // Messages that had to wait for a link
+    ulong qcycles; // Cycles messages spent waiting for links
+
+    // Messages between tiles and memory controllers, the hops they
+    // took and the hops they would have taken with the blocks
+    // interleaved across the controllers (see Dir::mapAddrToDir)
+    ulong memmsgs;
+    ulong memhops;
+    ulong blockhops;
+
+#ifdef STATS
+    ulong msgcount[NMSGTYPES]; // Messages sent of each type (see Stats.h)
+#endif
+
+    Net(Dir * dirr, Tile ** tiless, int m=NETCONTEND, int topology=TOPOMESH);
     ~Net();
+    ulong readyEvent(Event *ev);
+    void  recvEvent(Event *ev);
     ulong sendReqTileToTile(ulong msg, ulong addr, ulong fromtile, ulong totile);
     ulong sendReqDirToTile( ulong msg, ulong addr, ulong totile);
     ulong sendReqTileToDir( ulong msg, ulong addr, ulong fromtile);
@@ -66,9 +181,16 @@ public:
     ulong fakeDataTileToTile(ulong fromtile, ulong totile);
     ulong fakeDataDirToTile(ulong addr, ulong totile);
     ulong flushToMem(ulong addr, ulong fromtile);
+    ulong copyDirToDir(ulong addr, int fromdir, int todir);
+    int   nearestDir(int tile);
+    int   dirEndpoint(ulong addr);
     ulong calcTileToDirHops(ulong addr, ulong tile);
     ulong calcTileToTileHops(ulong fromtile, ulong totile);
-    ulong calcDistance(int x0, int x1, int y0, int y1);
+    void  trackSeries(ulong cycles);
+    void  PrintStats();
+    void  resetStats();
+    void  checkpoint(Checkpoint *ck);
+    void  WriteStats(const char *prefix);
 };
 
 #endif
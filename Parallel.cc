@@ -0,0 +1,317 @@
+/*
+ * Dusty Mabe - 2014
+ * Parallel.cc - Implementation of the parallel (quantum based)
+ *               simulation of the tiles.
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include "Parallel.h"
+#include "Trace.h"
+#include "Tile.h"
+#include "Dir.h"
+#include "BitVector.h"
+#include "Event.h"
+#include "IntervalStats.h"
+#include "Profile.h"
+
+// Global event queue is defined in simulator.cc
+extern thread_local EventQueue *EVENTQ;
+
+/*
+ * Mailbox::post
+ *     - Add a message to the mailbox (producer side).
+ */
+void Mailbox::post(int tile, uchar op, ulong addr, ulong cycle) {
+    ulong t = tail.load(std::memory_order_relaxed);
+    MailMsg *msg;
+
+    // Each tile posts at most once per quantum
+    assert(t - head.load(std::memory_order_acquire) < MAILBOXSIZE);
+
+    msg        = &slots[t & (MAILBOXSIZE - 1)];
+    msg->tile  = tile;
+    msg->op    = op;
+    msg->addr  = addr;
+    msg->cycle = cycle;
+    tail.store(t + 1, std::memory_order_release);
+}
+
+/*
+ * Mailbox::receive
+ *     - Take the oldest message out of the mailbox (consumer side).
+ *
+ * Returns 0 if the mailbox is empty.
+ */
+int Mailbox::receive(MailMsg *msg) {
+    ulong h = head.load(std::memory_order_relaxed);
+
+    if (h == tail.load(std::memory_order_acquire))
+        return 0;
+
+    *msg = slots[h & (MAILBOXSIZE - 1)];
+    head.store(h + 1, std::memory_order_release);
+    return 1;
+}
+
+/*
+ * Barrier::wait
+ *     - Wait for all threads to get to the barrier.
+ */
+void Barrier::wait() {
+    int s = sense.load(std::memory_order_relaxed);
+    PROF_SCOPE(PHASEWAIT);
+
+    if (count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        count.store(nthreads, std::memory_order_relaxed);
+        sense.store(!s, std::memory_order_release);
+        return;
+    }
+
+    while (sense.load(std::memory_order_acquire) == s)
+        std::this_thread::yield();
+}
+
+/*
+ * ParallelSim constructor
+ *     - workers is the # of host threads (including the calling
+ *       thread), q the length of a quantum in cycles and det
+ *       whether posted accesses are replayed in cycle order so the
+ *       results don't depend on the # of workers. Unless they are
+ *       replayed the directory d must have been made with locks.
+ */
+ParallelSim::ParallelSim(Tile **t, Dir *d, MTTrace *tr, int workers, ulong q, int det) {
+    tiles         = t;
+    dir           = d;
+    trace         = tr;
+    nworkers      = workers;
+    quantum       = q;
+    deterministic = det;
+
+    assert(nworkers >= 1 && nworkers <= NPROCS);
+    assert(quantum > 0);
+    assert(deterministic || dir->getLocking());
+    assert(NPROCS <= 64); // Tiles to lock are kept in a ulong
+
+    mailboxes = new Mailbox[nworkers * nworkers];
+    posted    = new MailMsg[NPROCS];
+    barrier   = new Barrier(nworkers);
+    threads   = new std::thread[nworkers];
+
+    qend       = 0;
+    done       = 0;
+    quanta     = 0;
+    localaccs  = 0;
+    postedaccs = 0;
+    istats     = NULL;
+}
+
+ParallelSim::~ParallelSim() {
+    delete[] mailboxes;
+    delete[] posted;
+    delete barrier;
+    delete[] threads;
+}
+
+/*
+ * ParallelSim::homeWorker
+ *     - The worker that carries out the posted accesses to the block
+ *       addr is in. Accesses to the same block go to the same worker
+ *       so they rarely have to wait for each other's claim.
+ */
+int ParallelSim::homeWorker(ulong addr) {
+    return BLKADDR(addr) % nworkers;
+}
+
+/*
+ * ParallelSim::runLocal
+ *     - Run the tiles owned by worker id up to the end of the quantum
+ *       or until they need to leave the tile.
+ */
+void ParallelSim::runLocal(int id) {
+    int t;
+    TraceRec *rec;
+
+    for (t=id; t < NPROCS; t += nworkers) {
+        while ((rec = trace->peek(t)) && tiles[t]->cycle < qend) {
+            if (!tiles[t]->isLocal(rec->addr, rec->op)) {
+                mailboxes[id*nworkers + homeWorker(rec->addr)].post(t,
+                    rec->op, rec->addr, tiles[t]->cycle);
+                break;
+            }
+            tiles[t]->Access(rec->addr, rec->op);
+            trace->pop(t);
+        }
+    }
+}
+
+/*
+ * ParallelSim::worker
+ *     - Main loop of the worker threads.
+ */
+void ParallelSim::worker(int id) {
+    EVENTQ = new EventQueue();
+    PROF_THREAD_START();
+
+    while (1) {
+        barrier->wait(); // Wait for the quantum to start
+        if (done)
+            break;
+        runLocal(id);
+        barrier->wait(); // Local accesses are done
+        if (!deterministic)
+            runPosted(id);
+        barrier->wait(); // Quantum is over
+    }
+
+    PROF_THREAD_END();
+    delete EVENTQ;
+}
+
+/*
+ * compareMsgs
+ *     - Order posted accesses by cycle and then by tile.
+ */
+static int compareMsgs(const void *a, const void *b) {
+    const MailMsg *x = (const MailMsg *)a;
+    const MailMsg *y = (const MailMsg *)b;
+
+    if (x->cycle != y->cycle)
+        return (x->cycle < y->cycle) ? -1 : 1;
+    return x->tile - y->tile;
+}
+
+/*
+ * ParallelSim::runLocked
+ *     - Carry out a posted access while the other workers carry out
+ *       theirs. The claim on the block keeps out other accesses to
+ *       it, so the tiles its directory entry names can only go away
+ *       until we are done. Those tiles and the ones in our partition
+ *       are locked (in order, so nobody deadlocks) for the whole
+ *       access. Dir::getFromNetwork takes the directory locks.
+ */
+void ParallelSim::runLocked(MailMsg *msg) {
+    std::lock_guard<std::mutex> claim(claims[BLKADDR(msg->addr) & (NCLAIMS - 1)]);
+    Tile *tile = tiles[msg->tile];
+    ulong mask = dir->sharerTiles(msg->addr);
+    int t;
+
+    for (t=0; t < tile->part->size; t++)
+        if (tile->part->getBit(t))
+            mask |= 1UL << t;
+    mask |= 1UL << msg->tile;
+
+    for (t=0; t < NPROCS; t++)
+        if (mask & (1UL << t))
+            tilelocks[t].lock();
+
+    tile->Access(msg->addr, msg->op);
+    trace->pop(msg->tile);
+
+    for (t=NPROCS-1; t >= 0; t--)
+        if (mask & (1UL << t))
+            tilelocks[t].unlock();
+}
+
+/*
+ * ParallelSim::runPosted
+ *     - Carry out the accesses posted to worker id. All of the
+ *       workers do this at the same time.
+ */
+void ParallelSim::runPosted(int id) {
+    int src;
+    ulong n = 0;
+    MailMsg msg;
+
+    for (src=0; src < nworkers; src++) {
+        while (mailboxes[src*nworkers + id].receive(&msg)) {
+            runLocked(&msg);
+            n++;
+        }
+    }
+
+    postedaccs += n;
+}
+
+/*
+ * ParallelSim::replayPosted
+ *     - Carry out all of the posted accesses one at a time in cycle
+ *       order (--deterministic). Only the coordinator runs here and
+ *       all workers are waiting.
+ */
+void ParallelSim::replayPosted() {
+    int i, n = 0;
+
+    for (i=0; i < nworkers * nworkers; i++)
+        while (mailboxes[i].receive(&posted[n]))
+            n++;
+
+    qsort(posted, n, sizeof(MailMsg), compareMsgs);
+
+    for (i=0; i < n; i++) {
+        tiles[posted[i].tile]->Access(posted[i].addr, posted[i].op);
+        trace->pop(posted[i].tile);
+    }
+
+    postedaccs += n;
+}
+
+/*
+ * ParallelSim::run
+ *     - Simulate the whole trace.
+ */
+void ParallelSim::run() {
+    int i, t;
+    ulong start, records;
+
+    // Each access takes at least L1ATIME so this is the most
+    // records a tile can get through in a quantum.
+    ulong need = quantum / L1ATIME + 1;
+
+    // The calling thread is worker 0
+    for (i=1; i < nworkers; i++)
+        threads[i] = std::thread(&ParallelSim::worker, this, i);
+
+    while (1) {
+
+        // Top up the records and find the tile furthest behind
+        trace->reclaim();
+        if (trace->fill(need) == 0)
+            break;
+
+        start = 0;
+        for (t=0, i=0; t < NPROCS; t++) {
+            if (!trace->peek(t))
+                continue;
+            if (!i || tiles[t]->cycle < start)
+                start = tiles[t]->cycle;
+            i = 1;
+        }
+        qend = start + quantum;
+        quanta++;
+
+        barrier->wait();
+        runLocal(0);
+        barrier->wait();
+        if (deterministic)
+            replayPosted();
+        else
+            runPosted(0);
+        barrier->wait();
+
+        // The workers are waiting for the next quantum so the tiles
+        // hold still while they are copied
+        if (istats) {
+            for (t=0, records=0; t < NPROCS; t++)
+                records += tiles[t]->accesses;
+            istats->tick(tiles, records);
+        }
+    }
+
+    done = 1;
+    barrier->wait();
+    for (i=1; i < nworkers; i++)
+        threads[i].join();
+
+    localaccs = trace->records - postedaccs;
+}
@@ -0,0 +1,140 @@
+/*
+ * Dusty Mabe - 2014
+ * Parallel.h - Header file for running the tiles of a multi-threaded
+ *              trace on several host threads at once.
+ *
+ *              Simulated time advances in quanta. During a quantum each
+ *              worker thread runs the tiles it owns, but only for the
+ *              accesses that stay within the tile (L1 hits and L2 hits
+ *              that don't need the directory). A tile that needs to
+ *              talk to the directory posts the access to the mailbox
+ *              between its worker and the block's home worker and
+ *              stops for the rest of the quantum. There is one lock
+ *              free mailbox for each (src, dst) pair of workers.
+ *
+ *              After the quantum every worker carries out the accesses
+ *              posted to it, all at the same time. The directory is
+ *              locked (Dir::getFromNetwork holds the stripe lock of the
+ *              block and stays in an epoch) and so are the network
+ *              links and memory controllers. An access also claims its
+ *              block and locks the tiles it can send messages to (see
+ *              runLocked()) so no two threads touch a tile at once.
+ *              With --deterministic the posted accesses are instead
+ *              replayed one at a time in cycle order by the
+ *              coordinator so the results don't depend on the # of
+ *              workers.
+ *
+ *              An access has to miss in the L1 and the L2 and then
+ *              cross at least one link before it can reach another
+ *              tile, so by default a quantum is that long (LOOKAHEAD
+ *              cycles). The protocol itself is not event-driven:
+ *              coherence state changes when a request is sent rather
+ *              than when it arrives (see Event.h), and a tile has only
+ *              one request in flight. So the results are close to but
+ *              not always the same as with one thread. A quantum of HOPDELAY(1)
+ *              keeps them closer. Longer quanta run faster but let a
+ *              tile run ahead of messages it should have seen.
+ */
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include "types.h"
+#include "params.h"
+
+class Tile;     // Forward Declaration
+class MTTrace;  // Forward Declaration
+class IntervalStats; // Forward Declaration
+class Dir;      // Forward Declaration
+
+// Mailbox slots (must be a power of 2 and >= NPROCS)
+#define MAILBOXSIZE 64
+
+// Claims on blocks being accessed (must be a power of 2)
+#define NCLAIMS 256
+
+// Cycles before an access can reach another tile (default quantum)
+#define LOOKAHEAD (L1ATIME + L2ATIME + HOPDELAY(1))
+
+// An access posted by a tile that needs the directory
+class MailMsg {
+    public:
+        int   tile;
+        uchar op;
+        ulong addr;
+        ulong cycle;
+};
+
+/*
+ * Mailbox - a lock-free single producer/single consumer queue
+ *           from one worker to another (or itself).
+ */
+class Mailbox {
+    private:
+        MailMsg slots[MAILBOXSIZE];
+        std::atomic<ulong> head; // Next slot to read  (consumer)
+        std::atomic<ulong> tail; // Next slot to write (producer)
+
+    public:
+        Mailbox() { head = 0; tail = 0; }
+        void post(int tile, uchar op, ulong addr, ulong cycle);
+        int  receive(MailMsg *msg);
+};
+
+/*
+ * Barrier - a sense reversing spin barrier. Quanta are short so
+ *           waiting threads spin (and yield) rather than sleep.
+ */
+class Barrier {
+    private:
+        int nthreads;
+        std::atomic<int> count;
+        std::atomic<int> sense;
+
+    public:
+        Barrier(int n) { nthreads = n; count = n; sense = 0; }
+        void wait();
+};
+
+class ParallelSim {
+    private:
+        Tile   **tiles;
+        Dir     *dir;
+        MTTrace *trace;
+        int      nworkers;
+        ulong    quantum;
+        int      deterministic;
+
+        Mailbox *mailboxes;    // [src * nworkers + dst]
+        MailMsg *posted;       // Accesses gathered for a replay
+        Barrier *barrier;
+        std::thread *threads;
+
+        ulong    qend;         // Cycle the current quantum ends at
+        int      done;
+
+        void worker(int id);
+        void runLocal(int id);
+        void runPosted(int id);
+        void runLocked(MailMsg *msg);
+        void replayPosted();
+        int  homeWorker(ulong addr);
+
+        std::mutex claims[NCLAIMS];   // Blocks being accessed (hashed)
+        std::mutex tilelocks[NPROCS]; // Tiles being accessed
+
+    public:
+        ulong quanta;       // Quanta simulated
+        ulong localaccs;    // Accesses that stayed within their tile
+        std::atomic<ulong> postedaccs; // Accesses posted to the directory
+
+        IntervalStats *istats; // Snapshots taken between quanta (or NULL)
+
+        ParallelSim(Tile **t, Dir *d, MTTrace *tr, int workers, ulong q, int det);
+        ~ParallelSim();
+        void run();
+};
+
+#endif
@@ -0,0 +1,156 @@
+/*
+ * Dusty Mabe - 2014
+ * Profile.cc - Implementation of the simulator self profiling.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include <chrono>
+#include <mutex>
+#include "Profile.h"
+
+// Names of the phases (indexed by PHASEOTHER, PHASEPARSE, ...)
+const char *PHASENAMES[] = {
+    "other", "parse", "L1", "L2", "directory", "network", "flush",
+    "barrier wait"
+};
+
+thread_local ProfThread PROFTHREAD;
+
+// Host events counted with perf_event_open
+enum {
+    HOSTLLC = 0, // Last level cache load misses
+    HOSTDTLB,    // Data TLB load misses
+    HOSTITLB,    // Instruction TLB load misses
+    NHOSTEVENTS,
+};
+
+static const char *HOSTNAMES[] = {
+    "LLC load misses", "dTLB load misses", "iTLB load misses"
+};
+
+static const ulong HOSTCONFIGS[] = {
+    PERF_COUNT_HW_CACHE_LL   | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                               (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+    PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                               (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+    PERF_COUNT_HW_CACHE_ITLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                               (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+};
+
+static std::mutex lock;            // Protects tsc
+static ulong tsc[NPHASES];         // Cycles of all threads in each phase
+static ulong tscstart, tscstop;    // Cycle counter at start/stop
+static std::chrono::steady_clock::time_point wallstart, wallstop;
+static int   hostfd[NHOSTEVENTS];  // -1 if the event isn't available
+static long long hostcount[NHOSTEVENTS];
+
+/*
+ * Profile::start
+ *     - Start timing the calling (main) thread and open the host
+ *       counters. Threads created after this are counted too.
+ */
+void Profile::start() {
+    struct perf_event_attr attr;
+    int i;
+
+    for (i=0; i < NHOSTEVENTS; i++) {
+        memset(&attr, 0, sizeof(attr));
+        attr.size           = sizeof(attr);
+        attr.type           = PERF_TYPE_HW_CACHE;
+        attr.config         = HOSTCONFIGS[i];
+        attr.disabled       = 1;
+        attr.inherit        = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        hostfd[i] = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+        hostcount[i] = -1;
+    }
+    for (i=0; i < NHOSTEVENTS; i++)
+        if (hostfd[i] != -1)
+            ioctl(hostfd[i], PERF_EVENT_IOC_ENABLE, 0);
+
+    wallstart = std::chrono::steady_clock::now();
+    tscstart  = __rdtsc();
+    startThread();
+}
+
+/*
+ * Profile::stop
+ *     - Stop the clock and read the host counters. Should be called
+ *       by the main thread once all the others are done.
+ */
+void Profile::stop() {
+    int i;
+
+    for (i=0; i < NHOSTEVENTS; i++) {
+        if (hostfd[i] == -1)
+            continue;
+        ioctl(hostfd[i], PERF_EVENT_IOC_DISABLE, 0);
+        if (read(hostfd[i], &hostcount[i], sizeof(hostcount[i])) != sizeof(hostcount[i]))
+            hostcount[i] = -1;
+        close(hostfd[i]);
+    }
+
+    endThread();
+    tscstop  = __rdtsc();
+    wallstop = std::chrono::steady_clock::now();
+}
+
+/*
+ * Profile::startThread
+ *     - Start timing the calling thread.
+ */
+void Profile::startThread() {
+    memset(&PROFTHREAD, 0, sizeof(PROFTHREAD));
+    PROFTHREAD.phase = PHASEOTHER;
+    PROFTHREAD.last  = __rdtsc();
+}
+
+/*
+ * Profile::endThread
+ *     - Add what the calling thread timed to the totals.
+ */
+void Profile::endThread() {
+    int i;
+
+    PROFTHREAD.charge();
+
+    std::lock_guard<std::mutex> guard(lock);
+    for (i=0; i < NPHASES; i++)
+        tsc[i] += PROFTHREAD.tsc[i];
+    memset(PROFTHREAD.tsc, 0, sizeof(PROFTHREAD.tsc));
+}
+
+/*
+ * Profile::print
+ *     - Print the throughput, the time spent in each phase and the
+ *       host counters. records is the # of trace records simulated.
+ */
+void Profile::print(ulong records) {
+    int i;
+    ulong all = 0;
+    double secs = std::chrono::duration<double>(wallstop - wallstart).count();
+    double hz   = secs > 0 ? (tscstop - tscstart) / secs : 0;
+
+    for (i=0; i < NPHASES; i++)
+        all += tsc[i];
+
+    printf("========================================================== (Profile)\n");
+    printf("01. records simulated:                          %lu\n", records);
+    printf("02. wall time (seconds):                        %.3f\n", secs);
+    printf("03. records per second:                         %.0f\n", secs > 0 ? records / secs : 0);
+    printf("04. time by phase (all threads)   seconds   percent\n");
+    for (i=0; i < NPHASES; i++)
+        printf("    %-28s %10.3f %8.1f%%\n", PHASENAMES[i],
+               hz > 0 ? tsc[i] / hz : 0, all ? 100.0 * tsc[i] / all : 0);
+    for (i=0; i < NHOSTEVENTS; i++)
+        if (hostcount[i] < 0)
+            printf("%02d. host %-20s                   %s\n", 5 + i, HOSTNAMES[i], "unavailable");
+        else
+            printf("%02d. host %-20s                   %lld\n", 5 + i, HOSTNAMES[i], hostcount[i]);
+}
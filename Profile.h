@@ -0,0 +1,99 @@
+/*
+ * Dusty Mabe - 2014
+ * Profile.h - Header file for profiling the simulator itself. Only
+ *             compiled in when built with -DPROFILE (make PROFILE=1).
+ *             Otherwise the PROF_*() macros expand to nothing.
+ *
+ *             PROF_SCOPE(phase) starts timing phase (with rdtsc) until
+ *             the end of the enclosing block. Time is charged to the
+ *             innermost phase only, so a directory lookup done from
+ *             inside an L2 access counts as directory time and not
+ *             as L2 time. Each thread keeps its own totals and adds
+ *             them to the global ones when it is done.
+ *
+ *             The host LLC and TLB misses of the whole run (all
+ *             threads) are read with perf_event_open if the kernel
+ *             lets us.
+ */
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <x86intrin.h>
+#include "types.h"
+
+// Phases of the simulation
+enum {
+    PHASEOTHER = 0, // Not in any of the below (setup, ..)
+    PHASEPARSE,     // Reading the trace and driving the tiles
+    PHASEL1,        // Tile::Access (L1 and running the events)
+    PHASEL2,        // Tile::L2Retrieve
+    PHASEDIR,       // Dir::getFromNetwork
+    PHASENET,       // Routing messages (Net::readyEvent)
+    PHASEFLUSH,     // Tile::FlushDirtyBlocks
+    PHASEWAIT,      // Waiting at a barrier (parallel mode)
+    NPHASES,
+};
+
+// Names of the phases (indexed by PHASEOTHER, PHASEPARSE, ...)
+extern const char *PHASENAMES[];
+
+#ifdef PROFILE
+#define PROF_SCOPE(p)        ProfScope profscope(p)
+#define PROF_START()         Profile::start()
+#define PROF_STOP()          Profile::stop()
+#define PROF_THREAD_START()  Profile::startThread()
+#define PROF_THREAD_END()    Profile::endThread()
+#define PROF_PRINT(records)  Profile::print(records)
+#else
+#define PROF_SCOPE(p)
+#define PROF_START()
+#define PROF_STOP()
+#define PROF_THREAD_START()
+#define PROF_THREAD_END()
+#define PROF_PRINT(records)
+#endif
+
+// What one thread has timed so far
+class ProfThread {
+    public:
+        int   phase;           // Phase being timed
+        ulong last;            // When phase was last charged
+        ulong tsc[NPHASES];    // Cycles charged to each phase
+
+        // Charge the time since last to the current phase
+        void charge() {
+            ulong now = __rdtsc();
+            tsc[phase] += now - last;
+            last = now;
+        }
+};
+
+extern thread_local ProfThread PROFTHREAD;
+
+// Times its phase from construction to destruction
+class ProfScope {
+    private:
+        int outer; // Phase to go back to
+
+    public:
+        ProfScope(int p) {
+            PROFTHREAD.charge();
+            outer = PROFTHREAD.phase;
+            PROFTHREAD.phase = p;
+        }
+        ~ProfScope() {
+            PROFTHREAD.charge();
+            PROFTHREAD.phase = outer;
+        }
+};
+
+class Profile {
+    public:
+        static void start();
+        static void stop();
+        static void startThread();
+        static void endThread();
+        static void print(ulong records);
+};
+
+#endif
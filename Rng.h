@@ -0,0 +1,43 @@
+/*
+ * Dusty Mabe - 2014
+ * Rng.h - Small, fast, seedable random number generator (xorshift64*).
+ *         The seed is run through splitmix64 first so that nearby
+ *         seeds (1, 2, 3, ..) give unrelated streams and a seed of 0
+ *         is fine. The whole state is one ulong so it is trivial to
+ *         save and restore.
+ */
+#ifndef RNG_H
+#define RNG_H
+
+#include "types.h"
+
+class Rng {
+    public:
+        ulong state;
+
+        Rng(ulong seed=1) { setSeed(seed); }
+
+        void setSeed(ulong seed) {
+            ulong z = seed + 0x9e3779b97f4a7c15UL;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9UL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebUL;
+            state = z ^ (z >> 31);
+            if (state == 0)
+                state = 0x9e3779b97f4a7c15UL;
+        }
+
+        // Next 64 random bits
+        ulong next() {
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            return state * 0x2545f4914f6cdd1dUL;
+        }
+
+        // Uniform in [0, n) without a divide
+        ulong below(ulong n) {
+            return (ulong)(((unsigned __int128)next() * n) >> 64);
+        }
+};
+
+#endif
@@ -0,0 +1,313 @@
+/*
+ * Dusty Mabe - 2014
+ * Sample.cc - Implementation of sampled simulation.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <assert.h>
+#include "Sample.h"
+#include "Tile.h"
+#include "Event.h"
+
+// Global event queue is defined in simulator.cc
+extern thread_local EventQueue *EVENTQ;
+
+RatioEst::RatioEst() {
+    n     = 0;
+    used  = 0;
+    swx   = 0;
+    swy   = 0;
+    swwxx = 0;
+    swwyy = 0;
+    swwxy = 0;
+}
+
+/*
+ * RatioEst::add
+ *     - Add a sample of x and y that stands for w samples.
+ */
+void RatioEst::add(double w, double x, double y) {
+    n++;
+    if (x > 0)
+        used++;
+    swx   += w * x;
+    swy   += w * y;
+    swwxx += w * w * x * x;
+    swwyy += w * w * y * y;
+    swwxy += w * w * x * y;
+}
+
+/*
+ * RatioEst::ci
+ *     - Half width of the confidence interval of ratio(). Uses the
+ *       linearized variance of a ratio estimator:
+ *
+ *         var(R) = n/(n-1) * sum(w^2 * (y - R*x)^2) / sum(w*x)^2
+ */
+double RatioEst::ci() {
+    double r = ratio();
+    double var;
+
+    if (!hasCI() || swx == 0)
+        return 0.0;
+
+    var = (swwyy - 2 * r * swwxy + r * r * swwxx) / (swx * swx);
+    var = var * n / (n - 1);
+    return (var > 0) ? SAMPLEZ * sqrt(var) : 0.0;
+}
+
+
+Sampler::Sampler(ulong u, ulong w, double err, ulong n) {
+    assert(u > 0);
+
+    unit     = u;
+    warm     = w;
+    target   = err;
+    total    = n;
+    pos      = 0;
+    records  = 0;
+    detailed = 0;
+    units    = 0;
+    mode     = SAMPLEDETAIL;
+
+    // Spread SAMPLEINIT units over the trace until we know better
+    if (total)
+        period = MAX(unit + warm, total / SAMPLEINIT);
+    else
+        period = SAMPLEINIT * (unit + warm);
+}
+
+/*
+ * Sampler::setMode
+ *     - Switch between functional and detailed simulation.
+ */
+void Sampler::setMode(int m) {
+    mode = m;
+    EVENTQ->functional = (m == SAMPLEWARM);
+}
+
+/*
+ * Sampler::next
+ *     - Move on one record. See Sample.h.
+ */
+int Sampler::next(Tile **tiles) {
+    int i;
+
+    if (pos == period) {
+        endUnit(tiles);
+        pos = 0;
+    }
+
+    if (pos == 0)
+        setMode(SAMPLEWARM);
+    if (pos == period - unit - warm)
+        setMode(SAMPLEDETAIL);
+    if (pos == period - unit) {
+        setMode(SAMPLEMEASURE);
+        for (i=0; i < NPROCS; i++) {
+            tiles[i]->Snapshot(&start[i]);
+            startl2[i] = tiles[i]->l2accesses;
+        }
+    }
+
+    pos++;
+    records++;
+    if (mode != SAMPLEWARM)
+        detailed++;
+    return (mode == SAMPLEWARM);
+}
+
+/*
+ * Sampler::endUnit
+ *     - A unit has been measured. Add what each tile did during it
+ *       to the estimates.
+ */
+void Sampler::endUnit(Tile **tiles) {
+    int i;
+    double w = period;
+    double x, sx = 0, sy = 0, sl1 = 0, sl2x = 0, sl2 = 0;
+    TileSnap now;
+
+    for (i=0; i < NPROCS; i++) {
+        tiles[i]->Snapshot(&now);
+        x = now.accesses - start[i].accesses;
+        aat[i].add(w, x, now.cycle - start[i].cycle);
+        l1miss[i].add(w, x, now.l1misses - start[i].l1misses);
+        l2miss[i].add(w, tiles[i]->l2accesses - startl2[i],
+                         now.l2misses - start[i].l2misses);
+
+        sx   += x;
+        sy   += now.cycle - start[i].cycle;
+        sl1  += now.l1misses - start[i].l1misses;
+        sl2x += tiles[i]->l2accesses - startl2[i];
+        sl2  += now.l2misses - start[i].l2misses;
+    }
+    aat[NPROCS].add(w, sx, sy);
+    l1miss[NPROCS].add(w, sx, sl1);
+    l2miss[NPROCS].add(w, sl2x, sl2);
+    units++;
+
+    adapt();
+}
+
+/*
+ * Sampler::needed
+ *     - Units needed to get the average access time of the whole
+ *       system within the target error (the interval shrinks with
+ *       the square root of the # of units).
+ */
+double Sampler::needed() {
+    double r = aat[NPROCS].ratio();
+    double rel;
+
+    if (target == 0 || r == 0)
+        return units;
+    rel = aat[NPROCS].ci() / r;
+    return ceil(units * (rel / target) * (rel / target));
+}
+
+/*
+ * Sampler::adapt
+ *     - Pick the period that spreads the # of units needed over the
+ *       trace. Units already measured keep the weight of the period
+ *       they were taken with.
+ */
+void Sampler::adapt() {
+    double need;
+
+    if (target == 0 || total == 0 || units < SAMPLEMIN)
+        return;
+
+    need   = MAX(needed(), (double)SAMPLEMIN);
+    period = MAX(unit + warm, (ulong)(total / need));
+}
+
+/*
+ * Sampler::finish
+ *     - The trace is done. A unit that was cut short is dropped.
+ */
+void Sampler::finish() {
+    setMode(SAMPLEDETAIL);
+}
+
+/*
+ * printCI
+ *     - Print " +- ci" in width characters or n/a if there is no
+ *       confidence interval.
+ */
+static void printCI(RatioEst *e, int width, int prec) {
+    if (e->hasCI())
+        printf(" +- %*.*f", width, prec, e->ci());
+    else
+        printf(" +- %*s", width, "n/a");
+}
+
+/*
+ * Sampler::met
+ *     - Is the average access time of the whole system within the
+ *       target error? Not if there is no confidence interval yet.
+ */
+int Sampler::met() {
+    double r = aat[NPROCS].ratio();
+
+    if (target == 0)
+        return 1;
+    return aat[NPROCS].hasCI() && r && aat[NPROCS].ci() / r <= target;
+}
+
+/*
+ * Sampler::PrintStats
+ *     - Print the estimates.
+ */
+void Sampler::PrintStats(Tile **tiles) {
+    int i;
+    ulong accesses = 0;
+    double r  = aat[NPROCS].ratio();
+    double ci = aat[NPROCS].ci();
+
+    for (i=0; i < NPROCS; i++)
+        accesses += tiles[i]->accesses;
+
+    printf("========================================================== (Sampling)\n");
+    printf("01. records (simulated in detail)               %lu (%lu)\n", records, detailed);
+    printf("02. units measured (records each, warming)      %lu (%lu, %lu)\n", units, unit, warm);
+    printf("03. last period (records)                       %lu\n", period);
+    printf("04. average total access time (cycles)          %f", r);
+    printCI(&aat[NPROCS], 0, 6);
+    printf("\n");
+    if (aat[NPROCS].hasCI() && r)
+        printf("05. error at 95%% confidence (target)           %.2f%% (%.2f%%)\n",
+               100 * ci / r, 100 * target);
+    else
+        printf("05. error at 95%% confidence (target)           n/a (%.2f%%)\n",
+               100 * target);
+    if (!met()) {
+        if (aat[NPROCS].hasCI())
+            printf("    target not met, about %.0f units are needed\n", needed());
+        else
+            printf("    target not met, fewer than 2 units were measured\n");
+        if (total == 0)
+            printf("    the length of the trace isn't known so the period didn't adapt\n");
+        else if (units < SAMPLEMIN)
+            printf("    the trace was too short for the period to adapt (%lu of %d units)\n",
+                   units, SAMPLEMIN);
+    }
+    printf("06. estimates (+- 95%% confidence interval)\n");
+    printf("    %4s %12s %21s %21s %21s\n", "tile", "accesses",
+           "access time", "L1 miss rate", "L2 miss rate");
+    for (i=0; i <= NPROCS; i++) {
+        if (i < NPROCS && aat[i].swx == 0)
+            continue;
+        if (i < NPROCS)
+            printf("    %4d %12lu", i, (ulong)tiles[i]->accesses);
+        else
+            printf("    %4s %12lu", "all", accesses);
+        printf(" %10.2f", aat[i].ratio());
+        printCI(&aat[i], 7, 2);
+        printf(" %10.4f", l1miss[i].ratio());
+        printCI(&l1miss[i], 7, 4);
+        printf(" %10.4f", l2miss[i].ratio());
+        printCI(&l2miss[i], 7, 4);
+        printf("\n");
+    }
+}
+
+/*
+ * printTabCI
+ *     - Print an estimate and its confidence interval (n/a if there
+ *       is none) as two columns.
+ */
+static void printTabCI(RatioEst *e) {
+    printf("%15f", e->ratio());
+    if (e->hasCI())
+        printf("%15f", e->ci());
+    else
+        printf("%15s", "n/a");
+}
+
+/*
+ * Sampler::PrintStatsTabular
+ *     - Print the estimates as a table. The last row is the whole
+ *       system.
+ */
+void Sampler::PrintStatsTabular(Tile **tiles) {
+    int i;
+    ulong accesses = 0;
+
+    printf("%15s%15s%15s%15s%15s%15s%15s%15s%15s\n", "tile", "accesses",
+           "units", "AAT", "AATci", "L1missrate", "L1ci", "L2missrate", "L2ci");
+    for (i=0; i <= NPROCS; i++) {
+        if (i < NPROCS) {
+            printf("%15d%15lu", i, (ulong)tiles[i]->accesses);
+            accesses += tiles[i]->accesses;
+        } else {
+            printf("%15s%15lu", "all", accesses);
+        }
+        printf("%15lu", units);
+        printTabCI(&aat[i]);
+        printTabCI(&l1miss[i]);
+        printTabCI(&l2miss[i]);
+        printf("\n");
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * Dusty Mabe - 2014
+ * Sample.h - Header file for sampled simulation (in the style of
+ *            SMARTS, Wunderlich et al. ISCA 2003). The trace is cut
+ *            into periods. The end of each period is simulated in
+ *            detail and the rest only warms the caches:
+ *
+ *              |<-------------------- period ------------------->|
+ *              | functional warming        | warm     | unit     |
+ *
+ *            - functional warming - accesses update the L1/L2 tags,
+ *                                   CCSMs and directory but no events
+ *                                   are made (see Tile::Warm())
+ *            - warm               - detailed simulation so the network
+ *                                   and memory queues fill back up
+ *            - unit               - detailed simulation that is
+ *                                   measured
+ *
+ *            Each unit gives one sample of the cycles, accesses and
+ *            misses of every tile. The average access time and miss
+ *            rates are ratio estimates over the samples (each weighted
+ *            by the period it stands for) and are printed with their
+ *            confidence interval.
+ *
+ *            The period adapts. Once SAMPLEMIN units are in, the
+ *            number of units needed to get the average access time of
+ *            the whole system within the target error is worked out
+ *            from the variance so far and the period is set to spread
+ *            that many units over the trace.
+ *
+ *            Only the end of each period is measured so a transient
+ *            shorter than a period (the caches filling up at the start
+ *            of the trace) is mostly left out of the estimates.
+ */
+#ifndef SAMPLE_H
+#define SAMPLE_H
+
+#include "types.h"
+#include "params.h"
+#include "IntervalStats.h"
+
+class Tile; // Forward Declaration
+
+// What the sampler is doing
+enum {
+    SAMPLEWARM = 0, // Functional warming
+    SAMPLEDETAIL,   // Detailed warming
+    SAMPLEMEASURE,  // Detailed and measured
+};
+
+#define SAMPLEINIT 50   // Units to spread over the trace to start with
+#define SAMPLEMIN  30   // Units needed before the period is adapted
+#define SAMPLEZ    1.96 // z for a 95% confidence interval
+
+// Ratio estimate (sum of y / sum of x) over weighted samples
+class RatioEst {
+    public:
+        ulong  n;
+        ulong  used;            // Samples with x > 0
+        double swx, swy;        // Sums of w*x and w*y
+        double swwxx, swwyy, swwxy; // Sums of w^2*x^2, ...
+
+        RatioEst();
+        void   add(double w, double x, double y);
+        double ratio() { return swx ? swy / swx : 0.0; }
+        double ci();
+
+        // Is there a confidence interval? It takes at least two
+        // samples where something happened.
+        int    hasCI() { return used >= 2; }
+};
+
+class Sampler {
+    private:
+        ulong    pos;              // Records into the current period
+        TileSnap start[NPROCS];    // Counters at the start of the unit
+        ulong    startl2[NPROCS];  // .. and the L2 accesses
+
+        void setMode(int m);
+        void endUnit(Tile **tiles);
+        void adapt();
+
+    public:
+        ulong  unit;     // Records measured in each unit
+        ulong  warm;     // Records of detailed warming before a unit
+        ulong  period;   // Records from one unit to the next
+        double target;   // Relative error aimed for (0 = fixed period)
+        ulong  total;    // Records in the trace (estimate, 0 = unknown)
+        int    mode;
+
+        ulong  records;  // Records seen
+        ulong  detailed; // .. that were simulated in detail
+        ulong  units;    // Units measured
+
+        // Estimates for each tile and the whole system (NPROCS)
+        RatioEst aat[NPROCS+1];    // cycles / access
+        RatioEst l1miss[NPROCS+1]; // L1 misses / access
+        RatioEst l2miss[NPROCS+1]; // L2 misses / L2 access
+
+        Sampler(ulong u, ulong w, double err, ulong n);
+
+        // Called before each record. Returns 1 if the record should
+        // only warm the caches (Tile::Warm()) and 0 if it should be
+        // simulated in detail (Tile::Access()).
+        int next(Tile **tiles);
+
+        void   finish();
+        double needed();
+        int    met();
+        void   PrintStats(Tile **tiles);
+        void   PrintStatsTabular(Tile **tiles);
+};
+
+#endif
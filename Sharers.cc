@@ -0,0 +1,238 @@
+/*
+ * Dusty Mabe - 2014
+ * Sharers.cc - Implementation of the directory sharer encodings.
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include "Sharers.h"
+
+// Names of the sharer encodings (indexed by SHRFULL, SHRPTR, ...)
+const char *SHARERNAMES[] = { "full", "ptr", "cv", "list" };
+
+/*
+ * Sharers::create
+ *     - Create a new set of sharers using the encoding requested.
+ *       n is the number of partitions and ptrs is the number of
+ *       pointers for the limited pointer encodings.
+ */
+Sharers * Sharers::create(int encoding, int n, int ptrs) {
+    switch (encoding) {
+        case SHRFULL: return new FullSharers(n);
+        case SHRPTR:  return new PtrSharers(n, ptrs);
+        case SHRCV:   return new CVSharers(n, ptrs);
+        case SHRLIST: return new ListSharers(n);
+        default:
+            assert(0); // Should not get here
+    }
+    return NULL;
+}
+
+/*
+ * Sharers::log2ceil
+ *     - Bits needed to hold a partition id (at least 1)
+ */
+int Sharers::log2ceil(int n) {
+    int bits = 1;
+    while ((1 << bits) < n)
+        bits++;
+    return bits;
+}
+
+/*
+ * Sharers::next
+ *     - Find the first partition at or after bit that might share
+ *       the block (getBit() returns 1).
+ *
+ * Returns the partition or -1 if there are no more.
+ */
+int Sharers::next(int bit) {
+    for (; bit < size; bit++)
+        if (test(bit))
+            return bit;
+    return -1;
+}
+
+/*
+ * Sharers::count
+ *     - How many partitions might share the block? For imprecise
+ *       encodings this includes partitions that can't be ruled out.
+ */
+int Sharers::count() {
+    int i;
+    int n = 0;
+    for (i=0; i < size; i++)
+        if (test(i))
+            n++;
+    return n;
+}
+
+/*
+ * Sharers::nextExact
+ *     - next() for the encodings that hold the exact set of sharers.
+ */
+int Sharers::nextExact(int bit) {
+    unsigned int rest;
+
+    if (bit >= size)
+        return -1;
+    rest = (unsigned int)exact >> bit;
+    return rest ? bit + __builtin_ctz(rest) : -1;
+}
+
+/*
+ * Sharers::pack
+ *     - Copy the state to (save = 1) or from (save = 0) w
+ */
+void Sharers::pack(int *w, int save) {
+    if (save)
+        w[0] = exact;
+    else
+        exact = w[0];
+}
+
+/*
+ * PtrSharers - Dir_i_B. Up to i exact pointers. Once there are more
+ *              sharers than pointers every partition must be assumed
+ *              to share the block (broadcast) until the entry is reset.
+ */
+PtrSharers::PtrSharers(int n, int i) : Sharers(n) {
+    assert(i > 0);
+    maxptrs  = i;
+    nptrs    = 0;
+    overflow = 0;
+    ptrs     = new int[i];
+}
+
+PtrSharers::~PtrSharers() {
+    delete[] ptrs;
+}
+
+int PtrSharers::findPtr(int bit) {
+    int i;
+    for (i=0; i < nptrs; i++)
+        if (ptrs[i] == bit)
+            return i;
+    return -1;
+}
+
+int PtrSharers::test(int bit) {
+    if (overflow)
+        return 1;
+    return (findPtr(bit) != -1);
+}
+
+void PtrSharers::set(int bit) {
+    if (overflow || findPtr(bit) != -1)
+        return;
+    if (nptrs < maxptrs)
+        ptrs[nptrs++] = bit;
+    else
+        overflow = 1;
+}
+
+void PtrSharers::clear(int bit) {
+    int i = findPtr(bit);
+
+    // Once in broadcast mode we no longer know who the sharers
+    // are so we can't remove one.
+    if (overflow || i == -1)
+        return;
+
+    ptrs[i] = ptrs[--nptrs];
+}
+
+void PtrSharers::reset() {
+    nptrs    = 0;
+    overflow = 0;
+}
+
+int PtrSharers::storageBits() {
+    return maxptrs*log2ceil(size) + 1; // pointers + overflow bit
+}
+
+void PtrSharers::pack(int *w, int save) {
+    int i;
+    int n = Sharers::words();
+
+    Sharers::pack(w, save);
+    if (save) {
+        w[n] = nptrs;
+        w[n+1] = overflow;
+        for (i=0; i < maxptrs; i++)
+            w[n+2+i] = ptrs[i];
+    } else {
+        nptrs = w[n];
+        overflow = w[n+1];
+        for (i=0; i < maxptrs; i++)
+            ptrs[i] = w[n+2+i];
+    }
+}
+
+/*
+ * CVSharers - Dir_i_CV_r. Up to i exact pointers. On overflow the 
+ *             pointer bits are reused as a coarse vector where each
+ *             bit covers a group of r partitions.
+ */
+CVSharers::CVSharers(int n, int i) : PtrSharers(n, i) {
+    int bits = i*log2ceil(n);
+    coarse    = 0;
+    groupsize = (n + bits - 1) / bits;
+}
+
+int CVSharers::test(int bit) {
+    if (overflow)
+        return ((coarse & (1 << (bit / groupsize))) ? 1 : 0);
+    return (findPtr(bit) != -1);
+}
+
+void CVSharers::set(int bit) {
+    int i;
+
+    if (overflow) {
+        coarse |= (1 << (bit / groupsize));
+        return;
+    }
+
+    if (findPtr(bit) != -1)
+        return;
+
+    if (nptrs < maxptrs) {
+        ptrs[nptrs++] = bit;
+        return;
+    }
+
+    // Out of pointers. Switch over to the coarse vector.
+    overflow = 1;
+    coarse   = (1 << (bit / groupsize));
+    for (i=0; i < nptrs; i++)
+        coarse |= (1 << (ptrs[i] / groupsize));
+}
+
+void CVSharers::clear(int bit) {
+    // A coarse bit covers other partitions too so it can't be cleared
+    if (overflow)
+        return;
+    PtrSharers::clear(bit);
+}
+
+void CVSharers::reset() {
+    PtrSharers::reset();
+    coarse = 0;
+}
+
+int CVSharers::storageBits() {
+    int ptrbits = maxptrs*log2ceil(size);
+    int cvbits  = (size + groupsize - 1) / groupsize;
+    return ((ptrbits > cvbits) ? ptrbits : cvbits) + 1; // + mode bit
+}
+
+void CVSharers::pack(int *w, int save) {
+    int n = PtrSharers::words();
+
+    PtrSharers::pack(w, save);
+    if (save)
+        w[n] = coarse;
+    else
+        coarse = w[n];
+}
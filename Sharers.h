@@ -0,0 +1,145 @@
+/*
+ * Dusty Mabe - 2014
+ * Sharers.h - Header file for the sharer encodings a directory entry
+ *             can use to track which partitions cache a block. 
+ *
+ *             - SHRFULL - full bit-vector (1 bit per partition)
+ *             - SHRPTR  - Dir_i_B: i pointers, broadcast on overflow
+ *             - SHRCV   - Dir_i_CV: i pointers, coarse vector on overflow
+ *             - SHRLIST - SCI style linked list of sharers
+ *
+ *             All encodings present the same interface as BitVector
+ *             so the Dir can iterate over them with getBit() (or
+ *             getNextSetBit() to skip straight to the sharers). An
+ *             imprecise encoding returns 1 for every partition it
+ *             can not rule out. Each encoding also keeps the exact
+ *             set of sharers (what a full bit-vector would hold) so
+ *             the Dir can count the extra invalidations it causes.
+ */
+#ifndef SHARERS_H
+#define SHARERS_H
+
+#include "types.h"
+
+// Sharer encodings
+enum {
+    SHRFULL = 0,
+    SHRPTR,
+    SHRCV,
+    SHRLIST,
+};
+
+// Names of the sharer encodings (indexed by SHRFULL, SHRPTR, ...)
+extern const char *SHARERNAMES[];
+
+class Sharers {
+    protected:
+        int exact; // Exact set of sharers (for statistics only)
+
+        virtual int  test(int bit)  = 0;
+        virtual void set(int bit)   = 0;
+        virtual void clear(int bit) = 0;
+        virtual void reset()        = 0;
+        virtual int  next(int bit);
+        virtual int  count();
+
+        // For encodings whose getBit() is the exact set
+        int  nextExact(int bit);
+        int  countExact()   { return __builtin_popcount(exact); }
+
+    public:
+        int size;  // # of partitions that can be tracked
+
+        Sharers(int n)      { exact = 0; size = n; }
+        virtual ~Sharers()  {};
+
+        int  getBit(int bit)   { return test(bit); }
+        void setBit(int bit)   { exact |=  (1 << bit); set(bit);   }
+        void clearBit(int bit) { exact &= ~(1 << bit); clear(bit); }
+        void clearAllBits()    { exact = 0; reset(); }
+        int  isSharer(int bit) { return ((exact & (1 << bit)) ? 1 : 0); }
+        int  getNextSetBit(int bit) { return next(bit); }
+        int  getNumSetBits()   { return count(); }
+
+        // Bits of directory storage needed per entry
+        virtual int storageBits() = 0;
+        // Bits of storage needed in each cache line holding a copy
+        virtual int lineBits()    { return 0; }
+        // Are invalidations sent one after another (list walk)?
+        virtual int serial()      { return 0; }
+
+        // Copy the state to (save = 1) or from (save = 0) w, for
+        // checkpoints. words() ints are used, the same for every entry
+        // of an encoding.
+        virtual int  words()      { return 1; }
+        virtual void pack(int *w, int save);
+
+        static Sharers * create(int encoding, int n, int ptrs);
+        static int log2ceil(int n);
+};
+
+class FullSharers : public Sharers {
+    protected:
+        int  test(int bit)  { return isSharer(bit); }
+        void set(int)       { }
+        void clear(int)     { }
+        void reset()        { }
+        int  next(int bit)  { return nextExact(bit); }
+        int  count()        { return countExact(); }
+    public:
+        FullSharers(int n) : Sharers(n) {}
+        int storageBits()   { return size; }
+};
+
+class PtrSharers : public Sharers {
+    protected:
+        int *ptrs;     // Partition ids of the sharers
+        int  nptrs;    // # of pointers in use
+        int  maxptrs;  // i, the # of pointers available
+        int  overflow; // More than i sharers (broadcast)
+
+        int  findPtr(int bit);
+        int  test(int bit);
+        void set(int bit);
+        void clear(int bit);
+        void reset();
+    public:
+        PtrSharers(int n, int i);
+        ~PtrSharers();
+        int storageBits();
+        int  words()        { return Sharers::words() + 2 + maxptrs; }
+        void pack(int *w, int save);
+};
+
+class CVSharers : public PtrSharers {
+    protected:
+        int coarse;    // Coarse vector (1 bit per group of partitions)
+        int groupsize; // r, the # of partitions per coarse bit
+
+        int  test(int bit);
+        void set(int bit);
+        void clear(int bit);
+        void reset();
+    public:
+        CVSharers(int n, int i);
+        int storageBits();
+        int  words()        { return PtrSharers::words() + 1; }
+        void pack(int *w, int save);
+};
+
+class ListSharers : public Sharers {
+    protected:
+        int  test(int bit)  { return isSharer(bit); }
+        void set(int)       { }
+        void clear(int)     { }
+        void reset()        { }
+        int  next(int bit)  { return nextExact(bit); }
+        int  count()        { return countExact(); }
+    public:
+        ListSharers(int n) : Sharers(n) {}
+        int storageBits()   { return log2ceil(size) + 1; } // head ptr
+        int lineBits()      { return 2*log2ceil(size); }   // fwd/back ptrs
+        int serial()        { return 1; }
+};
+
+#endif
@@ -0,0 +1,473 @@
+/*
+ * Dusty Mabe - 2014
+ * SimPoint.cc - Implementation of phase-based simulation of
+ *               representative intervals.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <assert.h>
+#include "SimPoint.h"
+#include "Tile.h"
+#include "Event.h"
+#include "Rng.h"
+
+// Global event queue is defined in simulator.cc
+extern thread_local EventQueue *EVENTQ;
+
+// Multiplier for hashing pages and blocks (golden ratio)
+#define SPHASH 0x9e3779b97f4a7c15UL
+
+SimPoint::SimPoint(ulong n, ulong w, int kmax) {
+    int i;
+
+    assert(n > 0 && kmax > 0);
+    interval  = n;
+    warm      = w;
+    maxk      = kmax;
+    mode      = SPDETAIL;
+    intervals = 0;
+    records   = 0;
+    k         = 0;
+    rec       = 0;
+    nextrep   = 0;
+    detailed  = 0;
+    warmed    = 0;
+
+    maxintervals = 1024;
+    sigs = (float *)malloc(maxintervals * SPDIMS * sizeof(float));
+    lens = (ulong *)malloc(maxintervals * sizeof(ulong));
+    memset(counts, 0, sizeof(counts));
+    lasttouch = new ulong[2 << SPLASTBITS];
+    memset(lasttouch, 0, (2 << SPLASTBITS) * sizeof(ulong));
+
+    cluster = NULL;
+    best    = NULL;
+    centers = NULL;
+    reps    = NULL;
+    weights = NULL;
+    members = NULL;
+
+    for (i=0; i < NPROCS; i++)
+        sums[i] = NULL;
+}
+
+SimPoint::~SimPoint() {
+    int i;
+
+    free(sigs);
+    free(lens);
+    delete[] lasttouch;
+    delete[] cluster;
+    delete[] best;
+    delete[] centers;
+    delete[] reps;
+    delete[] weights;
+    delete[] members;
+    for (i=0; i < NPROCS; i++)
+        delete sums[i];
+}
+
+/*
+ * SimPoint::profile
+ *     - Add the record for addr to the signature of the current
+ *       interval (first pass).
+ */
+void SimPoint::profile(ulong addr) {
+    ulong blk  = addr >> OFFSETBITS;
+    ulong page = addr >> SPPAGEBITS;
+    ulong slot = (blk * SPHASH) >> (64 - SPLASTBITS);
+    ulong d;
+    int   b;
+
+    counts[((page * SPHASH) >> 32) % SPWSDIMS]++;
+
+    // lasttouch holds (block + 1, record) pairs. Two blocks that hash
+    // to the same slot just look like they were touched long ago.
+    b = SPREUSEDIMS - 1;
+    if (lasttouch[2*slot] == blk + 1) {
+        d = rec - lasttouch[2*slot + 1];
+        b = MIN(63 - __builtin_clzl(d | 1), SPREUSEDIMS - 1);
+    }
+    counts[SPWSDIMS + b]++;
+    lasttouch[2*slot]     = blk + 1;
+    lasttouch[2*slot + 1] = rec;
+
+    if (++rec % interval == 0)
+        endInterval();
+}
+
+/*
+ * SimPoint::endInterval
+ *     - Turn the counts of the interval that just ended into its
+ *       signature. Each half (working set and reuse) sums to 1.
+ */
+void SimPoint::endInterval() {
+    float *sig;
+    ulong n = 0;
+    int i;
+
+    if (intervals == maxintervals) {
+        maxintervals *= 2;
+        sigs = (float *)realloc(sigs, maxintervals * SPDIMS * sizeof(float));
+        lens = (ulong *)realloc(lens, maxintervals * sizeof(ulong));
+        assert(sigs && lens);
+    }
+
+    for (i=0; i < SPWSDIMS; i++)
+        n += counts[i];
+
+    sig = &sigs[intervals * SPDIMS];
+    for (i=0; i < SPDIMS; i++)
+        sig[i] = n ? (float)counts[i] / n : 0;
+
+    lens[intervals++] = n;
+    memset(counts, 0, sizeof(counts));
+}
+
+/*
+ * dist
+ *     - Squared distance between two signatures.
+ */
+static double dist(float *a, float *b) {
+    double d, sum = 0;
+    int i;
+
+    for (i=0; i < SPDIMS; i++) {
+        d = a[i] - b[i];
+        sum += d * d;
+    }
+    return sum;
+}
+
+/*
+ * SimPoint::kmeans
+ *     - Cluster the signatures into k clusters, starting from centers
+ *       picked k-means++ style with the given seed. Leaves the
+ *       clusters in cluster and their centers in centers.
+ *
+ * Returns the sum of the squared distances to the centers.
+ */
+double SimPoint::kmeans(int k, ulong seed) {
+    Rng rng(seed);
+    double *d = new double[intervals];
+    ulong  *n = new ulong[k];
+    double sum, x, sse = 0;
+    ulong i, far;
+    int c, j, iter, changed;
+
+    // First center at random, then each next one with probability
+    // proportional to the squared distance to the closest center
+    memcpy(centers, &sigs[rng.below(intervals) * SPDIMS], SPDIMS * sizeof(float));
+    for (i=0; i < intervals; i++)
+        d[i] = dist(&sigs[i * SPDIMS], centers);
+    for (c=1; c < k; c++) {
+        for (i=0, sum=0; i < intervals; i++)
+            sum += d[i];
+        x = sum * (rng.next() >> 11) / 9007199254740992.0;
+        for (i=0; i < intervals - 1 && x >= d[i]; i++)
+            x -= d[i];
+        memcpy(&centers[c * SPDIMS], &sigs[i * SPDIMS], SPDIMS * sizeof(float));
+        for (i=0; i < intervals; i++)
+            d[i] = MIN(d[i], dist(&sigs[i * SPDIMS], &centers[c * SPDIMS]));
+    }
+
+    for (i=0; i < intervals; i++)
+        cluster[i] = -1;
+
+    for (iter=0; iter < SPITERS; iter++) {
+
+        // Move each signature to its closest center
+        changed = 0;
+        sse     = 0;
+        for (i=0; i < intervals; i++) {
+            int    bestc = 0;
+            double bestd = DBL_MAX;
+            for (c=0; c < k; c++) {
+                x = dist(&sigs[i * SPDIMS], &centers[c * SPDIMS]);
+                if (x < bestd) {
+                    bestd = x;
+                    bestc = c;
+                }
+            }
+            if (cluster[i] != bestc)
+                changed = 1;
+            cluster[i] = bestc;
+            d[i] = bestd;
+            sse += bestd;
+        }
+        if (!changed)
+            break;
+
+        // Move each center to the middle of its cluster. A cluster
+        // that ended up empty takes the signature furthest from its
+        // center.
+        memset(centers, 0, k * SPDIMS * sizeof(float));
+        memset(n, 0, k * sizeof(ulong));
+        for (i=0; i < intervals; i++) {
+            n[cluster[i]]++;
+            for (j=0; j < SPDIMS; j++)
+                centers[cluster[i] * SPDIMS + j] += sigs[i * SPDIMS + j];
+        }
+        for (c=0; c < k; c++) {
+            if (n[c] == 0) {
+                for (i=1, far=0; i < intervals; i++)
+                    if (d[i] > d[far])
+                        far = i;
+                memcpy(&centers[c * SPDIMS], &sigs[far * SPDIMS], SPDIMS * sizeof(float));
+                d[far] = 0;
+                continue;
+            }
+            for (j=0; j < SPDIMS; j++)
+                centers[c * SPDIMS + j] /= n[c];
+        }
+    }
+
+    delete[] d;
+    delete[] n;
+    return sse;
+}
+
+/*
+ * SimPoint::bic
+ *     - Bayesian Information Criterion of a clustering (higher is
+ *       better). The clusters are taken to be spherical Gaussians
+ *       with the same variance (as in X-means, Pelleg and Moore 2000).
+ */
+double SimPoint::bic(int k, double sse) {
+    double R = intervals;
+    double var, loglik, params;
+    ulong *n = new ulong[k];
+    ulong i;
+    int c;
+
+    memset(n, 0, k * sizeof(ulong));
+    for (i=0; i < intervals; i++)
+        n[best[i]]++;
+
+    var = (R > k) ? sse / (SPDIMS * (R - k)) : 0;
+    var = MAX(var, 1e-12);
+
+    loglik = -R * SPDIMS / 2.0 * log(2 * M_PI * var) - SPDIMS * (R - k) / 2.0;
+    for (c=0; c < k; c++)
+        if (n[c])
+            loglik += n[c] * log(n[c] / R);
+    params = (k - 1) + k * SPDIMS + 1;
+
+    delete[] n;
+    return loglik - params / 2.0 * log(R);
+}
+
+/*
+ * SimPoint::select
+ *     - End of the first pass. Cluster the intervals and pick the
+ *       representatives.
+ */
+void SimPoint::select() {
+    int kk, c, r;
+    ulong i, *rep;
+    double sse, bestsse, lo = DBL_MAX, hi = -DBL_MAX;
+    double *scores;
+    int   **assign;
+    double  x, *closest;
+
+    if (rec % interval)
+        endInterval();
+    records = rec;
+    assert(intervals > 0);
+
+    maxk    = MIN((ulong)maxk, intervals);
+    cluster = new int[intervals];
+    best    = new int[intervals];
+    centers = new float[maxk * SPDIMS];
+    scores  = new double[maxk + 1];
+    assign  = new int*[maxk + 1];
+
+    // Best of SPRESTARTS runs for each k
+    for (kk=1; kk <= maxk; kk++) {
+        bestsse = DBL_MAX;
+        for (r=0; r < SPRESTARTS; r++) {
+            sse = kmeans(kk, 1 + r * 1000 + kk);
+            if (sse < bestsse) {
+                bestsse = sse;
+                memcpy(best, cluster, intervals * sizeof(int));
+            }
+        }
+        assign[kk] = new int[intervals];
+        memcpy(assign[kk], best, intervals * sizeof(int));
+        scores[kk] = bic(kk, bestsse);
+        lo = MIN(lo, scores[kk]);
+        hi = MAX(hi, scores[kk]);
+    }
+
+    // Smallest k that scores close to the best
+    for (k=1; k < maxk; k++)
+        if (scores[k] >= lo + SPBICFRAC * (hi - lo))
+            break;
+    memcpy(cluster, assign[k], intervals * sizeof(int));
+    for (kk=1; kk <= maxk; kk++)
+        delete[] assign[kk];
+    delete[] assign;
+    delete[] scores;
+
+    // Recompute the centers for the k picked
+    memset(centers, 0, k * SPDIMS * sizeof(float));
+    ulong *n = new ulong[k];
+    memset(n, 0, k * sizeof(ulong));
+    for (i=0; i < intervals; i++) {
+        n[cluster[i]]++;
+        for (r=0; r < SPDIMS; r++)
+            centers[cluster[i] * SPDIMS + r] += sigs[i * SPDIMS + r];
+    }
+    for (c=0; c < k; c++)
+        for (r=0; r < SPDIMS; r++)
+            centers[c * SPDIMS + r] /= MAX(n[c], 1UL);
+
+    // The interval closest to each center represents its cluster.
+    // Its weight is the # of records in the cluster.
+    rep     = new ulong[k];
+    closest = new double[k];
+    reps    = new ulong[k];
+    weights = new double[k];
+    members = new ulong[k];
+    for (c=0; c < k; c++) {
+        closest[c] = DBL_MAX;
+        weights[c] = 0;
+        members[c] = 0;
+    }
+    for (i=0; i < intervals; i++) {
+        c = cluster[i];
+        x = dist(&sigs[i * SPDIMS], &centers[c * SPDIMS]);
+        if (x < closest[c]) {
+            closest[c] = x;
+            rep[c]     = i;
+        }
+        weights[c] += lens[i];
+        members[c]++;
+    }
+
+    // Put them in trace order (insertion sort, k is small)
+    for (c=0; c < k; c++) {
+        x = weights[c];
+        i = members[c];
+        for (r=c; r > 0 && reps[r-1] > rep[c]; r--) {
+            reps[r]    = reps[r-1];
+            weights[r] = weights[r-1];
+            members[r] = members[r-1];
+        }
+        reps[r]    = rep[c];
+        weights[r] = x;
+        members[r] = i;
+    }
+
+    delete[] n;
+    delete[] rep;
+    delete[] closest;
+    delete[] lasttouch;
+    lasttouch = NULL;
+    rec = 0;
+}
+
+/*
+ * SimPoint::setMode
+ *     - Switch between skipping, functional and detailed simulation.
+ */
+void SimPoint::setMode(int m) {
+    mode = m;
+    EVENTQ->functional = (m == SPSKIP || m == SPWARM);
+}
+
+/*
+ * SimPoint::next
+ *     - Move on one record (second pass). See SimPoint.h.
+ *
+ * Returns SPSKIP, SPWARM, SPDETAIL or SPMEASURE.
+ */
+int SimPoint::next(Tile **tiles) {
+    ulong start;
+    int i, m;
+
+    if (!sums[0])
+        for (i=0; i < NPROCS; i++)
+            sums[i] = new Tile(i, 1, 0);
+
+    // Done with a representative? Add its counters in for all the
+    // records its cluster stands for.
+    if (mode == SPMEASURE && rec == (reps[nextrep] + 1) * interval) {
+        for (i=0; i < NPROCS; i++)
+            sums[i]->addStats(tiles[i], weights[nextrep] / lens[reps[nextrep]]);
+        nextrep++;
+        setMode(SPSKIP);
+    }
+
+    m = SPSKIP;
+    if (nextrep < (ulong)k) {
+        start = reps[nextrep] * interval;
+        if (rec >= start)
+            m = SPMEASURE;
+        else if (start - rec <= warm / SPDETAILDIV)
+            m = SPDETAIL;
+        else if (start - rec <= warm)
+            m = SPWARM;
+    }
+
+    if (m != mode) {
+        if (m == SPMEASURE)
+            for (i=0; i < NPROCS; i++)
+                tiles[i]->resetStats();
+        setMode(m);
+    }
+
+    rec++;
+    if (mode == SPWARM)
+        warmed++;
+    else if (mode != SPSKIP)
+        detailed++;
+    return mode;
+}
+
+/*
+ * SimPoint::finish
+ *     - The trace is done. Replace the counters of the tiles with
+ *       the whole-run counters.
+ */
+void SimPoint::finish(Tile **tiles) {
+    int i;
+
+    // The last interval may be a representative
+    if (mode == SPMEASURE) {
+        for (i=0; i < NPROCS; i++)
+            sums[i]->addStats(tiles[i], weights[nextrep] / lens[reps[nextrep]]);
+        nextrep++;
+    }
+    setMode(SPDETAIL);
+
+    for (i=0; i < NPROCS; i++) {
+        tiles[i]->resetStats();
+        if (sums[i])
+            tiles[i]->addStats(sums[i], 1.0);
+    }
+}
+
+/*
+ * SimPoint::PrintStats
+ *     - Print the phases that were found.
+ */
+void SimPoint::PrintStats() {
+    int c;
+
+    printf("========================================================== (SimPoint)\n");
+    printf("01. records (intervals of %lu)%*s%lu (%lu)\n", interval,
+           (int)(20 - snprintf(NULL, 0, "%lu", interval)), "", records, intervals);
+    printf("02. clusters picked (most tried)                %d (%d)\n", k, maxk);
+    printf("03. records simulated in detail (warmed)        %lu (%lu)\n", detailed, warmed);
+    printf("04. representatives     interval  intervals    weight\n");
+    for (c=0; c < k; c++)
+        printf("    %-18d %9lu %10lu %8.2f%%\n", c, reps[c], members[c],
+               100.0 * weights[c] / records);
+    printf("    (tile counters are rebuilt from the representatives. The\n");
+    printf("    directory and network counters only cover what was simulated.)\n");
+}
@@ -0,0 +1,125 @@
+/*
+ * Dusty Mabe - 2014
+ * SimPoint.h - Header file for phase-based simulation of representative
+ *              intervals (in the style of SimPoint, Sherwood et al.
+ *              ASPLOS 2002). A first pass over the trace cuts it into
+ *              intervals of a fixed # of records and gives each a
+ *              signature of its memory behavior:
+ *
+ *              - working set - how the accesses are spread over the
+ *                              pages touched (pages are hashed down
+ *                              to SPWSDIMS buckets)
+ *              - reuse       - how far back each block was last
+ *                              touched (log2 buckets of records, the
+ *                              last one for blocks touched for the
+ *                              first time or long ago)
+ *
+ *              The signatures are clustered with k-means for k = 1 up
+ *              to a maximum and the smallest k that scores within
+ *              SPBICFRAC of the best BIC is kept. The interval closest
+ *              to the center of each cluster represents it.
+ *
+ *              The second pass only simulates the representatives in
+ *              detail. Before each one a warmup period warms the caches
+ *              functionally (see Tile::Warm()) and its last tenth runs
+ *              in detail so the network and memory queues fill back
+ *              up. The rest of the trace is skipped. The counters of
+ *              each representative are scaled by the # of records its
+ *              cluster stands for and summed into whole-run counters
+ *              for each tile.
+ *
+ *              Nothing is updated while records are skipped, so state
+ *              that reaches back further than the warmup is off when a
+ *              representative starts. The worst is the directory (sharers
+ *              left behind by silent evictions): a stream that comes back
+ *              around to its blocks every 100K records needs about that
+ *              much --simpoint-warm to get its hop cycles right.
+ */
+#ifndef SIMPOINT_H
+#define SIMPOINT_H
+
+#include "types.h"
+#include "params.h"
+
+class Tile; // Forward Declaration
+
+// What to do with a record
+enum {
+    SPSKIP = 0, // Not simulated at all
+    SPWARM,     // Functional warming
+    SPDETAIL,   // Detailed warming (not counted)
+    SPMEASURE,  // Part of a representative
+};
+
+#define SPWSDIMS    16   // Working set buckets in a signature
+#define SPREUSEDIMS 16   // Reuse distance buckets in a signature
+#define SPDIMS      (SPWSDIMS + SPREUSEDIMS)
+#define SPPAGEBITS  12   // Working set is tracked by 4 KiB page
+#define SPLASTBITS  20   // Entries (log2) in the last touch table
+#define SPRESTARTS  5    // k-means runs (from different seeds) per k
+#define SPITERS     100  // Most k-means iterations per run
+#define SPBICFRAC   0.9  // Keep the smallest k within this of the best
+#define SPDETAILDIV 10   // Detailed part (1/n) of the warmup
+
+class SimPoint {
+    private:
+        // Signatures (SPDIMS floats per interval) and how many
+        // records are in each interval
+        float *sigs;
+        ulong *lens;
+        ulong  maxintervals;
+
+        // Signature of the interval being profiled
+        ulong  counts[SPDIMS];
+        ulong *lasttouch; // (block + 1, record) each block was last
+                          // touched at, by hash of the block
+
+        // Clustering
+        int   *cluster;   // Cluster of each interval
+        int   *best;      // Best clustering for the k being tried
+        float *centers;
+
+        // Second pass
+        ulong  rec;        // Records seen
+        ulong  nextrep;    // Index in reps of the next representative
+        Tile  *sums[NPROCS]; // Whole-run counters being built up
+
+        void   endInterval();
+        double kmeans(int k, ulong seed);
+        double bic(int k, double sse);
+        void   setMode(int m);
+
+    public:
+        ulong  interval;   // Records per interval
+        ulong  warm;       // Records of warmup before a representative
+        int    maxk;       // Most clusters to try
+        int    mode;
+
+        ulong  intervals;  // # of intervals in the trace
+        ulong  records;    // Records in the trace
+        int    k;          // Clusters picked
+
+        // Representatives in trace order (interval, weight in records)
+        ulong *reps;
+        double *weights;
+        ulong *members;    // Intervals in each rep's cluster
+        ulong  detailed;   // Records simulated in detail (second pass)
+        ulong  warmed;     // .. and warmed
+
+        SimPoint(ulong n, ulong w, int kmax);
+        ~SimPoint();
+
+        // First pass
+        void profile(ulong addr);
+        void select();
+
+        // Second pass. next() is called before each record and says
+        // what to do with it. finish() puts the whole-run counters in
+        // the tiles.
+        int  next(Tile **tiles);
+        void finish(Tile **tiles);
+
+        void PrintStats();
+};
+
+#endif
@@ -0,0 +1,187 @@
+/*
+ * Dusty Mabe - 2014
+ * SparseDir.cc - Implementation of a finite, set-associative sparse
+ *                directory that limits how many blocks the Dir tracks.
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include "SparseDir.h"
+#include "Checkpoint.h"
+
+/*
+ * SparseDir::SparseDir - create a new sparse directory.
+ * Arguments:
+ *      - entries - total # of directory entries
+ *      - a       - the associativity (entries within a set)
+ *      - p       - the replacement policy (SDIRLRU or SDIRRANDOM)
+ */
+SparseDir::SparseDir(ulong entries, ulong a, int p) {
+    ulong i;
+
+    assert(entries > 0 && a > 0);
+    assert(entries % a == 0);
+
+    numEntries = entries;
+    assoc      = a;
+    numSets    = entries / a;
+    policy     = p;
+
+    lruCounter  = 0;
+    rngState    = 0x2545F4914F6CDD1DUL;
+    allocations = 0;
+    evictions   = 0;
+    occupancy   = 0;
+    peak        = 0;
+
+    // create a two dimentional array, sized as tags[sets][assoc]
+    tags = new SparseDirTag*[numSets];
+    for (i=0; i < numSets; i++)
+        tags[i] = new SparseDirTag[assoc];
+}
+
+SparseDir::~SparseDir() {
+    ulong i;
+    for (i=0; i < numSets; i++)
+        delete[] tags[i];
+    delete[] tags;
+}
+
+/*
+ * SparseDir::calcIndex
+ *     - Return the set that blockaddr maps to. Each directory shard
+ *       only sees blocks with the same low address bits so mix in
+ *       the upper bits before picking a set.
+ */
+ulong SparseDir::calcIndex(ulong blockaddr) {
+    return ((blockaddr * 0x9E3779B97F4A7C15UL) >> 32) % numSets;
+}
+
+/*
+ * SparseDir::findTag
+ *     - Find the tag that tracks blockaddr. 
+ *
+ * Returns the tag or NULL if not found.
+ */
+SparseDirTag * SparseDir::findTag(ulong blockaddr) {
+    ulong j;
+    ulong index = calcIndex(blockaddr);
+
+    for (j=0; j < assoc; j++)
+        if (tags[index][j].valid && tags[index][j].blockaddr == blockaddr)
+            return &(tags[index][j]);
+
+    return NULL;
+}
+
+/*
+ * SparseDir::getVictim
+ *     - Get an invalid tag from the set blockaddr maps to or,
+ *       if the set is full, choose one to evict based on the
+ *       replacement policy.
+ */
+SparseDirTag * SparseDir::getVictim(ulong blockaddr) {
+    ulong j, victim, min;
+    ulong index = calcIndex(blockaddr);
+
+    // First see if there are any invalid entries
+    for (j=0; j < assoc; j++)
+        if (!tags[index][j].valid)
+            return &(tags[index][j]);
+
+    // Random: xorshift so runs are repeatable
+    if (policy == SDIRRANDOM) {
+        rngState ^= rngState << 13;
+        rngState ^= rngState >> 7;
+        rngState ^= rngState << 17;
+        return &(tags[index][rngState % assoc]);
+    }
+
+    // LRU: find the entry with the smallest seq
+    victim = 0;
+    min    = tags[index][0].seq;
+    for (j=1; j < assoc; j++) {
+        if (tags[index][j].seq < min) {
+            victim = j;
+            min    = tags[index][j].seq;
+        }
+    }
+
+    return &(tags[index][victim]);
+}
+
+/*
+ * SparseDir::touch
+ *     - Update LRU information for blockaddr which must already
+ *       have an entry.
+ */
+void SparseDir::touch(ulong blockaddr) {
+    SparseDirTag *tag = findTag(blockaddr);
+    assert(tag);
+    tag->seq = ++lruCounter;
+}
+
+/*
+ * SparseDir::allocate
+ *     - Allocate an entry for blockaddr. If a valid entry had to be
+ *       evicted to make room then its block address is stored in 
+ *       victim so the directory can back-invalidate its sharers.
+ *
+ * Returns 1 if an entry was evicted, 0 otherwise.
+ */
+int SparseDir::allocate(ulong blockaddr, ulong *victim) {
+    int evicted = 0;
+    SparseDirTag *tag;
+
+    assert(findTag(blockaddr) == NULL);
+
+    tag = getVictim(blockaddr);
+    if (tag->valid) {
+        *victim = tag->blockaddr;
+        evictions++;
+        evicted = 1;
+    } else {
+        occupancy++;
+        if (occupancy > peak)
+            peak = occupancy;
+    }
+
+    tag->blockaddr = blockaddr;
+    tag->seq       = ++lruCounter;
+    tag->valid     = 1;
+    allocations++;
+
+    return evicted;
+}
+
+/*
+ * SparseDir::remove
+ *     - Free the entry for blockaddr (if there is one) because the
+ *       directory no longer needs to track the block.
+ */
+void SparseDir::remove(ulong blockaddr) {
+    SparseDirTag *tag = findTag(blockaddr);
+    if (tag) {
+        tag->valid = 0;
+        occupancy--;
+    }
+}
+
+/*
+ * SparseDir::checkpoint
+ *     - Save or restore the tags, the replacement state and the
+ *       counters.
+ */
+void SparseDir::checkpoint(Checkpoint *ck) {
+    ulong i;
+
+    ck->section(CKSECTION('S','D','i','r'));
+    CKIO(ck, lruCounter);
+    CKIO(ck, rngState);
+    CKIO(ck, allocations);
+    CKIO(ck, evictions);
+    CKIO(ck, occupancy);
+    CKIO(ck, peak);
+    for (i=0; i < numSets; i++)
+        ck->io(tags[i], assoc*sizeof(SparseDirTag));
+}
@@ -0,0 +1,69 @@
+/*
+ * Dusty Mabe - 2014
+ * SparseDir.h - Header file for a finite, set-associative sparse
+ *               directory. It sits in front of the Dir and limits the
+ *               number of blocks the directory can track at once. When
+ *               a set is full an entry must be evicted which forces the
+ *               directory to back-invalidate all sharers of that block.
+ */
+#ifndef SPARSEDIR_H
+#define SPARSEDIR_H
+
+#include "types.h"
+
+class Checkpoint; // Forward Declaration
+
+// Replacement policies for the sparse directory
+enum {
+    SDIRLRU = 0,
+    SDIRRANDOM,
+};
+
+class SparseDirTag {
+
+    public:
+        ulong blockaddr;
+        ulong seq;
+        int   valid;
+
+        SparseDirTag() { blockaddr = 0; seq = 0; valid = 0; }
+};
+
+class SparseDir {
+    private:
+
+        // The 2-dimensional tag array [sets][assoc]
+        SparseDirTag **tags;
+
+        // Variable to keep up with LRU order
+        ulong lruCounter;
+
+        // State for the random replacement policy. Kept private
+        // so it does not disturb the random() stream used to pick
+        // processors in main().
+        ulong rngState;
+
+        SparseDirTag * findTag(ulong blockaddr);
+        SparseDirTag * getVictim(ulong blockaddr);
+
+    public:
+        ulong numEntries, assoc, numSets;
+        int policy;
+
+        // Some counters
+        ulong allocations; // Entries allocated
+        ulong evictions;   // Entries evicted to make room (dir-induced)
+        ulong occupancy;   // Entries currently valid
+        ulong peak;        // Max entries valid at once
+
+        SparseDir(ulong entries, ulong a, int p);
+        ~SparseDir();
+
+        ulong calcIndex(ulong blockaddr);
+        void  touch(ulong blockaddr);
+        int   allocate(ulong blockaddr, ulong *victim);
+        void  remove(ulong blockaddr);
+        void  checkpoint(Checkpoint *ck);
+};
+
+#endif
@@ -0,0 +1,90 @@
+/*
+ * Dusty Mabe - 2014
+ * Stats.cc - Implementation of the statistics registry.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Stats.h"
+#include "Checkpoint.h"
+
+char       **StatRegistry::groups   = NULL;
+const char **StatRegistry::names    = NULL;
+ulong      **StatRegistry::counters = NULL;
+int          StatRegistry::nstats   = 0;
+int          StatRegistry::maxstats = 0;
+
+/*
+ * StatRegistry::add
+ *     - Remember counter under group/name. The group is copied (it is
+ *       usually built on the stack) but name must stay around.
+ */
+void StatRegistry::add(const char *group, const char *name, ulong *counter) {
+
+    // Grow the tables if they are full
+    if (nstats == maxstats) {
+        maxstats = maxstats ? maxstats * 2 : 256;
+        groups   = (char **)realloc(groups, maxstats * sizeof(char *));
+        names    = (const char **)realloc(names, maxstats * sizeof(char *));
+        counters = (ulong **)realloc(counters, maxstats * sizeof(ulong *));
+    }
+
+    // Groups are added in runs so share the string with the last one
+    if (nstats && strcmp(groups[nstats-1], group) == 0)
+        groups[nstats] = groups[nstats-1];
+    else
+        groups[nstats] = strdup(group);
+    names[nstats]    = name;
+    counters[nstats] = counter;
+    nstats++;
+}
+
+/*
+ * StatRegistry::print
+ *     - Print one line per group with the counters that are not zero.
+ */
+void StatRegistry::print() {
+    int i;
+
+    printf("========================================================== (Stats)\n");
+    for (i=0; i < nstats; i++) {
+        if (i == 0 || groups[i] != groups[i-1])
+            printf("%-12s", groups[i]);
+        if (*counters[i])
+            printf(" %s=%lu", names[i], *counters[i]);
+        if (i == nstats-1 || groups[i+1] != groups[i])
+            printf("\n");
+    }
+}
+
+/*
+ * StatRegistry::reset
+ *     - Zero all of the counters.
+ */
+void StatRegistry::reset() {
+    int i;
+
+    for (i=0; i < nstats; i++)
+        *counters[i] = 0;
+}
+
+/*
+ * StatRegistry::checkpoint
+ *     - Save or restore all of the counters. The same counters have
+ *       to be registered (built with the same STATS setting).
+ */
+void StatRegistry::checkpoint(Checkpoint *ck) {
+    int i;
+    int n = nstats;
+
+    ck->section(CKSECTION('S','t','a','t'));
+    CKIO(ck, n);
+    if (n != nstats) {
+        printf("Checkpoint %s has %d stats but this simulator has %d (STATS build?)\n",
+               ck->name, n, nstats);
+        exit(1);
+    }
+    for (i=0; i < nstats; i++)
+        ck->io(counters[i], sizeof(ulong));
+}
@@ -0,0 +1,48 @@
+/*
+ * Dusty Mabe - 2014
+ * Stats.h - Header file for the optional statistics. These counters
+ *           are only compiled in when built with -DSTATS (make
+ *           STATS=1). Otherwise STAT_INC() and friends expand to
+ *           nothing and the counters don't exist at all, so they
+ *           cost nothing.
+ *
+ *           Counters are plain ulongs owned by whatever they count
+ *           (a cache, the network, ..) and are bumped with normal
+ *           non-atomic increments. Each one registers itself under a
+ *           group and a name so they can all be printed at the end.
+ */
+#ifndef STATS_H
+#define STATS_H
+
+#include "types.h"
+
+class Checkpoint; // Forward Declaration
+
+#ifdef STATS
+#define STAT_INC(x)               ((x)++)
+#define STAT_REGISTER(g, n, p)    StatRegistry::add((g), (n), (p))
+#define STAT_PRINT()              StatRegistry::print()
+#define STAT_RESET()              StatRegistry::reset()
+#else
+#define STAT_INC(x)
+#define STAT_REGISTER(g, n, p)
+#define STAT_PRINT()
+#define STAT_RESET()
+#endif
+
+class StatRegistry {
+    private:
+        static char  **groups;
+        static const char **names;
+        static ulong **counters;
+        static int     nstats;
+        static int     maxstats;
+
+    public:
+        static void add(const char *group, const char *name, ulong *counter);
+        static void print();
+        static void reset();
+        static void checkpoint(Checkpoint *ck);
+};
+
+#endif
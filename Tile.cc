@@ -13,21 +13,31 @@
 #include "BitVector.h"
 #include "Net.h"
 #include "params.h"
+#include "Event.h"
+#include "IntervalStats.h"
+#include "Histogram.h"
+#include "Profile.h"
+#include "Checkpoint.h"
 
 
 // Global NETWORK is defined in simulator.cc
 extern Net *NETWORK;
 
-// Global delay counter for the current outstanding memory request.
-extern int CURRENTDELAY;
-extern int CURRENTMEMDELAY;
+// Global event queue is defined in simulator.cc
+extern thread_local EventQueue *EVENTQ;
 
+// Names of the transfer classes (indexed by XFERNONE, XFERLOC, ...)
+const char *XFERNAMES[] = { "L1 hit", "local L2", "cache to cache",
+                            "part to part", "memory" };
+
+// Ratio that is 0 rather than nan when nothing was counted
+static float ratio(ulong a, ulong b) {
+    return b ? (float)a / (float)b : 0.0;
+}
 
 Tile::Tile(int number, int partspertile, int partition) {
 
     index  = number;
-    xindex = index / SQRTNPROCS;  
-    yindex = index % SQRTNPROCS;  
     cycle    = 0;      // Keep count of cycles (measure of performance)
     locxfer  = 0;      // How many times did we get data from our own L2?
     locdelay = 0;      // Delay for local xfers. Should be same for each access.
@@ -41,6 +51,10 @@ Tile::Tile(int number, int partspertile, int partition) {
     memcycles = 0;     // Keep up with cycles spent waiting for mem access
     memhopscycles = 0; // Keep up with hop cycles when memory is accessed
     flushcycles = 0;   // # cycles taken to flush out caches
+    cyclebase = 0;     // Clock when the counters were reset (see resetStats())
+
+    for (int i=0; i < NXFERS; i++)
+        latency[i] = new Histogram();
 
     l1cache = new Cache(this, L1, L1SIZE, L1ASSOC, BLKSIZE);
     assert(l1cache);
@@ -51,12 +65,17 @@ Tile::Tile(int number, int partspertile, int partition) {
     partscheme = partspertile;
 
     part = new BitVector(partition);
+
+    port = new Port();
 }
 
 Tile::~Tile() {
     delete l1cache;
     delete l2cache;
     delete part;
+    delete port;
+    for (int i=0; i < NXFERS; i++)
+        delete latency[i];
 }
 
 /*
@@ -64,22 +83,30 @@ Tile::~Tile() {
  *     - Flush the dirty blocks from the L1 and L2 caches
  */
 void Tile::FlushDirtyBlocks() {
-    int state;
+    PROF_SCOPE(PHASEFLUSH);
+
+    // With the zeroload network sending the blocks one after the
+    // other stands in for the limited bandwidth. The contention model
+    // has the bandwidth itself so send them all at once.
+    int parallel = (NETWORK->model == NETCONTEND);
 
-    // Reset global CURRENTDELAY counter 
-    CURRENTDELAY = 0;
-    CURRENTMEMDELAY = 0;
+    // Start a new request
+    EVENTQ->begin(cycle);
+    if (parallel)
+        EVENTQ->fork();
 
     // L1: Flush blocks
-    l1cache->FlushDirtyBlocks();
+    l1cache->FlushDirtyBlocks(parallel);
 
     // L2: Flush blocks
-    l2cache->FlushDirtyBlocks();
+    l2cache->FlushDirtyBlocks(parallel);
 
-    // All accesses are done so add the accumulated delay
-    // to the cycle counter.
-    flushcycles += CURRENTDELAY;
-    flushcycles += CURRENTMEMDELAY;
+    if (parallel)
+        EVENTQ->join();
+
+    // Run the events to find out how long it took and
+    // add it to the flush cycle counter.
+    flushcycles += EVENTQ->run();
 }
 
 /*
@@ -89,13 +116,15 @@ void Tile::FlushDirtyBlocks() {
  */
 void Tile::Access(ulong addr, uchar op) {
     int state;
+    int xfer = XFERNONE;
+    ulong total;
+    PROF_SCOPE(PHASEL1);
 
     // Bump accesses counter
     accesses++;
 
-    // Reset global CURRENTDELAY counter 
-    CURRENTDELAY = 0;
-    CURRENTMEMDELAY = 0;
+    // Start a new request at the current cycle
+    EVENTQ->begin(cycle);
 
     // L1: Check L1 to see if hit
     state = l1cache->Access(addr, op);
@@ -103,25 +132,129 @@ void Tile::Access(ulong addr, uchar op) {
     // If a hit then we are done (almost). Must make any write
     // hits in the L1 access the L2 as well (WRITETHROUGH).
     if (state == HIT && op == 'w')
-        L2Retrieve(addr, op); // Aggregate L2 access
+        xfer = L2Retrieve(addr, op); // Aggregate L2 access
 
     // L2: If the L1 Missed then access the aggregate L2
     if (state == MISS)
-        L2Retrieve(addr, op);
+        xfer = L2Retrieve(addr, op);
+
+    // All accesses are done. Run the events to find out how
+    // long they took and add that to the cycle counter.
+    total = EVENTQ->run();
+    account(xfer, total - EVENTQ->memtime, EVENTQ->memtime);
+    cycle += total;
+}
 
-    // All accesses are done so add the accumulated delay
-    // to the cycle counter.
-    cycle += CURRENTDELAY;
-    cycle += CURRENTMEMDELAY;
+/*
+ * Tile::Warm()
+ *     - Do an access functionally (EVENTQ->functional must be set).
+ *       The caches, CCSMs and directory change state as they would
+ *       for Access() but no time is simulated. The cycle counter is
+ *       moved on by the average latency of accesses that got their
+ *       data from the same place (so far) so the tiles of a
+ *       multi-threaded trace stay in step.
+ */
+void Tile::Warm(ulong addr, uchar op) {
+    int state;
+    int xfer = XFERNONE;
+    PROF_SCOPE(PHASEL1);
+
+    // Latency to use until an access of the class has been timed
+    static const ulong nominal[NXFERS] = { L1ATIME, L2ATIME, L2ATIME,
+                                           L2ATIME, MEMATIME };
+
+    assert(EVENTQ->functional);
+    accesses++;
+
+    state = l1cache->Access(addr, op);
+    if (state == MISS || op == 'w')
+        xfer = L2Retrieve(addr, op);
+
+    if (latency[xfer]->count)
+        cycle += (ulong)(latency[xfer]->mean() + 0.5);
+    else
+        cycle += nominal[xfer];
+}
+
+/*
+ * Tile::Skip()
+ *     - Let an access go by without simulating it at all. The cycle
+ *       counter is moved on by the average access time so far so the
+ *       tiles of a multi-threaded trace stay in step.
+ */
+void Tile::Skip() {
+    cycle += accesses ? (cycles() + accesses / 2) / accesses : L1ATIME;
+}
+
+/*
+ * Tile::isLocal()
+ *     - Can an access to addr be done without sending any messages
+ *       outside of this tile? True for L1 read hits and for L2 hits
+ *       that don't need to ask the directory for permission.
+ */
+int Tile::isLocal(ulong addr, uchar op) {
+    CacheLine * line;
+    int state;
+
+    if (op != 'w' && l1cache->findLine(addr))
+        return 1;
+
+    line = l2cache->findLine(addr);
+    if (!line)
+        return 0;
+
+    if (op != 'w')
+        return 1;
+
+    state = line->ccsm->state;
+    return (state == STATEM || state == STATEE);
+}
+
+/*
+ * Tile::account()
+ *     - Update the transfer counters once we know how long an
+ *       access took. delay is the time spent outside of memory.
+ */
+void Tile::account(int xfer, ulong delay, ulong memdelay) {
+
+    assert(xfer >= 0 && xfer < NXFERS);
+    latency[xfer]->record(delay + memdelay);
+
+    switch (xfer) {
+        case XFERNONE:
+            break;
+        case XFERLOC:
+            locxfer++;
+            locdelay += delay;
+            break;
+        case XFERCTOC:
+            ctocxfer++;
+            ctocdelay += delay;
+            break;
+        case XFERPTOP:
+            ptopxfer++;
+            ptopdelay += delay;
+            break;
+        case XFERMEM:
+            memxfer++;
+            memcycles     += memdelay;
+            memhopscycles += (memdelay + delay);
+            break;
+        default:
+            assert(0); // Should not get here
+    }
 }
 
 /*
  * Tile::L2Retrieve()
+ *
+ * Returns where the data came from (XFERLOC, XFERCTOC, ..)
  */
-void Tile::L2Retrieve(ulong addr, uchar op) {
+int Tile::L2Retrieve(ulong addr, uchar op) {
 
     CacheLine * line;
     int state;
+    PROF_SCOPE(PHASEL2);
 
     // Bump accesses counter
     l2accesses++;
@@ -133,9 +266,7 @@ void Tile::L2Retrieve(ulong addr, uchar op) {
     if (line) {
         state = l2cache->Access(addr, op);
         assert(state == HIT);
-        locxfer++;
-        locdelay += CURRENTDELAY;
-        return;
+        return XFERLOC;
     }
 
     // Check the other cache in the partition if there is one. 
@@ -152,9 +283,7 @@ void Tile::L2Retrieve(ulong addr, uchar op) {
         } else {
             line->ccsm->procInitRd(addr);
         }
-        ctocxfer++;
-        ctocdelay += CURRENTDELAY;
-        return;
+        return XFERCTOC;
     }
 
     // If we are here then the line is not in the local or neighbor
@@ -162,10 +291,14 @@ void Tile::L2Retrieve(ulong addr, uchar op) {
     // take care of this for us. 
     state = l2cache->Access(addr, op);
     assert(state == MISS);
-    memxfer++;
-    memcycles     += CURRENTMEMDELAY;
-    memhopscycles += (CURRENTMEMDELAY + CURRENTDELAY);
-    return;
+
+    // If the directory had the data supplied by a tile in another
+    // partition (partition sharing or a MOESI/MESIF owner) then
+    // memory was never accessed.
+    if (EVENTQ->memaccess == 0)
+        return XFERPTOP;
+
+    return XFERMEM;
 }
 
 /*
@@ -174,8 +307,10 @@ void Tile::L2Retrieve(ulong addr, uchar op) {
  *       aggregate L2 (logically shared) for a partition. If HIT,
  *       then L2 returns quickly. If MISS, the L2 will contact the
  *       Memory controller (directory) and retrieve the value.
+ *
+ * Returns where the data came from (XFERLOC, XFERCTOC, ..)
  */
-void Tile::L2Access(ulong addr, uchar op) {
+int Tile::L2Access(ulong addr, uchar op) {
 
     int tileid = mapAddrToTile(addr);
     int msg    = (op == 'w') ? L2WR : L2RD;
@@ -184,29 +319,13 @@ void Tile::L2Access(ulong addr, uchar op) {
     // Bump accesses counter
     l2accesses++;
 
-    // If it was a hit and it was a remote cache then bump counter
-    if (state == HIT) {
-        if (tileid == index) {
-            locxfer++;
-            locdelay += CURRENTDELAY;
-        } else {
-            ctocxfer++;
-            ctocdelay += CURRENTDELAY;
-        }
-    }
+    // If it was a hit was it our cache or a remote one?
+    if (state == HIT)
+        return (tileid == index) ? XFERLOC : XFERCTOC;
 
     // If it was a miss then we accessed memory or a remote
     // partition
-    if (state == MISS) {
-        if (CURRENTMEMDELAY != 0) {
-            memxfer++;
-            memcycles     += CURRENTMEMDELAY;
-            memhopscycles += (CURRENTMEMDELAY + CURRENTDELAY);
-        } else {
-            ptopxfer++;
-            ptopdelay += CURRENTDELAY;
-        }
-    }
+    return EVENTQ->memaccess ? XFERMEM : XFERPTOP;
 }
 
 /*
@@ -239,22 +358,131 @@ int Tile::mapAddrToTile(ulong addr) {
  */
 void Tile::PrintStats() {
     printf("========================================================== (Tile %d)\n", index);
-    printf("01. cycle completed:                            %lu\n",  cycle);
+    printf("01. cycle completed:                            %lu\n",  cycles());
     printf("02. cache to cache xfer (within partition)      %lu\n",  ctocxfer);
     printf("03. memory xfer (does not include writebacks)   %lu\n",  memxfer);
     printf("04. part to part xfer  (outside partition)      %lu\n",  ptopxfer);
     printf("05. number of accesses                          %lu\n",  accesses);
     printf("06. memory cycles                               %lu\n",  memcycles);
-    printf("07. average total access time (cycles)          %f\n" ,  ((float)cycle / (float)accesses));
-    printf("08. average interconnect hop cycles             %f\n" ,  ((float)(cycle - memcycles) / (float)accesses));
-    printf("09. average mem access cycles (excludes hops)   %f\n" ,  ((float)memcycles / (float)accesses));
-    printf("10. average mem access cycles (includes hops)   %f\n" ,  ((float)(memcycles + memhopscycles)  / (float)accesses));
+    printf("07. average total access time (cycles)          %f\n" ,  ratio(cycles(), accesses));
+    printf("08. average interconnect hop cycles             %f\n" ,  ratio(cycles() - memcycles, accesses));
+    printf("09. average mem access cycles (excludes hops)   %f\n" ,  ratio(memcycles, accesses));
+    printf("10. average mem access cycles (includes hops)   %f\n" ,  ratio(memcycles + memhopscycles, accesses));
+    printf("11. access latency (cycles)        count      mean    p50    p90    p99    max\n");
+    for (int i=0; i < NXFERS; i++) {
+        Histogram *h = latency[i];
+        printf("    %-20s %12lu %9.1f %6lu %6lu %6lu %6lu\n", XFERNAMES[i], h->count,
+            h->mean(), h->percentile(50), h->percentile(90), h->percentile(99), h->max);
+    }
     printf("===== Simulation results (Cache %d L1) =============\n", index);
     l1cache->PrintStats();
     printf("===== Simulation results (Cache %d L2) =============\n", index);
     l2cache->PrintStats();
 }
 
+/*
+ * Tile::Snapshot()
+ *     - Copy the running counters into s (see IntervalStats.h).
+ */
+void Tile::Snapshot(TileSnap *s) {
+    s->tile        = index;
+    s->cycle       = cycles();
+    s->accesses    = accesses;
+    s->locxfer     = locxfer;
+    s->ctocxfer    = ctocxfer;
+    s->ptopxfer    = ptopxfer;
+    s->memxfer     = memxfer;
+    s->l1misses    = l1cache->getRM() + l1cache->getWM();
+    s->l2misses    = l2cache->getRM() + l2cache->getWM();
+    s->l1wbacks    = l1cache->getWB();
+    s->l2wbacks    = l2cache->getWB();
+    s->flushcycles = flushcycles;
+}
+
+/*
+ * Tile::resetStats()
+ *     - Zero the counters. The caches keep their contents and the
+ *       clock keeps running (cycles() counts from here).
+ */
+void Tile::resetStats() {
+    cyclebase     = cycle;
+    locxfer       = 0;
+    locdelay      = 0;
+    ctocxfer      = 0;
+    ctocdelay     = 0;
+    memxfer       = 0;
+    ptopxfer      = 0;
+    ptopdelay     = 0;
+    accesses      = 0;
+    l2accesses    = 0;
+    memcycles     = 0;
+    memhopscycles = 0;
+    flushcycles   = 0;
+    for (int i=0; i < NXFERS; i++)
+        latency[i]->reset();
+    l1cache->resetStats();
+    l2cache->resetStats();
+}
+
+/*
+ * Tile::checkpoint()
+ *     - Save or restore the clock, counters, partition and caches.
+ */
+void Tile::checkpoint(Checkpoint *ck) {
+    int i, v;
+
+    ck->section(CKSECTION('T', 'i', 'l', 'e'));
+    CKIO(ck, cycle);
+    CKIO(ck, cyclebase);
+    CKIO(ck, locxfer);
+    CKIO(ck, locdelay);
+    CKIO(ck, ctocxfer);
+    CKIO(ck, ctocdelay);
+    CKIO(ck, memxfer);
+    CKIO(ck, ptopxfer);
+    CKIO(ck, ptopdelay);
+    CKIO(ck, accesses);
+    CKIO(ck, l2accesses);
+    CKIO(ck, memcycles);
+    CKIO(ck, memhopscycles);
+    CKIO(ck, flushcycles);
+    for (i=0; i < NXFERS; i++)
+        ck->io(latency[i], sizeof(Histogram));
+
+    v = part->getVector();
+    CKIO(ck, v);
+    part->setVector(v);
+
+    l1cache->checkpoint(ck);
+    l2cache->checkpoint(ck);
+}
+
+/*
+ * Tile::addStats()
+ *     - Add the counters of t (times times) to this tile's. Used to
+ *       build up whole-run counters from the parts of a trace that
+ *       were simulated.
+ */
+void Tile::addStats(Tile *t, double times) {
+    cycle         += (ulong)(t->cycles() * times + 0.5);
+    locxfer       += (ulong)(t->locxfer * times + 0.5);
+    locdelay      += (ulong)(t->locdelay * times + 0.5);
+    ctocxfer      += (ulong)(t->ctocxfer * times + 0.5);
+    ctocdelay     += (ulong)(t->ctocdelay * times + 0.5);
+    memxfer       += (ulong)(t->memxfer * times + 0.5);
+    ptopxfer      += (ulong)(t->ptopxfer * times + 0.5);
+    ptopdelay     += (ulong)(t->ptopdelay * times + 0.5);
+    accesses      += (ulong)(t->accesses * times + 0.5);
+    l2accesses    += (ulong)(t->l2accesses * times + 0.5);
+    memcycles     += (ulong)(t->memcycles * times + 0.5);
+    memhopscycles += (ulong)(t->memhopscycles * times + 0.5);
+    flushcycles   += (ulong)(t->flushcycles * times + 0.5);
+    for (int i=0; i < NXFERS; i++)
+        latency[i]->add(t->latency[i], times);
+    l1cache->addStats(t->l1cache, times);
+    l2cache->addStats(t->l2cache, times);
+}
+
 /*
  * Tile::PrintStatsTabular()
  *     - Print a header and then query the L1 and L2 to print
@@ -279,7 +507,7 @@ void Tile::PrintStatsTabular(int printhead) {
 
     sprintf(buftemp, "%15s", "cycle");
     strcat(bufhead, buftemp);
-    sprintf(buftemp, "%15lu", cycle);
+    sprintf(buftemp, "%15lu", cycles());
     strcat(bufbody, buftemp);
 
     sprintf(buftemp, "%15s", "flushcycles");
@@ -324,7 +552,7 @@ void Tile::PrintStatsTabular(int printhead) {
 
     sprintf(buftemp, "%15s", "locAAT");
     strcat(bufhead, buftemp);
-    sprintf(buftemp, "%15f", ((float)locdelay / (float)locxfer));
+    sprintf(buftemp, "%15f", ratio(locdelay, locxfer));
     strcat(bufbody, buftemp);
 
 ////sprintf(buftemp, "%15s", "ctocdelay");
@@ -334,7 +562,7 @@ void Tile::PrintStatsTabular(int printhead) {
 
     sprintf(buftemp, "%15s", "ctocAAT");
     strcat(bufhead, buftemp);
-    sprintf(buftemp, "%15f", ((float)ctocdelay / (float)ctocxfer));
+    sprintf(buftemp, "%15f", ratio(ctocdelay, ctocxfer));
     strcat(bufbody, buftemp);
 
 ////sprintf(buftemp, "%15s", "ptopdelay");
@@ -344,17 +572,17 @@ void Tile::PrintStatsTabular(int printhead) {
 
     sprintf(buftemp, "%15s", "ptopAAT");
     strcat(bufhead, buftemp);
-    sprintf(buftemp, "%15f", ((float)ptopdelay / (float)ptopxfer));
+    sprintf(buftemp, "%15f", ratio(ptopdelay, ptopxfer));
     strcat(bufbody, buftemp);
 
     sprintf(buftemp, "%15s", "memAAT");
     strcat(bufhead, buftemp);
-    sprintf(buftemp, "%15f", ((float)(memcycles + memhopscycles) / (float)memxfer));
+    sprintf(buftemp, "%15f", ratio(memcycles + memhopscycles, memxfer));
     strcat(bufbody, buftemp);
 
     sprintf(buftemp, "%15s", "totalAAT");
     strcat(bufhead, buftemp);
-    sprintf(buftemp, "%15f", ((float)cycle / (float)accesses));
+    sprintf(buftemp, "%15f", ratio(cycles(), accesses));
     strcat(bufbody, buftemp);
 
     sprintf(buftemp, "%15s", "memcycles");
@@ -364,19 +592,33 @@ void Tile::PrintStatsTabular(int printhead) {
 
     sprintf(buftemp, "%15s", "ahopcycles");
     strcat(bufhead, buftemp);
-    sprintf(buftemp, "%15f", ((float)(cycle - memcycles) / (float)accesses));
+    sprintf(buftemp, "%15f", ratio(cycles() - memcycles, accesses));
     strcat(bufbody, buftemp);
 
     sprintf(buftemp, "%15s", "amemnohops");
     strcat(bufhead, buftemp);
-    sprintf(buftemp, "%15f", ((float)memcycles / (float)accesses));
+    sprintf(buftemp, "%15f", ratio(memcycles, accesses));
     strcat(bufbody, buftemp);
 
     sprintf(buftemp, "%15s", "amemwithhops");
     strcat(bufhead, buftemp);
-    sprintf(buftemp, "%15f", ((float)(memcycles + memhopscycles)  / (float)accesses));
+    sprintf(buftemp, "%15f", ratio(memcycles + memhopscycles, accesses));
     strcat(bufbody, buftemp);
 
+    // Tail latency of each class that goes past the L1
+    const char *cls[NXFERS] = { NULL, "loc", "ctoc", "ptop", "mem" };
+    for (int i=XFERLOC; i < NXFERS; i++) {
+        sprintf(buftemp, "%12sP99", cls[i]);
+        strcat(bufhead, buftemp);
+        sprintf(buftemp, "%15lu", latency[i]->percentile(99));
+        strcat(bufbody, buftemp);
+
+        sprintf(buftemp, "%12sMax", cls[i]);
+        strcat(bufhead, buftemp);
+        sprintf(buftemp, "%15lu", latency[i]->max);
+        strcat(bufbody, buftemp);
+    }
+
     if (printhead) {
         // Print the head
         printf("%s", bufhead);
@@ -411,7 +653,7 @@ int Tile::getFromNetwork(ulong msg, ulong addr, ulong fromtile) {
     // Handle L1 messages first
     if (msg == L1INV) {
         l1cache->invalidateLineIfExists(addr);
-        CURRENTDELAY += L1ATIME;
+        EVENTQ->delay(L1ATIME);
         return -1;
     }
 
@@ -421,10 +663,11 @@ int Tile::getFromNetwork(ulong msg, ulong addr, ulong fromtile) {
 
         case INV:
         case INT:
+        case BINV:
 
             // Get the L2 cache line that corresponds to addr
             line = l2cache->findLine(addr);
-            CURRENTDELAY += L2ATIME;
+            EVENTQ->delay(L2ATIME);
 
             // If it is not in this cache and this is a request from
             // the directory (not a forwarded request from another
@@ -436,16 +679,16 @@ int Tile::getFromNetwork(ulong msg, ulong addr, ulong fromtile) {
                     return -1;
             }
 
-            // Pass the message on to the CCSM
-            line->ccsm->getFromNetwork(msg);
-            return -1;
+            // Pass the message on to the CCSM. Return the state the
+            // line was in so the directory knows if we had the data.
+            return line->ccsm->getFromNetwork(msg);
 
         case XFER:
 
             // Check to see if it is in this cache. If so then
             // send data and invalidate in this cache.
             line = l2cache->findLine(addr);
-            CURRENTDELAY += L2ATIME;
+            EVENTQ->delay(L2ATIME);
 
             if (!line) {
                 return STATEI;
@@ -472,24 +715,17 @@ int Tile::getFromNetwork(ulong msg, ulong addr, ulong fromtile) {
 void Tile::broadcastToPartition(ulong msg, ulong addr) {
 
     int i;
-    int max = 0;
-
-    // Lets play a game with CURRENTDELAY. Since this stuff is
-    // done in parallel we will save off the original value and
-    // then find the max delay of all parallel requests. 
-    ulong origDelay = CURRENTDELAY;
-    CURRENTDELAY  = 0;
-
-    for(i=0; i < part->size; i++) {
-        if (part->getBit(i)) {
-            NETWORK->sendReqTileToTile(msg, addr, index, i);
-            max = MAX(max, CURRENTDELAY);
-            CURRENTDELAY = 0; // Reset for next iter
-        }
+
+    // The messages are sent out in parallel. Each is its own
+    // branch and we have to wait for all of them to finish.
+    EVENTQ->fork();
+
+    for(i = part->getNextSetBit(0); i != -1; i = part->getNextSetBit(i+1)) {
+        EVENTQ->branch();
+        NETWORK->sendReqTileToTile(msg, addr, index, i);
     }
 
-    // Add the max to the original delay
-    CURRENTDELAY = origDelay + max;
+    EVENTQ->join();
 }
 
 /*
@@ -503,8 +739,8 @@ int Tile::sendToNeighbor(ulong msg, ulong addr) {
     if (num < 2) 
         return -1;
 
-    for(i=0; i < part->size; i++)
-        if (part->getBit(i) && i != index)
+    for(i = part->getNextSetBit(0); i != -1; i = part->getNextSetBit(i+1))
+        if (i != index)
             return NETWORK->sendReqTileToTile(msg, addr, index, i);
 
     assert(0); // Should not get here
@@ -9,6 +9,23 @@
 
 class Cache;     // Forward Declaration
 class BitVector; // Forward Declaration
+class Port;      // Forward Declaration
+class TileSnap;  // Forward Declaration
+class Histogram; // Forward Declaration
+class Checkpoint; // Forward Declaration
+
+// Where the data for an access came from
+enum {
+    XFERNONE = 0, // L1 hit
+    XFERLOC,      // Local L2
+    XFERCTOC,     // Remote L2 in this partition
+    XFERPTOP,     // Remote L2 in another partition
+    XFERMEM,      // Memory
+    NXFERS,
+};
+
+// Names of the transfer classes (indexed by XFERNONE, XFERLOC, ...)
+extern const char *XFERNAMES[];
 
 
 class Tile {
@@ -20,10 +37,9 @@ protected:
    
 public:
     BitVector * part;
+    Port * port;
     unsigned int index;
     unsigned int partscheme;
-    unsigned int xindex;
-    unsigned int yindex;
     unsigned int cycle;
     unsigned int locxfer;
     unsigned int locdelay;
@@ -37,20 +53,39 @@ public:
     unsigned int memcycles;
     unsigned int memhopscycles;
     unsigned int flushcycles;
+    unsigned int cyclebase;  // cycle when the counters were last reset
+
+    // Latency of each access (all of it, hops and memory) by where
+    // the data came from
+    Histogram * latency[NXFERS];
 
     Tile(int number, int partspertile, int partition);
     ~Tile();
     void FlushDirtyBlocks();
     void Access(ulong addr, uchar op);
-    void L2Access(ulong addr, uchar op);
-    void L2Retrieve(ulong addr, uchar op);
+    void Warm(ulong addr, uchar op);
+    void Skip();
+    int  L2Access(ulong addr, uchar op);
+    int  L2Retrieve(ulong addr, uchar op);
+    void account(int xfer, ulong delay, ulong memdelay);
+    int  isLocal(ulong addr, uchar op);
     void PrintStats();
     void PrintStatsTabular(int printhead);
+    void Snapshot(TileSnap *s);
+    void resetStats();
+    void addStats(Tile *t, double times);
+    void checkpoint(Checkpoint *ck);
+
+    // Cycles since the counters were last reset. cycle itself is
+    // the tile's clock and never goes back.
+    ulong cycles() { return cycle - cyclebase; }
 
     void broadcastToPartition(ulong msg, ulong addr);
     int sendToNeighbor(ulong msg, ulong addr);
     int getFromNetwork(ulong msg, ulong addr, ulong fromtile);
     int mapAddrToTile(ulong addr);
+
+    Cache * getL2() { return l2cache; }
 };
 
 #endif
@@ -0,0 +1,339 @@
+/*
+ * Dusty Mabe - 2014
+ * Topology.cc - Implementation of the interconnect topologies.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "Topology.h"
+
+// Names of the topologies (indexed by TOPOMESH, TOPOTORUS, ...)
+const char *TOPONAMES[] = { "mesh", "torus", "ring", "cmesh", "fbfly" };
+
+/*
+ * Topology::create
+ *     - Create a new topology of the kind requested.
+ */
+Topology * Topology::create(int kind) {
+    switch (kind) {
+        case TOPOMESH:  return new MeshTopology();
+        case TOPOTORUS: return new TorusTopology();
+        case TOPORING:  return new RingTopology();
+        case TOPOCMESH: return new CMeshTopology();
+        case TOPOFBFLY: return new FBflyTopology();
+        default:
+            assert(0); // Should not get here
+    }
+    return NULL;
+}
+
+/*
+ * Topology constructor
+ *     - Set up a topology with the given # of routers. By default
+ *       tile i is attached to router i. The subclass adds the links
+ *       and then calls build().
+ */
+Topology::Topology(int k, int routers) {
+    int i;
+
+    kind     = k;
+    nrouters = routers;
+    nlinks   = 0;
+    maxlinks = routers*routers + 2*NDIRS;
+    linkfrom = new int[maxlinks];
+    linkto   = new int[maxlinks];
+    gridsize = 0;
+    wrap     = 0;
+    hoptable = NULL;
+    paths    = NULL;
+
+    for (i=0; i < NPROCS; i++)
+        eprouter[i] = i;
+}
+
+Topology::~Topology() {
+    int i;
+
+    for (i=0; i < NENDPOINTS*NENDPOINTS; i++)
+        delete[] paths[i];
+    delete[] paths;
+    delete[] hoptable;
+    delete[] linkfrom;
+    delete[] linkto;
+}
+
+/*
+ * Topology::addLink
+ *     - Add a link from one router (or controller) to another.
+ */
+int Topology::addLink(int from, int to) {
+    assert(nlinks < maxlinks);
+    linkfrom[nlinks] = from;
+    linkto[nlinks]   = to;
+    return nlinks++;
+}
+
+/*
+ * Topology::findLink
+ *     - Find the link from one router (or controller) to another.
+ *       This is only used at startup so a linear search is fine.
+ *
+ * Returns the link or -1 if there isn't one.
+ */
+int Topology::findLink(int from, int to) {
+    int i;
+    for (i=0; i < nlinks; i++)
+        if (linkfrom[i] == from && linkto[i] == to)
+            return i;
+    return -1;
+}
+
+/*
+ * Topology::addGridLinks
+ *     - Link each router of a grid to its neighbors (wrapping around
+ *       the edges for a torus).
+ */
+void Topology::addGridLinks() {
+    int r, d;
+
+    // gridLink() adds the links as it goes until build() is called
+    for (r=0; r < nrouters; r++)
+        for (d=0; d < NLINKDIRS; d++)
+            gridLink(r / gridsize, r % gridsize, d);
+}
+
+/*
+ * Topology::gridLink
+ *     - Get the link leaving grid router (x,y) in direction d. While
+ *       the links are being added (before build()) the link is created
+ *       if it isn't there yet.
+ *
+ * Returns the link, -1 if there is no grid and -2 if the link
+ * would leave the grid.
+ */
+int Topology::gridLink(int x, int y, int d) {
+    int l;
+    int x1 = x + (d == XPLUS) - (d == XMINUS);
+    int y1 = y + (d == YPLUS) - (d == YMINUS);
+
+    if (!gridsize)
+        return -1;
+
+    if (wrap) {
+        x1 = (x1 + gridsize) % gridsize;
+        y1 = (y1 + gridsize) % gridsize;
+    } else if (x1 < 0 || x1 >= gridsize || y1 < 0 || y1 >= gridsize) {
+        return -2;
+    }
+
+    l = findLink(x*gridsize + y, x1*gridsize + y1);
+    if (l == -1 && !hoptable)
+        l = addLink(x*gridsize + y, x1*gridsize + y1);
+    return l;
+}
+
+/*
+ * Topology::gridRoute
+ *     - Route from grid router r0 to r1, X first and then Y. With wrap
+ *       around go the short way (up if both ways are as long).
+ *
+ * Returns the # of links written to path.
+ */
+int Topology::gridRoute(int r0, int r1, int *path) {
+    int g  = gridsize;
+    int x  = r0 / g, y  = r0 % g;
+    int x1 = r1 / g, y1 = r1 % g;
+    int n  = 0;
+    int d;
+
+    while (x != x1) {
+        if (wrap)
+            d = ((x1 - x + g) % g <= (x - x1 + g) % g) ? XPLUS : XMINUS;
+        else
+            d = (x1 > x) ? XPLUS : XMINUS;
+        path[n++] = gridLink(x, y, d);
+        x = (x + ((d == XPLUS) ? 1 : -1) + g) % g;
+    }
+    while (y != y1) {
+        if (wrap)
+            d = ((y1 - y + g) % g <= (y - y1 + g) % g) ? YPLUS : YMINUS;
+        else
+            d = (y1 > y) ? YPLUS : YMINUS;
+        path[n++] = gridLink(x, y, d);
+        y = (y + ((d == YPLUS) ? 1 : -1) + g) % g;
+    }
+
+    return n;
+}
+
+/*
+ * Topology::build
+ *     - Attach the memory controllers to the routers of the corner
+ *       tiles (0, SQRTNPROCS-1, NPROCS-SQRTNPROCS and NPROCS-1) and
+ *       then work out the route between every pair of endpoints.
+ */
+void Topology::build() {
+    int c, r, src, dst, n, i;
+    int corners[4] = { 0, SQRTNPROCS-1, NPROCS-SQRTNPROCS, NPROCS-1 };
+    int *buf = new int[maxlinks];
+
+    assert(NDIRS == 4);
+    for (c=0; c < NDIRS; c++) {
+        r = eprouter[corners[c]];
+        eprouter[NPROCS + c] = r;
+        addLink(-1-c, r);
+        addLink(r, -1-c);
+    }
+
+    hoptable = new int[NENDPOINTS*NENDPOINTS];
+    paths    = new int*[NENDPOINTS*NENDPOINTS];
+
+    for (src=0; src < NENDPOINTS; src++) {
+        for (dst=0; dst < NENDPOINTS; dst++) {
+            n = 0;
+            if (src != dst) {
+                if (src >= NPROCS)
+                    buf[n++] = findLink(-1-(src-NPROCS), eprouter[src]);
+                n += route(eprouter[src], eprouter[dst], buf + n);
+                if (dst >= NPROCS)
+                    buf[n++] = findLink(eprouter[dst], -1-(dst-NPROCS));
+            }
+
+            for (i=0; i < n; i++)
+                assert(buf[i] >= 0);
+
+            i = src*NENDPOINTS + dst;
+            hoptable[i] = n;
+            paths[i]    = new int[n];
+            memcpy(paths[i], buf, n * sizeof(int));
+        }
+    }
+
+    delete[] buf;
+}
+
+/*
+ * Topology::routerName
+ *     - Write a name for router r ("x,y" for a grid, "rN" otherwise)
+ *       or for a memory controller ("mcN") into buf.
+ */
+void Topology::routerName(int r, char *buf) {
+    if (r < 0)
+        sprintf(buf, "mc%d", -1-r);
+    else if (gridsize)
+        sprintf(buf, "%d,%d", r / gridsize, r % gridsize);
+    else
+        sprintf(buf, "r%d", r);
+}
+
+/*
+ * Topology::linkName
+ *     - Write a name for link l ("from->to") into buf.
+ */
+void Topology::linkName(int l, char *buf) {
+    char from[16], to[16];
+
+    routerName(linkfrom[l], from);
+    routerName(linkto[l],   to);
+    sprintf(buf, "%s->%s", from, to);
+}
+
+/*
+ * MeshTopology
+ */
+MeshTopology::MeshTopology() : Topology(TOPOMESH, NPROCS) {
+    gridsize = SQRTNPROCS;
+    addGridLinks();
+    build();
+}
+
+int MeshTopology::route(int r0, int r1, int *path) {
+    return gridRoute(r0, r1, path);
+}
+
+/*
+ * TorusTopology
+ */
+TorusTopology::TorusTopology() : Topology(TOPOTORUS, NPROCS) {
+    gridsize = SQRTNPROCS;
+    wrap     = 1;
+    addGridLinks();
+    build();
+}
+
+int TorusTopology::route(int r0, int r1, int *path) {
+    return gridRoute(r0, r1, path);
+}
+
+/*
+ * RingTopology
+ */
+RingTopology::RingTopology() : Topology(TOPORING, NPROCS) {
+    int r;
+
+    for (r=0; r < NPROCS; r++) {
+        addLink(r, (r + 1) % NPROCS);
+        addLink(r, (r + NPROCS - 1) % NPROCS);
+    }
+    build();
+}
+
+int RingTopology::route(int r0, int r1, int *path) {
+    int n = 0;
+    int step = ((r1 - r0 + NPROCS) % NPROCS <= (r0 - r1 + NPROCS) % NPROCS) ? 1 : NPROCS-1;
+
+    for (; r0 != r1; r0 = (r0 + step) % NPROCS)
+        path[n++] = findLink(r0, (r0 + step) % NPROCS);
+    return n;
+}
+
+/*
+ * CMeshTopology
+ */
+CMeshTopology::CMeshTopology() : Topology(TOPOCMESH, NPROCS/4) {
+    int i;
+
+    assert(SQRTNPROCS % 2 == 0);
+    gridsize = SQRTNPROCS / 2;
+    for (i=0; i < NPROCS; i++)
+        eprouter[i] = (i / SQRTNPROCS / 2) * gridsize + (i % SQRTNPROCS) / 2;
+    addGridLinks();
+    build();
+}
+
+int CMeshTopology::route(int r0, int r1, int *path) {
+    return gridRoute(r0, r1, path);
+}
+
+/*
+ * FBflyTopology
+ */
+FBflyTopology::FBflyTopology() : Topology(TOPOFBFLY, NPROCS) {
+    int r, i;
+    int x, y;
+
+    for (r=0; r < NPROCS; r++) {
+        x = r / SQRTNPROCS;
+        y = r % SQRTNPROCS;
+        for (i=0; i < SQRTNPROCS; i++) {
+            if (i != x)
+                addLink(r, i*SQRTNPROCS + y);
+            if (i != y)
+                addLink(r, x*SQRTNPROCS + i);
+        }
+    }
+    build();
+}
+
+int FBflyTopology::route(int r0, int r1, int *path) {
+    int n = 0;
+    int r = (r1 / SQRTNPROCS) * SQRTNPROCS + r0 % SQRTNPROCS; // Same row as r1
+
+    if (r != r0)
+        path[n++] = findLink(r0, r);
+    if (r != r1)
+        path[n++] = findLink(r, r1);
+    return n;
+}
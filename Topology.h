@@ -0,0 +1,158 @@
+/*
+ * Dusty Mabe - 2014
+ * Topology.h - Header file for the interconnect topologies. A topology
+ *              puts the tiles and memory controllers on routers, builds
+ *              the (directed) links between the routers and picks the
+ *              route each message takes. The route and # of hops for
+ *              every pair of endpoints is worked out once at startup so
+ *              sending a message only takes a table lookup.
+ *
+ *              - TOPOMESH  - 2D mesh, X then Y routing
+ *              - TOPOTORUS - 2D torus, X then Y going the short way
+ *                            around each dimension
+ *              - TOPORING  - bidirectional ring, the short way around
+ *              - TOPOCMESH - concentrated mesh, 2x2 tiles per router
+ *              - TOPOFBFLY - flattened butterfly, each router is linked
+ *                            to all others in its row and its column
+ *
+ *              Endpoints 0..NPROCS-1 are the tiles and the memory
+ *              controllers come after them. Each controller hangs off
+ *              the router of a corner tile over a link pair of its own.
+ *              Tile i sits in row i / SQRTNPROCS, column i % SQRTNPROCS.
+ */
+#ifndef TOPOLOGY_H
+#define TOPOLOGY_H
+
+#include "types.h"
+#include "params.h"
+
+// Topologies
+enum {
+    TOPOMESH = 0,
+    TOPOTORUS,
+    TOPORING,
+    TOPOCMESH,
+    TOPOFBFLY,
+};
+
+// Names of the topologies (indexed by TOPOMESH, TOPOTORUS, ...)
+extern const char *TOPONAMES[];
+
+// # of network endpoints (tiles then memory controllers)
+#define NENDPOINTS (NPROCS + NDIRS)
+
+// Directions out of a router in a 2D grid (x is the row, y the column)
+enum {
+    XPLUS = 0,
+    XMINUS,
+    YPLUS,
+    YMINUS,
+    NLINKDIRS,
+};
+
+class Topology {
+    protected:
+        int  nrouters;
+        int  nlinks;
+        int  maxlinks;
+        int *linkfrom; // Router at each end of a link. Memory
+        int *linkto;   // controller c is -1-c.
+
+        int eprouter[NENDPOINTS]; // Router each endpoint is attached to
+
+        // Routes for all (src, dst) pairs of endpoints. paths[i] holds
+        // hoptable[i] links where i = src*NENDPOINTS + dst.
+        int  *hoptable;
+        int **paths;
+
+        // Routers laid out in a gridsize x gridsize grid (0 if not a
+        // grid) and does the grid wrap around (torus)?
+        int gridsize;
+        int wrap;
+
+        int  addLink(int from, int to);
+        int  findLink(int from, int to);
+        void addGridLinks();
+        int  gridRoute(int r0, int r1, int *path);
+        void build();
+        void routerName(int r, char *buf);
+
+        // Write the links from router r0 to router r1 into path.
+        // Returns the # of links.
+        virtual int route(int r0, int r1, int *path) = 0;
+
+    public:
+        int kind; // TOPOMESH, TOPOTORUS, ...
+
+        Topology(int k, int routers);
+        virtual ~Topology();
+
+        static Topology * create(int kind);
+
+        int   numLinks()               { return nlinks; }
+        int   numRouters()             { return nrouters; }
+        int   gridSize()               { return gridsize; }
+        int   linkFrom(int l)          { return linkfrom[l]; }
+        int   linkTo(int l)            { return linkto[l]; }
+        int   hops(int src, int dst)   { return hoptable[src*NENDPOINTS + dst]; }
+        int * path(int src, int dst)   { return paths[src*NENDPOINTS + dst]; }
+        int   gridLink(int x, int y, int d);
+        void  linkName(int l, char *buf);
+};
+
+/*
+ * MeshTopology - 2D mesh with X then Y dimension order routing.
+ */
+class MeshTopology : public Topology {
+    protected:
+        int route(int r0, int r1, int *path);
+    public:
+        MeshTopology();
+};
+
+/*
+ * TorusTopology - 2D mesh with wrap around links. X then Y, going
+ *                 the short way around each ring (ties go up).
+ */
+class TorusTopology : public Topology {
+    protected:
+        int route(int r0, int r1, int *path);
+    public:
+        TorusTopology();
+};
+
+/*
+ * RingTopology - All tiles on one bidirectional ring in tile order.
+ */
+class RingTopology : public Topology {
+    protected:
+        int route(int r0, int r1, int *path);
+    public:
+        RingTopology();
+};
+
+/*
+ * CMeshTopology - Each router serves a 2x2 block of tiles and the
+ *                 routers form a mesh. Tiles on the same router talk
+ *                 through it without using any links.
+ */
+class CMeshTopology : public Topology {
+    protected:
+        int route(int r0, int r1, int *path);
+    public:
+        CMeshTopology();
+};
+
+/*
+ * FBflyTopology - 2D flattened butterfly. A router has a link to
+ *                 every other router in its row and its column so
+ *                 any route is at most one hop in each dimension.
+ */
+class FBflyTopology : public Topology {
+    protected:
+        int route(int r0, int r1, int *path);
+    public:
+        FBflyTopology();
+};
+
+#endif
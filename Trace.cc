@@ -0,0 +1,415 @@
+/*
+ * Dusty Mabe - 2014
+ * Trace.cc - Implementation of the multi-threaded trace reader.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "Trace.h"
+#include "Tile.h"
+#include "Workload.h"
+#include "Checkpoint.h"
+
+MTTrace::MTTrace(FILE *f, int *map, int nmap) {
+    fp   = f;
+    work = NULL;
+    init(map, nmap);
+}
+
+MTTrace::MTTrace(Workload *w, int *map, int nmap) {
+    fp   = NULL;
+    work = w;
+    init(map, nmap);
+}
+
+/*
+ * MTTrace::init
+ *     - Set up the (empty) queues.
+ */
+void MTTrace::init(int *map, int nmap) {
+    int i;
+
+    eof        = 0;
+    last       = -1;
+    threadmap  = map;
+    nthreadmap = nmap;
+    freerecs   = NULL;
+    records    = 0;
+    threads    = 0;
+
+    for (i=0; i < NPROCS; i++) {
+        head[i]     = NULL;
+        tail[i]     = NULL;
+        queued[i]   = 0;
+        freetile[i] = NULL;
+        active[i]   = 0;
+    }
+}
+
+MTTrace::~MTTrace() {
+    int i;
+    TraceRec *rec;
+
+    reclaim();
+    for (i=0; i < NPROCS; i++) {
+        while ((rec = head[i])) {
+            head[i] = rec->next;
+            delete rec;
+        }
+    }
+    while ((rec = freerecs)) {
+        freerecs = rec->next;
+        delete rec;
+    }
+}
+
+/*
+ * MTTrace::mapThreadToTile
+ *     - Find the tile that runs thread tid.
+ */
+int MTTrace::mapThreadToTile(int tid) {
+    if (tid < nthreadmap)
+        return threadmap[tid];
+    return tid % NPROCS;
+}
+
+/*
+ * skipSpace, skipToken
+ *     - Move past the blanks or past the characters of a field.
+ */
+static char * skipSpace(char *p) {
+    while (*p == ' ' || *p == '\t')
+        p++;
+    return p;
+}
+
+static char * skipToken(char *p) {
+    while (*p && *p != ' ' && *p != '\t' && *p != '\n')
+        p++;
+    return p;
+}
+
+/*
+ * parseRecord
+ *     - Split a line of a trace into the thread id (if hastid is
+ *       set), the operation and the address (hex, with or without
+ *       0x). This is what strtok() and strtoul() would do but it
+ *       runs for every record so it is done by hand.
+ *
+ * Returns 0 if a field is missing.
+ */
+int parseRecord(char *line, int hastid, int *tid, uchar *op, ulong *addr) {
+    char *p = skipSpace(line);
+    ulong a = 0;
+    int d;
+
+    if (hastid) {
+        if (!*p || *p == '\n')
+            return 0;
+        *tid = atoi(p);
+        p = skipSpace(skipToken(p));
+    }
+
+    // The operation
+    if (!*p || *p == '\n')
+        return 0;
+    *op = p[0];
+    p = skipSpace(skipToken(p));
+
+    // The address
+    if (!*p || *p == '\n')
+        return 0;
+    if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
+        p += 2;
+    for (;; p++) {
+        if (*p >= '0' && *p <= '9')
+            d = *p - '0';
+        else if (*p >= 'a' && *p <= 'f')
+            d = *p - 'a' + 10;
+        else if (*p >= 'A' && *p <= 'F')
+            d = *p - 'A' + 10;
+        else
+            break;
+        a = (a << 4) | d;
+    }
+    *addr = a;
+    return 1;
+}
+
+/*
+ * MTTrace::readRecord
+ *     - Read the next line of the trace and queue it up for the
+ *       tile that runs the thread (or take the next record from
+ *       the workload).
+ *
+ * Returns 0 at the end of the file.
+ */
+int MTTrace::readRecord() {
+    char buf[256];
+    int tid, tile, ok;
+    uchar op;
+    ulong addr;
+    TraceRec *rec;
+
+    if (work) {
+        if (!work->next(&tid, &op, &addr))
+            return 0;
+    } else {
+        if (!fgets(buf, 256, fp))
+            return 0;
+
+        // Thread id, operation and address
+        ok = parseRecord(buf, 1, &tid, &op, &addr);
+        assert(ok);
+        assert(tid >= 0);
+    }
+
+    rec = freerecs;
+    if (rec)
+        freerecs = rec->next;
+    else
+        rec = new TraceRec;
+    rec->op   = op;
+    rec->addr = addr;
+    rec->next = NULL;
+
+    // Queue it up for the tile
+    tile = mapThreadToTile(tid);
+    assert(tile < NPROCS);
+    if (head[tile])
+        tail[tile]->next = rec;
+    else
+        head[tile] = rec;
+    tail[tile] = rec;
+    last       = tile;
+
+    active[tile] = 1;
+    queued[tile]++;
+    records++;
+    if (tid >= threads)
+        threads = tid + 1;
+
+    return 1;
+}
+
+/*
+ * MTTrace::buffered
+ *     - Total records queued up across all tiles.
+ */
+ulong MTTrace::buffered() {
+    int i;
+    ulong total = 0;
+    for (i=0; i < NPROCS; i++)
+        total += queued[i];
+    return total;
+}
+
+/*
+ * MTTrace::next
+ *     - Pick the tile with the smallest cycle that has a record to
+ *       run and hand back that record. If a tile that is further
+ *       behind has run out of records then read ahead in the file
+ *       (up to TRACEWINDOW records) to see if it has more coming.
+ *
+ * Returns the tile to run the access on or -1 when the trace is done.
+ */
+int MTTrace::next(Tile **tiles, ulong *addr, uchar *op) {
+    int i, best, wait;
+    TraceRec *rec;
+
+    while (1) {
+
+        // Find the tile furthest behind that has a record
+        best = -1;
+        for (i=0; i < NPROCS; i++)
+            if (head[i] && (best == -1 || tiles[i]->cycle < tiles[best]->cycle))
+                best = i;
+
+        // Is there a tile even further behind waiting on records? Ties
+        // go to the lower tile (as they do with ParallelSim) so the
+        // order requests reach the network doesn't depend on the file.
+        wait = 0;
+        for (i=0; i < NPROCS; i++)
+            if (active[i] && !head[i] &&
+               (best == -1 || tiles[i]->cycle < tiles[best]->cycle ||
+               (tiles[i]->cycle == tiles[best]->cycle && i < best)))
+                wait = 1;
+
+        // Read more of the file if we need to (and are allowed to)
+        if ((best == -1 || wait) && !eof && buffered() < TRACEWINDOW) {
+            if (!readRecord())
+                eof = 1;
+            continue;
+        }
+
+        if (best == -1)
+            return -1;
+
+        // Hand back the record
+        rec        = head[best];
+        head[best] = rec->next;
+        *addr      = rec->addr;
+        *op        = rec->op;
+        queued[best]--;
+
+        rec->next = freerecs;
+        freerecs  = rec;
+        return best;
+    }
+}
+
+/*
+ * MTTrace::nextInOrder
+ *     - Hand back the next record in file order, whatever the cycles
+ *       of the tiles are. Only for functional warming where there is
+ *       no timing to keep in step, and only before next() has queued
+ *       anything up.
+ *
+ * Returns the tile to run the access on or -1 when the trace is done.
+ */
+int MTTrace::nextInOrder(ulong *addr, uchar *op) {
+    TraceRec *rec;
+
+    if (eof || !readRecord()) {
+        eof = 1;
+        return -1;
+    }
+
+    rec = head[last];
+    assert(rec == tail[last]);
+    head[last] = NULL;
+    *addr      = rec->addr;
+    *op        = rec->op;
+    queued[last]--;
+
+    rec->next = freerecs;
+    freerecs  = rec;
+    return last;
+}
+
+/*
+ * MTTrace::checkpoint
+ *     - Save or restore where we are in the trace and the records
+ *       read ahead but not yet simulated. The file picks up from its
+ *       saved offset. A workload is run forward past the records it
+ *       already handed out.
+ */
+void MTTrace::checkpoint(Checkpoint *ck) {
+    int i, tid;
+    uchar op;
+    ulong j, n, off, addr, *recs;
+    TraceRec *rec;
+
+    reclaim();
+    ck->section(CKSECTION('T','r','a','c'));
+    CKIO(ck, eof);
+    CKIO(ck, last);
+    CKIO(ck, records);
+    CKIO(ck, threads);
+    CKIO(ck, active);
+
+    off = fp ? ftell(fp) : 0;
+    CKIO(ck, off);
+    if (!ck->saving && fp && fseek(fp, off, SEEK_SET) != 0) {
+        printf("Trace file problem (can't seek to %lu)\n", off);
+        exit(1);
+    }
+    if (!ck->saving && work)
+        for (j=0; j < records; j++)
+            if (!work->next(&tid, &op, &addr))
+                break;
+
+    // Queued records, as (addr, op) pairs for each tile
+    for (i=0; i < NPROCS; i++) {
+        n = queued[i];
+        CKIO(ck, n);
+        recs = new ulong[2*n + 1];
+        for (j=0, rec=head[i]; ck->saving && rec; j += 2, rec = rec->next) {
+            recs[j]   = rec->addr;
+            recs[j+1] = rec->op;
+        }
+        ck->io(recs, 2*n*sizeof(ulong));
+        if (!ck->saving) {
+            assert(head[i] == NULL); // Restore into a new trace only
+            for (j=0; j < 2*n; j += 2) {
+                rec = new TraceRec;
+                rec->addr = recs[j];
+                rec->op   = recs[j+1];
+                rec->next = NULL;
+                if (head[i])
+                    tail[i]->next = rec;
+                else
+                    head[i] = rec;
+                tail[i] = rec;
+            }
+            queued[i] = n;
+        }
+        delete[] recs;
+    }
+}
+
+/*
+ * MTTrace::fill
+ *     - Read ahead until every tile that has been active has at
+ *       least need records queued (or we hit the end of the file
+ *       or TRACEWINDOW records).
+ *
+ * Returns the # of records queued across all tiles.
+ */
+int MTTrace::fill(ulong need) {
+    int i;
+    ulong total = buffered();
+
+    while (!eof && total < TRACEWINDOW) {
+
+        for (i=0; i < NPROCS; i++)
+            if (active[i] && queued[i] < need)
+                break;
+
+        // Has every tile got enough? Keep going if no tile has
+        // been seen yet though.
+        if (i == NPROCS && total > 0)
+            break;
+
+        if (!readRecord())
+            eof = 1;
+        else
+            total++;
+    }
+
+    return total;
+}
+
+/*
+ * MTTrace::pop
+ *     - Drop the record at the head of tile's queue. Only the thread
+ *       running tile may call this while the tiles run in parallel.
+ */
+void MTTrace::pop(int tile) {
+    TraceRec *rec = head[tile];
+
+    assert(rec);
+    head[tile] = rec->next;
+    queued[tile]--;
+
+    rec->next      = freetile[tile];
+    freetile[tile] = rec;
+}
+
+/*
+ * MTTrace::reclaim
+ *     - Move the records freed by each tile back on to the free list.
+ */
+void MTTrace::reclaim() {
+    int i;
+    TraceRec *rec;
+
+    for (i=0; i < NPROCS; i++) {
+        while ((rec = freetile[i])) {
+            freetile[i] = rec->next;
+            rec->next   = freerecs;
+            freerecs    = rec;
+        }
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * Dusty Mabe - 2014
+ * Trace.h - Header file for reading multi-threaded traces. Each line
+ *           of a multi-threaded trace is of the form:
+ *
+ *              threadid operation(r,w) address(hex)
+ *
+ *              0 r 0x7fc61248
+ *              3 w 0x7fc62c08
+ *
+ *           Each thread is mapped to a tile. Tiles run concurrently
+ *           with their own cycle counter and the next record is always
+ *           taken from the tile that is furthest behind (the smallest
+ *           cycle) so the tiles stay in step with a global clock.
+ *
+ *           The records can also come from a synthetic workload
+ *           (see Workload.h) instead of a file.
+ */
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdio.h>
+#include "types.h"
+#include "params.h"
+
+class Tile;     // Forward Declaration
+class Workload; // Forward Declaration
+class Checkpoint; // Forward Declaration
+
+class TraceRec {
+    public:
+        ulong     addr;
+        uchar     op;
+        TraceRec *next;
+};
+
+class MTTrace {
+    private:
+        FILE     *fp;
+        Workload *work; // Where the records come from if not fp
+        int       eof;
+
+        // Thread -> tile mapping. Threads past the end of the map
+        // are assigned round robin.
+        int  *threadmap;
+        int   nthreadmap;
+
+        // Records read from the file but not yet simulated, queued
+        // per tile (FIFO). Freed records go back on a free list. When
+        // tiles run in parallel each tile frees records onto its own
+        // list and they are handed back in reclaim().
+        TraceRec *head[NPROCS];
+        TraceRec *tail[NPROCS];
+        ulong     queued[NPROCS];
+        TraceRec *freetile[NPROCS];
+        TraceRec *freerecs;
+
+        int  active[NPROCS]; // Has the tile had any records yet?
+        int  last;           // Tile the last record read was queued for
+
+        void  init(int *map, int nmap);
+        int   readRecord();
+        ulong buffered();
+
+    public:
+        ulong records;  // Records read from the file
+        int   threads;  // Highest thread id seen + 1
+
+        MTTrace(FILE *f, int *map, int nmap);
+        MTTrace(Workload *w, int *map, int nmap);
+        ~MTTrace();
+        int mapThreadToTile(int tid);
+        int next(Tile **tiles, ulong *addr, uchar *op);
+        int nextInOrder(ulong *addr, uchar *op);
+        void checkpoint(Checkpoint *ck);
+
+        // Used when tiles run in parallel (see Parallel.h)
+        int  fill(ulong need);
+        TraceRec * peek(int tile) { return head[tile]; }
+        void pop(int tile);
+        void reclaim();
+};
+
+// Split a line of a trace into its fields (see Trace.cc)
+int parseRecord(char *line, int hastid, int *tid, uchar *op, ulong *addr);
+
+#endif
@@ -0,0 +1,55 @@
+/*
+ * Dusty Mabe - 2014
+ * TraceGen.cc - Write a synthetic workload (see Workload.h) out as a
+ *               trace file. Single threaded workloads are written in
+ *               the normal format and multi-threaded ones in the
+ *               format --mt reads:
+ *
+ *                  r 0x10000040            0 r 0x10000040
+ *
+ *               usage: ./tracegen <spec> [file]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "Workload.h"
+
+int main(int argc, char *argv[]) {
+    FILE *fp = stdout;
+    Workload *work;
+    WorkRec *buf;
+    int i, n;
+    char desc[256];
+
+    if (argc < 2 || argc > 3) {
+        printf("usage: ./tracegen <spec> [file]\n");
+        exit(1);
+    }
+    work = Workload::create(argv[1]);
+    if (argc == 3 && (fp = fopen(argv[2], "w")) == NULL) {
+        printf("Can't open %s\n", argv[2]);
+        exit(1);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    buf = new WorkRec[WORKBATCH];
+    while ((n = work->fill(buf, WORKBATCH))) {
+        for (i=0; i < n; i++) {
+            if (work->threads > 1)
+                fprintf(fp, "%d %c 0x%08lx\n", buf[i].tid, buf[i].op, buf[i].addr);
+            else
+                fprintf(fp, "%c 0x%08lx\n", buf[i].op, buf[i].addr);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    work->describe(desc);
+    double secs = std::chrono::duration<double>(end - start).count();
+    fprintf(stderr, "%s: %lu records in %.2fs\n", desc, work->records, secs);
+
+    if (fp != stdout)
+        fclose(fp);
+    delete[] buf;
+    delete work;
+    return 0;
+}
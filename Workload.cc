@@ -0,0 +1,385 @@
+/*
+ * Dusty Mabe - 2014
+ * Workload.cc - Implementation of the synthetic workload generators.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <assert.h>
+#include <math.h>
+#include "Workload.h"
+
+// Names of the kinds (indexed by WORKSTREAM, WORKRANDOM, ...)
+const char *WORKNAMES[] = {
+    "stream", "random", "zipf", "prodcons", "migratory", "falseshare"
+};
+
+// Odd multiplier (a prime) that scatters the Zipf ranks over the
+// footprint. It has no factors in common with any block count so
+// rank -> block is one to one.
+#define ZIPFSCATTER 2654435761UL
+
+/*
+ * parseSize
+ *     - Parse a number with an optional K, M or G suffix. unit is
+ *       1000 for counts and 1024 for sizes.
+ */
+static ulong parseSize(const char *s, ulong unit) {
+    char *end;
+    ulong v = strtoul(s, &end, 0);
+
+    switch (*end) {
+        case 'k': case 'K': return v * unit;
+        case 'm': case 'M': return v * unit * unit;
+        case 'g': case 'G': return v * unit * unit * unit;
+        case '\0':          return v;
+    }
+    printf("Bad number in workload spec: %s\n", s);
+    exit(1);
+}
+
+Workload::Workload(int k) {
+    kind      = k;
+    records   = 10000000;
+    footprint = (k == WORKFALSESHARE) ? 4096 : 16 << 20;
+    writepct  = 30;
+    seed      = 1;
+    threads   = (k >= WORKPRODCONS) ? NPROCS : 1;
+    stride    = BLKSIZE;
+    theta     = 0.99;
+    objblocks = 4;
+    batch     = NULL;
+    nbatch    = 0;
+    pos       = 0;
+}
+
+Workload::~Workload() {
+    delete[] batch;
+}
+
+/*
+ * Workload::create
+ *     - Create the workload described by spec (see Workload.h).
+ *       Prints a message and exits if spec doesn't make sense.
+ */
+Workload * Workload::create(const char *spec) {
+    char *copy = strdup(spec);
+    char *save;
+    char *tok, *val;
+    Workload *w;
+    int k;
+
+    tok = strtok_r(copy, ",", &save);
+    for (k=0; tok && k < NWORKKINDS; k++)
+        if (strcasecmp(tok, WORKNAMES[k]) == 0)
+            break;
+
+    switch (k) {
+        case WORKSTREAM:     w = new StreamWorkload();     break;
+        case WORKRANDOM:     w = new RandomWorkload();     break;
+        case WORKZIPF:       w = new ZipfWorkload();       break;
+        case WORKPRODCONS:   w = new ProdConsWorkload();   break;
+        case WORKMIGRATORY:  w = new MigratoryWorkload();  break;
+        case WORKFALSESHARE: w = new FalseShareWorkload(); break;
+        default:
+            printf("Unknown workload: %s\n", spec);
+            exit(1);
+    }
+
+    while ((tok = strtok_r(NULL, ",", &save))) {
+        val = strchr(tok, '=');
+        if (!val) {
+            printf("Bad workload setting: %s\n", tok);
+            exit(1);
+        }
+        *val++ = '\0';
+
+        if      (strcmp(tok, "n") == 0)      w->records   = parseSize(val, 1000);
+        else if (strcmp(tok, "fp") == 0)     w->footprint = parseSize(val, 1024);
+        else if (strcmp(tok, "w") == 0)      w->writepct  = atoi(val);
+        else if (strcmp(tok, "seed") == 0)   w->seed      = parseSize(val, 1000);
+        else if (strcmp(tok, "t") == 0)      w->threads   = atoi(val);
+        else if (strcmp(tok, "stride") == 0) w->stride    = parseSize(val, 1024);
+        else if (strcmp(tok, "theta") == 0)  w->theta     = atof(val);
+        else if (strcmp(tok, "obj") == 0)    w->objblocks = parseSize(val, 1024);
+        else {
+            printf("Unknown workload setting: %s\n", tok);
+            exit(1);
+        }
+    }
+    free(copy);
+
+    w->setup();
+    w->init();
+    return w;
+}
+
+/*
+ * Workload::setup
+ *     - Check the settings and work out what every kind needs.
+ */
+void Workload::setup() {
+    assert(writepct >= 0 && writepct <= 100);
+    assert(threads >= 1 && threads <= 255);
+    assert(footprint >= BLKSIZE);
+    assert(stride > 0 && objblocks > 0);
+
+    nblocks = footprint / BLKSIZE;
+    if (writepct == 100)
+        wthresh = ~0UL;
+    else
+        wthresh = (ulong)(writepct / 100.0 * 18446744073709551616.0);
+    left = records;
+    rng.setSeed(seed);
+    batch = new WorkRec[WORKBATCH];
+}
+
+/*
+ * Workload::fill
+ *     - Make up to n records into buf.
+ *
+ * Returns the # made (0 when the workload is done).
+ */
+int Workload::fill(WorkRec *buf, int n) {
+    if ((ulong)n > left)
+        n = left;
+    if (n)
+        generate(buf, n);
+    left -= n;
+    return n;
+}
+
+/*
+ * Workload::describe
+ *     - Write the settings into buf.
+ */
+void Workload::describe(char *buf) {
+    buf += sprintf(buf, "%s n=%lu fp=%lu w=%d seed=%lu t=%d",
+                   WORKNAMES[kind], records, footprint, writepct, seed, threads);
+    if (kind == WORKSTREAM)
+        sprintf(buf, " stride=%lu", stride);
+    else if (kind == WORKZIPF)
+        sprintf(buf, " theta=%.2f", theta);
+    else if (kind == WORKMIGRATORY)
+        sprintf(buf, " obj=%lu", objblocks);
+}
+
+
+void StreamWorkload::init() {
+    int i;
+
+    region = footprint / threads / BLKSIZE * BLKSIZE;
+    assert(region > 0);
+    offset = new ulong[threads];
+    for (i=0; i < threads; i++)
+        offset[i] = 0;
+    cur = 0;
+}
+
+void StreamWorkload::generate(WorkRec *buf, int n) {
+    int i;
+
+    for (i=0; i < n; i++) {
+        buf[i].tid  = cur;
+        buf[i].op   = isWrite() ? 'w' : 'r';
+        buf[i].addr = WORKBASE + cur * region + offset[cur];
+        offset[cur] += stride;
+        if (offset[cur] >= region)
+            offset[cur] %= region;
+        if (++cur == threads)
+            cur = 0;
+    }
+}
+
+
+void RandomWorkload::generate(WorkRec *buf, int n) {
+    int i;
+
+    for (i=0; i < n; i++) {
+        buf[i].tid  = cur;
+        buf[i].op   = isWrite() ? 'w' : 'r';
+        buf[i].addr = WORKBASE + rng.below(nblocks) * BLKSIZE;
+        if (++cur == threads)
+            cur = 0;
+    }
+}
+
+
+/*
+ * ZipfWorkload::init
+ *     - Build the alias table. Rank r gets weight 1/(r+1)^theta. See
+ *       Vose, "A linear algorithm for generating random numbers with
+ *       a given distribution" (1991).
+ */
+void ZipfWorkload::init() {
+    ulong i, s, l;
+    ulong nsmall = 0, nlarge = 0;
+    double sum = 0;
+    double *p;
+    ulong *small, *large;
+
+    nranks = MIN(nblocks, (ulong)ZIPFMAX);
+    prob   = new uint[nranks];
+    alias  = new uint[nranks];
+    block  = new uint[nranks];
+    p      = new double[nranks];
+    small  = new ulong[nranks];
+    large  = new ulong[nranks];
+
+    for (i=0; i < nranks; i++) {
+        p[i] = pow(i + 1, -theta);
+        sum += p[i];
+        block[i] = (i * ZIPFSCATTER) % nblocks;
+    }
+    for (i=0; i < nranks; i++) {
+        p[i] = p[i] * nranks / sum;
+        if (p[i] < 1.0)
+            small[nsmall++] = i;
+        else
+            large[nlarge++] = i;
+    }
+
+    while (nsmall && nlarge) {
+        s = small[--nsmall];
+        l = large[--nlarge];
+        prob[s]  = (uint)(p[s] * 4294967295.0);
+        alias[s] = l;
+        p[l] = p[l] + p[s] - 1.0;
+        if (p[l] < 1.0)
+            small[nsmall++] = l;
+        else
+            large[nlarge++] = l;
+    }
+    while (nlarge) {
+        l = large[--nlarge];
+        prob[l]  = ~0U;
+        alias[l] = l;
+    }
+    while (nsmall) { // Only left over from rounding
+        s = small[--nsmall];
+        prob[s]  = ~0U;
+        alias[s] = s;
+    }
+
+    delete[] p;
+    delete[] small;
+    delete[] large;
+    cur = 0;
+}
+
+ZipfWorkload::~ZipfWorkload() {
+    delete[] prob;
+    delete[] alias;
+    delete[] block;
+}
+
+void ZipfWorkload::generate(WorkRec *buf, int n) {
+    int i;
+    ulong r, col;
+
+    for (i=0; i < n; i++) {
+        // The top half of r picks the column and the bottom half
+        // picks between it and its alias
+        r   = rng.next();
+        col = ((r >> 32) * nranks) >> 32;
+        if ((uint)r >= prob[col])
+            col = alias[col];
+
+        buf[i].tid  = cur;
+        buf[i].op   = isWrite() ? 'w' : 'r';
+        buf[i].addr = WORKBASE + (ulong)block[col] * BLKSIZE;
+        if (++cur == threads)
+            cur = 0;
+    }
+}
+
+
+void ProdConsWorkload::init() {
+    int i;
+
+    assert(threads >= 2 && threads % 2 == 0);
+    pairs  = threads / 2;
+    region = nblocks / pairs;
+    assert(region >= PCCHUNK);
+    head = new ulong[pairs];
+    for (i=0; i < pairs; i++)
+        head[i] = 0;
+    cur   = 0;
+    phase = 0;
+    idx   = 0;
+}
+
+void ProdConsWorkload::generate(WorkRec *buf, int n) {
+    int i;
+    ulong b;
+
+    for (i=0; i < n; i++) {
+        b = (head[cur] + idx) % region;
+        buf[i].addr = WORKBASE + (cur * region + b) * BLKSIZE;
+        if (phase == 0) {
+            buf[i].tid = 2 * cur;
+            buf[i].op  = 'w';
+        } else {
+            buf[i].tid = 2 * cur + 1;
+            buf[i].op  = isWrite() ? 'w' : 'r';
+        }
+
+        // Produce a chunk, consume it and then move on to the next
+        // pair
+        if (++idx < PCCHUNK)
+            continue;
+        idx = 0;
+        if (phase == 0) {
+            phase = 1;
+        } else {
+            phase = 0;
+            head[cur] += PCCHUNK;
+            if (++cur == pairs)
+                cur = 0;
+        }
+    }
+}
+
+
+void MigratoryWorkload::init() {
+    nobjs = nblocks / objblocks;
+    assert(nobjs > 0);
+    tid  = threads - 1;
+    step = 2 * objblocks; // Pick an object first thing
+}
+
+void MigratoryWorkload::generate(WorkRec *buf, int n) {
+    int i;
+
+    for (i=0; i < n; i++) {
+
+        // Done with this object? The next thread takes a random
+        // one (most likely last touched by some other thread).
+        if (step == 2 * objblocks) {
+            obj  = rng.below(nobjs);
+            tid  = (tid + 1) % threads;
+            step = 0;
+        }
+
+        buf[i].tid  = tid;
+        buf[i].op   = (step & 1) ? 'w' : 'r';
+        buf[i].addr = WORKBASE + (obj * objblocks + step / 2) * BLKSIZE;
+        step++;
+    }
+}
+
+
+void FalseShareWorkload::generate(WorkRec *buf, int n) {
+    int i;
+
+    for (i=0; i < n; i++) {
+        buf[i].tid  = cur;
+        buf[i].op   = isWrite() ? 'w' : 'r';
+        buf[i].addr = WORKBASE + rng.below(nblocks) * BLKSIZE +
+                      (cur * 4) % BLKSIZE;
+        if (++cur == threads)
+            cur = 0;
+    }
+}
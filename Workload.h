@@ -0,0 +1,229 @@
+/*
+ * Dusty Mabe - 2014
+ * Workload.h - Header file for the synthetic workload generators. A
+ *              workload hands out (thread, op, addr) records that can
+ *              be fed straight to the tiles (give the simulator
+ *              gen:<spec> instead of a trace file) or written out as
+ *              a trace (see TraceGen.cc). A spec is the kind followed
+ *              by optional key=value settings:
+ *
+ *                  zipf,n=10M,fp=64M,w=30,seed=7
+ *
+ *              - n      - records to generate (default 10M)
+ *              - fp     - footprint in bytes (default 16M, 4K for
+ *                         falseshare)
+ *              - w      - % of accesses that are writes (default 30)
+ *              - seed   - random seed (default 1)
+ *              - t      - threads (default 1, or NPROCS for the
+ *                         sharing patterns)
+ *              - stride - bytes between accesses (stream, default
+ *                         BLKSIZE)
+ *              - theta  - skew (zipf, default 0.99)
+ *              - obj    - blocks per object (migratory, default 4)
+ *
+ *              Sizes take a K, M or G suffix. The kinds are:
+ *
+ *              - WORKSTREAM     - each thread sweeps its own part of
+ *                                 the footprint with a fixed stride
+ *              - WORKRANDOM     - uniform over the footprint
+ *              - WORKZIPF       - Zipfian over the blocks of the
+ *                                 footprint (hottest first, scattered
+ *                                 over the footprint)
+ *              - WORKPRODCONS   - pairs of threads. The producer writes
+ *                                 a chunk of a buffer and then the
+ *                                 consumer reads it (and writes w% of
+ *                                 it back).
+ *              - WORKMIGRATORY  - random objects are read and then
+ *                                 written by one thread after another
+ *              - WORKFALSESHARE - every thread uses its own word of
+ *                                 the same blocks
+ *
+ *              With more than one thread the records go round robin
+ *              over the threads (except for the pattern itself).
+ *              Records are made in batches by a non-virtual loop so
+ *              generating them costs a few ns each (more for a Zipfian
+ *              footprint whose tables don't fit in the host caches).
+ */
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include "types.h"
+#include "params.h"
+#include "Rng.h"
+
+// Kinds of workload
+enum {
+    WORKSTREAM = 0,
+    WORKRANDOM,
+    WORKZIPF,
+    WORKPRODCONS,
+    WORKMIGRATORY,
+    WORKFALSESHARE,
+    NWORKKINDS,
+};
+
+// Names of the kinds (indexed by WORKSTREAM, WORKRANDOM, ...)
+extern const char *WORKNAMES[];
+
+// Where the footprint starts
+#define WORKBASE 0x10000000UL
+
+// Records made at a time
+#define WORKBATCH 4096
+
+// Most blocks a Zipfian workload ranks (the rest of a bigger
+// footprint would hardly ever be touched anyway)
+#define ZIPFMAX (1 << 20)
+
+// Blocks the producer writes before the consumer reads them
+#define PCCHUNK 8
+
+// One generated access
+class WorkRec {
+    public:
+        ulong addr;
+        uchar op;
+        uchar tid;
+};
+
+class Workload {
+    protected:
+        Rng   rng;
+        ulong nblocks;  // Blocks in the footprint
+        ulong wthresh;  // A write if the next random # is below this
+        ulong left;     // Records still to make
+
+        // Batch of records handed out by next()
+        WorkRec *batch;
+        int      nbatch;
+        int      pos;
+
+        Workload(int k);
+        void setup();
+        int  isWrite() { return rng.next() < wthresh; }
+
+        // Set up the state of the pattern (after the settings are in)
+        virtual void init() {}
+
+        // Make n records
+        virtual void generate(WorkRec *buf, int n) = 0;
+
+    public:
+        int   kind;
+        ulong records;   // Settings from the spec
+        ulong footprint;
+        int   writepct;
+        ulong seed;
+        int   threads;
+        ulong stride;
+        double theta;
+        ulong objblocks;
+
+        static Workload * create(const char *spec);
+        virtual ~Workload();
+
+        int  fill(WorkRec *buf, int n);
+        void describe(char *buf);
+
+        // Get the next record. Returns 0 when there are no more.
+        int next(int *tid, uchar *op, ulong *addr) {
+            if (pos == nbatch) {
+                nbatch = fill(batch, WORKBATCH);
+                pos    = 0;
+                if (nbatch == 0)
+                    return 0;
+            }
+            *tid  = batch[pos].tid;
+            *op   = batch[pos].op;
+            *addr = batch[pos].addr;
+            pos++;
+            return 1;
+        }
+};
+
+class StreamWorkload : public Workload {
+    private:
+        ulong  region; // Bytes each thread sweeps
+        ulong *offset; // Where each thread is in its region
+        int    cur;    // Thread making the next record
+
+        void init();
+        void generate(WorkRec *buf, int n);
+
+    public:
+        StreamWorkload() : Workload(WORKSTREAM) {}
+        ~StreamWorkload() { delete[] offset; }
+};
+
+class RandomWorkload : public Workload {
+    private:
+        int  cur;
+
+        void init() { cur = 0; }
+        void generate(WorkRec *buf, int n);
+
+    public:
+        RandomWorkload() : Workload(WORKRANDOM) {}
+};
+
+class ZipfWorkload : public Workload {
+    private:
+        // Alias table (Vose) over the ranks plus the block each rank
+        // is put on
+        uint *prob;
+        uint *alias;
+        uint *block;
+        ulong nranks;
+        int   cur;
+
+        void init();
+        void generate(WorkRec *buf, int n);
+
+    public:
+        ZipfWorkload() : Workload(WORKZIPF) {}
+        ~ZipfWorkload();
+};
+
+class ProdConsWorkload : public Workload {
+    private:
+        ulong  region; // Blocks in the buffer of each pair
+        ulong *head;   // Next chunk each pair produces
+        int    pairs;
+        int    cur;    // Pair making the next record
+        int    phase;  // 0 = producing, 1 = consuming
+        int    idx;    // Block within the chunk
+
+        void init();
+        void generate(WorkRec *buf, int n);
+
+    public:
+        ProdConsWorkload() : Workload(WORKPRODCONS) {}
+        ~ProdConsWorkload() { delete[] head; }
+};
+
+class MigratoryWorkload : public Workload {
+    private:
+        ulong  nobjs;
+        ulong  obj;   // Object being worked on
+        int    tid;   // .. and by whom
+        ulong  step;  // Read then write of each of its blocks
+
+        void init();
+        void generate(WorkRec *buf, int n);
+
+    public:
+        MigratoryWorkload() : Workload(WORKMIGRATORY) {}
+};
+
+class FalseShareWorkload : public Workload {
+    private:
+        int  cur;
+
+        void init() { cur = 0; }
+        void generate(WorkRec *buf, int n);
+
+    public:
+        FalseShareWorkload() : Workload(WORKFALSESHARE) {}
+};
+
+#endif
@@ -0,0 +1,268 @@
+#!/bin/bash
+#
+# Regression harness. Runs ../sim on a fixed set of configurations,
+# diffs the tabular output of each against its golden file and keeps
+# a history of how long each run took and how much memory it used.
+#
+#   ./regress.sh [-u] [-t pct] [-r reps] [-n history] [config ...]
+#
+#     -u          update the golden files with the current output
+#     -t pct      flag a run as SLOW (or its memory as RSS) if it is
+#                 more than pct percent over the median of the last
+#                 HISTWINDOW passing runs of that config (default 20)
+#     -r reps     run each config reps times and keep the fastest
+#                 (default 3)
+#     -n history  history file (default ./regress_history.txt)
+#     config ...  only run these configs
+#
+#   ./regress.sh -g <kind> <records> <seed>
+#
+#     Write a synthetic trace to stdout. kind is stream, random, hot
+#     or shared (multi-threaded).
+#
+# Inputs are the small traces committed under traces/ and synthetic
+# traces generated on every run. The generator only uses integer
+# arithmetic (Park-Miller) so every awk makes the same traces.
+#
+# The committed traces were made with:
+#
+#   (./regress.sh -g stream 10000 1; ./regress.sh -g hot 10000 2;
+#    ./regress.sh -g random 10000 3) > traces/mix.t
+#   ./regress.sh -g shared 16000 4 > traces/mix_mt.t
+#
+# Each line of the history file is:
+#
+#   date revision config wall(s) rss(KB) status
+#
+# Exits non-zero if any config drifted or slowed down. The *_tab.txt
+# files next to this script are from the original full-size traces
+# (which aren't shipped) and are not checked.
+
+cd "$(dirname "$0")"
+
+SIM=../sim
+GOLDEN=golden
+TRACES=traces
+HISTWINDOW=5     # Passing runs the timing baseline is taken from
+NOISEFLOOR=0.1   # Don't call a run slow over less than this (s)
+
+THRESHOLD=20
+REPS=3
+HISTORY=./regress_history.txt
+UPDATE=0
+
+# Configurations: name, trace, options and positional arguments.
+# Traces starting with @ are synthetic: @kind:records:seed.
+CONFIGS=(
+    "mix_int0_ov0           mix.t                 0 0"
+    "mix_int5000_ov0        mix.t                 5000 0"
+    "mix_int5000_ov1000     mix.t                 5000 1000"
+    "mix_moesi              mix.t      --protocol moesi 5000 0"
+    "mix_mesif_sparse       mix.t      --protocol mesif --dir-entries 4096 5000 0"
+    "mix_flat_zeroload      mix.t      --memory flat --network zeroload 5000 0"
+    "mix_dram               mix.t      --memory dram 5000 0"
+    "mix_torus_eager        mix.t      --topology torus --memory dram --mem-drain eager 5000 0"
+    "mix_migrate            mix.t      --memory dram --mem-map migrate 5000 0"
+    "mt_seq                 mix_mt.t   --mt 0 0"
+    "mt_w4                  mix_mt.t   --mt --workers 4 --deterministic 0 0"
+    "mt_dram                mix_mt.t   --mt --memory dram 0 0"
+    "stream_int50000        @stream:200000:11 50000 0"
+    "random_int50000_ov10000 @random:200000:12 50000 10000"
+    "hot_int0               @hot:200000:13        0 0"
+    "shared_w2              @shared:200000:14 --mt --workers 2 --deterministic 0 0"
+)
+
+#
+# gen
+#     - Write a synthetic trace: gen <kind> <records> <seed>
+#
+gen() {
+    awk -v kind="$1" -v n="$2" -v seed="$3" '
+    function rnd() {
+        x = (16807 * x) % 2147483647
+        return x / 2147483647
+    }
+    BEGIN {
+        x      = seed
+        base   = 268435456  # 0x10000000
+        shared = 536870912  # 0x20000000
+        for (i = 0; i < n; i++) {
+            if (kind == "stream") {        # 4MB sequential, 1 in 4 writes
+                a = base + (i * 64) % 4194304
+                w = (i % 4 == 3)
+            } else if (kind == "random") { # Uniform over 8MB, 30% writes
+                a = base + int(rnd() * 131072) * 64
+                w = (rnd() < 0.3)
+            } else if (kind == "hot") {    # 90% to a 64KB hot set
+                if (rnd() < 0.9)
+                    a = base + int(rnd() * 1024) * 64
+                else
+                    a = base + int(rnd() * 262144) * 64
+                w = (rnd() < 0.2)
+            } else if (kind == "shared") { # 16 threads, 20% to a shared 16KB
+                t = i % 16
+                if (rnd() < 0.2) {
+                    a = shared + int(rnd() * 256) * 64
+                    w = (rnd() < 0.5)
+                } else {
+                    a = base + t * 1048576 + int(rnd() * 4096) * 64
+                    w = (rnd() < 0.3)
+                }
+                printf "%d ", t
+            } else {
+                print "unknown trace kind " kind > "/dev/stderr"
+                exit 1
+            }
+            printf "%s 0x%08x\n", w ? "w" : "r", a
+        }
+    }'
+}
+
+#
+# measure
+#     - Run a command with stdout to $1 and set WALL (seconds) and RSS
+#       (peak KB).
+#
+measure() {
+    local out=$1
+    shift
+    if [ -x /usr/bin/time ]; then
+        /usr/bin/time -f "%e %M" -o "$TMP/time" "$@" > "$out" || return 1
+    else
+        python3 -c '
+import resource, subprocess, sys, time
+start = time.monotonic()
+rc = subprocess.call(sys.argv[2:], stdout=open(sys.argv[1], "w"))
+wall = time.monotonic() - start
+rss = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+open(sys.argv[1] + ".time", "w").write("%.2f %d\n" % (wall, rss))
+sys.exit(rc)' "$out" "$@" || return 1
+        mv "$out.time" "$TMP/time"
+    fi
+    read WALL RSS < "$TMP/time"
+}
+
+#
+# baseline
+#     - Print the median wall time and RSS of the last HISTWINDOW
+#       passing runs of config $1 (nothing if there are none).
+#
+baseline() {
+    local n
+    [ -f "$HISTORY" ] || return
+    awk -v c="$1" '$3 == c && $6 == "ok" { print $4, $5 }' "$HISTORY" |
+        tail -n $HISTWINDOW > "$TMP/base"
+    [ -s "$TMP/base" ] || return
+    n=$(( ($(wc -l < "$TMP/base") + 1) / 2 ))
+    echo $(cut -d' ' -f1 "$TMP/base" | sort -g | sed -n ${n}p) \
+         $(cut -d' ' -f2 "$TMP/base" | sort -n | sed -n ${n}p)
+}
+
+if [ "$1" == "-g" ]; then
+    [ $# -eq 4 ] || { echo "usage: $0 -g <kind> <records> <seed>"; exit 1; }
+    gen "$2" "$3" "$4"
+    exit
+fi
+
+while getopts "ut:r:n:" opt; do
+    case $opt in
+        u) UPDATE=1 ;;
+        t) THRESHOLD=$OPTARG ;;
+        r) REPS=$OPTARG ;;
+        n) HISTORY=$OPTARG ;;
+        *) sed -n '3,18p' "$0"; exit 1 ;;
+    esac
+done
+shift $((OPTIND - 1))
+ONLY=" $* "
+
+if [ ! -x $SIM ]; then
+    echo "$SIM not found (run make first)"
+    exit 1
+fi
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+mkdir -p $GOLDEN
+
+REV=$(git rev-parse --short HEAD 2>/dev/null || echo unknown)
+[ -n "$(git status --porcelain -- .. 2>/dev/null | grep -v '^??')" ] && REV="$REV+"
+DATE=$(date +%Y-%m-%dT%H:%M:%S)
+FAILED=0
+
+printf "%-24s %8s %10s %10s  %s\n" config wall rss baseline status
+for config in "${CONFIGS[@]}"; do
+    set -- $config
+    name=$1
+    trace=$2
+    shift 2
+
+    if [ "$ONLY" != "  " ] && [[ "$ONLY" != *" $name "* ]]; then
+        continue
+    fi
+
+    # Make the synthetic traces the first time they are used
+    if [[ $trace == @* ]]; then
+        file="$TMP/${trace:1}.t"
+        file=${file//:/_}
+        if [ ! -f "$file" ]; then
+            IFS=: read kind records seed <<< "${trace:1}"
+            gen $kind $records $seed > "$file"
+        fi
+    else
+        file=$TRACES/$trace
+    fi
+
+    # Keep the fastest run and the largest footprint
+    best=""
+    peak=0
+    for ((i=0; i < REPS; i++)); do
+        if ! measure "$TMP/$name.txt" $SIM "$@" "$file" t; then
+            WALL=0
+            RSS=0
+            status=FAILED
+            break
+        fi
+        if [ -z "$best" ] || awk "BEGIN { exit !($WALL < $best) }"; then
+            best=$WALL
+        fi
+        [ "$RSS" -gt "$peak" ] && peak=$RSS
+    done
+    best=${best:-0}
+
+    status=${status:-ok}
+    base=$(baseline $name)
+    golden=$GOLDEN/${name}_tab.txt
+
+    if [ $status == FAILED ]; then
+        :
+    elif [ $UPDATE -eq 1 ]; then
+        cp "$TMP/$name.txt" "$golden"
+        status=updated
+    elif [ ! -f "$golden" ]; then
+        status=NOGOLDEN
+    elif ! cmp -s "$TMP/$name.txt" "$golden"; then
+        status=DRIFT
+        diff "$golden" "$TMP/$name.txt" | head -n 10 | cut -c1-120 > "$TMP/$name.diff"
+    elif [ -n "$base" ]; then
+        read bwall brss <<< "$base"
+        if awk "BEGIN { exit !($best > $bwall * (1 + $THRESHOLD / 100.0) && \
+                              $best - $bwall > $NOISEFLOOR) }"; then
+            status=SLOW
+        elif awk "BEGIN { exit !($peak > $brss * (1 + $THRESHOLD / 100.0)) }"; then
+            status=RSS
+        fi
+    fi
+
+    printf "%-24s %8s %10s %10s  %s\n" $name $best $peak "${base%% *}" $status
+    [ -f "$TMP/$name.diff" ] && sed 's/^/    /' "$TMP/$name.diff"
+
+    echo "$DATE $REV $name $best $peak $status" >> "$HISTORY"
+    case $status in
+        ok|updated) ;;
+        *) FAILED=1 ;;
+    esac
+    unset status
+done
+
+exit $FAILED
@@ -0,0 +1,30000 @@
+r 0x10000000
+r 0x10000040
+r 0x10000080
+w 0x100000c0
+r 0x10000100
+r 0x10000140
+r 0x10000180
+w 0x100001c0
+r 0x10000200
+r 0x10000240
+r 0x10000280
+w 0x100002c0
+r 0x10000300
+r 0x10000340
+r 0x10000380
+w 0x100003c0
+r 0x10000400
+r 0x10000440
+r 0x10000480
+w 0x100004c0
+r 0x10000500
+r 0x10000540
+r 0x10000580
+w 0x100005c0
+r 0x10000600
+r 0x10000640
+r 0x10000680
+w 0x100006c0
+r 0x10000700
+r 0x10000740
+r 0x10000780
+w 0x100007c0
+r 0x10000800
+r 0x10000840
+r 0x10000880
+w 0x100008c0
+r 0x10000900
+r 0x10000940
+r 0x10000980
+w 0x100009c0
+r 0x10000a00
+r 0x10000a40
+r 0x10000a80
+w 0x10000ac0
+r 0x10000b00
+r 0x10000b40
+r 0x10000b80
+w 0x10000bc0
+r 0x10000c00
+r 0x10000c40
+r 0x10000c80
+w 0x10000cc0
+r 0x10000d00
+r 0x10000d40
+r 0x10000d80
+w 0x10000dc0
+r 0x10000e00
+r 0x10000e40
+r 0x10000e80
+w 0x10000ec0
+r 0x10000f00
+r 0x10000f40
+r 0x10000f80
+w 0x10000fc0
+r 0x10001000
+r 0x10001040
+r 0x10001080
+w 0x100010c0
+r 0x10001100
+r 0x10001140
+r 0x10001180
+w 0x100011c0
+r 0x10001200
+r 0x10001240
+r 0x10001280
+w 0x100012c0
+r 0x10001300
+r 0x10001340
+r 0x10001380
+w 0x100013c0
+r 0x10001400
+r 0x10001440
+r 0x10001480
+w 0x100014c0
+r 0x10001500
+r 0x10001540
+r 0x10001580
+w 0x100015c0
+r 0x10001600
+r 0x10001640
+r 0x10001680
+w 0x100016c0
+r 0x10001700
+r 0x10001740
+r 0x10001780
+w 0x100017c0
+r 0x10001800
+r 0x10001840
+r 0x10001880
+w 0x100018c0
+r 0x10001900
+r 0x10001940
+r 0x10001980
+w 0x100019c0
+r 0x10001a00
+r 0x10001a40
+r 0x10001a80
+w 0x10001ac0
+r 0x10001b00
+r 0x10001b40
+r 0x10001b80
+w 0x10001bc0
+r 0x10001c00
+r 0x10001c40
+r 0x10001c80
+w 0x10001cc0
+r 0x10001d00
+r 0x10001d40
+r 0x10001d80
+w 0x10001dc0
+r 0x10001e00
+r 0x10001e40
+r 0x10001e80
+w 0x10001ec0
+r 0x10001f00
+r 0x10001f40
+r 0x10001f80
+w 0x10001fc0
+r 0x10002000
+r 0x10002040
+r 0x10002080
+w 0x100020c0
+r 0x10002100
+r 0x10002140
+r 0x10002180
+w 0x100021c0
+r 0x10002200
+r 0x10002240
+r 0x10002280
+w 0x100022c0
+r 0x10002300
+r 0x10002340
+r 0x10002380
+w 0x100023c0
+r 0x10002400
+r 0x10002440
+r 0x10002480
+w 0x100024c0
+r 0x10002500
+r 0x10002540
+r 0x10002580
+w 0x100025c0
+r 0x10002600
+r 0x10002640
+r 0x10002680
+w 0x100026c0
+r 0x10002700
+r 0x10002740
+r 0x10002780
+w 0x100027c0
+r 0x10002800
+r 0x10002840
+r 0x10002880
+w 0x100028c0
+r 0x10002900
+r 0x10002940
+r 0x10002980
+w 0x100029c0
+r 0x10002a00
+r 0x10002a40
+r 0x10002a80
+w 0x10002ac0
+r 0x10002b00
+r 0x10002b40
+r 0x10002b80
+w 0x10002bc0
+r 0x10002c00
+r 0x10002c40
+r 0x10002c80
+w 0x10002cc0
+r 0x10002d00
+r 0x10002d40
+r 0x10002d80
+w 0x10002dc0
+r 0x10002e00
+r 0x10002e40
+r 0x10002e80
+w 0x10002ec0
+r 0x10002f00
+r 0x10002f40
+r 0x10002f80
+w 0x10002fc0
+r 0x10003000
+r 0x10003040
+r 0x10003080
+w 0x100030c0
+r 0x10003100
+r 0x10003140
+r 0x10003180
+w 0x100031c0
+r 0x10003200
+r 0x10003240
+r 0x10003280
+w 0x100032c0
+r 0x10003300
+r 0x10003340
+r 0x10003380
+w 0x100033c0
+r 0x10003400
+r 0x10003440
+r 0x10003480
+w 0x100034c0
+r 0x10003500
+r 0x10003540
+r 0x10003580
+w 0x100035c0
+r 0x10003600
+r 0x10003640
+r 0x10003680
+w 0x100036c0
+r 0x10003700
+r 0x10003740
+r 0x10003780
+w 0x100037c0
+r 0x10003800
+r 0x10003840
+r 0x10003880
+w 0x100038c0
+r 0x10003900
+r 0x10003940
+r 0x10003980
+w 0x100039c0
+r 0x10003a00
+r 0x10003a40
+r 0x10003a80
+w 0x10003ac0
+r 0x10003b00
+r 0x10003b40
+r 0x10003b80
+w 0x10003bc0
+r 0x10003c00
+r 0x10003c40
+r 0x10003c80
+w 0x10003cc0
+r 0x10003d00
+r 0x10003d40
+r 0x10003d80
+w 0x10003dc0
+r 0x10003e00
+r 0x10003e40
+r 0x10003e80
+w 0x10003ec0
+r 0x10003f00
+r 0x10003f40
+r 0x10003f80
+w 0x10003fc0
+r 0x10004000
+r 0x10004040
+r 0x10004080
+w 0x100040c0
+r 0x10004100
+r 0x10004140
+r 0x10004180
+w 0x100041c0
+r 0x10004200
+r 0x10004240
+r 0x10004280
+w 0x100042c0
+r 0x10004300
+r 0x10004340
+r 0x10004380
+w 0x100043c0
+r 0x10004400
+r 0x10004440
+r 0x10004480
+w 0x100044c0
+r 0x10004500
+r 0x10004540
+r 0x10004580
+w 0x100045c0
+r 0x10004600
+r 0x10004640
+r 0x10004680
+w 0x100046c0
+r 0x10004700
+r 0x10004740
+r 0x10004780
+w 0x100047c0
+r 0x10004800
+r 0x10004840
+r 0x10004880
+w 0x100048c0
+r 0x10004900
+r 0x10004940
+r 0x10004980
+w 0x100049c0
+r 0x10004a00
+r 0x10004a40
+r 0x10004a80
+w 0x10004ac0
+r 0x10004b00
+r 0x10004b40
+r 0x10004b80
+w 0x10004bc0
+r 0x10004c00
+r 0x10004c40
+r 0x10004c80
+w 0x10004cc0
+r 0x10004d00
+r 0x10004d40
+r 0x10004d80
+w 0x10004dc0
+r 0x10004e00
+r 0x10004e40
+r 0x10004e80
+w 0x10004ec0
+r 0x10004f00
+r 0x10004f40
+r 0x10004f80
+w 0x10004fc0
+r 0x10005000
+r 0x10005040
+r 0x10005080
+w 0x100050c0
+r 0x10005100
+r 0x10005140
+r 0x10005180
+w 0x100051c0
+r 0x10005200
+r 0x10005240
+r 0x10005280
+w 0x100052c0
+r 0x10005300
+r 0x10005340
+r 0x10005380
+w 0x100053c0
+r 0x10005400
+r 0x10005440
+r 0x10005480
+w 0x100054c0
+r 0x10005500
+r 0x10005540
+r 0x10005580
+w 0x100055c0
+r 0x10005600
+r 0x10005640
+r 0x10005680
+w 0x100056c0
+r 0x10005700
+r 0x10005740
+r 0x10005780
+w 0x100057c0
+r 0x10005800
+r 0x10005840
+r 0x10005880
+w 0x100058c0
+r 0x10005900
+r 0x10005940
+r 0x10005980
+w 0x100059c0
+r 0x10005a00
+r 0x10005a40
+r 0x10005a80
+w 0x10005ac0
+r 0x10005b00
+r 0x10005b40
+r 0x10005b80
+w 0x10005bc0
+r 0x10005c00
+r 0x10005c40
+r 0x10005c80
+w 0x10005cc0
+r 0x10005d00
+r 0x10005d40
+r 0x10005d80
+w 0x10005dc0
+r 0x10005e00
+r 0x10005e40
+r 0x10005e80
+w 0x10005ec0
+r 0x10005f00
+r 0x10005f40
+r 0x10005f80
+w 0x10005fc0
+r 0x10006000
+r 0x10006040
+r 0x10006080
+w 0x100060c0
+r 0x10006100
+r 0x10006140
+r 0x10006180
+w 0x100061c0
+r 0x10006200
+r 0x10006240
+r 0x10006280
+w 0x100062c0
+r 0x10006300
+r 0x10006340
+r 0x10006380
+w 0x100063c0
+r 0x10006400
+r 0x10006440
+r 0x10006480
+w 0x100064c0
+r 0x10006500
+r 0x10006540
+r 0x10006580
+w 0x100065c0
+r 0x10006600
+r 0x10006640
+r 0x10006680
+w 0x100066c0
+r 0x10006700
+r 0x10006740
+r 0x10006780
+w 0x100067c0
+r 0x10006800
+r 0x10006840
+r 0x10006880
+w 0x100068c0
+r 0x10006900
+r 0x10006940
+r 0x10006980
+w 0x100069c0
+r 0x10006a00
+r 0x10006a40
+r 0x10006a80
+w 0x10006ac0
+r 0x10006b00
+r 0x10006b40
+r 0x10006b80
+w 0x10006bc0
+r 0x10006c00
+r 0x10006c40
+r 0x10006c80
+w 0x10006cc0
+r 0x10006d00
+r 0x10006d40
+r 0x10006d80
+w 0x10006dc0
+r 0x10006e00
+r 0x10006e40
+r 0x10006e80
+w 0x10006ec0
+r 0x10006f00
+r 0x10006f40
+r 0x10006f80
+w 0x10006fc0
+r 0x10007000
+r 0x10007040
+r 0x10007080
+w 0x100070c0
+r 0x10007100
+r 0x10007140
+r 0x10007180
+w 0x100071c0
+r 0x10007200
+r 0x10007240
+r 0x10007280
+w 0x100072c0
+r 0x10007300
+r 0x10007340
+r 0x10007380
+w 0x100073c0
+r 0x10007400
+r 0x10007440
+r 0x10007480
+w 0x100074c0
+r 0x10007500
+r 0x10007540
+r 0x10007580
+w 0x100075c0
+r 0x10007600
+r 0x10007640
+r 0x10007680
+w 0x100076c0
+r 0x10007700
+r 0x10007740
+r 0x10007780
+w 0x100077c0
+r 0x10007800
+r 0x10007840
+r 0x10007880
+w 0x100078c0
+r 0x10007900
+r 0x10007940
+r 0x10007980
+w 0x100079c0
+r 0x10007a00
+r 0x10007a40
+r 0x10007a80
+w 0x10007ac0
+r 0x10007b00
+r 0x10007b40
+r 0x10007b80
+w 0x10007bc0
+r 0x10007c00
+r 0x10007c40
+r 0x10007c80
+w 0x10007cc0
+r 0x10007d00
+r 0x10007d40
+r 0x10007d80
+w 0x10007dc0
+r 0x10007e00
+r 0x10007e40
+r 0x10007e80
+w 0x10007ec0
+r 0x10007f00
+r 0x10007f40
+r 0x10007f80
+w 0x10007fc0
+r 0x10008000
+r 0x10008040
+r 0x10008080
+w 0x100080c0
+r 0x10008100
+r 0x10008140
+r 0x10008180
+w 0x100081c0
+r 0x10008200
+r 0x10008240
+r 0x10008280
+w 0x100082c0
+r 0x10008300
+r 0x10008340
+r 0x10008380
+w 0x100083c0
+r 0x10008400
+r 0x10008440
+r 0x10008480
+w 0x100084c0
+r 0x10008500
+r 0x10008540
+r 0x10008580
+w 0x100085c0
+r 0x10008600
+r 0x10008640
+r 0x10008680
+w 0x100086c0
+r 0x10008700
+r 0x10008740
+r 0x10008780
+w 0x100087c0
+r 0x10008800
+r 0x10008840
+r 0x10008880
+w 0x100088c0
+r 0x10008900
+r 0x10008940
+r 0x10008980
+w 0x100089c0
+r 0x10008a00
+r 0x10008a40
+r 0x10008a80
+w 0x10008ac0
+r 0x10008b00
+r 0x10008b40
+r 0x10008b80
+w 0x10008bc0
+r 0x10008c00
+r 0x10008c40
+r 0x10008c80
+w 0x10008cc0
+r 0x10008d00
+r 0x10008d40
+r 0x10008d80
+w 0x10008dc0
+r 0x10008e00
+r 0x10008e40
+r 0x10008e80
+w 0x10008ec0
+r 0x10008f00
+r 0x10008f40
+r 0x10008f80
+w 0x10008fc0
+r 0x10009000
+r 0x10009040
+r 0x10009080
+w 0x100090c0
+r 0x10009100
+r 0x10009140
+r 0x10009180
+w 0x100091c0
+r 0x10009200
+r 0x10009240
+r 0x10009280
+w 0x100092c0
+r 0x10009300
+r 0x10009340
+r 0x10009380
+w 0x100093c0
+r 0x10009400
+r 0x10009440
+r 0x10009480
+w 0x100094c0
+r 0x10009500
+r 0x10009540
+r 0x10009580
+w 0x100095c0
+r 0x10009600
+r 0x10009640
+r 0x10009680
+w 0x100096c0
+r 0x10009700
+r 0x10009740
+r 0x10009780
+w 0x100097c0
+r 0x10009800
+r 0x10009840
+r 0x10009880
+w 0x100098c0
+r 0x10009900
+r 0x10009940
+r 0x10009980
+w 0x100099c0
+r 0x10009a00
+r 0x10009a40
+r 0x10009a80
+w 0x10009ac0
+r 0x10009b00
+r 0x10009b40
+r 0x10009b80
+w 0x10009bc0
+r 0x10009c00
+r 0x10009c40
+r 0x10009c80
+w 0x10009cc0
+r 0x10009d00
+r 0x10009d40
+r 0x10009d80
+w 0x10009dc0
+r 0x10009e00
+r 0x10009e40
+r 0x10009e80
+w 0x10009ec0
+r 0x10009f00
+r 0x10009f40
+r 0x10009f80
+w 0x10009fc0
+r 0x1000a000
+r 0x1000a040
+r 0x1000a080
+w 0x1000a0c0
+r 0x1000a100
+r 0x1000a140
+r 0x1000a180
+w 0x1000a1c0
+r 0x1000a200
+r 0x1000a240
+r 0x1000a280
+w 0x1000a2c0
+r 0x1000a300
+r 0x1000a340
+r 0x1000a380
+w 0x1000a3c0
+r 0x1000a400
+r 0x1000a440
+r 0x1000a480
+w 0x1000a4c0
+r 0x1000a500
+r 0x1000a540
+r 0x1000a580
+w 0x1000a5c0
+r 0x1000a600
+r 0x1000a640
+r 0x1000a680
+w 0x1000a6c0
+r 0x1000a700
+r 0x1000a740
+r 0x1000a780
+w 0x1000a7c0
+r 0x1000a800
+r 0x1000a840
+r 0x1000a880
+w 0x1000a8c0
+r 0x1000a900
+r 0x1000a940
+r 0x1000a980
+w 0x1000a9c0
+r 0x1000aa00
+r 0x1000aa40
+r 0x1000aa80
+w 0x1000aac0
+r 0x1000ab00
+r 0x1000ab40
+r 0x1000ab80
+w 0x1000abc0
+r 0x1000ac00
+r 0x1000ac40
+r 0x1000ac80
+w 0x1000acc0
+r 0x1000ad00
+r 0x1000ad40
+r 0x1000ad80
+w 0x1000adc0
+r 0x1000ae00
+r 0x1000ae40
+r 0x1000ae80
+w 0x1000aec0
+r 0x1000af00
+r 0x1000af40
+r 0x1000af80
+w 0x1000afc0
+r 0x1000b000
+r 0x1000b040
+r 0x1000b080
+w 0x1000b0c0
+r 0x1000b100
+r 0x1000b140
+r 0x1000b180
+w 0x1000b1c0
+r 0x1000b200
+r 0x1000b240
+r 0x1000b280
+w 0x1000b2c0
+r 0x1000b300
+r 0x1000b340
+r 0x1000b380
+w 0x1000b3c0
+r 0x1000b400
+r 0x1000b440
+r 0x1000b480
+w 0x1000b4c0
+r 0x1000b500
+r 0x1000b540
+r 0x1000b580
+w 0x1000b5c0
+r 0x1000b600
+r 0x1000b640
+r 0x1000b680
+w 0x1000b6c0
+r 0x1000b700
+r 0x1000b740
+r 0x1000b780
+w 0x1000b7c0
+r 0x1000b800
+r 0x1000b840
+r 0x1000b880
+w 0x1000b8c0
+r 0x1000b900
+r 0x1000b940
+r 0x1000b980
+w 0x1000b9c0
+r 0x1000ba00
+r 0x1000ba40
+r 0x1000ba80
+w 0x1000bac0
+r 0x1000bb00
+r 0x1000bb40
+r 0x1000bb80
+w 0x1000bbc0
+r 0x1000bc00
+r 0x1000bc40
+r 0x1000bc80
+w 0x1000bcc0
+r 0x1000bd00
+r 0x1000bd40
+r 0x1000bd80
+w 0x1000bdc0
+r 0x1000be00
+r 0x1000be40
+r 0x1000be80
+w 0x1000bec0
+r 0x1000bf00
+r 0x1000bf40
+r 0x1000bf80
+w 0x1000bfc0
+r 0x1000c000
+r 0x1000c040
+r 0x1000c080
+w 0x1000c0c0
+r 0x1000c100
+r 0x1000c140
+r 0x1000c180
+w 0x1000c1c0
+r 0x1000c200
+r 0x1000c240
+r 0x1000c280
+w 0x1000c2c0
+r 0x1000c300
+r 0x1000c340
+r 0x1000c380
+w 0x1000c3c0
+r 0x1000c400
+r 0x1000c440
+r 0x1000c480
+w 0x1000c4c0
+r 0x1000c500
+r 0x1000c540
+r 0x1000c580
+w 0x1000c5c0
+r 0x1000c600
+r 0x1000c640
+r 0x1000c680
+w 0x1000c6c0
+r 0x1000c700
+r 0x1000c740
+r 0x1000c780
+w 0x1000c7c0
+r 0x1000c800
+r 0x1000c840
+r 0x1000c880
+w 0x1000c8c0
+r 0x1000c900
+r 0x1000c940
+r 0x1000c980
+w 0x1000c9c0
+r 0x1000ca00
+r 0x1000ca40
+r 0x1000ca80
+w 0x1000cac0
+r 0x1000cb00
+r 0x1000cb40
+r 0x1000cb80
+w 0x1000cbc0
+r 0x1000cc00
+r 0x1000cc40
+r 0x1000cc80
+w 0x1000ccc0
+r 0x1000cd00
+r 0x1000cd40
+r 0x1000cd80
+w 0x1000cdc0
+r 0x1000ce00
+r 0x1000ce40
+r 0x1000ce80
+w 0x1000cec0
+r 0x1000cf00
+r 0x1000cf40
+r 0x1000cf80
+w 0x1000cfc0
+r 0x1000d000
+r 0x1000d040
+r 0x1000d080
+w 0x1000d0c0
+r 0x1000d100
+r 0x1000d140
+r 0x1000d180
+w 0x1000d1c0
+r 0x1000d200
+r 0x1000d240
+r 0x1000d280
+w 0x1000d2c0
+r 0x1000d300
+r 0x1000d340
+r 0x1000d380
+w 0x1000d3c0
+r 0x1000d400
+r 0x1000d440
+r 0x1000d480
+w 0x1000d4c0
+r 0x1000d500
+r 0x1000d540
+r 0x1000d580
+w 0x1000d5c0
+r 0x1000d600
+r 0x1000d640
+r 0x1000d680
+w 0x1000d6c0
+r 0x1000d700
+r 0x1000d740
+r 0x1000d780
+w 0x1000d7c0
+r 0x1000d800
+r 0x1000d840
+r 0x1000d880
+w 0x1000d8c0
+r 0x1000d900
+r 0x1000d940
+r 0x1000d980
+w 0x1000d9c0
+r 0x1000da00
+r 0x1000da40
+r 0x1000da80
+w 0x1000dac0
+r 0x1000db00
+r 0x1000db40
+r 0x1000db80
+w 0x1000dbc0
+r 0x1000dc00
+r 0x1000dc40
+r 0x1000dc80
+w 0x1000dcc0
+r 0x1000dd00
+r 0x1000dd40
+r 0x1000dd80
+w 0x1000ddc0
+r 0x1000de00
+r 0x1000de40
+r 0x1000de80
+w 0x1000dec0
+r 0x1000df00
+r 0x1000df40
+r 0x1000df80
+w 0x1000dfc0
+r 0x1000e000
+r 0x1000e040
+r 0x1000e080
+w 0x1000e0c0
+r 0x1000e100
+r 0x1000e140
+r 0x1000e180
+w 0x1000e1c0
+r 0x1000e200
+r 0x1000e240
+r 0x1000e280
+w 0x1000e2c0
+r 0x1000e300
+r 0x1000e340
+r 0x1000e380
+w 0x1000e3c0
+r 0x1000e400
+r 0x1000e440
+r 0x1000e480
+w 0x1000e4c0
+r 0x1000e500
+r 0x1000e540
+r 0x1000e580
+w 0x1000e5c0
+r 0x1000e600
+r 0x1000e640
+r 0x1000e680
+w 0x1000e6c0
+r 0x1000e700
+r 0x1000e740
+r 0x1000e780
+w 0x1000e7c0
+r 0x1000e800
+r 0x1000e840
+r 0x1000e880
+w 0x1000e8c0
+r 0x1000e900
+r 0x1000e940
+r 0x1000e980
+w 0x1000e9c0
+r 0x1000ea00
+r 0x1000ea40
+r 0x1000ea80
+w 0x1000eac0
+r 0x1000eb00
+r 0x1000eb40
+r 0x1000eb80
+w 0x1000ebc0
+r 0x1000ec00
+r 0x1000ec40
+r 0x1000ec80
+w 0x1000ecc0
+r 0x1000ed00
+r 0x1000ed40
+r 0x1000ed80
+w 0x1000edc0
+r 0x1000ee00
+r 0x1000ee40
+r 0x1000ee80
+w 0x1000eec0
+r 0x1000ef00
+r 0x1000ef40
+r 0x1000ef80
+w 0x1000efc0
+r 0x1000f000
+r 0x1000f040
+r 0x1000f080
+w 0x1000f0c0
+r 0x1000f100
+r 0x1000f140
+r 0x1000f180
+w 0x1000f1c0
+r 0x1000f200
+r 0x1000f240
+r 0x1000f280
+w 0x1000f2c0
+r 0x1000f300
+r 0x1000f340
+r 0x1000f380
+w 0x1000f3c0
+r 0x1000f400
+r 0x1000f440
+r 0x1000f480
+w 0x1000f4c0
+r 0x1000f500
+r 0x1000f540
+r 0x1000f580
+w 0x1000f5c0
+r 0x1000f600
+r 0x1000f640
+r 0x1000f680
+w 0x1000f6c0
+r 0x1000f700
+r 0x1000f740
+r 0x1000f780
+w 0x1000f7c0
+r 0x1000f800
+r 0x1000f840
+r 0x1000f880
+w 0x1000f8c0
+r 0x1000f900
+r 0x1000f940
+r 0x1000f980
+w 0x1000f9c0
+r 0x1000fa00
+r 0x1000fa40
+r 0x1000fa80
+w 0x1000fac0
+r 0x1000fb00
+r 0x1000fb40
+r 0x1000fb80
+w 0x1000fbc0
+r 0x1000fc00
+r 0x1000fc40
+r 0x1000fc80
+w 0x1000fcc0
+r 0x1000fd00
+r 0x1000fd40
+r 0x1000fd80
+w 0x1000fdc0
+r 0x1000fe00
+r 0x1000fe40
+r 0x1000fe80
+w 0x1000fec0
+r 0x1000ff00
+r 0x1000ff40
+r 0x1000ff80
+w 0x1000ffc0
+r 0x10010000
+r 0x10010040
+r 0x10010080
+w 0x100100c0
+r 0x10010100
+r 0x10010140
+r 0x10010180
+w 0x100101c0
+r 0x10010200
+r 0x10010240
+r 0x10010280
+w 0x100102c0
+r 0x10010300
+r 0x10010340
+r 0x10010380
+w 0x100103c0
+r 0x10010400
+r 0x10010440
+r 0x10010480
+w 0x100104c0
+r 0x10010500
+r 0x10010540
+r 0x10010580
+w 0x100105c0
+r 0x10010600
+r 0x10010640
+r 0x10010680
+w 0x100106c0
+r 0x10010700
+r 0x10010740
+r 0x10010780
+w 0x100107c0
+r 0x10010800
+r 0x10010840
+r 0x10010880
+w 0x100108c0
+r 0x10010900
+r 0x10010940
+r 0x10010980
+w 0x100109c0
+r 0x10010a00
+r 0x10010a40
+r 0x10010a80
+w 0x10010ac0
+r 0x10010b00
+r 0x10010b40
+r 0x10010b80
+w 0x10010bc0
+r 0x10010c00
+r 0x10010c40
+r 0x10010c80
+w 0x10010cc0
+r 0x10010d00
+r 0x10010d40
+r 0x10010d80
+w 0x10010dc0
+r 0x10010e00
+r 0x10010e40
+r 0x10010e80
+w 0x10010ec0
+r 0x10010f00
+r 0x10010f40
+r 0x10010f80
+w 0x10010fc0
+r 0x10011000
+r 0x10011040
+r 0x10011080
+w 0x100110c0
+r 0x10011100
+r 0x10011140
+r 0x10011180
+w 0x100111c0
+r 0x10011200
+r 0x10011240
+r 0x10011280
+w 0x100112c0
+r 0x10011300
+r 0x10011340
+r 0x10011380
+w 0x100113c0
+r 0x10011400
+r 0x10011440
+r 0x10011480
+w 0x100114c0
+r 0x10011500
+r 0x10011540
+r 0x10011580
+w 0x100115c0
+r 0x10011600
+r 0x10011640
+r 0x10011680
+w 0x100116c0
+r 0x10011700
+r 0x10011740
+r 0x10011780
+w 0x100117c0
+r 0x10011800
+r 0x10011840
+r 0x10011880
+w 0x100118c0
+r 0x10011900
+r 0x10011940
+r 0x10011980
+w 0x100119c0
+r 0x10011a00
+r 0x10011a40
+r 0x10011a80
+w 0x10011ac0
+r 0x10011b00
+r 0x10011b40
+r 0x10011b80
+w 0x10011bc0
+r 0x10011c00
+r 0x10011c40
+r 0x10011c80
+w 0x10011cc0
+r 0x10011d00
+r 0x10011d40
+r 0x10011d80
+w 0x10011dc0
+r 0x10011e00
+r 0x10011e40
+r 0x10011e80
+w 0x10011ec0
+r 0x10011f00
+r 0x10011f40
+r 0x10011f80
+w 0x10011fc0
+r 0x10012000
+r 0x10012040
+r 0x10012080
+w 0x100120c0
+r 0x10012100
+r 0x10012140
+r 0x10012180
+w 0x100121c0
+r 0x10012200
+r 0x10012240
+r 0x10012280
+w 0x100122c0
+r 0x10012300
+r 0x10012340
+r 0x10012380
+w 0x100123c0
+r 0x10012400
+r 0x10012440
+r 0x10012480
+w 0x100124c0
+r 0x10012500
+r 0x10012540
+r 0x10012580
+w 0x100125c0
+r 0x10012600
+r 0x10012640
+r 0x10012680
+w 0x100126c0
+r 0x10012700
+r 0x10012740
+r 0x10012780
+w 0x100127c0
+r 0x10012800
+r 0x10012840
+r 0x10012880
+w 0x100128c0
+r 0x10012900
+r 0x10012940
+r 0x10012980
+w 0x100129c0
+r 0x10012a00
+r 0x10012a40
+r 0x10012a80
+w 0x10012ac0
+r 0x10012b00
+r 0x10012b40
+r 0x10012b80
+w 0x10012bc0
+r 0x10012c00
+r 0x10012c40
+r 0x10012c80
+w 0x10012cc0
+r 0x10012d00
+r 0x10012d40
+r 0x10012d80
+w 0x10012dc0
+r 0x10012e00
+r 0x10012e40
+r 0x10012e80
+w 0x10012ec0
+r 0x10012f00
+r 0x10012f40
+r 0x10012f80
+w 0x10012fc0
+r 0x10013000
+r 0x10013040
+r 0x10013080
+w 0x100130c0
+r 0x10013100
+r 0x10013140
+r 0x10013180
+w 0x100131c0
+r 0x10013200
+r 0x10013240
+r 0x10013280
+w 0x100132c0
+r 0x10013300
+r 0x10013340
+r 0x10013380
+w 0x100133c0
+r 0x10013400
+r 0x10013440
+r 0x10013480
+w 0x100134c0
+r 0x10013500
+r 0x10013540
+r 0x10013580
+w 0x100135c0
+r 0x10013600
+r 0x10013640
+r 0x10013680
+w 0x100136c0
+r 0x10013700
+r 0x10013740
+r 0x10013780
+w 0x100137c0
+r 0x10013800
+r 0x10013840
+r 0x10013880
+w 0x100138c0
+r 0x10013900
+r 0x10013940
+r 0x10013980
+w 0x100139c0
+r 0x10013a00
+r 0x10013a40
+r 0x10013a80
+w 0x10013ac0
+r 0x10013b00
+r 0x10013b40
+r 0x10013b80
+w 0x10013bc0
+r 0x10013c00
+r 0x10013c40
+r 0x10013c80
+w 0x10013cc0
+r 0x10013d00
+r 0x10013d40
+r 0x10013d80
+w 0x10013dc0
+r 0x10013e00
+r 0x10013e40
+r 0x10013e80
+w 0x10013ec0
+r 0x10013f00
+r 0x10013f40
+r 0x10013f80
+w 0x10013fc0
+r 0x10014000
+r 0x10014040
+r 0x10014080
+w 0x100140c0
+r 0x10014100
+r 0x10014140
+r 0x10014180
+w 0x100141c0
+r 0x10014200
+r 0x10014240
+r 0x10014280
+w 0x100142c0
+r 0x10014300
+r 0x10014340
+r 0x10014380
+w 0x100143c0
+r 0x10014400
+r 0x10014440
+r 0x10014480
+w 0x100144c0
+r 0x10014500
+r 0x10014540
+r 0x10014580
+w 0x100145c0
+r 0x10014600
+r 0x10014640
+r 0x10014680
+w 0x100146c0
+r 0x10014700
+r 0x10014740
+r 0x10014780
+w 0x100147c0
+r 0x10014800
+r 0x10014840
+r 0x10014880
+w 0x100148c0
+r 0x10014900
+r 0x10014940
+r 0x10014980
+w 0x100149c0
+r 0x10014a00
+r 0x10014a40
+r 0x10014a80
+w 0x10014ac0
+r 0x10014b00
+r 0x10014b40
+r 0x10014b80
+w 0x10014bc0
+r 0x10014c00
+r 0x10014c40
+r 0x10014c80
+w 0x10014cc0
+r 0x10014d00
+r 0x10014d40
+r 0x10014d80
+w 0x10014dc0
+r 0x10014e00
+r 0x10014e40
+r 0x10014e80
+w 0x10014ec0
+r 0x10014f00
+r 0x10014f40
+r 0x10014f80
+w 0x10014fc0
+r 0x10015000
+r 0x10015040
+r 0x10015080
+w 0x100150c0
+r 0x10015100
+r 0x10015140
+r 0x10015180
+w 0x100151c0
+r 0x10015200
+r 0x10015240
+r 0x10015280
+w 0x100152c0
+r 0x10015300
+r 0x10015340
+r 0x10015380
+w 0x100153c0
+r 0x10015400
+r 0x10015440
+r 0x10015480
+w 0x100154c0
+r 0x10015500
+r 0x10015540
+r 0x10015580
+w 0x100155c0
+r 0x10015600
+r 0x10015640
+r 0x10015680
+w 0x100156c0
+r 0x10015700
+r 0x10015740
+r 0x10015780
+w 0x100157c0
+r 0x10015800
+r 0x10015840
+r 0x10015880
+w 0x100158c0
+r 0x10015900
+r 0x10015940
+r 0x10015980
+w 0x100159c0
+r 0x10015a00
+r 0x10015a40
+r 0x10015a80
+w 0x10015ac0
+r 0x10015b00
+r 0x10015b40
+r 0x10015b80
+w 0x10015bc0
+r 0x10015c00
+r 0x10015c40
+r 0x10015c80
+w 0x10015cc0
+r 0x10015d00
+r 0x10015d40
+r 0x10015d80
+w 0x10015dc0
+r 0x10015e00
+r 0x10015e40
+r 0x10015e80
+w 0x10015ec0
+r 0x10015f00
+r 0x10015f40
+r 0x10015f80
+w 0x10015fc0
+r 0x10016000
+r 0x10016040
+r 0x10016080
+w 0x100160c0
+r 0x10016100
+r 0x10016140
+r 0x10016180
+w 0x100161c0
+r 0x10016200
+r 0x10016240
+r 0x10016280
+w 0x100162c0
+r 0x10016300
+r 0x10016340
+r 0x10016380
+w 0x100163c0
+r 0x10016400
+r 0x10016440
+r 0x10016480
+w 0x100164c0
+r 0x10016500
+r 0x10016540
+r 0x10016580
+w 0x100165c0
+r 0x10016600
+r 0x10016640
+r 0x10016680
+w 0x100166c0
+r 0x10016700
+r 0x10016740
+r 0x10016780
+w 0x100167c0
+r 0x10016800
+r 0x10016840
+r 0x10016880
+w 0x100168c0
+r 0x10016900
+r 0x10016940
+r 0x10016980
+w 0x100169c0
+r 0x10016a00
+r 0x10016a40
+r 0x10016a80
+w 0x10016ac0
+r 0x10016b00
+r 0x10016b40
+r 0x10016b80
+w 0x10016bc0
+r 0x10016c00
+r 0x10016c40
+r 0x10016c80
+w 0x10016cc0
+r 0x10016d00
+r 0x10016d40
+r 0x10016d80
+w 0x10016dc0
+r 0x10016e00
+r 0x10016e40
+r 0x10016e80
+w 0x10016ec0
+r 0x10016f00
+r 0x10016f40
+r 0x10016f80
+w 0x10016fc0
+r 0x10017000
+r 0x10017040
+r 0x10017080
+w 0x100170c0
+r 0x10017100
+r 0x10017140
+r 0x10017180
+w 0x100171c0
+r 0x10017200
+r 0x10017240
+r 0x10017280
+w 0x100172c0
+r 0x10017300
+r 0x10017340
+r 0x10017380
+w 0x100173c0
+r 0x10017400
+r 0x10017440
+r 0x10017480
+w 0x100174c0
+r 0x10017500
+r 0x10017540
+r 0x10017580
+w 0x100175c0
+r 0x10017600
+r 0x10017640
+r 0x10017680
+w 0x100176c0
+r 0x10017700
+r 0x10017740
+r 0x10017780
+w 0x100177c0
+r 0x10017800
+r 0x10017840
+r 0x10017880
+w 0x100178c0
+r 0x10017900
+r 0x10017940
+r 0x10017980
+w 0x100179c0
+r 0x10017a00
+r 0x10017a40
+r 0x10017a80
+w 0x10017ac0
+r 0x10017b00
+r 0x10017b40
+r 0x10017b80
+w 0x10017bc0
+r 0x10017c00
+r 0x10017c40
+r 0x10017c80
+w 0x10017cc0
+r 0x10017d00
+r 0x10017d40
+r 0x10017d80
+w 0x10017dc0
+r 0x10017e00
+r 0x10017e40
+r 0x10017e80
+w 0x10017ec0
+r 0x10017f00
+r 0x10017f40
+r 0x10017f80
+w 0x10017fc0
+r 0x10018000
+r 0x10018040
+r 0x10018080
+w 0x100180c0
+r 0x10018100
+r 0x10018140
+r 0x10018180
+w 0x100181c0
+r 0x10018200
+r 0x10018240
+r 0x10018280
+w 0x100182c0
+r 0x10018300
+r 0x10018340
+r 0x10018380
+w 0x100183c0
+r 0x10018400
+r 0x10018440
+r 0x10018480
+w 0x100184c0
+r 0x10018500
+r 0x10018540
+r 0x10018580
+w 0x100185c0
+r 0x10018600
+r 0x10018640
+r 0x10018680
+w 0x100186c0
+r 0x10018700
+r 0x10018740
+r 0x10018780
+w 0x100187c0
+r 0x10018800
+r 0x10018840
+r 0x10018880
+w 0x100188c0
+r 0x10018900
+r 0x10018940
+r 0x10018980
+w 0x100189c0
+r 0x10018a00
+r 0x10018a40
+r 0x10018a80
+w 0x10018ac0
+r 0x10018b00
+r 0x10018b40
+r 0x10018b80
+w 0x10018bc0
+r 0x10018c00
+r 0x10018c40
+r 0x10018c80
+w 0x10018cc0
+r 0x10018d00
+r 0x10018d40
+r 0x10018d80
+w 0x10018dc0
+r 0x10018e00
+r 0x10018e40
+r 0x10018e80
+w 0x10018ec0
+r 0x10018f00
+r 0x10018f40
+r 0x10018f80
+w 0x10018fc0
+r 0x10019000
+r 0x10019040
+r 0x10019080
+w 0x100190c0
+r 0x10019100
+r 0x10019140
+r 0x10019180
+w 0x100191c0
+r 0x10019200
+r 0x10019240
+r 0x10019280
+w 0x100192c0
+r 0x10019300
+r 0x10019340
+r 0x10019380
+w 0x100193c0
+r 0x10019400
+r 0x10019440
+r 0x10019480
+w 0x100194c0
+r 0x10019500
+r 0x10019540
+r 0x10019580
+w 0x100195c0
+r 0x10019600
+r 0x10019640
+r 0x10019680
+w 0x100196c0
+r 0x10019700
+r 0x10019740
+r 0x10019780
+w 0x100197c0
+r 0x10019800
+r 0x10019840
+r 0x10019880
+w 0x100198c0
+r 0x10019900
+r 0x10019940
+r 0x10019980
+w 0x100199c0
+r 0x10019a00
+r 0x10019a40
+r 0x10019a80
+w 0x10019ac0
+r 0x10019b00
+r 0x10019b40
+r 0x10019b80
+w 0x10019bc0
+r 0x10019c00
+r 0x10019c40
+r 0x10019c80
+w 0x10019cc0
+r 0x10019d00
+r 0x10019d40
+r 0x10019d80
+w 0x10019dc0
+r 0x10019e00
+r 0x10019e40
+r 0x10019e80
+w 0x10019ec0
+r 0x10019f00
+r 0x10019f40
+r 0x10019f80
+w 0x10019fc0
+r 0x1001a000
+r 0x1001a040
+r 0x1001a080
+w 0x1001a0c0
+r 0x1001a100
+r 0x1001a140
+r 0x1001a180
+w 0x1001a1c0
+r 0x1001a200
+r 0x1001a240
+r 0x1001a280
+w 0x1001a2c0
+r 0x1001a300
+r 0x1001a340
+r 0x1001a380
+w 0x1001a3c0
+r 0x1001a400
+r 0x1001a440
+r 0x1001a480
+w 0x1001a4c0
+r 0x1001a500
+r 0x1001a540
+r 0x1001a580
+w 0x1001a5c0
+r 0x1001a600
+r 0x1001a640
+r 0x1001a680
+w 0x1001a6c0
+r 0x1001a700
+r 0x1001a740
+r 0x1001a780
+w 0x1001a7c0
+r 0x1001a800
+r 0x1001a840
+r 0x1001a880
+w 0x1001a8c0
+r 0x1001a900
+r 0x1001a940
+r 0x1001a980
+w 0x1001a9c0
+r 0x1001aa00
+r 0x1001aa40
+r 0x1001aa80
+w 0x1001aac0
+r 0x1001ab00
+r 0x1001ab40
+r 0x1001ab80
+w 0x1001abc0
+r 0x1001ac00
+r 0x1001ac40
+r 0x1001ac80
+w 0x1001acc0
+r 0x1001ad00
+r 0x1001ad40
+r 0x1001ad80
+w 0x1001adc0
+r 0x1001ae00
+r 0x1001ae40
+r 0x1001ae80
+w 0x1001aec0
+r 0x1001af00
+r 0x1001af40
+r 0x1001af80
+w 0x1001afc0
+r 0x1001b000
+r 0x1001b040
+r 0x1001b080
+w 0x1001b0c0
+r 0x1001b100
+r 0x1001b140
+r 0x1001b180
+w 0x1001b1c0
+r 0x1001b200
+r 0x1001b240
+r 0x1001b280
+w 0x1001b2c0
+r 0x1001b300
+r 0x1001b340
+r 0x1001b380
+w 0x1001b3c0
+r 0x1001b400
+r 0x1001b440
+r 0x1001b480
+w 0x1001b4c0
+r 0x1001b500
+r 0x1001b540
+r 0x1001b580
+w 0x1001b5c0
+r 0x1001b600
+r 0x1001b640
+r 0x1001b680
+w 0x1001b6c0
+r 0x1001b700
+r 0x1001b740
+r 0x1001b780
+w 0x1001b7c0
+r 0x1001b800
+r 0x1001b840
+r 0x1001b880
+w 0x1001b8c0
+r 0x1001b900
+r 0x1001b940
+r 0x1001b980
+w 0x1001b9c0
+r 0x1001ba00
+r 0x1001ba40
+r 0x1001ba80
+w 0x1001bac0
+r 0x1001bb00
+r 0x1001bb40
+r 0x1001bb80
+w 0x1001bbc0
+r 0x1001bc00
+r 0x1001bc40
+r 0x1001bc80
+w 0x1001bcc0
+r 0x1001bd00
+r 0x1001bd40
+r 0x1001bd80
+w 0x1001bdc0
+r 0x1001be00
+r 0x1001be40
+r 0x1001be80
+w 0x1001bec0
+r 0x1001bf00
+r 0x1001bf40
+r 0x1001bf80
+w 0x1001bfc0
+r 0x1001c000
+r 0x1001c040
+r 0x1001c080
+w 0x1001c0c0
+r 0x1001c100
+r 0x1001c140
+r 0x1001c180
+w 0x1001c1c0
+r 0x1001c200
+r 0x1001c240
+r 0x1001c280
+w 0x1001c2c0
+r 0x1001c300
+r 0x1001c340
+r 0x1001c380
+w 0x1001c3c0
+r 0x1001c400
+r 0x1001c440
+r 0x1001c480
+w 0x1001c4c0
+r 0x1001c500
+r 0x1001c540
+r 0x1001c580
+w 0x1001c5c0
+r 0x1001c600
+r 0x1001c640
+r 0x1001c680
+w 0x1001c6c0
+r 0x1001c700
+r 0x1001c740
+r 0x1001c780
+w 0x1001c7c0
+r 0x1001c800
+r 0x1001c840
+r 0x1001c880
+w 0x1001c8c0
+r 0x1001c900
+r 0x1001c940
+r 0x1001c980
+w 0x1001c9c0
+r 0x1001ca00
+r 0x1001ca40
+r 0x1001ca80
+w 0x1001cac0
+r 0x1001cb00
+r 0x1001cb40
+r 0x1001cb80
+w 0x1001cbc0
+r 0x1001cc00
+r 0x1001cc40
+r 0x1001cc80
+w 0x1001ccc0
+r 0x1001cd00
+r 0x1001cd40
+r 0x1001cd80
+w 0x1001cdc0
+r 0x1001ce00
+r 0x1001ce40
+r 0x1001ce80
+w 0x1001cec0
+r 0x1001cf00
+r 0x1001cf40
+r 0x1001cf80
+w 0x1001cfc0
+r 0x1001d000
+r 0x1001d040
+r 0x1001d080
+w 0x1001d0c0
+r 0x1001d100
+r 0x1001d140
+r 0x1001d180
+w 0x1001d1c0
+r 0x1001d200
+r 0x1001d240
+r 0x1001d280
+w 0x1001d2c0
+r 0x1001d300
+r 0x1001d340
+r 0x1001d380
+w 0x1001d3c0
+r 0x1001d400
+r 0x1001d440
+r 0x1001d480
+w 0x1001d4c0
+r 0x1001d500
+r 0x1001d540
+r 0x1001d580
+w 0x1001d5c0
+r 0x1001d600
+r 0x1001d640
+r 0x1001d680
+w 0x1001d6c0
+r 0x1001d700
+r 0x1001d740
+r 0x1001d780
+w 0x1001d7c0
+r 0x1001d800
+r 0x1001d840
+r 0x1001d880
+w 0x1001d8c0
+r 0x1001d900
+r 0x1001d940
+r 0x1001d980
+w 0x1001d9c0
+r 0x1001da00
+r 0x1001da40
+r 0x1001da80
+w 0x1001dac0
+r 0x1001db00
+r 0x1001db40
+r 0x1001db80
+w 0x1001dbc0
+r 0x1001dc00
+r 0x1001dc40
+r 0x1001dc80
+w 0x1001dcc0
+r 0x1001dd00
+r 0x1001dd40
+r 0x1001dd80
+w 0x1001ddc0
+r 0x1001de00
+r 0x1001de40
+r 0x1001de80
+w 0x1001dec0
+r 0x1001df00
+r 0x1001df40
+r 0x1001df80
+w 0x1001dfc0
+r 0x1001e000
+r 0x1001e040
+r 0x1001e080
+w 0x1001e0c0
+r 0x1001e100
+r 0x1001e140
+r 0x1001e180
+w 0x1001e1c0
+r 0x1001e200
+r 0x1001e240
+r 0x1001e280
+w 0x1001e2c0
+r 0x1001e300
+r 0x1001e340
+r 0x1001e380
+w 0x1001e3c0
+r 0x1001e400
+r 0x1001e440
+r 0x1001e480
+w 0x1001e4c0
+r 0x1001e500
+r 0x1001e540
+r 0x1001e580
+w 0x1001e5c0
+r 0x1001e600
+r 0x1001e640
+r 0x1001e680
+w 0x1001e6c0
+r 0x1001e700
+r 0x1001e740
+r 0x1001e780
+w 0x1001e7c0
+r 0x1001e800
+r 0x1001e840
+r 0x1001e880
+w 0x1001e8c0
+r 0x1001e900
+r 0x1001e940
+r 0x1001e980
+w 0x1001e9c0
+r 0x1001ea00
+r 0x1001ea40
+r 0x1001ea80
+w 0x1001eac0
+r 0x1001eb00
+r 0x1001eb40
+r 0x1001eb80
+w 0x1001ebc0
+r 0x1001ec00
+r 0x1001ec40
+r 0x1001ec80
+w 0x1001ecc0
+r 0x1001ed00
+r 0x1001ed40
+r 0x1001ed80
+w 0x1001edc0
+r 0x1001ee00
+r 0x1001ee40
+r 0x1001ee80
+w 0x1001eec0
+r 0x1001ef00
+r 0x1001ef40
+r 0x1001ef80
+w 0x1001efc0
+r 0x1001f000
+r 0x1001f040
+r 0x1001f080
+w 0x1001f0c0
+r 0x1001f100
+r 0x1001f140
+r 0x1001f180
+w 0x1001f1c0
+r 0x1001f200
+r 0x1001f240
+r 0x1001f280
+w 0x1001f2c0
+r 0x1001f300
+r 0x1001f340
+r 0x1001f380
+w 0x1001f3c0
+r 0x1001f400
+r 0x1001f440
+r 0x1001f480
+w 0x1001f4c0
+r 0x1001f500
+r 0x1001f540
+r 0x1001f580
+w 0x1001f5c0
+r 0x1001f600
+r 0x1001f640
+r 0x1001f680
+w 0x1001f6c0
+r 0x1001f700
+r 0x1001f740
+r 0x1001f780
+w 0x1001f7c0
+r 0x1001f800
+r 0x1001f840
+r 0x1001f880
+w 0x1001f8c0
+r 0x1001f900
+r 0x1001f940
+r 0x1001f980
+w 0x1001f9c0
+r 0x1001fa00
+r 0x1001fa40
+r 0x1001fa80
+w 0x1001fac0
+r 0x1001fb00
+r 0x1001fb40
+r 0x1001fb80
+w 0x1001fbc0
+r 0x1001fc00
+r 0x1001fc40
+r 0x1001fc80
+w 0x1001fcc0
+r 0x1001fd00
+r 0x1001fd40
+r 0x1001fd80
+w 0x1001fdc0
+r 0x1001fe00
+r 0x1001fe40
+r 0x1001fe80
+w 0x1001fec0
+r 0x1001ff00
+r 0x1001ff40
+r 0x1001ff80
+w 0x1001ffc0
+r 0x10020000
+r 0x10020040
+r 0x10020080
+w 0x100200c0
+r 0x10020100
+r 0x10020140
+r 0x10020180
+w 0x100201c0
+r 0x10020200
+r 0x10020240
+r 0x10020280
+w 0x100202c0
+r 0x10020300
+r 0x10020340
+r 0x10020380
+w 0x100203c0
+r 0x10020400
+r 0x10020440
+r 0x10020480
+w 0x100204c0
+r 0x10020500
+r 0x10020540
+r 0x10020580
+w 0x100205c0
+r 0x10020600
+r 0x10020640
+r 0x10020680
+w 0x100206c0
+r 0x10020700
+r 0x10020740
+r 0x10020780
+w 0x100207c0
+r 0x10020800
+r 0x10020840
+r 0x10020880
+w 0x100208c0
+r 0x10020900
+r 0x10020940
+r 0x10020980
+w 0x100209c0
+r 0x10020a00
+r 0x10020a40
+r 0x10020a80
+w 0x10020ac0
+r 0x10020b00
+r 0x10020b40
+r 0x10020b80
+w 0x10020bc0
+r 0x10020c00
+r 0x10020c40
+r 0x10020c80
+w 0x10020cc0
+r 0x10020d00
+r 0x10020d40
+r 0x10020d80
+w 0x10020dc0
+r 0x10020e00
+r 0x10020e40
+r 0x10020e80
+w 0x10020ec0
+r 0x10020f00
+r 0x10020f40
+r 0x10020f80
+w 0x10020fc0
+r 0x10021000
+r 0x10021040
+r 0x10021080
+w 0x100210c0
+r 0x10021100
+r 0x10021140
+r 0x10021180
+w 0x100211c0
+r 0x10021200
+r 0x10021240
+r 0x10021280
+w 0x100212c0
+r 0x10021300
+r 0x10021340
+r 0x10021380
+w 0x100213c0
+r 0x10021400
+r 0x10021440
+r 0x10021480
+w 0x100214c0
+r 0x10021500
+r 0x10021540
+r 0x10021580
+w 0x100215c0
+r 0x10021600
+r 0x10021640
+r 0x10021680
+w 0x100216c0
+r 0x10021700
+r 0x10021740
+r 0x10021780
+w 0x100217c0
+r 0x10021800
+r 0x10021840
+r 0x10021880
+w 0x100218c0
+r 0x10021900
+r 0x10021940
+r 0x10021980
+w 0x100219c0
+r 0x10021a00
+r 0x10021a40
+r 0x10021a80
+w 0x10021ac0
+r 0x10021b00
+r 0x10021b40
+r 0x10021b80
+w 0x10021bc0
+r 0x10021c00
+r 0x10021c40
+r 0x10021c80
+w 0x10021cc0
+r 0x10021d00
+r 0x10021d40
+r 0x10021d80
+w 0x10021dc0
+r 0x10021e00
+r 0x10021e40
+r 0x10021e80
+w 0x10021ec0
+r 0x10021f00
+r 0x10021f40
+r 0x10021f80
+w 0x10021fc0
+r 0x10022000
+r 0x10022040
+r 0x10022080
+w 0x100220c0
+r 0x10022100
+r 0x10022140
+r 0x10022180
+w 0x100221c0
+r 0x10022200
+r 0x10022240
+r 0x10022280
+w 0x100222c0
+r 0x10022300
+r 0x10022340
+r 0x10022380
+w 0x100223c0
+r 0x10022400
+r 0x10022440
+r 0x10022480
+w 0x100224c0
+r 0x10022500
+r 0x10022540
+r 0x10022580
+w 0x100225c0
+r 0x10022600
+r 0x10022640
+r 0x10022680
+w 0x100226c0
+r 0x10022700
+r 0x10022740
+r 0x10022780
+w 0x100227c0
+r 0x10022800
+r 0x10022840
+r 0x10022880
+w 0x100228c0
+r 0x10022900
+r 0x10022940
+r 0x10022980
+w 0x100229c0
+r 0x10022a00
+r 0x10022a40
+r 0x10022a80
+w 0x10022ac0
+r 0x10022b00
+r 0x10022b40
+r 0x10022b80
+w 0x10022bc0
+r 0x10022c00
+r 0x10022c40
+r 0x10022c80
+w 0x10022cc0
+r 0x10022d00
+r 0x10022d40
+r 0x10022d80
+w 0x10022dc0
+r 0x10022e00
+r 0x10022e40
+r 0x10022e80
+w 0x10022ec0
+r 0x10022f00
+r 0x10022f40
+r 0x10022f80
+w 0x10022fc0
+r 0x10023000
+r 0x10023040
+r 0x10023080
+w 0x100230c0
+r 0x10023100
+r 0x10023140
+r 0x10023180
+w 0x100231c0
+r 0x10023200
+r 0x10023240
+r 0x10023280
+w 0x100232c0
+r 0x10023300
+r 0x10023340
+r 0x10023380
+w 0x100233c0
+r 0x10023400
+r 0x10023440
+r 0x10023480
+w 0x100234c0
+r 0x10023500
+r 0x10023540
+r 0x10023580
+w 0x100235c0
+r 0x10023600
+r 0x10023640
+r 0x10023680
+w 0x100236c0
+r 0x10023700
+r 0x10023740
+r 0x10023780
+w 0x100237c0
+r 0x10023800
+r 0x10023840
+r 0x10023880
+w 0x100238c0
+r 0x10023900
+r 0x10023940
+r 0x10023980
+w 0x100239c0
+r 0x10023a00
+r 0x10023a40
+r 0x10023a80
+w 0x10023ac0
+r 0x10023b00
+r 0x10023b40
+r 0x10023b80
+w 0x10023bc0
+r 0x10023c00
+r 0x10023c40
+r 0x10023c80
+w 0x10023cc0
+r 0x10023d00
+r 0x10023d40
+r 0x10023d80
+w 0x10023dc0
+r 0x10023e00
+r 0x10023e40
+r 0x10023e80
+w 0x10023ec0
+r 0x10023f00
+r 0x10023f40
+r 0x10023f80
+w 0x10023fc0
+r 0x10024000
+r 0x10024040
+r 0x10024080
+w 0x100240c0
+r 0x10024100
+r 0x10024140
+r 0x10024180
+w 0x100241c0
+r 0x10024200
+r 0x10024240
+r 0x10024280
+w 0x100242c0
+r 0x10024300
+r 0x10024340
+r 0x10024380
+w 0x100243c0
+r 0x10024400
+r 0x10024440
+r 0x10024480
+w 0x100244c0
+r 0x10024500
+r 0x10024540
+r 0x10024580
+w 0x100245c0
+r 0x10024600
+r 0x10024640
+r 0x10024680
+w 0x100246c0
+r 0x10024700
+r 0x10024740
+r 0x10024780
+w 0x100247c0
+r 0x10024800
+r 0x10024840
+r 0x10024880
+w 0x100248c0
+r 0x10024900
+r 0x10024940
+r 0x10024980
+w 0x100249c0
+r 0x10024a00
+r 0x10024a40
+r 0x10024a80
+w 0x10024ac0
+r 0x10024b00
+r 0x10024b40
+r 0x10024b80
+w 0x10024bc0
+r 0x10024c00
+r 0x10024c40
+r 0x10024c80
+w 0x10024cc0
+r 0x10024d00
+r 0x10024d40
+r 0x10024d80
+w 0x10024dc0
+r 0x10024e00
+r 0x10024e40
+r 0x10024e80
+w 0x10024ec0
+r 0x10024f00
+r 0x10024f40
+r 0x10024f80
+w 0x10024fc0
+r 0x10025000
+r 0x10025040
+r 0x10025080
+w 0x100250c0
+r 0x10025100
+r 0x10025140
+r 0x10025180
+w 0x100251c0
+r 0x10025200
+r 0x10025240
+r 0x10025280
+w 0x100252c0
+r 0x10025300
+r 0x10025340
+r 0x10025380
+w 0x100253c0
+r 0x10025400
+r 0x10025440
+r 0x10025480
+w 0x100254c0
+r 0x10025500
+r 0x10025540
+r 0x10025580
+w 0x100255c0
+r 0x10025600
+r 0x10025640
+r 0x10025680
+w 0x100256c0
+r 0x10025700
+r 0x10025740
+r 0x10025780
+w 0x100257c0
+r 0x10025800
+r 0x10025840
+r 0x10025880
+w 0x100258c0
+r 0x10025900
+r 0x10025940
+r 0x10025980
+w 0x100259c0
+r 0x10025a00
+r 0x10025a40
+r 0x10025a80
+w 0x10025ac0
+r 0x10025b00
+r 0x10025b40
+r 0x10025b80
+w 0x10025bc0
+r 0x10025c00
+r 0x10025c40
+r 0x10025c80
+w 0x10025cc0
+r 0x10025d00
+r 0x10025d40
+r 0x10025d80
+w 0x10025dc0
+r 0x10025e00
+r 0x10025e40
+r 0x10025e80
+w 0x10025ec0
+r 0x10025f00
+r 0x10025f40
+r 0x10025f80
+w 0x10025fc0
+r 0x10026000
+r 0x10026040
+r 0x10026080
+w 0x100260c0
+r 0x10026100
+r 0x10026140
+r 0x10026180
+w 0x100261c0
+r 0x10026200
+r 0x10026240
+r 0x10026280
+w 0x100262c0
+r 0x10026300
+r 0x10026340
+r 0x10026380
+w 0x100263c0
+r 0x10026400
+r 0x10026440
+r 0x10026480
+w 0x100264c0
+r 0x10026500
+r 0x10026540
+r 0x10026580
+w 0x100265c0
+r 0x10026600
+r 0x10026640
+r 0x10026680
+w 0x100266c0
+r 0x10026700
+r 0x10026740
+r 0x10026780
+w 0x100267c0
+r 0x10026800
+r 0x10026840
+r 0x10026880
+w 0x100268c0
+r 0x10026900
+r 0x10026940
+r 0x10026980
+w 0x100269c0
+r 0x10026a00
+r 0x10026a40
+r 0x10026a80
+w 0x10026ac0
+r 0x10026b00
+r 0x10026b40
+r 0x10026b80
+w 0x10026bc0
+r 0x10026c00
+r 0x10026c40
+r 0x10026c80
+w 0x10026cc0
+r 0x10026d00
+r 0x10026d40
+r 0x10026d80
+w 0x10026dc0
+r 0x10026e00
+r 0x10026e40
+r 0x10026e80
+w 0x10026ec0
+r 0x10026f00
+r 0x10026f40
+r 0x10026f80
+w 0x10026fc0
+r 0x10027000
+r 0x10027040
+r 0x10027080
+w 0x100270c0
+r 0x10027100
+r 0x10027140
+r 0x10027180
+w 0x100271c0
+r 0x10027200
+r 0x10027240
+r 0x10027280
+w 0x100272c0
+r 0x10027300
+r 0x10027340
+r 0x10027380
+w 0x100273c0
+r 0x10027400
+r 0x10027440
+r 0x10027480
+w 0x100274c0
+r 0x10027500
+r 0x10027540
+r 0x10027580
+w 0x100275c0
+r 0x10027600
+r 0x10027640
+r 0x10027680
+w 0x100276c0
+r 0x10027700
+r 0x10027740
+r 0x10027780
+w 0x100277c0
+r 0x10027800
+r 0x10027840
+r 0x10027880
+w 0x100278c0
+r 0x10027900
+r 0x10027940
+r 0x10027980
+w 0x100279c0
+r 0x10027a00
+r 0x10027a40
+r 0x10027a80
+w 0x10027ac0
+r 0x10027b00
+r 0x10027b40
+r 0x10027b80
+w 0x10027bc0
+r 0x10027c00
+r 0x10027c40
+r 0x10027c80
+w 0x10027cc0
+r 0x10027d00
+r 0x10027d40
+r 0x10027d80
+w 0x10027dc0
+r 0x10027e00
+r 0x10027e40
+r 0x10027e80
+w 0x10027ec0
+r 0x10027f00
+r 0x10027f40
+r 0x10027f80
+w 0x10027fc0
+r 0x10028000
+r 0x10028040
+r 0x10028080
+w 0x100280c0
+r 0x10028100
+r 0x10028140
+r 0x10028180
+w 0x100281c0
+r 0x10028200
+r 0x10028240
+r 0x10028280
+w 0x100282c0
+r 0x10028300
+r 0x10028340
+r 0x10028380
+w 0x100283c0
+r 0x10028400
+r 0x10028440
+r 0x10028480
+w 0x100284c0
+r 0x10028500
+r 0x10028540
+r 0x10028580
+w 0x100285c0
+r 0x10028600
+r 0x10028640
+r 0x10028680
+w 0x100286c0
+r 0x10028700
+r 0x10028740
+r 0x10028780
+w 0x100287c0
+r 0x10028800
+r 0x10028840
+r 0x10028880
+w 0x100288c0
+r 0x10028900
+r 0x10028940
+r 0x10028980
+w 0x100289c0
+r 0x10028a00
+r 0x10028a40
+r 0x10028a80
+w 0x10028ac0
+r 0x10028b00
+r 0x10028b40
+r 0x10028b80
+w 0x10028bc0
+r 0x10028c00
+r 0x10028c40
+r 0x10028c80
+w 0x10028cc0
+r 0x10028d00
+r 0x10028d40
+r 0x10028d80
+w 0x10028dc0
+r 0x10028e00
+r 0x10028e40
+r 0x10028e80
+w 0x10028ec0
+r 0x10028f00
+r 0x10028f40
+r 0x10028f80
+w 0x10028fc0
+r 0x10029000
+r 0x10029040
+r 0x10029080
+w 0x100290c0
+r 0x10029100
+r 0x10029140
+r 0x10029180
+w 0x100291c0
+r 0x10029200
+r 0x10029240
+r 0x10029280
+w 0x100292c0
+r 0x10029300
+r 0x10029340
+r 0x10029380
+w 0x100293c0
+r 0x10029400
+r 0x10029440
+r 0x10029480
+w 0x100294c0
+r 0x10029500
+r 0x10029540
+r 0x10029580
+w 0x100295c0
+r 0x10029600
+r 0x10029640
+r 0x10029680
+w 0x100296c0
+r 0x10029700
+r 0x10029740
+r 0x10029780
+w 0x100297c0
+r 0x10029800
+r 0x10029840
+r 0x10029880
+w 0x100298c0
+r 0x10029900
+r 0x10029940
+r 0x10029980
+w 0x100299c0
+r 0x10029a00
+r 0x10029a40
+r 0x10029a80
+w 0x10029ac0
+r 0x10029b00
+r 0x10029b40
+r 0x10029b80
+w 0x10029bc0
+r 0x10029c00
+r 0x10029c40
+r 0x10029c80
+w 0x10029cc0
+r 0x10029d00
+r 0x10029d40
+r 0x10029d80
+w 0x10029dc0
+r 0x10029e00
+r 0x10029e40
+r 0x10029e80
+w 0x10029ec0
+r 0x10029f00
+r 0x10029f40
+r 0x10029f80
+w 0x10029fc0
+r 0x1002a000
+r 0x1002a040
+r 0x1002a080
+w 0x1002a0c0
+r 0x1002a100
+r 0x1002a140
+r 0x1002a180
+w 0x1002a1c0
+r 0x1002a200
+r 0x1002a240
+r 0x1002a280
+w 0x1002a2c0
+r 0x1002a300
+r 0x1002a340
+r 0x1002a380
+w 0x1002a3c0
+r 0x1002a400
+r 0x1002a440
+r 0x1002a480
+w 0x1002a4c0
+r 0x1002a500
+r 0x1002a540
+r 0x1002a580
+w 0x1002a5c0
+r 0x1002a600
+r 0x1002a640
+r 0x1002a680
+w 0x1002a6c0
+r 0x1002a700
+r 0x1002a740
+r 0x1002a780
+w 0x1002a7c0
+r 0x1002a800
+r 0x1002a840
+r 0x1002a880
+w 0x1002a8c0
+r 0x1002a900
+r 0x1002a940
+r 0x1002a980
+w 0x1002a9c0
+r 0x1002aa00
+r 0x1002aa40
+r 0x1002aa80
+w 0x1002aac0
+r 0x1002ab00
+r 0x1002ab40
+r 0x1002ab80
+w 0x1002abc0
+r 0x1002ac00
+r 0x1002ac40
+r 0x1002ac80
+w 0x1002acc0
+r 0x1002ad00
+r 0x1002ad40
+r 0x1002ad80
+w 0x1002adc0
+r 0x1002ae00
+r 0x1002ae40
+r 0x1002ae80
+w 0x1002aec0
+r 0x1002af00
+r 0x1002af40
+r 0x1002af80
+w 0x1002afc0
+r 0x1002b000
+r 0x1002b040
+r 0x1002b080
+w 0x1002b0c0
+r 0x1002b100
+r 0x1002b140
+r 0x1002b180
+w 0x1002b1c0
+r 0x1002b200
+r 0x1002b240
+r 0x1002b280
+w 0x1002b2c0
+r 0x1002b300
+r 0x1002b340
+r 0x1002b380
+w 0x1002b3c0
+r 0x1002b400
+r 0x1002b440
+r 0x1002b480
+w 0x1002b4c0
+r 0x1002b500
+r 0x1002b540
+r 0x1002b580
+w 0x1002b5c0
+r 0x1002b600
+r 0x1002b640
+r 0x1002b680
+w 0x1002b6c0
+r 0x1002b700
+r 0x1002b740
+r 0x1002b780
+w 0x1002b7c0
+r 0x1002b800
+r 0x1002b840
+r 0x1002b880
+w 0x1002b8c0
+r 0x1002b900
+r 0x1002b940
+r 0x1002b980
+w 0x1002b9c0
+r 0x1002ba00
+r 0x1002ba40
+r 0x1002ba80
+w 0x1002bac0
+r 0x1002bb00
+r 0x1002bb40
+r 0x1002bb80
+w 0x1002bbc0
+r 0x1002bc00
+r 0x1002bc40
+r 0x1002bc80
+w 0x1002bcc0
+r 0x1002bd00
+r 0x1002bd40
+r 0x1002bd80
+w 0x1002bdc0
+r 0x1002be00
+r 0x1002be40
+r 0x1002be80
+w 0x1002bec0
+r 0x1002bf00
+r 0x1002bf40
+r 0x1002bf80
+w 0x1002bfc0
+r 0x1002c000
+r 0x1002c040
+r 0x1002c080
+w 0x1002c0c0
+r 0x1002c100
+r 0x1002c140
+r 0x1002c180
+w 0x1002c1c0
+r 0x1002c200
+r 0x1002c240
+r 0x1002c280
+w 0x1002c2c0
+r 0x1002c300
+r 0x1002c340
+r 0x1002c380
+w 0x1002c3c0
+r 0x1002c400
+r 0x1002c440
+r 0x1002c480
+w 0x1002c4c0
+r 0x1002c500
+r 0x1002c540
+r 0x1002c580
+w 0x1002c5c0
+r 0x1002c600
+r 0x1002c640
+r 0x1002c680
+w 0x1002c6c0
+r 0x1002c700
+r 0x1002c740
+r 0x1002c780
+w 0x1002c7c0
+r 0x1002c800
+r 0x1002c840
+r 0x1002c880
+w 0x1002c8c0
+r 0x1002c900
+r 0x1002c940
+r 0x1002c980
+w 0x1002c9c0
+r 0x1002ca00
+r 0x1002ca40
+r 0x1002ca80
+w 0x1002cac0
+r 0x1002cb00
+r 0x1002cb40
+r 0x1002cb80
+w 0x1002cbc0
+r 0x1002cc00
+r 0x1002cc40
+r 0x1002cc80
+w 0x1002ccc0
+r 0x1002cd00
+r 0x1002cd40
+r 0x1002cd80
+w 0x1002cdc0
+r 0x1002ce00
+r 0x1002ce40
+r 0x1002ce80
+w 0x1002cec0
+r 0x1002cf00
+r 0x1002cf40
+r 0x1002cf80
+w 0x1002cfc0
+r 0x1002d000
+r 0x1002d040
+r 0x1002d080
+w 0x1002d0c0
+r 0x1002d100
+r 0x1002d140
+r 0x1002d180
+w 0x1002d1c0
+r 0x1002d200
+r 0x1002d240
+r 0x1002d280
+w 0x1002d2c0
+r 0x1002d300
+r 0x1002d340
+r 0x1002d380
+w 0x1002d3c0
+r 0x1002d400
+r 0x1002d440
+r 0x1002d480
+w 0x1002d4c0
+r 0x1002d500
+r 0x1002d540
+r 0x1002d580
+w 0x1002d5c0
+r 0x1002d600
+r 0x1002d640
+r 0x1002d680
+w 0x1002d6c0
+r 0x1002d700
+r 0x1002d740
+r 0x1002d780
+w 0x1002d7c0
+r 0x1002d800
+r 0x1002d840
+r 0x1002d880
+w 0x1002d8c0
+r 0x1002d900
+r 0x1002d940
+r 0x1002d980
+w 0x1002d9c0
+r 0x1002da00
+r 0x1002da40
+r 0x1002da80
+w 0x1002dac0
+r 0x1002db00
+r 0x1002db40
+r 0x1002db80
+w 0x1002dbc0
+r 0x1002dc00
+r 0x1002dc40
+r 0x1002dc80
+w 0x1002dcc0
+r 0x1002dd00
+r 0x1002dd40
+r 0x1002dd80
+w 0x1002ddc0
+r 0x1002de00
+r 0x1002de40
+r 0x1002de80
+w 0x1002dec0
+r 0x1002df00
+r 0x1002df40
+r 0x1002df80
+w 0x1002dfc0
+r 0x1002e000
+r 0x1002e040
+r 0x1002e080
+w 0x1002e0c0
+r 0x1002e100
+r 0x1002e140
+r 0x1002e180
+w 0x1002e1c0
+r 0x1002e200
+r 0x1002e240
+r 0x1002e280
+w 0x1002e2c0
+r 0x1002e300
+r 0x1002e340
+r 0x1002e380
+w 0x1002e3c0
+r 0x1002e400
+r 0x1002e440
+r 0x1002e480
+w 0x1002e4c0
+r 0x1002e500
+r 0x1002e540
+r 0x1002e580
+w 0x1002e5c0
+r 0x1002e600
+r 0x1002e640
+r 0x1002e680
+w 0x1002e6c0
+r 0x1002e700
+r 0x1002e740
+r 0x1002e780
+w 0x1002e7c0
+r 0x1002e800
+r 0x1002e840
+r 0x1002e880
+w 0x1002e8c0
+r 0x1002e900
+r 0x1002e940
+r 0x1002e980
+w 0x1002e9c0
+r 0x1002ea00
+r 0x1002ea40
+r 0x1002ea80
+w 0x1002eac0
+r 0x1002eb00
+r 0x1002eb40
+r 0x1002eb80
+w 0x1002ebc0
+r 0x1002ec00
+r 0x1002ec40
+r 0x1002ec80
+w 0x1002ecc0
+r 0x1002ed00
+r 0x1002ed40
+r 0x1002ed80
+w 0x1002edc0
+r 0x1002ee00
+r 0x1002ee40
+r 0x1002ee80
+w 0x1002eec0
+r 0x1002ef00
+r 0x1002ef40
+r 0x1002ef80
+w 0x1002efc0
+r 0x1002f000
+r 0x1002f040
+r 0x1002f080
+w 0x1002f0c0
+r 0x1002f100
+r 0x1002f140
+r 0x1002f180
+w 0x1002f1c0
+r 0x1002f200
+r 0x1002f240
+r 0x1002f280
+w 0x1002f2c0
+r 0x1002f300
+r 0x1002f340
+r 0x1002f380
+w 0x1002f3c0
+r 0x1002f400
+r 0x1002f440
+r 0x1002f480
+w 0x1002f4c0
+r 0x1002f500
+r 0x1002f540
+r 0x1002f580
+w 0x1002f5c0
+r 0x1002f600
+r 0x1002f640
+r 0x1002f680
+w 0x1002f6c0
+r 0x1002f700
+r 0x1002f740
+r 0x1002f780
+w 0x1002f7c0
+r 0x1002f800
+r 0x1002f840
+r 0x1002f880
+w 0x1002f8c0
+r 0x1002f900
+r 0x1002f940
+r 0x1002f980
+w 0x1002f9c0
+r 0x1002fa00
+r 0x1002fa40
+r 0x1002fa80
+w 0x1002fac0
+r 0x1002fb00
+r 0x1002fb40
+r 0x1002fb80
+w 0x1002fbc0
+r 0x1002fc00
+r 0x1002fc40
+r 0x1002fc80
+w 0x1002fcc0
+r 0x1002fd00
+r 0x1002fd40
+r 0x1002fd80
+w 0x1002fdc0
+r 0x1002fe00
+r 0x1002fe40
+r 0x1002fe80
+w 0x1002fec0
+r 0x1002ff00
+r 0x1002ff40
+r 0x1002ff80
+w 0x1002ffc0
+r 0x10030000
+r 0x10030040
+r 0x10030080
+w 0x100300c0
+r 0x10030100
+r 0x10030140
+r 0x10030180
+w 0x100301c0
+r 0x10030200
+r 0x10030240
+r 0x10030280
+w 0x100302c0
+r 0x10030300
+r 0x10030340
+r 0x10030380
+w 0x100303c0
+r 0x10030400
+r 0x10030440
+r 0x10030480
+w 0x100304c0
+r 0x10030500
+r 0x10030540
+r 0x10030580
+w 0x100305c0
+r 0x10030600
+r 0x10030640
+r 0x10030680
+w 0x100306c0
+r 0x10030700
+r 0x10030740
+r 0x10030780
+w 0x100307c0
+r 0x10030800
+r 0x10030840
+r 0x10030880
+w 0x100308c0
+r 0x10030900
+r 0x10030940
+r 0x10030980
+w 0x100309c0
+r 0x10030a00
+r 0x10030a40
+r 0x10030a80
+w 0x10030ac0
+r 0x10030b00
+r 0x10030b40
+r 0x10030b80
+w 0x10030bc0
+r 0x10030c00
+r 0x10030c40
+r 0x10030c80
+w 0x10030cc0
+r 0x10030d00
+r 0x10030d40
+r 0x10030d80
+w 0x10030dc0
+r 0x10030e00
+r 0x10030e40
+r 0x10030e80
+w 0x10030ec0
+r 0x10030f00
+r 0x10030f40
+r 0x10030f80
+w 0x10030fc0
+r 0x10031000
+r 0x10031040
+r 0x10031080
+w 0x100310c0
+r 0x10031100
+r 0x10031140
+r 0x10031180
+w 0x100311c0
+r 0x10031200
+r 0x10031240
+r 0x10031280
+w 0x100312c0
+r 0x10031300
+r 0x10031340
+r 0x10031380
+w 0x100313c0
+r 0x10031400
+r 0x10031440
+r 0x10031480
+w 0x100314c0
+r 0x10031500
+r 0x10031540
+r 0x10031580
+w 0x100315c0
+r 0x10031600
+r 0x10031640
+r 0x10031680
+w 0x100316c0
+r 0x10031700
+r 0x10031740
+r 0x10031780
+w 0x100317c0
+r 0x10031800
+r 0x10031840
+r 0x10031880
+w 0x100318c0
+r 0x10031900
+r 0x10031940
+r 0x10031980
+w 0x100319c0
+r 0x10031a00
+r 0x10031a40
+r 0x10031a80
+w 0x10031ac0
+r 0x10031b00
+r 0x10031b40
+r 0x10031b80
+w 0x10031bc0
+r 0x10031c00
+r 0x10031c40
+r 0x10031c80
+w 0x10031cc0
+r 0x10031d00
+r 0x10031d40
+r 0x10031d80
+w 0x10031dc0
+r 0x10031e00
+r 0x10031e40
+r 0x10031e80
+w 0x10031ec0
+r 0x10031f00
+r 0x10031f40
+r 0x10031f80
+w 0x10031fc0
+r 0x10032000
+r 0x10032040
+r 0x10032080
+w 0x100320c0
+r 0x10032100
+r 0x10032140
+r 0x10032180
+w 0x100321c0
+r 0x10032200
+r 0x10032240
+r 0x10032280
+w 0x100322c0
+r 0x10032300
+r 0x10032340
+r 0x10032380
+w 0x100323c0
+r 0x10032400
+r 0x10032440
+r 0x10032480
+w 0x100324c0
+r 0x10032500
+r 0x10032540
+r 0x10032580
+w 0x100325c0
+r 0x10032600
+r 0x10032640
+r 0x10032680
+w 0x100326c0
+r 0x10032700
+r 0x10032740
+r 0x10032780
+w 0x100327c0
+r 0x10032800
+r 0x10032840
+r 0x10032880
+w 0x100328c0
+r 0x10032900
+r 0x10032940
+r 0x10032980
+w 0x100329c0
+r 0x10032a00
+r 0x10032a40
+r 0x10032a80
+w 0x10032ac0
+r 0x10032b00
+r 0x10032b40
+r 0x10032b80
+w 0x10032bc0
+r 0x10032c00
+r 0x10032c40
+r 0x10032c80
+w 0x10032cc0
+r 0x10032d00
+r 0x10032d40
+r 0x10032d80
+w 0x10032dc0
+r 0x10032e00
+r 0x10032e40
+r 0x10032e80
+w 0x10032ec0
+r 0x10032f00
+r 0x10032f40
+r 0x10032f80
+w 0x10032fc0
+r 0x10033000
+r 0x10033040
+r 0x10033080
+w 0x100330c0
+r 0x10033100
+r 0x10033140
+r 0x10033180
+w 0x100331c0
+r 0x10033200
+r 0x10033240
+r 0x10033280
+w 0x100332c0
+r 0x10033300
+r 0x10033340
+r 0x10033380
+w 0x100333c0
+r 0x10033400
+r 0x10033440
+r 0x10033480
+w 0x100334c0
+r 0x10033500
+r 0x10033540
+r 0x10033580
+w 0x100335c0
+r 0x10033600
+r 0x10033640
+r 0x10033680
+w 0x100336c0
+r 0x10033700
+r 0x10033740
+r 0x10033780
+w 0x100337c0
+r 0x10033800
+r 0x10033840
+r 0x10033880
+w 0x100338c0
+r 0x10033900
+r 0x10033940
+r 0x10033980
+w 0x100339c0
+r 0x10033a00
+r 0x10033a40
+r 0x10033a80
+w 0x10033ac0
+r 0x10033b00
+r 0x10033b40
+r 0x10033b80
+w 0x10033bc0
+r 0x10033c00
+r 0x10033c40
+r 0x10033c80
+w 0x10033cc0
+r 0x10033d00
+r 0x10033d40
+r 0x10033d80
+w 0x10033dc0
+r 0x10033e00
+r 0x10033e40
+r 0x10033e80
+w 0x10033ec0
+r 0x10033f00
+r 0x10033f40
+r 0x10033f80
+w 0x10033fc0
+r 0x10034000
+r 0x10034040
+r 0x10034080
+w 0x100340c0
+r 0x10034100
+r 0x10034140
+r 0x10034180
+w 0x100341c0
+r 0x10034200
+r 0x10034240
+r 0x10034280
+w 0x100342c0
+r 0x10034300
+r 0x10034340
+r 0x10034380
+w 0x100343c0
+r 0x10034400
+r 0x10034440
+r 0x10034480
+w 0x100344c0
+r 0x10034500
+r 0x10034540
+r 0x10034580
+w 0x100345c0
+r 0x10034600
+r 0x10034640
+r 0x10034680
+w 0x100346c0
+r 0x10034700
+r 0x10034740
+r 0x10034780
+w 0x100347c0
+r 0x10034800
+r 0x10034840
+r 0x10034880
+w 0x100348c0
+r 0x10034900
+r 0x10034940
+r 0x10034980
+w 0x100349c0
+r 0x10034a00
+r 0x10034a40
+r 0x10034a80
+w 0x10034ac0
+r 0x10034b00
+r 0x10034b40
+r 0x10034b80
+w 0x10034bc0
+r 0x10034c00
+r 0x10034c40
+r 0x10034c80
+w 0x10034cc0
+r 0x10034d00
+r 0x10034d40
+r 0x10034d80
+w 0x10034dc0
+r 0x10034e00
+r 0x10034e40
+r 0x10034e80
+w 0x10034ec0
+r 0x10034f00
+r 0x10034f40
+r 0x10034f80
+w 0x10034fc0
+r 0x10035000
+r 0x10035040
+r 0x10035080
+w 0x100350c0
+r 0x10035100
+r 0x10035140
+r 0x10035180
+w 0x100351c0
+r 0x10035200
+r 0x10035240
+r 0x10035280
+w 0x100352c0
+r 0x10035300
+r 0x10035340
+r 0x10035380
+w 0x100353c0
+r 0x10035400
+r 0x10035440
+r 0x10035480
+w 0x100354c0
+r 0x10035500
+r 0x10035540
+r 0x10035580
+w 0x100355c0
+r 0x10035600
+r 0x10035640
+r 0x10035680
+w 0x100356c0
+r 0x10035700
+r 0x10035740
+r 0x10035780
+w 0x100357c0
+r 0x10035800
+r 0x10035840
+r 0x10035880
+w 0x100358c0
+r 0x10035900
+r 0x10035940
+r 0x10035980
+w 0x100359c0
+r 0x10035a00
+r 0x10035a40
+r 0x10035a80
+w 0x10035ac0
+r 0x10035b00
+r 0x10035b40
+r 0x10035b80
+w 0x10035bc0
+r 0x10035c00
+r 0x10035c40
+r 0x10035c80
+w 0x10035cc0
+r 0x10035d00
+r 0x10035d40
+r 0x10035d80
+w 0x10035dc0
+r 0x10035e00
+r 0x10035e40
+r 0x10035e80
+w 0x10035ec0
+r 0x10035f00
+r 0x10035f40
+r 0x10035f80
+w 0x10035fc0
+r 0x10036000
+r 0x10036040
+r 0x10036080
+w 0x100360c0
+r 0x10036100
+r 0x10036140
+r 0x10036180
+w 0x100361c0
+r 0x10036200
+r 0x10036240
+r 0x10036280
+w 0x100362c0
+r 0x10036300
+r 0x10036340
+r 0x10036380
+w 0x100363c0
+r 0x10036400
+r 0x10036440
+r 0x10036480
+w 0x100364c0
+r 0x10036500
+r 0x10036540
+r 0x10036580
+w 0x100365c0
+r 0x10036600
+r 0x10036640
+r 0x10036680
+w 0x100366c0
+r 0x10036700
+r 0x10036740
+r 0x10036780
+w 0x100367c0
+r 0x10036800
+r 0x10036840
+r 0x10036880
+w 0x100368c0
+r 0x10036900
+r 0x10036940
+r 0x10036980
+w 0x100369c0
+r 0x10036a00
+r 0x10036a40
+r 0x10036a80
+w 0x10036ac0
+r 0x10036b00
+r 0x10036b40
+r 0x10036b80
+w 0x10036bc0
+r 0x10036c00
+r 0x10036c40
+r 0x10036c80
+w 0x10036cc0
+r 0x10036d00
+r 0x10036d40
+r 0x10036d80
+w 0x10036dc0
+r 0x10036e00
+r 0x10036e40
+r 0x10036e80
+w 0x10036ec0
+r 0x10036f00
+r 0x10036f40
+r 0x10036f80
+w 0x10036fc0
+r 0x10037000
+r 0x10037040
+r 0x10037080
+w 0x100370c0
+r 0x10037100
+r 0x10037140
+r 0x10037180
+w 0x100371c0
+r 0x10037200
+r 0x10037240
+r 0x10037280
+w 0x100372c0
+r 0x10037300
+r 0x10037340
+r 0x10037380
+w 0x100373c0
+r 0x10037400
+r 0x10037440
+r 0x10037480
+w 0x100374c0
+r 0x10037500
+r 0x10037540
+r 0x10037580
+w 0x100375c0
+r 0x10037600
+r 0x10037640
+r 0x10037680
+w 0x100376c0
+r 0x10037700
+r 0x10037740
+r 0x10037780
+w 0x100377c0
+r 0x10037800
+r 0x10037840
+r 0x10037880
+w 0x100378c0
+r 0x10037900
+r 0x10037940
+r 0x10037980
+w 0x100379c0
+r 0x10037a00
+r 0x10037a40
+r 0x10037a80
+w 0x10037ac0
+r 0x10037b00
+r 0x10037b40
+r 0x10037b80
+w 0x10037bc0
+r 0x10037c00
+r 0x10037c40
+r 0x10037c80
+w 0x10037cc0
+r 0x10037d00
+r 0x10037d40
+r 0x10037d80
+w 0x10037dc0
+r 0x10037e00
+r 0x10037e40
+r 0x10037e80
+w 0x10037ec0
+r 0x10037f00
+r 0x10037f40
+r 0x10037f80
+w 0x10037fc0
+r 0x10038000
+r 0x10038040
+r 0x10038080
+w 0x100380c0
+r 0x10038100
+r 0x10038140
+r 0x10038180
+w 0x100381c0
+r 0x10038200
+r 0x10038240
+r 0x10038280
+w 0x100382c0
+r 0x10038300
+r 0x10038340
+r 0x10038380
+w 0x100383c0
+r 0x10038400
+r 0x10038440
+r 0x10038480
+w 0x100384c0
+r 0x10038500
+r 0x10038540
+r 0x10038580
+w 0x100385c0
+r 0x10038600
+r 0x10038640
+r 0x10038680
+w 0x100386c0
+r 0x10038700
+r 0x10038740
+r 0x10038780
+w 0x100387c0
+r 0x10038800
+r 0x10038840
+r 0x10038880
+w 0x100388c0
+r 0x10038900
+r 0x10038940
+r 0x10038980
+w 0x100389c0
+r 0x10038a00
+r 0x10038a40
+r 0x10038a80
+w 0x10038ac0
+r 0x10038b00
+r 0x10038b40
+r 0x10038b80
+w 0x10038bc0
+r 0x10038c00
+r 0x10038c40
+r 0x10038c80
+w 0x10038cc0
+r 0x10038d00
+r 0x10038d40
+r 0x10038d80
+w 0x10038dc0
+r 0x10038e00
+r 0x10038e40
+r 0x10038e80
+w 0x10038ec0
+r 0x10038f00
+r 0x10038f40
+r 0x10038f80
+w 0x10038fc0
+r 0x10039000
+r 0x10039040
+r 0x10039080
+w 0x100390c0
+r 0x10039100
+r 0x10039140
+r 0x10039180
+w 0x100391c0
+r 0x10039200
+r 0x10039240
+r 0x10039280
+w 0x100392c0
+r 0x10039300
+r 0x10039340
+r 0x10039380
+w 0x100393c0
+r 0x10039400
+r 0x10039440
+r 0x10039480
+w 0x100394c0
+r 0x10039500
+r 0x10039540
+r 0x10039580
+w 0x100395c0
+r 0x10039600
+r 0x10039640
+r 0x10039680
+w 0x100396c0
+r 0x10039700
+r 0x10039740
+r 0x10039780
+w 0x100397c0
+r 0x10039800
+r 0x10039840
+r 0x10039880
+w 0x100398c0
+r 0x10039900
+r 0x10039940
+r 0x10039980
+w 0x100399c0
+r 0x10039a00
+r 0x10039a40
+r 0x10039a80
+w 0x10039ac0
+r 0x10039b00
+r 0x10039b40
+r 0x10039b80
+w 0x10039bc0
+r 0x10039c00
+r 0x10039c40
+r 0x10039c80
+w 0x10039cc0
+r 0x10039d00
+r 0x10039d40
+r 0x10039d80
+w 0x10039dc0
+r 0x10039e00
+r 0x10039e40
+r 0x10039e80
+w 0x10039ec0
+r 0x10039f00
+r 0x10039f40
+r 0x10039f80
+w 0x10039fc0
+r 0x1003a000
+r 0x1003a040
+r 0x1003a080
+w 0x1003a0c0
+r 0x1003a100
+r 0x1003a140
+r 0x1003a180
+w 0x1003a1c0
+r 0x1003a200
+r 0x1003a240
+r 0x1003a280
+w 0x1003a2c0
+r 0x1003a300
+r 0x1003a340
+r 0x1003a380
+w 0x1003a3c0
+r 0x1003a400
+r 0x1003a440
+r 0x1003a480
+w 0x1003a4c0
+r 0x1003a500
+r 0x1003a540
+r 0x1003a580
+w 0x1003a5c0
+r 0x1003a600
+r 0x1003a640
+r 0x1003a680
+w 0x1003a6c0
+r 0x1003a700
+r 0x1003a740
+r 0x1003a780
+w 0x1003a7c0
+r 0x1003a800
+r 0x1003a840
+r 0x1003a880
+w 0x1003a8c0
+r 0x1003a900
+r 0x1003a940
+r 0x1003a980
+w 0x1003a9c0
+r 0x1003aa00
+r 0x1003aa40
+r 0x1003aa80
+w 0x1003aac0
+r 0x1003ab00
+r 0x1003ab40
+r 0x1003ab80
+w 0x1003abc0
+r 0x1003ac00
+r 0x1003ac40
+r 0x1003ac80
+w 0x1003acc0
+r 0x1003ad00
+r 0x1003ad40
+r 0x1003ad80
+w 0x1003adc0
+r 0x1003ae00
+r 0x1003ae40
+r 0x1003ae80
+w 0x1003aec0
+r 0x1003af00
+r 0x1003af40
+r 0x1003af80
+w 0x1003afc0
+r 0x1003b000
+r 0x1003b040
+r 0x1003b080
+w 0x1003b0c0
+r 0x1003b100
+r 0x1003b140
+r 0x1003b180
+w 0x1003b1c0
+r 0x1003b200
+r 0x1003b240
+r 0x1003b280
+w 0x1003b2c0
+r 0x1003b300
+r 0x1003b340
+r 0x1003b380
+w 0x1003b3c0
+r 0x1003b400
+r 0x1003b440
+r 0x1003b480
+w 0x1003b4c0
+r 0x1003b500
+r 0x1003b540
+r 0x1003b580
+w 0x1003b5c0
+r 0x1003b600
+r 0x1003b640
+r 0x1003b680
+w 0x1003b6c0
+r 0x1003b700
+r 0x1003b740
+r 0x1003b780
+w 0x1003b7c0
+r 0x1003b800
+r 0x1003b840
+r 0x1003b880
+w 0x1003b8c0
+r 0x1003b900
+r 0x1003b940
+r 0x1003b980
+w 0x1003b9c0
+r 0x1003ba00
+r 0x1003ba40
+r 0x1003ba80
+w 0x1003bac0
+r 0x1003bb00
+r 0x1003bb40
+r 0x1003bb80
+w 0x1003bbc0
+r 0x1003bc00
+r 0x1003bc40
+r 0x1003bc80
+w 0x1003bcc0
+r 0x1003bd00
+r 0x1003bd40
+r 0x1003bd80
+w 0x1003bdc0
+r 0x1003be00
+r 0x1003be40
+r 0x1003be80
+w 0x1003bec0
+r 0x1003bf00
+r 0x1003bf40
+r 0x1003bf80
+w 0x1003bfc0
+r 0x1003c000
+r 0x1003c040
+r 0x1003c080
+w 0x1003c0c0
+r 0x1003c100
+r 0x1003c140
+r 0x1003c180
+w 0x1003c1c0
+r 0x1003c200
+r 0x1003c240
+r 0x1003c280
+w 0x1003c2c0
+r 0x1003c300
+r 0x1003c340
+r 0x1003c380
+w 0x1003c3c0
+r 0x1003c400
+r 0x1003c440
+r 0x1003c480
+w 0x1003c4c0
+r 0x1003c500
+r 0x1003c540
+r 0x1003c580
+w 0x1003c5c0
+r 0x1003c600
+r 0x1003c640
+r 0x1003c680
+w 0x1003c6c0
+r 0x1003c700
+r 0x1003c740
+r 0x1003c780
+w 0x1003c7c0
+r 0x1003c800
+r 0x1003c840
+r 0x1003c880
+w 0x1003c8c0
+r 0x1003c900
+r 0x1003c940
+r 0x1003c980
+w 0x1003c9c0
+r 0x1003ca00
+r 0x1003ca40
+r 0x1003ca80
+w 0x1003cac0
+r 0x1003cb00
+r 0x1003cb40
+r 0x1003cb80
+w 0x1003cbc0
+r 0x1003cc00
+r 0x1003cc40
+r 0x1003cc80
+w 0x1003ccc0
+r 0x1003cd00
+r 0x1003cd40
+r 0x1003cd80
+w 0x1003cdc0
+r 0x1003ce00
+r 0x1003ce40
+r 0x1003ce80
+w 0x1003cec0
+r 0x1003cf00
+r 0x1003cf40
+r 0x1003cf80
+w 0x1003cfc0
+r 0x1003d000
+r 0x1003d040
+r 0x1003d080
+w 0x1003d0c0
+r 0x1003d100
+r 0x1003d140
+r 0x1003d180
+w 0x1003d1c0
+r 0x1003d200
+r 0x1003d240
+r 0x1003d280
+w 0x1003d2c0
+r 0x1003d300
+r 0x1003d340
+r 0x1003d380
+w 0x1003d3c0
+r 0x1003d400
+r 0x1003d440
+r 0x1003d480
+w 0x1003d4c0
+r 0x1003d500
+r 0x1003d540
+r 0x1003d580
+w 0x1003d5c0
+r 0x1003d600
+r 0x1003d640
+r 0x1003d680
+w 0x1003d6c0
+r 0x1003d700
+r 0x1003d740
+r 0x1003d780
+w 0x1003d7c0
+r 0x1003d800
+r 0x1003d840
+r 0x1003d880
+w 0x1003d8c0
+r 0x1003d900
+r 0x1003d940
+r 0x1003d980
+w 0x1003d9c0
+r 0x1003da00
+r 0x1003da40
+r 0x1003da80
+w 0x1003dac0
+r 0x1003db00
+r 0x1003db40
+r 0x1003db80
+w 0x1003dbc0
+r 0x1003dc00
+r 0x1003dc40
+r 0x1003dc80
+w 0x1003dcc0
+r 0x1003dd00
+r 0x1003dd40
+r 0x1003dd80
+w 0x1003ddc0
+r 0x1003de00
+r 0x1003de40
+r 0x1003de80
+w 0x1003dec0
+r 0x1003df00
+r 0x1003df40
+r 0x1003df80
+w 0x1003dfc0
+r 0x1003e000
+r 0x1003e040
+r 0x1003e080
+w 0x1003e0c0
+r 0x1003e100
+r 0x1003e140
+r 0x1003e180
+w 0x1003e1c0
+r 0x1003e200
+r 0x1003e240
+r 0x1003e280
+w 0x1003e2c0
+r 0x1003e300
+r 0x1003e340
+r 0x1003e380
+w 0x1003e3c0
+r 0x1003e400
+r 0x1003e440
+r 0x1003e480
+w 0x1003e4c0
+r 0x1003e500
+r 0x1003e540
+r 0x1003e580
+w 0x1003e5c0
+r 0x1003e600
+r 0x1003e640
+r 0x1003e680
+w 0x1003e6c0
+r 0x1003e700
+r 0x1003e740
+r 0x1003e780
+w 0x1003e7c0
+r 0x1003e800
+r 0x1003e840
+r 0x1003e880
+w 0x1003e8c0
+r 0x1003e900
+r 0x1003e940
+r 0x1003e980
+w 0x1003e9c0
+r 0x1003ea00
+r 0x1003ea40
+r 0x1003ea80
+w 0x1003eac0
+r 0x1003eb00
+r 0x1003eb40
+r 0x1003eb80
+w 0x1003ebc0
+r 0x1003ec00
+r 0x1003ec40
+r 0x1003ec80
+w 0x1003ecc0
+r 0x1003ed00
+r 0x1003ed40
+r 0x1003ed80
+w 0x1003edc0
+r 0x1003ee00
+r 0x1003ee40
+r 0x1003ee80
+w 0x1003eec0
+r 0x1003ef00
+r 0x1003ef40
+r 0x1003ef80
+w 0x1003efc0
+r 0x1003f000
+r 0x1003f040
+r 0x1003f080
+w 0x1003f0c0
+r 0x1003f100
+r 0x1003f140
+r 0x1003f180
+w 0x1003f1c0
+r 0x1003f200
+r 0x1003f240
+r 0x1003f280
+w 0x1003f2c0
+r 0x1003f300
+r 0x1003f340
+r 0x1003f380
+w 0x1003f3c0
+r 0x1003f400
+r 0x1003f440
+r 0x1003f480
+w 0x1003f4c0
+r 0x1003f500
+r 0x1003f540
+r 0x1003f580
+w 0x1003f5c0
+r 0x1003f600
+r 0x1003f640
+r 0x1003f680
+w 0x1003f6c0
+r 0x1003f700
+r 0x1003f740
+r 0x1003f780
+w 0x1003f7c0
+r 0x1003f800
+r 0x1003f840
+r 0x1003f880
+w 0x1003f8c0
+r 0x1003f900
+r 0x1003f940
+r 0x1003f980
+w 0x1003f9c0
+r 0x1003fa00
+r 0x1003fa40
+r 0x1003fa80
+w 0x1003fac0
+r 0x1003fb00
+r 0x1003fb40
+r 0x1003fb80
+w 0x1003fbc0
+r 0x1003fc00
+r 0x1003fc40
+r 0x1003fc80
+w 0x1003fcc0
+r 0x1003fd00
+r 0x1003fd40
+r 0x1003fd80
+w 0x1003fdc0
+r 0x1003fe00
+r 0x1003fe40
+r 0x1003fe80
+w 0x1003fec0
+r 0x1003ff00
+r 0x1003ff40
+r 0x1003ff80
+w 0x1003ffc0
+r 0x10040000
+r 0x10040040
+r 0x10040080
+w 0x100400c0
+r 0x10040100
+r 0x10040140
+r 0x10040180
+w 0x100401c0
+r 0x10040200
+r 0x10040240
+r 0x10040280
+w 0x100402c0
+r 0x10040300
+r 0x10040340
+r 0x10040380
+w 0x100403c0
+r 0x10040400
+r 0x10040440
+r 0x10040480
+w 0x100404c0
+r 0x10040500
+r 0x10040540
+r 0x10040580
+w 0x100405c0
+r 0x10040600
+r 0x10040640
+r 0x10040680
+w 0x100406c0
+r 0x10040700
+r 0x10040740
+r 0x10040780
+w 0x100407c0
+r 0x10040800
+r 0x10040840
+r 0x10040880
+w 0x100408c0
+r 0x10040900
+r 0x10040940
+r 0x10040980
+w 0x100409c0
+r 0x10040a00
+r 0x10040a40
+r 0x10040a80
+w 0x10040ac0
+r 0x10040b00
+r 0x10040b40
+r 0x10040b80
+w 0x10040bc0
+r 0x10040c00
+r 0x10040c40
+r 0x10040c80
+w 0x10040cc0
+r 0x10040d00
+r 0x10040d40
+r 0x10040d80
+w 0x10040dc0
+r 0x10040e00
+r 0x10040e40
+r 0x10040e80
+w 0x10040ec0
+r 0x10040f00
+r 0x10040f40
+r 0x10040f80
+w 0x10040fc0
+r 0x10041000
+r 0x10041040
+r 0x10041080
+w 0x100410c0
+r 0x10041100
+r 0x10041140
+r 0x10041180
+w 0x100411c0
+r 0x10041200
+r 0x10041240
+r 0x10041280
+w 0x100412c0
+r 0x10041300
+r 0x10041340
+r 0x10041380
+w 0x100413c0
+r 0x10041400
+r 0x10041440
+r 0x10041480
+w 0x100414c0
+r 0x10041500
+r 0x10041540
+r 0x10041580
+w 0x100415c0
+r 0x10041600
+r 0x10041640
+r 0x10041680
+w 0x100416c0
+r 0x10041700
+r 0x10041740
+r 0x10041780
+w 0x100417c0
+r 0x10041800
+r 0x10041840
+r 0x10041880
+w 0x100418c0
+r 0x10041900
+r 0x10041940
+r 0x10041980
+w 0x100419c0
+r 0x10041a00
+r 0x10041a40
+r 0x10041a80
+w 0x10041ac0
+r 0x10041b00
+r 0x10041b40
+r 0x10041b80
+w 0x10041bc0
+r 0x10041c00
+r 0x10041c40
+r 0x10041c80
+w 0x10041cc0
+r 0x10041d00
+r 0x10041d40
+r 0x10041d80
+w 0x10041dc0
+r 0x10041e00
+r 0x10041e40
+r 0x10041e80
+w 0x10041ec0
+r 0x10041f00
+r 0x10041f40
+r 0x10041f80
+w 0x10041fc0
+r 0x10042000
+r 0x10042040
+r 0x10042080
+w 0x100420c0
+r 0x10042100
+r 0x10042140
+r 0x10042180
+w 0x100421c0
+r 0x10042200
+r 0x10042240
+r 0x10042280
+w 0x100422c0
+r 0x10042300
+r 0x10042340
+r 0x10042380
+w 0x100423c0
+r 0x10042400
+r 0x10042440
+r 0x10042480
+w 0x100424c0
+r 0x10042500
+r 0x10042540
+r 0x10042580
+w 0x100425c0
+r 0x10042600
+r 0x10042640
+r 0x10042680
+w 0x100426c0
+r 0x10042700
+r 0x10042740
+r 0x10042780
+w 0x100427c0
+r 0x10042800
+r 0x10042840
+r 0x10042880
+w 0x100428c0
+r 0x10042900
+r 0x10042940
+r 0x10042980
+w 0x100429c0
+r 0x10042a00
+r 0x10042a40
+r 0x10042a80
+w 0x10042ac0
+r 0x10042b00
+r 0x10042b40
+r 0x10042b80
+w 0x10042bc0
+r 0x10042c00
+r 0x10042c40
+r 0x10042c80
+w 0x10042cc0
+r 0x10042d00
+r 0x10042d40
+r 0x10042d80
+w 0x10042dc0
+r 0x10042e00
+r 0x10042e40
+r 0x10042e80
+w 0x10042ec0
+r 0x10042f00
+r 0x10042f40
+r 0x10042f80
+w 0x10042fc0
+r 0x10043000
+r 0x10043040
+r 0x10043080
+w 0x100430c0
+r 0x10043100
+r 0x10043140
+r 0x10043180
+w 0x100431c0
+r 0x10043200
+r 0x10043240
+r 0x10043280
+w 0x100432c0
+r 0x10043300
+r 0x10043340
+r 0x10043380
+w 0x100433c0
+r 0x10043400
+r 0x10043440
+r 0x10043480
+w 0x100434c0
+r 0x10043500
+r 0x10043540
+r 0x10043580
+w 0x100435c0
+r 0x10043600
+r 0x10043640
+r 0x10043680
+w 0x100436c0
+r 0x10043700
+r 0x10043740
+r 0x10043780
+w 0x100437c0
+r 0x10043800
+r 0x10043840
+r 0x10043880
+w 0x100438c0
+r 0x10043900
+r 0x10043940
+r 0x10043980
+w 0x100439c0
+r 0x10043a00
+r 0x10043a40
+r 0x10043a80
+w 0x10043ac0
+r 0x10043b00
+r 0x10043b40
+r 0x10043b80
+w 0x10043bc0
+r 0x10043c00
+r 0x10043c40
+r 0x10043c80
+w 0x10043cc0
+r 0x10043d00
+r 0x10043d40
+r 0x10043d80
+w 0x10043dc0
+r 0x10043e00
+r 0x10043e40
+r 0x10043e80
+w 0x10043ec0
+r 0x10043f00
+r 0x10043f40
+r 0x10043f80
+w 0x10043fc0
+r 0x10044000
+r 0x10044040
+r 0x10044080
+w 0x100440c0
+r 0x10044100
+r 0x10044140
+r 0x10044180
+w 0x100441c0
+r 0x10044200
+r 0x10044240
+r 0x10044280
+w 0x100442c0
+r 0x10044300
+r 0x10044340
+r 0x10044380
+w 0x100443c0
+r 0x10044400
+r 0x10044440
+r 0x10044480
+w 0x100444c0
+r 0x10044500
+r 0x10044540
+r 0x10044580
+w 0x100445c0
+r 0x10044600
+r 0x10044640
+r 0x10044680
+w 0x100446c0
+r 0x10044700
+r 0x10044740
+r 0x10044780
+w 0x100447c0
+r 0x10044800
+r 0x10044840
+r 0x10044880
+w 0x100448c0
+r 0x10044900
+r 0x10044940
+r 0x10044980
+w 0x100449c0
+r 0x10044a00
+r 0x10044a40
+r 0x10044a80
+w 0x10044ac0
+r 0x10044b00
+r 0x10044b40
+r 0x10044b80
+w 0x10044bc0
+r 0x10044c00
+r 0x10044c40
+r 0x10044c80
+w 0x10044cc0
+r 0x10044d00
+r 0x10044d40
+r 0x10044d80
+w 0x10044dc0
+r 0x10044e00
+r 0x10044e40
+r 0x10044e80
+w 0x10044ec0
+r 0x10044f00
+r 0x10044f40
+r 0x10044f80
+w 0x10044fc0
+r 0x10045000
+r 0x10045040
+r 0x10045080
+w 0x100450c0
+r 0x10045100
+r 0x10045140
+r 0x10045180
+w 0x100451c0
+r 0x10045200
+r 0x10045240
+r 0x10045280
+w 0x100452c0
+r 0x10045300
+r 0x10045340
+r 0x10045380
+w 0x100453c0
+r 0x10045400
+r 0x10045440
+r 0x10045480
+w 0x100454c0
+r 0x10045500
+r 0x10045540
+r 0x10045580
+w 0x100455c0
+r 0x10045600
+r 0x10045640
+r 0x10045680
+w 0x100456c0
+r 0x10045700
+r 0x10045740
+r 0x10045780
+w 0x100457c0
+r 0x10045800
+r 0x10045840
+r 0x10045880
+w 0x100458c0
+r 0x10045900
+r 0x10045940
+r 0x10045980
+w 0x100459c0
+r 0x10045a00
+r 0x10045a40
+r 0x10045a80
+w 0x10045ac0
+r 0x10045b00
+r 0x10045b40
+r 0x10045b80
+w 0x10045bc0
+r 0x10045c00
+r 0x10045c40
+r 0x10045c80
+w 0x10045cc0
+r 0x10045d00
+r 0x10045d40
+r 0x10045d80
+w 0x10045dc0
+r 0x10045e00
+r 0x10045e40
+r 0x10045e80
+w 0x10045ec0
+r 0x10045f00
+r 0x10045f40
+r 0x10045f80
+w 0x10045fc0
+r 0x10046000
+r 0x10046040
+r 0x10046080
+w 0x100460c0
+r 0x10046100
+r 0x10046140
+r 0x10046180
+w 0x100461c0
+r 0x10046200
+r 0x10046240
+r 0x10046280
+w 0x100462c0
+r 0x10046300
+r 0x10046340
+r 0x10046380
+w 0x100463c0
+r 0x10046400
+r 0x10046440
+r 0x10046480
+w 0x100464c0
+r 0x10046500
+r 0x10046540
+r 0x10046580
+w 0x100465c0
+r 0x10046600
+r 0x10046640
+r 0x10046680
+w 0x100466c0
+r 0x10046700
+r 0x10046740
+r 0x10046780
+w 0x100467c0
+r 0x10046800
+r 0x10046840
+r 0x10046880
+w 0x100468c0
+r 0x10046900
+r 0x10046940
+r 0x10046980
+w 0x100469c0
+r 0x10046a00
+r 0x10046a40
+r 0x10046a80
+w 0x10046ac0
+r 0x10046b00
+r 0x10046b40
+r 0x10046b80
+w 0x10046bc0
+r 0x10046c00
+r 0x10046c40
+r 0x10046c80
+w 0x10046cc0
+r 0x10046d00
+r 0x10046d40
+r 0x10046d80
+w 0x10046dc0
+r 0x10046e00
+r 0x10046e40
+r 0x10046e80
+w 0x10046ec0
+r 0x10046f00
+r 0x10046f40
+r 0x10046f80
+w 0x10046fc0
+r 0x10047000
+r 0x10047040
+r 0x10047080
+w 0x100470c0
+r 0x10047100
+r 0x10047140
+r 0x10047180
+w 0x100471c0
+r 0x10047200
+r 0x10047240
+r 0x10047280
+w 0x100472c0
+r 0x10047300
+r 0x10047340
+r 0x10047380
+w 0x100473c0
+r 0x10047400
+r 0x10047440
+r 0x10047480
+w 0x100474c0
+r 0x10047500
+r 0x10047540
+r 0x10047580
+w 0x100475c0
+r 0x10047600
+r 0x10047640
+r 0x10047680
+w 0x100476c0
+r 0x10047700
+r 0x10047740
+r 0x10047780
+w 0x100477c0
+r 0x10047800
+r 0x10047840
+r 0x10047880
+w 0x100478c0
+r 0x10047900
+r 0x10047940
+r 0x10047980
+w 0x100479c0
+r 0x10047a00
+r 0x10047a40
+r 0x10047a80
+w 0x10047ac0
+r 0x10047b00
+r 0x10047b40
+r 0x10047b80
+w 0x10047bc0
+r 0x10047c00
+r 0x10047c40
+r 0x10047c80
+w 0x10047cc0
+r 0x10047d00
+r 0x10047d40
+r 0x10047d80
+w 0x10047dc0
+r 0x10047e00
+r 0x10047e40
+r 0x10047e80
+w 0x10047ec0
+r 0x10047f00
+r 0x10047f40
+r 0x10047f80
+w 0x10047fc0
+r 0x10048000
+r 0x10048040
+r 0x10048080
+w 0x100480c0
+r 0x10048100
+r 0x10048140
+r 0x10048180
+w 0x100481c0
+r 0x10048200
+r 0x10048240
+r 0x10048280
+w 0x100482c0
+r 0x10048300
+r 0x10048340
+r 0x10048380
+w 0x100483c0
+r 0x10048400
+r 0x10048440
+r 0x10048480
+w 0x100484c0
+r 0x10048500
+r 0x10048540
+r 0x10048580
+w 0x100485c0
+r 0x10048600
+r 0x10048640
+r 0x10048680
+w 0x100486c0
+r 0x10048700
+r 0x10048740
+r 0x10048780
+w 0x100487c0
+r 0x10048800
+r 0x10048840
+r 0x10048880
+w 0x100488c0
+r 0x10048900
+r 0x10048940
+r 0x10048980
+w 0x100489c0
+r 0x10048a00
+r 0x10048a40
+r 0x10048a80
+w 0x10048ac0
+r 0x10048b00
+r 0x10048b40
+r 0x10048b80
+w 0x10048bc0
+r 0x10048c00
+r 0x10048c40
+r 0x10048c80
+w 0x10048cc0
+r 0x10048d00
+r 0x10048d40
+r 0x10048d80
+w 0x10048dc0
+r 0x10048e00
+r 0x10048e40
+r 0x10048e80
+w 0x10048ec0
+r 0x10048f00
+r 0x10048f40
+r 0x10048f80
+w 0x10048fc0
+r 0x10049000
+r 0x10049040
+r 0x10049080
+w 0x100490c0
+r 0x10049100
+r 0x10049140
+r 0x10049180
+w 0x100491c0
+r 0x10049200
+r 0x10049240
+r 0x10049280
+w 0x100492c0
+r 0x10049300
+r 0x10049340
+r 0x10049380
+w 0x100493c0
+r 0x10049400
+r 0x10049440
+r 0x10049480
+w 0x100494c0
+r 0x10049500
+r 0x10049540
+r 0x10049580
+w 0x100495c0
+r 0x10049600
+r 0x10049640
+r 0x10049680
+w 0x100496c0
+r 0x10049700
+r 0x10049740
+r 0x10049780
+w 0x100497c0
+r 0x10049800
+r 0x10049840
+r 0x10049880
+w 0x100498c0
+r 0x10049900
+r 0x10049940
+r 0x10049980
+w 0x100499c0
+r 0x10049a00
+r 0x10049a40
+r 0x10049a80
+w 0x10049ac0
+r 0x10049b00
+r 0x10049b40
+r 0x10049b80
+w 0x10049bc0
+r 0x10049c00
+r 0x10049c40
+r 0x10049c80
+w 0x10049cc0
+r 0x10049d00
+r 0x10049d40
+r 0x10049d80
+w 0x10049dc0
+r 0x10049e00
+r 0x10049e40
+r 0x10049e80
+w 0x10049ec0
+r 0x10049f00
+r 0x10049f40
+r 0x10049f80
+w 0x10049fc0
+r 0x1004a000
+r 0x1004a040
+r 0x1004a080
+w 0x1004a0c0
+r 0x1004a100
+r 0x1004a140
+r 0x1004a180
+w 0x1004a1c0
+r 0x1004a200
+r 0x1004a240
+r 0x1004a280
+w 0x1004a2c0
+r 0x1004a300
+r 0x1004a340
+r 0x1004a380
+w 0x1004a3c0
+r 0x1004a400
+r 0x1004a440
+r 0x1004a480
+w 0x1004a4c0
+r 0x1004a500
+r 0x1004a540
+r 0x1004a580
+w 0x1004a5c0
+r 0x1004a600
+r 0x1004a640
+r 0x1004a680
+w 0x1004a6c0
+r 0x1004a700
+r 0x1004a740
+r 0x1004a780
+w 0x1004a7c0
+r 0x1004a800
+r 0x1004a840
+r 0x1004a880
+w 0x1004a8c0
+r 0x1004a900
+r 0x1004a940
+r 0x1004a980
+w 0x1004a9c0
+r 0x1004aa00
+r 0x1004aa40
+r 0x1004aa80
+w 0x1004aac0
+r 0x1004ab00
+r 0x1004ab40
+r 0x1004ab80
+w 0x1004abc0
+r 0x1004ac00
+r 0x1004ac40
+r 0x1004ac80
+w 0x1004acc0
+r 0x1004ad00
+r 0x1004ad40
+r 0x1004ad80
+w 0x1004adc0
+r 0x1004ae00
+r 0x1004ae40
+r 0x1004ae80
+w 0x1004aec0
+r 0x1004af00
+r 0x1004af40
+r 0x1004af80
+w 0x1004afc0
+r 0x1004b000
+r 0x1004b040
+r 0x1004b080
+w 0x1004b0c0
+r 0x1004b100
+r 0x1004b140
+r 0x1004b180
+w 0x1004b1c0
+r 0x1004b200
+r 0x1004b240
+r 0x1004b280
+w 0x1004b2c0
+r 0x1004b300
+r 0x1004b340
+r 0x1004b380
+w 0x1004b3c0
+r 0x1004b400
+r 0x1004b440
+r 0x1004b480
+w 0x1004b4c0
+r 0x1004b500
+r 0x1004b540
+r 0x1004b580
+w 0x1004b5c0
+r 0x1004b600
+r 0x1004b640
+r 0x1004b680
+w 0x1004b6c0
+r 0x1004b700
+r 0x1004b740
+r 0x1004b780
+w 0x1004b7c0
+r 0x1004b800
+r 0x1004b840
+r 0x1004b880
+w 0x1004b8c0
+r 0x1004b900
+r 0x1004b940
+r 0x1004b980
+w 0x1004b9c0
+r 0x1004ba00
+r 0x1004ba40
+r 0x1004ba80
+w 0x1004bac0
+r 0x1004bb00
+r 0x1004bb40
+r 0x1004bb80
+w 0x1004bbc0
+r 0x1004bc00
+r 0x1004bc40
+r 0x1004bc80
+w 0x1004bcc0
+r 0x1004bd00
+r 0x1004bd40
+r 0x1004bd80
+w 0x1004bdc0
+r 0x1004be00
+r 0x1004be40
+r 0x1004be80
+w 0x1004bec0
+r 0x1004bf00
+r 0x1004bf40
+r 0x1004bf80
+w 0x1004bfc0
+r 0x1004c000
+r 0x1004c040
+r 0x1004c080
+w 0x1004c0c0
+r 0x1004c100
+r 0x1004c140
+r 0x1004c180
+w 0x1004c1c0
+r 0x1004c200
+r 0x1004c240
+r 0x1004c280
+w 0x1004c2c0
+r 0x1004c300
+r 0x1004c340
+r 0x1004c380
+w 0x1004c3c0
+r 0x1004c400
+r 0x1004c440
+r 0x1004c480
+w 0x1004c4c0
+r 0x1004c500
+r 0x1004c540
+r 0x1004c580
+w 0x1004c5c0
+r 0x1004c600
+r 0x1004c640
+r 0x1004c680
+w 0x1004c6c0
+r 0x1004c700
+r 0x1004c740
+r 0x1004c780
+w 0x1004c7c0
+r 0x1004c800
+r 0x1004c840
+r 0x1004c880
+w 0x1004c8c0
+r 0x1004c900
+r 0x1004c940
+r 0x1004c980
+w 0x1004c9c0
+r 0x1004ca00
+r 0x1004ca40
+r 0x1004ca80
+w 0x1004cac0
+r 0x1004cb00
+r 0x1004cb40
+r 0x1004cb80
+w 0x1004cbc0
+r 0x1004cc00
+r 0x1004cc40
+r 0x1004cc80
+w 0x1004ccc0
+r 0x1004cd00
+r 0x1004cd40
+r 0x1004cd80
+w 0x1004cdc0
+r 0x1004ce00
+r 0x1004ce40
+r 0x1004ce80
+w 0x1004cec0
+r 0x1004cf00
+r 0x1004cf40
+r 0x1004cf80
+w 0x1004cfc0
+r 0x1004d000
+r 0x1004d040
+r 0x1004d080
+w 0x1004d0c0
+r 0x1004d100
+r 0x1004d140
+r 0x1004d180
+w 0x1004d1c0
+r 0x1004d200
+r 0x1004d240
+r 0x1004d280
+w 0x1004d2c0
+r 0x1004d300
+r 0x1004d340
+r 0x1004d380
+w 0x1004d3c0
+r 0x1004d400
+r 0x1004d440
+r 0x1004d480
+w 0x1004d4c0
+r 0x1004d500
+r 0x1004d540
+r 0x1004d580
+w 0x1004d5c0
+r 0x1004d600
+r 0x1004d640
+r 0x1004d680
+w 0x1004d6c0
+r 0x1004d700
+r 0x1004d740
+r 0x1004d780
+w 0x1004d7c0
+r 0x1004d800
+r 0x1004d840
+r 0x1004d880
+w 0x1004d8c0
+r 0x1004d900
+r 0x1004d940
+r 0x1004d980
+w 0x1004d9c0
+r 0x1004da00
+r 0x1004da40
+r 0x1004da80
+w 0x1004dac0
+r 0x1004db00
+r 0x1004db40
+r 0x1004db80
+w 0x1004dbc0
+r 0x1004dc00
+r 0x1004dc40
+r 0x1004dc80
+w 0x1004dcc0
+r 0x1004dd00
+r 0x1004dd40
+r 0x1004dd80
+w 0x1004ddc0
+r 0x1004de00
+r 0x1004de40
+r 0x1004de80
+w 0x1004dec0
+r 0x1004df00
+r 0x1004df40
+r 0x1004df80
+w 0x1004dfc0
+r 0x1004e000
+r 0x1004e040
+r 0x1004e080
+w 0x1004e0c0
+r 0x1004e100
+r 0x1004e140
+r 0x1004e180
+w 0x1004e1c0
+r 0x1004e200
+r 0x1004e240
+r 0x1004e280
+w 0x1004e2c0
+r 0x1004e300
+r 0x1004e340
+r 0x1004e380
+w 0x1004e3c0
+r 0x1004e400
+r 0x1004e440
+r 0x1004e480
+w 0x1004e4c0
+r 0x1004e500
+r 0x1004e540
+r 0x1004e580
+w 0x1004e5c0
+r 0x1004e600
+r 0x1004e640
+r 0x1004e680
+w 0x1004e6c0
+r 0x1004e700
+r 0x1004e740
+r 0x1004e780
+w 0x1004e7c0
+r 0x1004e800
+r 0x1004e840
+r 0x1004e880
+w 0x1004e8c0
+r 0x1004e900
+r 0x1004e940
+r 0x1004e980
+w 0x1004e9c0
+r 0x1004ea00
+r 0x1004ea40
+r 0x1004ea80
+w 0x1004eac0
+r 0x1004eb00
+r 0x1004eb40
+r 0x1004eb80
+w 0x1004ebc0
+r 0x1004ec00
+r 0x1004ec40
+r 0x1004ec80
+w 0x1004ecc0
+r 0x1004ed00
+r 0x1004ed40
+r 0x1004ed80
+w 0x1004edc0
+r 0x1004ee00
+r 0x1004ee40
+r 0x1004ee80
+w 0x1004eec0
+r 0x1004ef00
+r 0x1004ef40
+r 0x1004ef80
+w 0x1004efc0
+r 0x1004f000
+r 0x1004f040
+r 0x1004f080
+w 0x1004f0c0
+r 0x1004f100
+r 0x1004f140
+r 0x1004f180
+w 0x1004f1c0
+r 0x1004f200
+r 0x1004f240
+r 0x1004f280
+w 0x1004f2c0
+r 0x1004f300
+r 0x1004f340
+r 0x1004f380
+w 0x1004f3c0
+r 0x1004f400
+r 0x1004f440
+r 0x1004f480
+w 0x1004f4c0
+r 0x1004f500
+r 0x1004f540
+r 0x1004f580
+w 0x1004f5c0
+r 0x1004f600
+r 0x1004f640
+r 0x1004f680
+w 0x1004f6c0
+r 0x1004f700
+r 0x1004f740
+r 0x1004f780
+w 0x1004f7c0
+r 0x1004f800
+r 0x1004f840
+r 0x1004f880
+w 0x1004f8c0
+r 0x1004f900
+r 0x1004f940
+r 0x1004f980
+w 0x1004f9c0
+r 0x1004fa00
+r 0x1004fa40
+r 0x1004fa80
+w 0x1004fac0
+r 0x1004fb00
+r 0x1004fb40
+r 0x1004fb80
+w 0x1004fbc0
+r 0x1004fc00
+r 0x1004fc40
+r 0x1004fc80
+w 0x1004fcc0
+r 0x1004fd00
+r 0x1004fd40
+r 0x1004fd80
+w 0x1004fdc0
+r 0x1004fe00
+r 0x1004fe40
+r 0x1004fe80
+w 0x1004fec0
+r 0x1004ff00
+r 0x1004ff40
+r 0x1004ff80
+w 0x1004ffc0
+r 0x10050000
+r 0x10050040
+r 0x10050080
+w 0x100500c0
+r 0x10050100
+r 0x10050140
+r 0x10050180
+w 0x100501c0
+r 0x10050200
+r 0x10050240
+r 0x10050280
+w 0x100502c0
+r 0x10050300
+r 0x10050340
+r 0x10050380
+w 0x100503c0
+r 0x10050400
+r 0x10050440
+r 0x10050480
+w 0x100504c0
+r 0x10050500
+r 0x10050540
+r 0x10050580
+w 0x100505c0
+r 0x10050600
+r 0x10050640
+r 0x10050680
+w 0x100506c0
+r 0x10050700
+r 0x10050740
+r 0x10050780
+w 0x100507c0
+r 0x10050800
+r 0x10050840
+r 0x10050880
+w 0x100508c0
+r 0x10050900
+r 0x10050940
+r 0x10050980
+w 0x100509c0
+r 0x10050a00
+r 0x10050a40
+r 0x10050a80
+w 0x10050ac0
+r 0x10050b00
+r 0x10050b40
+r 0x10050b80
+w 0x10050bc0
+r 0x10050c00
+r 0x10050c40
+r 0x10050c80
+w 0x10050cc0
+r 0x10050d00
+r 0x10050d40
+r 0x10050d80
+w 0x10050dc0
+r 0x10050e00
+r 0x10050e40
+r 0x10050e80
+w 0x10050ec0
+r 0x10050f00
+r 0x10050f40
+r 0x10050f80
+w 0x10050fc0
+r 0x10051000
+r 0x10051040
+r 0x10051080
+w 0x100510c0
+r 0x10051100
+r 0x10051140
+r 0x10051180
+w 0x100511c0
+r 0x10051200
+r 0x10051240
+r 0x10051280
+w 0x100512c0
+r 0x10051300
+r 0x10051340
+r 0x10051380
+w 0x100513c0
+r 0x10051400
+r 0x10051440
+r 0x10051480
+w 0x100514c0
+r 0x10051500
+r 0x10051540
+r 0x10051580
+w 0x100515c0
+r 0x10051600
+r 0x10051640
+r 0x10051680
+w 0x100516c0
+r 0x10051700
+r 0x10051740
+r 0x10051780
+w 0x100517c0
+r 0x10051800
+r 0x10051840
+r 0x10051880
+w 0x100518c0
+r 0x10051900
+r 0x10051940
+r 0x10051980
+w 0x100519c0
+r 0x10051a00
+r 0x10051a40
+r 0x10051a80
+w 0x10051ac0
+r 0x10051b00
+r 0x10051b40
+r 0x10051b80
+w 0x10051bc0
+r 0x10051c00
+r 0x10051c40
+r 0x10051c80
+w 0x10051cc0
+r 0x10051d00
+r 0x10051d40
+r 0x10051d80
+w 0x10051dc0
+r 0x10051e00
+r 0x10051e40
+r 0x10051e80
+w 0x10051ec0
+r 0x10051f00
+r 0x10051f40
+r 0x10051f80
+w 0x10051fc0
+r 0x10052000
+r 0x10052040
+r 0x10052080
+w 0x100520c0
+r 0x10052100
+r 0x10052140
+r 0x10052180
+w 0x100521c0
+r 0x10052200
+r 0x10052240
+r 0x10052280
+w 0x100522c0
+r 0x10052300
+r 0x10052340
+r 0x10052380
+w 0x100523c0
+r 0x10052400
+r 0x10052440
+r 0x10052480
+w 0x100524c0
+r 0x10052500
+r 0x10052540
+r 0x10052580
+w 0x100525c0
+r 0x10052600
+r 0x10052640
+r 0x10052680
+w 0x100526c0
+r 0x10052700
+r 0x10052740
+r 0x10052780
+w 0x100527c0
+r 0x10052800
+r 0x10052840
+r 0x10052880
+w 0x100528c0
+r 0x10052900
+r 0x10052940
+r 0x10052980
+w 0x100529c0
+r 0x10052a00
+r 0x10052a40
+r 0x10052a80
+w 0x10052ac0
+r 0x10052b00
+r 0x10052b40
+r 0x10052b80
+w 0x10052bc0
+r 0x10052c00
+r 0x10052c40
+r 0x10052c80
+w 0x10052cc0
+r 0x10052d00
+r 0x10052d40
+r 0x10052d80
+w 0x10052dc0
+r 0x10052e00
+r 0x10052e40
+r 0x10052e80
+w 0x10052ec0
+r 0x10052f00
+r 0x10052f40
+r 0x10052f80
+w 0x10052fc0
+r 0x10053000
+r 0x10053040
+r 0x10053080
+w 0x100530c0
+r 0x10053100
+r 0x10053140
+r 0x10053180
+w 0x100531c0
+r 0x10053200
+r 0x10053240
+r 0x10053280
+w 0x100532c0
+r 0x10053300
+r 0x10053340
+r 0x10053380
+w 0x100533c0
+r 0x10053400
+r 0x10053440
+r 0x10053480
+w 0x100534c0
+r 0x10053500
+r 0x10053540
+r 0x10053580
+w 0x100535c0
+r 0x10053600
+r 0x10053640
+r 0x10053680
+w 0x100536c0
+r 0x10053700
+r 0x10053740
+r 0x10053780
+w 0x100537c0
+r 0x10053800
+r 0x10053840
+r 0x10053880
+w 0x100538c0
+r 0x10053900
+r 0x10053940
+r 0x10053980
+w 0x100539c0
+r 0x10053a00
+r 0x10053a40
+r 0x10053a80
+w 0x10053ac0
+r 0x10053b00
+r 0x10053b40
+r 0x10053b80
+w 0x10053bc0
+r 0x10053c00
+r 0x10053c40
+r 0x10053c80
+w 0x10053cc0
+r 0x10053d00
+r 0x10053d40
+r 0x10053d80
+w 0x10053dc0
+r 0x10053e00
+r 0x10053e40
+r 0x10053e80
+w 0x10053ec0
+r 0x10053f00
+r 0x10053f40
+r 0x10053f80
+w 0x10053fc0
+r 0x10054000
+r 0x10054040
+r 0x10054080
+w 0x100540c0
+r 0x10054100
+r 0x10054140
+r 0x10054180
+w 0x100541c0
+r 0x10054200
+r 0x10054240
+r 0x10054280
+w 0x100542c0
+r 0x10054300
+r 0x10054340
+r 0x10054380
+w 0x100543c0
+r 0x10054400
+r 0x10054440
+r 0x10054480
+w 0x100544c0
+r 0x10054500
+r 0x10054540
+r 0x10054580
+w 0x100545c0
+r 0x10054600
+r 0x10054640
+r 0x10054680
+w 0x100546c0
+r 0x10054700
+r 0x10054740
+r 0x10054780
+w 0x100547c0
+r 0x10054800
+r 0x10054840
+r 0x10054880
+w 0x100548c0
+r 0x10054900
+r 0x10054940
+r 0x10054980
+w 0x100549c0
+r 0x10054a00
+r 0x10054a40
+r 0x10054a80
+w 0x10054ac0
+r 0x10054b00
+r 0x10054b40
+r 0x10054b80
+w 0x10054bc0
+r 0x10054c00
+r 0x10054c40
+r 0x10054c80
+w 0x10054cc0
+r 0x10054d00
+r 0x10054d40
+r 0x10054d80
+w 0x10054dc0
+r 0x10054e00
+r 0x10054e40
+r 0x10054e80
+w 0x10054ec0
+r 0x10054f00
+r 0x10054f40
+r 0x10054f80
+w 0x10054fc0
+r 0x10055000
+r 0x10055040
+r 0x10055080
+w 0x100550c0
+r 0x10055100
+r 0x10055140
+r 0x10055180
+w 0x100551c0
+r 0x10055200
+r 0x10055240
+r 0x10055280
+w 0x100552c0
+r 0x10055300
+r 0x10055340
+r 0x10055380
+w 0x100553c0
+r 0x10055400
+r 0x10055440
+r 0x10055480
+w 0x100554c0
+r 0x10055500
+r 0x10055540
+r 0x10055580
+w 0x100555c0
+r 0x10055600
+r 0x10055640
+r 0x10055680
+w 0x100556c0
+r 0x10055700
+r 0x10055740
+r 0x10055780
+w 0x100557c0
+r 0x10055800
+r 0x10055840
+r 0x10055880
+w 0x100558c0
+r 0x10055900
+r 0x10055940
+r 0x10055980
+w 0x100559c0
+r 0x10055a00
+r 0x10055a40
+r 0x10055a80
+w 0x10055ac0
+r 0x10055b00
+r 0x10055b40
+r 0x10055b80
+w 0x10055bc0
+r 0x10055c00
+r 0x10055c40
+r 0x10055c80
+w 0x10055cc0
+r 0x10055d00
+r 0x10055d40
+r 0x10055d80
+w 0x10055dc0
+r 0x10055e00
+r 0x10055e40
+r 0x10055e80
+w 0x10055ec0
+r 0x10055f00
+r 0x10055f40
+r 0x10055f80
+w 0x10055fc0
+r 0x10056000
+r 0x10056040
+r 0x10056080
+w 0x100560c0
+r 0x10056100
+r 0x10056140
+r 0x10056180
+w 0x100561c0
+r 0x10056200
+r 0x10056240
+r 0x10056280
+w 0x100562c0
+r 0x10056300
+r 0x10056340
+r 0x10056380
+w 0x100563c0
+r 0x10056400
+r 0x10056440
+r 0x10056480
+w 0x100564c0
+r 0x10056500
+r 0x10056540
+r 0x10056580
+w 0x100565c0
+r 0x10056600
+r 0x10056640
+r 0x10056680
+w 0x100566c0
+r 0x10056700
+r 0x10056740
+r 0x10056780
+w 0x100567c0
+r 0x10056800
+r 0x10056840
+r 0x10056880
+w 0x100568c0
+r 0x10056900
+r 0x10056940
+r 0x10056980
+w 0x100569c0
+r 0x10056a00
+r 0x10056a40
+r 0x10056a80
+w 0x10056ac0
+r 0x10056b00
+r 0x10056b40
+r 0x10056b80
+w 0x10056bc0
+r 0x10056c00
+r 0x10056c40
+r 0x10056c80
+w 0x10056cc0
+r 0x10056d00
+r 0x10056d40
+r 0x10056d80
+w 0x10056dc0
+r 0x10056e00
+r 0x10056e40
+r 0x10056e80
+w 0x10056ec0
+r 0x10056f00
+r 0x10056f40
+r 0x10056f80
+w 0x10056fc0
+r 0x10057000
+r 0x10057040
+r 0x10057080
+w 0x100570c0
+r 0x10057100
+r 0x10057140
+r 0x10057180
+w 0x100571c0
+r 0x10057200
+r 0x10057240
+r 0x10057280
+w 0x100572c0
+r 0x10057300
+r 0x10057340
+r 0x10057380
+w 0x100573c0
+r 0x10057400
+r 0x10057440
+r 0x10057480
+w 0x100574c0
+r 0x10057500
+r 0x10057540
+r 0x10057580
+w 0x100575c0
+r 0x10057600
+r 0x10057640
+r 0x10057680
+w 0x100576c0
+r 0x10057700
+r 0x10057740
+r 0x10057780
+w 0x100577c0
+r 0x10057800
+r 0x10057840
+r 0x10057880
+w 0x100578c0
+r 0x10057900
+r 0x10057940
+r 0x10057980
+w 0x100579c0
+r 0x10057a00
+r 0x10057a40
+r 0x10057a80
+w 0x10057ac0
+r 0x10057b00
+r 0x10057b40
+r 0x10057b80
+w 0x10057bc0
+r 0x10057c00
+r 0x10057c40
+r 0x10057c80
+w 0x10057cc0
+r 0x10057d00
+r 0x10057d40
+r 0x10057d80
+w 0x10057dc0
+r 0x10057e00
+r 0x10057e40
+r 0x10057e80
+w 0x10057ec0
+r 0x10057f00
+r 0x10057f40
+r 0x10057f80
+w 0x10057fc0
+r 0x10058000
+r 0x10058040
+r 0x10058080
+w 0x100580c0
+r 0x10058100
+r 0x10058140
+r 0x10058180
+w 0x100581c0
+r 0x10058200
+r 0x10058240
+r 0x10058280
+w 0x100582c0
+r 0x10058300
+r 0x10058340
+r 0x10058380
+w 0x100583c0
+r 0x10058400
+r 0x10058440
+r 0x10058480
+w 0x100584c0
+r 0x10058500
+r 0x10058540
+r 0x10058580
+w 0x100585c0
+r 0x10058600
+r 0x10058640
+r 0x10058680
+w 0x100586c0
+r 0x10058700
+r 0x10058740
+r 0x10058780
+w 0x100587c0
+r 0x10058800
+r 0x10058840
+r 0x10058880
+w 0x100588c0
+r 0x10058900
+r 0x10058940
+r 0x10058980
+w 0x100589c0
+r 0x10058a00
+r 0x10058a40
+r 0x10058a80
+w 0x10058ac0
+r 0x10058b00
+r 0x10058b40
+r 0x10058b80
+w 0x10058bc0
+r 0x10058c00
+r 0x10058c40
+r 0x10058c80
+w 0x10058cc0
+r 0x10058d00
+r 0x10058d40
+r 0x10058d80
+w 0x10058dc0
+r 0x10058e00
+r 0x10058e40
+r 0x10058e80
+w 0x10058ec0
+r 0x10058f00
+r 0x10058f40
+r 0x10058f80
+w 0x10058fc0
+r 0x10059000
+r 0x10059040
+r 0x10059080
+w 0x100590c0
+r 0x10059100
+r 0x10059140
+r 0x10059180
+w 0x100591c0
+r 0x10059200
+r 0x10059240
+r 0x10059280
+w 0x100592c0
+r 0x10059300
+r 0x10059340
+r 0x10059380
+w 0x100593c0
+r 0x10059400
+r 0x10059440
+r 0x10059480
+w 0x100594c0
+r 0x10059500
+r 0x10059540
+r 0x10059580
+w 0x100595c0
+r 0x10059600
+r 0x10059640
+r 0x10059680
+w 0x100596c0
+r 0x10059700
+r 0x10059740
+r 0x10059780
+w 0x100597c0
+r 0x10059800
+r 0x10059840
+r 0x10059880
+w 0x100598c0
+r 0x10059900
+r 0x10059940
+r 0x10059980
+w 0x100599c0
+r 0x10059a00
+r 0x10059a40
+r 0x10059a80
+w 0x10059ac0
+r 0x10059b00
+r 0x10059b40
+r 0x10059b80
+w 0x10059bc0
+r 0x10059c00
+r 0x10059c40
+r 0x10059c80
+w 0x10059cc0
+r 0x10059d00
+r 0x10059d40
+r 0x10059d80
+w 0x10059dc0
+r 0x10059e00
+r 0x10059e40
+r 0x10059e80
+w 0x10059ec0
+r 0x10059f00
+r 0x10059f40
+r 0x10059f80
+w 0x10059fc0
+r 0x1005a000
+r 0x1005a040
+r 0x1005a080
+w 0x1005a0c0
+r 0x1005a100
+r 0x1005a140
+r 0x1005a180
+w 0x1005a1c0
+r 0x1005a200
+r 0x1005a240
+r 0x1005a280
+w 0x1005a2c0
+r 0x1005a300
+r 0x1005a340
+r 0x1005a380
+w 0x1005a3c0
+r 0x1005a400
+r 0x1005a440
+r 0x1005a480
+w 0x1005a4c0
+r 0x1005a500
+r 0x1005a540
+r 0x1005a580
+w 0x1005a5c0
+r 0x1005a600
+r 0x1005a640
+r 0x1005a680
+w 0x1005a6c0
+r 0x1005a700
+r 0x1005a740
+r 0x1005a780
+w 0x1005a7c0
+r 0x1005a800
+r 0x1005a840
+r 0x1005a880
+w 0x1005a8c0
+r 0x1005a900
+r 0x1005a940
+r 0x1005a980
+w 0x1005a9c0
+r 0x1005aa00
+r 0x1005aa40
+r 0x1005aa80
+w 0x1005aac0
+r 0x1005ab00
+r 0x1005ab40
+r 0x1005ab80
+w 0x1005abc0
+r 0x1005ac00
+r 0x1005ac40
+r 0x1005ac80
+w 0x1005acc0
+r 0x1005ad00
+r 0x1005ad40
+r 0x1005ad80
+w 0x1005adc0
+r 0x1005ae00
+r 0x1005ae40
+r 0x1005ae80
+w 0x1005aec0
+r 0x1005af00
+r 0x1005af40
+r 0x1005af80
+w 0x1005afc0
+r 0x1005b000
+r 0x1005b040
+r 0x1005b080
+w 0x1005b0c0
+r 0x1005b100
+r 0x1005b140
+r 0x1005b180
+w 0x1005b1c0
+r 0x1005b200
+r 0x1005b240
+r 0x1005b280
+w 0x1005b2c0
+r 0x1005b300
+r 0x1005b340
+r 0x1005b380
+w 0x1005b3c0
+r 0x1005b400
+r 0x1005b440
+r 0x1005b480
+w 0x1005b4c0
+r 0x1005b500
+r 0x1005b540
+r 0x1005b580
+w 0x1005b5c0
+r 0x1005b600
+r 0x1005b640
+r 0x1005b680
+w 0x1005b6c0
+r 0x1005b700
+r 0x1005b740
+r 0x1005b780
+w 0x1005b7c0
+r 0x1005b800
+r 0x1005b840
+r 0x1005b880
+w 0x1005b8c0
+r 0x1005b900
+r 0x1005b940
+r 0x1005b980
+w 0x1005b9c0
+r 0x1005ba00
+r 0x1005ba40
+r 0x1005ba80
+w 0x1005bac0
+r 0x1005bb00
+r 0x1005bb40
+r 0x1005bb80
+w 0x1005bbc0
+r 0x1005bc00
+r 0x1005bc40
+r 0x1005bc80
+w 0x1005bcc0
+r 0x1005bd00
+r 0x1005bd40
+r 0x1005bd80
+w 0x1005bdc0
+r 0x1005be00
+r 0x1005be40
+r 0x1005be80
+w 0x1005bec0
+r 0x1005bf00
+r 0x1005bf40
+r 0x1005bf80
+w 0x1005bfc0
+r 0x1005c000
+r 0x1005c040
+r 0x1005c080
+w 0x1005c0c0
+r 0x1005c100
+r 0x1005c140
+r 0x1005c180
+w 0x1005c1c0
+r 0x1005c200
+r 0x1005c240
+r 0x1005c280
+w 0x1005c2c0
+r 0x1005c300
+r 0x1005c340
+r 0x1005c380
+w 0x1005c3c0
+r 0x1005c400
+r 0x1005c440
+r 0x1005c480
+w 0x1005c4c0
+r 0x1005c500
+r 0x1005c540
+r 0x1005c580
+w 0x1005c5c0
+r 0x1005c600
+r 0x1005c640
+r 0x1005c680
+w 0x1005c6c0
+r 0x1005c700
+r 0x1005c740
+r 0x1005c780
+w 0x1005c7c0
+r 0x1005c800
+r 0x1005c840
+r 0x1005c880
+w 0x1005c8c0
+r 0x1005c900
+r 0x1005c940
+r 0x1005c980
+w 0x1005c9c0
+r 0x1005ca00
+r 0x1005ca40
+r 0x1005ca80
+w 0x1005cac0
+r 0x1005cb00
+r 0x1005cb40
+r 0x1005cb80
+w 0x1005cbc0
+r 0x1005cc00
+r 0x1005cc40
+r 0x1005cc80
+w 0x1005ccc0
+r 0x1005cd00
+r 0x1005cd40
+r 0x1005cd80
+w 0x1005cdc0
+r 0x1005ce00
+r 0x1005ce40
+r 0x1005ce80
+w 0x1005cec0
+r 0x1005cf00
+r 0x1005cf40
+r 0x1005cf80
+w 0x1005cfc0
+r 0x1005d000
+r 0x1005d040
+r 0x1005d080
+w 0x1005d0c0
+r 0x1005d100
+r 0x1005d140
+r 0x1005d180
+w 0x1005d1c0
+r 0x1005d200
+r 0x1005d240
+r 0x1005d280
+w 0x1005d2c0
+r 0x1005d300
+r 0x1005d340
+r 0x1005d380
+w 0x1005d3c0
+r 0x1005d400
+r 0x1005d440
+r 0x1005d480
+w 0x1005d4c0
+r 0x1005d500
+r 0x1005d540
+r 0x1005d580
+w 0x1005d5c0
+r 0x1005d600
+r 0x1005d640
+r 0x1005d680
+w 0x1005d6c0
+r 0x1005d700
+r 0x1005d740
+r 0x1005d780
+w 0x1005d7c0
+r 0x1005d800
+r 0x1005d840
+r 0x1005d880
+w 0x1005d8c0
+r 0x1005d900
+r 0x1005d940
+r 0x1005d980
+w 0x1005d9c0
+r 0x1005da00
+r 0x1005da40
+r 0x1005da80
+w 0x1005dac0
+r 0x1005db00
+r 0x1005db40
+r 0x1005db80
+w 0x1005dbc0
+r 0x1005dc00
+r 0x1005dc40
+r 0x1005dc80
+w 0x1005dcc0
+r 0x1005dd00
+r 0x1005dd40
+r 0x1005dd80
+w 0x1005ddc0
+r 0x1005de00
+r 0x1005de40
+r 0x1005de80
+w 0x1005dec0
+r 0x1005df00
+r 0x1005df40
+r 0x1005df80
+w 0x1005dfc0
+r 0x1005e000
+r 0x1005e040
+r 0x1005e080
+w 0x1005e0c0
+r 0x1005e100
+r 0x1005e140
+r 0x1005e180
+w 0x1005e1c0
+r 0x1005e200
+r 0x1005e240
+r 0x1005e280
+w 0x1005e2c0
+r 0x1005e300
+r 0x1005e340
+r 0x1005e380
+w 0x1005e3c0
+r 0x1005e400
+r 0x1005e440
+r 0x1005e480
+w 0x1005e4c0
+r 0x1005e500
+r 0x1005e540
+r 0x1005e580
+w 0x1005e5c0
+r 0x1005e600
+r 0x1005e640
+r 0x1005e680
+w 0x1005e6c0
+r 0x1005e700
+r 0x1005e740
+r 0x1005e780
+w 0x1005e7c0
+r 0x1005e800
+r 0x1005e840
+r 0x1005e880
+w 0x1005e8c0
+r 0x1005e900
+r 0x1005e940
+r 0x1005e980
+w 0x1005e9c0
+r 0x1005ea00
+r 0x1005ea40
+r 0x1005ea80
+w 0x1005eac0
+r 0x1005eb00
+r 0x1005eb40
+r 0x1005eb80
+w 0x1005ebc0
+r 0x1005ec00
+r 0x1005ec40
+r 0x1005ec80
+w 0x1005ecc0
+r 0x1005ed00
+r 0x1005ed40
+r 0x1005ed80
+w 0x1005edc0
+r 0x1005ee00
+r 0x1005ee40
+r 0x1005ee80
+w 0x1005eec0
+r 0x1005ef00
+r 0x1005ef40
+r 0x1005ef80
+w 0x1005efc0
+r 0x1005f000
+r 0x1005f040
+r 0x1005f080
+w 0x1005f0c0
+r 0x1005f100
+r 0x1005f140
+r 0x1005f180
+w 0x1005f1c0
+r 0x1005f200
+r 0x1005f240
+r 0x1005f280
+w 0x1005f2c0
+r 0x1005f300
+r 0x1005f340
+r 0x1005f380
+w 0x1005f3c0
+r 0x1005f400
+r 0x1005f440
+r 0x1005f480
+w 0x1005f4c0
+r 0x1005f500
+r 0x1005f540
+r 0x1005f580
+w 0x1005f5c0
+r 0x1005f600
+r 0x1005f640
+r 0x1005f680
+w 0x1005f6c0
+r 0x1005f700
+r 0x1005f740
+r 0x1005f780
+w 0x1005f7c0
+r 0x1005f800
+r 0x1005f840
+r 0x1005f880
+w 0x1005f8c0
+r 0x1005f900
+r 0x1005f940
+r 0x1005f980
+w 0x1005f9c0
+r 0x1005fa00
+r 0x1005fa40
+r 0x1005fa80
+w 0x1005fac0
+r 0x1005fb00
+r 0x1005fb40
+r 0x1005fb80
+w 0x1005fbc0
+r 0x1005fc00
+r 0x1005fc40
+r 0x1005fc80
+w 0x1005fcc0
+r 0x1005fd00
+r 0x1005fd40
+r 0x1005fd80
+w 0x1005fdc0
+r 0x1005fe00
+r 0x1005fe40
+r 0x1005fe80
+w 0x1005fec0
+r 0x1005ff00
+r 0x1005ff40
+r 0x1005ff80
+w 0x1005ffc0
+r 0x10060000
+r 0x10060040
+r 0x10060080
+w 0x100600c0
+r 0x10060100
+r 0x10060140
+r 0x10060180
+w 0x100601c0
+r 0x10060200
+r 0x10060240
+r 0x10060280
+w 0x100602c0
+r 0x10060300
+r 0x10060340
+r 0x10060380
+w 0x100603c0
+r 0x10060400
+r 0x10060440
+r 0x10060480
+w 0x100604c0
+r 0x10060500
+r 0x10060540
+r 0x10060580
+w 0x100605c0
+r 0x10060600
+r 0x10060640
+r 0x10060680
+w 0x100606c0
+r 0x10060700
+r 0x10060740
+r 0x10060780
+w 0x100607c0
+r 0x10060800
+r 0x10060840
+r 0x10060880
+w 0x100608c0
+r 0x10060900
+r 0x10060940
+r 0x10060980
+w 0x100609c0
+r 0x10060a00
+r 0x10060a40
+r 0x10060a80
+w 0x10060ac0
+r 0x10060b00
+r 0x10060b40
+r 0x10060b80
+w 0x10060bc0
+r 0x10060c00
+r 0x10060c40
+r 0x10060c80
+w 0x10060cc0
+r 0x10060d00
+r 0x10060d40
+r 0x10060d80
+w 0x10060dc0
+r 0x10060e00
+r 0x10060e40
+r 0x10060e80
+w 0x10060ec0
+r 0x10060f00
+r 0x10060f40
+r 0x10060f80
+w 0x10060fc0
+r 0x10061000
+r 0x10061040
+r 0x10061080
+w 0x100610c0
+r 0x10061100
+r 0x10061140
+r 0x10061180
+w 0x100611c0
+r 0x10061200
+r 0x10061240
+r 0x10061280
+w 0x100612c0
+r 0x10061300
+r 0x10061340
+r 0x10061380
+w 0x100613c0
+r 0x10061400
+r 0x10061440
+r 0x10061480
+w 0x100614c0
+r 0x10061500
+r 0x10061540
+r 0x10061580
+w 0x100615c0
+r 0x10061600
+r 0x10061640
+r 0x10061680
+w 0x100616c0
+r 0x10061700
+r 0x10061740
+r 0x10061780
+w 0x100617c0
+r 0x10061800
+r 0x10061840
+r 0x10061880
+w 0x100618c0
+r 0x10061900
+r 0x10061940
+r 0x10061980
+w 0x100619c0
+r 0x10061a00
+r 0x10061a40
+r 0x10061a80
+w 0x10061ac0
+r 0x10061b00
+r 0x10061b40
+r 0x10061b80
+w 0x10061bc0
+r 0x10061c00
+r 0x10061c40
+r 0x10061c80
+w 0x10061cc0
+r 0x10061d00
+r 0x10061d40
+r 0x10061d80
+w 0x10061dc0
+r 0x10061e00
+r 0x10061e40
+r 0x10061e80
+w 0x10061ec0
+r 0x10061f00
+r 0x10061f40
+r 0x10061f80
+w 0x10061fc0
+r 0x10062000
+r 0x10062040
+r 0x10062080
+w 0x100620c0
+r 0x10062100
+r 0x10062140
+r 0x10062180
+w 0x100621c0
+r 0x10062200
+r 0x10062240
+r 0x10062280
+w 0x100622c0
+r 0x10062300
+r 0x10062340
+r 0x10062380
+w 0x100623c0
+r 0x10062400
+r 0x10062440
+r 0x10062480
+w 0x100624c0
+r 0x10062500
+r 0x10062540
+r 0x10062580
+w 0x100625c0
+r 0x10062600
+r 0x10062640
+r 0x10062680
+w 0x100626c0
+r 0x10062700
+r 0x10062740
+r 0x10062780
+w 0x100627c0
+r 0x10062800
+r 0x10062840
+r 0x10062880
+w 0x100628c0
+r 0x10062900
+r 0x10062940
+r 0x10062980
+w 0x100629c0
+r 0x10062a00
+r 0x10062a40
+r 0x10062a80
+w 0x10062ac0
+r 0x10062b00
+r 0x10062b40
+r 0x10062b80
+w 0x10062bc0
+r 0x10062c00
+r 0x10062c40
+r 0x10062c80
+w 0x10062cc0
+r 0x10062d00
+r 0x10062d40
+r 0x10062d80
+w 0x10062dc0
+r 0x10062e00
+r 0x10062e40
+r 0x10062e80
+w 0x10062ec0
+r 0x10062f00
+r 0x10062f40
+r 0x10062f80
+w 0x10062fc0
+r 0x10063000
+r 0x10063040
+r 0x10063080
+w 0x100630c0
+r 0x10063100
+r 0x10063140
+r 0x10063180
+w 0x100631c0
+r 0x10063200
+r 0x10063240
+r 0x10063280
+w 0x100632c0
+r 0x10063300
+r 0x10063340
+r 0x10063380
+w 0x100633c0
+r 0x10063400
+r 0x10063440
+r 0x10063480
+w 0x100634c0
+r 0x10063500
+r 0x10063540
+r 0x10063580
+w 0x100635c0
+r 0x10063600
+r 0x10063640
+r 0x10063680
+w 0x100636c0
+r 0x10063700
+r 0x10063740
+r 0x10063780
+w 0x100637c0
+r 0x10063800
+r 0x10063840
+r 0x10063880
+w 0x100638c0
+r 0x10063900
+r 0x10063940
+r 0x10063980
+w 0x100639c0
+r 0x10063a00
+r 0x10063a40
+r 0x10063a80
+w 0x10063ac0
+r 0x10063b00
+r 0x10063b40
+r 0x10063b80
+w 0x10063bc0
+r 0x10063c00
+r 0x10063c40
+r 0x10063c80
+w 0x10063cc0
+r 0x10063d00
+r 0x10063d40
+r 0x10063d80
+w 0x10063dc0
+r 0x10063e00
+r 0x10063e40
+r 0x10063e80
+w 0x10063ec0
+r 0x10063f00
+r 0x10063f40
+r 0x10063f80
+w 0x10063fc0
+r 0x10064000
+r 0x10064040
+r 0x10064080
+w 0x100640c0
+r 0x10064100
+r 0x10064140
+r 0x10064180
+w 0x100641c0
+r 0x10064200
+r 0x10064240
+r 0x10064280
+w 0x100642c0
+r 0x10064300
+r 0x10064340
+r 0x10064380
+w 0x100643c0
+r 0x10064400
+r 0x10064440
+r 0x10064480
+w 0x100644c0
+r 0x10064500
+r 0x10064540
+r 0x10064580
+w 0x100645c0
+r 0x10064600
+r 0x10064640
+r 0x10064680
+w 0x100646c0
+r 0x10064700
+r 0x10064740
+r 0x10064780
+w 0x100647c0
+r 0x10064800
+r 0x10064840
+r 0x10064880
+w 0x100648c0
+r 0x10064900
+r 0x10064940
+r 0x10064980
+w 0x100649c0
+r 0x10064a00
+r 0x10064a40
+r 0x10064a80
+w 0x10064ac0
+r 0x10064b00
+r 0x10064b40
+r 0x10064b80
+w 0x10064bc0
+r 0x10064c00
+r 0x10064c40
+r 0x10064c80
+w 0x10064cc0
+r 0x10064d00
+r 0x10064d40
+r 0x10064d80
+w 0x10064dc0
+r 0x10064e00
+r 0x10064e40
+r 0x10064e80
+w 0x10064ec0
+r 0x10064f00
+r 0x10064f40
+r 0x10064f80
+w 0x10064fc0
+r 0x10065000
+r 0x10065040
+r 0x10065080
+w 0x100650c0
+r 0x10065100
+r 0x10065140
+r 0x10065180
+w 0x100651c0
+r 0x10065200
+r 0x10065240
+r 0x10065280
+w 0x100652c0
+r 0x10065300
+r 0x10065340
+r 0x10065380
+w 0x100653c0
+r 0x10065400
+r 0x10065440
+r 0x10065480
+w 0x100654c0
+r 0x10065500
+r 0x10065540
+r 0x10065580
+w 0x100655c0
+r 0x10065600
+r 0x10065640
+r 0x10065680
+w 0x100656c0
+r 0x10065700
+r 0x10065740
+r 0x10065780
+w 0x100657c0
+r 0x10065800
+r 0x10065840
+r 0x10065880
+w 0x100658c0
+r 0x10065900
+r 0x10065940
+r 0x10065980
+w 0x100659c0
+r 0x10065a00
+r 0x10065a40
+r 0x10065a80
+w 0x10065ac0
+r 0x10065b00
+r 0x10065b40
+r 0x10065b80
+w 0x10065bc0
+r 0x10065c00
+r 0x10065c40
+r 0x10065c80
+w 0x10065cc0
+r 0x10065d00
+r 0x10065d40
+r 0x10065d80
+w 0x10065dc0
+r 0x10065e00
+r 0x10065e40
+r 0x10065e80
+w 0x10065ec0
+r 0x10065f00
+r 0x10065f40
+r 0x10065f80
+w 0x10065fc0
+r 0x10066000
+r 0x10066040
+r 0x10066080
+w 0x100660c0
+r 0x10066100
+r 0x10066140
+r 0x10066180
+w 0x100661c0
+r 0x10066200
+r 0x10066240
+r 0x10066280
+w 0x100662c0
+r 0x10066300
+r 0x10066340
+r 0x10066380
+w 0x100663c0
+r 0x10066400
+r 0x10066440
+r 0x10066480
+w 0x100664c0
+r 0x10066500
+r 0x10066540
+r 0x10066580
+w 0x100665c0
+r 0x10066600
+r 0x10066640
+r 0x10066680
+w 0x100666c0
+r 0x10066700
+r 0x10066740
+r 0x10066780
+w 0x100667c0
+r 0x10066800
+r 0x10066840
+r 0x10066880
+w 0x100668c0
+r 0x10066900
+r 0x10066940
+r 0x10066980
+w 0x100669c0
+r 0x10066a00
+r 0x10066a40
+r 0x10066a80
+w 0x10066ac0
+r 0x10066b00
+r 0x10066b40
+r 0x10066b80
+w 0x10066bc0
+r 0x10066c00
+r 0x10066c40
+r 0x10066c80
+w 0x10066cc0
+r 0x10066d00
+r 0x10066d40
+r 0x10066d80
+w 0x10066dc0
+r 0x10066e00
+r 0x10066e40
+r 0x10066e80
+w 0x10066ec0
+r 0x10066f00
+r 0x10066f40
+r 0x10066f80
+w 0x10066fc0
+r 0x10067000
+r 0x10067040
+r 0x10067080
+w 0x100670c0
+r 0x10067100
+r 0x10067140
+r 0x10067180
+w 0x100671c0
+r 0x10067200
+r 0x10067240
+r 0x10067280
+w 0x100672c0
+r 0x10067300
+r 0x10067340
+r 0x10067380
+w 0x100673c0
+r 0x10067400
+r 0x10067440
+r 0x10067480
+w 0x100674c0
+r 0x10067500
+r 0x10067540
+r 0x10067580
+w 0x100675c0
+r 0x10067600
+r 0x10067640
+r 0x10067680
+w 0x100676c0
+r 0x10067700
+r 0x10067740
+r 0x10067780
+w 0x100677c0
+r 0x10067800
+r 0x10067840
+r 0x10067880
+w 0x100678c0
+r 0x10067900
+r 0x10067940
+r 0x10067980
+w 0x100679c0
+r 0x10067a00
+r 0x10067a40
+r 0x10067a80
+w 0x10067ac0
+r 0x10067b00
+r 0x10067b40
+r 0x10067b80
+w 0x10067bc0
+r 0x10067c00
+r 0x10067c40
+r 0x10067c80
+w 0x10067cc0
+r 0x10067d00
+r 0x10067d40
+r 0x10067d80
+w 0x10067dc0
+r 0x10067e00
+r 0x10067e40
+r 0x10067e80
+w 0x10067ec0
+r 0x10067f00
+r 0x10067f40
+r 0x10067f80
+w 0x10067fc0
+r 0x10068000
+r 0x10068040
+r 0x10068080
+w 0x100680c0
+r 0x10068100
+r 0x10068140
+r 0x10068180
+w 0x100681c0
+r 0x10068200
+r 0x10068240
+r 0x10068280
+w 0x100682c0
+r 0x10068300
+r 0x10068340
+r 0x10068380
+w 0x100683c0
+r 0x10068400
+r 0x10068440
+r 0x10068480
+w 0x100684c0
+r 0x10068500
+r 0x10068540
+r 0x10068580
+w 0x100685c0
+r 0x10068600
+r 0x10068640
+r 0x10068680
+w 0x100686c0
+r 0x10068700
+r 0x10068740
+r 0x10068780
+w 0x100687c0
+r 0x10068800
+r 0x10068840
+r 0x10068880
+w 0x100688c0
+r 0x10068900
+r 0x10068940
+r 0x10068980
+w 0x100689c0
+r 0x10068a00
+r 0x10068a40
+r 0x10068a80
+w 0x10068ac0
+r 0x10068b00
+r 0x10068b40
+r 0x10068b80
+w 0x10068bc0
+r 0x10068c00
+r 0x10068c40
+r 0x10068c80
+w 0x10068cc0
+r 0x10068d00
+r 0x10068d40
+r 0x10068d80
+w 0x10068dc0
+r 0x10068e00
+r 0x10068e40
+r 0x10068e80
+w 0x10068ec0
+r 0x10068f00
+r 0x10068f40
+r 0x10068f80
+w 0x10068fc0
+r 0x10069000
+r 0x10069040
+r 0x10069080
+w 0x100690c0
+r 0x10069100
+r 0x10069140
+r 0x10069180
+w 0x100691c0
+r 0x10069200
+r 0x10069240
+r 0x10069280
+w 0x100692c0
+r 0x10069300
+r 0x10069340
+r 0x10069380
+w 0x100693c0
+r 0x10069400
+r 0x10069440
+r 0x10069480
+w 0x100694c0
+r 0x10069500
+r 0x10069540
+r 0x10069580
+w 0x100695c0
+r 0x10069600
+r 0x10069640
+r 0x10069680
+w 0x100696c0
+r 0x10069700
+r 0x10069740
+r 0x10069780
+w 0x100697c0
+r 0x10069800
+r 0x10069840
+r 0x10069880
+w 0x100698c0
+r 0x10069900
+r 0x10069940
+r 0x10069980
+w 0x100699c0
+r 0x10069a00
+r 0x10069a40
+r 0x10069a80
+w 0x10069ac0
+r 0x10069b00
+r 0x10069b40
+r 0x10069b80
+w 0x10069bc0
+r 0x10069c00
+r 0x10069c40
+r 0x10069c80
+w 0x10069cc0
+r 0x10069d00
+r 0x10069d40
+r 0x10069d80
+w 0x10069dc0
+r 0x10069e00
+r 0x10069e40
+r 0x10069e80
+w 0x10069ec0
+r 0x10069f00
+r 0x10069f40
+r 0x10069f80
+w 0x10069fc0
+r 0x1006a000
+r 0x1006a040
+r 0x1006a080
+w 0x1006a0c0
+r 0x1006a100
+r 0x1006a140
+r 0x1006a180
+w 0x1006a1c0
+r 0x1006a200
+r 0x1006a240
+r 0x1006a280
+w 0x1006a2c0
+r 0x1006a300
+r 0x1006a340
+r 0x1006a380
+w 0x1006a3c0
+r 0x1006a400
+r 0x1006a440
+r 0x1006a480
+w 0x1006a4c0
+r 0x1006a500
+r 0x1006a540
+r 0x1006a580
+w 0x1006a5c0
+r 0x1006a600
+r 0x1006a640
+r 0x1006a680
+w 0x1006a6c0
+r 0x1006a700
+r 0x1006a740
+r 0x1006a780
+w 0x1006a7c0
+r 0x1006a800
+r 0x1006a840
+r 0x1006a880
+w 0x1006a8c0
+r 0x1006a900
+r 0x1006a940
+r 0x1006a980
+w 0x1006a9c0
+r 0x1006aa00
+r 0x1006aa40
+r 0x1006aa80
+w 0x1006aac0
+r 0x1006ab00
+r 0x1006ab40
+r 0x1006ab80
+w 0x1006abc0
+r 0x1006ac00
+r 0x1006ac40
+r 0x1006ac80
+w 0x1006acc0
+r 0x1006ad00
+r 0x1006ad40
+r 0x1006ad80
+w 0x1006adc0
+r 0x1006ae00
+r 0x1006ae40
+r 0x1006ae80
+w 0x1006aec0
+r 0x1006af00
+r 0x1006af40
+r 0x1006af80
+w 0x1006afc0
+r 0x1006b000
+r 0x1006b040
+r 0x1006b080
+w 0x1006b0c0
+r 0x1006b100
+r 0x1006b140
+r 0x1006b180
+w 0x1006b1c0
+r 0x1006b200
+r 0x1006b240
+r 0x1006b280
+w 0x1006b2c0
+r 0x1006b300
+r 0x1006b340
+r 0x1006b380
+w 0x1006b3c0
+r 0x1006b400
+r 0x1006b440
+r 0x1006b480
+w 0x1006b4c0
+r 0x1006b500
+r 0x1006b540
+r 0x1006b580
+w 0x1006b5c0
+r 0x1006b600
+r 0x1006b640
+r 0x1006b680
+w 0x1006b6c0
+r 0x1006b700
+r 0x1006b740
+r 0x1006b780
+w 0x1006b7c0
+r 0x1006b800
+r 0x1006b840
+r 0x1006b880
+w 0x1006b8c0
+r 0x1006b900
+r 0x1006b940
+r 0x1006b980
+w 0x1006b9c0
+r 0x1006ba00
+r 0x1006ba40
+r 0x1006ba80
+w 0x1006bac0
+r 0x1006bb00
+r 0x1006bb40
+r 0x1006bb80
+w 0x1006bbc0
+r 0x1006bc00
+r 0x1006bc40
+r 0x1006bc80
+w 0x1006bcc0
+r 0x1006bd00
+r 0x1006bd40
+r 0x1006bd80
+w 0x1006bdc0
+r 0x1006be00
+r 0x1006be40
+r 0x1006be80
+w 0x1006bec0
+r 0x1006bf00
+r 0x1006bf40
+r 0x1006bf80
+w 0x1006bfc0
+r 0x1006c000
+r 0x1006c040
+r 0x1006c080
+w 0x1006c0c0
+r 0x1006c100
+r 0x1006c140
+r 0x1006c180
+w 0x1006c1c0
+r 0x1006c200
+r 0x1006c240
+r 0x1006c280
+w 0x1006c2c0
+r 0x1006c300
+r 0x1006c340
+r 0x1006c380
+w 0x1006c3c0
+r 0x1006c400
+r 0x1006c440
+r 0x1006c480
+w 0x1006c4c0
+r 0x1006c500
+r 0x1006c540
+r 0x1006c580
+w 0x1006c5c0
+r 0x1006c600
+r 0x1006c640
+r 0x1006c680
+w 0x1006c6c0
+r 0x1006c700
+r 0x1006c740
+r 0x1006c780
+w 0x1006c7c0
+r 0x1006c800
+r 0x1006c840
+r 0x1006c880
+w 0x1006c8c0
+r 0x1006c900
+r 0x1006c940
+r 0x1006c980
+w 0x1006c9c0
+r 0x1006ca00
+r 0x1006ca40
+r 0x1006ca80
+w 0x1006cac0
+r 0x1006cb00
+r 0x1006cb40
+r 0x1006cb80
+w 0x1006cbc0
+r 0x1006cc00
+r 0x1006cc40
+r 0x1006cc80
+w 0x1006ccc0
+r 0x1006cd00
+r 0x1006cd40
+r 0x1006cd80
+w 0x1006cdc0
+r 0x1006ce00
+r 0x1006ce40
+r 0x1006ce80
+w 0x1006cec0
+r 0x1006cf00
+r 0x1006cf40
+r 0x1006cf80
+w 0x1006cfc0
+r 0x1006d000
+r 0x1006d040
+r 0x1006d080
+w 0x1006d0c0
+r 0x1006d100
+r 0x1006d140
+r 0x1006d180
+w 0x1006d1c0
+r 0x1006d200
+r 0x1006d240
+r 0x1006d280
+w 0x1006d2c0
+r 0x1006d300
+r 0x1006d340
+r 0x1006d380
+w 0x1006d3c0
+r 0x1006d400
+r 0x1006d440
+r 0x1006d480
+w 0x1006d4c0
+r 0x1006d500
+r 0x1006d540
+r 0x1006d580
+w 0x1006d5c0
+r 0x1006d600
+r 0x1006d640
+r 0x1006d680
+w 0x1006d6c0
+r 0x1006d700
+r 0x1006d740
+r 0x1006d780
+w 0x1006d7c0
+r 0x1006d800
+r 0x1006d840
+r 0x1006d880
+w 0x1006d8c0
+r 0x1006d900
+r 0x1006d940
+r 0x1006d980
+w 0x1006d9c0
+r 0x1006da00
+r 0x1006da40
+r 0x1006da80
+w 0x1006dac0
+r 0x1006db00
+r 0x1006db40
+r 0x1006db80
+w 0x1006dbc0
+r 0x1006dc00
+r 0x1006dc40
+r 0x1006dc80
+w 0x1006dcc0
+r 0x1006dd00
+r 0x1006dd40
+r 0x1006dd80
+w 0x1006ddc0
+r 0x1006de00
+r 0x1006de40
+r 0x1006de80
+w 0x1006dec0
+r 0x1006df00
+r 0x1006df40
+r 0x1006df80
+w 0x1006dfc0
+r 0x1006e000
+r 0x1006e040
+r 0x1006e080
+w 0x1006e0c0
+r 0x1006e100
+r 0x1006e140
+r 0x1006e180
+w 0x1006e1c0
+r 0x1006e200
+r 0x1006e240
+r 0x1006e280
+w 0x1006e2c0
+r 0x1006e300
+r 0x1006e340
+r 0x1006e380
+w 0x1006e3c0
+r 0x1006e400
+r 0x1006e440
+r 0x1006e480
+w 0x1006e4c0
+r 0x1006e500
+r 0x1006e540
+r 0x1006e580
+w 0x1006e5c0
+r 0x1006e600
+r 0x1006e640
+r 0x1006e680
+w 0x1006e6c0
+r 0x1006e700
+r 0x1006e740
+r 0x1006e780
+w 0x1006e7c0
+r 0x1006e800
+r 0x1006e840
+r 0x1006e880
+w 0x1006e8c0
+r 0x1006e900
+r 0x1006e940
+r 0x1006e980
+w 0x1006e9c0
+r 0x1006ea00
+r 0x1006ea40
+r 0x1006ea80
+w 0x1006eac0
+r 0x1006eb00
+r 0x1006eb40
+r 0x1006eb80
+w 0x1006ebc0
+r 0x1006ec00
+r 0x1006ec40
+r 0x1006ec80
+w 0x1006ecc0
+r 0x1006ed00
+r 0x1006ed40
+r 0x1006ed80
+w 0x1006edc0
+r 0x1006ee00
+r 0x1006ee40
+r 0x1006ee80
+w 0x1006eec0
+r 0x1006ef00
+r 0x1006ef40
+r 0x1006ef80
+w 0x1006efc0
+r 0x1006f000
+r 0x1006f040
+r 0x1006f080
+w 0x1006f0c0
+r 0x1006f100
+r 0x1006f140
+r 0x1006f180
+w 0x1006f1c0
+r 0x1006f200
+r 0x1006f240
+r 0x1006f280
+w 0x1006f2c0
+r 0x1006f300
+r 0x1006f340
+r 0x1006f380
+w 0x1006f3c0
+r 0x1006f400
+r 0x1006f440
+r 0x1006f480
+w 0x1006f4c0
+r 0x1006f500
+r 0x1006f540
+r 0x1006f580
+w 0x1006f5c0
+r 0x1006f600
+r 0x1006f640
+r 0x1006f680
+w 0x1006f6c0
+r 0x1006f700
+r 0x1006f740
+r 0x1006f780
+w 0x1006f7c0
+r 0x1006f800
+r 0x1006f840
+r 0x1006f880
+w 0x1006f8c0
+r 0x1006f900
+r 0x1006f940
+r 0x1006f980
+w 0x1006f9c0
+r 0x1006fa00
+r 0x1006fa40
+r 0x1006fa80
+w 0x1006fac0
+r 0x1006fb00
+r 0x1006fb40
+r 0x1006fb80
+w 0x1006fbc0
+r 0x1006fc00
+r 0x1006fc40
+r 0x1006fc80
+w 0x1006fcc0
+r 0x1006fd00
+r 0x1006fd40
+r 0x1006fd80
+w 0x1006fdc0
+r 0x1006fe00
+r 0x1006fe40
+r 0x1006fe80
+w 0x1006fec0
+r 0x1006ff00
+r 0x1006ff40
+r 0x1006ff80
+w 0x1006ffc0
+r 0x10070000
+r 0x10070040
+r 0x10070080
+w 0x100700c0
+r 0x10070100
+r 0x10070140
+r 0x10070180
+w 0x100701c0
+r 0x10070200
+r 0x10070240
+r 0x10070280
+w 0x100702c0
+r 0x10070300
+r 0x10070340
+r 0x10070380
+w 0x100703c0
+r 0x10070400
+r 0x10070440
+r 0x10070480
+w 0x100704c0
+r 0x10070500
+r 0x10070540
+r 0x10070580
+w 0x100705c0
+r 0x10070600
+r 0x10070640
+r 0x10070680
+w 0x100706c0
+r 0x10070700
+r 0x10070740
+r 0x10070780
+w 0x100707c0
+r 0x10070800
+r 0x10070840
+r 0x10070880
+w 0x100708c0
+r 0x10070900
+r 0x10070940
+r 0x10070980
+w 0x100709c0
+r 0x10070a00
+r 0x10070a40
+r 0x10070a80
+w 0x10070ac0
+r 0x10070b00
+r 0x10070b40
+r 0x10070b80
+w 0x10070bc0
+r 0x10070c00
+r 0x10070c40
+r 0x10070c80
+w 0x10070cc0
+r 0x10070d00
+r 0x10070d40
+r 0x10070d80
+w 0x10070dc0
+r 0x10070e00
+r 0x10070e40
+r 0x10070e80
+w 0x10070ec0
+r 0x10070f00
+r 0x10070f40
+r 0x10070f80
+w 0x10070fc0
+r 0x10071000
+r 0x10071040
+r 0x10071080
+w 0x100710c0
+r 0x10071100
+r 0x10071140
+r 0x10071180
+w 0x100711c0
+r 0x10071200
+r 0x10071240
+r 0x10071280
+w 0x100712c0
+r 0x10071300
+r 0x10071340
+r 0x10071380
+w 0x100713c0
+r 0x10071400
+r 0x10071440
+r 0x10071480
+w 0x100714c0
+r 0x10071500
+r 0x10071540
+r 0x10071580
+w 0x100715c0
+r 0x10071600
+r 0x10071640
+r 0x10071680
+w 0x100716c0
+r 0x10071700
+r 0x10071740
+r 0x10071780
+w 0x100717c0
+r 0x10071800
+r 0x10071840
+r 0x10071880
+w 0x100718c0
+r 0x10071900
+r 0x10071940
+r 0x10071980
+w 0x100719c0
+r 0x10071a00
+r 0x10071a40
+r 0x10071a80
+w 0x10071ac0
+r 0x10071b00
+r 0x10071b40
+r 0x10071b80
+w 0x10071bc0
+r 0x10071c00
+r 0x10071c40
+r 0x10071c80
+w 0x10071cc0
+r 0x10071d00
+r 0x10071d40
+r 0x10071d80
+w 0x10071dc0
+r 0x10071e00
+r 0x10071e40
+r 0x10071e80
+w 0x10071ec0
+r 0x10071f00
+r 0x10071f40
+r 0x10071f80
+w 0x10071fc0
+r 0x10072000
+r 0x10072040
+r 0x10072080
+w 0x100720c0
+r 0x10072100
+r 0x10072140
+r 0x10072180
+w 0x100721c0
+r 0x10072200
+r 0x10072240
+r 0x10072280
+w 0x100722c0
+r 0x10072300
+r 0x10072340
+r 0x10072380
+w 0x100723c0
+r 0x10072400
+r 0x10072440
+r 0x10072480
+w 0x100724c0
+r 0x10072500
+r 0x10072540
+r 0x10072580
+w 0x100725c0
+r 0x10072600
+r 0x10072640
+r 0x10072680
+w 0x100726c0
+r 0x10072700
+r 0x10072740
+r 0x10072780
+w 0x100727c0
+r 0x10072800
+r 0x10072840
+r 0x10072880
+w 0x100728c0
+r 0x10072900
+r 0x10072940
+r 0x10072980
+w 0x100729c0
+r 0x10072a00
+r 0x10072a40
+r 0x10072a80
+w 0x10072ac0
+r 0x10072b00
+r 0x10072b40
+r 0x10072b80
+w 0x10072bc0
+r 0x10072c00
+r 0x10072c40
+r 0x10072c80
+w 0x10072cc0
+r 0x10072d00
+r 0x10072d40
+r 0x10072d80
+w 0x10072dc0
+r 0x10072e00
+r 0x10072e40
+r 0x10072e80
+w 0x10072ec0
+r 0x10072f00
+r 0x10072f40
+r 0x10072f80
+w 0x10072fc0
+r 0x10073000
+r 0x10073040
+r 0x10073080
+w 0x100730c0
+r 0x10073100
+r 0x10073140
+r 0x10073180
+w 0x100731c0
+r 0x10073200
+r 0x10073240
+r 0x10073280
+w 0x100732c0
+r 0x10073300
+r 0x10073340
+r 0x10073380
+w 0x100733c0
+r 0x10073400
+r 0x10073440
+r 0x10073480
+w 0x100734c0
+r 0x10073500
+r 0x10073540
+r 0x10073580
+w 0x100735c0
+r 0x10073600
+r 0x10073640
+r 0x10073680
+w 0x100736c0
+r 0x10073700
+r 0x10073740
+r 0x10073780
+w 0x100737c0
+r 0x10073800
+r 0x10073840
+r 0x10073880
+w 0x100738c0
+r 0x10073900
+r 0x10073940
+r 0x10073980
+w 0x100739c0
+r 0x10073a00
+r 0x10073a40
+r 0x10073a80
+w 0x10073ac0
+r 0x10073b00
+r 0x10073b40
+r 0x10073b80
+w 0x10073bc0
+r 0x10073c00
+r 0x10073c40
+r 0x10073c80
+w 0x10073cc0
+r 0x10073d00
+r 0x10073d40
+r 0x10073d80
+w 0x10073dc0
+r 0x10073e00
+r 0x10073e40
+r 0x10073e80
+w 0x10073ec0
+r 0x10073f00
+r 0x10073f40
+r 0x10073f80
+w 0x10073fc0
+r 0x10074000
+r 0x10074040
+r 0x10074080
+w 0x100740c0
+r 0x10074100
+r 0x10074140
+r 0x10074180
+w 0x100741c0
+r 0x10074200
+r 0x10074240
+r 0x10074280
+w 0x100742c0
+r 0x10074300
+r 0x10074340
+r 0x10074380
+w 0x100743c0
+r 0x10074400
+r 0x10074440
+r 0x10074480
+w 0x100744c0
+r 0x10074500
+r 0x10074540
+r 0x10074580
+w 0x100745c0
+r 0x10074600
+r 0x10074640
+r 0x10074680
+w 0x100746c0
+r 0x10074700
+r 0x10074740
+r 0x10074780
+w 0x100747c0
+r 0x10074800
+r 0x10074840
+r 0x10074880
+w 0x100748c0
+r 0x10074900
+r 0x10074940
+r 0x10074980
+w 0x100749c0
+r 0x10074a00
+r 0x10074a40
+r 0x10074a80
+w 0x10074ac0
+r 0x10074b00
+r 0x10074b40
+r 0x10074b80
+w 0x10074bc0
+r 0x10074c00
+r 0x10074c40
+r 0x10074c80
+w 0x10074cc0
+r 0x10074d00
+r 0x10074d40
+r 0x10074d80
+w 0x10074dc0
+r 0x10074e00
+r 0x10074e40
+r 0x10074e80
+w 0x10074ec0
+r 0x10074f00
+r 0x10074f40
+r 0x10074f80
+w 0x10074fc0
+r 0x10075000
+r 0x10075040
+r 0x10075080
+w 0x100750c0
+r 0x10075100
+r 0x10075140
+r 0x10075180
+w 0x100751c0
+r 0x10075200
+r 0x10075240
+r 0x10075280
+w 0x100752c0
+r 0x10075300
+r 0x10075340
+r 0x10075380
+w 0x100753c0
+r 0x10075400
+r 0x10075440
+r 0x10075480
+w 0x100754c0
+r 0x10075500
+r 0x10075540
+r 0x10075580
+w 0x100755c0
+r 0x10075600
+r 0x10075640
+r 0x10075680
+w 0x100756c0
+r 0x10075700
+r 0x10075740
+r 0x10075780
+w 0x100757c0
+r 0x10075800
+r 0x10075840
+r 0x10075880
+w 0x100758c0
+r 0x10075900
+r 0x10075940
+r 0x10075980
+w 0x100759c0
+r 0x10075a00
+r 0x10075a40
+r 0x10075a80
+w 0x10075ac0
+r 0x10075b00
+r 0x10075b40
+r 0x10075b80
+w 0x10075bc0
+r 0x10075c00
+r 0x10075c40
+r 0x10075c80
+w 0x10075cc0
+r 0x10075d00
+r 0x10075d40
+r 0x10075d80
+w 0x10075dc0
+r 0x10075e00
+r 0x10075e40
+r 0x10075e80
+w 0x10075ec0
+r 0x10075f00
+r 0x10075f40
+r 0x10075f80
+w 0x10075fc0
+r 0x10076000
+r 0x10076040
+r 0x10076080
+w 0x100760c0
+r 0x10076100
+r 0x10076140
+r 0x10076180
+w 0x100761c0
+r 0x10076200
+r 0x10076240
+r 0x10076280
+w 0x100762c0
+r 0x10076300
+r 0x10076340
+r 0x10076380
+w 0x100763c0
+r 0x10076400
+r 0x10076440
+r 0x10076480
+w 0x100764c0
+r 0x10076500
+r 0x10076540
+r 0x10076580
+w 0x100765c0
+r 0x10076600
+r 0x10076640
+r 0x10076680
+w 0x100766c0
+r 0x10076700
+r 0x10076740
+r 0x10076780
+w 0x100767c0
+r 0x10076800
+r 0x10076840
+r 0x10076880
+w 0x100768c0
+r 0x10076900
+r 0x10076940
+r 0x10076980
+w 0x100769c0
+r 0x10076a00
+r 0x10076a40
+r 0x10076a80
+w 0x10076ac0
+r 0x10076b00
+r 0x10076b40
+r 0x10076b80
+w 0x10076bc0
+r 0x10076c00
+r 0x10076c40
+r 0x10076c80
+w 0x10076cc0
+r 0x10076d00
+r 0x10076d40
+r 0x10076d80
+w 0x10076dc0
+r 0x10076e00
+r 0x10076e40
+r 0x10076e80
+w 0x10076ec0
+r 0x10076f00
+r 0x10076f40
+r 0x10076f80
+w 0x10076fc0
+r 0x10077000
+r 0x10077040
+r 0x10077080
+w 0x100770c0
+r 0x10077100
+r 0x10077140
+r 0x10077180
+w 0x100771c0
+r 0x10077200
+r 0x10077240
+r 0x10077280
+w 0x100772c0
+r 0x10077300
+r 0x10077340
+r 0x10077380
+w 0x100773c0
+r 0x10077400
+r 0x10077440
+r 0x10077480
+w 0x100774c0
+r 0x10077500
+r 0x10077540
+r 0x10077580
+w 0x100775c0
+r 0x10077600
+r 0x10077640
+r 0x10077680
+w 0x100776c0
+r 0x10077700
+r 0x10077740
+r 0x10077780
+w 0x100777c0
+r 0x10077800
+r 0x10077840
+r 0x10077880
+w 0x100778c0
+r 0x10077900
+r 0x10077940
+r 0x10077980
+w 0x100779c0
+r 0x10077a00
+r 0x10077a40
+r 0x10077a80
+w 0x10077ac0
+r 0x10077b00
+r 0x10077b40
+r 0x10077b80
+w 0x10077bc0
+r 0x10077c00
+r 0x10077c40
+r 0x10077c80
+w 0x10077cc0
+r 0x10077d00
+r 0x10077d40
+r 0x10077d80
+w 0x10077dc0
+r 0x10077e00
+r 0x10077e40
+r 0x10077e80
+w 0x10077ec0
+r 0x10077f00
+r 0x10077f40
+r 0x10077f80
+w 0x10077fc0
+r 0x10078000
+r 0x10078040
+r 0x10078080
+w 0x100780c0
+r 0x10078100
+r 0x10078140
+r 0x10078180
+w 0x100781c0
+r 0x10078200
+r 0x10078240
+r 0x10078280
+w 0x100782c0
+r 0x10078300
+r 0x10078340
+r 0x10078380
+w 0x100783c0
+r 0x10078400
+r 0x10078440
+r 0x10078480
+w 0x100784c0
+r 0x10078500
+r 0x10078540
+r 0x10078580
+w 0x100785c0
+r 0x10078600
+r 0x10078640
+r 0x10078680
+w 0x100786c0
+r 0x10078700
+r 0x10078740
+r 0x10078780
+w 0x100787c0
+r 0x10078800
+r 0x10078840
+r 0x10078880
+w 0x100788c0
+r 0x10078900
+r 0x10078940
+r 0x10078980
+w 0x100789c0
+r 0x10078a00
+r 0x10078a40
+r 0x10078a80
+w 0x10078ac0
+r 0x10078b00
+r 0x10078b40
+r 0x10078b80
+w 0x10078bc0
+r 0x10078c00
+r 0x10078c40
+r 0x10078c80
+w 0x10078cc0
+r 0x10078d00
+r 0x10078d40
+r 0x10078d80
+w 0x10078dc0
+r 0x10078e00
+r 0x10078e40
+r 0x10078e80
+w 0x10078ec0
+r 0x10078f00
+r 0x10078f40
+r 0x10078f80
+w 0x10078fc0
+r 0x10079000
+r 0x10079040
+r 0x10079080
+w 0x100790c0
+r 0x10079100
+r 0x10079140
+r 0x10079180
+w 0x100791c0
+r 0x10079200
+r 0x10079240
+r 0x10079280
+w 0x100792c0
+r 0x10079300
+r 0x10079340
+r 0x10079380
+w 0x100793c0
+r 0x10079400
+r 0x10079440
+r 0x10079480
+w 0x100794c0
+r 0x10079500
+r 0x10079540
+r 0x10079580
+w 0x100795c0
+r 0x10079600
+r 0x10079640
+r 0x10079680
+w 0x100796c0
+r 0x10079700
+r 0x10079740
+r 0x10079780
+w 0x100797c0
+r 0x10079800
+r 0x10079840
+r 0x10079880
+w 0x100798c0
+r 0x10079900
+r 0x10079940
+r 0x10079980
+w 0x100799c0
+r 0x10079a00
+r 0x10079a40
+r 0x10079a80
+w 0x10079ac0
+r 0x10079b00
+r 0x10079b40
+r 0x10079b80
+w 0x10079bc0
+r 0x10079c00
+r 0x10079c40
+r 0x10079c80
+w 0x10079cc0
+r 0x10079d00
+r 0x10079d40
+r 0x10079d80
+w 0x10079dc0
+r 0x10079e00
+r 0x10079e40
+r 0x10079e80
+w 0x10079ec0
+r 0x10079f00
+r 0x10079f40
+r 0x10079f80
+w 0x10079fc0
+r 0x1007a000
+r 0x1007a040
+r 0x1007a080
+w 0x1007a0c0
+r 0x1007a100
+r 0x1007a140
+r 0x1007a180
+w 0x1007a1c0
+r 0x1007a200
+r 0x1007a240
+r 0x1007a280
+w 0x1007a2c0
+r 0x1007a300
+r 0x1007a340
+r 0x1007a380
+w 0x1007a3c0
+r 0x1007a400
+r 0x1007a440
+r 0x1007a480
+w 0x1007a4c0
+r 0x1007a500
+r 0x1007a540
+r 0x1007a580
+w 0x1007a5c0
+r 0x1007a600
+r 0x1007a640
+r 0x1007a680
+w 0x1007a6c0
+r 0x1007a700
+r 0x1007a740
+r 0x1007a780
+w 0x1007a7c0
+r 0x1007a800
+r 0x1007a840
+r 0x1007a880
+w 0x1007a8c0
+r 0x1007a900
+r 0x1007a940
+r 0x1007a980
+w 0x1007a9c0
+r 0x1007aa00
+r 0x1007aa40
+r 0x1007aa80
+w 0x1007aac0
+r 0x1007ab00
+r 0x1007ab40
+r 0x1007ab80
+w 0x1007abc0
+r 0x1007ac00
+r 0x1007ac40
+r 0x1007ac80
+w 0x1007acc0
+r 0x1007ad00
+r 0x1007ad40
+r 0x1007ad80
+w 0x1007adc0
+r 0x1007ae00
+r 0x1007ae40
+r 0x1007ae80
+w 0x1007aec0
+r 0x1007af00
+r 0x1007af40
+r 0x1007af80
+w 0x1007afc0
+r 0x1007b000
+r 0x1007b040
+r 0x1007b080
+w 0x1007b0c0
+r 0x1007b100
+r 0x1007b140
+r 0x1007b180
+w 0x1007b1c0
+r 0x1007b200
+r 0x1007b240
+r 0x1007b280
+w 0x1007b2c0
+r 0x1007b300
+r 0x1007b340
+r 0x1007b380
+w 0x1007b3c0
+r 0x1007b400
+r 0x1007b440
+r 0x1007b480
+w 0x1007b4c0
+r 0x1007b500
+r 0x1007b540
+r 0x1007b580
+w 0x1007b5c0
+r 0x1007b600
+r 0x1007b640
+r 0x1007b680
+w 0x1007b6c0
+r 0x1007b700
+r 0x1007b740
+r 0x1007b780
+w 0x1007b7c0
+r 0x1007b800
+r 0x1007b840
+r 0x1007b880
+w 0x1007b8c0
+r 0x1007b900
+r 0x1007b940
+r 0x1007b980
+w 0x1007b9c0
+r 0x1007ba00
+r 0x1007ba40
+r 0x1007ba80
+w 0x1007bac0
+r 0x1007bb00
+r 0x1007bb40
+r 0x1007bb80
+w 0x1007bbc0
+r 0x1007bc00
+r 0x1007bc40
+r 0x1007bc80
+w 0x1007bcc0
+r 0x1007bd00
+r 0x1007bd40
+r 0x1007bd80
+w 0x1007bdc0
+r 0x1007be00
+r 0x1007be40
+r 0x1007be80
+w 0x1007bec0
+r 0x1007bf00
+r 0x1007bf40
+r 0x1007bf80
+w 0x1007bfc0
+r 0x1007c000
+r 0x1007c040
+r 0x1007c080
+w 0x1007c0c0
+r 0x1007c100
+r 0x1007c140
+r 0x1007c180
+w 0x1007c1c0
+r 0x1007c200
+r 0x1007c240
+r 0x1007c280
+w 0x1007c2c0
+r 0x1007c300
+r 0x1007c340
+r 0x1007c380
+w 0x1007c3c0
+r 0x1007c400
+r 0x1007c440
+r 0x1007c480
+w 0x1007c4c0
+r 0x1007c500
+r 0x1007c540
+r 0x1007c580
+w 0x1007c5c0
+r 0x1007c600
+r 0x1007c640
+r 0x1007c680
+w 0x1007c6c0
+r 0x1007c700
+r 0x1007c740
+r 0x1007c780
+w 0x1007c7c0
+r 0x1007c800
+r 0x1007c840
+r 0x1007c880
+w 0x1007c8c0
+r 0x1007c900
+r 0x1007c940
+r 0x1007c980
+w 0x1007c9c0
+r 0x1007ca00
+r 0x1007ca40
+r 0x1007ca80
+w 0x1007cac0
+r 0x1007cb00
+r 0x1007cb40
+r 0x1007cb80
+w 0x1007cbc0
+r 0x1007cc00
+r 0x1007cc40
+r 0x1007cc80
+w 0x1007ccc0
+r 0x1007cd00
+r 0x1007cd40
+r 0x1007cd80
+w 0x1007cdc0
+r 0x1007ce00
+r 0x1007ce40
+r 0x1007ce80
+w 0x1007cec0
+r 0x1007cf00
+r 0x1007cf40
+r 0x1007cf80
+w 0x1007cfc0
+r 0x1007d000
+r 0x1007d040
+r 0x1007d080
+w 0x1007d0c0
+r 0x1007d100
+r 0x1007d140
+r 0x1007d180
+w 0x1007d1c0
+r 0x1007d200
+r 0x1007d240
+r 0x1007d280
+w 0x1007d2c0
+r 0x1007d300
+r 0x1007d340
+r 0x1007d380
+w 0x1007d3c0
+r 0x1007d400
+r 0x1007d440
+r 0x1007d480
+w 0x1007d4c0
+r 0x1007d500
+r 0x1007d540
+r 0x1007d580
+w 0x1007d5c0
+r 0x1007d600
+r 0x1007d640
+r 0x1007d680
+w 0x1007d6c0
+r 0x1007d700
+r 0x1007d740
+r 0x1007d780
+w 0x1007d7c0
+r 0x1007d800
+r 0x1007d840
+r 0x1007d880
+w 0x1007d8c0
+r 0x1007d900
+r 0x1007d940
+r 0x1007d980
+w 0x1007d9c0
+r 0x1007da00
+r 0x1007da40
+r 0x1007da80
+w 0x1007dac0
+r 0x1007db00
+r 0x1007db40
+r 0x1007db80
+w 0x1007dbc0
+r 0x1007dc00
+r 0x1007dc40
+r 0x1007dc80
+w 0x1007dcc0
+r 0x1007dd00
+r 0x1007dd40
+r 0x1007dd80
+w 0x1007ddc0
+r 0x1007de00
+r 0x1007de40
+r 0x1007de80
+w 0x1007dec0
+r 0x1007df00
+r 0x1007df40
+r 0x1007df80
+w 0x1007dfc0
+r 0x1007e000
+r 0x1007e040
+r 0x1007e080
+w 0x1007e0c0
+r 0x1007e100
+r 0x1007e140
+r 0x1007e180
+w 0x1007e1c0
+r 0x1007e200
+r 0x1007e240
+r 0x1007e280
+w 0x1007e2c0
+r 0x1007e300
+r 0x1007e340
+r 0x1007e380
+w 0x1007e3c0
+r 0x1007e400
+r 0x1007e440
+r 0x1007e480
+w 0x1007e4c0
+r 0x1007e500
+r 0x1007e540
+r 0x1007e580
+w 0x1007e5c0
+r 0x1007e600
+r 0x1007e640
+r 0x1007e680
+w 0x1007e6c0
+r 0x1007e700
+r 0x1007e740
+r 0x1007e780
+w 0x1007e7c0
+r 0x1007e800
+r 0x1007e840
+r 0x1007e880
+w 0x1007e8c0
+r 0x1007e900
+r 0x1007e940
+r 0x1007e980
+w 0x1007e9c0
+r 0x1007ea00
+r 0x1007ea40
+r 0x1007ea80
+w 0x1007eac0
+r 0x1007eb00
+r 0x1007eb40
+r 0x1007eb80
+w 0x1007ebc0
+r 0x1007ec00
+r 0x1007ec40
+r 0x1007ec80
+w 0x1007ecc0
+r 0x1007ed00
+r 0x1007ed40
+r 0x1007ed80
+w 0x1007edc0
+r 0x1007ee00
+r 0x1007ee40
+r 0x1007ee80
+w 0x1007eec0
+r 0x1007ef00
+r 0x1007ef40
+r 0x1007ef80
+w 0x1007efc0
+r 0x1007f000
+r 0x1007f040
+r 0x1007f080
+w 0x1007f0c0
+r 0x1007f100
+r 0x1007f140
+r 0x1007f180
+w 0x1007f1c0
+r 0x1007f200
+r 0x1007f240
+r 0x1007f280
+w 0x1007f2c0
+r 0x1007f300
+r 0x1007f340
+r 0x1007f380
+w 0x1007f3c0
+r 0x1007f400
+r 0x1007f440
+r 0x1007f480
+w 0x1007f4c0
+r 0x1007f500
+r 0x1007f540
+r 0x1007f580
+w 0x1007f5c0
+r 0x1007f600
+r 0x1007f640
+r 0x1007f680
+w 0x1007f6c0
+r 0x1007f700
+r 0x1007f740
+r 0x1007f780
+w 0x1007f7c0
+r 0x1007f800
+r 0x1007f840
+r 0x1007f880
+w 0x1007f8c0
+r 0x1007f900
+r 0x1007f940
+r 0x1007f980
+w 0x1007f9c0
+r 0x1007fa00
+r 0x1007fa40
+r 0x1007fa80
+w 0x1007fac0
+r 0x1007fb00
+r 0x1007fb40
+r 0x1007fb80
+w 0x1007fbc0
+r 0x1007fc00
+r 0x1007fc40
+r 0x1007fc80
+w 0x1007fcc0
+r 0x1007fd00
+r 0x1007fd40
+r 0x1007fd80
+w 0x1007fdc0
+r 0x1007fe00
+r 0x1007fe40
+r 0x1007fe80
+w 0x1007fec0
+r 0x1007ff00
+r 0x1007ff40
+r 0x1007ff80
+w 0x1007ffc0
+r 0x10080000
+r 0x10080040
+r 0x10080080
+w 0x100800c0
+r 0x10080100
+r 0x10080140
+r 0x10080180
+w 0x100801c0
+r 0x10080200
+r 0x10080240
+r 0x10080280
+w 0x100802c0
+r 0x10080300
+r 0x10080340
+r 0x10080380
+w 0x100803c0
+r 0x10080400
+r 0x10080440
+r 0x10080480
+w 0x100804c0
+r 0x10080500
+r 0x10080540
+r 0x10080580
+w 0x100805c0
+r 0x10080600
+r 0x10080640
+r 0x10080680
+w 0x100806c0
+r 0x10080700
+r 0x10080740
+r 0x10080780
+w 0x100807c0
+r 0x10080800
+r 0x10080840
+r 0x10080880
+w 0x100808c0
+r 0x10080900
+r 0x10080940
+r 0x10080980
+w 0x100809c0
+r 0x10080a00
+r 0x10080a40
+r 0x10080a80
+w 0x10080ac0
+r 0x10080b00
+r 0x10080b40
+r 0x10080b80
+w 0x10080bc0
+r 0x10080c00
+r 0x10080c40
+r 0x10080c80
+w 0x10080cc0
+r 0x10080d00
+r 0x10080d40
+r 0x10080d80
+w 0x10080dc0
+r 0x10080e00
+r 0x10080e40
+r 0x10080e80
+w 0x10080ec0
+r 0x10080f00
+r 0x10080f40
+r 0x10080f80
+w 0x10080fc0
+r 0x10081000
+r 0x10081040
+r 0x10081080
+w 0x100810c0
+r 0x10081100
+r 0x10081140
+r 0x10081180
+w 0x100811c0
+r 0x10081200
+r 0x10081240
+r 0x10081280
+w 0x100812c0
+r 0x10081300
+r 0x10081340
+r 0x10081380
+w 0x100813c0
+r 0x10081400
+r 0x10081440
+r 0x10081480
+w 0x100814c0
+r 0x10081500
+r 0x10081540
+r 0x10081580
+w 0x100815c0
+r 0x10081600
+r 0x10081640
+r 0x10081680
+w 0x100816c0
+r 0x10081700
+r 0x10081740
+r 0x10081780
+w 0x100817c0
+r 0x10081800
+r 0x10081840
+r 0x10081880
+w 0x100818c0
+r 0x10081900
+r 0x10081940
+r 0x10081980
+w 0x100819c0
+r 0x10081a00
+r 0x10081a40
+r 0x10081a80
+w 0x10081ac0
+r 0x10081b00
+r 0x10081b40
+r 0x10081b80
+w 0x10081bc0
+r 0x10081c00
+r 0x10081c40
+r 0x10081c80
+w 0x10081cc0
+r 0x10081d00
+r 0x10081d40
+r 0x10081d80
+w 0x10081dc0
+r 0x10081e00
+r 0x10081e40
+r 0x10081e80
+w 0x10081ec0
+r 0x10081f00
+r 0x10081f40
+r 0x10081f80
+w 0x10081fc0
+r 0x10082000
+r 0x10082040
+r 0x10082080
+w 0x100820c0
+r 0x10082100
+r 0x10082140
+r 0x10082180
+w 0x100821c0
+r 0x10082200
+r 0x10082240
+r 0x10082280
+w 0x100822c0
+r 0x10082300
+r 0x10082340
+r 0x10082380
+w 0x100823c0
+r 0x10082400
+r 0x10082440
+r 0x10082480
+w 0x100824c0
+r 0x10082500
+r 0x10082540
+r 0x10082580
+w 0x100825c0
+r 0x10082600
+r 0x10082640
+r 0x10082680
+w 0x100826c0
+r 0x10082700
+r 0x10082740
+r 0x10082780
+w 0x100827c0
+r 0x10082800
+r 0x10082840
+r 0x10082880
+w 0x100828c0
+r 0x10082900
+r 0x10082940
+r 0x10082980
+w 0x100829c0
+r 0x10082a00
+r 0x10082a40
+r 0x10082a80
+w 0x10082ac0
+r 0x10082b00
+r 0x10082b40
+r 0x10082b80
+w 0x10082bc0
+r 0x10082c00
+r 0x10082c40
+r 0x10082c80
+w 0x10082cc0
+r 0x10082d00
+r 0x10082d40
+r 0x10082d80
+w 0x10082dc0
+r 0x10082e00
+r 0x10082e40
+r 0x10082e80
+w 0x10082ec0
+r 0x10082f00
+r 0x10082f40
+r 0x10082f80
+w 0x10082fc0
+r 0x10083000
+r 0x10083040
+r 0x10083080
+w 0x100830c0
+r 0x10083100
+r 0x10083140
+r 0x10083180
+w 0x100831c0
+r 0x10083200
+r 0x10083240
+r 0x10083280
+w 0x100832c0
+r 0x10083300
+r 0x10083340
+r 0x10083380
+w 0x100833c0
+r 0x10083400
+r 0x10083440
+r 0x10083480
+w 0x100834c0
+r 0x10083500
+r 0x10083540
+r 0x10083580
+w 0x100835c0
+r 0x10083600
+r 0x10083640
+r 0x10083680
+w 0x100836c0
+r 0x10083700
+r 0x10083740
+r 0x10083780
+w 0x100837c0
+r 0x10083800
+r 0x10083840
+r 0x10083880
+w 0x100838c0
+r 0x10083900
+r 0x10083940
+r 0x10083980
+w 0x100839c0
+r 0x10083a00
+r 0x10083a40
+r 0x10083a80
+w 0x10083ac0
+r 0x10083b00
+r 0x10083b40
+r 0x10083b80
+w 0x10083bc0
+r 0x10083c00
+r 0x10083c40
+r 0x10083c80
+w 0x10083cc0
+r 0x10083d00
+r 0x10083d40
+r 0x10083d80
+w 0x10083dc0
+r 0x10083e00
+r 0x10083e40
+r 0x10083e80
+w 0x10083ec0
+r 0x10083f00
+r 0x10083f40
+r 0x10083f80
+w 0x10083fc0
+r 0x10084000
+r 0x10084040
+r 0x10084080
+w 0x100840c0
+r 0x10084100
+r 0x10084140
+r 0x10084180
+w 0x100841c0
+r 0x10084200
+r 0x10084240
+r 0x10084280
+w 0x100842c0
+r 0x10084300
+r 0x10084340
+r 0x10084380
+w 0x100843c0
+r 0x10084400
+r 0x10084440
+r 0x10084480
+w 0x100844c0
+r 0x10084500
+r 0x10084540
+r 0x10084580
+w 0x100845c0
+r 0x10084600
+r 0x10084640
+r 0x10084680
+w 0x100846c0
+r 0x10084700
+r 0x10084740
+r 0x10084780
+w 0x100847c0
+r 0x10084800
+r 0x10084840
+r 0x10084880
+w 0x100848c0
+r 0x10084900
+r 0x10084940
+r 0x10084980
+w 0x100849c0
+r 0x10084a00
+r 0x10084a40
+r 0x10084a80
+w 0x10084ac0
+r 0x10084b00
+r 0x10084b40
+r 0x10084b80
+w 0x10084bc0
+r 0x10084c00
+r 0x10084c40
+r 0x10084c80
+w 0x10084cc0
+r 0x10084d00
+r 0x10084d40
+r 0x10084d80
+w 0x10084dc0
+r 0x10084e00
+r 0x10084e40
+r 0x10084e80
+w 0x10084ec0
+r 0x10084f00
+r 0x10084f40
+r 0x10084f80
+w 0x10084fc0
+r 0x10085000
+r 0x10085040
+r 0x10085080
+w 0x100850c0
+r 0x10085100
+r 0x10085140
+r 0x10085180
+w 0x100851c0
+r 0x10085200
+r 0x10085240
+r 0x10085280
+w 0x100852c0
+r 0x10085300
+r 0x10085340
+r 0x10085380
+w 0x100853c0
+r 0x10085400
+r 0x10085440
+r 0x10085480
+w 0x100854c0
+r 0x10085500
+r 0x10085540
+r 0x10085580
+w 0x100855c0
+r 0x10085600
+r 0x10085640
+r 0x10085680
+w 0x100856c0
+r 0x10085700
+r 0x10085740
+r 0x10085780
+w 0x100857c0
+r 0x10085800
+r 0x10085840
+r 0x10085880
+w 0x100858c0
+r 0x10085900
+r 0x10085940
+r 0x10085980
+w 0x100859c0
+r 0x10085a00
+r 0x10085a40
+r 0x10085a80
+w 0x10085ac0
+r 0x10085b00
+r 0x10085b40
+r 0x10085b80
+w 0x10085bc0
+r 0x10085c00
+r 0x10085c40
+r 0x10085c80
+w 0x10085cc0
+r 0x10085d00
+r 0x10085d40
+r 0x10085d80
+w 0x10085dc0
+r 0x10085e00
+r 0x10085e40
+r 0x10085e80
+w 0x10085ec0
+r 0x10085f00
+r 0x10085f40
+r 0x10085f80
+w 0x10085fc0
+r 0x10086000
+r 0x10086040
+r 0x10086080
+w 0x100860c0
+r 0x10086100
+r 0x10086140
+r 0x10086180
+w 0x100861c0
+r 0x10086200
+r 0x10086240
+r 0x10086280
+w 0x100862c0
+r 0x10086300
+r 0x10086340
+r 0x10086380
+w 0x100863c0
+r 0x10086400
+r 0x10086440
+r 0x10086480
+w 0x100864c0
+r 0x10086500
+r 0x10086540
+r 0x10086580
+w 0x100865c0
+r 0x10086600
+r 0x10086640
+r 0x10086680
+w 0x100866c0
+r 0x10086700
+r 0x10086740
+r 0x10086780
+w 0x100867c0
+r 0x10086800
+r 0x10086840
+r 0x10086880
+w 0x100868c0
+r 0x10086900
+r 0x10086940
+r 0x10086980
+w 0x100869c0
+r 0x10086a00
+r 0x10086a40
+r 0x10086a80
+w 0x10086ac0
+r 0x10086b00
+r 0x10086b40
+r 0x10086b80
+w 0x10086bc0
+r 0x10086c00
+r 0x10086c40
+r 0x10086c80
+w 0x10086cc0
+r 0x10086d00
+r 0x10086d40
+r 0x10086d80
+w 0x10086dc0
+r 0x10086e00
+r 0x10086e40
+r 0x10086e80
+w 0x10086ec0
+r 0x10086f00
+r 0x10086f40
+r 0x10086f80
+w 0x10086fc0
+r 0x10087000
+r 0x10087040
+r 0x10087080
+w 0x100870c0
+r 0x10087100
+r 0x10087140
+r 0x10087180
+w 0x100871c0
+r 0x10087200
+r 0x10087240
+r 0x10087280
+w 0x100872c0
+r 0x10087300
+r 0x10087340
+r 0x10087380
+w 0x100873c0
+r 0x10087400
+r 0x10087440
+r 0x10087480
+w 0x100874c0
+r 0x10087500
+r 0x10087540
+r 0x10087580
+w 0x100875c0
+r 0x10087600
+r 0x10087640
+r 0x10087680
+w 0x100876c0
+r 0x10087700
+r 0x10087740
+r 0x10087780
+w 0x100877c0
+r 0x10087800
+r 0x10087840
+r 0x10087880
+w 0x100878c0
+r 0x10087900
+r 0x10087940
+r 0x10087980
+w 0x100879c0
+r 0x10087a00
+r 0x10087a40
+r 0x10087a80
+w 0x10087ac0
+r 0x10087b00
+r 0x10087b40
+r 0x10087b80
+w 0x10087bc0
+r 0x10087c00
+r 0x10087c40
+r 0x10087c80
+w 0x10087cc0
+r 0x10087d00
+r 0x10087d40
+r 0x10087d80
+w 0x10087dc0
+r 0x10087e00
+r 0x10087e40
+r 0x10087e80
+w 0x10087ec0
+r 0x10087f00
+r 0x10087f40
+r 0x10087f80
+w 0x10087fc0
+r 0x10088000
+r 0x10088040
+r 0x10088080
+w 0x100880c0
+r 0x10088100
+r 0x10088140
+r 0x10088180
+w 0x100881c0
+r 0x10088200
+r 0x10088240
+r 0x10088280
+w 0x100882c0
+r 0x10088300
+r 0x10088340
+r 0x10088380
+w 0x100883c0
+r 0x10088400
+r 0x10088440
+r 0x10088480
+w 0x100884c0
+r 0x10088500
+r 0x10088540
+r 0x10088580
+w 0x100885c0
+r 0x10088600
+r 0x10088640
+r 0x10088680
+w 0x100886c0
+r 0x10088700
+r 0x10088740
+r 0x10088780
+w 0x100887c0
+r 0x10088800
+r 0x10088840
+r 0x10088880
+w 0x100888c0
+r 0x10088900
+r 0x10088940
+r 0x10088980
+w 0x100889c0
+r 0x10088a00
+r 0x10088a40
+r 0x10088a80
+w 0x10088ac0
+r 0x10088b00
+r 0x10088b40
+r 0x10088b80
+w 0x10088bc0
+r 0x10088c00
+r 0x10088c40
+r 0x10088c80
+w 0x10088cc0
+r 0x10088d00
+r 0x10088d40
+r 0x10088d80
+w 0x10088dc0
+r 0x10088e00
+r 0x10088e40
+r 0x10088e80
+w 0x10088ec0
+r 0x10088f00
+r 0x10088f40
+r 0x10088f80
+w 0x10088fc0
+r 0x10089000
+r 0x10089040
+r 0x10089080
+w 0x100890c0
+r 0x10089100
+r 0x10089140
+r 0x10089180
+w 0x100891c0
+r 0x10089200
+r 0x10089240
+r 0x10089280
+w 0x100892c0
+r 0x10089300
+r 0x10089340
+r 0x10089380
+w 0x100893c0
+r 0x10089400
+r 0x10089440
+r 0x10089480
+w 0x100894c0
+r 0x10089500
+r 0x10089540
+r 0x10089580
+w 0x100895c0
+r 0x10089600
+r 0x10089640
+r 0x10089680
+w 0x100896c0
+r 0x10089700
+r 0x10089740
+r 0x10089780
+w 0x100897c0
+r 0x10089800
+r 0x10089840
+r 0x10089880
+w 0x100898c0
+r 0x10089900
+r 0x10089940
+r 0x10089980
+w 0x100899c0
+r 0x10089a00
+r 0x10089a40
+r 0x10089a80
+w 0x10089ac0
+r 0x10089b00
+r 0x10089b40
+r 0x10089b80
+w 0x10089bc0
+r 0x10089c00
+r 0x10089c40
+r 0x10089c80
+w 0x10089cc0
+r 0x10089d00
+r 0x10089d40
+r 0x10089d80
+w 0x10089dc0
+r 0x10089e00
+r 0x10089e40
+r 0x10089e80
+w 0x10089ec0
+r 0x10089f00
+r 0x10089f40
+r 0x10089f80
+w 0x10089fc0
+r 0x1008a000
+r 0x1008a040
+r 0x1008a080
+w 0x1008a0c0
+r 0x1008a100
+r 0x1008a140
+r 0x1008a180
+w 0x1008a1c0
+r 0x1008a200
+r 0x1008a240
+r 0x1008a280
+w 0x1008a2c0
+r 0x1008a300
+r 0x1008a340
+r 0x1008a380
+w 0x1008a3c0
+r 0x1008a400
+r 0x1008a440
+r 0x1008a480
+w 0x1008a4c0
+r 0x1008a500
+r 0x1008a540
+r 0x1008a580
+w 0x1008a5c0
+r 0x1008a600
+r 0x1008a640
+r 0x1008a680
+w 0x1008a6c0
+r 0x1008a700
+r 0x1008a740
+r 0x1008a780
+w 0x1008a7c0
+r 0x1008a800
+r 0x1008a840
+r 0x1008a880
+w 0x1008a8c0
+r 0x1008a900
+r 0x1008a940
+r 0x1008a980
+w 0x1008a9c0
+r 0x1008aa00
+r 0x1008aa40
+r 0x1008aa80
+w 0x1008aac0
+r 0x1008ab00
+r 0x1008ab40
+r 0x1008ab80
+w 0x1008abc0
+r 0x1008ac00
+r 0x1008ac40
+r 0x1008ac80
+w 0x1008acc0
+r 0x1008ad00
+r 0x1008ad40
+r 0x1008ad80
+w 0x1008adc0
+r 0x1008ae00
+r 0x1008ae40
+r 0x1008ae80
+w 0x1008aec0
+r 0x1008af00
+r 0x1008af40
+r 0x1008af80
+w 0x1008afc0
+r 0x1008b000
+r 0x1008b040
+r 0x1008b080
+w 0x1008b0c0
+r 0x1008b100
+r 0x1008b140
+r 0x1008b180
+w 0x1008b1c0
+r 0x1008b200
+r 0x1008b240
+r 0x1008b280
+w 0x1008b2c0
+r 0x1008b300
+r 0x1008b340
+r 0x1008b380
+w 0x1008b3c0
+r 0x1008b400
+r 0x1008b440
+r 0x1008b480
+w 0x1008b4c0
+r 0x1008b500
+r 0x1008b540
+r 0x1008b580
+w 0x1008b5c0
+r 0x1008b600
+r 0x1008b640
+r 0x1008b680
+w 0x1008b6c0
+r 0x1008b700
+r 0x1008b740
+r 0x1008b780
+w 0x1008b7c0
+r 0x1008b800
+r 0x1008b840
+r 0x1008b880
+w 0x1008b8c0
+r 0x1008b900
+r 0x1008b940
+r 0x1008b980
+w 0x1008b9c0
+r 0x1008ba00
+r 0x1008ba40
+r 0x1008ba80
+w 0x1008bac0
+r 0x1008bb00
+r 0x1008bb40
+r 0x1008bb80
+w 0x1008bbc0
+r 0x1008bc00
+r 0x1008bc40
+r 0x1008bc80
+w 0x1008bcc0
+r 0x1008bd00
+r 0x1008bd40
+r 0x1008bd80
+w 0x1008bdc0
+r 0x1008be00
+r 0x1008be40
+r 0x1008be80
+w 0x1008bec0
+r 0x1008bf00
+r 0x1008bf40
+r 0x1008bf80
+w 0x1008bfc0
+r 0x1008c000
+r 0x1008c040
+r 0x1008c080
+w 0x1008c0c0
+r 0x1008c100
+r 0x1008c140
+r 0x1008c180
+w 0x1008c1c0
+r 0x1008c200
+r 0x1008c240
+r 0x1008c280
+w 0x1008c2c0
+r 0x1008c300
+r 0x1008c340
+r 0x1008c380
+w 0x1008c3c0
+r 0x1008c400
+r 0x1008c440
+r 0x1008c480
+w 0x1008c4c0
+r 0x1008c500
+r 0x1008c540
+r 0x1008c580
+w 0x1008c5c0
+r 0x1008c600
+r 0x1008c640
+r 0x1008c680
+w 0x1008c6c0
+r 0x1008c700
+r 0x1008c740
+r 0x1008c780
+w 0x1008c7c0
+r 0x1008c800
+r 0x1008c840
+r 0x1008c880
+w 0x1008c8c0
+r 0x1008c900
+r 0x1008c940
+r 0x1008c980
+w 0x1008c9c0
+r 0x1008ca00
+r 0x1008ca40
+r 0x1008ca80
+w 0x1008cac0
+r 0x1008cb00
+r 0x1008cb40
+r 0x1008cb80
+w 0x1008cbc0
+r 0x1008cc00
+r 0x1008cc40
+r 0x1008cc80
+w 0x1008ccc0
+r 0x1008cd00
+r 0x1008cd40
+r 0x1008cd80
+w 0x1008cdc0
+r 0x1008ce00
+r 0x1008ce40
+r 0x1008ce80
+w 0x1008cec0
+r 0x1008cf00
+r 0x1008cf40
+r 0x1008cf80
+w 0x1008cfc0
+r 0x1008d000
+r 0x1008d040
+r 0x1008d080
+w 0x1008d0c0
+r 0x1008d100
+r 0x1008d140
+r 0x1008d180
+w 0x1008d1c0
+r 0x1008d200
+r 0x1008d240
+r 0x1008d280
+w 0x1008d2c0
+r 0x1008d300
+r 0x1008d340
+r 0x1008d380
+w 0x1008d3c0
+r 0x1008d400
+r 0x1008d440
+r 0x1008d480
+w 0x1008d4c0
+r 0x1008d500
+r 0x1008d540
+r 0x1008d580
+w 0x1008d5c0
+r 0x1008d600
+r 0x1008d640
+r 0x1008d680
+w 0x1008d6c0
+r 0x1008d700
+r 0x1008d740
+r 0x1008d780
+w 0x1008d7c0
+r 0x1008d800
+r 0x1008d840
+r 0x1008d880
+w 0x1008d8c0
+r 0x1008d900
+r 0x1008d940
+r 0x1008d980
+w 0x1008d9c0
+r 0x1008da00
+r 0x1008da40
+r 0x1008da80
+w 0x1008dac0
+r 0x1008db00
+r 0x1008db40
+r 0x1008db80
+w 0x1008dbc0
+r 0x1008dc00
+r 0x1008dc40
+r 0x1008dc80
+w 0x1008dcc0
+r 0x1008dd00
+r 0x1008dd40
+r 0x1008dd80
+w 0x1008ddc0
+r 0x1008de00
+r 0x1008de40
+r 0x1008de80
+w 0x1008dec0
+r 0x1008df00
+r 0x1008df40
+r 0x1008df80
+w 0x1008dfc0
+r 0x1008e000
+r 0x1008e040
+r 0x1008e080
+w 0x1008e0c0
+r 0x1008e100
+r 0x1008e140
+r 0x1008e180
+w 0x1008e1c0
+r 0x1008e200
+r 0x1008e240
+r 0x1008e280
+w 0x1008e2c0
+r 0x1008e300
+r 0x1008e340
+r 0x1008e380
+w 0x1008e3c0
+r 0x1008e400
+r 0x1008e440
+r 0x1008e480
+w 0x1008e4c0
+r 0x1008e500
+r 0x1008e540
+r 0x1008e580
+w 0x1008e5c0
+r 0x1008e600
+r 0x1008e640
+r 0x1008e680
+w 0x1008e6c0
+r 0x1008e700
+r 0x1008e740
+r 0x1008e780
+w 0x1008e7c0
+r 0x1008e800
+r 0x1008e840
+r 0x1008e880
+w 0x1008e8c0
+r 0x1008e900
+r 0x1008e940
+r 0x1008e980
+w 0x1008e9c0
+r 0x1008ea00
+r 0x1008ea40
+r 0x1008ea80
+w 0x1008eac0
+r 0x1008eb00
+r 0x1008eb40
+r 0x1008eb80
+w 0x1008ebc0
+r 0x1008ec00
+r 0x1008ec40
+r 0x1008ec80
+w 0x1008ecc0
+r 0x1008ed00
+r 0x1008ed40
+r 0x1008ed80
+w 0x1008edc0
+r 0x1008ee00
+r 0x1008ee40
+r 0x1008ee80
+w 0x1008eec0
+r 0x1008ef00
+r 0x1008ef40
+r 0x1008ef80
+w 0x1008efc0
+r 0x1008f000
+r 0x1008f040
+r 0x1008f080
+w 0x1008f0c0
+r 0x1008f100
+r 0x1008f140
+r 0x1008f180
+w 0x1008f1c0
+r 0x1008f200
+r 0x1008f240
+r 0x1008f280
+w 0x1008f2c0
+r 0x1008f300
+r 0x1008f340
+r 0x1008f380
+w 0x1008f3c0
+r 0x1008f400
+r 0x1008f440
+r 0x1008f480
+w 0x1008f4c0
+r 0x1008f500
+r 0x1008f540
+r 0x1008f580
+w 0x1008f5c0
+r 0x1008f600
+r 0x1008f640
+r 0x1008f680
+w 0x1008f6c0
+r 0x1008f700
+r 0x1008f740
+r 0x1008f780
+w 0x1008f7c0
+r 0x1008f800
+r 0x1008f840
+r 0x1008f880
+w 0x1008f8c0
+r 0x1008f900
+r 0x1008f940
+r 0x1008f980
+w 0x1008f9c0
+r 0x1008fa00
+r 0x1008fa40
+r 0x1008fa80
+w 0x1008fac0
+r 0x1008fb00
+r 0x1008fb40
+r 0x1008fb80
+w 0x1008fbc0
+r 0x1008fc00
+r 0x1008fc40
+r 0x1008fc80
+w 0x1008fcc0
+r 0x1008fd00
+r 0x1008fd40
+r 0x1008fd80
+w 0x1008fdc0
+r 0x1008fe00
+r 0x1008fe40
+r 0x1008fe80
+w 0x1008fec0
+r 0x1008ff00
+r 0x1008ff40
+r 0x1008ff80
+w 0x1008ffc0
+r 0x10090000
+r 0x10090040
+r 0x10090080
+w 0x100900c0
+r 0x10090100
+r 0x10090140
+r 0x10090180
+w 0x100901c0
+r 0x10090200
+r 0x10090240
+r 0x10090280
+w 0x100902c0
+r 0x10090300
+r 0x10090340
+r 0x10090380
+w 0x100903c0
+r 0x10090400
+r 0x10090440
+r 0x10090480
+w 0x100904c0
+r 0x10090500
+r 0x10090540
+r 0x10090580
+w 0x100905c0
+r 0x10090600
+r 0x10090640
+r 0x10090680
+w 0x100906c0
+r 0x10090700
+r 0x10090740
+r 0x10090780
+w 0x100907c0
+r 0x10090800
+r 0x10090840
+r 0x10090880
+w 0x100908c0
+r 0x10090900
+r 0x10090940
+r 0x10090980
+w 0x100909c0
+r 0x10090a00
+r 0x10090a40
+r 0x10090a80
+w 0x10090ac0
+r 0x10090b00
+r 0x10090b40
+r 0x10090b80
+w 0x10090bc0
+r 0x10090c00
+r 0x10090c40
+r 0x10090c80
+w 0x10090cc0
+r 0x10090d00
+r 0x10090d40
+r 0x10090d80
+w 0x10090dc0
+r 0x10090e00
+r 0x10090e40
+r 0x10090e80
+w 0x10090ec0
+r 0x10090f00
+r 0x10090f40
+r 0x10090f80
+w 0x10090fc0
+r 0x10091000
+r 0x10091040
+r 0x10091080
+w 0x100910c0
+r 0x10091100
+r 0x10091140
+r 0x10091180
+w 0x100911c0
+r 0x10091200
+r 0x10091240
+r 0x10091280
+w 0x100912c0
+r 0x10091300
+r 0x10091340
+r 0x10091380
+w 0x100913c0
+r 0x10091400
+r 0x10091440
+r 0x10091480
+w 0x100914c0
+r 0x10091500
+r 0x10091540
+r 0x10091580
+w 0x100915c0
+r 0x10091600
+r 0x10091640
+r 0x10091680
+w 0x100916c0
+r 0x10091700
+r 0x10091740
+r 0x10091780
+w 0x100917c0
+r 0x10091800
+r 0x10091840
+r 0x10091880
+w 0x100918c0
+r 0x10091900
+r 0x10091940
+r 0x10091980
+w 0x100919c0
+r 0x10091a00
+r 0x10091a40
+r 0x10091a80
+w 0x10091ac0
+r 0x10091b00
+r 0x10091b40
+r 0x10091b80
+w 0x10091bc0
+r 0x10091c00
+r 0x10091c40
+r 0x10091c80
+w 0x10091cc0
+r 0x10091d00
+r 0x10091d40
+r 0x10091d80
+w 0x10091dc0
+r 0x10091e00
+r 0x10091e40
+r 0x10091e80
+w 0x10091ec0
+r 0x10091f00
+r 0x10091f40
+r 0x10091f80
+w 0x10091fc0
+r 0x10092000
+r 0x10092040
+r 0x10092080
+w 0x100920c0
+r 0x10092100
+r 0x10092140
+r 0x10092180
+w 0x100921c0
+r 0x10092200
+r 0x10092240
+r 0x10092280
+w 0x100922c0
+r 0x10092300
+r 0x10092340
+r 0x10092380
+w 0x100923c0
+r 0x10092400
+r 0x10092440
+r 0x10092480
+w 0x100924c0
+r 0x10092500
+r 0x10092540
+r 0x10092580
+w 0x100925c0
+r 0x10092600
+r 0x10092640
+r 0x10092680
+w 0x100926c0
+r 0x10092700
+r 0x10092740
+r 0x10092780
+w 0x100927c0
+r 0x10092800
+r 0x10092840
+r 0x10092880
+w 0x100928c0
+r 0x10092900
+r 0x10092940
+r 0x10092980
+w 0x100929c0
+r 0x10092a00
+r 0x10092a40
+r 0x10092a80
+w 0x10092ac0
+r 0x10092b00
+r 0x10092b40
+r 0x10092b80
+w 0x10092bc0
+r 0x10092c00
+r 0x10092c40
+r 0x10092c80
+w 0x10092cc0
+r 0x10092d00
+r 0x10092d40
+r 0x10092d80
+w 0x10092dc0
+r 0x10092e00
+r 0x10092e40
+r 0x10092e80
+w 0x10092ec0
+r 0x10092f00
+r 0x10092f40
+r 0x10092f80
+w 0x10092fc0
+r 0x10093000
+r 0x10093040
+r 0x10093080
+w 0x100930c0
+r 0x10093100
+r 0x10093140
+r 0x10093180
+w 0x100931c0
+r 0x10093200
+r 0x10093240
+r 0x10093280
+w 0x100932c0
+r 0x10093300
+r 0x10093340
+r 0x10093380
+w 0x100933c0
+r 0x10093400
+r 0x10093440
+r 0x10093480
+w 0x100934c0
+r 0x10093500
+r 0x10093540
+r 0x10093580
+w 0x100935c0
+r 0x10093600
+r 0x10093640
+r 0x10093680
+w 0x100936c0
+r 0x10093700
+r 0x10093740
+r 0x10093780
+w 0x100937c0
+r 0x10093800
+r 0x10093840
+r 0x10093880
+w 0x100938c0
+r 0x10093900
+r 0x10093940
+r 0x10093980
+w 0x100939c0
+r 0x10093a00
+r 0x10093a40
+r 0x10093a80
+w 0x10093ac0
+r 0x10093b00
+r 0x10093b40
+r 0x10093b80
+w 0x10093bc0
+r 0x10093c00
+r 0x10093c40
+r 0x10093c80
+w 0x10093cc0
+r 0x10093d00
+r 0x10093d40
+r 0x10093d80
+w 0x10093dc0
+r 0x10093e00
+r 0x10093e40
+r 0x10093e80
+w 0x10093ec0
+r 0x10093f00
+r 0x10093f40
+r 0x10093f80
+w 0x10093fc0
+r 0x10094000
+r 0x10094040
+r 0x10094080
+w 0x100940c0
+r 0x10094100
+r 0x10094140
+r 0x10094180
+w 0x100941c0
+r 0x10094200
+r 0x10094240
+r 0x10094280
+w 0x100942c0
+r 0x10094300
+r 0x10094340
+r 0x10094380
+w 0x100943c0
+r 0x10094400
+r 0x10094440
+r 0x10094480
+w 0x100944c0
+r 0x10094500
+r 0x10094540
+r 0x10094580
+w 0x100945c0
+r 0x10094600
+r 0x10094640
+r 0x10094680
+w 0x100946c0
+r 0x10094700
+r 0x10094740
+r 0x10094780
+w 0x100947c0
+r 0x10094800
+r 0x10094840
+r 0x10094880
+w 0x100948c0
+r 0x10094900
+r 0x10094940
+r 0x10094980
+w 0x100949c0
+r 0x10094a00
+r 0x10094a40
+r 0x10094a80
+w 0x10094ac0
+r 0x10094b00
+r 0x10094b40
+r 0x10094b80
+w 0x10094bc0
+r 0x10094c00
+r 0x10094c40
+r 0x10094c80
+w 0x10094cc0
+r 0x10094d00
+r 0x10094d40
+r 0x10094d80
+w 0x10094dc0
+r 0x10094e00
+r 0x10094e40
+r 0x10094e80
+w 0x10094ec0
+r 0x10094f00
+r 0x10094f40
+r 0x10094f80
+w 0x10094fc0
+r 0x10095000
+r 0x10095040
+r 0x10095080
+w 0x100950c0
+r 0x10095100
+r 0x10095140
+r 0x10095180
+w 0x100951c0
+r 0x10095200
+r 0x10095240
+r 0x10095280
+w 0x100952c0
+r 0x10095300
+r 0x10095340
+r 0x10095380
+w 0x100953c0
+r 0x10095400
+r 0x10095440
+r 0x10095480
+w 0x100954c0
+r 0x10095500
+r 0x10095540
+r 0x10095580
+w 0x100955c0
+r 0x10095600
+r 0x10095640
+r 0x10095680
+w 0x100956c0
+r 0x10095700
+r 0x10095740
+r 0x10095780
+w 0x100957c0
+r 0x10095800
+r 0x10095840
+r 0x10095880
+w 0x100958c0
+r 0x10095900
+r 0x10095940
+r 0x10095980
+w 0x100959c0
+r 0x10095a00
+r 0x10095a40
+r 0x10095a80
+w 0x10095ac0
+r 0x10095b00
+r 0x10095b40
+r 0x10095b80
+w 0x10095bc0
+r 0x10095c00
+r 0x10095c40
+r 0x10095c80
+w 0x10095cc0
+r 0x10095d00
+r 0x10095d40
+r 0x10095d80
+w 0x10095dc0
+r 0x10095e00
+r 0x10095e40
+r 0x10095e80
+w 0x10095ec0
+r 0x10095f00
+r 0x10095f40
+r 0x10095f80
+w 0x10095fc0
+r 0x10096000
+r 0x10096040
+r 0x10096080
+w 0x100960c0
+r 0x10096100
+r 0x10096140
+r 0x10096180
+w 0x100961c0
+r 0x10096200
+r 0x10096240
+r 0x10096280
+w 0x100962c0
+r 0x10096300
+r 0x10096340
+r 0x10096380
+w 0x100963c0
+r 0x10096400
+r 0x10096440
+r 0x10096480
+w 0x100964c0
+r 0x10096500
+r 0x10096540
+r 0x10096580
+w 0x100965c0
+r 0x10096600
+r 0x10096640
+r 0x10096680
+w 0x100966c0
+r 0x10096700
+r 0x10096740
+r 0x10096780
+w 0x100967c0
+r 0x10096800
+r 0x10096840
+r 0x10096880
+w 0x100968c0
+r 0x10096900
+r 0x10096940
+r 0x10096980
+w 0x100969c0
+r 0x10096a00
+r 0x10096a40
+r 0x10096a80
+w 0x10096ac0
+r 0x10096b00
+r 0x10096b40
+r 0x10096b80
+w 0x10096bc0
+r 0x10096c00
+r 0x10096c40
+r 0x10096c80
+w 0x10096cc0
+r 0x10096d00
+r 0x10096d40
+r 0x10096d80
+w 0x10096dc0
+r 0x10096e00
+r 0x10096e40
+r 0x10096e80
+w 0x10096ec0
+r 0x10096f00
+r 0x10096f40
+r 0x10096f80
+w 0x10096fc0
+r 0x10097000
+r 0x10097040
+r 0x10097080
+w 0x100970c0
+r 0x10097100
+r 0x10097140
+r 0x10097180
+w 0x100971c0
+r 0x10097200
+r 0x10097240
+r 0x10097280
+w 0x100972c0
+r 0x10097300
+r 0x10097340
+r 0x10097380
+w 0x100973c0
+r 0x10097400
+r 0x10097440
+r 0x10097480
+w 0x100974c0
+r 0x10097500
+r 0x10097540
+r 0x10097580
+w 0x100975c0
+r 0x10097600
+r 0x10097640
+r 0x10097680
+w 0x100976c0
+r 0x10097700
+r 0x10097740
+r 0x10097780
+w 0x100977c0
+r 0x10097800
+r 0x10097840
+r 0x10097880
+w 0x100978c0
+r 0x10097900
+r 0x10097940
+r 0x10097980
+w 0x100979c0
+r 0x10097a00
+r 0x10097a40
+r 0x10097a80
+w 0x10097ac0
+r 0x10097b00
+r 0x10097b40
+r 0x10097b80
+w 0x10097bc0
+r 0x10097c00
+r 0x10097c40
+r 0x10097c80
+w 0x10097cc0
+r 0x10097d00
+r 0x10097d40
+r 0x10097d80
+w 0x10097dc0
+r 0x10097e00
+r 0x10097e40
+r 0x10097e80
+w 0x10097ec0
+r 0x10097f00
+r 0x10097f40
+r 0x10097f80
+w 0x10097fc0
+r 0x10098000
+r 0x10098040
+r 0x10098080
+w 0x100980c0
+r 0x10098100
+r 0x10098140
+r 0x10098180
+w 0x100981c0
+r 0x10098200
+r 0x10098240
+r 0x10098280
+w 0x100982c0
+r 0x10098300
+r 0x10098340
+r 0x10098380
+w 0x100983c0
+r 0x10098400
+r 0x10098440
+r 0x10098480
+w 0x100984c0
+r 0x10098500
+r 0x10098540
+r 0x10098580
+w 0x100985c0
+r 0x10098600
+r 0x10098640
+r 0x10098680
+w 0x100986c0
+r 0x10098700
+r 0x10098740
+r 0x10098780
+w 0x100987c0
+r 0x10098800
+r 0x10098840
+r 0x10098880
+w 0x100988c0
+r 0x10098900
+r 0x10098940
+r 0x10098980
+w 0x100989c0
+r 0x10098a00
+r 0x10098a40
+r 0x10098a80
+w 0x10098ac0
+r 0x10098b00
+r 0x10098b40
+r 0x10098b80
+w 0x10098bc0
+r 0x10098c00
+r 0x10098c40
+r 0x10098c80
+w 0x10098cc0
+r 0x10098d00
+r 0x10098d40
+r 0x10098d80
+w 0x10098dc0
+r 0x10098e00
+r 0x10098e40
+r 0x10098e80
+w 0x10098ec0
+r 0x10098f00
+r 0x10098f40
+r 0x10098f80
+w 0x10098fc0
+r 0x10099000
+r 0x10099040
+r 0x10099080
+w 0x100990c0
+r 0x10099100
+r 0x10099140
+r 0x10099180
+w 0x100991c0
+r 0x10099200
+r 0x10099240
+r 0x10099280
+w 0x100992c0
+r 0x10099300
+r 0x10099340
+r 0x10099380
+w 0x100993c0
+r 0x10099400
+r 0x10099440
+r 0x10099480
+w 0x100994c0
+r 0x10099500
+r 0x10099540
+r 0x10099580
+w 0x100995c0
+r 0x10099600
+r 0x10099640
+r 0x10099680
+w 0x100996c0
+r 0x10099700
+r 0x10099740
+r 0x10099780
+w 0x100997c0
+r 0x10099800
+r 0x10099840
+r 0x10099880
+w 0x100998c0
+r 0x10099900
+r 0x10099940
+r 0x10099980
+w 0x100999c0
+r 0x10099a00
+r 0x10099a40
+r 0x10099a80
+w 0x10099ac0
+r 0x10099b00
+r 0x10099b40
+r 0x10099b80
+w 0x10099bc0
+r 0x10099c00
+r 0x10099c40
+r 0x10099c80
+w 0x10099cc0
+r 0x10099d00
+r 0x10099d40
+r 0x10099d80
+w 0x10099dc0
+r 0x10099e00
+r 0x10099e40
+r 0x10099e80
+w 0x10099ec0
+r 0x10099f00
+r 0x10099f40
+r 0x10099f80
+w 0x10099fc0
+r 0x1009a000
+r 0x1009a040
+r 0x1009a080
+w 0x1009a0c0
+r 0x1009a100
+r 0x1009a140
+r 0x1009a180
+w 0x1009a1c0
+r 0x1009a200
+r 0x1009a240
+r 0x1009a280
+w 0x1009a2c0
+r 0x1009a300
+r 0x1009a340
+r 0x1009a380
+w 0x1009a3c0
+r 0x1009a400
+r 0x1009a440
+r 0x1009a480
+w 0x1009a4c0
+r 0x1009a500
+r 0x1009a540
+r 0x1009a580
+w 0x1009a5c0
+r 0x1009a600
+r 0x1009a640
+r 0x1009a680
+w 0x1009a6c0
+r 0x1009a700
+r 0x1009a740
+r 0x1009a780
+w 0x1009a7c0
+r 0x1009a800
+r 0x1009a840
+r 0x1009a880
+w 0x1009a8c0
+r 0x1009a900
+r 0x1009a940
+r 0x1009a980
+w 0x1009a9c0
+r 0x1009aa00
+r 0x1009aa40
+r 0x1009aa80
+w 0x1009aac0
+r 0x1009ab00
+r 0x1009ab40
+r 0x1009ab80
+w 0x1009abc0
+r 0x1009ac00
+r 0x1009ac40
+r 0x1009ac80
+w 0x1009acc0
+r 0x1009ad00
+r 0x1009ad40
+r 0x1009ad80
+w 0x1009adc0
+r 0x1009ae00
+r 0x1009ae40
+r 0x1009ae80
+w 0x1009aec0
+r 0x1009af00
+r 0x1009af40
+r 0x1009af80
+w 0x1009afc0
+r 0x1009b000
+r 0x1009b040
+r 0x1009b080
+w 0x1009b0c0
+r 0x1009b100
+r 0x1009b140
+r 0x1009b180
+w 0x1009b1c0
+r 0x1009b200
+r 0x1009b240
+r 0x1009b280
+w 0x1009b2c0
+r 0x1009b300
+r 0x1009b340
+r 0x1009b380
+w 0x1009b3c0
+r 0x1009b400
+r 0x1009b440
+r 0x1009b480
+w 0x1009b4c0
+r 0x1009b500
+r 0x1009b540
+r 0x1009b580
+w 0x1009b5c0
+r 0x1009b600
+r 0x1009b640
+r 0x1009b680
+w 0x1009b6c0
+r 0x1009b700
+r 0x1009b740
+r 0x1009b780
+w 0x1009b7c0
+r 0x1009b800
+r 0x1009b840
+r 0x1009b880
+w 0x1009b8c0
+r 0x1009b900
+r 0x1009b940
+r 0x1009b980
+w 0x1009b9c0
+r 0x1009ba00
+r 0x1009ba40
+r 0x1009ba80
+w 0x1009bac0
+r 0x1009bb00
+r 0x1009bb40
+r 0x1009bb80
+w 0x1009bbc0
+r 0x1009bc00
+r 0x1009bc40
+r 0x1009bc80
+w 0x1009bcc0
+r 0x1009bd00
+r 0x1009bd40
+r 0x1009bd80
+w 0x1009bdc0
+r 0x1009be00
+r 0x1009be40
+r 0x1009be80
+w 0x1009bec0
+r 0x1009bf00
+r 0x1009bf40
+r 0x1009bf80
+w 0x1009bfc0
+r 0x1009c000
+r 0x1009c040
+r 0x1009c080
+w 0x1009c0c0
+r 0x1009c100
+r 0x1009c140
+r 0x1009c180
+w 0x1009c1c0
+r 0x1009c200
+r 0x1009c240
+r 0x1009c280
+w 0x1009c2c0
+r 0x1009c300
+r 0x1009c340
+r 0x1009c380
+w 0x1009c3c0
+r 0x10004340
+r 0x1010c6c0
+r 0x10005b80
+w 0x1000c440
+w 0x10001180
+w 0x10005780
+r 0x10002200
+r 0x10002d80
+w 0x10000dc0
+r 0x1000d4c0
+r 0x10008600
+r 0x100078c0
+r 0x10008340
+r 0x10007e40
+r 0x10008180
+r 0x10004340
+r 0x1000df40
+r 0x1079bd80
+r 0x10005540
+w 0x1000d180
+w 0x10000240
+r 0x1000f900
+r 0x10002e40
+r 0x10000040
+w 0x1000d3c0
+w 0x10e1c800
+r 0x10008a40
+r 0x10000800
+r 0x10004240
+r 0x1000ff80
+r 0x10009cc0
+r 0x10002e80
+r 0x1000aec0
+r 0x10001300
+r 0x10005b40
+w 0x10009ac0
+r 0x1000ff00
+r 0x10001bc0
+r 0x1000af00
+r 0x10006dc0
+w 0x10008c80
+r 0x10000dc0
+r 0x10007ac0
+r 0x1000c600
+r 0x10005cc0
+r 0x1000ffc0
+w 0x1000b0c0
+r 0x101cbf00
+r 0x10d149c0
+r 0x10008100
+r 0x10ec1480
+r 0x1000a340
+r 0x10004d40
+r 0x10007ec0
+w 0x10006800
+r 0x1000da40
+r 0x1000d200
+r 0x10002f00
+r 0x1000bb00
+r 0x100090c0
+r 0x1000e780
+r 0x10004d80
+r 0x1000d140
+w 0x1000f140
+r 0x1000a280
+r 0x10e71980
+r 0x1000a600
+r 0x1000f940
+w 0x10009400
+r 0x100034c0
+r 0x1000c0c0
+r 0x1000bd00
+r 0x10006980
+w 0x1000c580
+r 0x10216100
+r 0x1055da00
+r 0x1000d540
+r 0x10001680
+r 0x10fa8d80
+w 0x1000a180
+r 0x1000e100
+r 0x1000bac0
+r 0x104ea500
+w 0x10000040
+r 0x10007440
+r 0x10005d40
+r 0x1000ac00
+w 0x10003040
+r 0x10004240
+r 0x10002980
+r 0x10e52480
+r 0x10006240
+r 0x10009140
+w 0x10006340
+r 0x1000f740
+r 0x100045c0
+r 0x10005a80
+r 0x1000f9c0
+r 0x10003400
+r 0x10006440
+r 0x10008180
+w 0x10001cc0
+r 0x1000a300
+w 0x10008640
+r 0x10002d00
+r 0x10004900
+r 0x10b86f80
+r 0x10007a40
+r 0x10000e80
+r 0x10000940
+r 0x1000bd80
+r 0x1000f380
+r 0x10002800
+r 0x100057c0
+r 0x10007500
+r 0x1000ebc0
+w 0x1000eb80
+r 0x1000cd80
+r 0x104d0040
+w 0x10001540
+r 0x10000780
+r 0x10001780
+r 0x1000f080
+r 0x10006340
+r 0x10000b40
+r 0x10006a40
+r 0x100080c0
+r 0x10008f00
+r 0x10000200
+r 0x10005340
+r 0x10007e40
+w 0x10002b40
+r 0x10001680
+r 0x1000c580
+w 0x10006b00
+r 0x1000a1c0
+w 0x10009ec0
+r 0x10000a80
+w 0x10001c40
+r 0x10007280
+r 0x1000f480
+r 0x1000e480
+r 0x1000aac0
+r 0x10005cc0
+w 0x1000f940
+w 0x1000b640
+w 0x1000fa80
+w 0x10005bc0
+r 0x10003e80
+r 0x1000b3c0
+w 0x10004040
+r 0x10b6bec0
+r 0x10849d80
+r 0x1000a040
+r 0x10008540
+r 0x1086f900
+r 0x10006b40
+r 0x10000300
+w 0x1000dd00
+r 0x1000c000
+w 0x1000f240
+r 0x1000fd00
+r 0x10008000
+r 0x1000ffc0
+r 0x10005d00
+r 0x10007600
+r 0x10004e00
+r 0x10007300
+r 0x100054c0
+r 0x10001840
+r 0x1000e5c0
+w 0x1000d3c0
+r 0x10007180
+w 0x1000e200
+r 0x10002140
+r 0x10ef7bc0
+r 0x10007c80
+r 0x1000be80
+w 0x108289c0
+r 0x10000d40
+r 0x100035c0
+r 0x1000d900
+r 0x10002740
+r 0x1000ac40
+r 0x1000dec0
+r 0x10001400
+w 0x10007b00
+r 0x1000f1c0
+r 0x10006ec0
+r 0x10005640
+r 0x10006c40
+r 0x10002940
+r 0x10009700
+r 0x10008840
+r 0x10005f80
+r 0x10009740
+w 0x10003640
+w 0x10009580
+r 0x1000ab00
+r 0x10009a80
+r 0x10001500
+w 0x10001f80
+r 0x100070c0
+r 0x10006600
+r 0x108607c0
+r 0x10006680
+r 0x1000f040
+w 0x10e39800
+r 0x10001000
+r 0x1000a540
+r 0x10001280
+r 0x1000f980
+r 0x1000bc00
+r 0x1000fec0
+r 0x10dd23c0
+w 0x10001540
+r 0x1000e3c0
+r 0x10001500
+w 0x10003140
+r 0x10001f40
+r 0x10005940
+r 0x10000b80
+w 0x1000b100
+r 0x1000d780
+r 0x10002c00
+r 0x100061c0
+w 0x10002780
+r 0x1000dc00
+r 0x1000a980
+w 0x10007280
+r 0x1052a580
+w 0x10008bc0
+w 0x10005580
+r 0x10003880
+w 0x1024a640
+w 0x10004d40
+w 0x10001000
+w 0x1000a400
+r 0x100036c0
+r 0x100031c0
+w 0x10008b40
+r 0x104cdd80
+r 0x1000f940
+r 0x10001180
+r 0x10008f40
+r 0x1000e040
+r 0x100031c0
+r 0x10005cc0
+r 0x100075c0
+r 0x10008080
+r 0x1000df00
+r 0x10008ec0
+r 0x10003ec0
+r 0x1000df40
+r 0x10003300
+r 0x10009800
+w 0x1000a940
+r 0x1000f840
+r 0x1000f2c0
+r 0x10bc1b00
+w 0x10005180
+r 0x1000ef80
+r 0x1000d900
+w 0x10009dc0
+r 0x1000cb80
+r 0x10008a40
+r 0x10001000
+r 0x1000b900
+r 0x10002c40
+r 0x10000d00
+r 0x100028c0
+r 0x1000ad00
+r 0x10007000
+r 0x10006b80
+r 0x10002e00
+r 0x10003140
+r 0x1000a040
+r 0x10004500
+r 0x1000f900
+r 0x1000c3c0
+r 0x10002740
+r 0x106acc00
+r 0x1000f380
+r 0x1000d100
+r 0x10009680
+r 0x1000ff40
+r 0x10ffd300
+r 0x10009980
+r 0x10002900
+r 0x10007a00
+r 0x10006540
+w 0x1000ad80
+r 0x10002bc0
+r 0x1000c380
+r 0x10004c00
+r 0x106568c0
+r 0x1000a380
+r 0x100004c0
+r 0x10004b00
+r 0x1000c100
+r 0x1000ab00
+r 0x10009540
+r 0x1000a100
+r 0x100002c0
+r 0x10000840
+r 0x100094c0
+w 0x100044c0
+r 0x10c0ee00
+w 0x100054c0
+r 0x10001f00
+w 0x1000a400
+r 0x1000af00
+w 0x10bf28c0
+w 0x10006780
+r 0x1000d840
+r 0x10005cc0
+r 0x10002dc0
+r 0x104172c0
+r 0x100019c0
+r 0x10007f00
+r 0x10003580
+r 0x10002980
+r 0x1009af40
+w 0x1000ef40
+w 0x10007080
+r 0x1000ab40
+r 0x10004900
+r 0x10005400
+r 0x1000e240
+r 0x1000e740
+r 0x1000ac00
+w 0x10000d40
+r 0x1000dc00
+w 0x1000e200
+r 0x10007e40
+r 0x10005340
+r 0x10003f00
+r 0x1000c840
+w 0x10003b00
+r 0x100041c0
+r 0x10001080
+r 0x1000bdc0
+r 0x10001e80
+r 0x1000e280
+r 0x1000cb40
+r 0x100010c0
+r 0x10238080
+r 0x10006080
+r 0x108b7d80
+r 0x1000e800
+r 0x1000ec40
+r 0x10000380
+r 0x1000eb80
+r 0x10004600
+r 0x100000c0
+r 0x10000d80
+r 0x10005640
+r 0x1000c840
+r 0x10003f00
+r 0x10006700
+r 0x10003600
+r 0x10008f00
+r 0x10002940
+r 0x10009580
+r 0x10005780
+r 0x10002880
+r 0x10006600
+r 0x1000b280
+w 0x10005700
+r 0x1000ff40
+r 0x10005440
+r 0x10006d40
+r 0x1000dbc0
+r 0x1000f6c0
+r 0x10006d80
+r 0x10006a80
+w 0x10003b80
+r 0x1000d0c0
+r 0x10009500
+r 0x10007ec0
+r 0x10004f00
+r 0x10006e00
+r 0x1000d400
+r 0x100075c0
+r 0x10004240
+r 0x1000b940
+r 0x100024c0
+r 0x1000fc80
+r 0x1000dec0
+r 0x10009000
+r 0x10007d00
+r 0x10008100
+r 0x1000a100
+r 0x1000bf40
+r 0x10004080
+r 0x10002440
+r 0x10782740
+r 0x10002980
+r 0x10003d80
+w 0x10001740
+r 0x10004840
+w 0x1000cc40
+r 0x10001b80
+w 0x1000d3c0
+r 0x1000f2c0
+r 0x1000ab00
+r 0x10002dc0
+r 0x100000c0
+w 0x1000dd80
+r 0x1000c0c0
+r 0x10003800
+r 0x10004ec0
+r 0x10000d40
+w 0x100048c0
+r 0x10003dc0
+w 0x10002bc0
+w 0x10c5f040
+r 0x10003380
+r 0x1000d340
+r 0x10a06600
+r 0x1000e580
+r 0x1000a180
+r 0x1000cd80
+w 0x10c1c340
+r 0x1000cc40
+r 0x1000ea80
+r 0x1000d180
+r 0x10009b80
+r 0x10008c80
+r 0x100091c0
+r 0x10004400
+r 0x10004140
+w 0x10fc0280
+r 0x1000b740
+r 0x1000c600
+r 0x1000e9c0
+r 0x1000ec80
+r 0x107bb500
+r 0x100065c0
+r 0x100080c0
+r 0x10000700
+r 0x1000fa80
+r 0x10004b00
+w 0x10007e00
+w 0x10005b40
+r 0x1000c080
+r 0x10007cc0
+w 0x10002b80
+r 0x103a9fc0
+w 0x10008340
+w 0x1000afc0
+r 0x10003880
+r 0x100075c0
+w 0x1000c080
+r 0x1000d600
+w 0x10005ec0
+r 0x10001040
+r 0x1000f340
+r 0x10195a00
+w 0x1000f300
+r 0x1000d600
+w 0x1000fe80
+r 0x1000b140
+r 0x10005000
+r 0x105195c0
+w 0x1000f200
+r 0x10002000
+r 0x1000eec0
+r 0x10dc9500
+r 0x1000c500
+r 0x10005840
+r 0x1000a0c0
+r 0x1000d780
+r 0x10005a40
+r 0x10005600
+r 0x1000a580
+r 0x10002fc0
+r 0x10004b80
+r 0x1000c3c0
+w 0x10005700
+r 0x100037c0
+r 0x1000ed40
+r 0x10000f40
+w 0x1000d380
+r 0x1000f940
+w 0x10002a80
+r 0x1081b540
+r 0x10000680
+w 0x1000ef00
+r 0x1000e880
+r 0x10008000
+r 0x1000d880
+w 0x10000d40
+r 0x1000ce80
+r 0x10009d80
+r 0x10003dc0
+r 0x10004ec0
+r 0x1010fd00
+w 0x1000d140
+r 0x10002140
+r 0x1000aac0
+r 0x10005340
+r 0x10004840
+w 0x1000ab80
+r 0x1000fb40
+r 0x1000e0c0
+r 0x100000c0
+r 0x1000a300
+r 0x10005480
+r 0x10001540
+r 0x100070c0
+r 0x1000e000
+r 0x10001900
+w 0x10005740
+r 0x1000cdc0
+r 0x100077c0
+r 0x1000c000
+r 0x1000fbc0
+r 0x10004880
+r 0x10005d00
+r 0x1000dc80
+r 0x10004200
+w 0x1000a940
+r 0x1000f340
+w 0x10001080
+r 0x1000f040
+r 0x10003180
+r 0x10002b40
+w 0x10006a80
+r 0x10002480
+r 0x1000ffc0
+r 0x1000e380
+r 0x10005780
+r 0x1000f680
+r 0x1000cc40
+w 0x10006b80
+r 0x10008680
+r 0x10005140
+r 0x1000e7c0
+r 0x10000b00
+r 0x10001540
+r 0x10009600
+r 0x10d04180
+r 0x10006d40
+r 0x10008d80
+r 0x10006040
+w 0x1000cdc0
+r 0x101b8540
+w 0x10009780
+r 0x1000d7c0
+w 0x10002540
+r 0x1000f640
+r 0x10001e40
+w 0x10002dc0
+r 0x1000c640
+r 0x10001bc0
+r 0x10005280
+r 0x10008800
+w 0x10004bc0
+r 0x1000f080
+r 0x1000fc80
+r 0x1000e040
+r 0x10c8c7c0
+r 0x10009a40
+w 0x10002700
+r 0x10000340
+r 0x10002a40
+r 0x1000c500
+r 0x10005440
+r 0x1000c940
+r 0x10806180
+w 0x10007000
+r 0x10b42800
+r 0x10000a40
+r 0x10232380
+r 0x10002cc0
+w 0x10001600
+r 0x10002600
+w 0x10006a00
+r 0x100095c0
+w 0x10f84780
+w 0x10000b00
+w 0x10005d00
+r 0x10006680
+r 0x10006500
+w 0x10009400
+r 0x10007e40
+r 0x1000c880
+r 0x10003180
+r 0x10e8a100
+r 0x10005f40
+r 0x10008940
+r 0x1000d700
+r 0x1061acc0
+w 0x100096c0
+r 0x10cc1a40
+w 0x1000ed80
+w 0x10002f00
+r 0x100055c0
+r 0x1000f6c0
+w 0x10000280
+r 0x1000da80
+r 0x100081c0
+r 0x10009740
+r 0x1000d880
+r 0x10008100
+r 0x10f2a5c0
+r 0x1000cb80
+r 0x10f23a40
+r 0x10008680
+r 0x10008a80
+r 0x10d65c40
+r 0x10007bc0
+r 0x10008f40
+r 0x10009340
+r 0x1000d980
+r 0x1000e380
+r 0x100098c0
+w 0x1000a840
+r 0x10003000
+r 0x1000e8c0
+r 0x10000600
+r 0x10d5bd00
+r 0x100037c0
+r 0x10006840
+r 0x1000cc40
+r 0x1000d540
+r 0x1000eac0
+r 0x100034c0
+w 0x107a6ac0
+r 0x10004280
+r 0x1000a800
+r 0x105c8a40
+w 0x10006840
+r 0x10002580
+r 0x10006ec0
+r 0x1000ea80
+r 0x100063c0
+r 0x1000ad80
+r 0x1000d700
+w 0x1000abc0
+r 0x10004440
+w 0x10007340
+r 0x10001380
+w 0x1000df00
+r 0x1000a8c0
+r 0x100016c0
+w 0x10008680
+r 0x1000f0c0
+r 0x1000bc80
+r 0x10008e80
+r 0x1000cb80
+w 0x10005d00
+r 0x1000b380
+r 0x10787cc0
+r 0x10009a40
+r 0x1000bc40
+r 0x10008280
+r 0x10b5e380
+r 0x1000c1c0
+r 0x10004cc0
+w 0x10000b40
+w 0x1000a880
+w 0x10000f80
+w 0x10004f40
+r 0x10002600
+r 0x100011c0
+r 0x10008cc0
+r 0x10009b00
+r 0x103e9bc0
+w 0x10004f00
+r 0x10006480
+r 0x1000eac0
+w 0x1000a7c0
+r 0x10009c40
+w 0x10002240
+r 0x1074f7c0
+r 0x1000e380
+r 0x10002b80
+r 0x10000d00
+r 0x100010c0
+r 0x10000400
+r 0x10533780
+r 0x10006280
+r 0x1000e4c0
+r 0x100093c0
+r 0x1000ab80
+w 0x1000dcc0
+w 0x100049c0
+r 0x100079c0
+w 0x1000bbc0
+r 0x1000d4c0
+r 0x100014c0
+w 0x10004380
+w 0x100069c0
+r 0x1000f380
+r 0x1000c380
+r 0x1000fa00
+r 0x10006680
+r 0x1099dc80
+w 0x100077c0
+r 0x1000be40
+r 0x10596680
+r 0x1000b6c0
+r 0x10001a80
+r 0x1000d900
+r 0x10000b40
+w 0x100078c0
+w 0x10009040
+w 0x100035c0
+w 0x100040c0
+r 0x10002740
+r 0x1000a0c0
+r 0x10005f80
+w 0x1000a1c0
+r 0x10002380
+r 0x10003b40
+r 0x10002d40
+r 0x10009b80
+w 0x10009840
+r 0x102f0c80
+r 0x1000ba00
+r 0x10515540
+w 0x10001440
+w 0x10005f00
+r 0x10005d80
+r 0x1000b040
+r 0x10000b80
+r 0x10005300
+r 0x10001f80
+r 0x10004d40
+r 0x10007b00
+r 0x10000c40
+r 0x10dea400
+r 0x1000c540
+r 0x10000340
+w 0x10007380
+w 0x100070c0
+r 0x10005d80
+r 0x1000fd40
+r 0x1000b400
+w 0x10002a00
+r 0x10007cc0
+r 0x1000c480
+r 0x10009400
+r 0x10007e80
+w 0x1000de00
+r 0x10009e40
+r 0x1000a540
+r 0x10006140
+r 0x10000800
+r 0x1000f7c0
+w 0x1000f640
+r 0x10004100
+r 0x100057c0
+r 0x100049c0
+r 0x10006440
+r 0x1000bcc0
+r 0x10002440
+r 0x10009c80
+r 0x10007cc0
+w 0x100001c0
+r 0x10005a00
+r 0x1000d140
+r 0x10eaf6c0
+w 0x10005e80
+r 0x10003140
+r 0x1000f5c0
+r 0x1000ed00
+r 0x100043c0
+r 0x10009680
+r 0x1000b380
+w 0x10003180
+r 0x10006840
+r 0x10002880
+r 0x10002dc0
+r 0x10002100
+r 0x10008340
+r 0x1000f700
+r 0x100016c0
+w 0x10004f80
+r 0x1000d6c0
+r 0x100057c0
+w 0x10e9c380
+r 0x10003f00
+r 0x1000cb00
+r 0x1000d7c0
+w 0x1000f240
+r 0x10005fc0
+r 0x10004440
+w 0x1031bf40
+r 0x100091c0
+r 0x1000dcc0
+r 0x1000d040
+w 0x10002c40
+w 0x10005c40
+w 0x10005140
+r 0x10008240
+w 0x10001e80
+r 0x10003700
+r 0x10003c00
+w 0x10003f00
+r 0x10009680
+r 0x1000af00
+r 0x10000400
+r 0x10009180
+r 0x10004b00
+r 0x1000d000
+r 0x100073c0
+r 0x10006580
+w 0x10002a00
+r 0x10005f00
+r 0x1000b700
+r 0x1000f500
+w 0x10006100
+w 0x10007480
+r 0x10007880
+r 0x10002040
+w 0x10001bc0
+r 0x1000ddc0
+w 0x1000a4c0
+r 0x1000ee00
+r 0x1000f880
+r 0x10005200
+r 0x10008e00
+r 0x1000fe00
+r 0x10ae8180
+r 0x100041c0
+w 0x10008bc0
+r 0x100002c0
+w 0x10004f40
+r 0x1000c2c0
+r 0x10008a00
+w 0x10008e00
+r 0x100021c0
+r 0x10001e40
+w 0x107074c0
+w 0x10003f00
+r 0x100061c0
+w 0x10890ec0
+r 0x10000c80
+r 0x10ec7440
+r 0x10006d00
+r 0x10003000
+w 0x1000a280
+r 0x108af0c0
+r 0x1000a6c0
+w 0x10009a40
+r 0x10004d00
+w 0x1000f7c0
+w 0x1000fb00
+r 0x1000ffc0
+w 0x10001800
+w 0x10004f00
+r 0x10009c80
+r 0x10002ec0
+r 0x10005180
+w 0x1000e580
+r 0x1000be40
+w 0x1000d6c0
+r 0x10003340
+r 0x10005e80
+w 0x1000a1c0
+r 0x10000c00
+r 0x10007cc0
+r 0x10003ac0
+r 0x1000dcc0
+r 0x10002880
+r 0x105a0380
+w 0x1000cec0
+r 0x1000f600
+r 0x10003c40
+r 0x10010a80
+w 0x1000d580
+r 0x1000f1c0
+r 0x1000d4c0
+r 0x10009b40
+r 0x1000cec0
+r 0x10679640
+w 0x1000f8c0
+r 0x1000db80
+r 0x10008a00
+r 0x1000b500
+r 0x10005fc0
+w 0x10004600
+r 0x10006f80
+r 0x100084c0
+r 0x104f7c00
+r 0x10004fc0
+r 0x10008d80
+r 0x1000b400
+r 0x1000fc40
+w 0x10000a80
+r 0x10009bc0
+r 0x1000b840
+r 0x10008300
+r 0x1000cd80
+w 0x10000780
+r 0x1000a780
+r 0x1000a700
+r 0x1000be80
+r 0x10000800
+r 0x100045c0
+r 0x10006900
+r 0x1000bb80
+w 0x10000c40
+r 0x10bbfcc0
+r 0x1000ec80
+r 0x10002780
+r 0x100057c0
+r 0x100018c0
+r 0x1000f5c0
+r 0x10f85540
+w 0x10004640
+r 0x1000b740
+r 0x10004b40
+r 0x10007ac0
+r 0x1000b140
+w 0x10006380
+r 0x100007c0
+w 0x100021c0
+w 0x10013fc0
+r 0x1000ba80
+r 0x100039c0
+r 0x10fe0fc0
+r 0x1000a580
+r 0x10008a40
+r 0x1000eac0
+r 0x1000df40
+w 0x1000e5c0
+r 0x10005800
+w 0x10009380
+r 0x10000100
+r 0x100037c0
+r 0x10004d40
+r 0x10001940
+r 0x1000e7c0
+r 0x10009c80
+r 0x100036c0
+r 0x10336940
+r 0x10004180
+r 0x10000f40
+r 0x100013c0
+r 0x10009d00
+r 0x100022c0
+r 0x10a02ec0
+w 0x10485dc0
+r 0x1000de80
+r 0x107f5c80
+r 0x10009400
+r 0x10007380
+w 0x1000bc80
+r 0x1000b900
+r 0x1000fd80
+r 0x1000e4c0
+r 0x10002200
+r 0x1000cdc0
+r 0x10000380
+r 0x10000a00
+r 0x100048c0
+r 0x1000bb40
+r 0x10007f40
+w 0x10000980
+w 0x10821800
+r 0x10005500
+r 0x1000a6c0
+r 0x10006140
+r 0x10000d40
+r 0x1000d740
+r 0x10004640
+r 0x10003440
+r 0x10005c40
+r 0x100043c0
+r 0x1000f2c0
+w 0x100021c0
+r 0x1000ee40
+r 0x1000f340
+w 0x10004d80
+r 0x1000f500
+r 0x1000a240
+r 0x100064c0
+r 0x1000e040
+r 0x10004a40
+r 0x1000aa40
+r 0x10878f80
+r 0x10005180
+r 0x10003800
+r 0x10000e00
+r 0x10004ec0
+r 0x10004940
+r 0x10003440
+r 0x10002080
+r 0x10006640
+r 0x10008100
+r 0x10005980
+w 0x1000a0c0
+w 0x1000f8c0
+w 0x10009080
+w 0x10005100
+r 0x10000540
+w 0x10000580
+r 0x10003840
+w 0x10007b40
+r 0x1000d640
+w 0x1000a100
+r 0x1000cb00
+r 0x1000bd00
+w 0x1000d380
+r 0x10003700
+r 0x10005dc0
+r 0x10004400
+r 0x100013c0
+r 0x1000a980
+r 0x1000edc0
+w 0x1000ab40
+w 0x10ed6f40
+r 0x10000d80
+r 0x10007f80
+r 0x1000fe80
+w 0x1000db00
+r 0x10008180
+w 0x10003000
+r 0x1000e7c0
+r 0x1000b080
+r 0x10001a80
+r 0x10009080
+w 0x10009700
+r 0x1000bf80
+r 0x1000bb80
+w 0x10008c40
+r 0x1000bd80
+r 0x10009b80
+r 0x10840500
+r 0x10005800
+r 0x1000b140
+w 0x10001c80
+w 0x10002d80
+r 0x1000cc40
+w 0x1000fd40
+r 0x10002680
+r 0x10005c40
+w 0x1000d980
+r 0x10007100
+r 0x10000cc0
+r 0x1000b780
+r 0x10003d80
+w 0x10000240
+w 0x10003740
+r 0x1000de00
+r 0x1000db00
+w 0x1000fd00
+r 0x10004080
+r 0x10006a40
+w 0x1000cdc0
+r 0x1000bbc0
+r 0x1000bd80
+w 0x103123c0
+r 0x10855980
+r 0x100038c0
+r 0x10002640
+w 0x1000bbc0
+w 0x1000b040
+r 0x106251c0
+r 0x10004b00
+r 0x10009f40
+w 0x10000540
+w 0x10878c00
+w 0x1000cc40
+w 0x1000d3c0
+r 0x10001140
+w 0x1000b4c0
+r 0x1000e600
+w 0x10b76f80
+w 0x1000b180
+w 0x1000b4c0
+r 0x10005080
+w 0x10008380
+r 0x10157b00
+r 0x1000fbc0
+r 0x1000bec0
+r 0x10002480
+r 0x1000e680
+r 0x10007680
+r 0x1000a480
+r 0x10000c40
+r 0x1000e200
+r 0x10008ac0
+r 0x10005f80
+w 0x1000b040
+r 0x1000c7c0
+r 0x10009340
+r 0x10006740
+r 0x10000980
+r 0x10a65d40
+r 0x1000cf40
+r 0x1094d6c0
+w 0x10001980
+r 0x10001d00
+r 0x1000db40
+w 0x10009840
+r 0x10f3b8c0
+w 0x100006c0
+r 0x1000c2c0
+r 0x1000e300
+r 0x10001e80
+r 0x1000bbc0
+w 0x1000a140
+r 0x10002c00
+w 0x10006e40
+r 0x10008c80
+w 0x1000f0c0
+r 0x10002000
+r 0x10007100
+r 0x1000ff80
+r 0x1000e100
+r 0x10003cc0
+r 0x10001800
+w 0x10005a80
+w 0x100026c0
+w 0x10004ac0
+w 0x1047c240
+r 0x100049c0
+r 0x100004c0
+r 0x1045a200
+r 0x1000e840
+r 0x10008680
+w 0x1000d2c0
+r 0x10d9f540
+r 0x10009540
+w 0x10009740
+r 0x105e65c0
+w 0x10000480
+r 0x1000a640
+r 0x10005440
+r 0x10009c80
+r 0x10008b80
+r 0x10004800
+r 0x1000b580
+r 0x1000be00
+r 0x10007d80
+r 0x10002340
+r 0x1000f700
+r 0x1000a100
+r 0x1000d640
+r 0x10004280
+w 0x10008900
+w 0x10008f40
+r 0x10009380
+r 0x10002040
+r 0x100015c0
+r 0x1000b740
+r 0x1000a580
+r 0x1000e640
+w 0x10000f00
+r 0x10006d40
+r 0x100084c0
+r 0x1000e780
+r 0x1000ae00
+r 0x10009b40
+r 0x10002540
+r 0x1000c700
+r 0x1000e040
+r 0x1000a040
+r 0x10001980
+r 0x1000ba00
+r 0x10005fc0
+r 0x1000ac80
+r 0x1000e980
+r 0x102ac680
+r 0x10005d00
+r 0x10001d80
+r 0x10009140
+r 0x10007a80
+r 0x10009f00
+r 0x1000dd00
+r 0x100087c0
+w 0x10002d00
+r 0x10006380
+r 0x1000e500
+w 0x100062c0
+r 0x1000e0c0
+r 0x10e31e40
+r 0x1000ab80
+r 0x10005400
+r 0x10004ac0
+r 0x1015e640
+r 0x1000d880
+w 0x10005100
+r 0x10bb7c80
+r 0x10005740
+r 0x10007340
+w 0x10002b80
+r 0x10008fc0
+r 0x10008c00
+r 0x10007080
+w 0x10008b40
+r 0x10001140
+r 0x10005d80
+r 0x101dd080
+r 0x10003780
+r 0x10002240
+w 0x10008800
+r 0x100011c0
+w 0x10009580
+r 0x10008940
+r 0x10009a00
+r 0x1033cc80
+w 0x1000bc80
+r 0x10008e40
+r 0x100086c0
+r 0x10b49080
+r 0x100089c0
+w 0x10003440
+r 0x10000140
+r 0x10006ec0
+r 0x10f8c100
+w 0x1000a340
+r 0x1000e380
+r 0x1000a680
+r 0x10003100
+r 0x10001340
+r 0x10007280
+r 0x1000fb40
+r 0x100030c0
+r 0x10002b40
+r 0x10990440
+r 0x1000fec0
+r 0x10007540
+r 0x1000e340
+r 0x1000f080
+r 0x10008e80
+r 0x1000df40
+w 0x10002200
+w 0x10002480
+r 0x1000e540
+r 0x10002ac0
+r 0x10000bc0
+w 0x1000bec0
+w 0x10006940
+r 0x1000cc00
+r 0x1000afc0
+w 0x10001c80
+r 0x1000fd00
+r 0x1000f940
+r 0x1000b400
+r 0x10008940
+r 0x1000e640
+r 0x1000e500
+r 0x1000e6c0
+r 0x10000380
+r 0x1000f200
+r 0x1000ffc0
+r 0x10002c00
+r 0x10005740
+r 0x10005e80
+r 0x10006700
+r 0x100079c0
+r 0x10005040
+r 0x10000b80
+r 0x104c0040
+r 0x1000bcc0
+r 0x10009140
+r 0x1000d1c0
+r 0x1000ed00
+r 0x10002380
+r 0x109eb5c0
+r 0x1000b780
+w 0x1000fc40
+r 0x1000bec0
+r 0x100068c0
+r 0x100098c0
+r 0x1000a880
+w 0x10003180
+r 0x10000b00
+w 0x10006b00
+r 0x1000a980
+w 0x10e54c80
+r 0x100040c0
+r 0x1000db00
+r 0x10008900
+r 0x100038c0
+r 0x10005940
+r 0x10000ac0
+w 0x10006800
+r 0x10000200
+r 0x10000800
+r 0x1000b840
+r 0x1041c300
+r 0x10000740
+r 0x10000d80
+r 0x10002bc0
+r 0x1000f980
+w 0x10b71280
+r 0x1000fe00
+w 0x1000f5c0
+r 0x10b78880
+r 0x1000a400
+r 0x1000b300
+w 0x10001500
+r 0x1000a380
+w 0x10007f00
+r 0x10006e00
+r 0x10004400
+r 0x10e29b80
+r 0x1000a480
+w 0x10003640
+w 0x10004900
+r 0x10007700
+r 0x10009a00
+r 0x10008700
+r 0x10003500
+r 0x10006280
+r 0x10008000
+r 0x10008ec0
+w 0x10004840
+r 0x10000fc0
+r 0x100038c0
+r 0x10007000
+r 0x10006d80
+r 0x10f522c0
+r 0x10008900
+r 0x100041c0
+w 0x10007600
+r 0x10cbd640
+r 0x1000fb80
+r 0x1000c7c0
+r 0x1000ca40
+r 0x10005d40
+w 0x1000acc0
+r 0x10002740
+r 0x10006c00
+r 0x10007680
+r 0x10008c00
+w 0x1000c640
+w 0x100098c0
+r 0x10000500
+r 0x10004ec0
+r 0x10009b80
+r 0x10005640
+r 0x100064c0
+r 0x10006380
+r 0x1000f540
+r 0x100058c0
+r 0x1000d140
+r 0x1000bf40
+r 0x10000000
+w 0x10003840
+r 0x1000c080
+r 0x10944740
+w 0x10007940
+r 0x100023c0
+r 0x1000ea80
+r 0x1000cf40
+r 0x10005e40
+r 0x1000a580
+r 0x1000d700
+r 0x10007140
+r 0x1000ab80
+r 0x10006f00
+w 0x100067c0
+w 0x1000cd00
+w 0x1000e0c0
+r 0x1000ec00
+r 0x10479a00
+w 0x100094c0
+r 0x1000bb00
+r 0x1000c980
+r 0x10000c40
+r 0x10001940
+r 0x10008ac0
+r 0x1000b3c0
+r 0x1000f300
+r 0x10008ec0
+r 0x10ee1200
+r 0x10000840
+r 0x10001a40
+r 0x1000b440
+r 0x10004b80
+w 0x10137040
+r 0x1000fdc0
+w 0x10ca7a80
+r 0x10002680
+r 0x10006ac0
+r 0x10003540
+r 0x10002540
+r 0x100049c0
+r 0x1000d5c0
+r 0x1000a340
+w 0x100086c0
+r 0x10103c80
+r 0x10001440
+w 0x10004180
+r 0x10007d00
+r 0x1000c380
+r 0x10006680
+r 0x10007240
+w 0x1000f700
+r 0x10001c40
+w 0x10004d40
+r 0x1000ad80
+r 0x10000d00
+w 0x10006800
+r 0x10006ac0
+r 0x1000e180
+w 0x1000e500
+r 0x10005a00
+r 0x100010c0
+r 0x100047c0
+r 0x10002cc0
+r 0x103f28c0
+r 0x1000f6c0
+r 0x1000a440
+w 0x1000fd80
+r 0x1000c340
+r 0x1000d200
+w 0x10ea0d40
+r 0x10007340
+r 0x10004e00
+r 0x10004c40
+r 0x103ee000
+r 0x1000cd40
+r 0x100092c0
+r 0x1000f9c0
+r 0x10008ac0
+r 0x10009c00
+r 0x10003d00
+r 0x1000bc00
+r 0x10004840
+r 0x10004000
+w 0x10008f00
+w 0x10008740
+r 0x10006f00
+r 0x10002100
+r 0x10002e40
+r 0x100078c0
+r 0x10004800
+r 0x10008440
+w 0x10007200
+r 0x10007a00
+r 0x1022c840
+r 0x1000dd80
+r 0x10000300
+r 0x1000fec0
+r 0x103f7300
+w 0x100011c0
+r 0x1000fa00
+r 0x10007e00
+r 0x100016c0
+r 0x10000600
+r 0x10001d00
+r 0x10002cc0
+r 0x10004dc0
+r 0x10006980
+r 0x1000c800
+r 0x10003840
+r 0x10009480
+r 0x1000bac0
+r 0x10003b00
+r 0x10002d00
+w 0x1000f5c0
+r 0x1000f4c0
+r 0x1000f000
+w 0x10007580
+w 0x10009100
+r 0x10003980
+r 0x10000440
+r 0x10006b40
+r 0x100011c0
+r 0x10007880
+r 0x102db0c0
+w 0x100d4c40
+r 0x10009c00
+r 0x10001400
+w 0x100045c0
+r 0x10007240
+r 0x10003840
+r 0x100088c0
+r 0x10001c40
+r 0x10006d00
+r 0x1000be80
+r 0x10003100
+r 0x10cf4b00
+r 0x10001c00
+r 0x10e70a00
+w 0x1000de80
+r 0x10539600
+r 0x1000c2c0
+w 0x10005100
+r 0x1000c540
+w 0x1000c8c0
+r 0x1000bd80
+r 0x1000d040
+r 0x10001a80
+r 0x1000bbc0
+r 0x10009340
+r 0x10003fc0
+r 0x10009f00
+r 0x1000d800
+r 0x10000f80
+r 0x100072c0
+r 0x1000fa40
+w 0x1000cd00
+r 0x10009e00
+w 0x10009440
+r 0x10005740
+r 0x10000200
+r 0x10002c40
+r 0x10ff8480
+w 0x1000bd80
+r 0x1000e140
+r 0x100079c0
+w 0x10000140
+r 0x100078c0
+w 0x10005f80
+r 0x10004400
+r 0x1000e9c0
+r 0x10008340
+r 0x10005b80
+w 0x10008200
+w 0x100045c0
+r 0x10005bc0
+r 0x10005780
+w 0x10008640
+r 0x10000700
+r 0x1000b2c0
+r 0x10001180
+w 0x100078c0
+w 0x10004280
+r 0x10001ec0
+r 0x10009680
+r 0x10009d80
+r 0x10001640
+r 0x10008e80
+r 0x10006080
+r 0x1000c9c0
+r 0x10009b80
+r 0x10f58500
+r 0x10009000
+w 0x10ef3740
+w 0x1000bc00
+w 0x10002340
+r 0x10002900
+r 0x1000ddc0
+r 0x1000dc00
+r 0x10000980
+w 0x1000fcc0
+r 0x10525ac0
+r 0x1000d6c0
+r 0x10007240
+r 0x1000b740
+r 0x10002100
+w 0x10000140
+r 0x100068c0
+r 0x1014f040
+r 0x1000f080
+r 0x10006b80
+r 0x10001700
+r 0x10007bc0
+w 0x10007cc0
+r 0x1000bcc0
+w 0x10007280
+w 0x1000ab00
+r 0x10000780
+r 0x100072c0
+r 0x10003cc0
+r 0x10005840
+r 0x10006dc0
+w 0x100039c0
+r 0x1000ebc0
+r 0x10009f00
+w 0x1000c200
+w 0x10000d40
+w 0x1000b940
+r 0x10005640
+r 0x1000b440
+r 0x1000e000
+r 0x100021c0
+r 0x1000f140
+r 0x100007c0
+r 0x1000fd00
+r 0x1000d280
+r 0x1000ddc0
+r 0x1000e380
+r 0x100004c0
+r 0x10159cc0
+r 0x100050c0
+r 0x10001d00
+r 0x1000e340
+r 0x1000fb40
+w 0x1000a840
+r 0x10003340
+r 0x10007280
+w 0x1000be00
+r 0x10001840
+w 0x100cc800
+r 0x10009100
+r 0x100018c0
+w 0x1000bdc0
+r 0x10005500
+r 0x10004e80
+w 0x1066a240
+r 0x1000a400
+r 0x100086c0
+r 0x1000be00
+r 0x10002940
+r 0x10009e00
+r 0x1000c180
+r 0x1097d3c0
+r 0x10002bc0
+r 0x10007140
+w 0x1000e980
+r 0x1000dac0
+r 0x10007040
+r 0x10008a80
+r 0x1000cf80
+r 0x10002e80
+r 0x10002680
+r 0x100026c0
+r 0x10001640
+r 0x10003300
+r 0x1000d9c0
+w 0x10001ec0
+r 0x1013a200
+r 0x1000dec0
+r 0x10003f00
+r 0x10000b80
+w 0x10007400
+r 0x1000c140
+w 0x100047c0
+r 0x1000d540
+r 0x10007c00
+r 0x1000fd40
+r 0x1000d700
+r 0x10002240
+r 0x10009840
+w 0x10007d40
+r 0x1000c7c0
+r 0x10006e80
+r 0x10005100
+r 0x10dfc8c0
+r 0x10004000
+r 0x1000bf00
+r 0x100027c0
+r 0x10008700
+r 0x10009180
+r 0x10008680
+w 0x1000da80
+r 0x10002e40
+w 0x108b7e40
+r 0x100041c0
+r 0x10006140
+r 0x1000b8c0
+r 0x10004880
+r 0x1000f480
+r 0x1000e4c0
+r 0x100088c0
+r 0x1000bb40
+r 0x10401380
+w 0x10000d80
+r 0x10001040
+w 0x1000d8c0
+r 0x105bd880
+w 0x1000a9c0
+r 0x10008a40
+r 0x1000dec0
+r 0x1000fe80
+r 0x1000ff00
+r 0x100058c0
+r 0x1000c0c0
+r 0x10009440
+r 0x100062c0
+w 0x10000280
+r 0x10008e40
+r 0x10a8dd00
+r 0x100074c0
+r 0x10003d00
+w 0x10007780
+r 0x10004480
+w 0x1000fd40
+r 0x10004b40
+r 0x100004c0
+r 0x10005a80
+w 0x1000c400
+r 0x1000a6c0
+r 0x10002c00
+r 0x10007040
+r 0x10004e00
+r 0x10004700
+r 0x1003b640
+r 0x1000f500
+w 0x10007180
+r 0x10001d40
+r 0x10003dc0
+w 0x1000d440
+r 0x108f6300
+r 0x1000bd00
+r 0x108fde80
+r 0x10007100
+w 0x10001500
+r 0x1000efc0
+r 0x10008000
+r 0x1000d640
+w 0x10001580
+r 0x1000c980
+r 0x1000b080
+r 0x10007800
+r 0x10006fc0
+w 0x10b6f700
+r 0x1000a100
+r 0x100076c0
+r 0x1000fbc0
+r 0x10007700
+r 0x10002a00
+w 0x10195100
+w 0x10009b00
+r 0x1000ab00
+r 0x1000d240
+r 0x10003fc0
+r 0x10007d00
+r 0x10001340
+r 0x1000da00
+w 0x10001780
+w 0x10005600
+r 0x1078b800
+r 0x10338ec0
+w 0x1000a480
+r 0x1000dfc0
+r 0x10001140
+w 0x1000d580
+r 0x10000b80
+r 0x1000d500
+r 0x10008e00
+r 0x1000d600
+r 0x10009980
+r 0x1000d2c0
+r 0x10007940
+r 0x1000df80
+r 0x10005c80
+w 0x10001dc0
+r 0x10002e00
+r 0x10005140
+r 0x10006d00
+r 0x10005bc0
+r 0x1000e780
+r 0x1000fc80
+r 0x10002840
+w 0x10c276c0
+w 0x1000e080
+r 0x10004ec0
+w 0x1000f480
+r 0x10004b80
+r 0x10003a80
+w 0x1000d0c0
+r 0x10004000
+r 0x10003b40
+r 0x100055c0
+w 0x1000ec00
+r 0x1000d980
+w 0x10002740
+r 0x10007b80
+r 0x1000a2c0
+r 0x1000f180
+w 0x10006180
+r 0x100058c0
+r 0x10a51bc0
+w 0x1000af00
+r 0x10002880
+w 0x10000d80
+w 0x10003f80
+r 0x10007340
+r 0x10002480
+r 0x1000bb40
+r 0x1000a940
+r 0x10004600
+r 0x10008540
+w 0x1000e540
+r 0x10004080
+r 0x1000df40
+r 0x1000d780
+w 0x1000c040
+r 0x10002140
+r 0x10004a00
+w 0x10f18080
+r 0x10006680
+r 0x1000be40
+r 0x1000cf80
+r 0x100004c0
+r 0x1000b400
+w 0x10a10800
+r 0x1000ff40
+r 0x10003440
+r 0x1000f740
+r 0x10007c00
+r 0x1000a500
+r 0x10002d00
+r 0x1000b1c0
+w 0x1000e840
+w 0x10001240
+r 0x10001d00
+r 0x10000b40
+r 0x10008e00
+r 0x100086c0
+w 0x10002f80
+w 0x10009940
+r 0x10006b00
+r 0x1077ca00
+r 0x10001080
+r 0x10007380
+r 0x1000cb80
+r 0x103cc740
+w 0x10001fc0
+r 0x10003080
+r 0x10000a80
+r 0x10004c80
+r 0x1000bf00
+r 0x10003100
+w 0x1000f800
+r 0x10407c00
+r 0x10007a00
+r 0x100099c0
+r 0x1000c940
+r 0x100002c0
+r 0x10007880
+r 0x100010c0
+r 0x100085c0
+r 0x1000e000
+w 0x1000a480
+w 0x1000b700
+w 0x100045c0
+r 0x104f2880
+r 0x10005180
+r 0x100077c0
+r 0x102c8c80
+r 0x1000fd00
+r 0x10003000
+r 0x1000f340
+r 0x100056c0
+r 0x10001800
+r 0x1000da00
+r 0x10008940
+r 0x1000bf00
+w 0x10002e40
+w 0x10002500
+r 0x10005640
+r 0x100078c0
+w 0x1000b000
+w 0x10006140
+w 0x10002400
+r 0x10007d00
+r 0x10000c40
+r 0x10007040
+r 0x1000c700
+r 0x10f1e400
+r 0x1000aa40
+r 0x10009500
+r 0x106e0080
+r 0x10008240
+w 0x1000e6c0
+r 0x106b4100
+r 0x1000c500
+r 0x10001440
+r 0x10004880
+r 0x10003f80
+w 0x1000b7c0
+r 0x10004200
+w 0x1000e700
+r 0x10001d00
+r 0x10aee6c0
+w 0x1000a980
+r 0x10000700
+r 0x1000fb00
+r 0x10003940
+w 0x10005a00
+r 0x100012c0
+w 0x10005680
+w 0x10a6d1c0
+r 0x10003d00
+r 0x10009f00
+r 0x10009d00
+r 0x10007b40
+r 0x10003fc0
+w 0x1000e000
+r 0x109b0100
+r 0x1000e080
+w 0x10009e80
+r 0x10003280
+r 0x10d57300
+r 0x1000a240
+r 0x1000ad80
+r 0x10003140
+r 0x10005a00
+r 0x1071cf00
+r 0x1000a7c0
+r 0x10004fc0
+r 0x10003e00
+r 0x100090c0
+r 0x10009300
+r 0x10000d80
+w 0x10002e80
+w 0x10ab4880
+r 0x10003940
+r 0x1000ea00
+r 0x1000ffc0
+w 0x100052c0
+r 0x1000e540
+r 0x100060c0
+r 0x10004bc0
+r 0x10f96a80
+r 0x10003e40
+r 0x1000d640
+r 0x100058c0
+w 0x10002f40
+r 0x10007300
+r 0x1000f940
+w 0x10002180
+r 0x10008580
+r 0x1000a940
+r 0x1000c680
+r 0x100011c0
+r 0x10003d00
+r 0x10004f40
+r 0x10001480
+w 0x101fed80
+r 0x10be5bc0
+r 0x10003280
+r 0x10008840
+r 0x1002fd80
+r 0x10001640
+r 0x1000a200
+r 0x1000fa80
+r 0x1000ea00
+r 0x10003d40
+r 0x100016c0
+r 0x1000e240
+r 0x10000940
+w 0x1000ec40
+r 0x1000ef40
+r 0x10008880
+r 0x100007c0
+r 0x10005240
+r 0x1000ba00
+w 0x10006440
+r 0x10000cc0
+r 0x1000dcc0
+r 0x100037c0
+r 0x100015c0
+r 0x1000e180
+r 0x1000d440
+r 0x10005d00
+r 0x100043c0
+r 0x1000b400
+r 0x100019c0
+r 0x100012c0
+r 0x10008080
+r 0x10008340
+r 0x10000200
+r 0x100058c0
+w 0x10006480
+r 0x10005940
+r 0x10002a40
+r 0x1000c7c0
+w 0x10f68700
+r 0x10000640
+r 0x10003600
+r 0x1000c4c0
+r 0x10000fc0
+r 0x1000c6c0
+w 0x108f02c0
+w 0x1000e680
+w 0x10006140
+r 0x10003ec0
+r 0x10008f00
+r 0x10007d00
+r 0x10bfb1c0
+r 0x1000a900
+w 0x10009ac0
+r 0x1000b300
+r 0x1000ee80
+r 0x106b2640
+r 0x10007300
+w 0x10003d80
+r 0x10009e40
+r 0x10006840
+r 0x1000aec0
+r 0x1000ac80
+r 0x10001f00
+r 0x1000f4c0
+w 0x1000f440
+r 0x106d1680
+w 0x10008340
+r 0x10008300
+r 0x1000fac0
+r 0x10003d00
+r 0x10009100
+r 0x1000d780
+r 0x10006c80
+r 0x10007700
+r 0x10001380
+r 0x10007c00
+r 0x10008600
+r 0x1000ea40
+r 0x10006d80
+r 0x10ede600
+r 0x103a5400
+w 0x1000d040
+w 0x10002440
+r 0x1000dac0
+r 0x100011c0
+w 0x1000e980
+r 0x10000440
+r 0x1000dc80
+w 0x10003880
+r 0x10006a40
+r 0x1000ac40
+r 0x1000ac80
+r 0x10677500
+w 0x100042c0
+r 0x100091c0
+r 0x10007e80
+r 0x1000df80
+r 0x1000d400
+w 0x100034c0
+r 0x100068c0
+r 0x1000c0c0
+r 0x1000f800
+r 0x1020d8c0
+r 0x1000b800
+r 0x1000afc0
+r 0x10001400
+r 0x1000dd00
+r 0x10e65ac0
+r 0x10003540
+r 0x10002f40
+r 0x10b438c0
+r 0x1000ee80
+r 0x100072c0
+r 0x10005740
+r 0x10007e40
+r 0x1000a600
+r 0x10d72480
+w 0x1000e3c0
+r 0x10004e00
+r 0x10006740
+w 0x10374b40
+r 0x1033f240
+r 0x10002480
+r 0x10009300
+r 0x10003140
+r 0x1000dd80
+r 0x10001180
+r 0x100029c0
+w 0x10f16500
+r 0x1000e5c0
+w 0x10008800
+w 0x10005e00
+w 0x1000e840
+r 0x1000d300
+r 0x10003c00
+r 0x1000f5c0
+r 0x10001a80
+r 0x10000140
+r 0x10006140
+r 0x1000c300
+r 0x10005480
+r 0x10006080
+r 0x10007140
+r 0x10004980
+r 0x1000c300
+r 0x100030c0
+r 0x100084c0
+r 0x10007280
+r 0x10f14d00
+r 0x100025c0
+r 0x10006040
+r 0x1000d100
+w 0x10398040
+r 0x100098c0
+r 0x1000f500
+w 0x10006240
+r 0x1000fcc0
+r 0x1000b9c0
+r 0x100011c0
+r 0x1006d480
+r 0x1000f6c0
+r 0x1000f340
+r 0x10cab2c0
+r 0x100031c0
+r 0x1000dfc0
+w 0x10003fc0
+r 0x10002100
+r 0x100024c0
+r 0x10004c00
+r 0x1000f5c0
+r 0x100013c0
+r 0x1000f700
+r 0x1000c600
+r 0x10008700
+r 0x1000c3c0
+r 0x100061c0
+r 0x10fb30c0
+r 0x10004700
+r 0x10000180
+r 0x1000a280
+r 0x10006b00
+r 0x1000b5c0
+r 0x1000a840
+r 0x1000bb00
+r 0x10002900
+r 0x1000d540
+w 0x10008600
+r 0x10007bc0
+r 0x100004c0
+w 0x10004fc0
+r 0x1000be40
+r 0x1000ec80
+r 0x103dcac0
+r 0x1000d0c0
+r 0x1000cf00
+w 0x10e747c0
+r 0x10001500
+w 0x10006b80
+r 0x10f33c00
+r 0x10001f00
+r 0x10009480
+r 0x1000b700
+r 0x10515c80
+r 0x1000f500
+r 0x10008480
+r 0x1000bac0
+w 0x1000f780
+r 0x1000ccc0
+w 0x10000700
+r 0x10004580
+w 0x1000cf00
+r 0x1000b5c0
+r 0x10006980
+r 0x10004fc0
+r 0x1000e480
+r 0x1000d300
+r 0x100034c0
+w 0x1000a040
+r 0x10000040
+r 0x10008880
+r 0x10004b00
+r 0x10001800
+r 0x10000440
+r 0x10002200
+r 0x1000dfc0
+r 0x1000f940
+r 0x1000e5c0
+r 0x10008700
+r 0x1000b400
+r 0x10006ec0
+r 0x1000b200
+w 0x10001a40
+w 0x100049c0
+r 0x10003b80
+r 0x10002500
+r 0x10004800
+r 0x1000fb80
+w 0x10004c80
+r 0x1000a340
+r 0x100063c0
+r 0x10845c00
+r 0x1016be80
+r 0x10003dc0
+r 0x1000c680
+w 0x10006580
+r 0x1000a4c0
+r 0x100003c0
+r 0x10006f00
+w 0x10008080
+r 0x1000f400
+r 0x1000a140
+w 0x10000000
+r 0x10007a80
+r 0x100011c0
+w 0x10001540
+r 0x100088c0
+r 0x10005640
+r 0x10001140
+r 0x100091c0
+r 0x1000b2c0
+r 0x1000e200
+r 0x10002940
+r 0x10004940
+r 0x10002cc0
+r 0x10bb9900
+w 0x10007000
+r 0x10005c40
+r 0x10ffed40
+r 0x10000d00
+r 0x10001680
+w 0x1000f340
+r 0x10006bc0
+r 0x10002680
+w 0x10000340
+r 0x10003700
+r 0x100086c0
+r 0x1000be80
+r 0x1000b540
+r 0x10002f40
+w 0x1000a400
+r 0x108a4b00
+r 0x10cd3e40
+r 0x10001f00
+r 0x1000ba00
+r 0x10005f80
+r 0x10001a40
+r 0x100044c0
+r 0x10002dc0
+r 0x10009400
+r 0x10001ac0
+r 0x1000a980
+r 0x1000be40
+w 0x10004a80
+r 0x1000d5c0
+r 0x1000e680
+r 0x10006a40
+r 0x10009180
+r 0x100089c0
+r 0x10c2ce00
+w 0x1000e880
+w 0x1000c000
+r 0x10006f40
+w 0x10000840
+r 0x10005380
+r 0x1050ea40
+r 0x1000db00
+r 0x1000bd00
+r 0x10001fc0
+r 0x100081c0
+r 0x10006bc0
+r 0x1000c240
+w 0x1000ae80
+r 0x1000c3c0
+w 0x1000da80
+w 0x109b0fc0
+r 0x1000db00
+r 0x10007900
+r 0x10007f00
+w 0x10007400
+r 0x1000b840
+w 0x10007ac0
+r 0x100099c0
+r 0x1000b000
+r 0x10007580
+w 0x10009bc0
+w 0x1000f040
+r 0x10003d00
+r 0x10003c40
+w 0x10006380
+r 0x1000be40
+w 0x10009bc0
+r 0x1000c7c0
+r 0x1000a340
+w 0x10005380
+r 0x1000c400
+w 0x10bcc080
+r 0x100054c0
+r 0x10004d40
+w 0x1000c340
+r 0x10006980
+r 0x10007200
+r 0x10000280
+r 0x10004900
+r 0x1021a540
+r 0x1000f600
+w 0x1000ba40
+r 0x10d04180
+r 0x100046c0
+r 0x100031c0
+r 0x1000b080
+r 0x1000a380
+r 0x10001c40
+w 0x10002ec0
+w 0x1000b300
+r 0x10006c80
+r 0x1000fb80
+r 0x10002fc0
+r 0x1000db00
+r 0x10003680
+r 0x10002dc0
+r 0x1000d900
+r 0x10009800
+w 0x10005540
+r 0x100060c0
+r 0x10001800
+r 0x1000c9c0
+r 0x10006480
+r 0x1000c640
+r 0x10007540
+r 0x100027c0
+r 0x1000de80
+w 0x100064c0
+w 0x10006640
+w 0x1000a280
+w 0x1000ba40
+r 0x10002180
+r 0x10001dc0
+r 0x1000ae00
+r 0x10000ac0
+r 0x10004340
+r 0x1000c180
+r 0x1000bf40
+r 0x10001cc0
+r 0x1000cf00
+r 0x10003c80
+r 0x1000f500
+r 0x100031c0
+w 0x107013c0
+r 0x1000b840
+w 0x100068c0
+w 0x10004380
+r 0x1000df40
+w 0x1000c680
+w 0x10001f80
+r 0x10000e80
+r 0x10007a80
+r 0x1000c340
+w 0x102c8980
+r 0x10001d80
+r 0x10000c40
+r 0x1047db80
+r 0x10006d80
+r 0x10004940
+r 0x10009c80
+r 0x10001c80
+r 0x10006e00
+r 0x1000f640
+r 0x1000d480
+r 0x1000e2c0
+r 0x10626900
+w 0x10004dc0
+r 0x1000d6c0
+w 0x1000dd80
+r 0x10006300
+r 0x100005c0
+w 0x1000f3c0
+r 0x10000240
+r 0x10007940
+r 0x10001700
+r 0x10001240
+r 0x10a6c780
+r 0x1000fb80
+r 0x1000c500
+r 0x1000db80
+r 0x1000b180
+r 0x10007c40
+r 0x1000d280
+r 0x1000f440
+r 0x1000c080
+r 0x10006f80
+r 0x10003d40
+r 0x1000f440
+r 0x1000dd00
+r 0x104c1640
+r 0x100002c0
+r 0x1000b280
+r 0x10008840
+r 0x1000be40
+w 0x100003c0
+r 0x10397b80
+w 0x10a50940
+r 0x1000d580
+r 0x10009280
+r 0x100061c0
+w 0x1000db80
+r 0x10002c40
+r 0x1000a180
+r 0x10006200
+w 0x1000bb40
+r 0x1000ee00
+r 0x10008b80
+w 0x10002480
+r 0x10007b00
+w 0x10a34140
+w 0x1000b380
+r 0x10008780
+r 0x10343580
+r 0x1000e600
+r 0x1000ab00
+r 0x10001e80
+r 0x1000b600
+w 0x1000b800
+r 0x1000bf80
+r 0x10003500
+r 0x10005f40
+r 0x10003f40
+w 0x10007e40
+r 0x1000ac80
+r 0x10007b00
+r 0x10000580
+r 0x1000c080
+r 0x10006280
+r 0x10007940
+r 0x1000cc80
+w 0x10006c00
+w 0x10004ac0
+r 0x10002a80
+r 0x10007500
+r 0x1000be40
+w 0x1000db80
+w 0x1000e980
+w 0x10003280
+r 0x10008d80
+w 0x1000e8c0
+w 0x10008dc0
+r 0x10001bc0
+w 0x10004c00
+w 0x10002340
+r 0x100067c0
+w 0x1000cec0
+r 0x10d9a140
+r 0x1000e100
+r 0x10007280
+r 0x1000d480
+r 0x10000a00
+r 0x10004340
+w 0x1000b100
+r 0x1000c300
+r 0x1000d100
+r 0x1000dbc0
+r 0x10000200
+r 0x10004ac0
+w 0x1091bd00
+r 0x10007500
+r 0x1000a080
+r 0x10005940
+w 0x10004080
+r 0x10004680
+r 0x10004b00
+r 0x1000d000
+r 0x100af840
+r 0x10002900
+r 0x1000c840
+w 0x10004740
+r 0x1000bfc0
+r 0x10005900
+r 0x10003380
+r 0x100091c0
+r 0x10009680
+r 0x10811e40
+r 0x1000db00
+r 0x1000e280
+r 0x102a7440
+r 0x1000f880
+r 0x100006c0
+r 0x10005140
+w 0x1000d080
+r 0x1000e640
+w 0x1000c340
+r 0x10001ec0
+r 0x1000bdc0
+w 0x1000ee40
+w 0x109a2d40
+r 0x1000a1c0
+r 0x1000e6c0
+r 0x10000000
+r 0x10007d40
+w 0x10009c80
+w 0x10008fc0
+r 0x10001d80
+r 0x10008940
+w 0x10005800
+r 0x1000e300
+r 0x1000d640
+r 0x10009ec0
+r 0x10d2f3c0
+r 0x10008440
+r 0x10005640
+r 0x1000d840
+r 0x1000f7c0
+r 0x10005b80
+r 0x1000b980
+r 0x10b52fc0
+r 0x10008340
+r 0x1000b140
+r 0x1000a0c0
+r 0x10002400
+r 0x10f1df80
+r 0x10007600
+r 0x10005d40
+r 0x10005240
+r 0x10009480
+r 0x10009ec0
+r 0x1000f500
+w 0x10000580
+r 0x10009e00
+w 0x1000df00
+r 0x10468ac0
+r 0x10005500
+r 0x1000aec0
+r 0x10005b40
+r 0x1000b300
+r 0x10008e40
+r 0x1000fac0
+r 0x10006a00
+r 0x1000d500
+r 0x1000a0c0
+r 0x1000acc0
+r 0x10344540
+r 0x10009bc0
+r 0x1000a3c0
+r 0x10009bc0
+r 0x1000de40
+r 0x10d80980
+r 0x10001080
+w 0x10a90ec0
+w 0x1000d700
+r 0x10005380
+r 0x10004900
+r 0x1000f1c0
+r 0x1000ac80
+r 0x1000f000
+r 0x10007280
+r 0x10007500
+r 0x1000c180
+w 0x1000dbc0
+r 0x1000e780
+r 0x10002880
+r 0x1000b580
+r 0x1026f880
+r 0x10006980
+r 0x10009240
+w 0x100012c0
+r 0x1000f800
+r 0x100046c0
+r 0x10008880
+r 0x10009d00
+r 0x10000c40
+r 0x10000140
+w 0x10002b00
+r 0x1000c980
+w 0x100039c0
+r 0x1000a740
+r 0x10002dc0
+r 0x1000c240
+r 0x10004a40
+r 0x10004a80
+r 0x10006bc0
+r 0x10009600
+r 0x1000b180
+r 0x100032c0
+w 0x10005d40
+r 0x10005800
+r 0x10003dc0
+r 0x1000eb00
+r 0x1000c0c0
+r 0x1000cc80
+r 0x1000b1c0
+r 0x1000bf00
+w 0x10000c00
+r 0x100064c0
+r 0x10003300
+r 0x10003340
+w 0x10006f40
+r 0x10003040
+w 0x10c8c180
+r 0x1000dc80
+r 0x1000a540
+r 0x10000300
+w 0x100021c0
+r 0x1000e740
+w 0x1000f100
+r 0x10005100
+r 0x1000c280
+r 0x10002e00
+r 0x1000cbc0
+r 0x10006f40
+r 0x100025c0
+w 0x100095c0
+r 0x100020c0
+r 0x1000c500
+w 0x10005bc0
+w 0x10006100
+w 0x10001680
+w 0x10005f00
+r 0x1000cd40
+r 0x101e8380
+w 0x1000f300
+r 0x10001a80
+w 0x10000c80
+r 0x10009780
+w 0x10008dc0
+w 0x10000500
+r 0x1000d6c0
+w 0x10bd3200
+r 0x10006740
+r 0x1000b940
+w 0x10003c80
+r 0x10000440
+r 0x100092c0
+w 0x10000640
+w 0x10002080
+r 0x10005e00
+r 0x1000ff00
+r 0x10004f40
+r 0x10000180
+r 0x1000b780
+r 0x10000640
+w 0x10b1ad80
+r 0x1000ea00
+w 0x1000fac0
+r 0x1000f680
+r 0x10004200
+w 0x10004480
+r 0x10009a80
+w 0x10bdb600
+w 0x105a2c80
+r 0x1000e7c0
+r 0x1000ffc0
+r 0x10749b40
+r 0x1000e980
+r 0x10004f00
+w 0x1000f3c0
+r 0x1000d140
+r 0x100022c0
+r 0x1000e5c0
+r 0x10000000
+r 0x100087c0
+w 0x100043c0
+r 0x1000b840
+w 0x1000b200
+r 0x1000fe80
+r 0x102e38c0
+r 0x100030c0
+r 0x10000840
+r 0x10000840
+r 0x10c83dc0
+r 0x1000bf80
+w 0x10001a80
+r 0x10007a00
+r 0x10007ac0
+r 0x10000300
+r 0x1000d680
+r 0x10009a40
+r 0x1000dd00
+r 0x10008e80
+r 0x10009380
+w 0x10005600
+r 0x1000ff80
+r 0x1000e380
+r 0x1000afc0
+r 0x10afea40
+r 0x10001900
+r 0x1000c780
+w 0x10003500
+r 0x10e4d1c0
+w 0x1000dd40
+r 0x10002cc0
+r 0x1000c1c0
+r 0x10003540
+r 0x10001b00
+r 0x10008180
+r 0x1000c080
+w 0x1000f540
+r 0x10008d80
+r 0x1000ba80
+w 0x10008b80
+r 0x1000f740
+r 0x10008c00
+w 0x10003b00
+w 0x10001b00
+r 0x10005580
+w 0x1000bfc0
+r 0x10005b80
+r 0x108b26c0
+r 0x10003280
+r 0x10002c40
+r 0x1000de00
+r 0x1000e580
+r 0x10004400
+r 0x1000e340
+r 0x1000bcc0
+r 0x1000ae00
+w 0x10002bc0
+r 0x100057c0
+w 0x10005640
+w 0x10007300
+r 0x10005280
+w 0x103867c0
+r 0x102c5240
+r 0x1000b600
+w 0x100062c0
+w 0x10001800
+r 0x10005180
+r 0x1000ad40
+r 0x1000e540
+w 0x1000c540
+r 0x100054c0
+r 0x10774540
+w 0x10000240
+r 0x10001600
+r 0x10001b00
+r 0x100078c0
+r 0x10008d40
+r 0x10f14200
+r 0x10007f00
+r 0x10001e80
+r 0x10004f00
+r 0x1000cac0
+w 0x1000ea00
+r 0x1000c100
+r 0x10007d00
+r 0x10009180
+r 0x10a23ec0
+r 0x1000da80
+r 0x10005b80
+r 0x1000ff00
+r 0x10e3ca40
+r 0x10002900
+w 0x1000c300
+r 0x1000c900
+w 0x10ca37c0
+w 0x1000fd00
+r 0x10005880
+r 0x1000b040
+r 0x10004c40
+r 0x10003b40
+r 0x1000a6c0
+w 0x10001600
+w 0x10005ac0
+r 0x10002080
+r 0x10000980
+r 0x100090c0
+r 0x10006140
+r 0x10001d40
+r 0x1000d340
+r 0x1000fcc0
+r 0x10001ac0
+w 0x10004800
+r 0x10008e40
+r 0x105b4a80
+r 0x10008fc0
+r 0x10c55600
+w 0x10008400
+r 0x10001740
+r 0x10000840
+r 0x1083b400
+w 0x10003c80
+r 0x100045c0
+r 0x1000e780
+r 0x100020c0
+r 0x100086c0
+w 0x1000e700
+r 0x10005c00
+w 0x100036c0
+r 0x10006a80
+w 0x10007cc0
+r 0x10005900
+r 0x1000c440
+r 0x1000f140
+r 0x1000b640
+r 0x10006dc0
+r 0x10006680
+r 0x10006dc0
+r 0x1000d180
+r 0x108f3440
+w 0x10005b40
+r 0x10007040
+w 0x10004c40
+r 0x1000be80
+r 0x1000ff80
+r 0x10000ac0
+w 0x10001b80
+r 0x10005280
+w 0x10009c80
+r 0x10003140
+r 0x10006840
+r 0x1000a900
+w 0x10a80d80
+r 0x10009fc0
+r 0x10001880
+r 0x10005080
+r 0x10007fc0
+r 0x1000fac0
+w 0x1000fcc0
+r 0x10008240
+r 0x1000afc0
+r 0x10006d80
+w 0x1000f280
+r 0x1000b880
+w 0x10007e00
+w 0x100083c0
+r 0x1000a640
+r 0x10008ec0
+r 0x10004340
+r 0x1000b900
+r 0x10006940
+r 0x100025c0
+w 0x10004d00
+r 0x1000c840
+r 0x100085c0
+w 0x1000b980
+r 0x10001340
+r 0x10003e40
+r 0x1000ba40
+r 0x10004080
+w 0x1000f3c0
+r 0x10003780
+r 0x10003580
+r 0x100092c0
+r 0x109e8140
+r 0x10007400
+r 0x1000f000
+w 0x1000bdc0
+r 0x10008880
+r 0x10002400
+r 0x10002300
+r 0x1000bfc0
+r 0x10006800
+w 0x10002fc0
+r 0x10000640
+w 0x100093c0
+w 0x10008d40
+r 0x10005780
+r 0x1000b1c0
+w 0x10007280
+r 0x10001a40
+w 0x10007840
+r 0x10008e40
+r 0x10003480
+r 0x1000f5c0
+w 0x1000c7c0
+w 0x10004680
+r 0x1000ba00
+r 0x1000cc40
+r 0x10003c00
+w 0x10007680
+r 0x10afcbc0
+w 0x10005740
+r 0x1000fb40
+w 0x10003d40
+r 0x1000f440
+r 0x10001ac0
+w 0x1000af00
+r 0x1000eb00
+r 0x1000c640
+r 0x10008200
+r 0x100018c0
+r 0x10000780
+r 0x1000c780
+r 0x106f7b00
+r 0x1000bc40
+r 0x10006880
+r 0x10008f00
+r 0x10fafbc0
+r 0x1000ee00
+r 0x104e7700
+r 0x100062c0
+r 0x1000f3c0
+r 0x10001440
+r 0x1000a300
+r 0x10006f40
+r 0x10007d80
+w 0x1000b000
+r 0x10009c00
+r 0x10003580
+r 0x1056e840
+r 0x10000440
+r 0x10000b40
+r 0x1000f640
+w 0x1000f840
+r 0x10004500
+r 0x10008780
+r 0x1000af80
+r 0x10faa1c0
+r 0x1000f940
+r 0x1000b980
+r 0x10000740
+r 0x1058fb80
+r 0x10003780
+r 0x1000a9c0
+r 0x100019c0
+r 0x10009080
+r 0x10008fc0
+r 0x1000e740
+r 0x1000c3c0
+r 0x10007e00
+r 0x10b8bc80
+r 0x10004dc0
+r 0x10c34c40
+r 0x104a5c00
+w 0x1000d740
+r 0x10001ec0
+w 0x10008180
+r 0x10009380
+r 0x106f3280
+r 0x1000f8c0
+r 0x1000f980
+w 0x10ffaa80
+r 0x10002340
+r 0x1000aac0
+r 0x10006500
+r 0x1000e800
+r 0x10003180
+r 0x10000380
+r 0x1000d6c0
+r 0x10008b40
+r 0x1000bf80
+w 0x10001b40
+r 0x10000ac0
+r 0x1000dbc0
+r 0x10000d80
+r 0x10006940
+w 0x1000fd00
+w 0x1000ea00
+r 0x1000e980
+r 0x1000b240
+r 0x10724640
+r 0x1000e780
+r 0x1000e640
+r 0x10007640
+r 0x10ae3b00
+r 0x10002880
+r 0x10009740
+r 0x10006680
+r 0x100078c0
+r 0x1000a6c0
+r 0x1000a200
+r 0x1000a280
+r 0x1000f800
+r 0x1000f400
+r 0x10007000
+r 0x10004ec0
+r 0x1000e640
+r 0x10000900
+r 0x10007100
+w 0x1000be00
+r 0x10009440
+w 0x1000cd00
+w 0x10008880
+r 0x10005ac0
+r 0x1000f100
+r 0x10006440
+r 0x10001e80
+r 0x1000b140
+r 0x10005080
+r 0x100066c0
+r 0x1000c240
+r 0x10538200
+r 0x100032c0
+w 0x10001b80
+r 0x10008100
+r 0x10006500
+w 0x10008280
+r 0x10001f40
+r 0x1000d800
+r 0x100069c0
+r 0x1000c480
+r 0x100033c0
+r 0x10000880
+r 0x10df8c80
+r 0x10004500
+r 0x10006780
+r 0x10000640
+w 0x10008dc0
+r 0x1000a940
+r 0x10005740
+r 0x100029c0
+r 0x1000a3c0
+w 0x100069c0
+r 0x10009a80
+w 0x1000dc40
+r 0x10001240
+r 0x1000d080
+r 0x100057c0
+r 0x10005700
+r 0x10008200
+r 0x1000a600
+w 0x1000c740
+r 0x100027c0
+r 0x10003cc0
+r 0x1000f240
+w 0x10005600
+w 0x103a3b40
+r 0x10001bc0
+w 0x1000fa80
+w 0x10008900
+r 0x1000fd00
+w 0x10a29a00
+r 0x10001e00
+r 0x1000ed00
+r 0x10007380
+r 0x10009700
+w 0x10003f80
+r 0x10007200
+r 0x10006b80
+r 0x1000fa80
+w 0x10005800
+r 0x1000e2c0
+r 0x1000b200
+r 0x10008f40
+r 0x10000e00
+r 0x10000800
+r 0x10000c40
+r 0x10000b00
+r 0x10009980
+r 0x100099c0
+r 0x10001ac0
+r 0x1000b180
+r 0x10323d80
+r 0x1000d000
+r 0x10002780
+r 0x10009100
+r 0x100089c0
+r 0x1000db80
+r 0x10000e80
+r 0x10000d00
+r 0x1000aa80
+r 0x10005c00
+r 0x1000f700
+r 0x1000c340
+r 0x1000eac0
+r 0x1000e3c0
+r 0x102c5e00
+r 0x1000cbc0
+w 0x1000fa80
+r 0x10004540
+r 0x10004300
+r 0x10be3680
+r 0x1000ac40
+r 0x1000a8c0
+r 0x10004540
+r 0x102e0e40
+w 0x10fa1300
+w 0x10008240
+r 0x100000c0
+w 0x10006a00
+r 0x10001100
+w 0x10004380
+r 0x10004f00
+r 0x10005780
+w 0x1000fc00
+r 0x10004380
+r 0x1000cc80
+r 0x10002800
+r 0x10007d40
+r 0x1000e5c0
+r 0x10004500
+w 0x10004940
+r 0x10001700
+w 0x1000e440
+r 0x1000eb40
+r 0x10000940
+r 0x1023c740
+r 0x1000f080
+r 0x10001ac0
+r 0x10002980
+r 0x10002000
+w 0x10001e00
+r 0x100088c0
+r 0x10001340
+r 0x10002e80
+r 0x1000df00
+r 0x1000edc0
+r 0x10789f80
+r 0x10003b00
+r 0x106a6b80
+w 0x10004640
+r 0x1000a280
+r 0x10000e00
+r 0x1000de80
+r 0x10003380
+r 0x10004140
+r 0x1043f0c0
+r 0x10002b00
+r 0x1000ea00
+w 0x10b23240
+w 0x10004740
+r 0x10009f00
+r 0x10b9e8c0
+r 0x10001080
+r 0x1000cd40
+r 0x10006c40
+r 0x100018c0
+r 0x10000600
+w 0x10002240
+r 0x1000e700
+w 0x100050c0
+r 0x100049c0
+r 0x100096c0
+r 0x10007d80
+r 0x1000eec0
+r 0x100050c0
+r 0x1000aa80
+r 0x10ae6700
+r 0x10002ac0
+r 0x1000dc80
+w 0x1000b740
+w 0x10004300
+r 0x10bd6000
+r 0x1000cd80
+r 0x1000d080
+r 0x10006bc0
+r 0x10baa9c0
+r 0x1000e040
+r 0x100078c0
+r 0x10003dc0
+r 0x1000c300
+r 0x10002500
+r 0x10001740
+r 0x100071c0
+r 0x1000f240
+r 0x10001880
+r 0x1000f040
+r 0x10004bc0
+w 0x1000fd40
+r 0x101e2a80
+w 0x1000ec00
+r 0x10007080
+r 0x100010c0
+r 0x10001d40
+r 0x10003800
+r 0x1000e0c0
+r 0x1000ccc0
+r 0x100099c0
+r 0x100070c0
+r 0x1000ea80
+r 0x10007a80
+r 0x10003680
+r 0x100004c0
+r 0x1000fa80
+r 0x10007000
+r 0x10001600
+r 0x108d0b80
+w 0x10008f00
+r 0x10f48e00
+w 0x1000de00
+r 0x10f373c0
+r 0x1000c100
+r 0x10004880
+w 0x1000e440
+r 0x1000adc0
+r 0x10006dc0
+w 0x10002300
+r 0x10001840
+r 0x10000900
+w 0x1000e3c0
+r 0x10008340
+r 0x10004c40
+r 0x10001080
+r 0x10007b80
+r 0x1000e900
+w 0x10007240
+r 0x10006440
+r 0x1000c840
+w 0x105110c0
+r 0x10009280
+r 0x1000e3c0
+r 0x10005e80
+r 0x100052c0
+r 0x1000cc00
+r 0x100012c0
+r 0x10005740
+r 0x10000b80
+r 0x10005740
+r 0x1000fc00
+r 0x1000c9c0
+r 0x10003c00
+r 0x10009740
+r 0x100052c0
+r 0x1000dec0
+w 0x10ae0a40
+r 0x10003240
+w 0x10006080
+r 0x1000cd40
+r 0x10004fc0
+r 0x100082c0
+r 0x1000a200
+r 0x1000d7c0
+r 0x10009500
+w 0x10002fc0
+r 0x10005f40
+r 0x10004000
+r 0x10005240
+r 0x100093c0
+r 0x10004a40
+r 0x10000880
+r 0x10000ec0
+r 0x1000e480
+r 0x10004f80
+r 0x10004a00
+w 0x1018e000
+r 0x1000b480
+r 0x10007700
+r 0x1000ab80
+w 0x1000ff80
+r 0x10009340
+r 0x10005e40
+w 0x10002ec0
+r 0x10007d00
+r 0x10002bc0
+r 0x10047540
+r 0x10001c40
+r 0x1000a2c0
+r 0x10065b40
+r 0x10006d40
+w 0x10009300
+w 0x10003780
+r 0x10001800
+r 0x10758980
+r 0x10009a40
+w 0x1000fc40
+r 0x10ae6b00
+r 0x10af3840
+r 0x10005240
+w 0x10d9c8c0
+w 0x10008f00
+r 0x1000ca00
+r 0x100069c0
+w 0x10000380
+r 0x10004840
+r 0x10006680
+r 0x1000ef80
+r 0x10004240
+r 0x10005f80
+r 0x10001600
+r 0x105d80c0
+r 0x1000d480
+r 0x10003500
+r 0x10009580
+r 0x10004780
+r 0x10007f00
+r 0x10001a00
+w 0x10004ac0
+r 0x1000db00
+r 0x10000700
+r 0x10003c00
+r 0x10005900
+w 0x1000e9c0
+r 0x10003e00
+r 0x10b12700
+r 0x10008d00
+w 0x10b4f040
+r 0x10772300
+r 0x1000bd40
+r 0x1000a6c0
+r 0x10007680
+r 0x10002d40
+r 0x10006e80
+r 0x10003380
+w 0x10000200
+r 0x10000e80
+r 0x1000a4c0
+w 0x10000cc0
+r 0x10001b40
+w 0x1000d540
+r 0x10004b00
+w 0x100021c0
+w 0x1000f0c0
+r 0x1000e500
+r 0x10004540
+w 0x10006c40
+r 0x10000e00
+r 0x10001740
+r 0x10007400
+r 0x10007f80
+r 0x10224ac0
+r 0x10008d40
+r 0x100067c0
+r 0x1000f7c0
+r 0x10009f40
+r 0x10005840
+r 0x1000bc00
+r 0x10004bc0
+r 0x10005780
+r 0x10006380
+w 0x10000a80
+r 0x102f4380
+w 0x10519d00
+r 0x1000d700
+r 0x10009ec0
+r 0x10006940
+r 0x101e2740
+r 0x1000fd00
+r 0x1000bd40
+r 0x10007d40
+r 0x10008980
+w 0x10007c00
+r 0x1000a6c0
+r 0x10008bc0
+w 0x10002200
+r 0x100045c0
+r 0x10002700
+w 0x100071c0
+r 0x10003800
+r 0x10007d80
+w 0x10cfda80
+w 0x10000fc0
+r 0x10008880
+w 0x10001900
+w 0x10002680
+r 0x10003d40
+r 0x1000a8c0
+r 0x10009ec0
+r 0x1000fc00
+r 0x1000d5c0
+r 0x10006040
+r 0x10006dc0
+r 0x1000a0c0
+r 0x100093c0
+r 0x10005d00
+r 0x10006e80
+r 0x100009c0
+r 0x1000e040
+w 0x10009b40
+w 0x1000adc0
+r 0x1000d140
+r 0x10000d80
+r 0x10004640
+r 0x10006e00
+r 0x10c1e400
+r 0x10002cc0
+r 0x10004700
+r 0x1000cb80
+r 0x10004a80
+r 0x1000b180
+r 0x10008140
+w 0x10004e00
+r 0x10007600
+r 0x1000fd80
+r 0x10004700
+r 0x10002880
+r 0x10009d00
+w 0x10003c00
+r 0x1000d640
+r 0x10002680
+r 0x1000f680
+r 0x10008800
+r 0x10002940
+r 0x1000dc80
+r 0x107b0e00
+r 0x10006140
+r 0x1000af40
+w 0x1000dc80
+w 0x10002f00
+w 0x100098c0
+w 0x10001000
+r 0x10005640
+r 0x1000e100
+r 0x100033c0
+r 0x10004a00
+w 0x1000e740
+r 0x10002040
+r 0x10003980
+r 0x10381340
+r 0x10000800
+r 0x1000a400
+r 0x10005dc0
+r 0x10000d00
+r 0x10009d80
+r 0x10007080
+r 0x10007400
+r 0x100046c0
+r 0x10005640
+w 0x100086c0
+r 0x10004400
+r 0x10008b00
+r 0x10006700
+r 0x10002b40
+r 0x10004a80
+r 0x100098c0
+r 0x1000e600
+r 0x1000c540
+r 0x1000d600
+r 0x1000c400
+r 0x100010c0
+r 0x10001c00
+w 0x1000cb00
+w 0x1000b280
+w 0x10007e00
+r 0x10002540
+r 0x10009380
+r 0x100082c0
+w 0x10005f80
+r 0x1000f140
+r 0x10002900
+w 0x1000f000
+w 0x10007c80
+r 0x10007240
+w 0x1021b540
+w 0x1000d600
+r 0x1000bc40
+w 0x10000e40
+r 0x10000740
+w 0x1000f100
+r 0x10008a80
+r 0x10001bc0
+r 0x1000b440
+r 0x10a6f300
+w 0x10000900
+r 0x10002640
+r 0x1000ba80
+r 0x10004800
+r 0x10006680
+r 0x100009c0
+r 0x10c00c00
+w 0x10000b40
+r 0x1000fdc0
+w 0x102f01c0
+r 0x1000b480
+r 0x106ff3c0
+w 0x100038c0
+w 0x10007d00
+r 0x10001340
+w 0x1000b180
+w 0x1000b200
+r 0x1000fbc0
+w 0x10007800
+r 0x102c6640
+w 0x10000480
+r 0x10009d00
+r 0x100066c0
+r 0x10006680
+w 0x1000de40
+r 0x100042c0
+w 0x10005200
+w 0x10006280
+r 0x10009340
+w 0x109aa240
+r 0x10008f80
+r 0x10003280
+r 0x10004100
+r 0x10003340
+r 0x107dfcc0
+r 0x100017c0
+r 0x10003d80
+r 0x10005140
+r 0x10001200
+r 0x1000a540
+w 0x10004480
+r 0x100059c0
+r 0x1000ee80
+r 0x10006e00
+r 0x10003f40
+r 0x10c6f880
+r 0x10007500
+r 0x10003c00
+r 0x1000ba00
+r 0x10000980
+r 0x100032c0
+w 0x10009040
+w 0x10008780
+w 0x10005280
+r 0x10000840
+r 0x1000ad00
+r 0x10003b00
+r 0x10000140
+r 0x10007840
+r 0x10008cc0
+r 0x1000c880
+r 0x1000e540
+r 0x1000a2c0
+r 0x10688b40
+r 0x10009e80
+r 0x10009f00
+r 0x1000cf00
+r 0x1000dd40
+r 0x100072c0
+r 0x100095c0
+r 0x10002140
+r 0x1000af40
+w 0x1000e940
+r 0x10009100
+r 0x1000e480
+r 0x1049aec0
+r 0x10005580
+r 0x10001e80
+r 0x100056c0
+w 0x1000ce80
+r 0x10005080
+r 0x10005500
+r 0x1000d480
+r 0x10003c40
+r 0x10dc2200
+r 0x10009f00
+r 0x1000cb40
+r 0x10009300
+r 0x10008140
+r 0x10005200
+w 0x1000b980
+r 0x1000c980
+r 0x1000fe80
+w 0x1000d040
+w 0x10002b00
+r 0x10007d00
+r 0x100058c0
+r 0x1000f3c0
+w 0x10003b00
+r 0x1000d5c0
+r 0x1000e940
+w 0x10003400
+r 0x10005780
+r 0x10003700
+r 0x1000c740
+r 0x10001b00
+r 0x10004200
+r 0x10008b40
+w 0x10001f80
+r 0x1000a600
+r 0x10005800
+r 0x100036c0
+w 0x10006980
+r 0x1000e340
+w 0x10004100
+w 0x10009a00
+r 0x1000dbc0
+r 0x1000c240
+r 0x107877c0
+w 0x1000eac0
+w 0x1000e840
+r 0x10aee680
+r 0x10003100
+r 0x10006bc0
+r 0x10004a80
+r 0x10005600
+r 0x10940540
+r 0x1000a8c0
+w 0x10001540
+r 0x1000c600
+r 0x10005580
+r 0x1000ae40
+r 0x1000f900
+w 0x100097c0
+r 0x1000f900
+w 0x1000f300
+r 0x10008700
+r 0x10003040
+r 0x1000cf80
+r 0x10006980
+w 0x10001c80
+r 0x10006b00
+r 0x10006180
+r 0x10003fc0
+r 0x10000240
+r 0x10009340
+r 0x10003740
+r 0x10006480
+r 0x10006f00
+r 0x10002c40
+r 0x1000d080
+r 0x100013c0
+r 0x10009d80
+r 0x10003880
+r 0x10005480
+r 0x10000180
+w 0x1000efc0
+w 0x10006280
+r 0x1000a540
+r 0x10009940
+w 0x10000e40
+r 0x10002440
+r 0x10467dc0
+r 0x1000d640
+r 0x1000ad40
+r 0x10006980
+w 0x10003c00
+r 0x1000c8c0
+r 0x10007d40
+r 0x10003ec0
+r 0x1000fb00
+w 0x10001680
+w 0x10002d00
+r 0x102f8bc0
+w 0x10005b40
+w 0x1000af40
+r 0x10008840
+r 0x10000f00
+r 0x10009100
+r 0x10002940
+w 0x10004140
+r 0x10001a80
+r 0x1000ffc0
+r 0x1000e3c0
+r 0x1000c9c0
+r 0x10008500
+r 0x10006e00
+r 0x10008480
+r 0x10000580
+r 0x10006480
+r 0x10002e00
+r 0x100087c0
+r 0x10003cc0
+r 0x10004440
+r 0x10009040
+w 0x1000b440
+r 0x10001280
+r 0x10007000
+w 0x10007680
+r 0x10008080
+r 0x10006080
+w 0x1000adc0
+r 0x10617240
+r 0x10c92dc0
+r 0x10009100
+r 0x1000b700
+w 0x10006080
+r 0x10007f80
+r 0x1000ffc0
+r 0x10002340
+r 0x10003940
+r 0x10002a40
+r 0x1000fac0
+r 0x1000d480
+r 0x1000b4c0
+r 0x10007e80
+w 0x10003180
+r 0x10007940
+w 0x10004780
+w 0x1000ca00
+r 0x1000eac0
+r 0x1000a840
+r 0x10fe0d80
+r 0x10004740
+r 0x10001240
+r 0x10003440
+r 0x10007400
+r 0x1000ed40
+r 0x100076c0
+r 0x1000ba40
+r 0x10001cc0
+r 0x10000040
+r 0x10004280
+w 0x10002c00
+w 0x10003a40
+r 0x10003200
+r 0x1000c6c0
+w 0x100044c0
+r 0x10001e40
+w 0x1000fac0
+r 0x10002a40
+r 0x100024c0
+r 0x10001e80
+r 0x10007400
+r 0x10503d80
+r 0x1000c740
+r 0x10001a00
+r 0x1000bd80
+w 0x10001780
+r 0x1000a600
+r 0x1000f740
+r 0x10009a40
+r 0x1000b840
+w 0x100050c0
+r 0x100027c0
+r 0x100063c0
+r 0x10000240
+r 0x10006600
+w 0x10002b40
+r 0x10007fc0
+w 0x1062fdc0
+r 0x1000edc0
+r 0x1000ac80
+w 0x1000f680
+r 0x1000a180
+r 0x1000a880
+r 0x1000df80
+r 0x10003040
+w 0x10009240
+r 0x10006ec0
+r 0x10003740
+r 0x10001540
+r 0x1000b640
+r 0x1000bf00
+w 0x1000b480
+r 0x10009d40
+r 0x10001340
+r 0x1000e400
+r 0x1000ba40
+r 0x10000440
+r 0x10000300
+r 0x10000400
+r 0x100032c0
+r 0x105ef680
+r 0x10003500
+w 0x10715e80
+w 0x1000e6c0
+r 0x10009580
+r 0x10000bc0
+r 0x100053c0
+r 0x100042c0
+r 0x10002540
+r 0x10009680
+r 0x104c1840
+w 0x10f24700
+r 0x10009f40
+w 0x10e15300
+w 0x1039dd80
+r 0x10008c80
+r 0x1000e9c0
+r 0x10009a00
+r 0x100060c0
+r 0x10006680
+r 0x10003400
+w 0x10007600
+r 0x1000fc00
+w 0x1000f0c0
+r 0x1000b880
+r 0x1000c500
+r 0x1000f900
+r 0x1000c040
+w 0x1000a840
+r 0x10004840
+r 0x1000e300
+r 0x100033c0
+r 0x10955f00
+w 0x100004c0
+r 0x10009140
+r 0x1000ff40
+w 0x10003f80
+r 0x10562100
+r 0x10004340
+r 0x100025c0
+r 0x10003200
+r 0x1000adc0
+r 0x1000b340
+w 0x10006840
+r 0x1000aa00
+r 0x10007d80
+r 0x100059c0
+r 0x10004280
+r 0x10005bc0
+w 0x10009900
+r 0x10001b80
+r 0x1000d0c0
+r 0x1000d940
+r 0x10001240
+r 0x1000a8c0
+r 0x10007ec0
+r 0x10293a00
+r 0x10008400
+r 0x10001000
+r 0x1000bf00
+r 0x10002140
+r 0x10005b00
+r 0x10003b00
+w 0x1011bf00
+r 0x1000fb00
+r 0x1000d100
+r 0x1000d940
+r 0x10008a00
+w 0x10004680
+w 0x100090c0
+r 0x10002880
+w 0x1016ecc0
+w 0x1000dbc0
+r 0x10001580
+r 0x101160c0
+r 0x10002480
+r 0x1000b5c0
+w 0x1000b7c0
+w 0x1000b800
+r 0x100038c0
+r 0x100083c0
+r 0x10005dc0
+r 0x10008d00
+r 0x107f9c00
+r 0x10001580
+r 0x1000be00
+w 0x10009100
+r 0x1000d4c0
+r 0x1000c040
+r 0x1000e440
+r 0x10007380
+r 0x10003540
+r 0x10005540
+w 0x10003540
+r 0x10000d00
+r 0x10003d80
+r 0x1000eec0
+w 0x10008e40
+r 0x10000140
+r 0x10b14f00
+r 0x1000bb40
+r 0x1000aec0
+w 0x1000ea80
+r 0x100001c0
+r 0x10008900
+r 0x10006740
+w 0x1031a080
+r 0x10005800
+r 0x10ef4bc0
+w 0x10009700
+r 0x10005bc0
+r 0x10009bc0
+r 0x10007e00
+r 0x1000ff40
+r 0x10009380
+r 0x1000ea80
+r 0x10005c80
+r 0x1000e900
+r 0x1000dc40
+w 0x1000e580
+r 0x10002e40
+r 0x1000fb80
+r 0x1053a280
+r 0x10005b00
+r 0x10002b80
+r 0x1000b780
+w 0x1000c580
+r 0x10009340
+r 0x1000f9c0
+r 0x10002b00
+r 0x100057c0
+r 0x103dd240
+r 0x1000f9c0
+r 0x101be700
+r 0x1000d840
+r 0x10001c80
+r 0x10002580
+r 0x1000bc40
+r 0x10009d40
+w 0x1000a300
+r 0x100066c0
+r 0x100029c0
+w 0x10009000
+r 0x10001ec0
+r 0x1000b9c0
+r 0x1000ffc0
+w 0x1000ac40
+r 0x10008800
+r 0x1000b280
+r 0x10bab380
+r 0x10002e00
+r 0x10005a40
+w 0x10005180
+r 0x100059c0
+r 0x1000d480
+r 0x1000a640
+r 0x10007880
+w 0x10005f40
+r 0x10844f40
+r 0x10008cc0
+r 0x1000fa80
+r 0x1000d980
+r 0x10eb7d40
+r 0x1000b300
+w 0x10001c80
+r 0x10004580
+r 0x10003d80
+r 0x10005b00
+r 0x1032de00
+r 0x10007980
+r 0x10005280
+r 0x1000df00
+r 0x10008940
+w 0x1000e180
+r 0x1000ea00
+r 0x10cb9f00
+r 0x106a5300
+r 0x10008680
+r 0x10002ec0
+r 0x1000a740
+r 0x1000c180
+r 0x10483e00
+r 0x10003e00
+r 0x10ee7180
+r 0x10e9e540
+r 0x10001480
+r 0x10008800
+r 0x1000b4c0
+r 0x1000e940
+r 0x10003540
+w 0x10000540
+r 0x1014f740
+r 0x1000d600
+r 0x10000780
+r 0x1000f280
+r 0x100047c0
+r 0x1000dc00
+r 0x10001380
+r 0x10005380
+w 0x1000d740
+r 0x1000e880
+r 0x1000c600
+r 0x1000a680
+r 0x1000a480
+r 0x1000f040
+w 0x10009c40
+r 0x10007d00
+r 0x10008780
+r 0x100040c0
+r 0x10009280
+r 0x10002b80
+w 0x10005780
+w 0x10007b00
+w 0x100038c0
+r 0x10002080
+w 0x10001880
+r 0x10002a00
+r 0x1000a0c0
+r 0x10001b40
+r 0x1000f1c0
+r 0x1017f500
+r 0x1000bd80
+r 0x1000f300
+r 0x10000d80
+r 0x1000d3c0
+r 0x100093c0
+w 0x10003a00
+r 0x10004700
+r 0x10005d40
+r 0x10009c80
+w 0x100029c0
+w 0x10002a00
+r 0x1000a100
+w 0x10005a80
+r 0x10007740
+w 0x10006540
+r 0x1000a500
+r 0x10009a80
+r 0x10004080
+r 0x1000e680
+w 0x1000d580
+w 0x10005280
+r 0x10005240
+r 0x1000c3c0
+w 0x1000ef40
+r 0x1000a2c0
+r 0x10975d00
+r 0x10009dc0
+r 0x10007740
+w 0x10004840
+r 0x1000ae40
+r 0x100084c0
+w 0x10003140
+r 0x100022c0
+r 0x10004580
+r 0x10006f80
+r 0x10004500
+r 0x1005a9c0
+r 0x1000b600
+r 0x1000bb80
+r 0x10000740
+r 0x1000d240
+r 0x1000a800
+w 0x1000c6c0
+w 0x10001700
+w 0x10002280
+r 0x100017c0
+r 0x1001f300
+r 0x107c7b80
+w 0x10002340
+w 0x10006c40
+r 0x1000e080
+w 0x10006980
+r 0x10008b80
+r 0x1000c0c0
+w 0x1000bf40
+r 0x1000b280
+w 0x10002500
+w 0x10002b00
+r 0x1000ee00
+r 0x1000ed80
+r 0x10007480
+r 0x10004d40
+r 0x10004500
+r 0x10003880
+r 0x10000940
+r 0x10001100
+r 0x100038c0
+r 0x10002300
+r 0x1000e300
+r 0x1000c640
+r 0x10000c40
+r 0x1000f3c0
+r 0x10001fc0
+r 0x1000af40
+r 0x10007bc0
+r 0x1000ba00
+r 0x10001380
+r 0x1000f840
+r 0x10004540
+r 0x1000f180
+r 0x10007180
+w 0x1000a700
+w 0x1000d9c0
+r 0x10008080
+r 0x1000fa80
+r 0x10008800
+r 0x10005a40
+r 0x1000a200
+w 0x10003dc0
+r 0x100047c0
+r 0x10004f00
+r 0x10001cc0
+w 0x10008e00
+r 0x10007bc0
+r 0x10007fc0
+r 0x10000f00
+r 0x1000d480
+r 0x10007b40
+r 0x10002280
+r 0x1000ce40
+r 0x1000f540
+w 0x10003840
+w 0x10007c80
+r 0x10003240
+r 0x1000b740
+r 0x10008900
+r 0x10007480
+r 0x10a68940
+r 0x10007b80
+r 0x100038c0
+w 0x10003280
+r 0x10002f40
+r 0x10003c00
+r 0x10005e40
+r 0x1000e700
+r 0x10000e80
+r 0x10c1dc80
+r 0x10008e80
+r 0x1000abc0
+w 0x10001a00
+r 0x1000da00
+r 0x10007140
+r 0x10007380
+r 0x10000f80
+r 0x100063c0
+r 0x10007540
+w 0x10000bc0
+r 0x10008800
+r 0x10003d40
+r 0x10009440
+r 0x10003600
+r 0x10315500
+r 0x1000c0c0
+r 0x10003e40
+r 0x10003300
+r 0x1000d800
+r 0x1000d700
+w 0x100033c0
+r 0x10000c40
+r 0x10003f80
+r 0x10002c40
+r 0x10001640
+w 0x10000500
+w 0x10f275c0
+r 0x1000d3c0
+r 0x100052c0
+r 0x1000a3c0
+r 0x10001040
+r 0x10009380
+r 0x100086c0
+r 0x1000f380
+w 0x10009640
+r 0x10005cc0
+r 0x10009200
+r 0x1000c180
+r 0x1000e1c0
+w 0x1000a080
+r 0x1000b880
+r 0x10004e40
+r 0x10006380
+r 0x10007380
+r 0x10002180
+r 0x10007ec0
+r 0x1000ef40
+r 0x1000d0c0
+r 0x1000c1c0
+r 0x10000d80
+r 0x100080c0
+r 0x103e1700
+r 0x1000efc0
+r 0x1000c840
+r 0x10003640
+r 0x10005840
+r 0x1000c440
+r 0x10004f00
+r 0x10002180
+r 0x10006e40
+r 0x1000a400
+r 0x10009a80
+w 0x10002700
+w 0x10001340
+r 0x10004600
+r 0x1000b980
+r 0x1000dd80
+r 0x10000480
+w 0x10006bc0
+r 0x10005400
+r 0x1000e100
+r 0x1000c8c0
+r 0x1000e700
+r 0x1000c5c0
+r 0x10004ec0
+r 0x100012c0
+w 0x1024fc40
+w 0x100029c0
+r 0x1000c1c0
+w 0x10004c80
+r 0x10c79700
+r 0x1000a100
+r 0x1000aa40
+w 0x10000680
+r 0x1000b840
+w 0x1000c700
+r 0x1000ebc0
+r 0x100058c0
+r 0x10532640
+w 0x10006280
+r 0x100022c0
+r 0x1000ad80
+w 0x10002e00
+w 0x10a1c6c0
+r 0x10009600
+r 0x10000e40
+r 0x10009f40
+r 0x10002600
+r 0x1000fac0
+r 0x1000f840
+r 0x1000f500
+w 0x1000a100
+r 0x105ddf00
+r 0x10003f00
+r 0x1000a000
+r 0x1000f440
+r 0x1000a640
+r 0x10000c80
+r 0x1000ba00
+r 0x1084e680
+r 0x100037c0
+w 0x1000ce40
+r 0x10e64f80
+r 0x1000c780
+r 0x10003980
+w 0x10000440
+r 0x10002740
+r 0x10001e40
+r 0x10007f40
+r 0x10005b00
+w 0x10007d40
+r 0x1000b300
+r 0x1000da00
+r 0x10006100
+r 0x1000aa80
+r 0x10001a80
+w 0x1000d500
+w 0x1000abc0
+r 0x10003440
+r 0x10000f80
+r 0x10007200
+r 0x100050c0
+r 0x1000d4c0
+w 0x10001dc0
+r 0x10004b00
+w 0x10002d40
+r 0x1000f900
+r 0x10007640
+r 0x1000c980
+r 0x10005140
+r 0x100043c0
+r 0x1000b440
+r 0x1000c140
+r 0x1000ea40
+r 0x10000540
+r 0x10003840
+r 0x1000c7c0
+r 0x105f11c0
+w 0x10009b40
+r 0x100070c0
+r 0x10004d80
+r 0x10864a40
+r 0x1000ba40
+r 0x10007c40
+r 0x10008180
+w 0x10005180
+r 0x102248c0
+r 0x1000be40
+r 0x100063c0
+r 0x1000d880
+r 0x1000bdc0
+r 0x10002880
+r 0x1000f540
+w 0x10002f00
+r 0x10003dc0
+r 0x10008840
+r 0x10006dc0
+r 0x10000b00
+r 0x10006380
+r 0x10008e00
+r 0x10009c80
+r 0x10006780
+r 0x10003e80
+r 0x10201940
+r 0x10006740
+r 0x100089c0
+r 0x10b18a40
+w 0x10009a80
+w 0x10003740
+r 0x100042c0
+r 0x106d3000
+r 0x10001500
+w 0x10002d40
+r 0x10003440
+w 0x1000d140
+r 0x10004940
+r 0x10008700
+r 0x1000df80
+r 0x10008fc0
+r 0x10008f40
+w 0x1000d300
+r 0x10005100
+r 0x1000d280
+w 0x10001100
+w 0x100018c0
+r 0x1000cbc0
+w 0x10007740
+w 0x10006b00
+w 0x1000a800
+r 0x10001180
+r 0x1000c840
+r 0x1000a940
+r 0x100027c0
+w 0x1000d800
+r 0x10002100
+r 0x10008300
+r 0x10000640
+r 0x10009180
+w 0x10007f40
+r 0x10006480
+r 0x10006780
+r 0x1000d280
+r 0x10003a40
+r 0x10002780
+w 0x1000a300
+r 0x1000fc40
+r 0x10006000
+r 0x10250a40
+r 0x1000fb40
+r 0x1000f340
+r 0x100007c0
+r 0x10001a40
+w 0x1000be40
+r 0x10003040
+r 0x1000d480
+r 0x10007440
+r 0x10002c00
+w 0x10c6e5c0
+r 0x10007700
+r 0x100024c0
+r 0x1000fc80
+r 0x1000ca40
+r 0x10005b40
+w 0x1000fb00
+r 0x10000880
+r 0x1000f6c0
+r 0x1000ae80
+r 0x10b149c0
+w 0x1020b400
+r 0x10006300
+r 0x100005c0
+r 0x1000b500
+w 0x1000fe00
+r 0x1000cc40
+w 0x100007c0
+w 0x1000ed00
+r 0x100049c0
+r 0x10000f00
+r 0x10006680
+w 0x101e2cc0
+r 0x100010c0
+r 0x10000d80
+r 0x10004d40
+w 0x1000b1c0
+r 0x1000a580
+r 0x100059c0
+r 0x1000bcc0
+r 0x100c0980
+w 0x10002040
+w 0x10007d40
+r 0x100064c0
+r 0x10004b00
+r 0x10d13840
+r 0x10001240
+r 0x10008100
+r 0x10000c80
+r 0x1000ae40
+r 0x1000f340
+w 0x1000d840
+r 0x10009100
+r 0x1000de00
+r 0x1000c940
+w 0x1000ca00
+r 0x1000de00
+r 0x1000bbc0
+r 0x1000d240
+r 0x10f88c80
+r 0x1000c5c0
+r 0x102dd5c0
+r 0x10003fc0
+r 0x100043c0
+r 0x1000e040
+w 0x1000f480
+r 0x10041780
+r 0x1000ae00
+r 0x10005d40
+r 0x1000fe40
+r 0x10003940
+r 0x1000cf80
+r 0x10008c80
+r 0x10007fc0
+r 0x1000f100
+r 0x10009900
+r 0x10000c00
+w 0x10006300
+r 0x10004540
+r 0x10001080
+r 0x10002500
+r 0x10007100
+w 0x10009080
+r 0x10004400
+w 0x10008d40
+r 0x10006280
+r 0x10001780
+r 0x102f8d80
+r 0x10004100
+r 0x100094c0
+r 0x10a87600
+w 0x10009c40
+r 0x10003b80
+r 0x100053c0
+r 0x10004080
+r 0x10003180
+r 0x10004300
+r 0x1000cc00
+r 0x1000e980
+r 0x10219900
+r 0x10008f80
+r 0x100060c0
+r 0x100024c0
+r 0x10001a40
+r 0x1000e180
+r 0x10d51dc0
+w 0x10000680
+r 0x10000840
+r 0x1000a400
+w 0x1000ca00
+r 0x1000b5c0
+r 0x1000fb40
+r 0x100f8540
+r 0x1000edc0
+r 0x10000980
+r 0x10e41dc0
+w 0x1000f040
+r 0x10001300
+r 0x10002900
+r 0x1000fdc0
+r 0x1000c2c0
+r 0x10008c00
+r 0x10002500
+r 0x10008900
+r 0x1000b300
+r 0x10003a80
+r 0x10008c80
+r 0x10002500
+r 0x100069c0
+r 0x108179c0
+w 0x1000e0c0
+r 0x10003700
+r 0x1000ee00
+w 0x1000d580
+r 0x1000a340
+r 0x100033c0
+r 0x10006c00
+r 0x100060c0
+w 0x1000bb80
+w 0x10006f00
+w 0x10007100
+r 0x1000f2c0
+r 0x1000a600
+w 0x10af8400
+r 0x1000cfc0
+r 0x1000e340
+r 0x10009000
+r 0x10005180
+r 0x10002cc0
+r 0x101dda00
+r 0x10009800
+r 0x1000fc80
+r 0x1000d7c0
+r 0x10002ac0
+r 0x10001800
+r 0x1000be80
+r 0x1000a580
+r 0x103df980
+r 0x10146a80
+r 0x10003880
+r 0x10007740
+r 0x10000e80
+r 0x100059c0
+r 0x10001d40
+r 0x1000f780
+r 0x1000a800
+r 0x10004b00
+r 0x10c78740
+r 0x10003440
+r 0x10002cc0
+w 0x10001f00
+r 0x10001c40
+r 0x10000f00
+w 0x10006640
+w 0x100070c0
+r 0x10009ac0
+r 0x1000b040
+r 0x1000e040
+r 0x1000ad80
+r 0x10002280
+r 0x10007640
+r 0x10008e80
+w 0x10007bc0
+r 0x10007d00
+r 0x100053c0
+r 0x100049c0
+r 0x1000b540
+r 0x10661e80
+r 0x10005900
+r 0x100002c0
+r 0x10009200
+r 0x1000e880
+r 0x10007b40
+r 0x10001b40
+r 0x1000ec40
+r 0x10009380
+r 0x1000d400
+r 0x10000f80
+r 0x100031c0
+r 0x10009bc0
+r 0x10001f80
+w 0x10004640
+r 0x10008480
+r 0x1000d740
+r 0x10007440
+r 0x10009540
+r 0x103182c0
+r 0x1000f0c0
+r 0x1000db40
+w 0x100022c0
+r 0x1089bf80
+r 0x10000740
+r 0x10003440
+r 0x10000980
+r 0x10009580
+r 0x1000cf80
+r 0x10003200
+r 0x10004840
+r 0x10005740
+r 0x10002800
+w 0x10006200
+r 0x10001440
+r 0x10003400
+w 0x10001e80
+r 0x10009400
+r 0x108d9dc0
+r 0x1000e100
+r 0x1000bb40
+r 0x1000c9c0
+r 0x10009300
+r 0x100045c0
+r 0x100038c0
+r 0x1000b740
+r 0x10007340
+r 0x1000a540
+r 0x1000a6c0
+r 0x1000b240
+r 0x1000d300
+r 0x10000780
+w 0x107fcfc0
+r 0x10007d80
+r 0x10007000
+r 0x10002240
+r 0x1000f2c0
+r 0x1000e380
+w 0x1000b340
+r 0x10002280
+r 0x1000f300
+r 0x10006f40
+r 0x1000b580
+r 0x10009cc0
+r 0x100013c0
+r 0x1000e600
+r 0x10009f00
+r 0x1000d0c0
+r 0x1000f4c0
+r 0x1000c500
+r 0x10004100
+w 0x1000af00
+r 0x10002b80
+r 0x100051c0
+r 0x10008040
+r 0x1000dbc0
+r 0x109df100
+w 0x1000cdc0
+r 0x10008b00
+w 0x10008280
+r 0x10006000
+r 0x10002600
+w 0x1000cf80
+r 0x1000a540
+r 0x1000dd80
+w 0x10004480
+r 0x10003c80
+r 0x10004e00
+r 0x1000f140
+r 0x10001200
+r 0x10001800
+r 0x1000cd40
+r 0x10000640
+r 0x1000a840
+r 0x1000f9c0
+r 0x10005100
+r 0x10002a00
+r 0x10003940
+r 0x1000eac0
+w 0x10009dc0
+w 0x1000ecc0
+r 0x10002740
+r 0x1000d7c0
+r 0x1005d680
+r 0x100006c0
+r 0x10004840
+r 0x10005c40
+r 0x10004e80
+r 0x10006e80
+r 0x10003d80
+r 0x100a1500
+w 0x10001840
+r 0x10003d80
+r 0x10008f80
+r 0x10000600
+w 0x1000dac0
+r 0x1000f680
+r 0x10706ac0
+r 0x1000ce40
+r 0x10001d00
+r 0x1000c140
+r 0x10005280
+r 0x10005440
+r 0x10002b80
+r 0x10005c40
+w 0x10229f80
+r 0x1000b1c0
+r 0x10000080
+r 0x10008a80
+r 0x1000d480
+w 0x10c55c00
+r 0x1051e780
+r 0x10007c80
+w 0x1000f240
+w 0x1002f440
+r 0x100076c0
+w 0x10005c00
+r 0x10006800
+r 0x10003840
+r 0x1000a900
+r 0x10004f00
+r 0x1000a7c0
+r 0x1000c740
+w 0x1000b680
+r 0x10007540
+r 0x1000a3c0
+r 0x10008d80
+r 0x10eed080
+r 0x1000f9c0
+r 0x101cf480
+r 0x100045c0
+r 0x10003d00
+r 0x1000ac80
+w 0x10379500
+r 0x1000d200
+r 0x10001c80
+w 0x10000b00
+r 0x1000aec0
+r 0x1000fc40
+r 0x10007b80
+r 0x102544c0
+r 0x10004240
+r 0x10e6cc40
+r 0x10004fc0
+r 0x10005640
+w 0x10008180
+r 0x10832cc0
+r 0x10f999c0
+r 0x10007040
+w 0x10002a40
+w 0x1056d680
+r 0x1000a240
+r 0x10002e80
+w 0x10003f80
+r 0x10005080
+r 0x10005e80
+r 0x1000d280
+r 0x10869900
+r 0x10006fc0
+r 0x10007100
+w 0x1000ebc0
+w 0x10009080
+r 0x1000cfc0
+r 0x1000d500
+w 0x10002640
+r 0x1095bd80
+w 0x10009880
+r 0x100050c0
+r 0x1000fbc0
+w 0x1076fa00
+r 0x10b32e80
+r 0x1000bb00
+r 0x10d18280
+r 0x1000f180
+r 0x10009200
+w 0x10cd3fc0
+r 0x1000ac40
+r 0x1000fc80
+r 0x10004040
+r 0x10003bc0
+r 0x1000f140
+r 0x1000d0c0
+r 0x1000a440
+r 0x10000840
+r 0x10000f80
+r 0x10009240
+w 0x10007440
+w 0x10003340
+r 0x10007a80
+r 0x10008d40
+r 0x1000eac0
+r 0x1000ee80
+r 0x10be7ac0
+r 0x10008600
+r 0x10006900
+r 0x100078c0
+r 0x10005140
+r 0x10001580
+w 0x10ba1e00
+r 0x1000d280
+r 0x1000a9c0
+r 0x1000c780
+r 0x10fa7780
+r 0x10006140
+r 0x10003fc0
+r 0x10009940
+r 0x100034c0
+r 0x1000b700
+r 0x10009d40
+r 0x1000e700
+r 0x10007180
+r 0x10cbae80
+w 0x100003c0
+w 0x10002ac0
+r 0x10004340
+r 0x1000ec00
+w 0x10000700
+r 0x1000fd40
+r 0x10008e00
+r 0x10001d80
+r 0x1000ff40
+r 0x10003e40
+r 0x100063c0
+r 0x10000ac0
+r 0x10008e40
+r 0x10008dc0
+r 0x10fdb0c0
+r 0x10000d80
+r 0x10a34e80
+w 0x10006e80
+r 0x10003740
+r 0x100020c0
+w 0x1000ab40
+r 0x10007340
+r 0x10001540
+r 0x10b664c0
+w 0x10001c80
+r 0x1000acc0
+r 0x10004080
+r 0x1000fe80
+r 0x10dfd1c0
+r 0x10001340
+w 0x10005800
+r 0x10008540
+w 0x10005300
+r 0x1000a200
+r 0x10003f80
+r 0x10001fc0
+r 0x10003000
+r 0x1000e6c0
+w 0x1000aa80
+w 0x10002e40
+r 0x10001700
+r 0x10005280
+r 0x1000e740
+r 0x10dacd00
+r 0x10005e00
+r 0x10006200
+w 0x10009b40
+w 0x10009180
+r 0x10003040
+r 0x10007d00
+w 0x10005380
+r 0x10005600
+r 0x1000d040
+r 0x1000e2c0
+r 0x100059c0
+r 0x1000fa00
+r 0x10003b80
+r 0x10006440
+r 0x10008b80
+r 0x10006180
+r 0x10397ec0
+w 0x10004940
+r 0x1000ef40
+w 0x10003240
+r 0x1000b180
+w 0x10008740
+r 0x10003b80
+r 0x1000fd80
+r 0x10bf1ec0
+r 0x10f01600
+r 0x100030c0
+r 0x10005640
+r 0x1000c080
+r 0x107249c0
+r 0x100051c0
+r 0x10d944c0
+r 0x1000b440
+r 0x10006040
+r 0x10005180
+r 0x10003b00
+r 0x10000cc0
+w 0x10004440
+r 0x10005a00
+r 0x102e9580
+r 0x10255840
+w 0x10002280
+r 0x1000bb00
+r 0x1000bc00
+r 0x10000b40
+r 0x1000e1c0
+r 0x10005500
+w 0x10000e00
+w 0x1000b300
+r 0x10009580
+r 0x10008780
+r 0x100022c0
+r 0x10009540
+r 0x10007300
+r 0x100034c0
+r 0x1000c1c0
+r 0x10007e40
+r 0x100022c0
+r 0x1000fdc0
+r 0x10004d00
+r 0x10004b80
+r 0x100073c0
+w 0x10008500
+w 0x100097c0
+r 0x1000aa80
+r 0x100016c0
+r 0x1000ed40
+r 0x1000fd40
+r 0x1000b780
+w 0x10008ec0
+w 0x10009680
+r 0x100080c0
+w 0x10002800
+r 0x1000c680
+r 0x10e71c00
+r 0x10173580
+w 0x10459c80
+w 0x10000840
+w 0x1000c000
+r 0x10006e40
+r 0x10000d40
+r 0x10003080
+r 0x10009a00
+r 0x10006780
+r 0x10009300
+w 0x101faac0
+r 0x1000f780
+w 0x10002a40
+r 0x1000ae00
+r 0x1000a280
+r 0x100009c0
+r 0x100054c0
+r 0x10006700
+r 0x10000140
+r 0x1000ab80
+r 0x10008680
+r 0x10001f00
+r 0x1000dd40
+r 0x10d49d40
+r 0x10006d80
+w 0x10003dc0
+r 0x100028c0
+r 0x10000840
+r 0x100054c0
+r 0x10001280
+r 0x10000340
+r 0x10002380
+r 0x10003a80
+r 0x10000340
+r 0x10007080
+w 0x100004c0
+r 0x100012c0
+r 0x1000fd00
+w 0x1000b2c0
+r 0x1000bec0
+w 0x1000ff80
+r 0x1000b200
+w 0x10007800
+r 0x1000db40
+r 0x1000f600
+r 0x1000a980
+w 0x10000c40
+r 0x1000aa40
+r 0x10007900
+w 0x10001c00
+w 0x10008d80
+r 0x10002240
+r 0x10009400
+r 0x10001f80
+r 0x100091c0
+r 0x10e6b040
+r 0x1000eac0
+r 0x1000bf80
+r 0x10006400
+w 0x1000e380
+w 0x10006980
+r 0x10003d00
+r 0x1000bcc0
+r 0x1000c400
+r 0x1000cf40
+r 0x1000fd00
+r 0x10009680
+r 0x10004980
+r 0x109c3740
+r 0x1000ed00
+r 0x10002000
+r 0x10176640
+w 0x1000a8c0
+r 0x1000d240
+r 0x1000c600
+r 0x10000640
+r 0x100051c0
+r 0x10006000
+r 0x100050c0
+w 0x10005a80
+r 0x10006d80
+r 0x1000dd80
+r 0x10004b40
+r 0x10000b00
+r 0x100078c0
+w 0x1000c380
+r 0x1000ba00
+w 0x10009100
+w 0x1000b480
+r 0x1000c580
+r 0x1000a1c0
+r 0x10000b00
+r 0x1000a4c0
+r 0x1000f140
+r 0x100019c0
+w 0x1000e740
+r 0x1000eec0
+r 0x10006180
+r 0x10005440
+r 0x1000ab80
+r 0x10001940
+r 0x10d9e100
+w 0x10006b00
+w 0x103e3cc0
+r 0x100045c0
+w 0x10009080
+r 0x1000e500
+r 0x10009640
+r 0x10003fc0
+r 0x10009500
+r 0x1000b240
+r 0x100037c0
+r 0x10ac7e80
+r 0x103b90c0
+w 0x10ea3bc0
+r 0x103cefc0
+r 0x10003500
+r 0x10006ec0
+r 0x1000dec0
+w 0x10009600
+r 0x1000b7c0
+r 0x10006780
+r 0x10001b00
+r 0x1000e200
+r 0x1000d440
+r 0x1000f6c0
+r 0x1021e180
+r 0x10009400
+r 0x10005980
+r 0x10005500
+r 0x100042c0
+r 0x1000de40
+r 0x1000b000
+r 0x10000940
+r 0x10005d40
+r 0x100026c0
+r 0x10005ec0
+r 0x100086c0
+w 0x100015c0
+r 0x100008c0
+w 0x100027c0
+r 0x10006e80
+r 0x10f60380
+r 0x1000e3c0
+w 0x1000bac0
+r 0x104ecd80
+w 0x1000e0c0
+r 0x10007c40
+r 0x1000bd00
+r 0x1000dfc0
+r 0x10000c80
+r 0x1000c4c0
+r 0x1000e680
+r 0x10006480
+r 0x10001580
+r 0x1000a840
+w 0x100072c0
+w 0x10009b00
+w 0x10004500
+r 0x1000f2c0
+r 0x1000d580
+r 0x100067c0
+r 0x10006ec0
+r 0x10c13580
+r 0x1000f4c0
+r 0x1000cd40
+w 0x10007540
+r 0x1000bd00
+r 0x1000f780
+w 0x10000e00
+r 0x1000a0c0
+r 0x1000e0c0
+r 0x100086c0
+r 0x10009640
+w 0x1000a400
+r 0x10c11d40
+r 0x10000940
+r 0x1000efc0
+r 0x10001e40
+r 0x1000bc00
+r 0x1000c640
+r 0x103fa680
+w 0x1000dd40
+r 0x1000f900
+r 0x10008800
+r 0x10006ec0
+w 0x1000ab00
+r 0x10001e00
+r 0x10003ac0
+r 0x10005ac0
+r 0x1000e780
+w 0x10003240
+w 0x10002440
+r 0x10006040
+r 0x1000d480
+r 0x10000e80
+r 0x10006e40
+r 0x10f86000
+r 0x10000780
+r 0x1000f8c0
+r 0x10003700
+w 0x1000d340
+w 0x10004a40
+r 0x10000f80
+r 0x10008800
+r 0x10c1de40
+r 0x10005540
+r 0x10008fc0
+r 0x1000bd40
+r 0x100043c0
+r 0x10002240
+r 0x104fa380
+r 0x10005fc0
+w 0x1000ab80
+r 0x10002600
+r 0x10acc9c0
+r 0x10009200
+r 0x1000e2c0
+r 0x10007940
+r 0x10002b40
+r 0x1000a900
+r 0x10002600
+r 0x100038c0
+r 0x1000d380
+r 0x10007980
+r 0x105d7540
+w 0x100017c0
+r 0x10e34500
+w 0x10009a40
+w 0x10004940
+r 0x1000cb00
+r 0x1000b7c0
+w 0x1000c580
+r 0x1000c940
+r 0x10b85a40
+w 0x1000e100
+r 0x10005f40
+r 0x10004540
+r 0x1000c6c0
+r 0x1000d040
+r 0x1000d700
+w 0x1000fcc0
+r 0x1000f940
+r 0x1000b6c0
+r 0x1000adc0
+w 0x1000fb00
+w 0x10001cc0
+r 0x1000fa40
+w 0x10006b40
+r 0x1000c7c0
+r 0x1000cfc0
+r 0x10003c40
+r 0x10008f80
+w 0x1000e640
+r 0x10000e00
+r 0x1000cc00
+r 0x1000a680
+r 0x10006c40
+r 0x1000dcc0
+w 0x10248ec0
+r 0x10008380
+r 0x10002480
+r 0x10009dc0
+r 0x10000280
+r 0x10005280
+r 0x1000c740
+r 0x10001dc0
+w 0x10007740
+r 0x1000d400
+r 0x10006200
+r 0x1000a940
+r 0x10002600
+r 0x1000db40
+r 0x10006040
+r 0x1000da40
+r 0x10001680
+r 0x1000cec0
+r 0x100027c0
+w 0x100010c0
+r 0x100080c0
+r 0x1000d500
+r 0x1000ff00
+w 0x1000f2c0
+w 0x107cbfc0
+r 0x1000d2c0
+r 0x1000e940
+r 0x10009c40
+r 0x10006600
+r 0x100080c0
+r 0x10004000
+r 0x1000e380
+r 0x1000ba40
+w 0x10003a00
+r 0x1000ab80
+r 0x10006900
+r 0x1000f780
+r 0x10009700
+r 0x10df3240
+r 0x1000b040
+r 0x100037c0
+r 0x10005b80
+r 0x10003080
+r 0x10002740
+r 0x10004040
+r 0x1000aa40
+r 0x10008700
+w 0x10000700
+r 0x10880880
+w 0x100081c0
+r 0x1000e0c0
+r 0x10001a80
+w 0x10007780
+r 0x10000680
+w 0x10001380
+r 0x1000b940
+w 0x10004cc0
+r 0x10007500
+r 0x1000b4c0
+w 0x100037c0
+r 0x10009ac0
+w 0x1074d800
+r 0x10000ec0
+w 0x1000cd80
+r 0x100028c0
+r 0x10009480
+r 0x10008b00
+r 0x10490400
+r 0x1000aec0
+r 0x1000b0c0
+r 0x101d1cc0
+r 0x10008980
+w 0x1000c040
+r 0x10000bc0
+r 0x1000e140
+w 0x10000040
+w 0x1000e240
+r 0x1000ef80
+r 0x100022c0
+r 0x10004e00
+w 0x1000b880
+r 0x10005240
+r 0x10005a40
+w 0x10001240
+r 0x1000b640
+r 0x10b90ec0
+r 0x10911400
+r 0x100094c0
+r 0x10003440
+r 0x100015c0
+r 0x10009700
+w 0x100047c0
+r 0x10008880
+r 0x10002680
+r 0x100094c0
+r 0x10003380
+r 0x10005840
+r 0x1000bd80
+r 0x10f9ddc0
+r 0x100082c0
+r 0x10008280
+r 0x10003640
+r 0x1000db00
+r 0x10559600
+w 0x108fa680
+r 0x1000a600
+r 0x10000440
+r 0x10000b00
+r 0x10004580
+r 0x10001640
+r 0x1000ec00
+r 0x10009340
+r 0x100028c0
+r 0x100050c0
+r 0x1000b540
+r 0x10000440
+r 0x10008a40
+r 0x1000b700
+r 0x1000b7c0
+r 0x1000f280
+r 0x10bd20c0
+r 0x10008ec0
+w 0x10002580
+r 0x10007c00
+r 0x1000a240
+r 0x10000740
+r 0x10001780
+r 0x10006600
+r 0x100035c0
+r 0x1000e5c0
+r 0x1000de40
+r 0x1000bc80
+r 0x10003680
+r 0x1000e0c0
+w 0x10008cc0
+r 0x10004dc0
+r 0x10006140
+r 0x1000ff00
+r 0x103defc0
+r 0x10002f00
+r 0x10000ec0
+r 0x10002a00
+w 0x1000e400
+w 0x100013c0
+r 0x10004500
+r 0x100029c0
+r 0x1000c200
+w 0x1000e6c0
+r 0x10009bc0
+w 0x100078c0
+r 0x1000a0c0
+r 0x1000e380
+r 0x10003ec0
+r 0x10008d40
+r 0x10002680
+r 0x10005740
+r 0x1000dec0
+r 0x10001440
+r 0x101b4500
+r 0x1000b980
+w 0x10003cc0
+r 0x100000c0
+r 0x10000140
+r 0x1000bd80
+w 0x10008680
+r 0x1000a600
+r 0x10238380
+r 0x1000bac0
+r 0x1000ab80
+r 0x10007000
+r 0x10003200
+r 0x1000bfc0
+r 0x10004240
+r 0x1000b2c0
+r 0x1099c480
+r 0x1000c740
+r 0x10000000
+r 0x10004700
+r 0x10007b80
+r 0x10007500
+r 0x10003080
+r 0x1000eb00
+r 0x1000efc0
+r 0x1000f500
+r 0x1000ec00
+r 0x10002ec0
+r 0x100005c0
+r 0x104d3100
+r 0x1000a680
+r 0x1000d340
+r 0x1000da40
+w 0x100027c0
+r 0x10005dc0
+w 0x1079c3c0
+w 0x10007d00
+r 0x100039c0
+r 0x10005ac0
+r 0x10305640
+r 0x10000d40
+r 0x1000e000
+r 0x1000acc0
+r 0x1000a880
+r 0x10004ec0
+w 0x1000f6c0
+w 0x10007600
+r 0x102efc80
+w 0x10009280
+r 0x10009100
+r 0x107da080
+r 0x1000d700
+r 0x10007dc0
+r 0x10006f40
+r 0x10000140
+r 0x1000cc00
+r 0x10007f80
+w 0x10005900
+w 0x1000f180
+w 0x10008440
+r 0x10003680
+r 0x10005640
+r 0x10009740
+r 0x10009e00
+r 0x10006bc0
+r 0x100017c0
+r 0x10005c00
+r 0x10ce82c0
+r 0x10001340
+r 0x1041fd00
+r 0x1000d300
+r 0x10006c80
+r 0x1000d5c0
+r 0x1000a440
+r 0x1000e3c0
+r 0x10007800
+r 0x10008cc0
+r 0x10002880
+r 0x10009880
+w 0x1000d0c0
+r 0x10001980
+r 0x100056c0
+r 0x10006d00
+r 0x10001540
+r 0x100005c0
+r 0x1055ff00
+r 0x1000bc00
+r 0x10009e00
+r 0x100036c0
+r 0x10008900
+r 0x10006380
+r 0x10659e80
+w 0x10007300
+w 0x1000af80
+r 0x10003dc0
+w 0x10000e40
+r 0x1000ec80
+w 0x10007240
+r 0x10005f40
+r 0x1000fcc0
+r 0x100049c0
+r 0x10008dc0
+r 0x1000ce00
+r 0x1000ec80
+r 0x100036c0
+w 0x10005d40
+r 0x1000a980
+w 0x10003940
+w 0x10002d40
+r 0x10007a40
+w 0x10009980
+w 0x1000f300
+r 0x100056c0
+w 0x1000a740
+r 0x10004c00
+r 0x10002e40
+w 0x1000ca00
+r 0x1000cc40
+r 0x1000cb80
+r 0x10004740
+r 0x10008280
+r 0x100045c0
+r 0x100081c0
+w 0x1000cc40
+r 0x10005c00
+r 0x10691d00
+r 0x10002d40
+r 0x10d87800
+r 0x10000fc0
+r 0x10006780
+r 0x10003900
+r 0x1000a940
+w 0x1000d680
+w 0x10000240
+w 0x10dcd500
+w 0x10006340
+r 0x10f02ec0
+w 0x1000c080
+r 0x1000fec0
+r 0x10000040
+w 0x1000ab80
+r 0x10000840
+r 0x1000ad40
+r 0x10007dc0
+r 0x1000b740
+r 0x10002340
+r 0x1000a5c0
+r 0x1000ed40
+r 0x10674780
+w 0x10006c00
+r 0x1000b480
+r 0x10002f80
+w 0x10002480
+r 0x1000c8c0
+r 0x1000adc0
+w 0x105ed980
+r 0x10000e80
+r 0x1000f0c0
+w 0x10001b80
+w 0x10ee4180
+r 0x1000e380
+r 0x1000d5c0
+r 0x10008640
+w 0x1000b280
+r 0x10004ac0
+r 0x10004ac0
+r 0x10001b40
+r 0x1000ab40
+r 0x10547ac0
+r 0x109bbe00
+r 0x10004e40
+r 0x1000d680
+r 0x10007440
+r 0x100063c0
+w 0x10003c80
+r 0x1000be00
+r 0x1000f740
+r 0x1000a780
+w 0x1000a840
+w 0x1000ecc0
+r 0x10003240
+r 0x1000e780
+r 0x1000ce80
+r 0x10007380
+r 0x10175400
+r 0x1000ea00
+r 0x1000d380
+r 0x10004600
+r 0x1000c140
+w 0x10009d80
+r 0x10001440
+r 0x10002140
+r 0x10e44200
+r 0x1000d9c0
+r 0x10009a80
+r 0x10007e80
+r 0x1000c440
+r 0x100052c0
+r 0x10003240
+r 0x1000b400
+r 0x10001100
+r 0x10002880
+r 0x1000a8c0
+r 0x10001fc0
+r 0x10004ac0
+w 0x1000c4c0
+r 0x10007300
+w 0x10005f00
+w 0x10005880
+r 0x1000e040
+r 0x1000ff40
+r 0x10002c80
+w 0x100090c0
+r 0x100049c0
+w 0x10009bc0
+r 0x10005980
+r 0x1000fc40
+r 0x10007440
+r 0x100093c0
+r 0x100034c0
+r 0x1000fa80
+w 0x100038c0
+w 0x10005a40
+r 0x1000f6c0
+r 0x10004b80
+r 0x10002700
+r 0x10004300
+r 0x1000d740
+r 0x100030c0
+w 0x10004000
+r 0x10006f00
+r 0x1000e9c0
+r 0x10008040
+r 0x10337940
+r 0x1000c180
+w 0x1000b440
+w 0x1000bb00
+r 0x10252d40
+w 0x1000ff00
+r 0x104b24c0
+r 0x10005200
+r 0x1000b9c0
+r 0x10002d40
+r 0x10001640
+r 0x1000ec40
+r 0x1000a6c0
+r 0x100039c0
+r 0x10000480
+w 0x10001a40
+r 0x10b7e800
+r 0x1000ecc0
+r 0x1000a7c0
+r 0x10007240
+r 0x1000b480
+r 0x100076c0
+w 0x1000f7c0
+w 0x1000bd80
+r 0x10008740
+w 0x1000dd00
+r 0x10008f40
+r 0x100093c0
+r 0x10006840
+r 0x10000280
+r 0x10001a00
+r 0x10004440
+r 0x10003c00
+w 0x1000f080
+r 0x10008f80
+r 0x100053c0
+r 0x10006e00
+r 0x1000dc40
+r 0x10009e00
+r 0x1000ec00
+r 0x1000a2c0
+r 0x10009180
+w 0x107835c0
+r 0x10749280
+r 0x1000dc80
+r 0x1000f880
+w 0x10006f40
+r 0x10006040
+r 0x100067c0
+r 0x10006f40
+r 0x10cb5280
+r 0x10009240
+r 0x1000b400
+r 0x10007680
+r 0x1000f6c0
+r 0x1000e0c0
+r 0x10009380
+r 0x10003f00
+w 0x1000c080
+r 0x10009cc0
+r 0x10005080
+r 0x10000a80
+r 0x1000be80
+r 0x10004480
+r 0x1000e800
+w 0x10006100
+r 0x10a34c80
+w 0x10007540
+r 0x10006900
+r 0x1000fb80
+r 0x10007900
+r 0x10006480
+r 0x103d20c0
+r 0x10002c40
+r 0x1000ae80
+w 0x10008f00
+w 0x1000f1c0
+r 0x1000d4c0
+w 0x10008840
+r 0x1000a200
+r 0x10003980
+r 0x10006100
+r 0x1000cc40
+r 0x10007c00
+r 0x1000dd00
+r 0x10001540
+r 0x1000a700
+r 0x10008080
+r 0x1000f940
+r 0x10002340
+r 0x1000dcc0
+w 0x1000ce80
+r 0x1000cf40
+r 0x1000c680
+w 0x10005c00
+r 0x10003200
+r 0x100012c0
+r 0x1000f240
+w 0x1000ca80
+r 0x10000280
+r 0x100024c0
+r 0x1000f780
+r 0x10002a80
+w 0x1000e400
+r 0x100009c0
+r 0x1000a7c0
+r 0x1000d440
+r 0x10000e00
+w 0x10004b80
+r 0x1000cf40
+r 0x10007840
+w 0x10adfa00
+r 0x1000f780
+r 0x1000ea00
+r 0x1000cbc0
+r 0x1000d980
+w 0x1000cec0
+r 0x109d42c0
+r 0x1000d940
+r 0x10009c40
+r 0x1000d4c0
+w 0x1000d700
+w 0x10006e00
+r 0x10007000
+w 0x10003440
+r 0x10009880
+r 0x10005580
+r 0x1000a3c0
+w 0x10000fc0
+r 0x1000b780
+r 0x10005000
+r 0x10002500
+w 0x100042c0
+r 0x10008b00
+r 0x10004480
+r 0x10001e80
+r 0x10009180
+r 0x100064c0
+r 0x100014c0
+w 0x10007200
+r 0x107c63c0
+r 0x10009500
+r 0x1000f400
+w 0x10002100
+r 0x1000c740
+r 0x1000a780
+r 0x10d91380
+r 0x10006780
+r 0x10c25640
+r 0x10003800
+r 0x1000e840
+w 0x1000b980
+r 0x10000e00
+r 0x1000fdc0
+r 0x10007740
+r 0x1000d740
+w 0x1000f840
+r 0x100032c0
+r 0x10007fc0
+r 0x10006200
+w 0x1000d280
+w 0x10000a40
+r 0x10005a40
+r 0x10000c40
+r 0x1000a3c0
+w 0x10001800
+w 0x10004d00
+r 0x104f8200
+r 0x10fe5100
+r 0x1000b680
+r 0x10006d40
+r 0x10009b80
+r 0x10004380
+r 0x1000c680
+r 0x10008bc0
+r 0x1000d2c0
+r 0x10004a80
+r 0x10008700
+w 0x10004580
+w 0x10000d40
+w 0x100037c0
+r 0x1000c180
+r 0x1000e6c0
+r 0x10006340
+r 0x1000ef40
+w 0x10b39d00
+r 0x10505f00
+w 0x10e04e00
+r 0x109c0f40
+w 0x1000fa80
+r 0x1000a1c0
+w 0x10048680
+r 0x1000fb80
+w 0x10006300
+w 0x100064c0
+r 0x100040c0
+r 0x10000d40
+r 0x1000e840
+r 0x10007500
+r 0x1000e640
+r 0x100075c0
+r 0x10007500
+r 0x1000ffc0
+r 0x1000ca00
+r 0x1000a480
+w 0x10e06cc0
+r 0x10007400
+w 0x109baf00
+r 0x10006d40
+r 0x10002140
+r 0x100001c0
+r 0x1000b8c0
+r 0x1000e840
+r 0x10005940
+r 0x10003600
+r 0x10003740
+r 0x10005300
+r 0x10000dc0
+r 0x1000e000
+r 0x10000000
+r 0x100052c0
+r 0x10a6e9c0
+w 0x1000f980
+w 0x1000b940
+r 0x1000f540
+r 0x1000f6c0
+w 0x1000fa40
+r 0x10007940
+w 0x10004480
+r 0x1000ed80
+r 0x1000f840
+r 0x1000cd00
+w 0x100061c0
+r 0x10000580
+w 0x10008240
+w 0x10004040
+r 0x10001240
+r 0x1000fc00
+r 0x100080c0
+w 0x1000d340
+r 0x10004400
+w 0x1000c9c0
+w 0x1000c400
+r 0x100018c0
+r 0x1000eb40
+r 0x10006f80
+r 0x1000a840
+r 0x10008f00
+r 0x10004040
+r 0x100023c0
+r 0x10006d00
+r 0x1000b580
+r 0x10009880
+r 0x10004200
+r 0x10001300
+r 0x107ca180
+r 0x1000f380
+r 0x100085c0
+w 0x10005f80
+r 0x10007780
+r 0x101df540
+w 0x10008f80
+r 0x10791a00
+r 0x1000fb00
+r 0x10003100
+r 0x1000ce80
+r 0x10006980
+r 0x10006780
+r 0x100024c0
+w 0x10301680
+r 0x10004100
+r 0x10006c80
+r 0x10003d00
+r 0x10194dc0
+r 0x10004b40
+w 0x1000c040
+r 0x10001840
+r 0x10007d00
+r 0x1000b600
+r 0x10009a80
+r 0x10003680
+r 0x10009440
+r 0x1000d2c0
+r 0x10005880
+r 0x10005fc0
+r 0x10009ac0
+w 0x100083c0
+w 0x10004240
+r 0x10006400
+r 0x10000840
+r 0x1000c180
+r 0x10004e40
+r 0x10001dc0
+r 0x1000d580
+r 0x1000e400
+r 0x1000f400
+r 0x1000c940
+r 0x10006d80
+r 0x1000f040
+r 0x10008100
+r 0x1000d3c0
+r 0x10002540
+w 0x1000d640
+w 0x10005f00
+r 0x10008980
+r 0x1000b340
+r 0x10009000
+w 0x1000c680
+r 0x10001640
+w 0x1000a2c0
+w 0x10001680
+r 0x1000f380
+r 0x10006900
+w 0x10009140
+r 0x10005680
+r 0x1000d100
+w 0x10009e40
+r 0x10001b00
+w 0x10007c40
+r 0x10000340
+r 0x10005ec0
+w 0x10006a00
+r 0x10c57440
+r 0x1000a6c0
+r 0x1000cf40
+w 0x10004cc0
+r 0x100034c0
+r 0x10005900
+r 0x10004600
+r 0x10005ec0
+r 0x100077c0
+r 0x1000e980
+r 0x1000d180
+r 0x10000980
+r 0x100017c0
+r 0x10004640
+w 0x1000bb00
+r 0x1000ec40
+w 0x1000ef40
+r 0x10000180
+w 0x10002ac0
+w 0x1000aec0
+r 0x10825100
+r 0x1000c6c0
+r 0x10002fc0
+r 0x100034c0
+r 0x10006800
+r 0x1000f580
+r 0x1000e140
+w 0x1000f0c0
+r 0x1000de00
+r 0x1066e340
+r 0x10003380
+w 0x10f9c580
+r 0x10001f80
+r 0x100072c0
+r 0x100069c0
+r 0x1000ef40
+r 0x10003680
+r 0x10000540
+w 0x10006780
+r 0x1000d980
+r 0x10007200
+r 0x10000a00
+r 0x1000d300
+r 0x10001780
+r 0x10001d80
+r 0x10000a40
+r 0x10001d80
+r 0x10001640
+w 0x10a22080
+r 0x10005680
+r 0x1000b840
+r 0x10006dc0
+r 0x100071c0
+r 0x1000b280
+r 0x100040c0
+r 0x10b14a80
+r 0x108b2d80
+w 0x1000d080
+w 0x1000ec00
+r 0x10000e00
+r 0x1000b840
+r 0x1000a200
+r 0x10002880
+r 0x10001240
+r 0x10006d00
+r 0x10009140
+r 0x10006dc0
+w 0x10db8500
+r 0x10001cc0
+r 0x10003780
+r 0x10005e00
+r 0x10009940
+r 0x1000c480
+r 0x1000ec80
+r 0x10009200
+r 0x10004040
+r 0x10e101c0
+r 0x100099c0
+r 0x10000c80
+r 0x10006bc0
+r 0x10003800
+r 0x10005f80
+r 0x10004a80
+r 0x1000a540
+w 0x10006d40
+r 0x10009380
+r 0x10001c00
+w 0x1000d1c0
+w 0x1000d340
+r 0x1000d780
+r 0x1000d800
+r 0x100055c0
+r 0x10004900
+r 0x1000bf80
+r 0x10606a40
+r 0x10008ac0
+r 0x10006480
+r 0x10005900
+r 0x1000ac40
+w 0x10003e40
+r 0x1000fc00
+r 0x10000f40
+r 0x10006940
+r 0x10003500
+r 0x10001040
+r 0x10002640
+r 0x1000b900
+r 0x10003a80
+r 0x10008c00
+w 0x10006700
+w 0x1000d380
+r 0x1000f4c0
+w 0x1000ad40
+r 0x10000bc0
+w 0x1000e180
+w 0x1000ad00
+w 0x10004000
+r 0x10003640
+r 0x102961c0
+r 0x10002740
+w 0x10005840
+r 0x1000f340
+r 0x1000cec0
+r 0x1000c380
+r 0x10007080
+w 0x1000d640
+r 0x1000e880
+r 0x10006500
+r 0x1000d100
+w 0x1000dc80
+r 0x100002c0
+r 0x1000aac0
+r 0x1000a480
+r 0x1000eac0
+r 0x10003000
+r 0x10002cc0
+r 0x10001440
+r 0x1000a800
+w 0x10000940
+r 0x1000a5c0
+r 0x1000d340
+r 0x10001080
+r 0x1000fc00
+w 0x1000b440
+r 0x1000ce40
+r 0x10002000
+r 0x100c8a40
+r 0x1000be80
+r 0x1000ed80
+r 0x1000e200
+r 0x1000fb40
+r 0x1021cf80
+r 0x10001cc0
+w 0x10006500
+r 0x10000780
+r 0x10003340
+r 0x1000fbc0
+r 0x10008780
+r 0x10002d80
+r 0x1000f980
+r 0x10004900
+r 0x10009480
+w 0x10006000
+w 0x1000efc0
+w 0x100089c0
+r 0x10de9580
+r 0x1000a200
+r 0x10006c00
+r 0x10004b00
+r 0x10002e40
+r 0x100020c0
+w 0x100017c0
+w 0x10006880
+r 0x1000b440
+w 0x1000e3c0
+w 0x1079e680
+w 0x10398800
+w 0x1000ad00
+w 0x1000df80
+r 0x1000d140
+r 0x10035340
+r 0x10000140
+w 0x1000d1c0
+r 0x105a7340
+w 0x1000ed80
+w 0x10002900
+r 0x10005e80
+r 0x10004d00
+r 0x1000e780
+r 0x1000d8c0
+r 0x10002b80
+r 0x100073c0
+r 0x10008940
+r 0x10003880
+r 0x1082a240
+w 0x1000dd80
+r 0x10f67980
+r 0x100064c0
+w 0x1000b380
+r 0x1000cc40
+r 0x10004380
+r 0x10003800
+r 0x1000b3c0
+r 0x1000f4c0
+r 0x1000f600
+r 0x1000f380
+r 0x10006740
+r 0x10000280
+r 0x10000940
+r 0x100041c0
+r 0x10004bc0
+r 0x10008080
+r 0x10002040
+r 0x100035c0
+r 0x1000dd40
+r 0x10004400
+r 0x1000d1c0
+r 0x1000bb80
+r 0x10009a00
+r 0x10008d40
+r 0x1000ec40
+w 0x1000ca80
+r 0x1000a040
+r 0x1000c780
+r 0x10000e00
+r 0x10006f40
+r 0x10002a80
+r 0x1000c180
+r 0x1000e940
+r 0x1000aa00
+r 0x10005c00
+r 0x10003e80
+r 0x1000bd80
+r 0x10008440
+r 0x10002ec0
+r 0x10008c80
+w 0x10007f00
+w 0x10000e80
+r 0x10002900
+r 0x10004500
+r 0x1000d8c0
+r 0x10003e80
+w 0x1000b780
+r 0x1000dcc0
+r 0x1000d6c0
+r 0x1000a8c0
+r 0x10002280
+r 0x1000b840
+r 0x1000ea40
+r 0x1000dbc0
+r 0x100024c0
+r 0x10000cc0
+r 0x100045c0
+r 0x10008fc0
+r 0x10005500
+r 0x1000a280
+r 0x10006980
+r 0x10006480
+r 0x1000f3c0
+r 0x10009ec0
+r 0x10001040
+r 0x1000a300
+w 0x10000540
+r 0x1000f0c0
+r 0x10009c40
+r 0x1000a900
+w 0x1000d640
+r 0x10008d00
+r 0x10000200
+r 0x10e9e380
+r 0x100072c0
+r 0x106897c0
+r 0x1000f140
+r 0x10001c80
+r 0x10009480
+w 0x10008bc0
+w 0x10004fc0
+w 0x10000840
+r 0x10005e80
+r 0x1000c380
+r 0x10000640
+r 0x10001500
+r 0x10f8fb80
+r 0x1000c300
+r 0x10003800
+w 0x10007080
+r 0x10008140
+w 0x100057c0
+r 0x10000cc0
+r 0x10009680
+r 0x10006800
+r 0x10002880
+r 0x1000ca80
+w 0x100068c0
+r 0x1000e940
+r 0x1000a440
+r 0x10004b80
+r 0x10005ac0
+r 0x1000fec0
+w 0x10009140
+r 0x10009cc0
+r 0x100094c0
+r 0x10005c80
+r 0x10004900
+r 0x10712e40
+r 0x1000a240
+r 0x1000f300
+r 0x1000ef80
+r 0x100016c0
+r 0x10005080
+r 0x1000a280
+r 0x1000efc0
+r 0x1000ba00
+r 0x1000f180
+r 0x10009600
+r 0x10008e40
+r 0x1000fb80
+r 0x10000a00
+r 0x100061c0
+w 0x10006180
+r 0x10004e80
+r 0x10006240
+r 0x10007480
+r 0x106e9000
+r 0x1000e840
+w 0x10002180
+r 0x10003800
+w 0x1000bb80
+r 0x107e5b80
+w 0x10007ec0
+r 0x1000e700
+r 0x10005500
+r 0x10ab6600
+r 0x10006480
+r 0x1000f300
+r 0x10006bc0
+r 0x10005e00
+r 0x1000d5c0
+r 0x10000ec0
+w 0x1000dc00
+r 0x10002280
+w 0x10008100
+r 0x1000fd00
+r 0x1000db80
+w 0x10005740
+w 0x10007cc0
+r 0x10001780
+r 0x1000a3c0
+r 0x10656080
+r 0x1000eec0
+r 0x1000df80
+r 0x1000b0c0
+r 0x1000be00
+r 0x10009dc0
+r 0x10004500
+r 0x10002d80
+r 0x10008580
+r 0x100014c0
+r 0x1000bb80
+r 0x10004f00
+r 0x10005d40
+w 0x1000aa40
+r 0x10002a00
+r 0x1000c680
+w 0x1000b6c0
+r 0x10008200
+w 0x1000c100
+w 0x1000cfc0
+r 0x10001300
+r 0x10004cc0
+r 0x10008680
+r 0x10008ec0
+r 0x1059b600
+r 0x1000b780
+r 0x1000bec0
+r 0x10006cc0
+r 0x1000e800
+r 0x10002000
+r 0x10003780
+r 0x1000c440
+r 0x10006440
+w 0x10002d80
+w 0x10001000
+r 0x10005740
+r 0x100035c0
+r 0x10008180
+r 0x1000bd00
+r 0x10005640
+r 0x10008880
+r 0x1000df40
+w 0x1000d780
+r 0x10f92700
+w 0x10004b80
+r 0x10008080
+r 0x1000f300
+w 0x10004800
+r 0x1000c6c0
+r 0x10006580
+r 0x1000cf80
+r 0x10008fc0
+r 0x1000d880
+r 0x10004540
+r 0x1000f640
+r 0x10009b40
+w 0x10002d40
+r 0x10003580
+r 0x100089c0
+w 0x10008140
+w 0x10002a00
+r 0x1000ae40
+w 0x100062c0
+w 0x1000c640
+r 0x10005f80
+r 0x10001200
+r 0x10008980
+w 0x1000f540
+w 0x10001440
+r 0x1000e740
+r 0x1000f000
+r 0x10009500
+r 0x10bd8d40
+r 0x10a3d000
+r 0x10000dc0
+r 0x1000df00
+r 0x10003b80
+r 0x1000ca80
+r 0x10008d40
+r 0x100051c0
+r 0x10001ec0
+w 0x1000b100
+r 0x100034c0
+r 0x100049c0
+w 0x1000bb40
+r 0x1000afc0
+r 0x10007f00
+w 0x10000e80
+r 0x10ed4f40
+r 0x10008740
+r 0x10005f00
+r 0x10168540
+w 0x10003680
+r 0x10000640
+r 0x10009740
+r 0x10004780
+r 0x10000640
+r 0x1000a5c0
+w 0x10002b00
+w 0x1000fd00
+r 0x1000ad00
+r 0x10002700
+r 0x100026c0
+r 0x10003900
+r 0x1000e6c0
+w 0x10008080
+r 0x10003e40
+r 0x10009c80
+r 0x1000bcc0
+w 0x1000f300
+w 0x1000ed00
+r 0x10004680
+r 0x1000fc40
+r 0x1000df00
+w 0x1000b900
+r 0x1000d900
+r 0x1000d300
+r 0x10005880
+w 0x100060c0
+r 0x1000a500
+r 0x10d26d00
+r 0x10af8c80
+r 0x1000e680
+r 0x1000fd80
+r 0x10008dc0
+r 0x10004800
+r 0x10008cc0
+r 0x10001100
+w 0x10006800
+r 0x10005600
+r 0x10005dc0
+w 0x10004a80
+r 0x10004e00
+r 0x10008a80
+r 0x10005480
+w 0x10009e40
+r 0x1000ea80
+r 0x10008900
+r 0x1000be00
+r 0x10007700
+r 0x10003700
+r 0x10005f80
+r 0x10001d80
+r 0x1000a780
+r 0x1000aa00
+w 0x1000ef40
+r 0x10007f80
+r 0x1000f6c0
+r 0x10008c80
+r 0x10007f00
+r 0x10007bc0
+r 0x10009880
+r 0x1000b480
+r 0x100085c0
+r 0x10001940
+w 0x100031c0
+w 0x10008780
+r 0x1000dfc0
+w 0x1000c580
+r 0x10004fc0
+r 0x10008340
+r 0x1000e500
+r 0x10c19a80
+r 0x1000d080
+r 0x1000e200
+r 0x10000b00
+r 0x10005080
+w 0x10458100
+r 0x102a1680
+r 0x100096c0
+r 0x1000ac40
+r 0x10003700
+w 0x10000c40
+r 0x1068e940
+r 0x10001540
+w 0x10003740
+r 0x1000ed00
+r 0x10003fc0
+r 0x100044c0
+r 0x1015ac80
+r 0x10001c80
+r 0x1000eac0
+r 0x10003440
+r 0x10004fc0
+r 0x10000bc0
+r 0x10005c80
+w 0x10009340
+r 0x1000df80
+r 0x1000bc80
+r 0x1000bdc0
+w 0x10fbb880
+r 0x10004440
+r 0x1000f480
+r 0x100093c0
+w 0x10917ec0
+r 0x10002340
+r 0x10007700
+r 0x10008e00
+r 0x10005080
+r 0x101c9c40
+r 0x100010c0
+r 0x10007d80
+r 0x10a98ac0
+w 0x1000c680
+r 0x10009800
+r 0x1000e840
+r 0x10005cc0
+w 0x10003f80
+w 0x10001e00
+r 0x10fef4c0
+r 0x1000c580
+r 0x104ec600
+r 0x10006080
+r 0x1000ff40
+r 0x1000de40
+r 0x10009780
+r 0x100025c0
+r 0x10004300
+r 0x1000fbc0
+r 0x1000bf00
+r 0x10009e80
+r 0x10005d00
+r 0x10008780
+r 0x10002900
+w 0x10009f00
+w 0x1000c040
+r 0x1000cf80
+w 0x1000c640
+r 0x1000e380
+r 0x1034f880
+r 0x10007ec0
+r 0x1000ca00
+r 0x10004640
+r 0x10007f80
+r 0x10007fc0
+r 0x10005140
+r 0x10009680
+r 0x1054f0c0
+r 0x100093c0
+r 0x10001cc0
+w 0x1000adc0
+r 0x1000f040
+w 0x10002640
+r 0x10008580
+w 0x1000b300
+r 0x1000dd80
+r 0x10009040
+r 0x10006100
+r 0x1000e2c0
+r 0x1000da00
+r 0x10009a80
+w 0x10007480
+w 0x10004080
+r 0x10007d00
+r 0x10242ec0
+r 0x10008d00
+r 0x1000fd40
+r 0x1000fa40
+r 0x10000540
+r 0x100017c0
+r 0x10002440
+w 0x10009e00
+r 0x10451580
+r 0x1000b300
+r 0x1000c380
+r 0x1000ee40
+r 0x10008480
+r 0x1000a880
+w 0x100029c0
+r 0x107e36c0
+r 0x10006a40
+r 0x1000ecc0
+r 0x10000380
+w 0x10005440
+r 0x10005d00
+r 0x10001580
+r 0x10001240
+r 0x10001800
+r 0x1000af40
+r 0x10003840
+r 0x10007a80
+w 0x10bd9f00
+r 0x100058c0
+r 0x1000ce40
+r 0x10008540
+r 0x100050c0
+w 0x10005800
+r 0x10008e80
+r 0x10005bc0
+w 0x10681c00
+r 0x100085c0
+r 0x10008340
+r 0x100003c0
+r 0x10007d80
+r 0x1000a080
+r 0x10003200
+w 0x1000d040
+r 0x10b8b4c0
+r 0x10002580
+w 0x10009380
+r 0x1000ba80
+w 0x10005a00
+r 0x10008c00
+r 0x1000aa40
+w 0x10001980
+r 0x10db0700
+r 0x10000800
+r 0x10002380
+r 0x1000e800
+r 0x1000e2c0
+r 0x10003440
+r 0x10005c00
+w 0x10007f00
+r 0x10009880
+r 0x10853d80
+w 0x1000afc0
+w 0x10004900
+w 0x1040c800
+r 0x1000f1c0
+r 0x10004980
+r 0x1000a240
+w 0x100009c0
+r 0x1000fd40
+r 0x1000c580
+w 0x10003a00
+w 0x10691940
+r 0x10006500
+r 0x10005240
+r 0x10a574c0
+r 0x1000c1c0
+r 0x1000ac00
+r 0x1000c680
+r 0x1000f1c0
+r 0x10009e40
+r 0x10007200
+r 0x10005240
+r 0x10007880
+r 0x1000d340
+r 0x105beec0
+w 0x10004440
+r 0x10002640
+r 0x10005500
+r 0x1000cac0
+r 0x10007500
+r 0x10004640
+r 0x10002840
+w 0x106b1080
+r 0x10007680
+r 0x1000f8c0
+r 0x10009e40
+r 0x10001680
+r 0x10009700
+w 0x1000d800
+r 0x10001cc0
+w 0x10006580
+r 0x1000dc80
+r 0x10000ac0
+w 0x10000900
+w 0x100004c0
+r 0x1000eb80
+r 0x10009b00
+r 0x100093c0
+r 0x10001100
+w 0x1000a400
+r 0x1000a580
+r 0x1000c700
+r 0x10003ec0
+r 0x100026c0
+r 0x10005ac0
+r 0x10001740
+r 0x10006c00
+r 0x10002dc0
+r 0x10008c00
+r 0x100095c0
+r 0x1000f200
+r 0x10005c00
+r 0x10003c80
+r 0x1037a500
+r 0x10c05800
+w 0x1000d340
+r 0x1000a100
+r 0x10002380
+w 0x10008040
+w 0x1042fdc0
+r 0x10007e00
+r 0x1000b1c0
+w 0x1000c400
+r 0x10009000
+r 0x10001b40
+r 0x1000f200
+w 0x10008340
+r 0x100004c0
+w 0x1000e9c0
+r 0x1000b6c0
+w 0x10006a40
+r 0x1000de40
+w 0x10006ac0
+r 0x1000aa00
+r 0x10006bc0
+r 0x1045ccc0
+r 0x10005700
+r 0x1000ad40
+r 0x10009180
+w 0x1000f9c0
+r 0x100080c0
+w 0x1000f2c0
+w 0x10006980
+w 0x1000a580
+r 0x1000b740
+r 0x10005a40
+w 0x10006640
+r 0x10002580
+r 0x1000e680
+w 0x1000bd80
+r 0x1000bf00
+r 0x10903200
+r 0x100005c0
+r 0x1000be80
+w 0x10008dc0
+r 0x10005380
+w 0x100077c0
+r 0x10005580
+w 0x10005f40
+r 0x1000d740
+r 0x10001d80
+r 0x10006180
+r 0x10000d80
+r 0x10003ec0
+r 0x10004d00
+w 0x100055c0
+r 0x10770680
+w 0x10004e40
+r 0x1070fb80
+r 0x10005e80
+r 0x10006b00
+r 0x10578bc0
+r 0x1000bac0
+w 0x10001000
+r 0x1000c480
+r 0x1000b940
+r 0x1000d840
+r 0x1000dc40
+w 0x10006a40
+r 0x1000b1c0
+r 0x10537f00
+w 0x10007380
+w 0x10007fc0
+w 0x1000ee80
+w 0x100022c0
+r 0x1000acc0
+r 0x1000d0c0
+w 0x1000e4c0
+r 0x1000ffc0
+r 0x10002b80
+r 0x10000a40
+w 0x10008800
+r 0x1000cb80
+w 0x10004780
+r 0x10002680
+r 0x1000f4c0
+r 0x10004780
+r 0x10005940
+r 0x1000c080
+r 0x10008600
+r 0x1000b280
+r 0x1000c380
+r 0x100067c0
+r 0x1000d340
+r 0x1000f6c0
+r 0x100081c0
+w 0x10004b00
+r 0x10b626c0
+r 0x10006980
+r 0x1000a000
+w 0x10004280
+r 0x10005340
+r 0x1000d380
+r 0x10000a00
+w 0x1000cc40
+r 0x10004f40
+r 0x10001a40
+r 0x1000be80
+r 0x1000c240
+r 0x10dc5280
+r 0x100056c0
+w 0x1000ea00
+r 0x1000ebc0
+r 0x1000dd80
+r 0x1000d3c0
+r 0x1000dd80
+r 0x10009980
+r 0x10005d00
+r 0x1000a380
+r 0x10007900
+r 0x1000b340
+w 0x10780f00
+r 0x10006540
+r 0x1000ee00
+r 0x10000a40
+r 0x10002880
+r 0x102a3040
+r 0x109f8180
+r 0x10cb6240
+w 0x10a91ec0
+w 0x1000c680
+r 0x10c77180
+w 0x10001c00
+w 0x10002b40
+r 0x10007840
+r 0x10001bc0
+r 0x10c5ba80
+r 0x1000b580
+r 0x1000d900
+r 0x10000600
+w 0x100021c0
+r 0x1000f640
+w 0x1000e540
+r 0x1000f900
+w 0x1000ca80
+w 0x10000180
+r 0x1090a700
+r 0x10001e80
+r 0x100056c0
+r 0x10005d80
+w 0x10006340
+r 0x10007800
+w 0x1000b6c0
+r 0x1000e8c0
+r 0x1000cb80
+r 0x10004180
+r 0x10001ec0
+r 0x10005ec0
+r 0x10008d40
+r 0x102a8640
+w 0x1000ca40
+r 0x10006780
+w 0x10004840
+r 0x10009040
+r 0x100045c0
+w 0x100063c0
+r 0x10001980
+r 0x10006ec0
+r 0x1000bb80
+r 0x1000c7c0
+r 0x10000a40
+r 0x10005d40
+r 0x1000c880
+r 0x10009400
+r 0x10000440
+r 0x1000af40
+r 0x1000eac0
+r 0x10001b80
+r 0x109bdc00
+r 0x100054c0
+r 0x10d0b640
+r 0x10001500
+r 0x10003900
+w 0x1000a680
+w 0x10007440
+r 0x10008440
+r 0x10001840
+r 0x1000bf00
+r 0x10005980
+r 0x10001cc0
+r 0x10003ac0
+r 0x1000c4c0
+r 0x1000f4c0
+r 0x100078c0
+r 0x10002a80
+r 0x10009280
+w 0x10003180
+w 0x10a65cc0
+r 0x10002f40
+w 0x1000a580
+w 0x1000d680
+r 0x1000e740
+w 0x10000d00
+r 0x10000b00
+r 0x1000a040
+w 0x10009fc0
+r 0x10fe9fc0
+r 0x1000dc00
+r 0x10008900
+r 0x10003880
+r 0x100021c0
+r 0x10004bc0
+r 0x10006b40
+r 0x1000d600
+r 0x1000e380
+r 0x10003180
+w 0x100055c0
+w 0x10008200
+r 0x10007000
+r 0x100089c0
+r 0x10009680
+w 0x10008080
+r 0x1000c440
+r 0x10007340
+r 0x10002cc0
+r 0x1045e400
+r 0x100083c0
+r 0x100084c0
+r 0x1000ef80
+w 0x10750680
+r 0x10008140
+r 0x1000ed80
+r 0x100098c0
+r 0x1000ec40
+w 0x1000ff00
+w 0x10006340
+r 0x107633c0
+w 0x100047c0
+w 0x1000e940
+r 0x10008b40
+w 0x10000440
+r 0x1000bfc0
+w 0x10002d80
+r 0x10000400
+r 0x1000a0c0
+r 0x10003dc0
+r 0x10d14ec0
+r 0x1000a3c0
+r 0x10000e00
+r 0x10002c80
+r 0x1000b480
+r 0x10009400
+r 0x10fa6c00
+r 0x1000f040
+r 0x10000d80
+r 0x10002dc0
+r 0x1000fdc0
+r 0x10001240
+r 0x10000600
+r 0x10001180
+r 0x100092c0
+r 0x10007f40
+r 0x10092300
+r 0x10004c40
+r 0x10000d80
+r 0x10002d00
+r 0x10000500
+r 0x10000fc0
+r 0x1000ba00
+r 0x1000e580
+r 0x102f15c0
+r 0x10006540
+w 0x10007900
+w 0x10007e00
+r 0x10004e00
+r 0x10003ec0
+r 0x10005440
+w 0x10003a80
+r 0x10005440
+w 0x1000df80
+r 0x10009dc0
+r 0x1000d340
+r 0x107107c0
+w 0x10002780
+r 0x10c5bbc0
+w 0x10009380
+w 0x10005a80
+r 0x1000ea80
+w 0x1000cec0
+r 0x1000e880
+r 0x10001bc0
+r 0x1000d140
+r 0x1000ff40
+r 0x10007f80
+w 0x100070c0
+r 0x10002440
+w 0x10002580
+r 0x10000180
+r 0x100026c0
+r 0x1000b140
+r 0x100082c0
+w 0x10000740
+r 0x1000dfc0
+r 0x10003680
+r 0x10002240
+r 0x10009b00
+r 0x10007000
+r 0x1000ddc0
+r 0x1000a0c0
+w 0x1000a040
+r 0x1000f240
+r 0x102abbc0
+r 0x10002740
+r 0x1000f6c0
+r 0x101fe340
+r 0x1000b180
+r 0x10005800
+w 0x10009a80
+w 0x10000d40
+r 0x10002700
+r 0x10008440
+r 0x10008a40
+r 0x10003380
+r 0x10008780
+w 0x10005d40
+w 0x1000b200
+r 0x1000e040
+r 0x100064c0
+r 0x10000840
+r 0x1000edc0
+r 0x10008900
+r 0x1000fdc0
+w 0x1000cf00
+r 0x10c4a180
+r 0x1000ad80
+r 0x10004fc0
+r 0x1000c880
+r 0x10c8ac40
+w 0x10002e40
+r 0x1000a7c0
+r 0x1007ab80
+r 0x10008200
+r 0x10007fc0
+w 0x10006800
+r 0x1013da40
+r 0x10b54380
+r 0x10007580
+w 0x10008700
+w 0x10005480
+r 0x100007c0
+w 0x10005680
+r 0x105aa3c0
+r 0x1000d340
+w 0x10004980
+r 0x10007400
+w 0x10484a80
+w 0x10001f00
+r 0x10003c00
+r 0x10005780
+r 0x10009840
+w 0x10004e00
+r 0x1000f6c0
+r 0x10001ec0
+r 0x10007d80
+r 0x10001e80
+r 0x10008880
+r 0x1000c180
+w 0x10005b00
+r 0x1000c0c0
+r 0x10004c00
+r 0x1000d980
+r 0x1000c6c0
+r 0x10002700
+r 0x10004780
+w 0x10004c00
+r 0x10005900
+w 0x1000cf40
+r 0x1000a000
+r 0x10005840
+r 0x1000d400
+r 0x1000a540
+r 0x10006a00
+r 0x1000a080
+r 0x10007100
+r 0x10009300
+r 0x10003540
+r 0x10006500
+r 0x1000b580
+r 0x10006040
+r 0x100038c0
+r 0x1000a800
+r 0x10000700
+r 0x10003380
+r 0x10000a40
+r 0x10000240
+w 0x100072c0
+r 0x10004740
+w 0x104ea080
+r 0x1000aec0
+r 0x100061c0
+w 0x10003d00
+r 0x100057c0
+r 0x100ec640
+r 0x10009040
+w 0x10007b40
+w 0x10000e40
+r 0x1000edc0
+w 0x100017c0
+r 0x1000b9c0
+r 0x10007c80
+r 0x10004c80
+r 0x10003440
+r 0x100030c0
+r 0x1000b240
+r 0x10008780
+r 0x100e2440
+r 0x1000f200
+r 0x1000fa00
+r 0x10081bc0
+r 0x10001540
+r 0x1000db80
+r 0x1000cfc0
+r 0x100038c0
+r 0x1000ae80
+w 0x1000fc00
+r 0x10003280
+r 0x1000a340
+w 0x1000e840
+r 0x1000b940
+w 0x10008fc0
+r 0x10006e00
+w 0x1000d880
+r 0x10006380
+r 0x10f6bd00
+r 0x10002f40
+w 0x10008fc0
+r 0x10002440
+r 0x10004880
+r 0x103d6340
+r 0x10007f40
+r 0x1000c900
+r 0x1000d800
+w 0x10003540
+w 0x10000180
+r 0x1000d2c0
+r 0x1000dec0
+r 0x10a4ef40
+r 0x1000df80
+r 0x10006c00
+r 0x10002c00
+r 0x1000a380
+r 0x1000a080
+r 0x10004140
+r 0x10007300
+w 0x1000cd00
+w 0x1000fe40
+r 0x10001840
+w 0x1000c680
+r 0x10003c40
+r 0x10008a80
+r 0x1000e800
+r 0x10002b80
+r 0x10005f00
+r 0x10007b80
+r 0x100074c0
+r 0x10fb6400
+r 0x1000bb80
+r 0x10008c80
+r 0x1000ff40
+r 0x100019c0
+r 0x1000f480
+w 0x1000e780
+r 0x100001c0
+r 0x10008e80
+r 0x1000f140
+r 0x10007180
+r 0x10177400
+r 0x10007380
+r 0x1000a900
+r 0x10005c40
+r 0x10ab6940
+r 0x1000afc0
+w 0x10001300
+r 0x1000b3c0
+r 0x10002880
+r 0x1000d5c0
+r 0x10007540
+r 0x10009b40
+r 0x1000c440
+w 0x10dc4480
+r 0x10007e00
+r 0x100a3e00
+r 0x100009c0
+r 0x100010c0
+r 0x100087c0
+r 0x1000cdc0
+r 0x102ce580
+w 0x10008000
+w 0x10005480
+r 0x10004dc0
+r 0x1000ab40
+r 0x1000e2c0
+r 0x10000480
+r 0x1000f640
+r 0x10002ec0
+r 0x1000bf80
+r 0x10005dc0
+r 0x10002a40
+r 0x1000a5c0
+r 0x10001400
+r 0x1000e700
+r 0x10003340
+r 0x1000b1c0
+r 0x10006740
+r 0x10005500
+r 0x10000400
+w 0x100044c0
+r 0x10004e00
+r 0x10005480
+r 0x1000ad40
+r 0x10009100
+r 0x10008480
+r 0x1000fd40
+w 0x10918280
+r 0x10007480
+r 0x1000ae40
+r 0x10002cc0
+r 0x10000740
+r 0x10005c00
+r 0x1000fa80
+r 0x10004280
+r 0x10002d00
+r 0x10001840
+r 0x1000ec80
+r 0x10007640
+r 0x100021c0
+r 0x10007640
+w 0x1000ca00
+r 0x10003f80
+r 0x10001fc0
+r 0x10006b80
+w 0x10005740
+r 0x10142d40
+r 0x10001700
+r 0x10009cc0
+w 0x1000e1c0
+r 0x10002a80
+r 0x1000a280
+r 0x1000db00
+r 0x100027c0
+r 0x100090c0
+r 0x10fa2180
+r 0x10009ec0
+r 0x10006380
+r 0x1000da80
+r 0x1000dcc0
+r 0x100019c0
+r 0x1000bf80
+r 0x10009900
+r 0x1015b600
+r 0x100026c0
+r 0x10004140
+w 0x109fad00
+r 0x1000e200
+r 0x1000b940
+r 0x1000d740
+r 0x10005e00
+w 0x1000fc40
+r 0x1000a080
+r 0x10004240
+r 0x10006400
+r 0x10007e40
+r 0x10511940
+r 0x10006740
+r 0x1000bf80
+w 0x10009880
+w 0x10393280
+r 0x1000a2c0
+w 0x100062c0
+r 0x100cc480
+r 0x10001540
+r 0x10002440
+r 0x10003800
+r 0x10007400
+r 0x10002100
+r 0x1000b000
+r 0x109c9800
+r 0x100006c0
+r 0x10009680
+r 0x10002440
+r 0x1071d700
+r 0x1000c740
+r 0x10004a80
+w 0x10000ac0
+r 0x100010c0
+r 0x1000f800
+r 0x1000bb00
+w 0x10003f00
+r 0x10000680
+r 0x100033c0
+r 0x10009040
+r 0x10506240
+r 0x1000c380
+r 0x10006d40
+w 0x10b70300
+r 0x1000f880
+w 0x10734680
+r 0x10005940
+r 0x1000afc0
+r 0x10001d00
+r 0x1000e180
+r 0x1000fa40
+r 0x10007d80
+r 0x10008900
+r 0x10008840
+r 0x10006040
+r 0x10008c40
+r 0x10006d40
+w 0x10006400
+w 0x10002740
+r 0x10008a40
+r 0x10005140
+r 0x100000c0
+w 0x100001c0
+r 0x10006e40
+w 0x100060c0
+r 0x1000f140
+w 0x10005b00
+r 0x1000c380
+r 0x10000c00
+w 0x10003400
+r 0x1000b480
+r 0x10008400
+r 0x10007e00
+w 0x10009dc0
+r 0x100089c0
+r 0x1000fd00
+w 0x1000c940
+r 0x10002200
+w 0x10001580
+r 0x1000e740
+r 0x10004680
+r 0x10009940
+r 0x10009f80
+r 0x10004400
+r 0x1000dd00
+r 0x105cc440
+r 0x1000adc0
+w 0x10009e00
+r 0x10004b40
+r 0x1000f600
+r 0x1000de00
+r 0x10007e40
+r 0x10001240
+r 0x10026f00
+r 0x10003940
+w 0x100092c0
+r 0x10c2e2c0
+w 0x1000af40
+r 0x10000780
+w 0x1000b4c0
+r 0x1000a540
+r 0x10005480
+r 0x100032c0
+r 0x1000cbc0
+w 0x10006100
+r 0x1000f8c0
+r 0x100052c0
+w 0x10004a80
+r 0x1000c180
+w 0x1000e080
+r 0x10006d80
+r 0x1000ec40
+r 0x10007040
+r 0x107a2000
+r 0x104c29c0
+r 0x1000d200
+r 0x1000ff40
+r 0x10001b80
+w 0x10004780
+r 0x10002780
+r 0x10000d00
+r 0x1000ed00
+r 0x10002800
+r 0x1000bd80
+w 0x10009440
+w 0x1000b980
+w 0x10001a40
+r 0x1000ea40
+r 0x10008700
+r 0x10001b00
+r 0x10c53ac0
+w 0x10003f40
+r 0x1000ec00
+r 0x10009f40
+r 0x10002dc0
+r 0x1000ff40
+r 0x10007cc0
+r 0x10004400
+r 0x10dc0b80
+r 0x100068c0
+w 0x1000d000
+r 0x100097c0
+r 0x1000bb40
+r 0x1000cd00
+r 0x1000b440
+r 0x1000f500
+r 0x1000aa00
+r 0x10000dc0
+w 0x10002bc0
+r 0x1000e480
+r 0x108be880
+r 0x10008400
+r 0x1000c640
+r 0x100072c0
+r 0x1000cec0
+r 0x1000b880
+w 0x10008480
+r 0x10004080
+w 0x10c87380
+w 0x10017640
+r 0x100066c0
+r 0x10001980
+r 0x1000f080
+r 0x1000ab80
+r 0x10004580
+w 0x10008dc0
+r 0x10005480
+r 0x10001440
+r 0x10004880
+w 0x10003840
+r 0x1000d5c0
+r 0x10007740
+r 0x10f8cb40
+r 0x10003e40
+r 0x10005740
+r 0x109bbd00
+r 0x1000ba00
+r 0x1000a300
+r 0x10009b40
+w 0x10003440
+r 0x100062c0
+r 0x1000af40
+r 0x10003780
+r 0x10006e00
+r 0x10002700
+w 0x10004f00
+r 0x10002540
+w 0x1000a2c0
+w 0x10002880
+r 0x10002180
+r 0x10008cc0
+w 0x10007a40
+w 0x10001000
+r 0x1000e580
+r 0x1000ecc0
+r 0x10004540
+r 0x10000c40
+r 0x10004980
+r 0x100095c0
+w 0x10009400
+r 0x1000b480
+r 0x10004480
+r 0x10004b80
+r 0x10005580
+r 0x10004100
+r 0x10004400
+r 0x1000df00
+r 0x1000ee80
+r 0x10002580
+r 0x1000e6c0
+r 0x10005240
+r 0x1000d900
+r 0x10001580
+w 0x100011c0
+r 0x100000c0
+r 0x1000ec80
+w 0x10008600
+r 0x10000b80
+r 0x10000a40
+r 0x1000d140
+w 0x10010580
+r 0x1000dd40
+r 0x1000bb40
+w 0x1000b940
+r 0x10009a80
+r 0x10007840
+r 0x1000b340
+r 0x1000ed80
+r 0x100041c0
+r 0x109bb240
+r 0x10005e80
+r 0x10003e00
+w 0x1000db40
+r 0x10cb8940
+r 0x10004380
+r 0x1000f640
+r 0x10009cc0
+r 0x10002980
+r 0x10000bc0
+r 0x10000840
+r 0x100026c0
+r 0x10001380
+r 0x10003d40
+r 0x1000ad40
+r 0x10009fc0
+w 0x100085c0
+r 0x10615f80
+r 0x1000db00
+r 0x10004440
+r 0x10009580
+r 0x10008800
+r 0x10009cc0
+r 0x10000400
+r 0x10007640
+r 0x1000fcc0
+r 0x1000d640
+r 0x10001340
+r 0x1000e740
+r 0x100031c0
+r 0x1000c740
+r 0x10005240
+r 0x1000cac0
+r 0x10002080
+r 0x1000ad80
+r 0x104b2900
+r 0x100037c0
+r 0x1000d880
+r 0x1000cb40
+r 0x10008ec0
+r 0x10005480
+r 0x1000e300
+w 0x1000fc80
+r 0x10009e00
+r 0x10005f00
+r 0x1000cf80
+r 0x1000b180
+r 0x10005980
+w 0x10003780
+r 0x10004e00
+r 0x1000a140
+r 0x10000f00
+r 0x10007d80
+r 0x10002ec0
+r 0x100039c0
+r 0x1000ba80
+r 0x10009400
+r 0x105264c0
+w 0x100052c0
+r 0x1000e4c0
+w 0x10002f80
+r 0x10008640
+w 0x10009780
+r 0x10004300
+r 0x10009ec0
+w 0x10005340
+r 0x10005cc0
+r 0x10006e00
+r 0x1000d580
+r 0x10003800
+r 0x1000ebc0
+r 0x10c08500
+r 0x100017c0
+r 0x10000040
+r 0x10b99c00
+w 0x1000f880
+r 0x1000c4c0
+w 0x10001540
+r 0x1000e3c0
+r 0x1000dac0
+r 0x10325640
+w 0x10009400
+r 0x1000c300
+w 0x100077c0
+w 0x10001780
+r 0x102ef080
+r 0x100046c0
+r 0x10d76940
+w 0x10001800
+r 0x1000cec0
+r 0x10003840
+r 0x10007e40
+r 0x1000f540
+r 0x10438ac0
+r 0x1000acc0
+r 0x1000f580
+w 0x10000540
+r 0x1000d540
+w 0x10002a80
+w 0x100054c0
+r 0x1000e1c0
+r 0x10000440
+r 0x1000c900
+r 0x1000e940
+r 0x1000ffc0
+w 0x1000aa40
+r 0x10002900
+r 0x1000da80
+r 0x103c5c80
+r 0x1000e6c0
+r 0x1000f7c0
+r 0x100007c0
+r 0x10001680
+r 0x1000f740
+r 0x10004e80
+r 0x10004d00
+r 0x1054ad00
+r 0x100026c0
+r 0x10000540
+r 0x101fad80
+r 0x10006840
+w 0x10009400
+w 0x10753580
+w 0x10005f40
+w 0x10009840
+r 0x10005000
+r 0x100027c0
+r 0x10005400
+r 0x1045af00
+w 0x10006280
+w 0x10007e00
+r 0x100097c0
+r 0x10001200
+r 0x1000d300
+w 0x10008ac0
+r 0x100e5b80
+r 0x100030c0
+r 0x1000e6c0
+r 0x10005bc0
+r 0x10008d40
+r 0x100050c0
+w 0x10006ec0
+r 0x1000ad00
+r 0x1000a7c0
+r 0x1000e600
+r 0x1000ae00
+r 0x1000b5c0
+r 0x10005d40
+w 0x10003b80
+w 0x1000dc80
+r 0x10006900
+r 0x1000c980
+r 0x10003100
+r 0x10006800
+w 0x1000c740
+r 0x1000cb40
+r 0x1000eb40
+w 0x1050a740
+r 0x1000c240
+r 0x10006c80
+r 0x10002b00
+r 0x10006300
+r 0x10002080
+r 0x1000c100
+r 0x100096c0
+w 0x10009f80
+r 0x100068c0
+r 0x10003980
+r 0x1000f000
+r 0x10002680
+r 0x100010c0
+r 0x102630c0
+r 0x10000500
+w 0x10009f40
+r 0x1000a280
+r 0x10003980
+r 0x10007780
+w 0x1000c800
+r 0x10008b80
+r 0x1000f0c0
+r 0x1000c940
+r 0x10005ac0
+r 0x1000abc0
+r 0x10005700
+w 0x10007740
+w 0x10002ac0
+w 0x100095c0
+r 0x10003680
+r 0x100061c0
+r 0x10db6f40
+r 0x10008400
+r 0x10dfb740
+r 0x1000b2c0
+r 0x1000bbc0
+r 0x10004f00
+r 0x1000bcc0
+r 0x1000e480
+r 0x10005640
+w 0x10a8b500
+r 0x10000940
+r 0x1000e040
+r 0x1000e640
+w 0x1000f280
+w 0x10004840
+r 0x10003000
+r 0x10009880
+r 0x10002940
+r 0x105ea8c0
+r 0x10006a40
+r 0x1000a580
+w 0x10008f00
+w 0x10000a80
+w 0x10005d40
+r 0x100067c0
+r 0x1000aec0
+w 0x10004040
+r 0x10f1b3c0
+r 0x10933440
+r 0x1000b100
+r 0x10004040
+r 0x100022c0
+r 0x10002ac0
+r 0x1000d780
+r 0x10001500
+r 0x10003c80
+r 0x1032fcc0
+r 0x100036c0
+w 0x10005c40
+w 0x10007ec0
+r 0x10008700
+w 0x100054c0
+w 0x10000880
+r 0x10002540
+r 0x10000b00
+r 0x1000eac0
+r 0x1000c700
+r 0x10917d80
+r 0x10006a80
+r 0x10009c40
+r 0x10003680
+r 0x10000e80
+r 0x10005980
+r 0x100091c0
+r 0x10003700
+w 0x10007040
+r 0x1000fcc0
+r 0x10008ac0
+r 0x10009640
+r 0x10009340
+r 0x100057c0
+r 0x10006600
+r 0x10001280
+r 0x10005080
+r 0x1000c400
+r 0x100072c0
+r 0x10005740
+w 0x1000cb40
+r 0x1000b7c0
+r 0x107fb340
+r 0x10001e80
+r 0x1000de80
+w 0x10003900
+r 0x10006040
+r 0x1068d640
+r 0x10007600
+r 0x10a1f380
+w 0x10003640
+r 0x10429b40
+w 0x100027c0
+r 0x1000a000
+r 0x10184a80
+r 0x1000fc40
+w 0x100016c0
+r 0x10009f00
+r 0x1000a800
+r 0x10005c40
+r 0x10007b80
+r 0x106c1540
+r 0x10001c80
+w 0x10002840
+r 0x1000e780
+w 0x10007440
+r 0x10008140
+w 0x100045c0
+r 0x1000c700
+r 0x10009080
+r 0x100039c0
+w 0x10002a00
+w 0x1000f800
+r 0x10008280
+r 0x1000b400
+w 0x10002ac0
+r 0x10cc0500
+w 0x1000f700
+r 0x10003840
+r 0x10004d80
+r 0x10d322c0
+r 0x1072e6c0
+r 0x10004d80
+r 0x1000b480
+r 0x1000a280
+w 0x1000e580
+r 0x1000fd00
+r 0x10007000
+r 0x1000b100
+r 0x10008d40
+w 0x10008440
+r 0x10fda940
+w 0x10000200
+r 0x1000ab40
+r 0x1000f140
+r 0x10009980
+r 0x10000880
+r 0x100032c0
+r 0x10007880
+r 0x10002c00
+r 0x1045de00
+r 0x10003e80
+r 0x10005f00
+r 0x1000e500
+r 0x100008c0
+r 0x1000a940
+r 0x10007cc0
+w 0x1000cac0
+r 0x10004340
+w 0x10008300
+r 0x10932040
+r 0x10001040
+r 0x10000a00
+r 0x1093a7c0
+r 0x1000c5c0
+r 0x100018c0
+r 0x1000bf40
+r 0x1000ed80
+r 0x10000d40
+r 0x1000c8c0
+r 0x1000cdc0
+r 0x10b40300
+r 0x1000a140
+r 0x10004d00
+r 0x1000fac0
+r 0x1000d0c0
+w 0x10002880
+r 0x10003ec0
+r 0x10006340
+r 0x10002ac0
+r 0x10004ac0
+r 0x10007a80
+r 0x1000b480
+r 0x10003680
+r 0x100017c0
+r 0x10000100
+r 0x10004a80
+r 0x1000f640
+r 0x1000e9c0
+r 0x1000b300
+w 0x10002440
+r 0x10006900
+r 0x10009a80
+r 0x10002640
+r 0x10001740
+r 0x1000ff40
+w 0x10003440
+r 0x100056c0
+r 0x1000e400
+r 0x1000bd40
+r 0x10002b80
+w 0x10005640
+w 0x10006140
+r 0x10712a00
+r 0x1000ecc0
+r 0x10004800
+r 0x10006e40
+r 0x1000c180
+r 0x1000b5c0
+w 0x1000bb40
+r 0x10001600
+r 0x10007480
+r 0x10001f40
+r 0x1000f400
+r 0x100043c0
+r 0x1000b280
+w 0x10005c40
+w 0x10006e40
+r 0x10009b40
+r 0x10000940
+r 0x10008fc0
+w 0x10004180
+w 0x10004040
+w 0x10008ac0
+w 0x1000c900
+r 0x10001640
+w 0x10003c80
+r 0x10002840
+r 0x10001480
+w 0x10003780
+r 0x108ee240
+r 0x1000c480
+w 0x10001c80
+r 0x10008540
+r 0x1000ad00
+r 0x1000fa80
+w 0x1000ac00
+r 0x10009980
+r 0x10006b00
+r 0x1000a240
+w 0x10002140
+r 0x1000e100
+r 0x100034c0
+r 0x1000f180
+r 0x1000b780
+r 0x10002840
+r 0x10007f00
+w 0x10001dc0
+r 0x1000e180
+r 0x1000e000
+r 0x1000edc0
+r 0x10006b40
+r 0x1000b6c0
+r 0x10009880
+r 0x10003c80
+r 0x1000e040
+w 0x1000a400
+r 0x1000c700
+r 0x10002e00
+w 0x1000b300
+r 0x100041c0
+r 0x10002c00
+r 0x10008940
+r 0x1000b740
+r 0x100012c0
+r 0x1000f600
+r 0x10fcc680
+r 0x10008280
+r 0x1000bb40
+r 0x100048c0
+r 0x10002700
+r 0x10007300
+r 0x100022c0
+r 0x1000d400
+r 0x10009c80
+r 0x1000c580
+r 0x1059f900
+r 0x10006780
+r 0x1000dd80
+r 0x10002c00
+w 0x10009740
+w 0x100039c0
+r 0x10006d80
+w 0x100e2300
+r 0x10003cc0
+w 0x100063c0
+w 0x10008640
+r 0x10004840
+w 0x1000e080
+r 0x1000c2c0
+r 0x10000bc0
+r 0x10003ec0
+r 0x10004e00
+w 0x1000e4c0
+w 0x10001900
+r 0x10006a40
+w 0x100071c0
+r 0x1000d400
+w 0x103b1d40
+r 0x10001bc0
+r 0x10005d40
+r 0x10009a80
+r 0x1000a9c0
+r 0x10000a00
+w 0x10003140
+w 0x100056c0
+r 0x1000f140
+r 0x1000aac0
+r 0x10d6f8c0
+r 0x1000dc40
+r 0x10004680
+r 0x10b09000
+r 0x10002140
+r 0x10008800
+r 0x10005300
+r 0x1000dd80
+r 0x1000f3c0
+r 0x100076c0
+r 0x10006d40
+r 0x1000c240
+r 0x10009480
+r 0x1000e6c0
+r 0x10002880
+r 0x10001740
+r 0x1000c0c0
+w 0x1000cd40
+r 0x100074c0
+r 0x1000d580
+w 0x1000aa40
+w 0x10006d00
+r 0x10003d00
+r 0x10006580
+w 0x10001140
+w 0x10005300
+r 0x1000a040
+r 0x1000f9c0
+w 0x10003280
+w 0x1000dc00
+r 0x10128940
+r 0x10003f40
+r 0x10009bc0
+r 0x10001b40
+r 0x1000c380
+r 0x10003340
+r 0x1000d240
+r 0x1000e500
+r 0x10005fc0
+w 0x1000bd80
+r 0x10005b40
+r 0x1000cc40
+w 0x1000c5c0
+r 0x100030c0
+w 0x1000e0c0
+r 0x108a72c0
+r 0x10b3ba80
+w 0x10005240
+r 0x1000bac0
+r 0x1000d700
+r 0x10006400
+r 0x10001b80
+r 0x100038c0
+w 0x10007b40
+r 0x1000bb00
+r 0x1000d1c0
+r 0x10006500
+w 0x10a5cc40
+w 0x1000b940
+r 0x10008e00
+r 0x10004b40
+r 0x1000aac0
+r 0x100083c0
+r 0x1000ae40
+r 0x10000e40
+r 0x1000d780
+r 0x10003ec0
+r 0x10001a80
+r 0x1000d240
+r 0x100058c0
+r 0x10e838c0
+r 0x1000a5c0
+r 0x100059c0
+r 0x1000ba80
+w 0x10007080
+r 0x1000b980
+r 0x1000da40
+r 0x10005180
+r 0x10000280
+w 0x1000a180
+r 0x100058c0
+r 0x100084c0
+r 0x1000a540
+w 0x1000b300
+w 0x1000e0c0
+w 0x1000e380
+w 0x1000c5c0
+r 0x1000f400
+r 0x1000a600
+r 0x1000fa00
+r 0x1000d8c0
+r 0x10006c80
+r 0x100052c0
+r 0x10d2e3c0
+w 0x10002d80
+r 0x1000d700
+r 0x100047c0
+r 0x100c1d00
+r 0x10007e40
+r 0x1000d500
+r 0x10005480
+r 0x10006580
+r 0x10e5af80
+w 0x10005240
+r 0x1000bf40
+r 0x10008bc0
+r 0x1000e800
+r 0x1000b680
+r 0x10002580
+w 0x10008cc0
+r 0x1000a880
+r 0x1000f880
+r 0x1000ff40
+r 0x10005e00
+r 0x100097c0
+r 0x10b88ec0
+r 0x10ded800
+w 0x1000a540
+w 0x1000dec0
+r 0x10006040
+r 0x10007400
+r 0x1000f6c0
+r 0x1000d500
+w 0x10007680
+w 0x10176200
+r 0x10003dc0
+r 0x10008a00
+w 0x10009780
+r 0x1000b380
+r 0x10007e80
+w 0x1000df40
+r 0x10002c80
+w 0x10007700
+r 0x1063c740
+r 0x1000b1c0
+r 0x1000a6c0
+r 0x1000d380
+w 0x100053c0
+r 0x10e7b640
+r 0x1000d480
+w 0x10004d00
+r 0x1000bd80
+r 0x1000de00
+r 0x1000c000
+w 0x1000d400
+r 0x10002500
+r 0x10007f40
+r 0x1000e340
+r 0x10008ac0
+r 0x10109200
+w 0x10004cc0
+r 0x10009a00
+r 0x10009180
+r 0x100019c0
+w 0x1000a0c0
+r 0x1000ecc0
+r 0x1000d880
+r 0x10001d00
+r 0x10007080
+r 0x10007280
+r 0x1000ce00
+r 0x10008dc0
+r 0x1000ca80
+r 0x10005a40
+r 0x10009a40
+r 0x10000f00
+r 0x10358200
+r 0x10002d80
+r 0x1000dd80
+r 0x100037c0
+w 0x101b7a80
+r 0x1000cb40
+w 0x1000f780
+r 0x10003080
+r 0x10002200
+r 0x10b7e7c0
+r 0x10f5af80
+r 0x1000b6c0
+r 0x1000c840
+r 0x10007a80
+w 0x10004c40
+r 0x1000c340
+r 0x1000c600
+w 0x10002e40
+r 0x10008c00
+r 0x10005180
+r 0x10006fc0
+r 0x10008bc0
+w 0x1000e540
+r 0x10001b00
+r 0x10002fc0
+r 0x100081c0
+w 0x10c39f00
+r 0x10008540
+r 0x10000b40
+r 0x10000780
+r 0x1000f800
+r 0x10008640
+w 0x1000cb40
+r 0x10001300
+w 0x1000bb80
+r 0x10002d40
+w 0x10004680
+r 0x10005800
+r 0x10006040
+r 0x1000f180
+w 0x10000b40
+w 0x10000e80
+r 0x10007380
+w 0x10000d00
+r 0x1000ea00
+r 0x103507c0
+r 0x10002640
+r 0x1000c1c0
+r 0x100091c0
+r 0x10008580
+r 0x100029c0
+r 0x10f8cb00
+r 0x10006840
+w 0x1000d140
+r 0x1000b480
+r 0x10002280
+w 0x10001180
+w 0x10001840
+r 0x10001180
+r 0x10005340
+r 0x10007ec0
+r 0x10007840
+r 0x10009d80
+w 0x10005680
+r 0x1000d180
+r 0x1000e8c0
+r 0x10007bc0
+r 0x1000fe00
+r 0x1000a580
+r 0x1000aac0
+r 0x1000ed00
+r 0x1000ce40
+r 0x10001f80
+w 0x1000fe40
+r 0x10000640
+r 0x10000fc0
+r 0x1000b200
+r 0x10000940
+r 0x10003d80
+r 0x10005c80
+r 0x10005ac0
+w 0x1000cc00
+r 0x10007800
+w 0x1000c380
+r 0x1000e4c0
+r 0x10008a00
+r 0x1000d680
+r 0x10005f80
+r 0x1000a000
+r 0x10008d80
+r 0x10001200
+w 0x10007780
+w 0x1000d7c0
+r 0x105429c0
+w 0x1000ef40
+w 0x1000cf40
+r 0x10002040
+w 0x10004a80
+r 0x1000ee80
+r 0x10005200
+r 0x10369d00
+r 0x10b52600
+r 0x1000f5c0
+r 0x1000fac0
+r 0x10000f00
+r 0x1000fc00
+w 0x10005840
+r 0x1000a6c0
+r 0x10006180
+r 0x10000fc0
+r 0x1000fdc0
+r 0x10005580
+r 0x1000f880
+r 0x10005740
+r 0x10009dc0
+r 0x1000dd40
+r 0x10003240
+r 0x1000f780
+w 0x10003200
+r 0x10005c80
+w 0x10001100
+w 0x10008080
+r 0x10009300
+r 0x10005540
+r 0x10009080
+r 0x10005d40
+r 0x100017c0
+r 0x10004ec0
+r 0x1000b3c0
+r 0x10005440
+r 0x10005840
+r 0x10fc90c0
+r 0x1000f540
+r 0x1000c0c0
+r 0x10006e80
+r 0x1000e800
+w 0x10000b80
+w 0x10004a00
+r 0x10005e40
+r 0x1000a3c0
+w 0x10007dc0
+r 0x1000f040
+w 0x10009a40
+r 0x101d8bc0
+w 0x107dd0c0
+r 0x10002c40
+r 0x10003e80
+r 0x10002980
+r 0x10007180
+r 0x100022c0
+r 0x10005240
+r 0x10000640
+r 0x1000d5c0
+r 0x10007800
+r 0x10006100
+r 0x1000f240
+r 0x10009c00
+r 0x10006b80
+r 0x10004f80
+r 0x10003c40
+r 0x10a7f980
+r 0x1000ac00
+r 0x10002480
+r 0x10003ec0
+w 0x1000e480
+r 0x1000ee00
+w 0x1000b8c0
+r 0x1000b340
+r 0x10005d80
+r 0x1000f9c0
+r 0x10005080
+r 0x10009580
+r 0x10000b40
+r 0x1000f940
+r 0x10001b80
+r 0x10ccf2c0
+r 0x100066c0
+r 0x10003e00
+r 0x10001480
+r 0x10002e40
+r 0x100007c0
+w 0x1000a4c0
+r 0x1000c200
+r 0x1000d3c0
+r 0x100045c0
+r 0x1000e100
+r 0x100004c0
+r 0x1000e340
+r 0x1000dc80
+r 0x10940740
+r 0x1000bdc0
+w 0x1000b100
+r 0x1000c5c0
+r 0x10004140
+w 0x1000de40
+r 0x10001400
+r 0x100085c0
+r 0x10009340
+r 0x10006e40
+r 0x10fafc40
+r 0x10005500
+r 0x10007740
+r 0x10007340
+r 0x10d7db80
+r 0x10000680
+r 0x100006c0
+r 0x107670c0
+w 0x1000d940
+r 0x1000b7c0
+r 0x10005ec0
+r 0x10007500
+w 0x1000c880
+r 0x10705c80
+w 0x10003940
+r 0x10004dc0
+r 0x10002740
+r 0x1000dfc0
+w 0x10008880
+r 0x10006240
+r 0x1000a1c0
+r 0x1000cd40
+w 0x10002180
+w 0x10d6f400
+r 0x100030c0
+r 0x10000ac0
+r 0x1000b480
+r 0x1000ddc0
+r 0x10006900
+r 0x10007940
+r 0x10007600
+r 0x1000db80
+r 0x10001900
+r 0x10000000
+r 0x100045c0
+r 0x1000cec0
+r 0x10003800
+r 0x1000e600
+r 0x1000fa00
+r 0x10006ac0
+r 0x10003b00
+r 0x10001880
+r 0x10009140
+r 0x1000fd40
+w 0x10006680
+r 0x1000c000
+r 0x10004840
+r 0x10009800
+r 0x10007680
+w 0x1000b200
+w 0x10001fc0
+r 0x10002800
+r 0x100033c0
+r 0x1000b980
+r 0x10009fc0
+r 0x10780600
+r 0x10009e80
+r 0x10004000
+r 0x10009a80
+r 0x1000cc40
+r 0x10005f40
+w 0x1000e380
+r 0x10003680
+w 0x10005b00
+r 0x1000bdc0
+r 0x1000f9c0
+w 0x10000e40
+r 0x10006c80
+r 0x10009a00
+r 0x10009500
+r 0x1000a0c0
+r 0x100095c0
+r 0x10972dc0
+r 0x10002b40
+r 0x10000b40
+r 0x1000fe80
+r 0x1000e880
+r 0x10005f80
+r 0x10005a80
+r 0x10009980
+r 0x10008b00
+r 0x10001540
+w 0x10006880
+w 0x1000eb40
+r 0x1000aa40
+r 0x10005800
+r 0x10009f00
+r 0x10007300
+w 0x1000a6c0
+r 0x10f7f400
+r 0x10115380
+r 0x10004040
+r 0x1000d7c0
+r 0x109a6a80
+w 0x10005100
+r 0x1000f980
+r 0x10001380
+r 0x10004d00
+r 0x10005780
+r 0x1000bc40
+r 0x10000780
+r 0x10003440
+r 0x100099c0
+r 0x10004f40
+r 0x10005b80
+r 0x10008c80
+r 0x10005500
+r 0x1000bcc0
+r 0x1000a380
+r 0x100022c0
+r 0x10008700
+r 0x10001ac0
+r 0x10009540
+r 0x10006880
+r 0x10005ec0
+r 0x1000de80
+r 0x10001d00
+r 0x100043c0
+r 0x10008f40
+r 0x1000a8c0
+w 0x10004a80
+r 0x10008580
+r 0x10009840
+r 0x107d1140
+r 0x10003900
+r 0x10001440
+r 0x10003180
+r 0x1000ee00
+r 0x10002f00
+r 0x1000df40
+w 0x1000f440
+r 0x108c5980
+r 0x10e68500
+r 0x10008e00
+w 0x10004600
+r 0x1000f940
+r 0x10007f00
+r 0x10005940
+r 0x100084c0
+r 0x10e9ae40
+r 0x1000a0c0
+r 0x1000b100
+r 0x1000c640
+r 0x1000c940
+r 0x100054c0
+r 0x10006e40
+r 0x1000fc80
+w 0x1000de00
+w 0x10000480
+r 0x10000b80
+r 0x1000c280
+r 0x1000d180
+r 0x1000c700
+r 0x1000bf80
+r 0x10001680
+w 0x1000dfc0
+w 0x10001780
+r 0x1000d280
+r 0x10005980
+r 0x10006d00
+r 0x10c47b00
+w 0x10009fc0
+r 0x1000ad40
+r 0x10bf2980
+r 0x10007600
+r 0x10007080
+r 0x10005040
+r 0x10008500
+r 0x10006000
+r 0x100082c0
+r 0x1000afc0
+r 0x100073c0
+r 0x1000a4c0
+w 0x1000e780
+r 0x10ec6080
+r 0x1000aa80
+r 0x100053c0
+r 0x10009c40
+r 0x1000c740
+r 0x10004740
+r 0x1000f640
+r 0x10002b80
+r 0x10008fc0
+r 0x100059c0
+w 0x100051c0
+r 0x10619300
+w 0x10002a00
+w 0x10005f40
+r 0x10000600
+r 0x10000d40
+r 0x1000f480
+r 0x10005080
+r 0x10005b00
+r 0x10001f40
+r 0x10006c80
+r 0x10003640
+r 0x10006780
+w 0x1000ec80
+r 0x10006bc0
+r 0x1048ce40
+r 0x10009640
+r 0x10009b40
+r 0x1000c840
+w 0x1000bac0
+r 0x10000680
+r 0x1000c980
+r 0x100065c0
+w 0x10006d80
+r 0x100025c0
+r 0x100b9c40
+r 0x10000140
+r 0x10a173c0
+r 0x10001340
+r 0x10001b80
+w 0x10005d80
+r 0x1000e7c0
+r 0x1000e780
+r 0x10003540
+r 0x100048c0
+r 0x1000f040
+r 0x10000840
+r 0x107dce40
+r 0x10002340
+w 0x10003040
+w 0x100cfa80
+r 0x10004f40
+w 0x10001680
+r 0x1000a480
+r 0x1000e340
+r 0x1000c3c0
+r 0x10051940
+r 0x10001a40
+w 0x10009440
+r 0x1000b400
+r 0x10003200
+w 0x10001700
+r 0x10000480
+r 0x102cfbc0
+r 0x1000c0c0
+r 0x100056c0
+r 0x10009040
+r 0x1000b800
+w 0x108c7000
+r 0x1000d6c0
+r 0x1000cb80
+w 0x1000f380
+r 0x10007e00
+r 0x10aae8c0
+r 0x1000ac40
+r 0x10002700
+r 0x10002c00
+r 0x10007bc0
+w 0x10006bc0
+r 0x10007300
+r 0x10308a40
+r 0x1000f840
+w 0x10007800
+r 0x1000f580
+r 0x10005940
+r 0x10009600
+w 0x1005e540
+r 0x10c19440
+r 0x104ddf00
+r 0x10002b00
+r 0x10005bc0
+r 0x10009a80
+r 0x1000ca40
+r 0x107d8cc0
+r 0x10009880
+w 0x10001640
+r 0x1000d6c0
+r 0x100058c0
+r 0x100007c0
+r 0x10006ec0
+w 0x10000600
+r 0x10001680
+r 0x10006180
+r 0x10008140
+w 0x1000e0c0
+w 0x10006dc0
+r 0x10008ec0
+r 0x10001740
+r 0x1000eb80
+r 0x1000f840
+w 0x10009bc0
+r 0x1019a180
+r 0x1000e980
+w 0x10007980
+w 0x10000940
+r 0x100043c0
+w 0x1000ad80
+r 0x1013cac0
+r 0x10002940
+r 0x100042c0
+r 0x1000fc80
+r 0x100002c0
+w 0x10000780
+w 0x10003ec0
+r 0x1085b240
+r 0x10006f80
+r 0x10009300
+r 0x1000c4c0
+r 0x100008c0
+r 0x10007500
+r 0x1000eb40
+r 0x1000cdc0
+r 0x1000ff40
+r 0x10008e40
+w 0x10008c00
+w 0x10007100
+r 0x109f36c0
+r 0x1000b780
+r 0x10001e00
+w 0x1000d180
+r 0x10004b00
+w 0x1000bcc0
+r 0x10000600
+r 0x10000d40
+r 0x1000d640
+r 0x10007c40
+r 0x100088c0
+r 0x10006600
+r 0x10003f80
+r 0x100066c0
+r 0x1000c300
+r 0x1000b540
+w 0x10007200
+r 0x1000c980
+r 0x1000c500
+r 0x1000c040
+w 0x10003840
+r 0x1000dcc0
+w 0x10008900
+w 0x10000b40
+r 0x100051c0
+w 0x10002500
+w 0x1000d900
+r 0x10bfaa80
+r 0x100040c0
+r 0x10eaba80
+r 0x10009900
+r 0x10005340
+w 0x10001740
+r 0x10caf380
+r 0x1000f800
+r 0x10006b80
+w 0x1000ce40
+r 0x1000d500
+r 0x1000f400
+r 0x10003740
+r 0x10006040
+r 0x10006dc0
+r 0x10008100
+r 0x1000b780
+r 0x1036ba00
+r 0x1000d4c0
+r 0x100041c0
+r 0x10000e00
+r 0x10003f80
+r 0x1000bd80
+r 0x10006140
+r 0x10005980
+w 0x10007800
+r 0x1000a5c0
+r 0x10002900
+r 0x10004980
+r 0x10007fc0
+w 0x1000b900
+r 0x10000100
+w 0x108e4fc0
+r 0x10ca90c0
+w 0x1000a300
+r 0x1000e880
+w 0x1000d880
+r 0x1000c980
+r 0x10006680
+r 0x10377c80
+r 0x1000b700
+r 0x1000f0c0
+r 0x10001280
+r 0x10001a80
+r 0x10009c80
+w 0x1000fd40
+r 0x1000e440
+r 0x10009400
+r 0x10002800
+r 0x100083c0
+w 0x10003d00
+r 0x1000a280
+r 0x10002340
+r 0x10001680
+r 0x10009100
+r 0x1000f9c0
+r 0x10002400
+r 0x10004000
+w 0x10003780
+r 0x1000f000
+r 0x10009a80
+r 0x1000e2c0
+r 0x10000980
+r 0x10005f00
+r 0x100089c0
+r 0x10007300
+r 0x10001a80
+r 0x10003b00
+r 0x1000b480
+r 0x10008b40
+r 0x1000c400
+r 0x10006c40
+r 0x10002800
+r 0x1000e180
+r 0x1000ff80
+r 0x100079c0
+r 0x100021c0
+r 0x10005e80
+r 0x1000d800
+r 0x1000aec0
+r 0x10000040
+r 0x10007b40
+r 0x10004b00
+r 0x10001080
+r 0x1000fb00
+r 0x10004900
+w 0x1000f5c0
+w 0x1000c680
+w 0x100004c0
+r 0x100015c0
+r 0x1000ec80
+r 0x1000ffc0
+r 0x1000b3c0
+r 0x10004f80
+r 0x10005500
+r 0x10003080
+r 0x1000e080
+r 0x10004f40
+r 0x10004140
+r 0x1000ee40
+r 0x10004580
+r 0x100069c0
+r 0x1000e2c0
+w 0x1000c380
+w 0x10003040
+r 0x10000580
+w 0x1000ee80
+r 0x100054c0
+r 0x10008780
+r 0x1000ab80
+r 0x1000fb00
+r 0x1000f300
+r 0x10000f40
+r 0x10001600
+r 0x100008c0
+r 0x1000c480
+w 0x10002780
+r 0x100084c0
+r 0x100c6f00
+r 0x10006300
+r 0x10b2a480
+r 0x1000f100
+r 0x1000bd40
+w 0x10009940
+r 0x1000dec0
+w 0x100016c0
+w 0x10002080
+r 0x100072c0
+w 0x10005d40
+r 0x100005c0
+r 0x100084c0
+w 0x10007a00
+r 0x10009b80
+r 0x1000fe40
+w 0x100052c0
+r 0x100037c0
+r 0x100083c0
+r 0x1000ae40
+w 0x1000b140
+r 0x10009600
+r 0x10003580
+r 0x1000e080
+r 0x10002900
+w 0x100039c0
+r 0x100073c0
+w 0x1000e6c0
+r 0x10002640
+r 0x10001940
+w 0x100044c0
+r 0x10004f00
+w 0x10009680
+w 0x1000d480
+r 0x10007a80
+r 0x1000d8c0
+r 0x10008b40
+r 0x10009d00
+r 0x10002c80
+r 0x1000f200
+r 0x1000e980
+r 0x105c4900
+r 0x1000bc40
+r 0x1000e440
+r 0x100035c0
+r 0x1000ba00
+r 0x10f58080
+w 0x10cfc700
+r 0x10007f80
+r 0x10c52780
+r 0x10001b40
+r 0x10006800
+r 0x10000c00
+r 0x10001240
+r 0x10007f00
+r 0x10005f80
+r 0x1000dc40
+r 0x10009c40
+r 0x100098c0
+r 0x1000ac40
+r 0x1000ec40
+r 0x10006880
+r 0x1000eb80
+r 0x1056e2c0
+r 0x10009c40
+r 0x10006640
+r 0x1000d340
+r 0x10000bc0
+w 0x1000de80
+r 0x1000dfc0
+r 0x10006540
+r 0x10a556c0
+r 0x10002600
+r 0x1000d340
+r 0x10003240
+r 0x10000780
+r 0x10003d40
+r 0x1000d580
+r 0x10240d80
+r 0x10000980
+r 0x1051ce80
+r 0x100096c0
+r 0x108ad3c0
+r 0x10003880
+r 0x10005340
+r 0x10000f40
+r 0x10008380
+r 0x10003a80
+r 0x100067c0
+r 0x10006240
+w 0x1000d9c0
+r 0x10003580
+w 0x1000c0c0
+r 0x1000d440
+r 0x10005600
+r 0x1000a3c0
+r 0x1000fc40
+r 0x100017c0
+r 0x1000c500
+r 0x10003b40
+r 0x10000280
+r 0x10008100
+w 0x10003c40
+r 0x10006b80
+r 0x1000f8c0
+r 0x10005400
+r 0x10244b80
+r 0x1000c440
+r 0x10007e80
+r 0x10001080
+r 0x1000ae00
+r 0x1000c380
+w 0x10478000
+w 0x106755c0
+r 0x10008b80
+w 0x10009e00
+w 0x10004740
+r 0x1000f980
+w 0x10006580
+r 0x1072ef40
+r 0x1000ca80
+r 0x10001cc0
+r 0x100020c0
+r 0x1000c9c0
+r 0x10002700
+r 0x1000b740
+r 0x10009480
+r 0x1000f380
+r 0x10008400
+r 0x10577b00
+r 0x1000ed80
+r 0x1000b280
+r 0x1000cec0
+r 0x100007c0
+r 0x1000c300
+r 0x10003940
+r 0x1000cd80
+r 0x10800fc0
+r 0x1045fc00
+r 0x100081c0
+w 0x10005b00
+r 0x10008280
+r 0x1000f800
+r 0x10008580
+r 0x10006280
+r 0x10006100
+r 0x10007100
+r 0x1000e9c0
+r 0x10009880
+r 0x1000b100
+r 0x10006840
+r 0x1000ba80
+r 0x10004240
+r 0x10008580
+w 0x10004e00
+w 0x10000200
+w 0x1000e400
+w 0x10a89a00
+r 0x10000200
+r 0x10002040
+r 0x1000b500
+w 0x1000af80
+r 0x100055c0
+r 0x100044c0
+r 0x10c455c0
+r 0x10003f80
+w 0x10de1440
+r 0x1000c940
+r 0x1000f140
+r 0x1000d040
+r 0x10003d40
+r 0x1000f380
+w 0x10002640
+r 0x10007e00
+r 0x1000c140
+r 0x1000c700
+r 0x1000c740
+r 0x10005040
+w 0x100016c0
+r 0x1000d3c0
+r 0x10001b40
+r 0x10000240
+r 0x1000e3c0
+r 0x10008fc0
+r 0x10002b00
+r 0x10004c80
+r 0x1000f880
+r 0x1000a040
+r 0x1000cf40
+r 0x10005e00
+r 0x1000e340
+r 0x1000bd00
+r 0x10006340
+r 0x1000d740
+r 0x10344d40
+r 0x10006dc0
+r 0x10869740
+r 0x1000e800
+r 0x10168400
+r 0x1000de40
+r 0x1000f180
+r 0x10001140
+r 0x10003680
+r 0x1000fe40
+r 0x10000400
+r 0x10001980
+r 0x10001e40
+w 0x1000fa80
+r 0x1000cac0
+r 0x10006f40
+w 0x1000f640
+r 0x10003640
+r 0x1000b080
+r 0x10000700
+r 0x1000bf00
+w 0x105485c0
+r 0x10003b80
+r 0x10007940
+r 0x1000f340
+r 0x10009dc0
+r 0x10008cc0
+r 0x1000a680
+w 0x10931040
+r 0x100084c0
+r 0x10005d00
+r 0x10a86000
+w 0x1000c980
+r 0x10009700
+r 0x1000d9c0
+r 0x10008e40
+r 0x1000e0c0
+r 0x10004980
+r 0x100007c0
+r 0x1000dc80
+r 0x10002080
+r 0x1000db80
+r 0x10000140
+r 0x10008200
+r 0x10009940
+r 0x10b56e00
+w 0x10008100
+r 0x1000ef00
+r 0x10005400
+r 0x1048b980
+r 0x1000b6c0
+r 0x100069c0
+r 0x105cd200
+r 0x1000e600
+r 0x10004b80
+r 0x10001c00
+r 0x1000cb80
+r 0x1000dc40
+r 0x1000b0c0
+w 0x1000c680
+r 0x10006c00
+r 0x1000be00
+r 0x10004780
+r 0x1000c6c0
+r 0x10bb5580
+r 0x10005480
+r 0x10001b00
+r 0x10003740
+r 0x10004580
+r 0x100072c0
+r 0x100035c0
+w 0x10006ec0
+r 0x106bbdc0
+r 0x100062c0
+r 0x10230c00
+w 0x1000ef80
+r 0x1000cbc0
+r 0x10003680
+w 0x10004880
+w 0x10000800
+w 0x10003dc0
+r 0x1000ac80
+r 0x10008d00
+r 0x1000aa40
+r 0x10009180
+r 0x10008e80
+r 0x10006b00
+r 0x100065c0
+r 0x10004a40
+w 0x1000d180
+r 0x10000040
+r 0x1000f980
+r 0x10006300
+r 0x1000c240
+w 0x10005280
+w 0x107fb880
+w 0x10008400
+r 0x1000b0c0
+r 0x1000db00
+w 0x1000d580
+r 0x10005780
+r 0x10000cc0
+w 0x10000040
+r 0x10736780
+r 0x10003ac0
+r 0x1000fa00
+r 0x1000dd80
+r 0x1000a280
+r 0x1000f400
+w 0x1000ab80
+r 0x10003780
+r 0x100054c0
+r 0x10009340
+r 0x1000db80
+r 0x10004f80
+w 0x1000a3c0
+w 0x1000b9c0
+r 0x1000de40
+r 0x10006d80
+r 0x1000dc80
+r 0x1000d740
+r 0x1000dec0
+w 0x1000e540
+r 0x10002e00
+r 0x1000a200
+r 0x10002680
+r 0x1000a480
+r 0x1000a340
+r 0x10009180
+r 0x10002dc0
+w 0x10006940
+r 0x10000980
+w 0x10009f00
+w 0x10003a80
+r 0x10008a80
+r 0x10006000
+r 0x10006dc0
+r 0x1000e880
+r 0x10004cc0
+r 0x10002f80
+r 0x10007440
+r 0x1000d8c0
+w 0x10003380
+r 0x100093c0
+r 0x100032c0
+r 0x109c5bc0
+r 0x10001d80
+r 0x10001a80
+r 0x1000dd80
+w 0x10007000
+r 0x10008b40
+r 0x1000cfc0
+r 0x10005a80
+w 0x1000a900
+r 0x10000380
+w 0x10001f00
+w 0x10007840
+w 0x100083c0
+r 0x10003640
+w 0x10001600
+r 0x10009680
+r 0x1000d900
+r 0x10009b80
+r 0x107a9d80
+r 0x1000db80
+r 0x10000740
+r 0x1000d000
+w 0x100090c0
+r 0x1000e340
+r 0x10000940
+r 0x10369fc0
+w 0x10008940
+r 0x1000e340
+r 0x1000db80
+r 0x100047c0
+r 0x10548480
+r 0x100049c0
+r 0x1000f5c0
+w 0x1000bc00
+r 0x10003bc0
+w 0x1000ce80
+r 0x1000a8c0
+r 0x1000f9c0
+r 0x1000bec0
+r 0x10002a80
+w 0x1000f5c0
+r 0x10003640
+r 0x10009540
+r 0x1000ec00
+r 0x10007d40
+r 0x1000d480
+w 0x1000e380
+r 0x10002c80
+r 0x10002cc0
+r 0x1000cc00
+r 0x10002e00
+r 0x1000d780
+r 0x1000d680
+r 0x10d1a200
+r 0x10002240
+r 0x1000c500
+r 0x1000a400
+r 0x10002a40
+w 0x10111b80
+r 0x1000b740
+w 0x1000df40
+r 0x10000c40
+r 0x1000ef80
+r 0x10006a80
+r 0x10002f00
+r 0x1000d0c0
+r 0x10008e00
+r 0x100006c0
+r 0x1000c340
+r 0x10002240
+r 0x1000bdc0
+r 0x100019c0
+w 0x10007c00
+r 0x1000e600
+r 0x100076c0
+r 0x1000f680
+r 0x10002d40
+r 0x10001040
+w 0x106c0a40
+r 0x1000f9c0
+r 0x10006bc0
+r 0x10000740
+r 0x10002b80
+r 0x10005d80
+r 0x10000b40
+r 0x10007ec0
+r 0x1000d8c0
+r 0x10008740
+w 0x100088c0
+r 0x10003b00
+w 0x10002b80
+r 0x1000ce80
+r 0x10000f80
+r 0x1000fe80
+r 0x1000f380
+w 0x1000d9c0
+r 0x10000500
+r 0x1000d6c0
+r 0x10005d80
+r 0x10001340
+r 0x10000d40
+w 0x1000b440
+r 0x10003d80
+r 0x10007bc0
+r 0x10000ec0
+r 0x1000ae40
+r 0x10004540
+r 0x1000ed80
+w 0x1000a280
+r 0x10004800
+r 0x1000d680
+w 0x1000a700
+r 0x10008200
+r 0x1000c380
+r 0x10007780
+r 0x1000ba80
+r 0x10004a80
+r 0x10fa7ac0
+r 0x1000a240
+w 0x10000440
+r 0x1000a680
+r 0x10004540
+w 0x10692900
+w 0x1000c740
+r 0x10007c80
+r 0x10006c00
+r 0x10a8edc0
+r 0x10008dc0
+r 0x10c313c0
+r 0x10001700
+r 0x1000c280
+r 0x100099c0
+r 0x10006c80
+r 0x1000b8c0
+r 0x1000d280
+w 0x1000c7c0
+r 0x1000c700
+r 0x10004280
+r 0x10001d40
+r 0x10002ec0
+r 0x1000a600
+r 0x10007f00
+r 0x10009f80
+r 0x1000b400
+r 0x1000c180
+r 0x1000d9c0
+r 0x100032c0
+r 0x1000a9c0
+r 0x10008d80
+r 0x1000d180
+r 0x100075c0
+r 0x1000ad40
+w 0x10005d80
+r 0x10ac4bc0
+w 0x10002840
+w 0x10002e40
+r 0x1000c880
+r 0x1000ea00
+r 0x1000e400
+r 0x10009d80
+r 0x10004040
+w 0x1000a100
+r 0x10002b40
+r 0x1000a500
+r 0x10002cc0
+r 0x1000a180
+w 0x10001b80
+w 0x10009740
+r 0x100012c0
+r 0x10001480
+r 0x1000bf80
+r 0x10002e80
+r 0x10003180
+r 0x10007f40
+w 0x10003900
+w 0x10003700
+r 0x1000a9c0
+r 0x1000a700
+r 0x1000ee40
+r 0x10979700
+r 0x100017c0
+r 0x10005cc0
+w 0x10003a40
+w 0x10001180
+w 0x10006400
+w 0x10007a80
+r 0x1000f3c0
+r 0x10007700
+r 0x100039c0
+w 0x1000b500
+r 0x10009600
+r 0x1000c500
+r 0x10000380
+r 0x1000b580
+r 0x1000b140
+r 0x100035c0
+r 0x10aad440
+r 0x10182bc0
+r 0x10d22680
+r 0x10008200
+r 0x1000acc0
+r 0x10004080
+r 0x10004080
+r 0x1000e0c0
+r 0x10008d80
+r 0x1000ff80
+r 0x1000a100
+r 0x100070c0
+r 0x10001b40
+w 0x10005e00
+r 0x100099c0
+w 0x10002d00
+r 0x1000ba40
+r 0x10005640
+r 0x1000b640
+r 0x1000ea80
+w 0x10ebf480
+r 0x1000eb80
+r 0x100032c0
+r 0x1000ddc0
+r 0x10001d40
+r 0x10009240
+w 0x10004440
+r 0x1000db40
+r 0x1000a480
+r 0x109d7600
+r 0x10002d00
+w 0x10005c00
+r 0x10004a80
+w 0x10001d40
+r 0x10347500
+r 0x1070c1c0
+r 0x10009c40
+r 0x10000ac0
+w 0x1000cc80
+r 0x1000f8c0
+w 0x100049c0
+r 0x10001d80
+r 0x1000b100
+r 0x1000c800
+r 0x10008500
+r 0x10681b80
+r 0x10005140
+r 0x10000100
+r 0x1000b500
+w 0x1000f980
+r 0x1000d2c0
+r 0x1000c180
+w 0x1000a880
+r 0x100072c0
+r 0x1000f000
+r 0x100072c0
+r 0x10009b00
+r 0x100014c0
+r 0x10009300
+r 0x10009a00
+w 0x10127dc0
+r 0x10005d80
+r 0x1000e640
+r 0x10006100
+r 0x101bfac0
+r 0x1000cf80
+r 0x10000900
+w 0x10003380
+r 0x10005ec0
+r 0x1000c0c0
+r 0x10009d00
+r 0x10008d80
+r 0x10002200
+r 0x10009100
+r 0x1000a580
+r 0x1000ce40
+w 0x10006640
+r 0x1000bf80
+r 0x1000aa80
+r 0x10008d00
+r 0x10009c80
+r 0x10000cc0
+r 0x10009080
+r 0x1000dec0
+w 0x10c68fc0
+r 0x1000d780
+r 0x100074c0
+r 0x100050c0
+w 0x100053c0
+r 0x10005e40
+r 0x10000b80
+r 0x100057c0
+r 0x1000f4c0
+r 0x10004900
+r 0x1000ed80
+r 0x10005e80
+r 0x10004cc0
+r 0x100030c0
+r 0x10000340
+w 0x1000dc40
+r 0x1000cc00
+r 0x10004a40
+r 0x10008140
+r 0x10001580
+r 0x10004540
+r 0x1000b3c0
+r 0x10002b00
+w 0x10007040
+r 0x10003300
+r 0x106c0300
+r 0x10001fc0
+w 0x10007b00
+r 0x100061c0
+r 0x10005b00
+r 0x10000300
+r 0x10cc5540
+r 0x100062c0
+w 0x10b35340
+r 0x10000280
+r 0x10000180
+r 0x1000ac80
+r 0x10007880
+w 0x10002a00
+r 0x10008900
+r 0x10005c80
+r 0x1000cb80
+w 0x1000c8c0
+r 0x1000b440
+r 0x10009700
+r 0x10009380
+r 0x10004ec0
+r 0x100071c0
+r 0x10206740
+r 0x1000a100
+r 0x10007040
+r 0x10000ec0
+r 0x100044c0
+r 0x10008640
+r 0x10006c00
+r 0x10000c40
+r 0x10008280
+w 0x1000ca00
+r 0x10006fc0
+r 0x1000aa40
+r 0x1000e380
+r 0x10000bc0
+r 0x10001e00
+r 0x10001140
+r 0x1000f0c0
+r 0x1000af80
+r 0x1000b100
+w 0x10003640
+r 0x1000b800
+r 0x100027c0
+r 0x1000dd80
+w 0x1000fa00
+r 0x1000f540
+r 0x1000d8c0
+r 0x109815c0
+w 0x1000e840
+w 0x101d3740
+r 0x10009a40
+w 0x1000ac40
+r 0x1000f440
+w 0x100074c0
+r 0x1000ef00
+r 0x10008b00
+w 0x1000d080
+r 0x10002dc0
+r 0x103ce100
+r 0x10001e80
+r 0x100065c0
+r 0x10009640
+r 0x10004a80
+r 0x10001fc0
+w 0x10005cc0
+r 0x1000ef80
+r 0x1000d580
+r 0x10001900
+r 0x1000cf40
+r 0x10000300
+r 0x10006500
+r 0x10007400
+r 0x1000dd40
+r 0x10004800
+w 0x1000fac0
+w 0x10e1fa80
+r 0x1000e2c0
+r 0x100020c0
+r 0x1000e340
+r 0x100098c0
+r 0x10002040
+r 0x10002700
+r 0x1000d800
+r 0x1000b180
+r 0x10002500
+r 0x100046c0
+r 0x10001cc0
+r 0x1000d540
+r 0x1000b500
+r 0x100058c0
+r 0x1000a500
+w 0x100099c0
+r 0x100058c0
+r 0x10006b40
+r 0x100048c0
+r 0x1000d280
+r 0x10008500
+r 0x10003380
+r 0x10007280
+r 0x1000f240
+r 0x1000c880
+w 0x1000ca00
+r 0x10003b00
+r 0x10005080
+r 0x10001440
+r 0x100061c0
+w 0x1000f6c0
+r 0x10001c80
+r 0x100021c0
+r 0x10007ec0
+w 0x100075c0
+r 0x10006840
+r 0x1000f400
+r 0x10000f80
+r 0x10003f40
+r 0x10003940
+r 0x1000a0c0
+w 0x1000dc40
+r 0x10006440
+r 0x100033c0
+r 0x10006b40
+r 0x10003880
+r 0x10009100
+r 0x100021c0
+r 0x10007900
+r 0x10005240
+r 0x1000c140
+w 0x10009140
+w 0x1000f680
+r 0x10f513c0
+r 0x10002640
+r 0x10008980
+r 0x1000f600
+r 0x10008980
+r 0x10002380
+r 0x1000e5c0
+w 0x1000c780
+w 0x10ee8c00
+r 0x10005a40
+w 0x10005500
+r 0x1000ed00
+w 0x10007b40
+r 0x10004340
+r 0x10005a00
+r 0x1000edc0
+w 0x1000c900
+r 0x10009b80
+w 0x10007280
+r 0x107098c0
+r 0x10008600
+r 0x1000ae00
+r 0x1000a880
+r 0x10005040
+r 0x1000ef40
+r 0x1000ce40
+r 0x10003f80
+r 0x1000c740
+w 0x10000200
+r 0x10007600
+r 0x10006ec0
+r 0x1000b3c0
+w 0x107dd480
+r 0x1089d280
+r 0x1000c100
+r 0x1000da40
+w 0x105e2a40
+r 0x10008780
+r 0x1000c680
+r 0x10008600
+w 0x1000b680
+r 0x1000a140
+r 0x10006900
+w 0x10004dc0
+r 0x1000fd80
+r 0x10002780
+r 0x109f7c80
+r 0x1000dd40
+w 0x1000bd40
+r 0x1000b200
+r 0x100075c0
+r 0x10002380
+r 0x10004d00
+r 0x1000c840
+r 0x10000280
+r 0x10006e40
+w 0x1000b8c0
+r 0x1000a080
+r 0x1000d4c0
+r 0x10003f80
+r 0x1000e080
+r 0x1000bdc0
+r 0x10005d00
+w 0x100066c0
+r 0x1000acc0
+r 0x10009c80
+w 0x10005b40
+w 0x100099c0
+r 0x1000e300
+r 0x10007580
+w 0x100068c0
+r 0x1000e840
+r 0x10003a40
+r 0x1000c4c0
+r 0x1000bb80
+w 0x100026c0
+w 0x10003100
+r 0x1064c840
+r 0x10008a80
+r 0x10000b40
+r 0x1000d140
+w 0x10001040
+r 0x1000b580
+r 0x100038c0
+r 0x10009940
+w 0x1000de00
+r 0x10007440
+r 0x1000b500
+r 0x10009f80
+r 0x100006c0
+r 0x10004140
+w 0x10425dc0
+r 0x100055c0
+r 0x1000e640
+r 0x10009140
+r 0x1000a040
+r 0x103a0c00
+w 0x1000b680
+w 0x100096c0
+r 0x10008e40
+r 0x10003180
+r 0x1000ea40
+r 0x10003640
+r 0x10001880
+r 0x1000e6c0
+r 0x104e6000
+r 0x10000080
+r 0x10009a80
+r 0x10005940
+r 0x10004b40
+w 0x10005ac0
+r 0x1000cb40
+w 0x10004e80
+w 0x10001380
+w 0x10004d40
+r 0x1000c940
+r 0x10006680
+r 0x10002340
+r 0x10008040
+r 0x10007440
+w 0x10000d80
+r 0x100088c0
+r 0x10009980
+r 0x10005940
+w 0x1000a000
+r 0x10861580
+w 0x1000fd80
+r 0x10007400
+w 0x1000aec0
+r 0x10009b00
+r 0x10008700
+r 0x1000d400
+r 0x100051c0
+r 0x1000ca80
+r 0x10004140
+r 0x10008600
+w 0x10007cc0
+r 0x1000b8c0
+r 0x1000d1c0
+r 0x1000b940
+r 0x1000c100
+r 0x1000c3c0
+w 0x10006100
+w 0x1000a340
+r 0x10005dc0
+r 0x10003d80
+r 0x10005080
+r 0x1000e500
+r 0x1000f8c0
+w 0x1000df40
+w 0x100000c0
+r 0x10008800
+r 0x10007140
+r 0x10009280
+r 0x1000ed80
+r 0x1000b3c0
+r 0x1000f100
+r 0x10001740
+w 0x1000e800
+r 0x10009e00
+r 0x10008e80
+w 0x1000e180
+r 0x1000f840
+w 0x10005880
+r 0x10003300
+r 0x10009f00
+w 0x1000c700
+r 0x100088c0
+r 0x1068b4c0
+r 0x10007f40
+r 0x10a84dc0
+r 0x10001d40
+r 0x1000e540
+r 0x10008980
+w 0x10003f00
+r 0x1028ac00
+r 0x100013c0
+w 0x10000640
+r 0x10003a40
+r 0x1000fa80
+r 0x10004f80
+w 0x10002300
+r 0x1000e340
+r 0x10008b40
+r 0x10000340
+r 0x1000ab00
+r 0x10006940
+r 0x10008880
+r 0x100009c0
+r 0x10ca8680
+r 0x1000dfc0
+w 0x1000f280
+r 0x1000bb80
+r 0x1058f200
+r 0x1000b780
+r 0x10009340
+r 0x10009900
+r 0x100097c0
+r 0x10000c00
+w 0x1000c680
+w 0x10000b40
+w 0x1000ac40
+r 0x1000bb80
+r 0x1000bb00
+r 0x100024c0
+r 0x1000c600
+r 0x10003440
+w 0x1000f6c0
+r 0x1000e180
+r 0x10008b00
+r 0x10005300
+r 0x10003800
+r 0x108e5200
+r 0x10008d80
+r 0x1000da80
+r 0x10006980
+r 0x1000a940
+w 0x10001500
+r 0x100048c0
+r 0x1000f1c0
+r 0x10007c80
+r 0x1000a240
+r 0x1000a900
+r 0x10000940
+r 0x1000a6c0
+r 0x10007080
+r 0x1000a680
+r 0x10009400
+w 0x10003ac0
+r 0x103ae580
+r 0x1000abc0
+r 0x10003ac0
+r 0x1000e800
+r 0x10002800
+r 0x100006c0
+r 0x10004740
+w 0x103bdd00
+r 0x10008f00
+r 0x10009a80
+r 0x1000c8c0
+r 0x10004880
+r 0x1000aa00
+r 0x10d387c0
+w 0x10001940
+r 0x100083c0
+r 0x1000e000
+r 0x1000e080
+r 0x10007e40
+w 0x10003f00
+r 0x1000a2c0
+r 0x1000f080
+r 0x100027c0
+r 0x1000fe00
+r 0x1000b0c0
+r 0x10009340
+r 0x1052b080
+w 0x100021c0
+r 0x10009ec0
+r 0x10008940
+w 0x10972180
+r 0x1000f080
+r 0x105255c0
+r 0x1000e400
+r 0x1000e1c0
+r 0x10009d80
+r 0x10000e80
+r 0x10009a00
+r 0x1000d640
+r 0x1000e180
+r 0x10008740
+w 0x10003300
+r 0x1000e840
+r 0x10008940
+r 0x1000a000
+r 0x10001dc0
+r 0x1000b040
+r 0x100c7f80
+r 0x10000940
+r 0x10001d00
+r 0x10007500
+r 0x10000f40
+r 0x100006c0
+r 0x10005980
+w 0x10000040
+r 0x10005680
+r 0x1000fd80
+r 0x10004780
+r 0x1000bc40
+r 0x10003040
+r 0x10000d80
+r 0x1000da00
+r 0x10005000
+r 0x10002840
+r 0x10295780
+r 0x1000e780
+r 0x10007600
+r 0x10002280
+w 0x100085c0
+w 0x10004f40
+r 0x10006480
+r 0x100027c0
+r 0x100091c0
+r 0x10008300
+r 0x10006700
+r 0x10000900
+r 0x1000ce00
+r 0x10000e80
+r 0x10009540
+r 0x10002d40
+r 0x1000a7c0
+r 0x1000be40
+r 0x1000a2c0
+w 0x10006940
+w 0x10003580
+w 0x1000be00
+w 0x1000d640
+w 0x10004b00
+w 0x1000bd80
+r 0x10004c40
+r 0x1000ec00
+r 0x1000d140
+r 0x10000a80
+r 0x1000ad00
+r 0x1000edc0
+w 0x10003f40
+r 0x10008a80
+r 0x10001340
+r 0x10004ec0
+r 0x10006a40
+w 0x10005100
+r 0x10fcd700
+r 0x10000b80
+r 0x10004ac0
+r 0x1000c7c0
+r 0x10001280
+w 0x100006c0
+r 0x100061c0
+w 0x1000cf40
+r 0x10007240
+r 0x10004540
+r 0x1000c380
+r 0x10d77380
+r 0x1000a140
+r 0x10005200
+w 0x10001980
+r 0x1000e340
+r 0x10007040
+r 0x1000c000
+r 0x10005300
+r 0x10009980
+w 0x1000fbc0
+r 0x10009880
+w 0x10009d40
+r 0x1000dc40
+r 0x10c35c80
+r 0x10001600
+r 0x1000c240
+r 0x1000c2c0
+w 0x100007c0
+r 0x10d7b580
+r 0x10434700
+r 0x10001340
+r 0x10009980
+r 0x1000f740
+r 0x10007300
+r 0x10002a00
+r 0x100069c0
+r 0x102c5900
+r 0x1000c980
+r 0x1000d200
+r 0x100029c0
+r 0x10008040
+r 0x1000f200
+r 0x10006a00
+r 0x10003a00
+r 0x1000a1c0
+r 0x10000f00
+w 0x100089c0
+r 0x10002400
+r 0x10006980
+r 0x1000a840
+r 0x100055c0
+w 0x100046c0
+w 0x10009a40
+w 0x10002600
+r 0x10001b80
+r 0x1000fe40
+r 0x1000b180
+r 0x100052c0
+r 0x10409c00
+r 0x10000d40
+r 0x10007f00
+r 0x10003240
+r 0x1000e000
+r 0x1000e140
+r 0x10004880
+r 0x10f05ec0
+r 0x1000ac40
+w 0x100024c0
+r 0x10004a40
+w 0x1000b3c0
+r 0x10005500
+r 0x10000680
+r 0x100096c0
+r 0x1000b1c0
+r 0x10008e00
+r 0x100007c0
+r 0x10003580
+r 0x10001280
+r 0x10006cc0
+r 0x10003580
+r 0x107220c0
+w 0x1000bf00
+w 0x1000a580
+r 0x10001580
+r 0x100c1200
+r 0x10009ac0
+w 0x10007bc0
+r 0x10009d00
+r 0x1000b080
+w 0x10005bc0
+r 0x1000f700
+r 0x10003e80
+r 0x1000f840
+r 0x10002000
+r 0x10001640
+w 0x10008600
+w 0x10008340
+r 0x100058c0
+r 0x10005b80
+r 0x103e7280
+r 0x1000a540
+r 0x100018c0
+w 0x1000aa40
+r 0x1065f1c0
+w 0x10002240
+w 0x10003b00
+r 0x1000f300
+r 0x10009a00
+r 0x109747c0
+r 0x10007f40
+w 0x10009640
+r 0x1000da00
+r 0x1000d800
+r 0x10007e80
+r 0x1000e880
+r 0x1000ff00
+w 0x10006c80
+w 0x10008200
+w 0x10002440
+r 0x10007c80
+r 0x10002d40
+r 0x100042c0
+r 0x1000cfc0
+r 0x100082c0
+r 0x101741c0
+r 0x1000fa80
+r 0x10002e80
+r 0x10000f40
+r 0x1000a240
+r 0x10008c00
+r 0x100089c0
+r 0x100071c0
+r 0x100034c0
+w 0x1000b440
+w 0x10000f80
+w 0x100075c0
+r 0x1000b400
+r 0x10007d40
+r 0x1000fb80
+r 0x10008c80
+w 0x10008340
+r 0x10000c40
+r 0x100054c0
+r 0x10008700
+w 0x100005c0
+w 0x10004580
+r 0x10004240
+w 0x1000e100
+r 0x10005f80
+r 0x10be8800
+r 0x10001780
+r 0x100018c0
+w 0x1000bb80
+w 0x1000b140
+r 0x10003740
+r 0x10004840
+r 0x10008a80
+r 0x1000e240
+r 0x10001980
+r 0x10003f80
+r 0x1000d800
+r 0x100007c0
+r 0x10004740
+r 0x10003240
+r 0x100088c0
+r 0x10003680
+w 0x10002fc0
+r 0x1000fec0
+r 0x1000d640
+r 0x10006e80
+r 0x1000b780
+r 0x10000d40
+r 0x1000a480
+r 0x10003e00
+w 0x100011c0
+r 0x1000c0c0
+r 0x10007900
+r 0x1000b200
+w 0x10008a80
+r 0x1000c880
+r 0x1000edc0
+r 0x10006d40
+w 0x1000b2c0
+r 0x10005500
+r 0x103b45c0
+r 0x1000df80
+r 0x10001940
+r 0x10009d00
+r 0x1000a600
+r 0x10003d40
+r 0x10008400
+r 0x10004cc0
+w 0x10003fc0
+r 0x1000e740
+w 0x1000b7c0
+r 0x1000ea00
+r 0x10006080
+r 0x1000ed80
+r 0x10001300
+w 0x1000a300
+r 0x10002880
+r 0x10004780
+r 0x1000b280
+r 0x100045c0
+r 0x1000a640
+r 0x10007d40
+r 0x10007a00
+r 0x1000cb40
+r 0x10005700
+r 0x1000cb80
+r 0x10005540
+r 0x10007c40
+r 0x1000b540
+r 0x1000fd40
+r 0x10771d80
+r 0x1000d000
+r 0x1000e080
+r 0x1000dd40
+r 0x10006b80
+r 0x1014ec80
+r 0x1000fa80
+r 0x1000bdc0
+w 0x1082f2c0
+w 0x1000ffc0
+r 0x10e12b40
+r 0x10003cc0
+r 0x1000d080
+r 0x1000ef00
+r 0x10006440
+r 0x10008480
+r 0x10007400
+r 0x10003e00
+w 0x10000880
+r 0x10005a40
+w 0x1000bcc0
+r 0x1000c2c0
+r 0x1000c800
+r 0x10e0a880
+r 0x1000f040
+r 0x10003800
+r 0x10006d80
+r 0x100045c0
+r 0x10006c80
+r 0x100047c0
+r 0x1000eac0
+w 0x10000dc0
+w 0x100085c0
+r 0x104b9580
+r 0x1000fe00
+w 0x1000ebc0
+r 0x10007080
+r 0x10001b40
+r 0x10007140
+r 0x10002780
+r 0x10004640
+r 0x1000ba80
+r 0x1000a040
+r 0x100050c0
+r 0x1000a080
+r 0x10008200
+w 0x10005940
+w 0x10007b80
+r 0x1000c7c0
+w 0x10007340
+r 0x1000dac0
+r 0x100054c0
+r 0x100067c0
+r 0x1000cf00
+r 0x10006b80
+r 0x10cf3fc0
+r 0x1000d540
+r 0x1000ec80
+w 0x1000ba80
+r 0x1000f100
+w 0x10008e00
+r 0x10005480
+r 0x1000bc80
+r 0x10af3cc0
+r 0x100fc740
+r 0x109c9480
+w 0x10007200
+w 0x100091c0
+w 0x10000b80
+r 0x10002240
+r 0x10008700
+w 0x10006a80
+r 0x10f91440
+r 0x100011c0
+r 0x1000ed80
+r 0x1000d4c0
+r 0x10007140
+r 0x10007c00
+r 0x100040c0
+r 0x100011c0
+r 0x10008e80
+r 0x10003b00
+r 0x10009000
+r 0x100002c0
+r 0x1000fdc0
+r 0x1000b240
+r 0x1000c540
+r 0x10004240
+r 0x10009d00
+r 0x10003780
+w 0x10008040
+w 0x10000c00
+r 0x1000dd40
+r 0x1000d940
+r 0x10000580
+r 0x10003d80
+r 0x10004280
+r 0x10002c00
+r 0x1038ae40
+r 0x1023e940
+w 0x10ce02c0
+r 0x1000e740
+w 0x10004e80
+r 0x10008400
+r 0x1082bb40
+r 0x1000ce40
+r 0x1000f440
+w 0x10001e00
+r 0x10004d80
+r 0x10006ec0
+r 0x10000140
+r 0x10005dc0
+w 0x100094c0
+r 0x10007240
+r 0x10005c00
+r 0x1000b3c0
+r 0x10006ec0
+r 0x1000f700
+r 0x10008d40
+r 0x1000e8c0
+r 0x100059c0
+r 0x10004fc0
+r 0x10001480
+w 0x100046c0
+r 0x1000d440
+r 0x1000cd00
+w 0x1000e580
+r 0x1000a8c0
+w 0x1000dfc0
+r 0x1021c340
+r 0x1000efc0
+w 0x1000f780
+r 0x10000a00
+r 0x1000e840
+r 0x100000c0
+r 0x10222700
+r 0x104c9500
+w 0x10121080
+r 0x1004d980
+r 0x101343c0
+w 0x103f1700
+r 0x10148740
+w 0x1001b880
+w 0x10133b40
+w 0x10205080
+r 0x10622ac0
+r 0x1044ed80
+r 0x10235080
+w 0x101fbe40
+w 0x105d9000
+w 0x1064c800
+r 0x101aa7c0
+w 0x1072eec0
+w 0x107c8ec0
+r 0x105edcc0
+w 0x10158040
+w 0x107a2ec0
+r 0x10728c00
+r 0x1068b840
+r 0x10265580
+r 0x105b4e00
+r 0x1009f500
+r 0x103ad280
+w 0x105d22c0
+r 0x105b6300
+r 0x10464180
+r 0x107adec0
+w 0x10663300
+w 0x106bf100
+w 0x10404580
+r 0x106a6600
+r 0x104b6c40
+w 0x10695600
+r 0x10246bc0
+r 0x103de1c0
+w 0x100617c0
+r 0x104d6800
+w 0x101ab5c0
+r 0x107fca80
+r 0x10598bc0
+r 0x1006ca00
+r 0x1062fcc0
+r 0x101e3d00
+w 0x10676ac0
+r 0x104e5300
+r 0x106e4a00
+r 0x103b0740
+w 0x10341f80
+r 0x104d3a80
+w 0x106edbc0
+r 0x1054f5c0
+r 0x106ff100
+r 0x103d59c0
+r 0x101272c0
+r 0x1022f080
+w 0x100126c0
+w 0x100a5200
+r 0x10682700
+r 0x104576c0
+r 0x10549a80
+w 0x1039ba80
+w 0x10142700
+r 0x103fe680
+r 0x10617ac0
+r 0x10629a00
+r 0x10558f40
+w 0x107996c0
+r 0x10367540
+r 0x1060d100
+r 0x10323000
+r 0x10306540
+r 0x107a9780
+r 0x1030a840
+r 0x106eb500
+r 0x105f2bc0
+r 0x10157f00
+r 0x100ae540
+r 0x1023c640
+w 0x106bd580
+r 0x10326040
+r 0x10236500
+w 0x101b49c0
+r 0x10612c80
+r 0x102cbb00
+r 0x10063780
+r 0x1036a240
+r 0x107a3b40
+r 0x1004f680
+r 0x10600c40
+r 0x1034f6c0
+r 0x10668d00
+r 0x10223e40
+r 0x106d5300
+r 0x1028b3c0
+w 0x10089180
+r 0x107b1040
+r 0x1046e300
+r 0x104e5f00
+w 0x1027b7c0
+r 0x105d7580
+w 0x1028f980
+w 0x104dcc00
+w 0x10337a00
+w 0x101cd180
+r 0x10543c40
+w 0x1031ea40
+r 0x1011f440
+w 0x10006380
+r 0x104ca100
+r 0x104c7f80
+r 0x1050e040
+r 0x102ceec0
+r 0x1052c380
+r 0x10793dc0
+r 0x10527f40
+r 0x10338800
+r 0x100c3840
+r 0x107fa900
+r 0x10721b80
+w 0x10003a40
+w 0x1028f780
+w 0x107a9040
+w 0x100613c0
+r 0x104ed200
+r 0x10103980
+w 0x10244e80
+r 0x10256080
+r 0x10521e80
+w 0x101f2080
+r 0x106da100
+r 0x1015b400
+r 0x1009cac0
+r 0x102a5100
+r 0x10223940
+w 0x104a7bc0
+r 0x1049a900
+r 0x105db780
+w 0x10346600
+r 0x1066c980
+r 0x103e1680
+r 0x107b5e00
+r 0x1059b380
+r 0x105440c0
+r 0x100b4440
+w 0x100b5b40
+r 0x10011880
+r 0x1015ac40
+r 0x10572bc0
+r 0x100cbc80
+r 0x1024d3c0
+r 0x1054b380
+w 0x107e9780
+r 0x1036edc0
+r 0x103a5d40
+r 0x10384b40
+r 0x101bc640
+r 0x1033f780
+r 0x107752c0
+w 0x1046f180
+w 0x10636540
+r 0x1016eb00
+w 0x1036be80
+w 0x106b3f80
+r 0x100dfb00
+w 0x1001f700
+w 0x10455a00
+r 0x1014c640
+r 0x1030e840
+r 0x107b7a80
+r 0x10469540
+r 0x101a4dc0
+r 0x107ad100
+w 0x10015140
+r 0x10500440
+w 0x103e6d40
+r 0x10694bc0
+r 0x1051b740
+r 0x10666100
+r 0x105ebec0
+r 0x100a8140
+w 0x1039c440
+w 0x103dba40
+r 0x100fce00
+w 0x105fa640
+w 0x107cbf80
+w 0x106b5500
+w 0x1041bb80
+w 0x103e5840
+r 0x103e9f80
+w 0x102cab00
+w 0x10279640
+r 0x10608ec0
+r 0x1019ab80
+r 0x1015a800
+r 0x10142280
+w 0x107d1380
+r 0x104ed880
+w 0x10395140
+r 0x10077680
+r 0x100396c0
+r 0x10480c40
+w 0x1054be00
+r 0x101b1f80
+r 0x1015ecc0
+r 0x10136e40
+r 0x102f8cc0
+r 0x102b7380
+r 0x106dcd40
+r 0x100b1fc0
+r 0x10059100
+r 0x10161200
+w 0x10504740
+w 0x1048c700
+r 0x1010fa80
+w 0x105d4000
+r 0x1004dd00
+r 0x100daa40
+r 0x1075c4c0
+r 0x1006e800
+r 0x10695280
+r 0x10544c80
+r 0x10090f00
+r 0x10761cc0
+w 0x10609600
+r 0x103835c0
+w 0x105debc0
+r 0x100ad300
+r 0x10653ac0
+r 0x102cc340
+r 0x102ba6c0
+r 0x10025580
+w 0x10662740
+w 0x101fae80
+r 0x10101e40
+r 0x102f7a00
+w 0x100b6140
+r 0x103dca00
+r 0x1066aac0
+r 0x100a1bc0
+w 0x103ffb80
+w 0x100202c0
+w 0x10229980
+r 0x10588a00
+r 0x10580a00
+w 0x106cc740
+r 0x105652c0
+r 0x107ac180
+r 0x101dbc40
+r 0x10124b00
+r 0x102ffa80
+r 0x1039ecc0
+w 0x105efc40
+w 0x1063ebc0
+w 0x103eafc0
+r 0x10299640
+w 0x10286d00
+r 0x102a0800
+r 0x10339cc0
+w 0x102b3c80
+r 0x104ed9c0
+r 0x100f0c00
+r 0x10728080
+r 0x101b0200
+r 0x104a1d00
+r 0x1046cc80
+w 0x10432a40
+r 0x1022c600
+r 0x10120040
+w 0x104ecd80
+w 0x104140c0
+r 0x10156600
+w 0x10688d00
+r 0x104f2b40
+r 0x101a3fc0
+w 0x101fe780
+r 0x103564c0
+r 0x10284ec0
+r 0x1033f980
+r 0x1000d380
+w 0x105d9980
+w 0x10653f00
+r 0x101f1b00
+r 0x10596bc0
+w 0x103cacc0
+r 0x10663080
+r 0x102345c0
+r 0x1071f980
+r 0x10319bc0
+r 0x1041b900
+w 0x10188000
+r 0x10704ec0
+r 0x103d1f00
+r 0x1016f440
+r 0x10340000
+w 0x10116900
+r 0x103adf40
+r 0x1017b440
+r 0x1064cb00
+w 0x104e8d40
+w 0x100cae40
+r 0x103df000
+w 0x10113e40
+r 0x104d0c00
+r 0x10277600
+r 0x104ab200
+w 0x102ab200
+w 0x104920c0
+r 0x102137c0
+r 0x103bfd40
+r 0x10591e00
+w 0x10255b80
+r 0x107b21c0
+r 0x10469a80
+r 0x1077a800
+r 0x107f13c0
+r 0x1033bd80
+r 0x10094180
+r 0x104ff300
+r 0x103d2380
+r 0x103b6440
+w 0x100fc5c0
+w 0x102a3f40
+w 0x10473540
+r 0x10579c00
+w 0x10467e00
+w 0x101b1300
+r 0x1008c140
+w 0x1001a900
+r 0x10197480
+r 0x1061b580
+r 0x1011f6c0
+w 0x10403f80
+w 0x10096440
+w 0x10120f00
+r 0x10627c80
+w 0x10650100
+r 0x10424ac0
+r 0x1060fc80
+r 0x1015f400
+r 0x103c7940
+r 0x1076d400
+r 0x1068ed80
+w 0x100c3f00
+r 0x10256a00
+w 0x106a85c0
+r 0x103e20c0
+r 0x10622200
+r 0x103a1100
+w 0x1018d7c0
+r 0x1013d200
+w 0x107b2040
+r 0x105e2240
+r 0x10130f40
+r 0x10655000
+r 0x106722c0
+r 0x10450c80
+w 0x1079a600
+r 0x101c7e80
+w 0x10383c80
+r 0x104d21c0
+r 0x106886c0
+r 0x100e1800
+r 0x10684a00
+r 0x101ec800
+r 0x102cac40
+r 0x1005b140
+r 0x104a86c0
+r 0x10372c80
+r 0x10608bc0
+r 0x1001d940
+r 0x1069bc40
+r 0x106b1bc0
+r 0x10429e40
+w 0x101fed00
+r 0x10279cc0
+w 0x10263600
+w 0x10297200
+w 0x10721280
+r 0x1001fcc0
+r 0x10155a40
+r 0x103a5980
+r 0x102bf540
+r 0x104c0280
+r 0x100d1440
+r 0x103e4940
+r 0x10162a40
+w 0x1033c000
+w 0x10535780
+r 0x101e4d80
+w 0x107665c0
+r 0x1038bc40
+r 0x10611580
+r 0x1027b280
+w 0x105bd140
+r 0x10347440
+r 0x104adcc0
+r 0x104de280
+r 0x10157100
+r 0x1049db40
+r 0x10214b40
+r 0x101fabc0
+r 0x1001d300
+w 0x101d5c40
+w 0x10519900
+r 0x1010af00
+w 0x100a0040
+w 0x103dd5c0
+w 0x10250740
+r 0x10580ac0
+r 0x105139c0
+r 0x1073eb00
+r 0x10514f80
+w 0x102b6b40
+w 0x1012ed00
+w 0x102ebf40
+r 0x10370700
+r 0x10101900
+r 0x10162180
+w 0x10717240
+w 0x105cefc0
+r 0x1049f000
+w 0x1024afc0
+r 0x103f7940
+r 0x102d1500
+r 0x101c7380
+r 0x10733f00
+w 0x102a3f40
+w 0x10756e40
+r 0x105b8c80
+r 0x10400dc0
+r 0x1031b880
+r 0x100238c0
+r 0x10291000
+w 0x10263980
+r 0x1012cf40
+r 0x1024eac0
+r 0x10015b00
+w 0x100c0e80
+r 0x10461f40
+w 0x1030a880
+r 0x1003b040
+r 0x107565c0
+r 0x1077a400
+w 0x1010e840
+w 0x10159140
+r 0x100a5680
+w 0x106ff200
+r 0x10481380
+r 0x103759c0
+r 0x10022540
+r 0x1012ab80
+r 0x10044540
+r 0x106fbe40
+r 0x102fc400
+r 0x1012b300
+r 0x1010b280
+r 0x10223f80
+r 0x10046d80
+r 0x10576400
+r 0x101f9300
+w 0x10459a40
+r 0x10435840
+w 0x10329000
+w 0x10133740
+r 0x104dbd80
+w 0x103f4e00
+r 0x104262c0
+w 0x10459440
+r 0x1066b2c0
+r 0x100db600
+r 0x10711600
+w 0x101bd240
+r 0x102ad280
+r 0x101f59c0
+r 0x10325000
+r 0x107f7a40
+r 0x105f3680
+w 0x10791980
+r 0x1061d840
+r 0x10739b00
+w 0x106b0e80
+r 0x1062bc40
+r 0x10408580
+r 0x10187dc0
+r 0x10063800
+r 0x107f0840
+r 0x104dc480
+r 0x10607fc0
+r 0x106d7900
+r 0x101fbf00
+r 0x10719d00
+r 0x104a0dc0
+r 0x103a2700
+r 0x107e8d00
+r 0x10698200
+r 0x10306580
+r 0x10548080
+r 0x103e9340
+r 0x106752c0
+w 0x10420d40
+r 0x10165b40
+r 0x100042c0
+w 0x100003c0
+r 0x107170c0
+w 0x105c8c80
+r 0x1006ef40
+r 0x100e66c0
+w 0x105d5940
+r 0x101de000
+r 0x1029f780
+r 0x10234040
+r 0x107d16c0
+w 0x100cac40
+r 0x103b16c0
+r 0x1057f540
+r 0x10086b80
+r 0x1038fb00
+r 0x106bb180
+r 0x106e0d40
+r 0x1030cd00
+r 0x104925c0
+r 0x1002b0c0
+r 0x101359c0
+r 0x10764980
+r 0x1034a4c0
+r 0x103ca800
+r 0x107bdc40
+r 0x104a2880
+w 0x105ac600
+w 0x106a97c0
+r 0x10165540
+r 0x105d5000
+r 0x1017ab40
+r 0x104d4440
+r 0x1008a940
+w 0x10482f00
+w 0x102b6380
+r 0x107fe240
+r 0x1006d980
+r 0x10702980
+w 0x1055e640
+r 0x101b6e00
+w 0x105e7980
+w 0x1027e640
+r 0x10405d40
+r 0x10460ac0
+r 0x1065a140
+w 0x104ce040
+w 0x107f8380
+r 0x102eeec0
+r 0x10233d80
+r 0x10520280
+r 0x100cb380
+r 0x1028b840
+r 0x10391b40
+r 0x1062e380
+w 0x106c7740
+r 0x104feb40
+r 0x10256680
+w 0x105d2080
+r 0x105c9d00
+r 0x102bd100
+w 0x100c1800
+r 0x101f3840
+r 0x1057aa80
+w 0x1004d240
+r 0x10529400
+r 0x1006d440
+w 0x102d9ec0
+r 0x10185040
+r 0x105112c0
+r 0x1003e000
+w 0x100b14c0
+r 0x101ef880
+r 0x102a2280
+r 0x103d6cc0
+r 0x1076cf40
+w 0x100749c0
+r 0x106c1cc0
+w 0x10707140
+r 0x103c7ec0
+r 0x1060c000
+r 0x10482ac0
+r 0x1069a480
+r 0x100f7c40
+r 0x10648e00
+w 0x104de1c0
+r 0x101b3e80
+r 0x1071e280
+w 0x104bd8c0
+r 0x101f3a80
+r 0x103a9580
+r 0x1036b400
+w 0x10117ac0
+r 0x103e9d00
+r 0x1033a600
+r 0x10194c40
+w 0x107b9940
+r 0x107ac340
+w 0x101ed080
+r 0x10297d80
+w 0x104cf940
+r 0x104065c0
+r 0x10134dc0
+r 0x10557480
+r 0x10009a80
+r 0x101d5980
+r 0x1008a000
+r 0x10109380
+r 0x1030d8c0
+r 0x107f6980
+r 0x107b1640
+w 0x10638080
+r 0x107b0600
+r 0x1076a700
+r 0x1010be00
+r 0x102c74c0
+r 0x1060f240
+r 0x1039b3c0
+w 0x101f5500
+r 0x1026b5c0
+r 0x10433340
+r 0x103dec80
+r 0x10384c80
+r 0x10427b40
+w 0x10769080
+r 0x10394040
+w 0x104a5ac0
+r 0x10655ec0
+r 0x10115280
+r 0x10577540
+r 0x107a9080
+w 0x10300e80
+w 0x106b2440
+w 0x101c2200
+r 0x1074b5c0
+r 0x103843c0
+w 0x10139ec0
+w 0x102d77c0
+r 0x105d9700
+w 0x1032a900
+w 0x10711280
+r 0x10353140
+r 0x104b5f80
+r 0x10497140
+w 0x10194540
+w 0x10450800
+w 0x102f7100
+r 0x10705140
+r 0x107fffc0
+w 0x101cc7c0
+r 0x1031e340
+r 0x1066ae80
+r 0x1060a640
+r 0x105d0a00
+r 0x101f1dc0
+r 0x107c0500
+r 0x105508c0
+r 0x10291780
+r 0x105e9440
+w 0x10006540
+r 0x101aa300
+r 0x10507c00
+w 0x1037d540
+w 0x107e2a80
+r 0x1060a680
+r 0x103dbd80
+r 0x10632240
+w 0x10627380
+w 0x106e5a80
+r 0x10094780
+w 0x106a8480
+w 0x105a4780
+w 0x100f9b00
+w 0x10107d80
+w 0x105fea80
+r 0x102a8c80
+r 0x10071a40
+r 0x104ecc40
+w 0x107638c0
+r 0x10368800
+r 0x107cff00
+r 0x100c4d40
+w 0x103664c0
+r 0x102aebc0
+r 0x1028c580
+r 0x107eea40
+r 0x102fb980
+r 0x10490f00
+r 0x107c0200
+r 0x102fb980
+r 0x10357240
+r 0x10759e00
+w 0x10473f40
+r 0x10637040
+r 0x10333340
+w 0x1030bc40
+r 0x104c98c0
+w 0x1013c000
+w 0x1038a980
+w 0x10151680
+r 0x10789200
+r 0x10083540
+w 0x103fa740
+r 0x1043b380
+w 0x104c0d40
+r 0x1002fd40
+r 0x107c3000
+w 0x107b3240
+r 0x104e3f80
+r 0x1038bec0
+r 0x1069b880
+r 0x107dcbc0
+w 0x104169c0
+r 0x103f84c0
+r 0x100ab280
+r 0x10721d00
+w 0x10092980
+r 0x10544a00
+r 0x105ead80
+r 0x104244c0
+r 0x1038bc80
+r 0x105fe540
+w 0x10352700
+r 0x107f9b80
+w 0x1044fa40
+r 0x103e03c0
+r 0x1001d580
+r 0x102e8d80
+r 0x1043ea80
+r 0x1019d240
+w 0x10226ac0
+r 0x101bdb00
+w 0x1049d080
+r 0x101b0400
+r 0x1065adc0
+w 0x10470700
+r 0x106e5680
+r 0x107db000
+r 0x1046cac0
+r 0x104cbdc0
+w 0x10637ec0
+r 0x100bf9c0
+r 0x1058fbc0
+w 0x1035dc00
+w 0x1076b380
+r 0x103e8a80
+r 0x1011c240
+w 0x10674980
+w 0x1000adc0
+r 0x1050e800
+r 0x106e8ac0
+r 0x1028b2c0
+w 0x107d0580
+r 0x107583c0
+r 0x107a4180
+r 0x10061e80
+r 0x107a6d80
+r 0x10101540
+r 0x102d8c40
+r 0x1026f600
+r 0x10280100
+r 0x106c8400
+r 0x1052cdc0
+r 0x10017580
+r 0x10230200
+w 0x1047b280
+r 0x1059d600
+w 0x10645500
+w 0x10730240
+w 0x107cdd40
+r 0x10249600
+r 0x10321940
+r 0x1045d780
+r 0x10414a00
+r 0x1058d880
+r 0x10719700
+r 0x1050ea00
+r 0x10150c00
+w 0x10768340
+w 0x104e0840
+w 0x10471440
+r 0x10745a00
+r 0x1057c540
+r 0x105841c0
+r 0x10208d80
+w 0x10281900
+r 0x1013f140
+r 0x101b8200
+r 0x1067a5c0
+w 0x1007ee00
+w 0x106abe80
+r 0x105e1ec0
+r 0x10391640
+r 0x10390a40
+w 0x100e0580
+r 0x1040adc0
+r 0x1050aa00
+r 0x100f2540
+r 0x1035c600
+w 0x107d0580
+r 0x10487f80
+w 0x106909c0
+r 0x10085b80
+r 0x1010e380
+w 0x10745d40
+w 0x10309f00
+w 0x102e0a00
+w 0x105dc840
+r 0x10521b40
+r 0x101c4e80
+r 0x1003c4c0
+r 0x10085880
+r 0x102ad240
+r 0x100850c0
+w 0x1014a400
+r 0x103ecd80
+r 0x10047200
+r 0x1061d7c0
+w 0x10514900
+w 0x1055b3c0
+w 0x1038de40
+r 0x101cee00
+w 0x10695f80
+w 0x10626b80
+w 0x106c9480
+r 0x101e6280
+r 0x1054dac0
+r 0x102cfd80
+r 0x10080d80
+r 0x10660a80
+r 0x101f2600
+w 0x104b6400
+w 0x10347580
+r 0x1025f600
+r 0x10330000
+w 0x10284d80
+r 0x107d9f00
+r 0x10066040
+r 0x1033d340
+r 0x1073aac0
+r 0x1053f000
+r 0x10428340
+w 0x10182e80
+r 0x10535a00
+w 0x1013ec80
+r 0x10658400
+r 0x1048e580
+r 0x10570d40
+r 0x10724040
+r 0x106d1640
+r 0x10140e80
+w 0x103acf40
+w 0x1049a780
+r 0x1007d580
+r 0x10707400
+w 0x107f2fc0
+r 0x1061a940
+w 0x101cc200
+r 0x10517240
+r 0x105caf00
+r 0x1005a200
+r 0x105885c0
+r 0x10707680
+r 0x10778bc0
+r 0x10602480
+w 0x10484880
+w 0x10362c00
+r 0x10646380
+r 0x104cf440
+r 0x106bd280
+r 0x10308840
+w 0x102f0d80
+r 0x103d7140
+r 0x10246480
+r 0x101672c0
+r 0x107fc100
+r 0x102b9980
+r 0x106e78c0
+w 0x102a61c0
+r 0x10434ec0
+w 0x10271000
+w 0x1060bd00
+r 0x1033d040
+r 0x10094180
+r 0x10538d80
+r 0x10616700
+w 0x105913c0
+r 0x1063cf00
+r 0x100003c0
+r 0x10234440
+w 0x1004c080
+r 0x101e2e40
+r 0x10791540
+w 0x102c9540
+w 0x10215600
+r 0x1063e100
+r 0x102c0a40
+w 0x106e0d00
+r 0x10719bc0
+r 0x105d6e00
+r 0x10567200
+w 0x1020ec40
+r 0x1033c0c0
+r 0x10502900
+r 0x1058be40
+r 0x10702480
+r 0x1060adc0
+w 0x1064f300
+r 0x10283c80
+r 0x1029dfc0
+r 0x1020c500
+w 0x10787c00
+r 0x103e8640
+r 0x102b9ac0
+r 0x102e1400
+w 0x107cdf00
+r 0x10232c80
+r 0x10734780
+r 0x10254140
+w 0x1032a580
+r 0x105ec480
+r 0x100ff9c0
+r 0x10241880
+r 0x1010b340
+r 0x103c8140
+w 0x10449900
+w 0x107f58c0
+w 0x10514140
+w 0x1029d1c0
+r 0x10253340
+r 0x1014a480
+r 0x10594b80
+w 0x1039c0c0
+w 0x1039e580
+w 0x103012c0
+r 0x10639940
+r 0x100053c0
+w 0x101bd000
+r 0x10702d40
+w 0x105819c0
+r 0x107e1400
+w 0x102d5c40
+r 0x106363c0
+r 0x100e4700
+w 0x100954c0
+r 0x1051c880
+w 0x10533a40
+r 0x102dadc0
+w 0x1012bc80
+r 0x104af7c0
+r 0x1007db00
+r 0x10242840
+r 0x10215b00
+r 0x1003e900
+r 0x10136380
+r 0x10735640
+w 0x102a0e40
+w 0x1006ba00
+r 0x104ea880
+r 0x1075e540
+r 0x100aacc0
+r 0x107eae80
+r 0x10104b80
+w 0x10273d00
+w 0x1024e280
+r 0x1046e240
+w 0x1041f9c0
+r 0x100d7240
+r 0x102e18c0
+w 0x103912c0
+r 0x1058ca40
+r 0x101e8540
+r 0x1054e800
+w 0x1006c580
+r 0x10753e80
+r 0x103615c0
+r 0x1033cc80
+r 0x1019fd40
+w 0x10674f40
+r 0x1021f840
+w 0x1077c840
+r 0x10184680
+r 0x10517d40
+r 0x10043100
+r 0x106e88c0
+r 0x10088340
+r 0x106ab980
+r 0x105a2740
+r 0x100baa40
+r 0x10766440
+r 0x101a3680
+w 0x105c8880
+w 0x1050a700
+w 0x1022ab40
+r 0x1069bbc0
+r 0x100fb200
+r 0x10081a40
+w 0x106ef4c0
+r 0x10051740
+r 0x104625c0
+w 0x100b6c80
+r 0x103624c0
+r 0x101aac80
+w 0x107de400
+r 0x10293440
+r 0x10664f00
+r 0x1059c040
+w 0x107b4f40
+r 0x102ab0c0
+r 0x102aae80
+r 0x10514640
+w 0x10390540
+w 0x1049c640
+w 0x1061b640
+w 0x105d0980
+w 0x10430f00
+r 0x1031df40
+w 0x100a3880
+r 0x100a04c0
+r 0x10604740
+r 0x101d7a00
+r 0x106edd40
+r 0x107bbb00
+r 0x1022ef80
+w 0x1025ab40
+r 0x10132140
+r 0x1046ea80
+w 0x101b5380
+w 0x10451d40
+r 0x1040e1c0
+r 0x101f9600
+r 0x100b2f40
+w 0x102c8600
+r 0x1072b300
+w 0x104423c0
+w 0x1044a480
+w 0x1076a600
+w 0x106b7200
+r 0x1071fb80
+r 0x103bad40
+w 0x1007bf00
+r 0x10462f00
+r 0x10336540
+r 0x102cbb80
+r 0x10090380
+w 0x104ec540
+w 0x103025c0
+r 0x10480d40
+r 0x10092640
+w 0x10227840
+r 0x10447c00
+r 0x1062d1c0
+w 0x103aee80
+r 0x10765d40
+w 0x101a9ac0
+r 0x103e5a80
+r 0x1004bf40
+w 0x10687380
+r 0x10521ec0
+r 0x100b2800
+r 0x105d9540
+r 0x107a3900
+w 0x101a7b40
+r 0x1007a440
+r 0x10219f80
+r 0x10013c40
+r 0x105aa600
+r 0x10515400
+r 0x105c8780
+w 0x10220d00
+r 0x1063f800
+r 0x1015aa80
+w 0x10325d40
+r 0x1078adc0
+r 0x10713f40
+r 0x104baf40
+r 0x10358700
+w 0x104e5e40
+w 0x100f4380
+r 0x102f6b80
+r 0x100fdc80
+r 0x10062280
+w 0x107a24c0
+r 0x1068fdc0
+r 0x1008ba00
+r 0x1057ae40
+r 0x1054f200
+r 0x1017b600
+r 0x106ec780
+r 0x1013b0c0
+r 0x101c69c0
+w 0x104ce000
+r 0x106c5a80
+r 0x1066fb00
+r 0x10616f40
+r 0x1004bdc0
+r 0x10028480
+r 0x1077cb80
+r 0x1043de40
+r 0x1054a3c0
+r 0x1049b000
+r 0x10778d00
+r 0x103e0d80
+w 0x10356700
+w 0x10469180
+w 0x101f9f40
+r 0x100a7040
+r 0x1071fa00
+w 0x10138300
+r 0x104cce00
+r 0x1060cc00
+r 0x101ee3c0
+r 0x1030d4c0
+r 0x10462cc0
+r 0x1036b040
+r 0x105df2c0
+w 0x10267400
+r 0x10091500
+r 0x10266900
+r 0x107bf5c0
+r 0x1079d280
+r 0x1002ac00
+r 0x104a6040
+r 0x1070e8c0
+r 0x106d8300
+r 0x102a53c0
+w 0x10375880
+r 0x104f04c0
+r 0x102257c0
+r 0x104d9dc0
+r 0x107e0480
+w 0x10679b80
+r 0x10356780
+w 0x10203940
+r 0x107c4280
+r 0x10417640
+r 0x10590680
+r 0x102df7c0
+r 0x101d04c0
+r 0x106e7980
+r 0x10392f00
+r 0x10070e40
+r 0x105c1e80
+w 0x1019c200
+w 0x10787d80
+r 0x10120a80
+w 0x103e5c40
+r 0x1032f980
+r 0x102da100
+w 0x102b9040
+r 0x1006cdc0
+w 0x105d72c0
+r 0x100958c0
+w 0x100e47c0
+r 0x10221a00
+r 0x10658840
+r 0x10626b40
+w 0x105d5940
+w 0x1068a680
+r 0x106297c0
+r 0x10373500
+r 0x10697780
+r 0x10112640
+r 0x105e40c0
+w 0x104d8b80
+r 0x10612140
+r 0x101dc600
+r 0x10472480
+w 0x106f52c0
+r 0x106581c0
+r 0x10268400
+r 0x10184e00
+w 0x107de440
+r 0x1002a9c0
+r 0x1035c9c0
+r 0x102bb240
+r 0x10597380
+r 0x10735140
+w 0x103a7600
+w 0x100be940
+r 0x102d6d40
+r 0x101ea6c0
+r 0x10661c80
+r 0x101c5180
+r 0x10368140
+r 0x1063a040
+r 0x10054c00
+r 0x103c2240
+w 0x1053b6c0
+r 0x1021d380
+r 0x10311100
+w 0x105bc380
+r 0x10694d80
+r 0x1027b800
+w 0x10132f80
+w 0x102f5180
+r 0x103f4880
+r 0x1004ba40
+r 0x10434680
+r 0x1031ef00
+r 0x1064cf80
+r 0x106d4280
+r 0x10441ac0
+r 0x10786300
+w 0x105c1380
+r 0x10767840
+r 0x107f18c0
+w 0x104c4dc0
+w 0x102a8540
+r 0x100e6580
+r 0x104755c0
+r 0x104552c0
+w 0x106faa00
+r 0x1037d040
+w 0x107f73c0
+w 0x1010b800
+w 0x10577000
+r 0x10530480
+r 0x10126740
+r 0x10183700
+w 0x1075cbc0
+r 0x105af280
+r 0x10666280
+r 0x100a1f00
+r 0x104f6440
+r 0x1072aec0
+r 0x10147480
+r 0x103dd140
+r 0x107dacc0
+r 0x101be440
+r 0x10497100
+r 0x103ea4c0
+w 0x103f2680
+w 0x1012c800
+w 0x10716c80
+r 0x10674000
+r 0x10007fc0
+w 0x10421f40
+r 0x1016ec40
+r 0x104e9440
+r 0x10121340
+r 0x10689f00
+r 0x10262540
+w 0x102a98c0
+r 0x107e4e80
+r 0x105ce3c0
+r 0x1016d9c0
+w 0x1035e200
+w 0x1003ac00
+w 0x106f4e80
+w 0x106ac080
+r 0x103d7f80
+r 0x1026cb00
+w 0x1028ad40
+r 0x1075ca40
+w 0x10715740
+r 0x103b6e40
+r 0x100cda00
+r 0x10640bc0
+r 0x105e8dc0
+r 0x101492c0
+w 0x10283480
+r 0x1026b400
+r 0x1071f600
+r 0x1073d940
+r 0x106c5100
+r 0x10604d00
+r 0x1079d780
+r 0x105a03c0
+r 0x1000e580
+r 0x107ff380
+w 0x100998c0
+r 0x10166940
+r 0x103b4d40
+r 0x1068a800
+w 0x106ff040
+r 0x10233ac0
+r 0x102b0180
+r 0x102b9340
+r 0x106c33c0
+w 0x1041c180
+r 0x100815c0
+w 0x10212500
+r 0x1034a680
+r 0x10703980
+r 0x10070940
+r 0x1029bd00
+r 0x10173440
+r 0x10491bc0
+w 0x100fc600
+w 0x107abec0
+w 0x102c3fc0
+r 0x10662440
+w 0x10522f00
+w 0x105e6240
+r 0x1073bc00
+r 0x10388fc0
+r 0x105b1d00
+r 0x10128a40
+w 0x107cd700
+r 0x102d5900
+w 0x103b8880
+w 0x104c2700
+w 0x10203500
+r 0x10287080
+r 0x10234840
+r 0x105fb900
+r 0x100c6c80
+r 0x106b2d00
+r 0x101b1e40
+r 0x10345d00
+r 0x1011d400
+r 0x107aaac0
+w 0x105c8ac0
+r 0x100972c0
+r 0x10679100
+w 0x10085300
+r 0x10382780
+r 0x1007f0c0
+r 0x106a6780
+w 0x1059e9c0
+w 0x1013a640
+r 0x102d4640
+r 0x10193d00
+r 0x103b9d00
+r 0x102d7280
+w 0x10403bc0
+r 0x106a4740
+w 0x1060c280
+w 0x106e3b80
+r 0x103d3a00
+r 0x106782c0
+r 0x105dea40
+r 0x1074d180
+r 0x10049c80
+r 0x10564500
+r 0x10626740
+r 0x105c5900
+w 0x102c7240
+w 0x1045a1c0
+r 0x101e7a80
+r 0x106be040
+r 0x103d4880
+r 0x106763c0
+r 0x102a1540
+r 0x10461000
+r 0x10333a00
+r 0x1074a1c0
+r 0x100ecdc0
+r 0x104e3040
+r 0x10644ac0
+r 0x10095b40
+w 0x10703280
+r 0x10665ac0
+r 0x10718540
+r 0x10183180
+r 0x102f1bc0
+r 0x1041d740
+r 0x1055e940
+w 0x10006740
+w 0x10386b80
+r 0x107545c0
+r 0x103f6780
+w 0x1034bb80
+r 0x100c8840
+w 0x100b4000
+r 0x107896c0
+r 0x1004e300
+r 0x1033f940
+r 0x1004ff80
+r 0x105ce300
+r 0x1048b2c0
+r 0x1045e340
+w 0x10465940
+r 0x10408f00
+r 0x1040efc0
+w 0x1007b340
+r 0x107d8200
+r 0x106b5d00
+r 0x107e0000
+r 0x104e4800
+r 0x103c4440
+r 0x100ee700
+r 0x100fa940
+r 0x10702400
+r 0x106acd80
+r 0x10398340
+w 0x106c7d00
+r 0x1012bb00
+r 0x1068c900
+r 0x106ebb40
+w 0x1058d4c0
+w 0x1035b700
+r 0x1029dec0
+r 0x104b9b00
+r 0x103ccf80
+w 0x1052f000
+r 0x106470c0
+w 0x1008f500
+r 0x10757640
+r 0x1058e300
+r 0x10722340
+r 0x10668ec0
+r 0x107174c0
+r 0x10640800
+r 0x100b75c0
+w 0x1006e880
+r 0x1066b280
+r 0x1035dd00
+w 0x1072db40
+r 0x103d8440
+w 0x10382300
+r 0x103d3440
+r 0x104b2e80
+r 0x1026ee00
+r 0x1034c0c0
+r 0x10375380
+r 0x106f2b00
+r 0x10502180
+w 0x1079cd80
+w 0x100d7900
+r 0x10500a00
+w 0x104c2a80
+r 0x103e3640
+r 0x10477540
+r 0x10295640
+r 0x1059ac80
+r 0x102ba8c0
+r 0x104675c0
+r 0x1002a540
+w 0x10564bc0
+r 0x1047cac0
+r 0x1076ad40
+r 0x10017b40
+w 0x105a8640
+r 0x105f7fc0
+r 0x102c88c0
+r 0x10647100
+w 0x10219200
+r 0x106407c0
+r 0x104e0580
+r 0x103d1a00
+w 0x10427e80
+w 0x106dd040
+r 0x100a1ac0
+w 0x1045b780
+r 0x107dacc0
+w 0x1034db00
+r 0x1049bb40
+w 0x1002f8c0
+r 0x10053a00
+r 0x10775300
+w 0x10159f80
+w 0x103620c0
+r 0x107704c0
+w 0x101ac980
+r 0x1032c600
+r 0x106c8180
+r 0x107555c0
+r 0x103a3a00
+r 0x102587c0
+w 0x107c8380
+w 0x1039bc40
+r 0x104da7c0
+r 0x10748480
+r 0x10685580
+r 0x100ba1c0
+w 0x10740940
+r 0x107fc640
+w 0x107b7280
+w 0x102ad500
+r 0x107d47c0
+r 0x10403a00
+r 0x105f6800
+r 0x104a93c0
+r 0x104aaf40
+r 0x107a4940
+r 0x10370f00
+r 0x105e6d80
+r 0x100fa3c0
+r 0x10186980
+w 0x1011e5c0
+w 0x10442000
+r 0x1060c780
+r 0x105aa3c0
+r 0x10263500
+r 0x10389d00
+r 0x1052c1c0
+r 0x100fd280
+r 0x102c7580
+r 0x105f8f40
+w 0x100e5780
+w 0x10441c40
+w 0x10167b40
+w 0x101a4c80
+r 0x102a3e80
+r 0x10135380
+w 0x10075780
+r 0x1020c640
+r 0x106922c0
+w 0x1050db80
+r 0x10584840
+w 0x104bb1c0
+r 0x1056bb80
+w 0x105ec7c0
+r 0x10551900
+r 0x1056e700
+w 0x10465b40
+r 0x10467fc0
+w 0x102b9dc0
+r 0x100edb40
+r 0x104f1c00
+r 0x1031b900
+w 0x107277c0
+w 0x105cde00
+r 0x105b0fc0
+r 0x10721380
+w 0x10760bc0
+r 0x103eca40
+r 0x101fa280
+r 0x1014b400
+r 0x1029cf40
+w 0x10644f00
+w 0x107a34c0
+w 0x10799cc0
+w 0x10241f40
+r 0x104d5b40
+r 0x1035d4c0
+w 0x10047c40
+r 0x1007a4c0
+w 0x10783000
+r 0x102c7ac0
+r 0x104f2480
+r 0x10554180
+w 0x100fa080
+r 0x103a70c0
+r 0x107b6300
+w 0x10693c80
+r 0x105eb700
+w 0x106e0140
+r 0x1034bcc0
+w 0x1077e200
+r 0x104fdf00
+r 0x10421ec0
+w 0x107f2b80
+r 0x1028a2c0
+r 0x105562c0
+w 0x10789740
+r 0x10556680
+r 0x10193100
+r 0x10331f00
+w 0x10263580
+w 0x105ce840
+w 0x100f4b00
+r 0x102a3580
+r 0x106327c0
+w 0x1062d700
+w 0x107fee80
+r 0x10099d00
+r 0x10635c40
+r 0x1032cec0
+r 0x102e2980
+r 0x10202480
+r 0x1002d840
+w 0x10699800
+r 0x106bb680
+r 0x1047b780
+r 0x10644200
+r 0x1025ffc0
+w 0x101be600
+r 0x107060c0
+w 0x100ec080
+r 0x10255640
+w 0x101a5c00
+w 0x10670740
+w 0x105ef080
+r 0x104e2c40
+w 0x10393440
+r 0x101c7d40
+w 0x10640340
+r 0x104aa800
+r 0x107b5dc0
+r 0x105cc380
+w 0x104142c0
+w 0x10008500
+w 0x10045000
+w 0x10327a80
+r 0x1071c540
+r 0x10784fc0
+r 0x105b3bc0
+r 0x1045c440
+r 0x1003f140
+r 0x102fe8c0
+r 0x1044d1c0
+w 0x10595d80
+r 0x100ea280
+r 0x104a8340
+r 0x100cf400
+w 0x1018e380
+r 0x104ff480
+r 0x102c9100
+r 0x102f2b40
+r 0x10072000
+w 0x10454800
+w 0x10283240
+r 0x10031f00
+w 0x107c75c0
+r 0x10759840
+r 0x1065e180
+r 0x10101c40
+r 0x10216040
+r 0x105ac3c0
+r 0x104f2680
+r 0x102a9f80
+w 0x10350b80
+r 0x102cf380
+w 0x104f0dc0
+w 0x100f35c0
+r 0x103b8b40
+r 0x1043a600
+r 0x101a1900
+w 0x10299d40
+r 0x101bfa80
+w 0x10706940
+w 0x1007abc0
+r 0x101ec980
+r 0x100df640
+w 0x1055d6c0
+r 0x101e39c0
+r 0x104c9f00
+r 0x100d9800
+w 0x1021d480
+r 0x106b7480
+r 0x107cc600
+w 0x1045f000
+r 0x10235940
+w 0x102fa100
+w 0x10485240
+w 0x1000c340
+r 0x1055de00
+w 0x103ba640
+w 0x100aac00
+w 0x10324640
+r 0x1039f780
+r 0x10362d40
+w 0x100512c0
+w 0x107d9a00
+r 0x105caf00
+r 0x106a40c0
+w 0x102683c0
+r 0x106aa880
+r 0x104ce8c0
+r 0x1032adc0
+r 0x10141400
+r 0x10210a40
+r 0x101c1f40
+r 0x101dc100
+r 0x10296600
+r 0x1058e640
+r 0x1054ea00
+w 0x10581640
+r 0x1073ed00
+w 0x10562500
+r 0x103fc900
+r 0x101dc9c0
+r 0x10639e40
+r 0x102daac0
+w 0x103de700
+r 0x106fe900
+r 0x1043f600
+w 0x102eb980
+r 0x104f2480
+r 0x10382080
+r 0x1077acc0
+r 0x101e7fc0
+w 0x103777c0
+r 0x104dd080
+r 0x101ef300
+r 0x10343980
+r 0x1032c040
+r 0x1039dcc0
+r 0x1064ea40
+w 0x10276800
+r 0x1023d5c0
+w 0x102377c0
+r 0x1078dfc0
+r 0x107f4a40
+r 0x10717f00
+w 0x107a47c0
+w 0x105af340
+r 0x100370c0
+r 0x100e15c0
+r 0x10473280
+r 0x107f4c00
+r 0x106c0000
+r 0x10145f40
+r 0x1028bb80
+r 0x1031db40
+r 0x105007c0
+r 0x10483640
+r 0x102e9d00
+r 0x10068980
+r 0x101e2040
+r 0x102af380
+r 0x10285ac0
+r 0x107953c0
+r 0x105e4b80
+r 0x100b9c40
+r 0x1020d840
+r 0x100c65c0
+r 0x103e5cc0
+r 0x1066cdc0
+r 0x10416640
+r 0x10009b00
+r 0x106ec180
+w 0x1036d200
+w 0x10365340
+w 0x10505cc0
+w 0x10409d00
+r 0x106c4b40
+r 0x107c2b00
+r 0x106312c0
+w 0x10378580
+w 0x104b40c0
+w 0x1030fa80
+r 0x10689f40
+r 0x1023bc80
+r 0x10452780
+r 0x1006b4c0
+r 0x1002ad00
+r 0x105b5b00
+r 0x1060ee40
+r 0x105bfa00
+w 0x10218c80
+w 0x1079a9c0
+r 0x10284700
+r 0x101cd800
+r 0x1075df80
+r 0x101332c0
+w 0x10570300
+r 0x10749a40
+w 0x1047f440
+r 0x105ef940
+r 0x1031d980
+w 0x102f2e40
+w 0x107a7300
+r 0x103fe240
+r 0x1045eb40
+r 0x10550940
+r 0x10203840
+r 0x106cf540
+r 0x103ebe80
+r 0x101e8700
+r 0x10375140
+w 0x102d6840
+w 0x1064d400
+r 0x1025e4c0
+r 0x100177c0
+r 0x105f0ec0
+w 0x104acb80
+r 0x1060da80
+r 0x107d8f00
+r 0x100a3bc0
+r 0x1033b8c0
+r 0x1068ca00
+w 0x102a5680
+w 0x1030c580
+r 0x103bd600
+r 0x107f2440
+r 0x102adf80
+r 0x107d9780
+w 0x10506c80
+r 0x1033bf80
+w 0x1011bd00
+r 0x103cd540
+r 0x107a9500
+r 0x1072d800
+r 0x10417480
+r 0x101454c0
+r 0x10367380
+r 0x1020a380
+r 0x10640e40
+r 0x105ad240
+r 0x106920c0
+r 0x1011c7c0
+r 0x10143000
+w 0x10288a40
+r 0x1057a7c0
+r 0x10023300
+r 0x10062fc0
+r 0x10368500
+r 0x1050ce80
+r 0x1069bdc0
+r 0x105ddb00
+r 0x1064fe40
+w 0x10261880
+r 0x1030af40
+r 0x10409600
+r 0x10302300
+r 0x10318040
+r 0x1050a800
+r 0x10739ac0
+r 0x102da7c0
+r 0x10553fc0
+r 0x104d6740
+r 0x105ccc40
+r 0x102b17c0
+r 0x10253500
+w 0x10720640
+w 0x1063ad40
+r 0x10275f80
+r 0x103fd580
+r 0x104fd900
+w 0x10410680
+r 0x10193880
+r 0x10020080
+r 0x107a90c0
+r 0x102a0cc0
+r 0x10595e40
+r 0x106aa880
+r 0x1068a640
+w 0x107ea6c0
+r 0x1024db40
+w 0x10623ac0
+w 0x104b7140
+w 0x1015fac0
+r 0x100ab140
+r 0x102b1100
+r 0x1024aac0
+w 0x1022e3c0
+r 0x10552000
+r 0x1072c340
+r 0x10236100
+w 0x107e5700
+w 0x1017f000
+r 0x104432c0
+w 0x10701b40
+r 0x10746b40
+r 0x104a5540
+r 0x104b5d00
+r 0x106794c0
+w 0x103d2c00
+r 0x1023a740
+w 0x105b7f80
+r 0x10474f40
+r 0x102a66c0
+r 0x10202ec0
+r 0x10647700
+w 0x10111ec0
+r 0x100f3e40
+w 0x10186500
+r 0x10473480
+r 0x10592800
+w 0x1042b140
+r 0x102a49c0
+r 0x101588c0
+r 0x106ec3c0
+w 0x104f9840
+r 0x107b00c0
+r 0x10677740
+r 0x105c08c0
+r 0x102701c0
+r 0x10219580
+r 0x105fb240
+r 0x102bda00
+r 0x105fc3c0
+w 0x10436100
+r 0x1042ce00
+r 0x105bf8c0
+r 0x1002ca80
+r 0x107ff9c0
+r 0x10212280
+r 0x10369680
+r 0x100178c0
+w 0x10726dc0
+w 0x10746cc0
+r 0x100d6480
+w 0x10798540
+r 0x106cebc0
+w 0x107c5040
+w 0x1072fc00
+r 0x10301ac0
+r 0x10790000
+w 0x1071ca00
+r 0x10398b00
+r 0x102d1ac0
+w 0x1072f880
+r 0x101d76c0
+r 0x1031edc0
+w 0x1042f000
+r 0x104a1140
+r 0x10770840
+w 0x104f30c0
+w 0x1057c440
+r 0x107d3400
+r 0x106fb100
+w 0x102a21c0
+r 0x100eb980
+r 0x101bb380
+r 0x1033b740
+r 0x107e6800
+w 0x1052fe00
+w 0x105af900
+r 0x10484d40
+w 0x101cf2c0
+w 0x10456d80
+w 0x103f2cc0
+r 0x102f8940
+w 0x104314c0
+w 0x1030a6c0
+w 0x105adc00
+w 0x106eae80
+r 0x1066ea40
+r 0x10311fc0
+r 0x103eb400
+r 0x10430d80
+r 0x10364280
+r 0x105dd980
+r 0x104e0980
+w 0x10040940
+r 0x101ffc40
+r 0x10461040
+r 0x1012cec0
+r 0x10727840
+w 0x10315240
+w 0x100665c0
+r 0x10457580
+r 0x104a2340
+w 0x100212c0
+w 0x106871c0
+r 0x103b4f00
+w 0x1039c240
+w 0x10614900
+r 0x103e9f00
+r 0x10707480
+r 0x100ca500
+r 0x1049a680
+r 0x104d7400
+w 0x104760c0
+w 0x10065c80
+r 0x100838c0
+w 0x1057f6c0
+r 0x107ab100
+r 0x1024ce00
+r 0x1047cac0
+r 0x101290c0
+r 0x106a6480
+r 0x10499480
+r 0x1069f480
+r 0x105c9500
+w 0x105bc1c0
+r 0x1068c8c0
+r 0x10739c80
+w 0x105825c0
+r 0x105966c0
+r 0x104a7980
+w 0x1078c5c0
+r 0x10255d00
+r 0x10379c00
+r 0x107fb880
+w 0x1049f900
+w 0x1043f900
+r 0x10390c40
+r 0x102b18c0
+r 0x10657040
+r 0x10180040
+r 0x104be400
+r 0x10216ac0
+w 0x1065dd00
+r 0x10540740
+w 0x10549ec0
+r 0x10187f00
+w 0x1077da00
+r 0x1042d9c0
+r 0x101bdcc0
+r 0x10316680
+w 0x103ee0c0
+r 0x10439900
+w 0x1058e0c0
+r 0x107ecdc0
+r 0x10485d40
+r 0x1055fd00
+r 0x10581500
+r 0x1045d300
+w 0x10461ac0
+r 0x10193080
+w 0x1004d640
+r 0x105d8780
+w 0x1056e3c0
+r 0x10133880
+r 0x1058f780
+r 0x10232d00
+r 0x10270880
+r 0x1014ba40
+r 0x100b9500
+r 0x10162a40
+w 0x1003dec0
+r 0x100deec0
+r 0x102a4d00
+r 0x1034a780
+r 0x1007b000
+r 0x104fb040
+r 0x104bb800
+r 0x10784c00
+w 0x10476c00
+w 0x1037fc00
+r 0x103267c0
+r 0x10266e80
+w 0x101d0680
+w 0x104f2700
+w 0x107a0d40
+r 0x100017c0
+r 0x10704680
+w 0x104a5e80
+r 0x10106c80
+r 0x107dd600
+r 0x10247640
+r 0x101b0080
+w 0x10046940
+r 0x1069b880
+r 0x10300fc0
+r 0x10742780
+r 0x1027b880
+r 0x1046d580
+r 0x10361b40
+r 0x104ed680
+w 0x10216740
+r 0x101bb800
+w 0x107ce6c0
+r 0x1000cf80
+w 0x1046d200
+w 0x103a96c0
+w 0x100df240
+r 0x105d0480
+r 0x10641a00
+w 0x1028a380
+r 0x102e0880
+r 0x106faac0
+r 0x1075b380
+r 0x105c0a40
+w 0x1041a840
+r 0x100c61c0
+r 0x1029c700
+w 0x10689880
+w 0x10093d00
+r 0x10000900
+r 0x1064b940
+r 0x10282b00
+w 0x107dbd00
+r 0x1005ad40
+r 0x10366800
+r 0x103b9d80
+r 0x107cbd40
+r 0x10328d80
+r 0x107d02c0
+r 0x103f5800
+r 0x1053cb40
+w 0x107dbb00
+w 0x100a9080
+r 0x1038b1c0
+r 0x102d1b00
+r 0x1064e080
+r 0x103e6540
+w 0x107b2440
+r 0x10652540
+w 0x101d00c0
+w 0x1025a740
+r 0x101d0540
+r 0x106813c0
+r 0x101d6700
+w 0x10636540
+r 0x10377ec0
+w 0x105e1680
+r 0x1062c9c0
+r 0x103a7a80
+r 0x101ac680
+r 0x101fd640
+r 0x100c2d40
+r 0x1039dec0
+w 0x102ab800
+r 0x103133c0
+r 0x100e6a00
+r 0x105bb680
+w 0x1012c800
+r 0x10450100
+r 0x10757140
+r 0x1015c7c0
+r 0x10157ec0
+r 0x10485700
+r 0x105534c0
+r 0x101be080
+r 0x10235d80
+r 0x10423240
+r 0x107b6780
+r 0x100b7ac0
+w 0x100e09c0
+r 0x102dd800
+r 0x10453dc0
+r 0x10693f40
+r 0x1002ac00
+r 0x1051fd80
+w 0x10439f40
+w 0x103aa880
+w 0x10289800
+r 0x1035d6c0
+w 0x100c7fc0
+r 0x1035e940
+r 0x106f5e80
+r 0x10219000
+w 0x1077b100
+r 0x107b5440
+r 0x10304e80
+r 0x101154c0
+r 0x10529580
+w 0x103c7c80
+r 0x106c4040
+w 0x102f8a00
+r 0x10755d80
+r 0x1073e140
+r 0x103a9f40
+r 0x1061b300
+r 0x101d6880
+r 0x102f2800
+w 0x105288c0
+w 0x101b5f40
+w 0x106e33c0
+r 0x101b4c80
+r 0x1033fa00
+r 0x106824c0
+r 0x10170280
+r 0x103de180
+w 0x102deec0
+w 0x10256ec0
+r 0x10383b00
+r 0x10363140
+r 0x1046a4c0
+r 0x101cfbc0
+w 0x102b6580
+w 0x10525a40
+r 0x104c10c0
+r 0x10135100
+r 0x103e41c0
+w 0x10400c80
+r 0x1062ca40
+r 0x10558600
+r 0x103b3d40
+w 0x107609c0
+w 0x10795480
+r 0x102fa040
+w 0x10158200
+r 0x104a7d00
+r 0x107b5b80
+r 0x101a1640
+w 0x1014de80
+r 0x10319580
+r 0x10424b40
+r 0x106bf440
+r 0x1027ecc0
+r 0x102f9640
+w 0x1057a4c0
+r 0x10643540
+w 0x103bafc0
+w 0x10361ec0
+w 0x107ca440
+r 0x10512e40
+r 0x1059cd80
+r 0x103f6180
+r 0x1055cac0
+w 0x101ed2c0
+r 0x10109dc0
+r 0x103a7680
+r 0x1013d600
+w 0x107e39c0
+w 0x10560980
+r 0x10237240
+w 0x10015780
+w 0x106f7740
+w 0x106b3180
+w 0x10392a80
+r 0x106c49c0
+w 0x106ad080
+r 0x10049180
+w 0x10386d40
+r 0x1017b140
+w 0x10662100
+w 0x10741c80
+r 0x101b27c0
+w 0x10415e80
+r 0x102cdec0
+r 0x103eda40
+w 0x10635380
+w 0x10434f40
+r 0x10558600
+w 0x107a6f00
+r 0x100d69c0
+w 0x103f8280
+r 0x1039e600
+r 0x10224480
+w 0x10362a00
+r 0x104a5040
+w 0x10351d40
+r 0x104b5140
+r 0x1068b940
+r 0x107463c0
+w 0x106adc00
+r 0x1039ae00
+r 0x106a4a00
+r 0x1064bf80
+w 0x100e7e40
+r 0x10154c80
+w 0x10673bc0
+r 0x105009c0
+w 0x100ee780
+w 0x10456b80
+r 0x1076d640
+r 0x101b7840
+w 0x10060680
+r 0x1034bf00
+r 0x102d4780
+r 0x10759940
+r 0x100bea00
+w 0x107eb080
+w 0x107c2f40
+r 0x10777580
+r 0x107ce9c0
+w 0x10046700
+r 0x1010cc00
+w 0x105699c0
+w 0x106ac280
+r 0x103fa880
+r 0x101c3180
+w 0x103e90c0
+w 0x10392c40
+w 0x104cd480
+r 0x1052f440
+r 0x104d0380
+w 0x102fda00
+r 0x102ca680
+r 0x107c4640
+r 0x10222540
+w 0x105b21c0
+w 0x1006e2c0
+r 0x10162d00
+r 0x10257c00
+r 0x1038d6c0
+r 0x1059e140
+r 0x102b94c0
+r 0x1032bdc0
+r 0x106f5940
+w 0x10503b80
+r 0x104ae080
+r 0x10019280
+w 0x10427900
+r 0x10368280
+r 0x107fa340
+r 0x1077b000
+w 0x10441a40
+r 0x102905c0
+w 0x10016d00
+r 0x10598940
+w 0x10010d40
+w 0x106d1740
+r 0x1007ffc0
+r 0x1047a980
+r 0x100fd800
+r 0x102292c0
+r 0x106f5380
+w 0x10142d00
+r 0x10119480
+r 0x1004ab00
+w 0x10699680
+r 0x101fe9c0
+w 0x10346400
+w 0x1003fb80
+r 0x107d2240
+r 0x1041a0c0
+w 0x10581440
+r 0x1062ed40
+w 0x10455400
+w 0x1001ca40
+w 0x10766f40
+r 0x100d3340
+w 0x10421f40
+r 0x1062ed40
+r 0x10720940
+r 0x10253b40
+r 0x1061ed40
+r 0x1030ebc0
+r 0x1018e900
+r 0x103e4d40
+r 0x1010b740
+r 0x1017ad00
+r 0x107bf780
+r 0x10486bc0
+w 0x1059cac0
+r 0x107a8000
+r 0x1074b540
+r 0x103b1c00
+r 0x10375340
+r 0x102c2600
+r 0x107ee9c0
+w 0x10557d40
+w 0x104d2fc0
+r 0x10518880
+w 0x10496500
+r 0x101ec140
+r 0x100046c0
+w 0x1063ce40
+r 0x10251e40
+w 0x10179600
+r 0x1020d7c0
+w 0x107dab40
+r 0x10734100
+r 0x1013eb00
+w 0x10211740
+w 0x10572e00
+r 0x1021eb80
+r 0x10097340
+w 0x107bce00
+w 0x10728300
+r 0x1000f300
+r 0x10010640
+r 0x102feec0
+r 0x104fb440
+r 0x10025540
+r 0x1049eac0
+w 0x1050b500
+w 0x106bcdc0
+r 0x1041c080
+r 0x101cf340
+r 0x1025d340
+r 0x1061b140
+r 0x104d9300
+r 0x1020ed80
+w 0x10595580
+r 0x10004d00
+r 0x100ce1c0
+w 0x10081900
+r 0x10563540
+r 0x10592480
+r 0x10626280
+r 0x104252c0
+w 0x10672e40
+w 0x1049ca80
+r 0x106b5780
+r 0x101dcac0
+w 0x100dc380
+r 0x10776980
+r 0x101fa600
+w 0x10407600
+r 0x104a1340
+w 0x1027abc0
+r 0x100a1e80
+r 0x1000c7c0
+r 0x104c5080
+r 0x104ca6c0
+w 0x106823c0
+r 0x1043fa00
+w 0x103e4280
+r 0x1074f3c0
+w 0x105cd480
+r 0x103fa640
+r 0x103de980
+w 0x101eee00
+r 0x100a0d00
+r 0x10665a40
+r 0x1078c340
+r 0x100cbb40
+r 0x10439800
+r 0x107d04c0
+r 0x106d7900
+r 0x107c9000
+w 0x1057aac0
+r 0x1075d600
+r 0x102a8880
+r 0x10586a80
+w 0x1079a240
+r 0x103e41c0
+r 0x1057e480
+r 0x101ce600
+w 0x1055f040
+r 0x10203440
+r 0x105b8f40
+r 0x10525f40
+r 0x10367ec0
+w 0x10192600
+w 0x102cef40
+r 0x1010b0c0
+r 0x103dce80
+r 0x104e74c0
+r 0x100cad00
+r 0x103ad4c0
+w 0x107b0540
+r 0x102ce440
+w 0x10254d80
+r 0x103b1040
+r 0x1041b540
+r 0x10773200
+r 0x104e8680
+w 0x1061c640
+w 0x10047080
+w 0x107680c0
+r 0x10409080
+r 0x1061e2c0
+r 0x1071dec0
+w 0x106bbe40
+w 0x103c5b40
+r 0x10551e00
+r 0x103cd380
+r 0x1056b480
+r 0x10641580
+r 0x10369680
+r 0x106ddd00
+r 0x10280140
+w 0x107dda80
+w 0x104c7ac0
+w 0x1022ed80
+r 0x10378840
+w 0x106a45c0
+w 0x101d2f00
+r 0x10113d40
+r 0x106ad380
+r 0x10265c00
+r 0x10345980
+w 0x101adac0
+w 0x10173cc0
+w 0x103444c0
+w 0x103bb380
+r 0x106729c0
+r 0x107ac040
+r 0x10301200
+r 0x1048ab80
+r 0x107c72c0
+r 0x1064b580
+r 0x10510780
+r 0x10414540
+r 0x10558740
+r 0x10201340
+r 0x1071fc00
+r 0x10282280
+r 0x103e0740
+w 0x104df900
+r 0x10690100
+w 0x1019bdc0
+r 0x104d5380
+r 0x10709100
+r 0x105e1980
+w 0x106d78c0
+r 0x10306600
+r 0x10530fc0
+r 0x1056b7c0
+r 0x103b6cc0
+r 0x1067d680
+r 0x100eee00
+w 0x10702ec0
+r 0x104f5d40
+w 0x1049d640
+r 0x105a5600
+r 0x10656b00
+r 0x10682340
+r 0x10536e40
+r 0x1024ebc0
+w 0x1069a040
+r 0x10532f80
+r 0x1022d700
+r 0x107b1ac0
+w 0x10547800
+r 0x10315500
+w 0x102b7c80
+w 0x1033d580
+w 0x104a9f00
+r 0x10527e80
+r 0x10254340
+w 0x10777c40
+r 0x10374140
+w 0x1078ba40
+w 0x1066af80
+r 0x1003f6c0
+r 0x10786600
+r 0x10700e80
+w 0x1078ae80
+r 0x10025ec0
+r 0x100c5e00
+r 0x103864c0
+r 0x100482c0
+r 0x1044e240
+r 0x104cb6c0
+r 0x1051b980
+r 0x1067d0c0
+r 0x10644000
+w 0x10188a00
+r 0x103ef2c0
+r 0x1029ad80
+r 0x103e2a40
+r 0x1002af80
+w 0x106b1a40
+r 0x101f1d40
+r 0x106f5740
+w 0x10556780
+r 0x1042d500
+r 0x1001ee40
+r 0x10109bc0
+r 0x105ebbc0
+r 0x107ea5c0
+w 0x10412b80
+r 0x1070d9c0
+r 0x102dd400
+w 0x1052dac0
+r 0x10073940
+r 0x10336f40
+r 0x102368c0
+r 0x105ac140
+r 0x107894c0
+r 0x103e2440
+w 0x1060ab80
+r 0x10440580
+r 0x10158ec0
+r 0x100f1940
+w 0x103d1880
+w 0x1006b800
+w 0x103cca80
+r 0x10143640
+r 0x10587440
+r 0x1060f440
+r 0x10356fc0
+w 0x10349080
+r 0x104ba9c0
+r 0x1077cb40
+r 0x1027c440
+w 0x105e6480
+r 0x1055f6c0
+r 0x10268ec0
+r 0x106b4680
+w 0x101f3a00
+r 0x107f5ac0
+r 0x10093680
+r 0x100de4c0
+r 0x1036c680
+r 0x1048bd00
+r 0x1054e480
+w 0x1010fdc0
+r 0x1050a280
+w 0x1033e580
+r 0x105fdfc0
+r 0x1033dbc0
+r 0x1060d780
+w 0x101f5500
+w 0x10427140
+r 0x10173d40
+r 0x106ae480
+r 0x10574c80
+r 0x101a26c0
+r 0x102c8ac0
+r 0x1010f1c0
+w 0x10093940
+r 0x1002b4c0
+r 0x10097500
+r 0x101928c0
+r 0x1040a980
+r 0x100d47c0
+w 0x10196c00
+r 0x102a8840
+r 0x107e5e80
+w 0x1012fcc0
+r 0x10150c80
+r 0x105847c0
+r 0x100062c0
+r 0x105ec8c0
+r 0x100633c0
+w 0x102fd400
+w 0x1005b0c0
+r 0x10657ac0
+r 0x104e82c0
+w 0x105d03c0
+r 0x101f6900
+w 0x1051bdc0
+r 0x106197c0
+r 0x1057bfc0
+w 0x105a8a00
+r 0x1071f940
+w 0x102ad540
+w 0x107b7dc0
+r 0x10724e00
+w 0x107e3fc0
+r 0x100d1800
+w 0x1004e040
+r 0x10498f00
+r 0x1048a580
+w 0x1009df40
+w 0x10787fc0
+r 0x106a8500
+w 0x10515100
+r 0x10798280
+r 0x10332480
+w 0x10759f00
+r 0x105b0180
+w 0x105b1c40
+r 0x106004c0
+r 0x10342a80
+r 0x10458440
+w 0x10222880
+r 0x104a6180
+r 0x1062a480
+r 0x105e0c40
+w 0x104fe600
+r 0x1011df80
+w 0x10500cc0
+w 0x1003f040
+w 0x102dae40
+r 0x1007b500
+r 0x10693780
+r 0x101e4ac0
+w 0x10389240
+r 0x10474600
+w 0x10688f40
+r 0x101c1e00
+r 0x100c7c40
+w 0x10776f00
+r 0x1011b0c0
+w 0x106d5940
+w 0x106bf6c0
+w 0x105ebc40
+r 0x10196780
+r 0x10300000
+r 0x10464700
+r 0x1023e340
+r 0x104067c0
+r 0x101002c0
+r 0x10243d40
+r 0x10632a00
+w 0x106309c0
+w 0x10125c80
+r 0x105cab00
+r 0x10402cc0
+w 0x101f35c0
+r 0x10753200
+w 0x10556980
+w 0x10487180
+r 0x1042b080
+r 0x10740000
+w 0x101bca80
+r 0x10435a00
+w 0x10548980
+w 0x10736f80
+r 0x104a4240
+r 0x106b6100
+w 0x1017ec00
+r 0x10568540
+w 0x1008a900
+r 0x103f2980
+r 0x100c8500
+r 0x1007fc00
+r 0x10483940
+r 0x1034ab00
+w 0x10727400
+w 0x10026a00
+r 0x102bf6c0
+r 0x10250400
+r 0x1002c580
+w 0x102798c0
+w 0x1050f940
+r 0x101b84c0
+w 0x105045c0
+r 0x10660cc0
+w 0x1004a1c0
+r 0x10779640
+r 0x102d0c00
+w 0x10236a40
+r 0x104ce6c0
+w 0x103f9400
+r 0x103f5d00
+r 0x101bbc80
+r 0x10256f80
+w 0x10379280
+w 0x10470100
+r 0x103d2680
+r 0x10554d80
+w 0x107f7580
+r 0x1062e400
+r 0x1062c700
+r 0x10399e40
+r 0x10683a80
+r 0x103b6140
+r 0x107bee80
+w 0x103cbb00
+r 0x10666e80
+r 0x10455f40
+r 0x10401900
+r 0x1007df40
+w 0x104dc480
+w 0x106a0b40
+w 0x10331c80
+r 0x10488440
+r 0x10547080
+r 0x10376ec0
+r 0x10653400
+r 0x105cd9c0
+w 0x1009ee80
+w 0x10730a00
+r 0x10114ec0
+r 0x104c5d00
+r 0x1059d780
+r 0x10360dc0
+w 0x106b9100
+r 0x1056ba40
+r 0x100d8400
+r 0x10674140
+r 0x106d9580
+w 0x106c8300
+r 0x10570040
+r 0x102483c0
+w 0x1023cb80
+w 0x10662500
+r 0x10398a80
+r 0x101014c0
+w 0x106f5c00
+r 0x1064d680
+r 0x10209380
+r 0x100d3180
+r 0x10305d00
+r 0x1025e4c0
+r 0x107b1a00
+r 0x10335200
+r 0x100e5880
+r 0x103e3d40
+r 0x10421700
+r 0x10577340
+r 0x101c5240
+r 0x104cbd80
+w 0x106d1ac0
+r 0x10420300
+w 0x102824c0
+r 0x1015f4c0
+r 0x100614c0
+w 0x10095c80
+r 0x100a23c0
+r 0x10511f80
+r 0x107b5e40
+r 0x105b1d80
+r 0x10185800
+r 0x1019d440
+w 0x106de800
+r 0x1015bf40
+r 0x107de2c0
+r 0x106637c0
+r 0x1030cac0
+r 0x10369500
+w 0x1054e100
+w 0x10769c40
+r 0x10120600
+w 0x105d0580
+r 0x1008af80
+w 0x10271dc0
+r 0x10212a00
+r 0x1016b500
+r 0x1022c940
+r 0x10099000
+r 0x10496680
+w 0x1040ca00
+w 0x10049dc0
+r 0x103cd700
+w 0x10441e00
+w 0x1001b2c0
+r 0x10168040
+r 0x101b2780
+w 0x106a2100
+w 0x1001f380
+w 0x10494e00
+w 0x1060d640
+w 0x1071c640
+r 0x101550c0
+r 0x10330280
+r 0x1044de00
+r 0x103fd200
+r 0x104a8700
+r 0x1078e7c0
+r 0x10128040
+w 0x107279c0
+w 0x1030eb00
+w 0x102d2400
+w 0x103b9840
+w 0x105fb200
+r 0x1013ea00
+r 0x1070df00
+w 0x104f4c00
+r 0x10766740
+r 0x101e7940
+w 0x102e4040
+w 0x1009e880
+r 0x105bda80
+r 0x10132940
+r 0x102d5b80
+r 0x10446f00
+r 0x105bc600
+w 0x10032d00
+r 0x104ac6c0
+r 0x1042c5c0
+r 0x10454800
+r 0x10721100
+r 0x102e8f40
+r 0x106b1a80
+w 0x105f3e80
+w 0x10584a80
+r 0x100e2c00
+r 0x1039ff80
+r 0x1056bb80
+w 0x107d1d40
+r 0x105fc580
+w 0x106ea4c0
+w 0x10376200
+r 0x103fab00
+w 0x1015dbc0
+r 0x105c7c40
+r 0x1037f9c0
+r 0x106849c0
+w 0x106808c0
+r 0x107c8e80
+r 0x104fcc40
+w 0x10288a00
+r 0x101fb900
+r 0x101b8140
+r 0x1065fd00
+w 0x10362680
+w 0x10185540
+r 0x1039c600
+w 0x105fe800
+w 0x10751dc0
+r 0x10250e40
+w 0x1053eb40
+r 0x106a58c0
+r 0x10555b40
+r 0x103cf300
+r 0x102942c0
+w 0x107bdd80
+r 0x1077f6c0
+w 0x10413f00
+r 0x102c9ac0
+r 0x10160040
+r 0x10038b80
+r 0x104a3240
+r 0x1045ddc0
+r 0x105f1e00
+r 0x10007640
+r 0x10781ac0
+w 0x104cbec0
+r 0x106f86c0
+r 0x10505100
+r 0x100b7700
+w 0x107e1c80
+r 0x107e0680
+r 0x102e5a80
+r 0x1008b540
+r 0x10613340
+r 0x10439700
+r 0x107b0fc0
+r 0x1061d100
+r 0x106d9900
+w 0x1020c940
+r 0x101b3340
+w 0x10686e00
+r 0x10239c00
+r 0x10120c00
+r 0x106331c0
+r 0x107b1c00
+r 0x10568380
+r 0x10257f00
+r 0x10643e40
+r 0x1047ce40
+w 0x106fcf00
+r 0x10550a80
+w 0x102ab5c0
+r 0x101cb900
+w 0x106dda40
+r 0x1002f080
+r 0x10079680
+w 0x104f6580
+w 0x10325380
+r 0x102343c0
+r 0x104ec4c0
+r 0x10563f80
+w 0x106e08c0
+r 0x10663fc0
+r 0x1072dfc0
+w 0x10071980
+r 0x1010d340
+r 0x106d17c0
+w 0x104db500
+w 0x107c0e40
+r 0x1056d0c0
+r 0x1000e1c0
+w 0x106e0ec0
+r 0x102a8800
+r 0x1072d000
+r 0x1069d900
+w 0x104aac80
+r 0x1055fe40
+r 0x10313800
+r 0x1047f800
+w 0x101621c0
+r 0x10666240
+r 0x107ad500
+r 0x10213180
+w 0x103dd740
+w 0x10439740
+w 0x1054e180
+w 0x104b42c0
+r 0x104a8480
+r 0x10157b80
+r 0x1065af00
+r 0x103c3a80
+r 0x102a68c0
+w 0x10105a40
+r 0x10589fc0
+r 0x1007e340
+r 0x101f5c40
+w 0x105b6bc0
+w 0x10143c80
+r 0x1072f780
+w 0x1015f100
+r 0x101f0a00
+r 0x105373c0
+w 0x105894c0
+r 0x10578ac0
+w 0x10608a00
+r 0x106aecc0
+r 0x1037b840
+w 0x10419e40
+r 0x104a1b00
+r 0x1002cc40
+r 0x104b8000
+r 0x10470980
+w 0x1043c640
+r 0x105fc780
+w 0x10299180
+r 0x10280600
+r 0x1038e540
+w 0x1043a100
+w 0x10674380
+r 0x10689f00
+r 0x1045ed00
+w 0x106967c0
+w 0x100bd240
+r 0x10327980
+r 0x1024df00
+r 0x106b4200
+r 0x102082c0
+r 0x1003c400
+r 0x1008f9c0
+r 0x1065ef00
+r 0x101c80c0
+r 0x106b6800
+w 0x10565d80
+r 0x10721c80
+r 0x100fc540
+r 0x106d18c0
+r 0x102f0900
+r 0x10342e00
+w 0x10758940
+w 0x103a8740
+r 0x1072f500
+w 0x106fae00
+r 0x103e4bc0
+r 0x10165940
+r 0x10565000
+r 0x105ec6c0
+w 0x1036bc80
+w 0x10337fc0
+r 0x107b4640
+r 0x10032700
+w 0x1046b2c0
+r 0x10501480
+w 0x101767c0
+r 0x105ff0c0
+r 0x107ff000
+w 0x10373d40
+w 0x103cda00
+w 0x102f5540
+r 0x10628d80
+r 0x10457280
+r 0x10535cc0
+w 0x103c1c80
+r 0x107d3800
+r 0x106fb800
+r 0x102cc8c0
+r 0x106e13c0
+r 0x102355c0
+r 0x101169c0
+r 0x102c46c0
+w 0x104e0280
+w 0x100ea140
+r 0x101b4900
+r 0x106a7500
+r 0x10648100
+r 0x104b8c40
+w 0x101a0840
+r 0x10522e80
+r 0x1075e080
+r 0x10377840
+w 0x102bbf00
+r 0x10638f40
+w 0x101814c0
+r 0x105b4d80
+r 0x105cb2c0
+r 0x1057e1c0
+r 0x100d6e40
+r 0x10412500
+w 0x1051d500
+r 0x10035b40
+w 0x101828c0
+r 0x1022aa80
+r 0x102a8200
+r 0x10239fc0
+r 0x101cad40
+r 0x100144c0
+w 0x1020c180
+r 0x1024d040
+r 0x104d97c0
+r 0x10688cc0
+r 0x104f0d40
+r 0x106d5b00
+w 0x1028d680
+r 0x106e2300
+r 0x1027c7c0
+r 0x1017ce00
+r 0x105b1140
+r 0x1027b900
+w 0x1000c700
+r 0x10004d00
+w 0x1010a440
+r 0x10413bc0
+r 0x1035fac0
+r 0x1018a280
+r 0x101087c0
+r 0x105fb800
+r 0x1003d800
+w 0x10723140
+r 0x103623c0
+w 0x1065c940
+r 0x1073b7c0
+r 0x1006b2c0
+w 0x102803c0
+w 0x106028c0
+r 0x106f1580
+r 0x10072a80
+r 0x106e0680
+r 0x1073dd00
+r 0x10161f00
+r 0x1025d6c0
+r 0x10362680
+w 0x101eccc0
+r 0x10123a40
+r 0x1073d540
+r 0x10215b40
+r 0x101026c0
+r 0x10447240
+r 0x107a8bc0
+r 0x10465840
+r 0x106d9480
+w 0x10297840
+r 0x10395480
+r 0x1016bc40
+r 0x101b8880
+r 0x10095000
+r 0x101d4a00
+r 0x10251b80
+w 0x10434000
+r 0x1048c9c0
+r 0x104d4fc0
+r 0x102a5b80
+r 0x1000d080
+r 0x10750bc0
+r 0x105f25c0
+r 0x103772c0
+r 0x10662a00
+r 0x1020c480
+r 0x1003e6c0
+w 0x106e5100
+w 0x10157280
+r 0x10212200
+r 0x106d2f80
+r 0x10045700
+r 0x10721340
+r 0x1053e540
+r 0x10028440
+r 0x10658a40
+r 0x10091a80
+w 0x10382500
+w 0x107f2600
+r 0x107f6f00
+r 0x10323b00
+r 0x101d2100
+r 0x10150fc0
+r 0x1033ac40
+r 0x10585f40
+r 0x10524d40
+r 0x10160fc0
+r 0x102383c0
+r 0x10639180
+r 0x1066d580
+r 0x101ba300
+r 0x1034f9c0
+r 0x102f4ac0
+r 0x10692e40
+w 0x10084980
+r 0x104b1cc0
+r 0x1074a7c0
+w 0x106b2040
+r 0x10051600
+r 0x10549000
+r 0x1037d380
+w 0x106ed980
+w 0x100969c0
+w 0x107d9600
+w 0x1046b2c0
+r 0x106c2a40
+r 0x100d7980
+r 0x103412c0
+w 0x10134cc0
+r 0x10391d80
+r 0x10749a00
+r 0x10499680
+r 0x10180600
+w 0x1050eb80
+r 0x10013500
+w 0x1067e140
+r 0x102f4640
+w 0x1044cf80
+w 0x1058e100
+r 0x104a9280
+r 0x1076af40
+r 0x10390c00
+r 0x10244800
+r 0x1026eb80
+r 0x104ed0c0
+r 0x103c61c0
+r 0x1077f080
+r 0x1054afc0
+r 0x10061140
+r 0x1036ae40
+r 0x1052ef80
+r 0x106b4400
+r 0x106b1140
+r 0x103c6480
+r 0x10226e40
+w 0x103d7dc0
+r 0x10412cc0
+r 0x10340fc0
+w 0x10249480
+r 0x105067c0
+r 0x10277a00
+r 0x104db800
+r 0x107e4cc0
+w 0x105d68c0
+r 0x100cb140
+r 0x105ed800
+w 0x103c1f00
+r 0x103c6480
+w 0x10249080
+w 0x103582c0
+r 0x1065afc0
+r 0x1043b7c0
+r 0x103cf200
+r 0x1040a840
+r 0x104ed9c0
+r 0x100593c0
+r 0x10512940
+r 0x106e5800
+r 0x1017d7c0
+r 0x103ee580
+r 0x105b4180
+r 0x106cf480
+r 0x1017f080
+r 0x104fd4c0
+r 0x104dda80
+r 0x1012df00
+r 0x10766d00
+r 0x10219b00
+r 0x101b7800
+w 0x106f7b40
+r 0x104dccc0
+r 0x10364400
+r 0x103d0580
+r 0x10265740
+r 0x1052d080
+r 0x106367c0
+w 0x102ba580
+w 0x1020f640
+r 0x1079c680
+r 0x106c1100
+r 0x1027ed40
+r 0x10454d40
+r 0x10660280
+r 0x1009fc80
+w 0x101b5740
+w 0x1010b380
+r 0x10207c40
+r 0x104f3c00
+r 0x10299300
+w 0x103469c0
+w 0x106b8b00
+w 0x10672680
+r 0x102e3980
+r 0x102793c0
+r 0x10729080
+w 0x10417980
+r 0x10005380
+r 0x1048f840
+r 0x10161740
+r 0x10785bc0
+r 0x10157180
+r 0x10508e80
+r 0x10433a80
+w 0x1049c2c0
+r 0x104353c0
+r 0x1067e900
+r 0x102088c0
+r 0x1052a480
+r 0x102c6740
+r 0x102b2a40
+r 0x107ad400
+r 0x10470e40
+r 0x104e1140
+w 0x1040a6c0
+r 0x1005ad00
+r 0x1020ff00
+r 0x105f0f40
+w 0x10775340
+r 0x10079f40
+r 0x107b88c0
+r 0x105bed40
+r 0x102b2e40
+r 0x103c15c0
+r 0x103cb1c0
+r 0x10189b40
+r 0x1051d680
+w 0x107a78c0
+w 0x1046fb00
+r 0x10715d80
+r 0x10634500
+w 0x107cc180
+r 0x1067afc0
+r 0x106e7c40
+w 0x1079bd80
+w 0x100ff280
+r 0x100c32c0
+r 0x1071e800
+r 0x102d5300
+r 0x1042ddc0
+r 0x1021a100
+r 0x105055c0
+r 0x10606d80
+r 0x102eec80
+r 0x1024b540
+r 0x1078fbc0
+w 0x1017e600
+w 0x10193180
+r 0x105bef80
+r 0x10481880
+r 0x10100180
+r 0x10500a00
+r 0x1058cc80
+r 0x10794740
+r 0x1040da00
+r 0x105e3080
+w 0x104295c0
+r 0x102d6900
+r 0x10163800
+r 0x10202500
+r 0x10699ac0
+w 0x107be180
+r 0x10544bc0
+r 0x10371540
+r 0x105c9580
+r 0x101d1980
+r 0x104cb2c0
+w 0x1063f580
+w 0x1017dc80
+r 0x10053380
+r 0x107da280
+r 0x10310480
+r 0x1049e080
+r 0x10650580
+r 0x1013d5c0
+w 0x10367c00
+w 0x10565780
+w 0x100f7040
+r 0x101d0100
+w 0x1007ff00
+r 0x102254c0
+r 0x10295c00
+r 0x10243040
+r 0x102a43c0
+r 0x104f0080
+r 0x105a38c0
+r 0x10293d00
+r 0x10637e00
+r 0x100745c0
+r 0x104607c0
+r 0x1027b840
+r 0x102edf80
+r 0x104f1a80
+r 0x10575b40
+r 0x10752e80
+w 0x1035ab80
+r 0x1007b080
+r 0x10542ec0
+r 0x100d4d80
+r 0x1073ac80
+w 0x1059cec0
+w 0x107084c0
+r 0x102f1280
+w 0x101d5640
+r 0x102adb80
+r 0x107f2880
+w 0x101ed840
+r 0x102871c0
+w 0x1037ee40
+w 0x1074b700
+r 0x1016ef40
+r 0x102cf440
+r 0x1076ce00
+w 0x10636180
+r 0x106d4f40
+r 0x107e5d40
+r 0x10140440
+r 0x10521a80
+r 0x10427640
+w 0x1011e7c0
+r 0x10500e00
+r 0x105d0e40
+r 0x1073ae80
+r 0x10463d00
+r 0x1067af80
+r 0x10579000
+r 0x103cafc0
+r 0x107c76c0
+r 0x106e57c0
+w 0x104dc040
+r 0x107de140
+r 0x102c2a00
+w 0x10215400
+w 0x10098d00
+r 0x1016bb80
+r 0x1011df80
+r 0x10426fc0
+r 0x10176300
+r 0x1012de80
+w 0x101f91c0
+r 0x1008c300
+r 0x10344bc0
+w 0x10635dc0
+r 0x1026ac00
+r 0x105ac000
+r 0x10785200
+r 0x105bef00
+r 0x10172a40
+r 0x105c7000
+w 0x104a5a80
+r 0x105c27c0
+r 0x102142c0
+r 0x106c6300
+r 0x10442080
+r 0x100e8f00
+r 0x10286240
+w 0x1034e0c0
+r 0x1065f5c0
+r 0x100d3d80
+r 0x106dd100
+r 0x103afbc0
+r 0x104d1940
+w 0x100aa780
+r 0x1060c380
+r 0x1064d280
+w 0x1034f7c0
+w 0x102d5e40
+r 0x10793a00
+r 0x107a7740
+r 0x102e1640
+r 0x10647200
+r 0x10132280
+w 0x107b7c00
+r 0x1003d200
+r 0x107fa300
+r 0x100612c0
+w 0x1010c540
+w 0x10527d00
+r 0x106767c0
+w 0x107aa180
+r 0x10158e80
+r 0x104c8b00
+r 0x106e8700
+r 0x1036c300
+w 0x102dc7c0
+r 0x10330380
+r 0x103891c0
+r 0x100b42c0
+r 0x1016be40
+w 0x105c3100
+r 0x105a4500
+r 0x1066cf00
+r 0x102579c0
+r 0x10505600
+w 0x10649f00
+r 0x107aaa40
+r 0x1071a040
+r 0x1067bd80
+w 0x106326c0
+r 0x10368e80
+r 0x10023340
+r 0x10117380
+r 0x10720f00
+r 0x102880c0
+r 0x1063d700
+w 0x1038fdc0
+r 0x1038aec0
+r 0x1068e280
+w 0x10034ac0
+r 0x103c2540
+r 0x1062c840
+r 0x10245e40
+r 0x10517900
+w 0x107ff680
+r 0x10283540
+w 0x10786e80
+r 0x105224c0
+r 0x10598d40
+r 0x107e2f80
+r 0x104b8200
+w 0x1009e6c0
+r 0x10751500
+r 0x10580300
+w 0x10590dc0
+w 0x10472040
+r 0x1026ff80
+w 0x103c0940
+r 0x10431a40
+w 0x100cdf40
+r 0x10650a00
+r 0x10077a00
+w 0x100bc280
+r 0x10002640
+r 0x10240480
+w 0x10565180
+w 0x100fd340
+r 0x10278240
+r 0x100838c0
+r 0x10386cc0
+r 0x107d4bc0
+r 0x10114380
+w 0x1029a8c0
+w 0x103ba600
+r 0x1055ac80
+w 0x10681a40
+r 0x101a3600
+r 0x102d7900
+r 0x105b9480
+r 0x10441f00
+r 0x10657940
+w 0x10706340
+r 0x10628f40
+r 0x100a5840
+r 0x104ff880
+w 0x10016140
+r 0x1032bc00
+r 0x10778f40
+r 0x104d6500
+w 0x10150f00
+w 0x10621800
+w 0x101520c0
+r 0x104ae000
+r 0x104d7540
+w 0x10390940
+r 0x10529940
+w 0x1031b000
+w 0x1001ef80
+w 0x10163f00
+r 0x10434280
+r 0x107f5fc0
+r 0x1075e480
+r 0x10285480
+w 0x10690fc0
+r 0x10770ac0
+r 0x10273380
+r 0x103c6a80
+r 0x10557240
+r 0x102c15c0
+r 0x100ca7c0
+r 0x1078d840
+r 0x10648ec0
+w 0x10529680
+r 0x106a2a00
+r 0x1071ee00
+w 0x1024c500
+r 0x107a7dc0
+r 0x10561c40
+r 0x102d9bc0
+r 0x10262380
+r 0x106109c0
+w 0x10775780
+r 0x10047180
+r 0x10303500
+w 0x1059a7c0
+r 0x1001b000
+r 0x10537f80
+r 0x10708000
+r 0x10115d00
+w 0x10433bc0
+r 0x104b59c0
+r 0x103d15c0
+r 0x10081740
+r 0x101eabc0
+r 0x1053c580
+w 0x10683d80
+r 0x100a3500
+r 0x10453700
+r 0x104f2640
+r 0x104fcdc0
+w 0x105df900
+r 0x101d1e40
+r 0x10585940
+w 0x10107540
+w 0x103ff380
+r 0x1005a480
+r 0x106e1980
+r 0x106f6780
+w 0x1068cdc0
+r 0x1065e080
+r 0x1035f600
+r 0x107db3c0
+w 0x10021c40
+w 0x104ca940
+r 0x103ce240
+w 0x10263740
+r 0x10006480
+r 0x10140b00
+w 0x1042e440
+r 0x10710f40
+r 0x106f3a80
+r 0x107bc700
+r 0x1014dd80
+w 0x1009d140
+r 0x106df240
+r 0x101a9940
+r 0x102f9400
+w 0x1064c440
+w 0x1050bac0
+r 0x1010c400
+r 0x10394140
+w 0x107caa00
+r 0x10310480
+w 0x104c74c0
+r 0x10238bc0
+r 0x107b3500
+r 0x1028b0c0
+w 0x104f4a40
+r 0x102307c0
+r 0x105c6140
+r 0x103dc180
+r 0x10181240
+w 0x1046c440
+r 0x1043ac40
+r 0x103c86c0
+r 0x10272840
+r 0x10012fc0
+r 0x10313180
+r 0x10005c80
+w 0x101b51c0
+r 0x102af180
+r 0x104899c0
+r 0x10717b00
+w 0x10441800
+r 0x104fa8c0
+r 0x101d6d00
+w 0x107f2f80
+r 0x104788c0
+r 0x104db100
+r 0x104e3e40
+r 0x101ecbc0
+r 0x10070480
+w 0x10102380
+r 0x105c4cc0
+r 0x107ea200
+r 0x10707640
+r 0x105084c0
+r 0x10608500
+r 0x105c6840
+r 0x101b1040
+w 0x10316200
+r 0x10605d80
+r 0x10112dc0
+r 0x10178540
+r 0x104040c0
+r 0x105ff880
+w 0x1011d280
+r 0x105ca2c0
+r 0x100eb780
+w 0x107c1080
+w 0x10509b80
+r 0x106f4980
+r 0x1061ac00
+r 0x104747c0
+r 0x102a4b80
+r 0x107f0040
+r 0x10050600
+w 0x102a5e40
+r 0x10388580
+r 0x10741dc0
+r 0x10790140
+r 0x107a0e80
+w 0x1008c800
+r 0x100de8c0
+r 0x106aa280
+r 0x100ad140
+r 0x10233900
+r 0x10186c00
+r 0x1051ee00
+r 0x1015f000
+r 0x10080480
+r 0x10155680
+w 0x10078e40
+r 0x1047e780
+r 0x1056fbc0
+w 0x1004edc0
+w 0x101342c0
+r 0x107bb040
+r 0x105ce4c0
+r 0x1068f7c0
+w 0x10746a80
+w 0x1041a040
+r 0x1001e540
+r 0x100dca80
+w 0x106d4dc0
+r 0x10632400
+w 0x1001eb40
+r 0x10786140
+r 0x1028a080
+r 0x1043d880
+r 0x103084c0
+r 0x106ef940
+w 0x1016c200
+r 0x10385180
+w 0x103ab440
+r 0x1075ee40
+r 0x10083a00
+r 0x104e6900
+w 0x1021c540
+r 0x105642c0
+r 0x10242e80
+r 0x1024e900
+r 0x104fd500
+r 0x10106480
+w 0x10614340
+r 0x1026cb00
+r 0x1072fc80
+r 0x102bc440
+w 0x1030f0c0
+w 0x10768900
+r 0x10740500
+r 0x10245280
+r 0x100a6100
+r 0x1044cb00
+r 0x101fd700
+r 0x103efd80
+w 0x10702500
+r 0x10053a80
+r 0x1052c3c0
+r 0x10043780
+w 0x105c6740
+r 0x100a7480
+r 0x100f39c0
+r 0x10529740
+r 0x1063cbc0
+w 0x101a8900
+r 0x104e6280
+r 0x10400880
+r 0x10506a40
+w 0x1073a200
+r 0x1023b1c0
+r 0x1035ae00
+r 0x106d2380
+w 0x10545e40
+w 0x102cc680
+r 0x105e0600
+r 0x1007af00
+r 0x1043bfc0
+w 0x102bda40
+r 0x106182c0
+w 0x106d5b40
+w 0x10670940
+r 0x10642900
+r 0x1004ec40
+r 0x102a6980
+r 0x1040fc00
+w 0x1026a880
+r 0x103715c0
+r 0x1071a040
+r 0x1067c1c0
+r 0x10635400
+r 0x10562580
+w 0x103fd480
+r 0x106259c0
+r 0x10507bc0
+r 0x10557680
+r 0x1044c740
+w 0x102a1000
+r 0x10460a00
+w 0x1007e3c0
+r 0x10492600
+r 0x1036dc00
+r 0x1004f140
+r 0x1044cf00
+w 0x10646cc0
+r 0x105b28c0
+r 0x102d4f40
+w 0x1026a480
+r 0x10589900
+w 0x1047a080
+r 0x1001c540
+r 0x107dd900
+r 0x1037e740
+w 0x10764440
+w 0x10373900
+r 0x1047f440
+r 0x103b2640
+w 0x10443d40
+r 0x10330680
+r 0x107f5f80
+r 0x10675680
+r 0x10724580
+r 0x1077da40
+r 0x107fd200
+w 0x10270dc0
+r 0x100f5780
+r 0x10448ec0
+w 0x10233740
+w 0x100caa40
+r 0x106ab3c0
+r 0x105e92c0
+r 0x10111280
+r 0x100f8b00
+r 0x10228340
+w 0x10378540
+r 0x1038a140
+r 0x105401c0
+r 0x10055f40
+r 0x10273400
+r 0x1051ee40
+w 0x101aafc0
+r 0x107ae180
+r 0x10524ec0
+w 0x1015c600
+r 0x1066d7c0
+r 0x1078cd00
+r 0x104a65c0
+r 0x100c67c0
+r 0x107fa440
+w 0x104f4840
+r 0x10215cc0
+r 0x101db480
+r 0x10718740
+w 0x1076e0c0
+r 0x101cf640
+r 0x1010d580
+r 0x10017cc0
+r 0x1041ba40
+r 0x101cf1c0
+r 0x10160340
+w 0x1017c340
+r 0x1051dac0
+r 0x10513500
+r 0x104589c0
+r 0x10599d40
+r 0x102dc080
+w 0x1000dac0
+r 0x1071fb40
+r 0x104848c0
+w 0x103a6480
+r 0x10643500
+r 0x100f2d40
+r 0x104b7e80
+w 0x10102940
+r 0x104e3640
+r 0x101f1180
+r 0x102ba240
+r 0x10753240
+r 0x10619380
+w 0x1044e4c0
+r 0x1075d280
+r 0x10667bc0
+w 0x107b91c0
+r 0x10011740
+w 0x1055bbc0
+r 0x101ecb40
+r 0x10173380
+r 0x1032f8c0
+r 0x1022b400
+r 0x103d8900
+w 0x10509d80
+r 0x1031ed80
+w 0x1051be40
+r 0x10652140
+r 0x105ff540
+r 0x1037e600
+w 0x1030e500
+w 0x10145fc0
+r 0x10309600
+r 0x101a5300
+r 0x107d3700
+r 0x10661640
+w 0x1019fc40
+r 0x105d7b00
+w 0x10020300
+r 0x10021bc0
+r 0x106e0b80
+r 0x10705b00
+r 0x10058680
+r 0x103dd6c0
+r 0x10598500
+r 0x100bee00
+r 0x1037abc0
+r 0x100f4d80
+w 0x103b6b40
+r 0x1055a680
+r 0x100b9180
+w 0x1055fa40
+w 0x103888c0
+r 0x10669280
+r 0x1022bd80
+r 0x10238dc0
+r 0x10645280
+r 0x102d3a40
+r 0x105ade80
+w 0x10656fc0
+r 0x10606c80
+r 0x1032e280
+r 0x10425140
+r 0x1071b3c0
+w 0x100ffcc0
+r 0x102d9e40
+r 0x104826c0
+r 0x100de300
+w 0x107cea80
+r 0x10361f80
+w 0x1034f800
+r 0x10628080
+w 0x101c2040
+r 0x104ad080
+r 0x105385c0
+w 0x10299780
+r 0x104e6780
+r 0x103074c0
+w 0x1023cf80
+r 0x106619c0
+r 0x1053dc80
+r 0x10653bc0
+r 0x10578840
+w 0x1048e240
+w 0x106c6d80
+w 0x106487c0
+r 0x10074f00
+r 0x100e6a00
+r 0x102889c0
+r 0x1016e280
+r 0x104595c0
+r 0x10257b40
+r 0x1053e540
+w 0x10499780
+w 0x10197600
+r 0x1071c5c0
+r 0x105134c0
+r 0x100ba7c0
+w 0x1043d9c0
+r 0x10206f00
+r 0x104d3380
+r 0x100de580
+r 0x106b3280
+w 0x103ff3c0
+r 0x104b1280
+r 0x1024c280
+w 0x100b5140
+r 0x10034dc0
+r 0x101fe100
+w 0x100daf80
+w 0x1044db00
+r 0x10170d00
+r 0x10034800
+r 0x1006a900
+r 0x10443cc0
+r 0x1058d040
+r 0x107b9c80
+w 0x10404340
+r 0x106bc300
+w 0x1009b640
+w 0x102b26c0
+r 0x107a2c40
+w 0x10454240
+r 0x104c6e80
+r 0x107358c0
+r 0x107c3dc0
+r 0x106695c0
+r 0x103aea00
+r 0x10718180
+r 0x10348380
+r 0x105c0c80
+w 0x1033fe80
+r 0x1078ea00
+r 0x10043cc0
+r 0x1003a140
+r 0x10066e00
+r 0x107a2b00
+w 0x107fd340
+r 0x10752700
+r 0x10277e40
+r 0x106f3dc0
+r 0x10696240
+r 0x102f5400
+w 0x1076d680
+w 0x102ae4c0
+r 0x100cf380
+r 0x101a2e40
+r 0x101ae000
+r 0x107a3000
+r 0x10401dc0
+w 0x100dd300
+r 0x10564540
+r 0x1072ed80
+w 0x106d4f80
+w 0x10444cc0
+r 0x10459d00
+r 0x10655d00
+r 0x102bb000
+r 0x1062aa80
+w 0x1009c400
+w 0x10517d80
+r 0x10064980
+w 0x107e9380
+r 0x10620100
+w 0x10562e40
+r 0x101aaac0
+r 0x1056c000
+w 0x105400c0
+r 0x10373c40
+r 0x10271300
+r 0x105c3a00
+r 0x10305180
+w 0x10005dc0
+r 0x10210140
+r 0x107fb0c0
+w 0x105020c0
+r 0x1065d800
+r 0x104cacc0
+r 0x104c3cc0
+r 0x102ebc00
+w 0x1007a380
+r 0x10177dc0
+r 0x103fc700
+r 0x101c94c0
+r 0x106ba040
+r 0x1043e400
+w 0x103ce380
+r 0x10779700
+r 0x1012e300
+w 0x1038a5c0
+r 0x10488d80
+w 0x1067d5c0
+r 0x10765280
+r 0x10693d40
+w 0x10661180
+r 0x1027d040
+w 0x10347340
+r 0x105160c0
+r 0x1031e8c0
+w 0x10722200
+w 0x10545500
+w 0x10061e00
+r 0x107ece80
+r 0x10506e40
+r 0x104bcac0
+r 0x1009ef40
+r 0x102a3c80
+r 0x10543480
+r 0x100efe40
+r 0x1068b940
+r 0x103b8380
+r 0x100f0000
+w 0x10292640
+r 0x1042fdc0
+w 0x10425b40
+r 0x10144140
+w 0x10709f80
+w 0x107fc7c0
+w 0x100fd940
+r 0x10067a40
+r 0x102a0200
+r 0x10285d00
+r 0x102c5680
+r 0x1016b080
+r 0x10613440
+r 0x1025f880
+r 0x104d0080
+r 0x102c27c0
+r 0x1079fd80
+r 0x1016e180
+w 0x102a9c40
+r 0x105d0a40
+r 0x102fed00
+r 0x1002a640
+r 0x107bc180
+r 0x100f1240
+r 0x1041d800
+w 0x104115c0
+w 0x1063b340
+r 0x10566600
+r 0x103c1f80
+r 0x107d5d00
+r 0x102a4dc0
+w 0x106d32c0
+r 0x10624fc0
+r 0x10089600
+w 0x102ec8c0
+r 0x100494c0
+w 0x10522cc0
+r 0x107a92c0
+r 0x1078e000
+w 0x100208c0
+r 0x104d22c0
+r 0x105f8540
+r 0x10540d80
+r 0x104e0440
+r 0x107f3100
+w 0x10197400
+w 0x10536880
+w 0x100d2f40
+r 0x1010a200
+r 0x100e00c0
+w 0x107850c0
+r 0x105a9040
+r 0x1022ad40
+r 0x1024bc00
+r 0x1034f180
+w 0x10556800
+w 0x10468840
+r 0x1016f200
+r 0x1013dd80
+r 0x102b4d00
+r 0x10183780
+r 0x1079d940
+r 0x1011fe00
+r 0x1010ce40
+r 0x104b0d40
+r 0x10132ac0
+r 0x102d2240
+r 0x10782880
+w 0x10176580
+r 0x10640280
+w 0x105d8bc0
+w 0x102d3580
+r 0x107f59c0
+r 0x1073a900
+w 0x107c0640
+r 0x105eec80
+w 0x107d7ac0
+r 0x1008bd40
+w 0x1016cd40
+w 0x1031f240
+r 0x100dcc00
+w 0x107dcf00
+r 0x102cec00
+r 0x101e4880
+r 0x10044ac0
+r 0x102bc280
+w 0x1070c680
+r 0x106c9d00
+r 0x104c21c0
+w 0x103f6500
+w 0x105093c0
+w 0x10679340
+r 0x10115e40
+r 0x10187000
+r 0x107f4f80
+r 0x104ba980
+r 0x106cb4c0
+r 0x103d3e40
+w 0x105a4740
+r 0x10160c00
+w 0x10608680
+w 0x101878c0
+r 0x107db800
+r 0x10280c80
+r 0x1044b8c0
+w 0x10361ac0
+r 0x1078f140
+r 0x107de680
+w 0x104477c0
+r 0x10555880
+r 0x10148000
+r 0x10140080
+r 0x10499340
+r 0x101c0dc0
+w 0x10519700
+r 0x10162680
+r 0x102b8600
+r 0x1022c700
+r 0x100c7240
+w 0x10601f00
+r 0x10747bc0
+r 0x106f7bc0
+r 0x103e8bc0
+w 0x1018bb00
+r 0x101f5480
+w 0x1049fcc0
+w 0x102d4740
+w 0x1047c580
+w 0x104df300
+r 0x106937c0
+r 0x100f32c0
+r 0x106be000
+r 0x105d9300
+w 0x1008c200
+r 0x103ac8c0
+r 0x10135000
+r 0x100e0ec0
+w 0x10744f40
+r 0x1048c480
+w 0x103945c0
+r 0x102a6940
+r 0x104cfbc0
+w 0x1005fe80
+r 0x106c59c0
+w 0x105d3640
+r 0x1075e840
+w 0x10438d80
+r 0x10447680
+w 0x104cd640
+r 0x1003d940
+r 0x10393940
+w 0x101a7540
+r 0x10779840
+w 0x103fa3c0
+r 0x10054e00
+w 0x105ef280
+r 0x1014c1c0
+r 0x102b5c40
+r 0x10518100
+w 0x10358a40
+r 0x101e7440
+r 0x1007c400
+r 0x100e5080
+r 0x10705380
+r 0x105b0240
+r 0x107e0a40
+r 0x1058fe80
+w 0x101ec2c0
+r 0x10528e00
+r 0x10037cc0
+r 0x106f08c0
+r 0x101ffa00
+r 0x1029af40
+r 0x1029ddc0
+w 0x103dae40
+w 0x1041dd00
+w 0x1075eac0
+r 0x1043fc00
+r 0x10205f40
+r 0x10360e00
+w 0x1075ecc0
+w 0x10051480
+r 0x103fe680
+r 0x105ea000
+w 0x1036a740
+w 0x101b1940
+r 0x103cd340
+r 0x101a6140
+r 0x10688640
+r 0x10727d00
+w 0x1064bc40
+w 0x10669fc0
+r 0x100ef6c0
+w 0x10506cc0
+w 0x107a2880
+w 0x1079e240
+r 0x107a29c0
+w 0x10485dc0
+w 0x10246380
+w 0x10016cc0
+r 0x1060ee40
+r 0x104e7ec0
+r 0x1051c240
+r 0x101d8a00
+r 0x104bc6c0
+r 0x106c3780
+r 0x102c8a80
+w 0x1076f400
+r 0x1012e2c0
+w 0x10301840
+w 0x10684cc0
+r 0x10363280
+r 0x107a1100
+r 0x1036e100
+r 0x1046a280
+r 0x105d5c80
+r 0x10741440
+w 0x1014dc40
+w 0x1060d000
+r 0x10268680
+r 0x100e4300
+r 0x100edd40
+r 0x101a6600
+w 0x10627d40
+w 0x104f8e40
+w 0x100e1180
+w 0x10688580
+w 0x10401280
+w 0x1004bf00
+r 0x10482c80
+r 0x10104f80
+w 0x106a1b00
+r 0x105b7680
+r 0x102d17c0
+r 0x10455e40
+r 0x10471f40
+w 0x1022cc40
+w 0x1013b5c0
+w 0x105456c0
+w 0x101a8500
+w 0x106ac2c0
+r 0x105520c0
+r 0x102d2e00
+r 0x10787740
+w 0x10504780
+r 0x10047b80
+w 0x107504c0
+w 0x100ae800
+r 0x10714280
+r 0x10595c00
+r 0x10406ec0
+w 0x1049ad80
+w 0x1018e380
+w 0x1037ffc0
+r 0x1011d700
+w 0x10019000
+r 0x10653fc0
+w 0x106ca840
+r 0x106e0a00
+r 0x10750d00
+r 0x1046ee80
+r 0x10142080
+w 0x10431880
+r 0x10535e80
+w 0x10306c00
+r 0x10009f00
+r 0x1062ba80
+r 0x1061ac40
+w 0x101dd500
+r 0x10115440
+r 0x1045cf40
+r 0x105c6a80
+r 0x10786400
+r 0x10539c40
+r 0x10636040
+r 0x10354940
+r 0x100e8b40
+r 0x101a1640
+r 0x10022480
+w 0x107c3cc0
+r 0x106da200
+r 0x104df380
+w 0x103ad940
+w 0x107ea100
+r 0x106c01c0
+r 0x1076e980
+w 0x103029c0
+r 0x106e38c0
+r 0x103a6140
+w 0x1059e200
+r 0x10333900
+w 0x101e2ec0
+r 0x106fd5c0
+r 0x1020d200
+r 0x10351e80
+r 0x10139600
+r 0x10401dc0
+r 0x10412e00
+r 0x105f2600
+w 0x1037d580
+r 0x10088c80
+r 0x10071cc0
+w 0x10738680
+w 0x103a5300
+r 0x10541200
+w 0x103d9d00
+r 0x1025aa00
+w 0x10549ec0
+r 0x10427f40
+r 0x107bf940
+r 0x107a3040
+r 0x1052d600
+w 0x104b3cc0
+r 0x10471f00
+r 0x106ebdc0
+r 0x1002bc80
+r 0x10330280
+w 0x1027a640
+r 0x103f5c40
+r 0x1004cb80
+w 0x1057e540
+r 0x102c8740
+r 0x10724440
+r 0x10267f00
+r 0x106d80c0
+r 0x10220a40
+r 0x10474fc0
+r 0x101eaec0
+w 0x107a8c00
+r 0x104c29c0
+r 0x107a7000
+w 0x1031a600
+r 0x1057ec80
+r 0x1077c500
+w 0x10660a00
+r 0x1024de40
+w 0x10573000
+w 0x107f1840
+r 0x1052c5c0
+w 0x102ea200
+w 0x103c4200
+r 0x100b6b80
+r 0x107aa540
+r 0x10676280
+r 0x10330e40
+w 0x107fbfc0
+w 0x100e51c0
+r 0x1018f640
+r 0x10003900
+w 0x10439f00
+r 0x1047b700
+r 0x106e0580
+r 0x10609900
+w 0x10552d00
+r 0x1042ae40
+w 0x1054e940
+r 0x10579080
+r 0x10688100
+r 0x10673cc0
+w 0x103a2dc0
+r 0x10148740
+r 0x104946c0
+w 0x1039ab00
+r 0x1024f580
+w 0x1070e200
+w 0x101e0b40
+r 0x104f1d00
+r 0x106ae940
+r 0x105cb900
+w 0x102f9b80
+r 0x103aadc0
+w 0x101c9900
+r 0x1045b240
+r 0x10713900
+r 0x10538b80
+r 0x106dbd80
+r 0x102145c0
+r 0x107c8c00
+w 0x1058c5c0
+r 0x107d9300
+r 0x103cc780
+r 0x105e6dc0
+r 0x10000880
+r 0x1058d880
+r 0x104d0ac0
+r 0x10736880
+w 0x10110980
+r 0x103d3c00
+r 0x1005f280
+r 0x100a44c0
+r 0x107a0b00
+r 0x1059eb80
+r 0x10780a00
+r 0x10370ec0
+w 0x106b3f40
+r 0x104f9f40
+r 0x103b1a40
+r 0x10343780
+r 0x10059dc0
+r 0x1006c9c0
+w 0x105a14c0
+r 0x101bf440
+w 0x100e9d80
+r 0x105db440
+w 0x1011b900
+r 0x1019d240
+r 0x10271c00
+w 0x10164140
+r 0x10443440
+r 0x104e2740
+r 0x103a4440
+r 0x100b5280
+r 0x102353c0
+r 0x1040b7c0
+w 0x10451d40
+r 0x104464c0
+r 0x101f6000
+r 0x100d2c80
+r 0x10125fc0
+r 0x10121700
+w 0x107ea180
+r 0x101c5840
+r 0x10470980
+r 0x1014b640
+r 0x103f0cc0
+r 0x10311600
+w 0x100beb80
+r 0x104f5cc0
+w 0x1016e4c0
+w 0x10179c00
+w 0x10243140
+r 0x10343080
+r 0x104f6680
+r 0x105d7f40
+r 0x1052bfc0
+r 0x1066d3c0
+w 0x1008a100
+r 0x1050f7c0
+r 0x1027a940
+r 0x101b9e40
+r 0x1071ae80
+r 0x104dbbc0
+r 0x1021aa80
+w 0x107e91c0
+r 0x102a6140
+r 0x10684d80
+w 0x1076bb40
+w 0x10418b00
+w 0x10677c80
+r 0x107c2680
+r 0x103ae540
+w 0x105ec1c0
+r 0x106423c0
+r 0x1033e000
+r 0x10374c00
+r 0x106430c0
+r 0x100dba40
+w 0x100cd180
+w 0x103e6f80
+w 0x1041d6c0
+w 0x105511c0
+r 0x10534e00
+w 0x10618780
+r 0x10769040
+r 0x102dbd40
+r 0x10557800
+w 0x102fe3c0
+r 0x103d94c0
+r 0x106d9140
+r 0x1043f880
+r 0x10284e40
+w 0x10408580
+r 0x107f0b00
+r 0x10472300
+r 0x1054da00
+r 0x1007b100
+w 0x1021ec00
+r 0x1026d640
+r 0x105558c0
+r 0x10280440
+w 0x1039f380
+w 0x10247340
+w 0x106ec7c0
+w 0x1071ce40
+w 0x1029f8c0
+r 0x10681fc0
+r 0x10714700
+r 0x10769200
+w 0x101788c0
+r 0x1015a600
+w 0x102e6d40
+w 0x100fa4c0
+r 0x107be000
+r 0x10420a80
+w 0x10075b80
+r 0x102a1540
+w 0x1077e780
+r 0x105b9b80
+r 0x102b7840
+w 0x10371dc0
+w 0x106e52c0
+r 0x10462d40
+w 0x10703a40
+r 0x1059ecc0
+r 0x10486340
+r 0x1063d000
+r 0x10598a00
+r 0x107373c0
+r 0x10550f00
+r 0x1072d800
+r 0x10054f80
+r 0x10361040
+r 0x100fcf40
+r 0x105c0980
+r 0x10453400
+r 0x1027df40
+w 0x102ce980
+r 0x10684d00
+r 0x10730e00
+r 0x1024a380
+w 0x1067a100
+r 0x100f6740
+r 0x1049e080
+r 0x1046c040
+w 0x10798f00
+r 0x10452240
+r 0x10629640
+r 0x10384580
+r 0x10528840
+r 0x10547280
+r 0x1002e0c0
+w 0x102ad740
+w 0x107c06c0
+r 0x102696c0
+w 0x1058e080
+r 0x1020a400
+r 0x104a9580
+r 0x1033f080
+r 0x101384c0
+r 0x10652240
+r 0x104ea8c0
+r 0x101b2940
+r 0x107073c0
+w 0x107eb480
+r 0x105ed600
+r 0x1028cfc0
+w 0x10628ac0
+r 0x106e79c0
+r 0x104451c0
+r 0x1061cd00
+w 0x10670900
+w 0x101950c0
+r 0x100f9fc0
+r 0x102630c0
+w 0x104cfd40
+w 0x1072c180
+r 0x10391880
+w 0x104366c0
+r 0x1041a500
+r 0x10610a80
+r 0x101bf0c0
+r 0x1072c9c0
+w 0x106af540
+r 0x10451300
+w 0x105e12c0
+w 0x10058400
+r 0x100b71c0
+r 0x106c5e80
+r 0x1002e780
+w 0x1044ee40
+r 0x1036f5c0
+w 0x1036cc00
+r 0x105d30c0
+r 0x102b4cc0
+r 0x10207900
+r 0x102039c0
+w 0x10071380
+r 0x107a8780
+w 0x107bf500
+w 0x10346c00
+w 0x102bbf00
+r 0x103db3c0
+w 0x105f2b40
+w 0x10121c80
+r 0x105b9780
+w 0x101698c0
+r 0x10074680
+w 0x10356340
+w 0x104e8380
+w 0x105dfd40
+r 0x10694580
+w 0x10675180
+r 0x106bf040
+r 0x10193e00
+r 0x105a7780
+r 0x10079380
+r 0x1054fa00
+w 0x104fd080
+r 0x10775cc0
+w 0x1011b140
+r 0x107a0e00
+r 0x101fabc0
+w 0x103a4cc0
+w 0x1066f780
+r 0x103429c0
+w 0x1003fa40
+w 0x103115c0
+r 0x1074f4c0
+r 0x101a0580
+r 0x10606b40
+r 0x105c4d80
+r 0x10069640
+r 0x1005a5c0
+r 0x10552dc0
+w 0x10080540
+r 0x10776800
+w 0x102fc080
+w 0x100e1180
+r 0x100c7640
+r 0x104a4480
+r 0x101fff80
+r 0x101141c0
+r 0x1047c8c0
+w 0x107ffe00
+r 0x1044a580
+w 0x10490780
+w 0x10638080
+r 0x102d4f40
+r 0x106589c0
+r 0x100a7080
+r 0x10375180
+r 0x1061aa40
+r 0x103eed40
+w 0x101e34c0
+r 0x100e5700
+r 0x10481cc0
+r 0x103cb000
+r 0x100dfa80
+r 0x103908c0
+r 0x1042cd40
+w 0x104c9640
+r 0x1063d780
+r 0x10658fc0
+r 0x1057bd00
+r 0x1009d9c0
+w 0x10726fc0
+w 0x102d0e40
+r 0x10352d00
+r 0x101a3e80
+r 0x100e7b80
+r 0x102a8640
+r 0x1010eb00
+w 0x10720c40
+w 0x102826c0
+r 0x10683200
+r 0x103dc900
+w 0x100841c0
+r 0x106e5480
+r 0x10021d40
+r 0x10026600
+w 0x105bc7c0
+r 0x102b7400
+w 0x106655c0
+r 0x10555980
+r 0x1016b2c0
+r 0x10611200
+r 0x10528380
+r 0x100a6300
+r 0x10635480
+w 0x1078e940
+r 0x101bb0c0
+r 0x104f1400
+w 0x10569fc0
+r 0x10652a00
+r 0x100bea80
+r 0x10548480
+r 0x107352c0
+r 0x10366a00
+r 0x10161a80
+r 0x1062e300
+w 0x1042b900
+r 0x1028bc00
+r 0x10499700
+r 0x1039d4c0
+r 0x10736800
+r 0x104feb00
+w 0x101a8e80
+r 0x106ffb80
+w 0x10446080
+r 0x10347280
+r 0x1068fdc0
+r 0x104e3200
+r 0x107651c0
+r 0x103be100
+w 0x10566900
+w 0x1000a200
+r 0x10109540
+r 0x102d5400
+w 0x107ca680
+r 0x102b4b40
+r 0x10361e00
+r 0x107cf4c0
+w 0x10269500
+r 0x1077e940
+r 0x102e2380
+r 0x1050c600
+r 0x1028b0c0
+r 0x105ab380
+r 0x106b32c0
+w 0x103a6200
+r 0x1007df00
+w 0x105255c0
+w 0x103f9dc0
+r 0x10529fc0
+r 0x10123500
+w 0x1050d980
+r 0x101d4f40
+r 0x106ad540
+r 0x1056b440
+r 0x10715e80
+r 0x10793800
+w 0x1064e900
+w 0x107b9940
+r 0x105ca700
+r 0x10556040
+w 0x106c21c0
+w 0x1055c500
+r 0x102d6ec0
+w 0x106b4b00
+r 0x10163a40
+r 0x107b8380
+w 0x1064d400
+w 0x102df640
+r 0x1022edc0
+r 0x102ad840
+r 0x10470d40
+r 0x10392e00
+w 0x107a8e80
+r 0x105929c0
+w 0x10210400
+r 0x106dde80
+r 0x10019500
+r 0x100a8940
+w 0x106d7680
+r 0x10419380
+r 0x10224940
+w 0x10702700
+w 0x10175640
+r 0x1075dc80
+r 0x10306940
+r 0x10319500
+r 0x101c6b00
+r 0x10228e80
+w 0x10672c40
+w 0x10779980
+r 0x1023dc00
+r 0x1025b240
+w 0x10693680
+r 0x101785c0
+r 0x1059f6c0
+r 0x102ceb00
+r 0x101f70c0
+r 0x10222400
+r 0x1062b940
+r 0x107cd600
+r 0x1021e2c0
+r 0x10628680
+r 0x10376840
+r 0x1023f380
+w 0x1059e000
+r 0x10353a00
+r 0x103022c0
+r 0x105996c0
+r 0x10620780
+r 0x106ee880
+r 0x103db300
+r 0x105119c0
+r 0x10468080
+r 0x106a2b40
+r 0x10373800
+r 0x102b6300
+r 0x1031f1c0
+r 0x10243080
+r 0x103781c0
+r 0x106db040
+w 0x101457c0
+w 0x10478980
+w 0x107e9d80
+w 0x1009e0c0
+r 0x1040ac00
+r 0x106178c0
+w 0x10108140
+r 0x106e8480
+w 0x100f1840
+w 0x10113080
+r 0x102320c0
+w 0x106f3180
+r 0x107717c0
+r 0x1020e800
+r 0x103913c0
+w 0x10476840
+r 0x10553e00
+r 0x105c9400
+r 0x10251b40
+r 0x1044c480
+w 0x10654100
+w 0x104d4900
+r 0x102e6080
+r 0x100f5140
+w 0x10223240
+r 0x10520980
+w 0x103fc100
+r 0x10384940
+w 0x1073b580
+r 0x10156f40
+r 0x10117180
+r 0x1042d040
+w 0x10758540
+w 0x1037e4c0
+r 0x107db400
+r 0x1033a600
+r 0x10538a80
+w 0x102b53c0
+w 0x10130e40
+r 0x10690580
+r 0x100f6ec0
+w 0x106e1440
+w 0x10070000
+w 0x103656c0
+w 0x10606cc0
+r 0x10492900
+w 0x1033c600
+r 0x10797000
+r 0x10203280
+w 0x1047b600
+w 0x10519300
+r 0x102ff1c0
+w 0x10462080
+w 0x10264380
+r 0x100dfa80
+r 0x1027eec0
+r 0x104e9240
+w 0x10332fc0
+w 0x1075acc0
+w 0x100e4400
+r 0x1053ec80
+r 0x10138100
+r 0x1075af00
+w 0x101977c0
+w 0x10245640
+r 0x1032c940
+w 0x10466b00
+r 0x106d2d00
+w 0x105edb00
+r 0x103db940
+w 0x106f5280
+r 0x10086fc0
+r 0x103ad6c0
+w 0x1044dd40
+r 0x10298600
+r 0x100c9e40
+r 0x1007b440
+w 0x103a50c0
+r 0x107a0f00
+r 0x100e0400
+r 0x103f90c0
+r 0x100d74c0
+r 0x10190940
+w 0x101c3200
+r 0x105cad40
+r 0x1012eb80
+r 0x106228c0
+w 0x10436880
+w 0x10019400
+w 0x1031cb00
+w 0x1005a2c0
+r 0x103bb440
+w 0x1066e800
+r 0x101dd040
+r 0x10548b00
+w 0x1034fe00
+w 0x104bd140
+r 0x10385d40
+r 0x10176c80
+r 0x1046a600
+w 0x10349c80
+r 0x10112a00
+w 0x10723340
+w 0x10340e00
+w 0x10634200
+r 0x1043fbc0
+r 0x100a96c0
+w 0x107b5300
+r 0x1037d9c0
+r 0x10170f80
+w 0x10577e00
+r 0x1039e300
+w 0x1019b800
+r 0x103843c0
+w 0x10368a00
+r 0x100de400
+r 0x10346f40
+w 0x102b01c0
+r 0x10378d80
+w 0x1063bcc0
+r 0x104b9780
+w 0x100d19c0
+r 0x10285800
+w 0x104e2200
+r 0x1041bd00
+r 0x105a2540
+w 0x1033fcc0
+r 0x1007f080
+w 0x102f9bc0
+r 0x103f0740
+r 0x107d35c0
+r 0x1054b380
+w 0x104b6fc0
+r 0x10772d00
+w 0x104c7100
+r 0x10370ec0
+r 0x10169d80
+r 0x10279d00
+r 0x107a3400
+w 0x100e1940
+r 0x10630100
+w 0x1035e640
+r 0x10272700
+w 0x10016500
+r 0x100d99c0
+r 0x107d1e40
+r 0x10761b00
+r 0x1068df80
+w 0x1059ab40
+r 0x10243540
+r 0x101be6c0
+r 0x101d5c80
+r 0x10044500
+w 0x1021f400
+w 0x106a0b40
+w 0x10385200
+r 0x1071c0c0
+w 0x101be3c0
+w 0x106c9480
+r 0x10140680
+r 0x10268080
+r 0x107a9ac0
+r 0x1010af00
+w 0x101cf900
+r 0x10708fc0
+w 0x10659100
+r 0x103e9800
+r 0x10613b00
+r 0x1026a800
+r 0x107d1bc0
+w 0x10271400
+r 0x1066c5c0
+r 0x10483d00
+w 0x101a15c0
+r 0x10673f00
+w 0x1078b640
+r 0x1075b580
+r 0x102a1080
+r 0x1045d200
+r 0x1012ee00
+w 0x1038a400
+r 0x10476200
+r 0x102c2980
+r 0x103da180
+r 0x107494c0
+r 0x107b5f80
+r 0x1014b680
+w 0x101d17c0
+r 0x10565080
+r 0x101cf7c0
+r 0x1034d380
+r 0x102cd4c0
+r 0x106bb100
+w 0x10116b00
+r 0x10036300
+w 0x107cc980
+r 0x10756e80
+w 0x1004a380
+r 0x104f5d40
+r 0x1037e840
+w 0x100d8680
+w 0x107ac840
+r 0x10210c00
+r 0x10712500
+r 0x10191340
+r 0x10588dc0
+r 0x105a6480
+r 0x10285500
+r 0x10756400
+r 0x10109b80
+r 0x105833c0
+r 0x1035cb80
+r 0x1006da40
+r 0x10475700
+r 0x1020bb00
+w 0x10428e80
+w 0x105cf180
+r 0x107908c0
+r 0x103abb40
+r 0x100d2480
+w 0x101f1a40
+w 0x1020c200
+r 0x10098000
+r 0x101c4a80
+r 0x10611b40
+w 0x101af000
+r 0x10037e00
+w 0x106e5540
+r 0x100cd7c0
+w 0x10634440
+r 0x102ce400
+r 0x104e1100
+r 0x104c1c40
+r 0x103e10c0
+r 0x1005cd00
+r 0x1068d0c0
+r 0x1002b0c0
+w 0x1041d100
+r 0x10779b40
+r 0x101a1540
+r 0x101bd980
+w 0x101841c0
+r 0x10735740
+r 0x1027b440
+w 0x102a0e80
+r 0x10719c00
+r 0x10700340
+w 0x103b2140
+r 0x10612ec0
+w 0x1012d5c0
+r 0x1049ef00
+r 0x1045aa40
+r 0x10146ac0
+r 0x10148d00
+w 0x101b8c40
+r 0x102ffd80
+r 0x10751d00
+r 0x106dcd40
+r 0x10188ec0
+r 0x106522c0
+r 0x106b64c0
+r 0x106d2380
+w 0x10284e00
+w 0x1018f700
+r 0x100c5fc0
+r 0x106083c0
+r 0x100b32c0
+r 0x10156000
+r 0x1032acc0
+r 0x106859c0
+r 0x104a6ec0
+r 0x10140300
+r 0x104be9c0
+w 0x1072c780
+r 0x10130800
+r 0x100cf740
+r 0x103db700
+r 0x10151e00
+w 0x1007a5c0
+w 0x10619140
+w 0x1005e340
+r 0x101a0f00
+r 0x104d8780
+r 0x101bf3c0
+r 0x101e2940
+w 0x1068d700
+r 0x102217c0
+w 0x107e5cc0
+r 0x1040ad00
+r 0x107503c0
+w 0x104f2f00
+r 0x107cbc00
+r 0x10342480
+w 0x101d27c0
+r 0x100b7bc0
+r 0x1015de40
+w 0x102e82c0
+w 0x1046fec0
+w 0x10208d40
+r 0x106717c0
+w 0x10623140
+r 0x100ab480
+w 0x1057eb00
+w 0x10570940
+w 0x1034dc80
+r 0x10553c40
+w 0x10649380
+r 0x1014eec0
+w 0x100a4800
+r 0x107f3cc0
+r 0x107d3640
+r 0x1023e1c0
+r 0x105d2340
+w 0x105cb7c0
+r 0x106e1d40
+r 0x10298480
+r 0x107600c0
+r 0x10437740
+w 0x10231840
+r 0x10475d40
+r 0x1035d180
+w 0x10050100
+w 0x10088600
+r 0x100b2440
+r 0x100a45c0
+w 0x10234140
+r 0x10626680
+r 0x103f2b40
+r 0x1013f6c0
+r 0x104aeb40
+r 0x1021ab40
+r 0x105dc140
+r 0x10623dc0
+r 0x1026bb00
+r 0x10054800
+r 0x1034d3c0
+r 0x10203440
+w 0x107ce6c0
+r 0x1061e640
+r 0x1058e140
+r 0x10214cc0
+r 0x102ebc00
+r 0x10537040
+r 0x1035db00
+w 0x100a0bc0
+w 0x106aca00
+w 0x104cec00
+r 0x102f8580
+r 0x10203e00
+r 0x10723a40
+r 0x105ff2c0
+r 0x101a8480
+r 0x104a0400
+r 0x1054b3c0
+r 0x1045de00
+r 0x1033f980
+r 0x107a0400
+r 0x106b5b80
+r 0x1065ef80
+r 0x1019f140
+r 0x103d5e00
+r 0x10668dc0
+r 0x1036c940
+w 0x10095280
+r 0x1011dc80
+r 0x10366040
+r 0x1019b2c0
+r 0x107d1b00
+r 0x10127ec0
+w 0x10527cc0
+w 0x103c16c0
+r 0x104ed3c0
+w 0x104f2940
+r 0x10436580
+r 0x104e10c0
+r 0x102a1e80
+r 0x1052a180
+r 0x107fb280
+r 0x1059c480
+r 0x10553a80
+w 0x107f1e00
+w 0x10712800
+r 0x106d1040
+r 0x105ada80
+w 0x102d7600
+r 0x10073600
+w 0x106bb680
+r 0x1075ef40
+r 0x102c3b00
+r 0x102da7c0
+w 0x10217300
+w 0x107e0500
+w 0x10550800
+r 0x102d4e40
+r 0x1001cf80
+r 0x1020c600
+r 0x1076b680
+w 0x100116c0
+w 0x10420200
+r 0x10277a00
+r 0x10299000
+w 0x102acd40
+r 0x104b9580
+w 0x106bfa40
+r 0x1018d0c0
+r 0x10264000
+r 0x104e6880
+r 0x10382680
+r 0x104bbfc0
+r 0x10374340
+r 0x106e6f80
+r 0x102e0080
+w 0x1065f240
+w 0x10523500
+w 0x10639000
+w 0x10707680
+r 0x1018db00
+r 0x107fa000
+w 0x10037540
+r 0x103c5000
+r 0x1065fd00
+w 0x102cc800
+r 0x1023b580
+r 0x106495c0
+w 0x10374300
+w 0x101cd740
+w 0x107ae440
+r 0x1016e640
+r 0x10453940
+w 0x1049c840
+r 0x105affc0
+r 0x105081c0
+w 0x103f5380
+r 0x107fe540
+r 0x102af180
+w 0x103d2f80
+r 0x106d5880
+r 0x10742f80
+r 0x10747300
+r 0x10775640
+w 0x10253640
+r 0x1033c840
+r 0x102e5c80
+r 0x104b5780
+r 0x10595680
+r 0x107da140
+r 0x100e8900
+r 0x10431080
+r 0x105738c0
+r 0x10013100
+r 0x107ff6c0
+w 0x105c3880
+r 0x10552680
+r 0x105e9400
+r 0x101de080
+r 0x10444f80
+r 0x103b9ec0
+r 0x1076dd80
+r 0x10223180
+r 0x10484200
+r 0x10205380
+r 0x10216200
+w 0x10025e80
+w 0x10270040
+w 0x102e0d80
+w 0x1018ff00
+r 0x10695780
+r 0x102c5040
+r 0x100349c0
+r 0x10144d80
+r 0x106a2340
+w 0x1056e800
+w 0x10289200
+r 0x104faac0
+r 0x105e2700
+r 0x107c81c0
+r 0x10295980
+w 0x105c6d00
+r 0x106927c0
+r 0x103b85c0
+r 0x10534040
+w 0x106a7840
+r 0x10547b40
+r 0x10637a00
+r 0x1033a200
+r 0x10452480
+r 0x104bdfc0
+w 0x1051db40
+r 0x103fc9c0
+r 0x103ff0c0
+w 0x10303340
+r 0x103fbb40
+r 0x1042c080
+w 0x10032d00
+r 0x10030d40
+r 0x10434100
+r 0x1050dd00
+r 0x104b5bc0
+r 0x1017fd40
+r 0x1000aa80
+r 0x107c6580
+r 0x10712140
+r 0x103eb180
+r 0x1011c980
+w 0x10178840
+r 0x10548480
+w 0x1057d940
+r 0x1023f6c0
+r 0x1002b2c0
+r 0x1038f840
+r 0x10730e80
+r 0x1071d680
+r 0x105a3780
+r 0x10209d40
+w 0x10364180
+w 0x100d6600
+w 0x1048e840
+r 0x10245540
+w 0x105aaf00
+r 0x10324180
+r 0x100f3e00
+r 0x100eee80
+r 0x101dcc40
+r 0x10104d40
+r 0x10329c80
+w 0x107a0940
+r 0x106fdf80
+w 0x10428c00
+w 0x1068d540
+r 0x102e7280
+r 0x1046bc00
+r 0x10790140
+w 0x100b6700
+r 0x107a6440
+r 0x10133000
+w 0x10215980
+w 0x10050b00
+r 0x1028d140
+r 0x104eee40
+r 0x105d0bc0
+r 0x1071d940
+r 0x106a7300
+r 0x101d9740
+r 0x102f78c0
+w 0x10414100
+r 0x106c1c40
+r 0x10206c80
+r 0x1049f840
+r 0x106e3180
+r 0x10322140
+r 0x1072f140
+w 0x100be380
+r 0x100a9e40
+r 0x105b4f80
+r 0x103c6780
+r 0x106f8200
+r 0x1020d4c0
+r 0x103d74c0
+w 0x10042680
+r 0x104f3940
+r 0x1021ddc0
+w 0x10534d80
+r 0x1056b080
+r 0x104562c0
+r 0x10076840
+r 0x106f31c0
+r 0x10789cc0
+r 0x104dae40
+w 0x10110580
+r 0x1044ad80
+r 0x10055880
+r 0x1063a8c0
+w 0x1031c100
+r 0x10076980
+w 0x10439d40
+r 0x10083f00
+w 0x101feb40
+r 0x104b4200
+r 0x103d88c0
+w 0x10640ac0
+r 0x105f0f40
+r 0x102adb80
+r 0x10618400
+w 0x101405c0
+r 0x103158c0
+r 0x100318c0
+r 0x106ae240
+w 0x1032ef80
+r 0x103c4a40
+w 0x1063da80
+w 0x107139c0
+r 0x107f24c0
+r 0x10638dc0
+w 0x105c9a00
+r 0x1053d900
+w 0x104b6380
+w 0x1003e6c0
+r 0x10509100
+r 0x1065f980
+r 0x106ebf80
+w 0x100c8940
+r 0x10733b80
+r 0x100e1580
+r 0x1060d480
+w 0x100753c0
+r 0x104d9280
+w 0x1036d200
+r 0x10541040
+w 0x103ba040
+w 0x10455000
+r 0x10206880
+r 0x10283340
+r 0x1049c340
+r 0x10026d80
+r 0x102f2740
+r 0x10311540
+r 0x1056e240
+r 0x10388fc0
+w 0x106e14c0
+w 0x10094cc0
+w 0x104b7940
+w 0x1002cdc0
+r 0x105fb6c0
+r 0x101dc440
+r 0x10473480
+r 0x105a7300
+r 0x101debc0
+r 0x104fe140
+r 0x101fbb80
+r 0x10171040
+w 0x103a83c0
+r 0x105f7dc0
+w 0x100bfec0
+r 0x10301d00
+r 0x105f0b80
+w 0x10011340
+r 0x10141680
+r 0x105b1d40
+r 0x104c61c0
+r 0x101a5100
+r 0x1017ad00
+r 0x1051bc80
+r 0x1036c980
+w 0x107e3200
+r 0x103f5c00
+w 0x10673dc0
+r 0x103594c0
+w 0x105f38c0
+r 0x101a8640
+r 0x10673780
+r 0x1049f280
+r 0x10020400
+w 0x107202c0
+r 0x10081000
+r 0x1039cf00
+r 0x100bde80
+w 0x105e02c0
+w 0x10315c40
+w 0x10004e00
+r 0x105d4a00
+r 0x1058f940
+w 0x102103c0
+r 0x106fe600
+r 0x1010eac0
+r 0x1065aac0
+w 0x106265c0
+w 0x103e7d40
+w 0x1073ab80
+w 0x1019ed00
+w 0x10309b40
+w 0x107c1e00
+r 0x10069000
+w 0x104335c0
+r 0x101ba000
+r 0x104902c0
+w 0x10561f40
+r 0x105702c0
+r 0x1038ce40
+w 0x103f70c0
+w 0x10159f00
+r 0x10574480
+w 0x102d1c40
+r 0x100e3800
+w 0x1027ac00
+r 0x100f0d80
+w 0x103c97c0
+r 0x1040ad40
+r 0x10373dc0
+r 0x1073d500
+w 0x1028ed80
+w 0x102e9c40
+w 0x107cb240
+r 0x104a4480
+r 0x105f8fc0
+r 0x104ad700
+w 0x1054b800
+w 0x103c4200
+r 0x104c8380
+r 0x1014e740
+r 0x1021fa80
+r 0x101fe080
+w 0x107b31c0
+r 0x1004a500
+r 0x10727cc0
+w 0x10126280
+w 0x10434380
+r 0x1078e200
+r 0x1009fac0
+r 0x104f0a00
+r 0x103e6800
+r 0x103ac500
+r 0x1068bd40
+r 0x10245ec0
+r 0x101b4080
+w 0x10173c80
+r 0x10532040
+r 0x106d2540
+r 0x102fc6c0
+r 0x100ffa00
+w 0x105b1fc0
+r 0x107a8400
+w 0x100f5cc0
+w 0x103b7cc0
+w 0x10475a40
+w 0x10360cc0
+w 0x10648f80
+r 0x1072acc0
+r 0x106b1780
+r 0x1077c780
+r 0x10285400
+r 0x100337c0
+w 0x1025d7c0
+w 0x1039a540
+r 0x10031080
+w 0x1032a980
+r 0x107d7580
+r 0x104738c0
+r 0x103ef480
+r 0x101de740
+w 0x10150700
+r 0x103dcf00
+w 0x1053fec0
+r 0x10702480
+r 0x107e0400
+r 0x103df600
+r 0x107ef880
+r 0x1029fc40
+r 0x10517ec0
+r 0x101c0e80
+r 0x1059bf80
+r 0x10306dc0
+w 0x10791240
+r 0x10756000
+r 0x1050ec80
+r 0x10777e00
+r 0x102dcfc0
+r 0x1054c480
+r 0x102b6600
+r 0x10056bc0
+w 0x10339ec0
+r 0x102f6b40
+r 0x105ba700
+w 0x101c4180
+r 0x1008a180
+w 0x101bc280
+r 0x1070c600
+r 0x10272240
+r 0x1014f0c0
+w 0x1044b5c0
+r 0x107d2f80
+r 0x103adf80
+r 0x101e5e00
+w 0x104a6840
+r 0x10478e40
+r 0x1041d400
+r 0x107adcc0
+w 0x10423480
+r 0x10304980
+w 0x103e5640
+r 0x107cacc0
+r 0x103c7300
+r 0x102a6180
+r 0x10671640
+r 0x10501c00
+r 0x10700740
+r 0x10071800
+w 0x105aed80
+r 0x106d0c80
+r 0x103c8200
+r 0x10204fc0
+w 0x102fb4c0
+r 0x1030af00
+w 0x106ff800
+w 0x10728b40
+w 0x1011f780
+w 0x1065dd40
+w 0x10658b00
+r 0x101f5000
+r 0x100d8bc0
+r 0x10468ec0
+r 0x107a8740
+r 0x106018c0
+r 0x107f9680
+r 0x1031ff00
+w 0x10242940
+r 0x10437f40
+r 0x101c97c0
+w 0x104fbd00
+w 0x1044e700
+r 0x1079d840
+r 0x10227200
+r 0x1054c940
+r 0x101aab00
+r 0x10124840
+r 0x1022fe40
+w 0x100336c0
+r 0x106a6280
+r 0x107ea480
+r 0x105b3880
+r 0x1026a840
+r 0x101eeb80
+w 0x100587c0
+r 0x10276340
+r 0x100c0280
+r 0x10469e40
+r 0x1047ef80
+r 0x105914c0
+r 0x105dc740
+r 0x105ac880
+r 0x102c6d00
+r 0x107a4700
+r 0x10136440
+r 0x103c6280
+r 0x10597fc0
+r 0x1045fb00
+r 0x1062fb00
+r 0x100c5700
+r 0x1015b080
+w 0x1034e480
+r 0x104e8d80
+w 0x105ff800
+w 0x105e8780
+r 0x1033d880
+r 0x10183b40
+r 0x1064d8c0
+w 0x100e3240
+r 0x10073700
+r 0x100d0880
+w 0x102df880
+r 0x107b27c0
+r 0x10487c80
+r 0x103de600
+r 0x1053f480
+w 0x104a08c0
+r 0x10695640
+r 0x1054ea00
+r 0x1022e0c0
+w 0x102cba40
+r 0x1009b0c0
+w 0x1069cb40
+r 0x10732a40
+w 0x10653500
+r 0x10503680
+r 0x10778d00
+r 0x1045c680
+w 0x102cc440
+w 0x104f0040
+r 0x1049b440
+r 0x10103580
+r 0x102f7300
+r 0x10297b00
+r 0x1056cbc0
+r 0x102a27c0
+r 0x10131740
+w 0x104006c0
+r 0x10625d40
+r 0x1007a000
+r 0x1009d1c0
+r 0x1070d6c0
+r 0x10132d00
+r 0x10731840
+r 0x102722c0
+w 0x101c0880
+r 0x1000f640
+w 0x10716e40
+r 0x100e30c0
+w 0x100c9340
+w 0x101a36c0
+r 0x102f98c0
+r 0x10300200
+w 0x106ae380
+r 0x103b1880
+r 0x1066e080
+r 0x10095f40
+r 0x103d1300
+r 0x10653880
+w 0x1054db00
+r 0x102fafc0
+w 0x107378c0
+r 0x10447b00
+w 0x10589c40
+r 0x1044ddc0
+r 0x10643840
+r 0x100b1880
+r 0x101ea340
+r 0x10028340
+r 0x1039d540
+r 0x106ea380
+r 0x10418780
+w 0x107c0840
+r 0x10058a40
+r 0x102be980
+r 0x1006f100
+r 0x10254700
+r 0x101f24c0
+r 0x10409080
+w 0x1062d6c0
+r 0x106f4740
+r 0x1017db00
+r 0x107eb9c0
+r 0x10384900
+r 0x10234680
+r 0x1020ca80
+w 0x10294d00
+r 0x10346480
+r 0x10543640
+r 0x106caf40
+w 0x1060e200
+r 0x103b6740
+r 0x105ac180
+w 0x100ddac0
+w 0x1041f800
+r 0x10357e00
+w 0x10523880
+r 0x107b6180
+r 0x1070ba40
+r 0x1027f280
+r 0x10223d00
+r 0x106826c0
+r 0x1046d300
+r 0x105c3280
+w 0x10779d80
+r 0x102cb740
+r 0x10760680
+r 0x104d4b00
+w 0x1065f880
+r 0x100d26c0
+r 0x105eec00
+r 0x10653c00
+r 0x102c11c0
+w 0x10107380
+r 0x101fba00
+r 0x100b5e00
+r 0x1007b7c0
+r 0x105c9d00
+w 0x100139c0
+w 0x10607ec0
+r 0x1038a600
+w 0x1005f8c0
+w 0x10757f80
+r 0x100907c0
+r 0x10629040
+w 0x10121840
+r 0x10601040
+r 0x103d2700
+r 0x102f2340
+r 0x10691440
+r 0x105f6680
+r 0x10151a40
+w 0x10550080
+r 0x101a73c0
+w 0x106f2380
+r 0x105b2d00
+w 0x10233b80
+r 0x100090c0
+w 0x102d3980
+r 0x103be100
+w 0x10329440
+r 0x101b16c0
+r 0x10309e00
+w 0x10100fc0
+r 0x104c7440
+r 0x10156600
+r 0x104f5540
+w 0x10494200
+r 0x102e4300
+w 0x1075d700
+r 0x1034abc0
+r 0x10662680
+w 0x100193c0
+w 0x102e4e00
+r 0x107df500
+r 0x103d1d80
+w 0x1060e040
+r 0x1026f940
+r 0x103ab980
+r 0x1013da00
+r 0x106faa80
+w 0x10329600
+r 0x102a6180
+w 0x100fbe40
+w 0x104cd0c0
+r 0x100911c0
+r 0x10632240
+r 0x100f8a40
+w 0x1067e740
+r 0x10113dc0
+r 0x10738440
+w 0x106fa680
+r 0x106e8c80
+r 0x102d17c0
+r 0x1006d980
+r 0x102f6bc0
+r 0x105dac00
+r 0x10080000
+r 0x10660440
+w 0x1056a940
+r 0x104bcf80
+r 0x102f13c0
+r 0x104a1200
+r 0x103b5f00
+r 0x10040e80
+r 0x107d0ac0
+w 0x1020c1c0
+w 0x1060a580
+r 0x10126d40
+r 0x1062fcc0
+w 0x1035fd80
+r 0x107d0d40
+w 0x10330b00
+r 0x10651180
+w 0x106a2c40
+w 0x106b9940
+r 0x107ea800
+r 0x106b3300
+r 0x1002a9c0
+r 0x102e8340
+w 0x1036ce00
+r 0x1005c900
+r 0x103ce100
+r 0x10011980
+r 0x1052e6c0
+w 0x103442c0
+r 0x105c3640
+r 0x1018d700
+r 0x105dec80
+r 0x100b6440
+r 0x1024e7c0
+r 0x103090c0
+r 0x105fcd80
+w 0x1070de80
+r 0x1060b780
+w 0x107c0040
+w 0x1047e300
+w 0x101c4580
+r 0x10480280
+w 0x104aa8c0
+r 0x105864c0
+w 0x10247f00
+r 0x1057c6c0
+r 0x101f97c0
+r 0x1036ae40
+w 0x105a4580
+r 0x10149680
+r 0x10733840
+r 0x105f01c0
+r 0x1011f7c0
+r 0x103525c0
+r 0x104f9ec0
+r 0x107643c0
+w 0x1050b0c0
+r 0x1032de80
+r 0x101eda80
+r 0x105fca80
+r 0x100cba80
+r 0x102ba0c0
+r 0x1049bd40
+r 0x102c1d80
+r 0x1045ff00
+r 0x10643180
+r 0x104591c0
+r 0x105f5900
+w 0x101ae880
+w 0x104d45c0
+w 0x1078c400
+r 0x103ba2c0
+w 0x1023cb40
+r 0x10197ac0
+w 0x10064680
+w 0x10437e00
+r 0x103bdf40
+r 0x106aed00
+r 0x100ef080
+r 0x10306500
+r 0x102e2880
+w 0x10368fc0
+w 0x10604f80
+r 0x1047b200
+r 0x10597040
+w 0x107dbd00
+w 0x105efa80
+r 0x1060b440
+w 0x10738100
+r 0x10762cc0
+r 0x100133c0
+w 0x107185c0
+r 0x1070b3c0
+r 0x103d2580
+w 0x10599480
+r 0x1002c740
+w 0x1051b040
+r 0x1042dfc0
+w 0x106a9fc0
+w 0x10383e40
+r 0x10650340
+r 0x1053eac0
+r 0x10559980
+r 0x10344440
+r 0x100ae700
+w 0x10505b40
+r 0x1033c080
+r 0x103f1040
+r 0x10207b00
+w 0x1048a5c0
+r 0x10039b40
+r 0x10797a80
+w 0x10058bc0
+w 0x10385400
+r 0x106daac0
+r 0x103e1ac0
+w 0x10570500
+r 0x1013e580
+w 0x10114640
+r 0x1002b580
+w 0x104a3f40
+r 0x1011ea80
+r 0x1032dcc0
+r 0x103ea0c0
+r 0x105d5c80
+w 0x103a5c80
+r 0x101c3600
+w 0x10515c80
+r 0x1079c4c0
+w 0x107bce00
+w 0x100f4b00
+r 0x1032d680
+w 0x1067b500
+r 0x10109540
+w 0x102cbe80
+w 0x10217340
+w 0x1045efc0
+r 0x1025bdc0
+r 0x1014e540
+w 0x102054c0
+r 0x101d58c0
+w 0x10407640
+r 0x10322d40
+w 0x10056880
+r 0x101f1800
+r 0x1039fc00
+r 0x103e0ac0
+r 0x10700440
+r 0x106a8c80
+r 0x10448fc0
+r 0x10626c00
+r 0x104ce700
+r 0x101c9a80
+w 0x1076c940
+r 0x105a4800
+r 0x104b4200
+r 0x10485780
+r 0x1014ddc0
+w 0x10463600
+r 0x1015df00
+r 0x1076fe40
+w 0x10471280
+r 0x1033f940
+r 0x10408380
+w 0x102bb380
+w 0x10751640
+r 0x104b9140
+r 0x1017dd40
+r 0x100d0900
+r 0x103a44c0
+r 0x1024ad40
+r 0x101246c0
+r 0x10354480
+r 0x10052900
+w 0x10025e80
+r 0x103d4040
+r 0x101716c0
+r 0x10455c40
+w 0x10207b40
+r 0x107c4180
+r 0x10121b80
+r 0x10660b00
+r 0x1004c580
+w 0x10175200
+r 0x10398980
+r 0x107695c0
+w 0x105b67c0
+r 0x1075d240
+r 0x10397400
+w 0x10262400
+r 0x1055a500
+r 0x103fa8c0
+w 0x101e0000
+r 0x101cf940
+w 0x1011e400
+w 0x10413180
+r 0x100b4340
+w 0x103618c0
+r 0x1064fb00
+w 0x101c7c00
+w 0x1010b9c0
+r 0x104569c0
+r 0x101aba40
+r 0x10302c40
+w 0x102c8000
+w 0x106a4800
+w 0x10791400
+r 0x10438ac0
+r 0x1025bf80
+r 0x10127140
+r 0x107b9880
+w 0x1026db40
+r 0x10125c00
+r 0x100a6100
+w 0x107ce700
+r 0x10578cc0
+r 0x1032c540
+w 0x102ab1c0
+r 0x1052ce40
+w 0x10039e80
+r 0x10237240
+r 0x10479480
+w 0x10429040
+r 0x1046d8c0
+r 0x105ddd40
+w 0x10748e00
+w 0x100b0580
+w 0x1034b000
+r 0x101ed1c0
+r 0x106af3c0
+r 0x106e1740
+r 0x107fc800
+r 0x10138680
+r 0x10236180
+w 0x1029dd40
+w 0x10151c40
+r 0x101d5b40
+r 0x102eb240
+r 0x104bc900
+r 0x1014b640
+r 0x1021b640
+r 0x10581300
+r 0x10352f80
+w 0x104f4080
+w 0x10662b00
+r 0x107409c0
+r 0x1008f800
+r 0x102f5d80
+r 0x10046840
+r 0x1064fe40
+w 0x1024ffc0
+r 0x10629d40
+r 0x10001280
+w 0x102ed880
+r 0x105b07c0
+w 0x10262c00
+r 0x10622840
+w 0x102f03c0
+r 0x100284c0
+w 0x1026e940
+r 0x10211840
+r 0x101dcc40
+r 0x102fc700
+w 0x103f9c00
+w 0x10673000
+r 0x1010bc40
+w 0x10777640
+r 0x105dc7c0
+r 0x1075d840
+w 0x104d1100
+w 0x10701140
+r 0x103e2cc0
+r 0x10030ac0
+w 0x1022b6c0
+r 0x100c39c0
+r 0x1030dcc0
+w 0x103bc8c0
+r 0x10252200
+r 0x10407a80
+r 0x10614280
+w 0x1030db40
+r 0x10131e80
+r 0x103b8840
+r 0x102d9f00
+r 0x10085fc0
+r 0x102b9ec0
+r 0x10295980
+r 0x1014b9c0
+r 0x1061bf40
+r 0x104a8140
+r 0x100c5d00
+r 0x107c7340
+w 0x100ab780
+r 0x10373080
+r 0x1040b580
+r 0x101926c0
+w 0x1003b000
+r 0x10512900
+w 0x10339180
+r 0x10391a00
+r 0x1039f3c0
+r 0x10516880
+w 0x105be0c0
+r 0x10130d40
+r 0x102095c0
+r 0x106f4440
+r 0x10097cc0
+r 0x1073f800
+w 0x101c5500
+r 0x105d7540
+r 0x1028df80
+r 0x10211440
+w 0x105c0000
+w 0x10133140
+r 0x10249bc0
+r 0x10742bc0
+r 0x10192780
+w 0x102b7300
+r 0x10593b40
+r 0x103b0c80
+r 0x10271a40
+r 0x10775900
+w 0x101d44c0
+w 0x1010c340
+w 0x10117e40
+r 0x10749800
+w 0x10298980
+r 0x105e7440
+r 0x10662680
+w 0x102f5900
+r 0x1073ce40
+r 0x1050d900
+r 0x104f0580
+r 0x10221bc0
+r 0x1068ca00
+w 0x1025e3c0
+w 0x1033c040
+r 0x102d5300
+r 0x10148d40
+w 0x107936c0
+w 0x103b13c0
+w 0x105b98c0
+r 0x107f14c0
+r 0x105bbd00
+w 0x1016c5c0
+r 0x105f7f40
+w 0x10517f40
+r 0x10441100
+r 0x101b2a40
+r 0x1015b140
+r 0x1040b700
+r 0x10418640
+w 0x107fb000
+w 0x107156c0
+r 0x10044440
+r 0x104a4ec0
+r 0x106098c0
+w 0x104aeec0
+r 0x1030ea00
+r 0x10419f40
+r 0x102e3340
+r 0x107e5cc0
+w 0x107ae3c0
+w 0x10605b40
+r 0x101a3340
+w 0x105cc6c0
+r 0x10641c00
+w 0x106288c0
+r 0x107cf7c0
+r 0x1040ad40
+r 0x10308c00
+w 0x101e2c80
+r 0x1048b6c0
+r 0x10777400
+w 0x103f9240
+w 0x10366280
+r 0x103c28c0
+r 0x102c6d40
+r 0x104cd600
+r 0x1077cfc0
+r 0x100d4240
+r 0x105c2300
+r 0x10066740
+r 0x100243c0
+r 0x102d2d00
+r 0x10782780
+r 0x1041e240
+r 0x104245c0
+w 0x103cb300
+r 0x1002c6c0
+r 0x101bd940
+w 0x104b9a80
+w 0x1073fa00
+r 0x1030d480
+r 0x1029da80
+r 0x103b2c40
+r 0x1001bf40
+w 0x106cbb80
+r 0x103bed40
+w 0x102f2080
+w 0x102b2540
+w 0x10494980
+r 0x10614ac0
+r 0x101d9b00
+w 0x1043d7c0
+r 0x10322040
+r 0x101f9a80
+r 0x105a7500
+w 0x10314640
+r 0x105dfc40
+r 0x106ab7c0
+r 0x1036cd00
+r 0x1023ad00
+r 0x101c6540
+w 0x1017f200
+r 0x107ff8c0
+r 0x107578c0
+w 0x105060c0
+w 0x101fc080
+r 0x101ddb80
+w 0x105fcec0
+w 0x10674b80
+r 0x104ba700
+r 0x101bf640
+r 0x10558d40
+r 0x1071e400
+r 0x106de6c0
+r 0x105fb680
+w 0x10251d00
+w 0x10246d80
+r 0x10385100
+r 0x1073d200
+r 0x1002e480
+r 0x103ac280
+w 0x1033e940
+r 0x1059aac0
+r 0x101739c0
+r 0x106a7640
+r 0x1016bcc0
+r 0x1072e600
+w 0x10590f40
+r 0x106db6c0
+r 0x10110b00
+r 0x106cf680
+r 0x106769c0
+w 0x10441840
+r 0x103c1480
+w 0x10176380
+r 0x1055e3c0
+r 0x1070c980
+r 0x102d1300
+r 0x10749500
+w 0x1061df40
+r 0x10297180
+r 0x107a3500
+w 0x103f80c0
+w 0x102176c0
+r 0x104bb880
+w 0x107082c0
+r 0x106ff880
+r 0x106121c0
+r 0x10044d80
+r 0x102042c0
+r 0x1019b680
+w 0x1038dc40
+w 0x1060fcc0
+r 0x100aed40
+w 0x1016b080
+w 0x107f2b80
+r 0x100e7000
+r 0x101dfd40
+w 0x106b2fc0
+r 0x10780d40
+w 0x1020ecc0
+r 0x1008b800
+r 0x106e5d80
+w 0x10074840
+r 0x10352640
+r 0x10125f40
+w 0x1051fe00
+r 0x1005b9c0
+w 0x104ac9c0
+r 0x1051e140
+w 0x10401c40
+w 0x10357680
+r 0x10703580
+w 0x102375c0
+r 0x102f0dc0
+w 0x107ac4c0
+r 0x100d94c0
+r 0x100d75c0
+r 0x100ae480
+r 0x10214000
+r 0x100527c0
+r 0x105da4c0
+r 0x1019c4c0
+w 0x10297dc0
+r 0x10773e80
+r 0x104a5180
+w 0x1011e400
+w 0x102e0bc0
+r 0x10078580
+w 0x1021f9c0
+r 0x10443f80
+r 0x10776040
+r 0x105d1a00
+r 0x10785580
+r 0x1023c440
+w 0x10254200
+r 0x10382740
+r 0x105230c0
+r 0x106bf340
+r 0x106506c0
+r 0x10629400
+r 0x105e4440
+r 0x101ade40
+r 0x10522880
+w 0x105de780
+w 0x105907c0
+r 0x105e7ec0
+r 0x1012adc0
+r 0x102c42c0
+r 0x1069fa80
+r 0x10198a40
+w 0x10664640
+w 0x10191880
+w 0x103e2180
+r 0x1014fc40
+w 0x1068a0c0
+r 0x10165800
+r 0x1052d580
+w 0x106a6100
+r 0x105dec00
+r 0x106e40c0
+r 0x1004b5c0
+r 0x1058d800
+w 0x10007180
+w 0x105c32c0
+r 0x1004c600
+r 0x101edc80
+r 0x10784300
+r 0x101f9880
+r 0x10225e00
+w 0x10307000
+r 0x100db900
+w 0x102afc40
+r 0x100b6040
+r 0x102bc5c0
+r 0x104cb280
+r 0x1037a540
+r 0x103a6500
+r 0x107dcc80
+w 0x100392c0
+r 0x10481cc0
+w 0x107690c0
+r 0x10577740
+r 0x107c7a40
+r 0x106c1c40
+w 0x10233f40
+r 0x1005dfc0
+w 0x104171c0
+r 0x106ce240
+w 0x100ed200
+w 0x10214280
+r 0x100a2800
+r 0x101f6f40
+r 0x107a77c0
+r 0x105e8240
+w 0x10611c80
+w 0x102f91c0
+r 0x10184ec0
+r 0x105940c0
+w 0x1010fe00
+r 0x106e0d80
+r 0x107d7b80
+w 0x107c96c0
+r 0x106edec0
+r 0x10047800
+r 0x10411980
+r 0x1024b480
+r 0x10466a00
+r 0x105f00c0
+r 0x102a8fc0
+r 0x1002eb80
+w 0x10753940
+r 0x101118c0
+r 0x10188700
+w 0x101cf0c0
+r 0x10647400
+w 0x10446e00
+w 0x1079f200
+w 0x101c6480
+w 0x107e95c0
+r 0x1044bf00
+w 0x10370c00
+w 0x1005fc80
+r 0x10545a40
+r 0x1044ed80
+r 0x10375580
+r 0x103051c0
+r 0x1057d080
+r 0x100cfbc0
+r 0x103007c0
+r 0x100ecf40
+r 0x104caf00
+r 0x1070b040
+w 0x10751a80
+r 0x107a1e40
+r 0x10144cc0
+r 0x101468c0
+r 0x107c2d00
+w 0x10691f40
+w 0x1046da40
+r 0x100db200
+w 0x102e6540
+r 0x10364240
+w 0x10183200
+r 0x10562400
+w 0x100dbd80
+r 0x100ba9c0
+r 0x1025db80
+r 0x1078da00
+r 0x101cea40
+r 0x10389b00
+w 0x1051bbc0
+r 0x1060c780
+w 0x107a1340
+w 0x103aeb00
+w 0x1002c600
+r 0x10562b40
+r 0x104b4980
+w 0x10224f40
+r 0x10436fc0
+r 0x103f7f80
+w 0x10269d00
+r 0x105be000
+r 0x10457080
+w 0x10578940
+r 0x10026780
+w 0x103c91c0
+r 0x104cf080
+r 0x100c9040
+r 0x10266ac0
+r 0x103a6940
+w 0x105a1e80
+r 0x10458240
+r 0x10226040
+r 0x104a6100
+r 0x105d24c0
+r 0x1072de40
+r 0x102fb440
+w 0x106c61c0
+r 0x10776c40
+w 0x107e5ac0
+w 0x107ac4c0
+r 0x10028880
+r 0x101b3900
+r 0x1029c4c0
+w 0x107ec880
+r 0x103892c0
+r 0x1009f000
+w 0x105bc7c0
+r 0x10275c40
+r 0x10475000
+r 0x105fe880
+r 0x10319100
+r 0x10457180
+w 0x1072e500
+w 0x105cebc0
+r 0x106eea40
+r 0x100a4180
+r 0x1054ad00
+r 0x106dcfc0
+r 0x104c7f40
+w 0x1022d400
+r 0x1069b300
+r 0x1054d080
+r 0x102386c0
+r 0x104c88c0
+r 0x103315c0
+r 0x1006f980
+w 0x100f8540
+r 0x1009fbc0
+r 0x1031f500
+r 0x107b5380
+r 0x1063aa40
+r 0x1045ddc0
+r 0x10316c80
+r 0x106f9180
+r 0x10794a40
+w 0x1064a500
+r 0x10355e80
+r 0x102b9280
+r 0x106289c0
+r 0x103ee9c0
+r 0x10104700
+r 0x107dcfc0
+r 0x10252500
+r 0x104f1300
+r 0x10693840
+r 0x10191900
+r 0x1063dac0
+r 0x10057a80
+w 0x105932c0
+r 0x1073f800
+r 0x101a10c0
+r 0x1048ad40
+r 0x1045acc0
+r 0x1005c940
+r 0x1013cec0
+r 0x10024680
+r 0x10444640
+r 0x105fd640
+w 0x107cfdc0
+w 0x10565f80
+r 0x10464e40
+r 0x10328300
+w 0x104b0480
+w 0x10579b00
+r 0x107c9b80
+w 0x100acec0
+r 0x103c7c00
+r 0x1078f980
+r 0x107ec540
+r 0x10327c40
+r 0x101dab00
+r 0x10384f80
+r 0x102b1640
+r 0x1028d9c0
+r 0x10199d40
+r 0x100e58c0
+r 0x103e3440
+w 0x10161440
+r 0x107e55c0
+w 0x10093740
+w 0x1060b700
+r 0x10290f80
+r 0x107d0cc0
+w 0x1056f540
+r 0x1066d800
+w 0x102a0e00
+r 0x105b9c40
+r 0x106bfb00
+r 0x10067bc0
+r 0x101b87c0
+r 0x101bdf80
+w 0x10253640
+r 0x1023ee00
+r 0x10611b40
+r 0x1042a300
+r 0x1046d2c0
+r 0x10695b80
+r 0x10156b00
+r 0x1048e300
+w 0x10602c40
+r 0x1053ea40
+r 0x10107300
+r 0x1026ff00
+r 0x1033fb80
+w 0x10118280
+w 0x1008b4c0
+w 0x102d2980
+r 0x105e7340
+r 0x101341c0
+w 0x10446c00
+r 0x105d5280
+r 0x10361240
+r 0x105deb00
+r 0x100cbd80
+r 0x1003a300
+r 0x1002bb40
+w 0x106a6cc0
+r 0x106a8b80
+r 0x107c7dc0
+r 0x10287f40
+r 0x103d2900
+r 0x102a78c0
+r 0x106c0f80
+w 0x10566380
+r 0x1015b140
+w 0x104389c0
+r 0x107d6dc0
+w 0x1052f040
+r 0x102c17c0
+r 0x10202500
+w 0x105fadc0
+r 0x10602240
+w 0x100f0e80
+r 0x106efa40
+r 0x10309f80
+r 0x106e7b00
+r 0x107079c0
+r 0x100f0c00
+w 0x106a62c0
+r 0x100953c0
+r 0x107786c0
+r 0x100ae700
+r 0x1019bcc0
+w 0x10646e40
+r 0x1055f380
+r 0x107908c0
+r 0x107532c0
+r 0x107e1b40
+r 0x1011c740
+r 0x1064c980
+r 0x1055a580
+r 0x107fa100
+w 0x10361c80
+r 0x1021bf80
+w 0x100c8180
+r 0x1051cac0
+r 0x10554f00
+w 0x1042d080
+r 0x103a9d40
+w 0x104cb340
+w 0x10120b00
+r 0x10176a40
+r 0x10343c80
+r 0x105fb480
+r 0x10449b40
+r 0x10684c40
+r 0x1048fc80
+r 0x100f8040
+w 0x1059f5c0
+w 0x1068a880
+r 0x104ad6c0
+r 0x106ae040
+r 0x1000d200
+r 0x105d2ec0
+r 0x105ddb40
+r 0x103b8b40
+w 0x100d2140
+w 0x10777e80
+r 0x1017fa80
+r 0x107e28c0
+r 0x104c96c0
+r 0x103fea80
+r 0x102fe2c0
+r 0x10422480
+r 0x10668dc0
+r 0x1041a300
+w 0x106e6680
+w 0x100de880
+r 0x104fef80
+r 0x10147380
+r 0x10106080
+r 0x107d7180
+r 0x102ebac0
+r 0x106aac40
+r 0x1027b100
+r 0x100bb280
+r 0x1004e700
+r 0x1028dbc0
+r 0x1034f8c0
+w 0x104d8400
+r 0x102e95c0
+w 0x1034cd00
+r 0x101dd240
+r 0x10235900
+r 0x102183c0
+r 0x101ccd00
+w 0x10608280
+r 0x10301980
+r 0x10304280
+w 0x101fd040
+r 0x10349640
+r 0x10655980
+r 0x107fdb80
+r 0x105a11c0
+r 0x103c3380
+r 0x10221dc0
+r 0x100577c0
+r 0x10745d80
+r 0x103f0740
+r 0x10472900
+r 0x1070b6c0
+w 0x10000fc0
+r 0x101bba00
+r 0x1031c0c0
+r 0x10335080
+r 0x10764700
+w 0x104deec0
+w 0x10514940
+w 0x101e01c0
+w 0x10579f00
+w 0x1004cc80
+w 0x100f5cc0
+r 0x107539c0
+r 0x107c2540
+w 0x1056ff00
+r 0x10600ac0
+r 0x1041db80
+r 0x102a3640
+r 0x10111980
+w 0x104db2c0
+r 0x100c7840
+w 0x103ddb80
+r 0x106f78c0
+w 0x106e5100
+r 0x104f90c0
+r 0x102c0880
+r 0x102a9a00
+w 0x106519c0
+w 0x107fd700
+r 0x10169580
+r 0x1019c280
+r 0x103f6600
+r 0x107d3040
+r 0x100f3a40
+r 0x102d4b80
+r 0x101e4880
+w 0x100b4580
+r 0x10771580
+r 0x105fdbc0
+r 0x1009c4c0
+w 0x1025a340
+r 0x105427c0
+r 0x1017a900
+r 0x10698700
+r 0x10762200
+r 0x101bdb80
+r 0x103cdf00
+w 0x104683c0
+w 0x104014c0
+w 0x10348300
+r 0x10764500
+r 0x10533140
+w 0x1031bf80
+r 0x10482800
+r 0x1002d900
+r 0x10779300
+r 0x104ed080
+r 0x100f5940
+r 0x10668b40
+r 0x103755c0
+r 0x105ee600
+r 0x104a0fc0
+w 0x10779580
+r 0x10456280
+r 0x103fe840
+r 0x1030e980
+r 0x105e93c0
+w 0x1020cb80
+r 0x1060a7c0
+r 0x101c78c0
+r 0x1030e640
+w 0x10604600
+w 0x106051c0
+r 0x107a1ac0
+r 0x103674c0
+w 0x104e6240
+r 0x10161940
+r 0x10685900
+w 0x107c9ec0
+w 0x1001d640
+r 0x10081180
+w 0x100bdc00
+r 0x102e5900
+r 0x105ba3c0
+r 0x102ed540
+w 0x10371e00
+r 0x106621c0
+r 0x10103280
+r 0x10218900
+r 0x106d7900
+r 0x10397bc0
+w 0x10625400
+r 0x107501c0
+r 0x10775280
+r 0x10455540
+r 0x10122580
+w 0x10234700
+r 0x104b4980
+w 0x1004c4c0
+r 0x10655500
+r 0x101fe040
+r 0x107b6800
+r 0x1001abc0
+r 0x101f2f40
+w 0x105fabc0
+r 0x10446480
+r 0x103dd000
+r 0x10703900
+r 0x101b86c0
+w 0x10249640
+w 0x1071a6c0
+r 0x104b8640
+r 0x10788240
+w 0x1061d380
+w 0x1035fb40
+r 0x10796ac0
+w 0x10451f40
+r 0x100c2180
+r 0x10581080
+w 0x10454840
+r 0x10404600
+r 0x1006b580
+r 0x101309c0
+r 0x106fd280
+r 0x102adb40
+r 0x10478fc0
+w 0x105a0140
+r 0x100fd200
+r 0x106e4bc0
+r 0x10158c40
+r 0x100a5080
+r 0x10449bc0
+w 0x101c9780
+w 0x105f67c0
+w 0x1038e600
+r 0x10733000
+r 0x105f56c0
+w 0x105ab480
+r 0x1076b880
+r 0x1047d240
+w 0x10511a00
+r 0x103ac480
+r 0x10445b40
+r 0x107f53c0
+w 0x10571300
+r 0x10037300
+w 0x10054b80
+r 0x103b1c80
+r 0x1019a200
+r 0x100572c0
+w 0x10671480
+r 0x10492b80
+w 0x10280780
+r 0x1024fec0
+r 0x10009100
+r 0x10140500
+r 0x107a2d40
+r 0x107446c0
+r 0x101d8f40
+r 0x1014f800
+r 0x104b34c0
+r 0x10423740
+w 0x105a2a40
+r 0x10078dc0
+w 0x10052600
+w 0x103f49c0
+w 0x105dfd40
+r 0x106a3f80
+r 0x105cd640
+r 0x101b7380
+r 0x103b6e80
+r 0x10662f80
+r 0x100eb280
+r 0x10559f80
+w 0x100944c0
+r 0x1018a7c0
+r 0x105810c0
+r 0x107d3d00
+r 0x101f13c0
+w 0x102a4ec0
+r 0x10733a00
+r 0x1050d8c0
+r 0x107b7f40
+w 0x107c1240
+r 0x103e1e40
+r 0x10345900
+r 0x102b15c0
+w 0x102a4a80
+r 0x100178c0
+r 0x103a3e80
+w 0x10186b00
+r 0x101d8180
+r 0x100e6a00
+w 0x1039de00
+w 0x10085180
+w 0x102b4600
+r 0x101e9100
+w 0x107d3880
+w 0x1070c300
+r 0x10230240
+w 0x101bf380
+r 0x103c0bc0
+r 0x1060bb80
+r 0x102d1900
+r 0x10027e40
+r 0x104bd640
+r 0x1000dd00
+w 0x10664080
+r 0x1063b580
+r 0x10626180
+r 0x1074e540
+w 0x106714c0
+r 0x10145240
+r 0x107acbc0
+r 0x10638400
+r 0x10412100
+r 0x106b4100
+r 0x103fc940
+r 0x1062fc80
+r 0x10611bc0
+w 0x100b6340
+r 0x103c63c0
+r 0x106c0ec0
+w 0x10173500
+w 0x105de000
+w 0x106d0200
+r 0x103e4940
+r 0x1053e100
+w 0x106afb00
+r 0x104aa240
+w 0x1030e900
+r 0x10024780
+r 0x10153c40
+r 0x101bde80
+w 0x1045f200
+r 0x107b7e80
+r 0x105cb280
+r 0x10792fc0
+w 0x1060a340
+r 0x10327180
+r 0x104da0c0
+w 0x10778800
+r 0x103ceec0
+r 0x103bfec0
+r 0x105a9240
+w 0x104662c0
+w 0x106ab8c0
+r 0x10280240
+r 0x105d21c0
+r 0x10392040
+r 0x10550580
+r 0x102d84c0
+w 0x10358880
+w 0x10516640
+w 0x10013040
+r 0x10537840
+r 0x10617680
+r 0x10304a40
+r 0x101ffd40
+r 0x10127140
+r 0x10350ec0
+w 0x106e39c0
+r 0x10603780
+r 0x103b4dc0
+r 0x1028f440
+r 0x1031f840
+r 0x104bc4c0
+r 0x103a2a40
+r 0x103dd4c0
+r 0x10175900
+r 0x105a7980
+w 0x10601500
+r 0x101c0280
+r 0x100ba780
+w 0x106dca80
+r 0x10702000
+r 0x10500d80
+r 0x1058b180
+r 0x104edc00
+r 0x10098c40
+w 0x1060efc0
+w 0x104edb00
+w 0x1060af40
+w 0x103e8500
+r 0x103cfc80
+r 0x10670c00
+r 0x101d3a80
+r 0x100b9680
+w 0x10022800
+w 0x101c2800
+r 0x107f66c0
+w 0x10100a40
+r 0x105bba80
+r 0x103bd9c0
+r 0x10566fc0
+r 0x107c3640
+r 0x106fd3c0
+r 0x10523640
+r 0x1055c1c0
+r 0x1027ae40
+w 0x1020e0c0
+r 0x107a5500
+r 0x1035f900
+r 0x101fac40
+r 0x100b03c0
+w 0x10154f80
+r 0x103944c0
+r 0x10674d00
+w 0x1002f2c0
+r 0x105feb80
+r 0x1055b940
+r 0x10728e00
+r 0x1058c300
+w 0x1039b2c0
+r 0x10054a40
+r 0x101f8880
+r 0x1039d8c0
+r 0x106aa000
+r 0x10410940
+w 0x1006adc0
+w 0x107f8700
+r 0x10094f00
+r 0x101dbb00
+w 0x104afe80
+r 0x10562b80
+w 0x1038d640
+r 0x106ab200
+r 0x1019d5c0
+r 0x10654d40
+r 0x107e4480
+w 0x10698c80
+r 0x1073e200
+r 0x103a7b00
+r 0x102158c0
+r 0x1060fa00
+r 0x10697c40
+w 0x1000d4c0
+w 0x10314440
+w 0x10409900
+r 0x101c36c0
+r 0x106b4a40
+r 0x101004c0
+r 0x107fff00
+r 0x102c6e00
+r 0x10156600
+r 0x10687680
+w 0x1066a940
+r 0x10707540
+r 0x1042d040
+r 0x106ad780
+r 0x1067dd40
+w 0x10635580
+r 0x10432d00
+w 0x100210c0
+w 0x1037d180
+w 0x104496c0
+r 0x103e6e40
+r 0x103eb540
+w 0x1046bc40
+r 0x102fbfc0
+w 0x107f8d40
+r 0x103e6180
+r 0x10241440
+r 0x104cf9c0
+r 0x1068f5c0
+r 0x103fe0c0
+r 0x1038dd80
+r 0x10569d00
+r 0x10515c00
+r 0x105ab840
+r 0x1024d380
+w 0x106d7100
+w 0x103da500
+r 0x1020e000
+w 0x10069e40
+r 0x1036a200
+r 0x107dbe00
+r 0x10747140
+r 0x100a1100
+w 0x10219080
+r 0x10645780
+w 0x1002cdc0
+r 0x102b44c0
+r 0x103ec040
+r 0x10259880
+r 0x10601c80
+r 0x105c49c0
+r 0x1039bb00
+r 0x1042ecc0
+r 0x100356c0
+r 0x103f40c0
+r 0x106fc480
+r 0x106ca940
+r 0x103d2100
+r 0x10729680
+r 0x1068bf40
+w 0x1040dd40
+r 0x1020c700
+r 0x106b1f00
+r 0x10109700
+r 0x105c8d80
+r 0x10737d80
+r 0x1045be80
+r 0x1022ae00
+r 0x10454400
+w 0x107c6080
+r 0x101e1d80
+r 0x102ca400
+r 0x10004140
+r 0x1006efc0
+r 0x104f5700
+r 0x10730b40
+r 0x106e5a40
+r 0x10249500
+w 0x1067eb00
+r 0x100c0200
+w 0x10106f80
+r 0x1036e080
+r 0x10770cc0
+w 0x107d7100
+w 0x106eab00
+r 0x102e1680
+w 0x10073880
+w 0x1022e540
+r 0x103ded40
+w 0x103d3f00
+r 0x1052d040
+r 0x10709500
+r 0x1049a080
+r 0x105cb8c0
+r 0x10218dc0
+r 0x104396c0
+r 0x1030d4c0
+r 0x100c1ac0
+r 0x101c0240
+r 0x10275540
+r 0x10055540
+w 0x104c6b00
+w 0x10251100
+r 0x1051d680
+r 0x10087000
+r 0x10559000
+r 0x10335740
+r 0x103fc540
+w 0x10076b00
+w 0x10537480
+w 0x100640c0
+r 0x1010f1c0
+r 0x100be4c0
+r 0x1065b4c0
+r 0x100c8680
+w 0x10798d00
+r 0x106ffcc0
+r 0x10427000
+r 0x102e3d40
+w 0x10679780
+w 0x1028da40
+r 0x10072840
+r 0x105ecc80
+r 0x1030cac0
+r 0x1019b180
+r 0x107e56c0
+r 0x1054a440
+r 0x10058e80
+w 0x1078b480
+r 0x10699380
+r 0x1028b240
+w 0x1063e400
+r 0x1047cd00
+w 0x10601700
+r 0x103fe540
+r 0x1022a800
+r 0x10347040
+r 0x10320880
+r 0x1057bfc0
+w 0x1017a800
+r 0x1009cb00
+r 0x100f14c0
+r 0x10513000
+r 0x10310d00
+w 0x10573200
+r 0x104527c0
+w 0x101e2880
+w 0x1032c680
+r 0x106995c0
+r 0x102d5500
+w 0x103f70c0
+r 0x1053a6c0
+r 0x10743540
+w 0x101a7b00
+r 0x1008d540
+w 0x10502280
+w 0x104f59c0
+r 0x105b3880
+r 0x104a0040
+w 0x1009b440
+w 0x100dbd80
+w 0x10338f40
+r 0x10765900
+w 0x1058f400
+w 0x102e65c0
+w 0x10700dc0
+r 0x10457380
+w 0x1039ab00
+w 0x10644d80
+w 0x10253240
+r 0x10428040
+r 0x1022a6c0
+r 0x10786600
+r 0x10477d00
+r 0x10647bc0
+r 0x10131ec0
+r 0x100d6b40
+r 0x104e5540
+r 0x104a1980
+r 0x1040ca40
+r 0x10372900
+r 0x106d50c0
+w 0x105760c0
+r 0x1001a480
+r 0x101f3940
+r 0x101f7600
+w 0x105152c0
+w 0x100f3b80
+w 0x102e6740
+r 0x10153740
+w 0x10378180
+r 0x10065100
+r 0x1072c740
+r 0x10044ac0
+r 0x100df540
+r 0x10151d40
+r 0x10418600
+r 0x101abf00
+r 0x10715c40
+r 0x104a1e00
+w 0x10029700
+r 0x10640e00
+r 0x10604940
+w 0x1043a500
+w 0x101ad2c0
+w 0x10452ac0
+r 0x103dc480
+r 0x10467540
+r 0x10416f40
+r 0x100f24c0
+r 0x10162180
+r 0x10429980
+r 0x10058240
+r 0x10480740
+r 0x10603700
+r 0x10647ec0
+r 0x10005480
+w 0x10519900
+w 0x107f4b40
+r 0x10642340
+r 0x1023a940
+w 0x103fc480
+r 0x10788a80
+r 0x106b68c0
+r 0x10551700
+r 0x10275e40
+r 0x1061bd80
+w 0x1019c780
+r 0x10793c40
+w 0x10019dc0
+r 0x1057c380
+r 0x10314700
+r 0x101c3080
+r 0x102d0440
+r 0x105dd180
+w 0x1040a0c0
+r 0x100fbc80
+r 0x1051ef80
+r 0x1054d640
+r 0x106ac980
+w 0x100cf080
+r 0x10533340
+r 0x106dc840
+w 0x104b13c0
+r 0x106a4600
+r 0x10532bc0
+r 0x10152380
+r 0x1067c7c0
+r 0x107dc9c0
+r 0x104ea300
+r 0x1058c200
+r 0x10374080
+r 0x107ee040
+r 0x1038cfc0
+r 0x1071df00
+r 0x104a2140
+r 0x107b5f40
+r 0x10518cc0
+r 0x107b3680
+r 0x101d9980
+r 0x101dc2c0
+r 0x10430440
+w 0x10660600
+r 0x1004df40
+r 0x1010cfc0
+r 0x1068ee00
+r 0x10081640
+r 0x106a5600
+w 0x1034c180
+w 0x1043e180
+w 0x105a4780
+w 0x10337c00
+r 0x10664140
+r 0x1046ae80
+w 0x100774c0
+w 0x10086680
+r 0x10260a00
+w 0x104a2080
+r 0x1052b480
+r 0x103c4a80
+w 0x104e6bc0
+r 0x102cde80
+w 0x104e4c80
+w 0x10520dc0
+r 0x10542c80
+r 0x1029b040
+r 0x1005f940
+r 0x10085bc0
+r 0x106b72c0
+w 0x104de180
+r 0x1034fc40
+r 0x101e9140
+r 0x1068b480
+w 0x106d7e40
+r 0x106d3100
+r 0x10407700
+r 0x10092940
+r 0x107f0c40
+r 0x10530c80
+r 0x1040a440
+w 0x10292c00
+r 0x100b12c0
+r 0x106368c0
+r 0x1021cbc0
+r 0x100e2a00
+r 0x106ead80
+r 0x1035ec40
+w 0x1038d100
+w 0x102c8fc0
+r 0x1060fb80
+w 0x10067780
+w 0x1070ce80
+r 0x1004f000
+r 0x1015e800
+w 0x102fe180
+w 0x1058a240
+r 0x102c59c0
+r 0x1029f080
+r 0x107b9600
+r 0x103d9480
+r 0x102cac80
+r 0x1072d680
+r 0x1044b1c0
+r 0x106db3c0
+r 0x10414040
+r 0x10725ec0
+r 0x10532ac0
+r 0x10651180
+r 0x107cd600
+r 0x10308c40
+w 0x102ced00
+r 0x100bee80
+r 0x104dbd00
+w 0x103fb340
+r 0x10085c80
+r 0x1029ab00
+r 0x10105b40
+r 0x107b9800
+r 0x10792640
+r 0x102cf240
+r 0x1005e8c0
+r 0x106f0400
+w 0x1016b7c0
+r 0x1036cb80
+w 0x103fda00
+r 0x1041fa80
+r 0x1071c4c0
+w 0x1026dd40
+r 0x1034c040
+r 0x107d06c0
+r 0x1046f9c0
+r 0x10754200
+w 0x105483c0
+r 0x105d2e00
+r 0x10516900
+r 0x10751580
+w 0x10651000
+w 0x1036db80
+w 0x10660bc0
+r 0x1046bc40
+r 0x1012c180
+r 0x104053c0
+r 0x105307c0
+r 0x107ce440
+r 0x104d3500
+r 0x102afb80
+w 0x1043db80
+r 0x105d0100
+r 0x103b1a00
+r 0x1053e100
+r 0x10178780
+r 0x101d3c80
+r 0x10686900
+r 0x102972c0
+r 0x1027d200
+r 0x1054c8c0
+w 0x10704dc0
+w 0x10539380
+r 0x1030bd80
+r 0x10432fc0
+r 0x100b7dc0
+r 0x107e8500
+w 0x10306640
+w 0x107e37c0
+r 0x1031aec0
+w 0x104dd400
+w 0x10746f00
+r 0x106b3040
+w 0x105a5d00
+r 0x10363100
+r 0x1062ca80
+r 0x10732440
+r 0x104df340
+r 0x1069bc40
+r 0x104e5800
+r 0x1010e800
+r 0x1058d580
+w 0x100497c0
+r 0x101a1240
+r 0x1068c100
+w 0x10230300
+r 0x100de400
+r 0x105d5500
+r 0x10692040
+w 0x104a9140
+r 0x10773ac0
+r 0x10374f00
+r 0x10289cc0
+r 0x10387080
+r 0x10660d40
+r 0x1070cc40
+r 0x10404500
+r 0x10422840
+w 0x1050d600
+r 0x1045e100
+w 0x1040c3c0
+r 0x1033e080
+r 0x1052d9c0
+w 0x103b8e80
+w 0x104d2e00
+w 0x1059cac0
+r 0x1036c6c0
+r 0x106fbcc0
+w 0x10207000
+w 0x10079000
+r 0x107ad400
+w 0x10528700
+w 0x104aaa80
+r 0x10532400
+w 0x103bf780
+r 0x10116fc0
+r 0x10168e40
+r 0x101b8e80
+w 0x105d1100
+r 0x10041100
+r 0x101c1ec0
+w 0x10311580
+w 0x1065c780
+w 0x104c7100
+r 0x1058c4c0
+r 0x10485980
+r 0x1010c0c0
+r 0x10345940
+w 0x100b0180
+w 0x1005f2c0
+r 0x101d7800
+r 0x103a4800
+w 0x103eb780
+r 0x1062c200
+r 0x103ab140
+r 0x101b4540
+w 0x10286140
+r 0x101e8740
+r 0x106b8e00
+r 0x104b5d00
+r 0x104ba500
+r 0x10640a40
+r 0x102dcc00
+r 0x101166c0
+r 0x10462940
+r 0x1071bd80
+w 0x106bd940
+r 0x106c6880
+w 0x10400500
+r 0x1032e540
+w 0x10136800
+r 0x10037dc0
+r 0x103bbac0
+w 0x1027f000
+r 0x101b8540
+r 0x1040c540
+r 0x100f2b00
+r 0x10092840
+r 0x10419740
+r 0x1078c180
+w 0x1024e0c0
+r 0x102a3e00
+w 0x102fd240
+r 0x10334100
+r 0x10209e00
+r 0x106a89c0
+w 0x106feac0
+w 0x101c9740
+r 0x100a4680
+r 0x100de340
+r 0x101ec040
+r 0x100caf80
+r 0x1078fc00
+w 0x100617c0
+w 0x10713600
+r 0x104c2d40
+r 0x106a73c0
+r 0x1005e5c0
+r 0x10229c40
+r 0x10771600
+w 0x1049a980
+r 0x105d3ac0
+r 0x1049f2c0
+r 0x10670080
+r 0x10263e40
+r 0x10571b80
+w 0x10301240
+r 0x106db000
+r 0x1028e100
+r 0x1006f300
+r 0x1045ed80
+r 0x10341700
+r 0x10304800
+w 0x1002b480
+r 0x101c5080
+w 0x105af540
+r 0x107c0a00
+r 0x103dab80
+r 0x1014b9c0
+r 0x10223940
+w 0x10093580
+r 0x10226b80
+r 0x105da280
+w 0x107c4cc0
+r 0x106a6a00
+r 0x1065c080
+r 0x107bc280
+w 0x10029700
+r 0x104455c0
+w 0x1055e880
+w 0x106a9dc0
+r 0x10316a00
+r 0x106d5280
+r 0x10470a00
+w 0x103ee640
+r 0x102cbd40
+r 0x104fc200
+r 0x1011c400
+r 0x10192740
+r 0x10162180
+r 0x10212640
+w 0x105154c0
+w 0x106a5b80
+r 0x102c3f80
+r 0x105b6b00
+w 0x103d9740
+w 0x10572600
+r 0x105b7740
+r 0x106035c0
+w 0x102d7400
+r 0x1041fec0
+r 0x10791580
+w 0x10629e40
+r 0x101574c0
+r 0x1067a240
+r 0x10431c40
+r 0x10597040
+r 0x1070db80
+r 0x106a90c0
+w 0x10098700
+r 0x10650240
+w 0x107e8200
+r 0x101c8c00
+w 0x105ccd00
+r 0x107b3100
+r 0x10084e40
+r 0x102a9000
+r 0x10349d80
+r 0x1010f980
+w 0x1041a080
+w 0x1070d2c0
+r 0x105df280
+r 0x10212dc0
+w 0x105f2380
+r 0x10609940
+r 0x10504ac0
+r 0x10076600
+w 0x103f51c0
+r 0x1025dd80
+r 0x104f8300
+r 0x101d8fc0
+w 0x1050b500
+w 0x102f9940
+w 0x102f0d80
+r 0x1041d2c0
+w 0x10750c80
+r 0x100ca9c0
+w 0x105bfa80
+r 0x104f6ec0
+r 0x10301780
+r 0x10005440
+w 0x1064e980
+r 0x104bcec0
+r 0x10100f80
+w 0x106322c0
+r 0x1000bb00
+r 0x1010df80
+r 0x10366940
+r 0x1079b680
+r 0x102ab280
+r 0x10764140
+r 0x106765c0
+r 0x104d0200
+r 0x1067b900
+w 0x1069f400
+r 0x1051fb00
+r 0x105baec0
+r 0x10647480
+r 0x104b8a00
+r 0x10365fc0
+r 0x10303a40
+r 0x100f8840
+w 0x1003da80
+r 0x10654780
+r 0x101afc80
+r 0x10237840
+r 0x10260640
+r 0x103d9480
+r 0x1005ea00
+r 0x1068b4c0
+r 0x104818c0
+r 0x107af640
+w 0x1059b980
+w 0x10283c00
+w 0x106f3f00
+w 0x104ea840
+w 0x1079d8c0
+w 0x1004b180
+w 0x1079a7c0
+r 0x104e5980
+w 0x1019c9c0
+r 0x1047a900
+r 0x101807c0
+w 0x100c46c0
+r 0x107424c0
+w 0x10764880
+r 0x10130f00
+r 0x104b1900
+w 0x102f9000
+r 0x10180dc0
+r 0x105eab40
+r 0x105353c0
+w 0x102f68c0
+r 0x10685440
+r 0x1031f680
+r 0x1042e100
+w 0x10431880
+w 0x106e9cc0
+r 0x1009b380
+r 0x1055d580
+r 0x1070a200
+r 0x10737bc0
+w 0x10503fc0
+r 0x1068b300
+r 0x1067f380
+r 0x10691b40
+w 0x104d56c0
+r 0x1053b800
+w 0x1069c500
+r 0x101a8180
+w 0x1076b1c0
+r 0x105a24c0
+r 0x10100ac0
+r 0x103177c0
+r 0x104a7b40
+r 0x106b99c0
+w 0x10384fc0
+r 0x1003c280
+r 0x1043b1c0
+r 0x10573fc0
+r 0x1048dc40
+w 0x103f8440
+r 0x10241e00
+w 0x106ccf00
+r 0x10661100
+r 0x10303340
+w 0x10674780
+w 0x102d2d80
+r 0x102e0480
+r 0x10314400
+r 0x103c5200
+w 0x1023eec0
+r 0x10667c40
+r 0x105543c0
+r 0x10560440
+r 0x102fbf40
+r 0x10234b40
+w 0x102b1b80
+r 0x10024880
+w 0x1013e680
+r 0x102d0140
+r 0x103b6640
+w 0x10354080
+r 0x10125240
+r 0x1061e800
+r 0x10475800
+w 0x1063c4c0
+w 0x102442c0
+w 0x1078d140
+r 0x10703340
+w 0x102bbd00
+r 0x10484540
+r 0x100546c0
+r 0x100337c0
+w 0x104c5780
+r 0x104638c0
+r 0x10743180
+w 0x101f39c0
+r 0x107127c0
+r 0x103126c0
+r 0x1035c140
+r 0x10450300
+r 0x105e9f40
+r 0x100ab700
+r 0x10477700
+r 0x10080440
+r 0x107b4040
+r 0x1030c6c0
+w 0x1067b0c0
+w 0x10368b80
+w 0x107fc3c0
+w 0x1049f980
+r 0x104b0bc0
+r 0x10392800
+w 0x100dd880
+r 0x106a07c0
+r 0x10497bc0
+r 0x105c2600
+w 0x1057b2c0
+w 0x10297480
+r 0x1079c680
+r 0x1016d240
+r 0x106054c0
+r 0x1051c4c0
+w 0x104559c0
+r 0x104956c0
+r 0x10687940
+r 0x102e1700
+r 0x102005c0
+w 0x1026b080
+w 0x10345440
+w 0x106eed40
+w 0x1028ed80
+r 0x106b2080
+r 0x103923c0
+w 0x10299180
+r 0x10674040
+r 0x10509fc0
+r 0x1048fd40
+r 0x106ccbc0
+r 0x10172e80
+r 0x106e73c0
+w 0x10124780
+r 0x1068b9c0
+r 0x104b1100
+r 0x1076b8c0
+r 0x105b5d80
+w 0x102b2100
+r 0x100af2c0
+r 0x1007ffc0
+w 0x1033eb00
+r 0x106cb100
+r 0x107b6900
+r 0x1011aec0
+r 0x1021ee40
+r 0x105a6740
+r 0x1034dd80
+w 0x106da980
+w 0x105e8980
+r 0x1038bd80
+r 0x10610740
+r 0x10243200
+w 0x102f3e00
+r 0x103407c0
+r 0x10797c40
+r 0x101d07c0
+r 0x104d6f00
+r 0x10791d00
+w 0x10672c40
+w 0x1033a8c0
+r 0x10559640
+r 0x101473c0
+w 0x1061d180
+r 0x1057a640
+r 0x102d9800
+r 0x101d4b40
+w 0x1054eb40
+r 0x1040f280
+r 0x106287c0
+r 0x10621840
+w 0x1024f3c0
+r 0x10640d80
+r 0x1060db80
+r 0x105aa2c0
+w 0x10527ec0
+r 0x10290200
+r 0x1040c0c0
+r 0x104f6840
+r 0x1073d740
+r 0x10658800
+w 0x101cdd40
+r 0x1001dc40
+r 0x1071dc40
+r 0x105ea580
+r 0x10250700
+r 0x10335340
+r 0x101aa340
+r 0x10002300
+r 0x10000a40
+r 0x1025e140
+r 0x101779c0
+w 0x101cc240
+r 0x10512cc0
+w 0x102b3a40
+r 0x10247300
+r 0x101f0f40
+w 0x10392840
+r 0x1073f800
+r 0x10649ec0
+w 0x107c0880
+r 0x10712700
+w 0x10097000
+r 0x101de7c0
+r 0x10445500
+r 0x103042c0
+r 0x101e6bc0
+w 0x103cf340
+r 0x104040c0
+w 0x106548c0
+w 0x1023be40
+r 0x106d77c0
+r 0x105e9600
+r 0x104656c0
+w 0x103920c0
+r 0x105d8f40
+r 0x101de780
+r 0x101f8d00
+w 0x10094680
+r 0x10043f80
+w 0x106e68c0
+w 0x1018b680
+r 0x104a1040
+r 0x1077ac80
+r 0x103e33c0
+r 0x1041ab40
+r 0x10074100
+r 0x104aba80
+w 0x103b2b40
+r 0x104b0dc0
+r 0x10147640
+r 0x1018ac40
+w 0x1075b840
+r 0x101ad880
+w 0x102de8c0
+r 0x10226540
+r 0x102b7480
+r 0x105e3840
+r 0x1053fa40
+w 0x101c14c0
+r 0x101e6c80
+r 0x104aaf80
+r 0x1025f980
+r 0x10410980
+r 0x105d7b80
+r 0x105be000
+r 0x101fce40
+w 0x105fdc40
+w 0x101398c0
+r 0x10354900
+w 0x1071dc00
+r 0x1048a3c0
+r 0x10290fc0
+w 0x101ade40
+r 0x1032cb80
+r 0x10318640
+r 0x10191200
+r 0x107a8b40
+w 0x1050dd80
+r 0x10186dc0
+w 0x1029c840
+r 0x10451880
+w 0x106e3bc0
+r 0x1073c640
+r 0x104e8040
+r 0x103cd380
+r 0x107ccdc0
+r 0x105e68c0
+r 0x1079c080
+w 0x10266c40
+r 0x102064c0
+r 0x1024aa80
+r 0x10139900
+r 0x106af5c0
+w 0x104c03c0
+r 0x10416b80
+r 0x10299400
+r 0x10046640
+r 0x106e0640
+w 0x10727f40
+w 0x10424080
+w 0x101e13c0
+r 0x10133e00
+r 0x105b3fc0
+r 0x106b5c40
+r 0x1051e800
+r 0x1065c680
+r 0x10455f00
+r 0x10045140
+w 0x107f8900
+r 0x10240140
+r 0x104d1780
+r 0x1001f100
+w 0x103ab5c0
+r 0x10692fc0
+r 0x10618100
+r 0x103dd4c0
+w 0x100aa9c0
+w 0x10733880
+r 0x106dfbc0
+w 0x10166c00
+w 0x1065d100
+w 0x10499240
+r 0x102e7200
+r 0x10006e40
+r 0x10253380
+r 0x10316340
+r 0x105f2c40
+r 0x104751c0
+w 0x10077100
+r 0x10211640
+w 0x103eac00
+r 0x10376280
+r 0x101fa940
+r 0x106a2840
+w 0x105aa740
+r 0x1050b900
+r 0x1029d680
+r 0x10693c00
+w 0x10664600
+r 0x10484100
+r 0x103f4d40
+r 0x101b11c0
+w 0x10040380
+r 0x10221400
+r 0x10024240
+w 0x10144640
+r 0x10734d00
+r 0x100df080
+r 0x101ecf80
+r 0x10012f00
+r 0x1051ae00
+w 0x101e9440
+w 0x10392080
+r 0x1007d980
+w 0x1053a900
+r 0x1057a9c0
+r 0x10375780
+r 0x10264a80
+r 0x1058a780
+r 0x106c56c0
+r 0x10211c80
+r 0x1061f840
+r 0x1005cb80
+r 0x10791840
+w 0x10215000
+r 0x1057c900
+w 0x10546280
+r 0x10451080
+r 0x102d3640
+w 0x103501c0
+w 0x1021fb80
+r 0x103b4780
+r 0x1009f700
+w 0x104be280
+r 0x105e5980
+r 0x103fc5c0
+r 0x106ae100
+r 0x107349c0
+r 0x10718380
+w 0x1060ff40
+r 0x10078f00
+r 0x10412d00
+r 0x10659fc0
+r 0x10239200
+r 0x10423fc0
+r 0x10742300
+r 0x105ee600
+r 0x101a5c80
+r 0x103f2840
+w 0x1016dec0
+w 0x10497100
+w 0x1000cb00
+r 0x102f3100
+w 0x106ae600
+r 0x10421600
+w 0x103fb740
+w 0x10223600
+r 0x10499380
+w 0x10528cc0
+w 0x100c6480
+r 0x107c5b40
+r 0x1062c5c0
+r 0x103fa600
+r 0x100d7580
+w 0x10323840
+w 0x10066800
+r 0x10478500
+r 0x10232140
+w 0x10187480
+r 0x101b73c0
+r 0x1008c540
+r 0x106d77c0
+r 0x104267c0
+r 0x106fd3c0
+w 0x105764c0
+r 0x104aea80
+r 0x1079d380
+w 0x10651c40
+r 0x1014c780
+r 0x107dd400
+w 0x1054fc40
+r 0x106ac580
+r 0x10244780
+r 0x10541b80
+w 0x1064c600
+w 0x1043d980
+r 0x10115080
+r 0x10781580
+r 0x1048d380
+r 0x10325340
+r 0x10147800
+r 0x10574c00
+r 0x106b1100
+r 0x103f5c00
+r 0x102eff00
+w 0x102524c0
+w 0x103ad940
+w 0x10433e00
+r 0x107dfcc0
+w 0x10174e00
+r 0x10250640
+r 0x1060b540
+w 0x102d71c0
+r 0x1014b640
+r 0x10291240
+r 0x107981c0
+r 0x1040bd00
+r 0x1051afc0
+w 0x107e4180
+r 0x100c5e00
+r 0x104df980
+r 0x1065ce40
+r 0x10540140
+w 0x10277b40
+w 0x105ae140
+r 0x10111080
+r 0x100f95c0
+r 0x10517f00
+r 0x105e7080
+w 0x101344c0
+w 0x101eb580
+r 0x105efec0
+r 0x102d4b40
+r 0x10510bc0
+r 0x1030b4c0
+r 0x101ada40
+r 0x104f47c0
+w 0x106b4540
+r 0x10311f00
+r 0x102b3180
+r 0x1004ba40
+r 0x10673940
+w 0x10340fc0
+r 0x1063df40
+r 0x10588800
+r 0x10533a80
+r 0x105085c0
+r 0x104edc80
+w 0x1025b4c0
+w 0x104fa580
+r 0x10052900
+r 0x100cc240
+r 0x105ba580
+r 0x1030af40
+w 0x103ebd80
+r 0x1069c040
+w 0x100dc340
+r 0x103817c0
+r 0x10637200
+r 0x101f6780
+w 0x10565b80
+r 0x1042bc00
+w 0x104006c0
+r 0x10027700
+r 0x10681c80
+r 0x107f5180
+r 0x103f8700
+r 0x10299a80
+r 0x106d6440
+r 0x102c9e00
+r 0x106537c0
+r 0x102b2e00
+r 0x1034dd80
+w 0x102ff500
+r 0x102f8cc0
+w 0x107d3ac0
+w 0x1069dc80
+w 0x10119000
+r 0x106eebc0
+r 0x101c9a80
+w 0x1028e040
+r 0x103c0200
+r 0x105fe0c0
+r 0x104a4c00
+r 0x1043c180
+r 0x100b0000
+r 0x1041b440
+r 0x1038bc00
+w 0x104aa300
+r 0x10213140
+r 0x10726780
+w 0x107b2880
+r 0x10077dc0
+r 0x1024b340
+r 0x1056e740
+r 0x104efe80
+r 0x10534b00
+r 0x10152400
+r 0x10571bc0
+w 0x10603240
+r 0x10307a00
+w 0x1008c280
+r 0x10113d40
+r 0x1019e7c0
+r 0x10474400
+r 0x104c6c00
+r 0x107496c0
+r 0x1051ab80
+r 0x103f6dc0
+r 0x10385080
+r 0x100c8800
+r 0x107d8f40
+w 0x10576e40
+r 0x1015ffc0
+r 0x102207c0
+w 0x101d7780
+r 0x1055d1c0
+r 0x10314100
+r 0x10449580
+r 0x1068a140
+r 0x106b5640
+r 0x10251d80
+r 0x100e3940
+r 0x1013d800
+w 0x10345240
+w 0x10738cc0
+r 0x1071b180
+r 0x105f3e40
+r 0x100a0100
+r 0x1055c1c0
+w 0x10240dc0
+r 0x10048100
+r 0x10593f40
+r 0x10021dc0
+r 0x10215ac0
+r 0x100e48c0
+r 0x10319b80
+w 0x106d57c0
+r 0x1065ce00
+r 0x107f1880
+r 0x1001bd80
+r 0x106eec00
+w 0x10272380
+w 0x10283e40
+r 0x1041f9c0
+r 0x10116e00
+r 0x10287800
+w 0x10733a80
+r 0x10121b00
+r 0x1032dec0
+r 0x10348840
+r 0x1031d640
+r 0x10016bc0
+w 0x107eed00
+w 0x1016b240
+r 0x1031fc40
+w 0x10655480
+r 0x10287080
+r 0x107f4000
+r 0x10310dc0
+r 0x105579c0
+r 0x1033e840
+r 0x102d4480
+w 0x107ce8c0
+r 0x105333c0
+r 0x10576e00
+w 0x1009aa80
+r 0x104c7f80
+r 0x107a8f80
+w 0x104b5840
+w 0x10140600
+w 0x104834c0
+w 0x104fc100
+r 0x1057fa00
+r 0x10538580
+w 0x103e7180
+w 0x107386c0
+r 0x106dd900
+r 0x103607c0
+w 0x10724ac0
+w 0x1058e4c0
+r 0x1054e2c0
+r 0x102f0c40
+r 0x10689d40
+r 0x100a92c0
+r 0x10326f80
+r 0x106f52c0
+w 0x105fc900
+r 0x100a68c0
+r 0x1075b2c0
+r 0x1057d440
+r 0x10656e40
+r 0x1047e740
+r 0x100423c0
+r 0x102ad7c0
+r 0x103384c0
+r 0x10130dc0
+r 0x10001740
+r 0x1048ce40
+r 0x102fe640
+w 0x107b9f40
+w 0x101805c0
+r 0x105b1900
+r 0x10124480
+r 0x107ccec0
+w 0x10621dc0
+r 0x106b5a00
+r 0x104b8680
+r 0x10708ec0
+r 0x106d4280
+r 0x10614300
+r 0x10446ac0
+r 0x106d5280
+w 0x102b4dc0
+r 0x102ee4c0
+r 0x100dddc0
+r 0x101fa9c0
+w 0x104e4540
+r 0x10020d40
+w 0x1039a340
+r 0x1018a1c0
+r 0x105ac940
+r 0x1048e380
+r 0x101acc40
+r 0x106a0f80
+r 0x101d2ec0
+w 0x104fbb80
+w 0x107a1b40
+w 0x10101d40
+r 0x1066fd40
+r 0x103f06c0
+r 0x10607e00
+r 0x1002e680
+r 0x10332cc0
+r 0x101a8bc0
+w 0x106fcd80
+r 0x105dc800
+r 0x101aeb00
+w 0x1061a700
+r 0x107ceb40
+r 0x1014e780
+r 0x101e9cc0
+w 0x10010f40
+r 0x106593c0
+w 0x1056f740
+r 0x1067ffc0
+r 0x1075dc00
+r 0x104cae80
+r 0x101c4240
+w 0x1041e0c0
+r 0x102a22c0
+r 0x10200740
+r 0x1079ad40
+r 0x10540a00
+r 0x10791380
+r 0x102b2400
+w 0x10343500
+w 0x104a0140
+r 0x107deb40
+r 0x104c0cc0
+r 0x105aee80
+r 0x104a8c80
+r 0x100f21c0
+r 0x1046f6c0
+w 0x101b7e80
+w 0x10799c80
+r 0x1016d400
+w 0x10027b80
+r 0x10030100
+r 0x10157380
+r 0x102f9800
+w 0x10531d00
+r 0x103feb00
+w 0x10634440
+w 0x105370c0
+r 0x1006d480
+r 0x1035f200
+w 0x107b5d00
+w 0x10366c80
+r 0x107536c0
+r 0x106b6980
+r 0x101b0d00
+w 0x10616280
+w 0x10505f00
+r 0x105c1340
+r 0x10142580
+r 0x1035ee00
+r 0x101c8440
+w 0x107275c0
+r 0x100440c0
+r 0x106f60c0
+r 0x107af340
+r 0x1053cd40
+r 0x10591480
+r 0x1049a500
+r 0x105947c0
+r 0x102d0340
+w 0x101bea00
+r 0x10695080
+r 0x10657640
+r 0x10686a80
+r 0x1047ed40
+w 0x10781e00
+w 0x1016ef00
+r 0x107ae840
+r 0x103905c0
+r 0x100baf80
+w 0x1020a640
+r 0x101326c0
+w 0x105584c0
+r 0x1074d540
+w 0x10653500
+r 0x106fde40
+r 0x101187c0
+r 0x10786a00
+w 0x1018e7c0
+w 0x1004d840
+r 0x1020a980
+r 0x107db000
+w 0x107abb40
+r 0x1030d200
+r 0x100dc200
+w 0x103796c0
+r 0x1003db80
+r 0x106a05c0
+r 0x10263a00
+r 0x105499c0
+w 0x100b4d80
+w 0x102677c0
+r 0x103f6a40
+r 0x103e54c0
+r 0x10684800
+r 0x1058bcc0
+r 0x10617680
+r 0x102123c0
+w 0x105ad400
+r 0x10662980
+w 0x107a2cc0
+w 0x10428ac0
+w 0x10098580
+r 0x104172c0
+r 0x105575c0
+r 0x1007c240
+w 0x101e5780
+r 0x10095340
+w 0x104951c0
+r 0x1076d480
+r 0x1067cbc0
+w 0x10122a40
+r 0x100bc900
+r 0x10562080
+r 0x107ba180
+r 0x10739ac0
+r 0x1063a840
+r 0x10490440
+r 0x1011fa40
+r 0x10789b40
+r 0x1074ae00
+r 0x10679b00
+w 0x10253e00
+r 0x1054e200
+r 0x10095100
+w 0x106fe100
+r 0x105e3900
+r 0x10395e80
+r 0x102ed780
+r 0x10654f40
+r 0x107f4c40
+r 0x10108680
+w 0x100a13c0
+r 0x10014fc0
+r 0x10049080
+r 0x10112a40
+r 0x103e4800
+r 0x100c1e80
+r 0x104a7d80
+r 0x10671840
+r 0x101c70c0
+w 0x1006b5c0
+r 0x103a1600
+r 0x102b9680
+w 0x10283a80
+r 0x10316540
+w 0x1049bcc0
+r 0x103bf500
+r 0x107ab2c0
+r 0x105925c0
+w 0x104364c0
+r 0x1058c500
+w 0x101deac0
+w 0x100a55c0
+w 0x1067d5c0
+r 0x101e04c0
+r 0x10709a40
+r 0x106f3040
+w 0x101f4b40
+w 0x102e3e80
+w 0x10238940
+r 0x1032f4c0
+r 0x106cd280
+r 0x10640e00
+r 0x100af700
+w 0x1057c040
+r 0x102b2f80
+w 0x1073f3c0
+r 0x1017a480
+r 0x10507300
+r 0x10365780
+r 0x10685180
+r 0x1029ea40
+r 0x1003f2c0
+w 0x1034c340
+w 0x10050500
+r 0x101dc0c0
+w 0x1018fb00
+r 0x105c4700
+r 0x10206080
+w 0x100aabc0
+r 0x1012b800
+w 0x103c6540
+r 0x10030b80
+r 0x10294f80
+w 0x1055c900
+w 0x10698a40
+r 0x105bd100
+r 0x1075d4c0
+r 0x104a7a40
+r 0x103f6080
+w 0x106f0280
+r 0x10401540
+r 0x103e9140
+r 0x10031f00
+r 0x103d2f40
+r 0x106da500
+r 0x1059b840
+r 0x104af000
+r 0x1021b700
+r 0x1070e480
+r 0x103927c0
+r 0x10653ec0
+r 0x10557a80
+w 0x101b0d80
+r 0x1061f040
+r 0x104bd640
+r 0x10323140
+r 0x101bc340
+r 0x103f63c0
+r 0x1019c740
+w 0x10269ec0
+w 0x1024bb80
+r 0x10444f40
+r 0x10538f40
+r 0x10116a40
+w 0x103035c0
+r 0x102c8100
+r 0x10280cc0
+w 0x107d1d80
+w 0x10637b00
+w 0x107b9780
+w 0x101e7300
+r 0x102e6cc0
+r 0x10071400
+r 0x10576940
+w 0x1062b7c0
+r 0x105e90c0
+r 0x1012a5c0
+r 0x105b2b00
+r 0x1068ff00
+r 0x1053cf40
+r 0x1062bc40
+r 0x103934c0
+w 0x102b5040
+r 0x100f8fc0
+r 0x102b24c0
+r 0x101af480
+r 0x10286440
+r 0x1010c980
+r 0x10082180
+r 0x100fc840
+r 0x101e4780
+r 0x103187c0
+r 0x105d9880
+r 0x1018fa80
+r 0x105d7940
+r 0x100adb00
+r 0x104ab0c0
+r 0x10246280
+w 0x1020e480
+w 0x101157c0
+r 0x1019ccc0
+w 0x106f0680
+w 0x10236e00
+w 0x102bbd40
+r 0x107b4c40
+r 0x10748b40
+w 0x107c5480
+r 0x104c4940
+r 0x1028fa40
+r 0x101aefc0
+w 0x1001f140
+w 0x105183c0
+r 0x104db040
+r 0x1063fc80
+r 0x107c9640
+w 0x106410c0
+r 0x107f4d40
+w 0x1073e240
+w 0x10518940
+r 0x107b2980
+r 0x10332580
+r 0x1012fa40
+r 0x1054d040
+r 0x10016000
+w 0x101042c0
+r 0x1078fd80
+r 0x107b6000
+w 0x101ddb00
+w 0x1024d2c0
+w 0x10372f40
+r 0x1033f200
+r 0x105cac00
+w 0x100d9240
+w 0x102f4400
+w 0x10437480
+r 0x1043f2c0
+r 0x100284c0
+r 0x102c6780
+r 0x103fff80
+r 0x10741dc0
+r 0x104aec40
+r 0x100ad000
+w 0x1031b780
+w 0x10251700
+r 0x1078a540
+r 0x104653c0
+w 0x105903c0
+w 0x105718c0
+r 0x103ab180
+r 0x106ba3c0
+r 0x102ca040
+r 0x10604780
+r 0x107cb440
+r 0x104aab80
+r 0x10771580
+r 0x1066c800
+r 0x105ca100
+r 0x105223c0
+r 0x10163ac0
+r 0x1026d080
+w 0x1020c400
+w 0x102cbcc0
+r 0x1067b200
+r 0x101c0180
+w 0x104f3300
+w 0x10012080
+w 0x10074640
+r 0x10532200
+r 0x1031b600
+r 0x10467f80
+r 0x103f9340
+r 0x106b0040
+w 0x1014e000
+r 0x106dbfc0
+r 0x1051aac0
+r 0x103a1900
+r 0x1015e840
+r 0x10042380
+r 0x1076cf40
+w 0x101aa800
+r 0x10751fc0
+r 0x106d0a80
+r 0x1045f480
+r 0x10003d00
+w 0x105ce600
+r 0x10405280
+r 0x10209280
+w 0x10144e40
+w 0x1033cc00
+r 0x1015a0c0
+w 0x10427cc0
+r 0x10654780
+r 0x10710880
+w 0x100f9180
+r 0x10757cc0
+r 0x10463f40
+r 0x103d2d80
+w 0x1021cec0
+r 0x100a12c0
+w 0x103993c0
+r 0x106c7e80
+r 0x1008ff40
+r 0x1002e1c0
+r 0x105ab340
+w 0x1069f1c0
+r 0x104721c0
+w 0x102d4cc0
+w 0x106c5680
+r 0x106f2b00
+w 0x100cdf40
+r 0x10777b40
+w 0x10472800
+w 0x10518d40
+r 0x103827c0
+w 0x1074b6c0
+w 0x100665c0
+w 0x1057c800
+r 0x10314400
+r 0x1036dd00
+r 0x10415980
+r 0x10414080
+r 0x10467980
+r 0x10187040
+w 0x10033100
+r 0x106da880
+w 0x10357340
+r 0x10551680
+w 0x1074c680
+w 0x1030bc40
+w 0x1027bf80
+w 0x10406680
+w 0x10063180
+r 0x10382e80
+r 0x10433440
+w 0x106c17c0
+r 0x1074b400
+r 0x10015f80
+r 0x101de140
+r 0x104d2a80
+r 0x10220680
+r 0x102eeec0
+w 0x103b5440
+w 0x10097f80
+w 0x1078fe80
+r 0x10563b80
+w 0x10418ec0
+w 0x103db600
+r 0x10337f00
+r 0x1061ec40
+r 0x10502b40
+r 0x10440dc0
+w 0x10212100
+r 0x10454140
+r 0x10233000
+w 0x107ad280
+r 0x104de700
+r 0x1007ab40
+w 0x105b0a80
+w 0x103c8a00
+r 0x1051b380
+r 0x10267cc0
+r 0x103cfa00
+r 0x1047ba80
+w 0x104b7d40
+w 0x100c7b80
+r 0x1010b040
+r 0x106f4540
+r 0x104c62c0
+r 0x1040fa40
+r 0x1015b580
+r 0x1026cc40
+r 0x10126700
+r 0x10794b80
+w 0x107f9c80
+r 0x1005e0c0
+r 0x106bbb80
+r 0x10074a80
+r 0x1004f7c0
+r 0x1030bb80
+w 0x100392c0
+r 0x105c6a80
+r 0x107ccec0
+r 0x10609640
+r 0x100aad40
+r 0x101dddc0
+r 0x10400080
+r 0x1079ae40
+r 0x1036cf00
+r 0x10295e40
+w 0x104dba80
+r 0x10415180
+r 0x1077ee40
+r 0x102d13c0
+w 0x1061f0c0
+r 0x10696040
+r 0x1064a3c0
+w 0x10217340
+r 0x1052c0c0
+r 0x1029c1c0
+r 0x1045ae80
+r 0x10318e00
+r 0x10730300
+w 0x100558c0
+r 0x102cd140
+r 0x103181c0
+r 0x101be340
+r 0x101b9900
+r 0x10703140
+r 0x10321e40
+r 0x106ee9c0
+r 0x10735700
+r 0x100f8e40
+w 0x103e2340
+r 0x1050d4c0
+r 0x10565300
+r 0x107c80c0
+r 0x1047b680
+r 0x10368640
+r 0x10382a80
+r 0x103c0ec0
+w 0x10096c00
+w 0x1003c540
+r 0x102ec200
+w 0x105f3300
+r 0x10279fc0
+r 0x101d5d00
+r 0x10098c40
+r 0x1007dd00
+r 0x1021c2c0
+r 0x10751580
+r 0x10500080
+r 0x10405dc0
+r 0x1015e400
+w 0x107f1280
+r 0x104fa900
+r 0x107d8f40
+w 0x10682dc0
+r 0x10683300
+w 0x10144400
+r 0x10174540
+r 0x1002e880
+r 0x10334bc0
+w 0x10785e80
+w 0x106ec7c0
+r 0x1010c9c0
+w 0x10003e80
+r 0x100b9d00
+r 0x106ff340
+w 0x1079cd00
+r 0x1027cc40
+r 0x1057ec00
+w 0x104e61c0
+r 0x101cda00
+r 0x10622080
+r 0x10395980
+r 0x102beb80
+r 0x1059c540
+r 0x10047540
+w 0x104d4580
+r 0x103f79c0
+w 0x100950c0
+r 0x10379d00
+r 0x1011a440
+r 0x10038080
+w 0x1008d580
+r 0x103f5ac0
+w 0x100d1b80
+w 0x1001c640
+r 0x104e2fc0
+r 0x105c6a00
+r 0x1028c740
+r 0x103f9d00
+r 0x1068a8c0
+r 0x105d9940
+r 0x10209380
+r 0x1014a940
+r 0x10767240
+w 0x106cbbc0
+r 0x10295a00
+w 0x1052af80
+w 0x1026aac0
+w 0x1005a540
+w 0x1060c4c0
+r 0x104cdc80
+r 0x1042ed40
+w 0x104be480
+r 0x1027a940
+r 0x100d6400
+w 0x10658b00
+w 0x10004a00
+r 0x103efcc0
+w 0x10001400
+r 0x105e67c0
+r 0x10636a40
+r 0x10703a00
+w 0x100c33c0
+r 0x102f07c0
+r 0x1021bac0
+w 0x1048f600
+w 0x107aeb80
+r 0x103e1b00
+w 0x104e5c00
+w 0x101f4d00
+r 0x107c5200
+r 0x1053e300
+r 0x103235c0
+r 0x104c6bc0
+r 0x107fc440
+r 0x10505bc0
+r 0x10074500
+w 0x106d2ac0
+w 0x10675740
+r 0x10180000
+r 0x10349f40
+r 0x103a4400
+r 0x100f0640
+r 0x1063ffc0
+r 0x105de8c0
+r 0x102986c0
+r 0x10283040
+r 0x105f3f40
+r 0x10195bc0
+w 0x1004a980
+r 0x105741c0
+r 0x104be3c0
+r 0x1005c8c0
+r 0x102e3b80
+r 0x10269100
+r 0x1045ff40
+r 0x104eda40
+r 0x1025b000
+r 0x104a3300
+w 0x10779800
+r 0x107b38c0
+r 0x10702c40
+r 0x104ba940
+r 0x102f8d40
+r 0x10691a40
+r 0x1044f1c0
+w 0x1033fec0
+r 0x10142740
+r 0x10218d00
+r 0x1066f000
+r 0x10033d40
+w 0x10202780
+r 0x10511e80
+r 0x1047b8c0
+w 0x107ffc00
+r 0x1022b900
+w 0x1014ff80
+r 0x105fb040
+w 0x1051f8c0
+w 0x104cedc0
+w 0x101bf780
+r 0x10074700
+r 0x10625680
+r 0x1043ad80
+w 0x101b6cc0
+r 0x103db1c0
+w 0x1016cf80
+w 0x1041e6c0
+r 0x100d0a40
+r 0x104bf740
+r 0x101cf840
+w 0x107cc140
+r 0x1041c080
+r 0x1000f780
+w 0x105c7940
+r 0x10650900
+r 0x1043d680
+r 0x104eadc0
+w 0x105f5400
+r 0x105ed880
+r 0x102c59c0
+r 0x10700580
+r 0x1039cfc0
+r 0x10572580
+r 0x1065ea40
+r 0x1022ba40
+r 0x10239040
+r 0x102e4cc0
+r 0x1056ee40
+r 0x1058d740
+w 0x1036f6c0
+w 0x102a7580
+r 0x10305800
+r 0x10548680
+r 0x10664f00
+r 0x106e8b40
+r 0x107c4fc0
+r 0x100b9140
+r 0x1049fa00
+r 0x1048e380
+r 0x10595600
+r 0x103de780
+r 0x1073cdc0
+r 0x102a2b00
+r 0x10252780
+r 0x10138580
+r 0x1037b300
+r 0x100faa40
+r 0x100de180
+w 0x1076af80
+r 0x106e2700
+r 0x10131a80
+r 0x1001f680
+w 0x10035600
+w 0x106d2700
+w 0x10316940
+r 0x104e4c40
+w 0x10682bc0
+r 0x10207300
+w 0x10175dc0
+r 0x10317a00
+r 0x10287940
+w 0x10599a40
+r 0x1066a900
+r 0x107324c0
+r 0x1015ae00
+r 0x103587c0
+w 0x100ca300
+r 0x1041f5c0
+r 0x107cd440
+r 0x102a1580
+r 0x101b7a00
+w 0x1053e780
+r 0x1057efc0
+r 0x10477480
+w 0x104c4a40
+r 0x1055cc40
+w 0x1003a600
+r 0x1058a980
+r 0x10138d40
+r 0x106ef400
+w 0x10733700
+r 0x10512e80
+r 0x10336dc0
+r 0x1057a200
+w 0x103f8a00
+w 0x101bb4c0
+r 0x107518c0
+r 0x102ef340
+w 0x104c6540
+w 0x10204ac0
+r 0x102353c0
+r 0x10480380
+r 0x10762640
+r 0x10298e40
+r 0x102489c0
+w 0x100342c0
+r 0x100aeec0
+r 0x103d0400
+w 0x106ba880
+w 0x1033e540
+w 0x103c1f00
+w 0x102e9440
+w 0x106ee300
+r 0x1043b780
+w 0x10638c00
+w 0x10259bc0
+w 0x10316400
+w 0x10139c80
+w 0x103eb5c0
+r 0x101d3640
+r 0x10727c40
+w 0x104a4140
+r 0x106537c0
+r 0x100ca000
+w 0x1024ec00
+w 0x102fbcc0
+r 0x1055cc00
+r 0x1009ae80
+r 0x101e8300
+r 0x103a5540
+r 0x106bedc0
+r 0x10413400
+w 0x1041bd80
+w 0x103a0700
+r 0x1027ab00
+w 0x1058ea80
+r 0x100b7200
+r 0x100d79c0
+r 0x101d4b80
+r 0x103737c0
+w 0x10120100
+r 0x100eeac0
+r 0x103a55c0
+r 0x10068bc0
+r 0x101b5680
+r 0x1074abc0
+r 0x100242c0
+r 0x100dbdc0
+r 0x107eca80
+r 0x1039b000
+w 0x105d7480
+r 0x1029dc40
+r 0x103a3040
+r 0x100941c0
+r 0x106f6ac0
+r 0x10523400
+r 0x1044bb80
+r 0x100e71c0
+r 0x10078300
+w 0x1079e8c0
+r 0x101567c0
+r 0x10398680
+r 0x105fb880
+r 0x1068dc00
+r 0x106acfc0
+r 0x105275c0
+r 0x10463700
+r 0x100b8300
+r 0x102d4b40
+r 0x1052b900
+r 0x101e0280
+r 0x104ed180
+r 0x104fda00
+r 0x103dfa40
+w 0x1000bb80
+r 0x10126780
+r 0x10276540
+r 0x107f57c0
+r 0x105480c0
+w 0x100b6ec0
+w 0x106bc7c0
+w 0x1001d080
+w 0x1041a800
+r 0x10602d40
+r 0x1070f680
+r 0x101c7ac0
+w 0x103afe00
+r 0x101e6800
+w 0x10116740
+r 0x101d0380
+w 0x104e9e40
+r 0x10611dc0
+r 0x10676e00
+r 0x107b5280
+r 0x102d4980
+r 0x10534e80
+w 0x10043fc0
+r 0x101e2b80
+r 0x10059240
+w 0x102d1080
+r 0x105a50c0
+r 0x10247f40
+r 0x102fb380
+r 0x10526e40
+w 0x10691000
+w 0x1076c340
+r 0x107dcfc0
+r 0x10776c40
+w 0x1079cb40
+r 0x101d2140
+r 0x1046d4c0
+r 0x1073b8c0
+r 0x10050200
+r 0x105b2740
+r 0x103c8b40
+r 0x10236200
+w 0x1026c240
+r 0x1073d980
+w 0x10133500
+r 0x10073200
+r 0x10352080
+r 0x10586480
+r 0x10184040
+w 0x106ac080
+r 0x10267a80
+r 0x10094c40
+r 0x10079780
+r 0x1058a700
+w 0x102afc00
+r 0x10094c00
+r 0x101be840
+w 0x1012cbc0
+r 0x1009d1c0
+w 0x104ac800
+r 0x10112380
+w 0x1052ec00
+r 0x100c0700
+r 0x101d1840
+r 0x10593f40
+r 0x100dd500
+w 0x101b5540
+w 0x100ca6c0
+w 0x10307240
+r 0x1000b640
+w 0x101f1500
+r 0x10637d00
+r 0x10658c40
+w 0x103fc6c0
+r 0x1038ecc0
+r 0x104ef140
+r 0x104b8580
+r 0x105d2dc0
+w 0x104bb240
+w 0x1050e980
+r 0x10264400
+r 0x1032fc40
+r 0x102076c0
+w 0x101b1900
+r 0x1074ccc0
+r 0x10250480
+w 0x1045a600
+w 0x10282700
+r 0x1060e280
+r 0x101ce200
+w 0x105b79c0
+w 0x1024c940
+r 0x105cba00
+r 0x10055840
+r 0x101da700
+r 0x1017d3c0
+w 0x1069f380
+r 0x103aedc0
+w 0x103dd580
+w 0x100430c0
+w 0x10332440
+r 0x104e3780
+r 0x10413e00
+r 0x1044ab80
+r 0x1070ba00
+r 0x102e6700
+r 0x10367bc0
+r 0x104e6480
+r 0x10468780
+r 0x10623800
+r 0x106ad740
+r 0x1014c1c0
+w 0x104fb980
+w 0x10660f80
+r 0x10022840
+r 0x107b5c40
+w 0x10631900
+r 0x1007fe00
+w 0x103fc0c0
+r 0x104a4280
+r 0x1074c5c0
+r 0x1014f700
+r 0x10071440
+r 0x100a6000
+r 0x10619680
+r 0x10314980
+r 0x10155240
+r 0x101bec80
+w 0x106ff800
+w 0x101c7240
+r 0x1079ae40
+w 0x101db240
+w 0x100c2400
+r 0x102b1f80
+w 0x1031f980
+w 0x1012a900
+w 0x1009c9c0
+r 0x102d24c0
+r 0x10357180
+r 0x10519a40
+r 0x10341a40
+w 0x100e0b80
+r 0x10582800
+r 0x103c6940
+r 0x1020d480
+r 0x10535e80
+r 0x104b5540
+w 0x10740380
+w 0x10224580
+r 0x1049f040
+r 0x10422940
+w 0x10018600
+r 0x100c60c0
+r 0x10328b00
+r 0x10613940
+w 0x10298980
+r 0x10682c00
+r 0x1040d6c0
+r 0x1039cb80
+w 0x107fb800
+r 0x10678140
+w 0x1019d5c0
+r 0x101ce3c0
+w 0x103add40
+r 0x10466480
+r 0x10221400
+r 0x102065c0
+r 0x1011ca40
+w 0x1025f700
+r 0x10760f00
+w 0x10462680
+r 0x102afd80
+r 0x104c44c0
+r 0x10618e80
+r 0x106e5800
+w 0x106bdf00
+r 0x104f8f80
+w 0x10254d80
+w 0x1033f8c0
+r 0x1015c400
+r 0x105aebc0
+r 0x10747580
+w 0x10152a80
+r 0x100e9040
+w 0x10283840
+r 0x100cb980
+r 0x107e1940
+r 0x10610000
+r 0x10152980
+r 0x100a22c0
+r 0x1002b0c0
+w 0x1051ac40
+r 0x1000d400
+w 0x1014b140
+r 0x103f7580
+r 0x10185a80
+r 0x104d94c0
+r 0x1026aec0
+r 0x106ac140
+w 0x10781840
+r 0x1008dc80
+w 0x10401ac0
+r 0x102d9c40
+r 0x102316c0
+r 0x10383d80
+r 0x102fc600
+w 0x103805c0
+r 0x1063e640
+w 0x107adc00
+w 0x1008b480
+r 0x101c4a00
+r 0x10676c40
+r 0x10462500
+w 0x10612c00
+w 0x10580e40
+r 0x10559cc0
+r 0x107ac600
+r 0x103d69c0
+w 0x10474d00
+r 0x10362140
+r 0x1004c200
+r 0x103c79c0
+r 0x10006e80
+r 0x10375700
+r 0x104f9140
+w 0x105c9240
+r 0x1043da40
+r 0x1020a1c0
+w 0x106aab40
+r 0x104af1c0
+r 0x106d5b00
+r 0x10336140
+r 0x10657000
+r 0x10118f00
+r 0x106b8bc0
+r 0x1010e400
+r 0x10197140
+r 0x10117bc0
+r 0x1004c400
+r 0x103edb40
+r 0x107b19c0
+r 0x1035b500
+r 0x107bad80
+r 0x10327080
+r 0x103c7bc0
+w 0x106a6540
+r 0x105099c0
+r 0x103de040
+r 0x1046a000
+w 0x100f9cc0
+w 0x105d5740
+w 0x10616680
+w 0x101c81c0
+r 0x106ade80
+r 0x10500980
+w 0x10519740
+r 0x10207100
+r 0x102d82c0
+w 0x103cddc0
+r 0x10757340
+w 0x101b5d40
+r 0x10222d40
+r 0x10366d40
+r 0x10215940
+w 0x104c3480
+r 0x1034efc0
+r 0x10096b80
+r 0x1059f2c0
+r 0x10274ec0
+w 0x101560c0
+w 0x1042ad40
+w 0x1062da80
+w 0x10096240
+r 0x10690b00
+r 0x10028300
+w 0x1044ea80
+w 0x100ce300
+r 0x107bc4c0
+w 0x10319a80
+r 0x103e2600
+r 0x1043a940
+r 0x1009e440
+r 0x10789800
+w 0x107e3000
+r 0x10070040
+w 0x1070ea00
+r 0x10760a80
+r 0x10771f40
+r 0x10239e80
+w 0x104cdc40
+w 0x100386c0
+r 0x101f1d80
+r 0x10409f80
+w 0x105ec580
+r 0x100db440
+w 0x10380000
+r 0x1079a1c0
+w 0x107185c0
+r 0x1067f440
+r 0x10600b00
+r 0x101ad5c0
+r 0x1076dd80
+r 0x106f1940
+w 0x103cef80
+r 0x1066e380
+w 0x100c52c0
+r 0x10336300
+r 0x10594b40
+r 0x10463680
+w 0x105fea00
+r 0x1047ca00
+r 0x106f5d40
+r 0x103ff5c0
+r 0x107dcd40
+r 0x10237480
+r 0x1043f280
+r 0x103386c0
+w 0x102fed80
+r 0x105bb980
+r 0x10392900
+r 0x1052a440
+r 0x10299cc0
+r 0x105f4e00
+r 0x100ec980
+r 0x100e5000
+r 0x103263c0
+r 0x100e3340
+r 0x10464cc0
+r 0x106468c0
+w 0x1076e640
+w 0x103b0440
+r 0x10255800
+r 0x107c51c0
+r 0x104f3980
+w 0x1027da80
+w 0x10393dc0
+r 0x104ea3c0
+w 0x107bf8c0
+r 0x1025e500
+w 0x107856c0
+r 0x102bd8c0
+w 0x106f94c0
+r 0x106fa940
+r 0x105c6340
+r 0x1000b9c0
+r 0x10321040
+r 0x10086180
+r 0x100de100
+r 0x107714c0
+r 0x103420c0
+r 0x10773180
+r 0x102b9f00
+w 0x10713800
+w 0x10753740
+r 0x10428940
+w 0x10296280
+r 0x1037d600
+r 0x1004dac0
+r 0x104eaf00
+r 0x10121d80
+r 0x10715a40
+w 0x10698680
+r 0x1019eb40
+r 0x103cd680
+r 0x102ff880
+r 0x103bfc40
+r 0x10696700
+r 0x10104180
+r 0x105afa00
+w 0x102dba00
+r 0x10301000
+r 0x104b7e80
+w 0x106f0c40
+r 0x103be340
+r 0x1048f8c0
+r 0x102e6680
+r 0x10456cc0
+r 0x10422f40
+r 0x10600c00
+r 0x1067a880
+r 0x105f9f00
+r 0x102db740
+r 0x104e6180
+r 0x107c60c0
+r 0x10132840
+r 0x10333880
+r 0x1020e440
+r 0x103acfc0
+r 0x106ee8c0
+r 0x1039b640
+w 0x101ac340
+w 0x101a7140
+w 0x101fc240
+r 0x10370b40
+r 0x106aa300
+r 0x10021400
+r 0x104e5d00
+r 0x10157540
+r 0x10617500
+w 0x102c9940
+r 0x101e4180
+r 0x1034f5c0
+r 0x10294640
+w 0x1054eec0
+r 0x10170c40
+w 0x10750c80
+w 0x102e3ec0
+w 0x102ceb00
+r 0x106bca40
+w 0x106fb200
+w 0x10393c00
+r 0x104850c0
+w 0x107f3780
+r 0x10105d00
+r 0x10305d40
+r 0x103b1480
+w 0x10166bc0
+r 0x105e5a40
+r 0x103f7440
+r 0x105982c0
+r 0x10634680
+r 0x1071a940
+w 0x107a30c0
+w 0x101c9140
+r 0x10724a40
+r 0x106b3d00
+r 0x1023d0c0
+r 0x100f44c0
+r 0x102816c0
+r 0x101777c0
+r 0x1005e4c0
+w 0x104347c0
+r 0x105e40c0
+r 0x101edcc0
+r 0x10168200
+r 0x1041c300
+r 0x10105140
+r 0x10445f80
+r 0x103c5700
+r 0x1054c8c0
+r 0x10085d40
+r 0x1056fd00
+r 0x1027ba40
+r 0x107fc8c0
+w 0x107f9140
+w 0x10578b80
+r 0x103c11c0
+w 0x105255c0
+r 0x105fc1c0
+w 0x102b6580
+r 0x102ab240
+w 0x103cfd40
+r 0x102d3000
+r 0x10643a40
+r 0x103fb480
+r 0x100fbac0
+r 0x1037ff00
+r 0x1015b9c0
+w 0x107adfc0
+r 0x1061dc80
+r 0x103430c0
+w 0x101cfcc0
+r 0x101e2040
+w 0x10643d80
+w 0x105aacc0
+r 0x10658200
+r 0x10662200
+r 0x100e6280
+r 0x105b8080
+r 0x1008ea40
+r 0x101c2e40
+r 0x1073f800
+r 0x10239b80
+r 0x10525980
+r 0x107c8a40
+r 0x10578480
+r 0x10155c80
+r 0x104c33c0
+r 0x101dc640
+r 0x10369c40
+w 0x10666d00
+r 0x1069d800
+r 0x10045840
+w 0x1079c500
+w 0x107bd580
+r 0x1053adc0
+r 0x10001d00
+w 0x1051df40
+r 0x10468f00
+w 0x10087880
+r 0x10769180
+r 0x103e29c0
+r 0x102ead40
+r 0x100645c0
+w 0x100e97c0
+w 0x107dcc80
+r 0x1072b480
+w 0x101d5c40
+w 0x10735400
+w 0x107e8fc0
+r 0x1004a2c0
+r 0x1046b480
+r 0x105ea900
+w 0x103a8940
+w 0x106a8e00
+r 0x1031a2c0
+r 0x1058e940
+r 0x10374400
+r 0x103f4100
+w 0x104507c0
+r 0x10346f00
+r 0x10504080
+r 0x1050e080
+w 0x107a4b80
+r 0x10522840
+r 0x10305940
+r 0x104c85c0
+w 0x102a3500
+w 0x105f2780
+r 0x1057fb40
+w 0x104e3740
+r 0x10196b00
+w 0x105c82c0
+r 0x101ad340
+w 0x103c6140
+r 0x1078afc0
+r 0x103cb180
+r 0x10115280
+r 0x1054b400
+r 0x106b0680
+w 0x10751a00
+r 0x103ec100
+w 0x100e1500
+r 0x10603b80
+r 0x10579b80
+r 0x10628f00
+r 0x1000a880
+r 0x106553c0
+r 0x105e2480
+r 0x1028d500
+w 0x10611a80
+r 0x10658080
+w 0x105a7080
+r 0x10178e40
+w 0x104a8780
+w 0x100f3d80
+w 0x10386340
+r 0x102eb280
+r 0x102d4dc0
+r 0x107d68c0
+w 0x1003aa00
+r 0x10170840
+r 0x105ce380
+r 0x103fd9c0
+r 0x104c6040
+r 0x10081900
+r 0x10244540
+r 0x10505200
+w 0x101df280
+r 0x101abb00
+r 0x1024d800
+w 0x10653700
+r 0x102a3ac0
+r 0x10631d80
+w 0x101dc780
+r 0x10050680
+w 0x10644980
+r 0x100a9b40
+r 0x10328540
+w 0x10390380
+r 0x106bc480
+r 0x1003d7c0
+r 0x10671180
+r 0x100f4b80
+r 0x10309600
+r 0x10277200
+r 0x10330a40
+r 0x10373c80
+r 0x105feec0
+r 0x100c4080
+r 0x10075300
+r 0x10523080
+r 0x10284540
+r 0x10144f80
+r 0x105ccd40
+r 0x105d0cc0
+w 0x104ed300
+w 0x1005fe80
+r 0x103b66c0
+r 0x107dcf40
+r 0x1036b240
+r 0x10716f40
+r 0x10515200
+r 0x1012c100
+r 0x1051c880
+r 0x1014f300
+r 0x10576400
+w 0x10479540
+w 0x1076b5c0
+w 0x1050a340
+r 0x1000f480
+w 0x103dc440
+r 0x102292c0
+w 0x101f6500
+r 0x105e8080
+r 0x102ee100
+r 0x1033e080
+w 0x107336c0
+w 0x105590c0
+r 0x10400d40
+w 0x103fc0c0
+w 0x102cdbc0
+r 0x102b5d00
+r 0x1017d740
+r 0x1009b280
+w 0x1037a640
+r 0x101e3ec0
+r 0x107bfbc0
+r 0x10471580
+r 0x1018e240
+r 0x102a0fc0
+r 0x1052aec0
+r 0x1076db40
+w 0x101841c0
+w 0x101eff40
+w 0x10315440
+w 0x1069ee40
+r 0x104295c0
+r 0x10559b40
+w 0x104c3e40
+r 0x1056bc00
+r 0x102576c0
+w 0x107f0280
+w 0x104d6300
+r 0x1046dac0
+w 0x1050f300
+r 0x104917c0
+r 0x1070bc40
+r 0x106dbe40
+w 0x10341a00
+r 0x106eebc0
+r 0x105ce140
+r 0x101e7440
+w 0x107b1500
+r 0x10270fc0
+w 0x107e3a00
+w 0x10556bc0
+r 0x105833c0
+r 0x1034c640
+r 0x105d1480
+w 0x1002ee80
+r 0x104ffec0
+r 0x10519000
+r 0x107599c0
+r 0x10101140
+r 0x106273c0
+r 0x107e1540
+w 0x10420440
+r 0x107050c0
+r 0x107c9940
+r 0x106d4cc0
+r 0x10051ec0
+r 0x10447e00
+r 0x1012c2c0
+r 0x1029bbc0
+r 0x1034dbc0
+w 0x10232dc0
+r 0x101e8d00
+r 0x10017540
+w 0x10222e80
+r 0x101ac640
+r 0x10228900
+r 0x102340c0
+w 0x10323e40
+w 0x107c0680
+r 0x1074e740
+r 0x10455e80
+w 0x102be400
+r 0x100dba80
+r 0x106c2ec0
+w 0x1072f840
+w 0x106dc880
+r 0x1035a540
+r 0x1025eac0
+w 0x10225380
+r 0x1003a380
+r 0x105f5a80
+r 0x1053a100
+r 0x10093880
+r 0x105d3700
+r 0x10522240
+r 0x1066c840
+w 0x107f0c80
+r 0x1003e700
+r 0x103f9a40
+w 0x105ac800
+r 0x105de900
+r 0x10345980
+w 0x10593080
+r 0x1065fd00
+r 0x10420080
+r 0x106b0a00
+r 0x1068bb80
+w 0x107b79c0
+w 0x10242380
+w 0x10601ec0
+r 0x107612c0
+w 0x10744780
+r 0x1048b880
+w 0x103c3600
+r 0x10277c00
+r 0x10592800
+r 0x1043d940
+w 0x102cca00
+w 0x100a88c0
+r 0x105c3b40
+r 0x105c3e00
+w 0x10642240
+r 0x100e3140
+w 0x105a7040
+r 0x10589340
+w 0x106c2580
+r 0x1067a9c0
+w 0x100c7f80
+r 0x100ee440
+r 0x1067ae40
+r 0x10197f00
+r 0x107ec600
+w 0x101ff900
+r 0x1005f740
+r 0x10404a00
+r 0x104cdf00
+r 0x10001a40
+r 0x10617280
+r 0x103c7780
+r 0x10121300
+r 0x10093680
+r 0x103d5b80
+r 0x1069c1c0
+w 0x106f2f40
+r 0x10250040
+r 0x1075d4c0
+r 0x10407cc0
+w 0x10333bc0
+r 0x10036140
+w 0x107ab500
+r 0x10709b00
+r 0x1034bb40
+w 0x1046e1c0
+w 0x104f51c0
+r 0x107432c0
+r 0x1001a8c0
+r 0x107f97c0
+r 0x104c2a80
+w 0x100c2200
+r 0x1019a1c0
+w 0x106a6ec0
+r 0x100b0100
+r 0x10403ec0
+r 0x10250ac0
+r 0x106536c0
+r 0x10718100
+r 0x104fda00
+w 0x10057600
+r 0x103ed680
+w 0x100cd940
+w 0x1016a680
+r 0x105ecec0
+r 0x101e48c0
+w 0x1032eb80
+w 0x100e3a40
+w 0x10622d40
+r 0x10419bc0
+w 0x104e5480
+r 0x1064f800
+w 0x102b9640
+r 0x107bbe00
+r 0x103ee180
+r 0x1060a840
+r 0x1018cf00
+r 0x106883c0
+r 0x10661280
+r 0x10195bc0
+r 0x100fc2c0
+w 0x1075ae80
+r 0x1025b800
+w 0x1078fc80
+r 0x1037bd80
+r 0x101cbdc0
+r 0x1075e800
+w 0x10031b80
+w 0x1075cd80
+w 0x101dfdc0
+r 0x1024ac80
+w 0x1047d740
+r 0x104a2740
+w 0x1012b6c0
+w 0x10649180
+w 0x105c4e40
+w 0x101e7700
+r 0x10506b40
+r 0x106cbe80
+r 0x10617f40
+r 0x10205400
+r 0x101f9340
+w 0x10089d00
+r 0x100c51c0
+r 0x101b1840
+w 0x10380fc0
+r 0x1052ff00
+r 0x1025e600
+r 0x103e7c00
+w 0x103f1f40
+r 0x106d9300
+w 0x10079440
+w 0x1005a700
+r 0x10521a80
+r 0x103b7480
+r 0x10128100
+w 0x106baac0
+w 0x104efc00
+r 0x1005ccc0
+r 0x102fae80
+r 0x10653e00
+w 0x1017b900
+r 0x105b39c0
+w 0x106fafc0
+r 0x10228780
+r 0x100b42c0
+w 0x10663c40
+w 0x10075400
+r 0x106c03c0
+w 0x10662540
+r 0x10271740
+w 0x105877c0
+r 0x1045c200
+r 0x100aa480
+r 0x10783ac0
+r 0x101ade00
+r 0x105ece40
+r 0x1008d680
+r 0x101a0b40
+w 0x1057ba40
+r 0x102ae400
+r 0x103281c0
+r 0x104cf080
+r 0x105da300
+w 0x105e6a40
+w 0x10728580
+r 0x105abf00
+r 0x1077a100
+r 0x10776e00
+r 0x10387c80
+w 0x103ed700
+w 0x1003a440
+r 0x10032cc0
+r 0x10159500
+r 0x106b7100
+w 0x10407240
+w 0x10607480
+r 0x10333cc0
+w 0x10713040
+r 0x1014fe00
+r 0x10388980
+w 0x1048de80
+r 0x104823c0
+w 0x10360180
+r 0x1024b800
+r 0x10449880
+w 0x100af5c0
+r 0x100e34c0
+r 0x1078bd40
+r 0x10212980
+r 0x1056c900
+r 0x107ae580
+r 0x100b96c0
+w 0x100e6d00
+r 0x10014a80
+r 0x107bea80
+r 0x101d3e40
+w 0x1056f540
+r 0x10187540
+r 0x10553b80
+r 0x104628c0
+w 0x10096000
+r 0x10549680
+r 0x105a0f80
+w 0x106f8ac0
+w 0x10618380
+r 0x102eb640
+r 0x100f2900
+r 0x10023140
+w 0x10712c40
+r 0x103b4980
+w 0x10717240
+r 0x10071000
+r 0x1072e340
+r 0x1036e6c0
+w 0x105fe4c0
+w 0x101f18c0
+r 0x10031c80
+r 0x104dc000
+r 0x101d4840
+r 0x10408580
+r 0x102c4ec0
+r 0x1011b3c0
+r 0x10306580
+w 0x104adf40
+w 0x104c6540
+r 0x1006aac0
+w 0x10133b00
+r 0x104a4040
+r 0x1075e440
+r 0x1055e000
+r 0x105d0440
+w 0x10179480
+w 0x10460900
+r 0x1075d840
+r 0x107b19c0
+r 0x106f1780
+w 0x100e7080
+r 0x102c3880
+r 0x10439a00
+r 0x100f5f00
+r 0x100df300
+r 0x1014a2c0
+r 0x107564c0
+r 0x102aba80
+r 0x103fa4c0
+r 0x102d28c0
+r 0x101bcd40
+r 0x100fe780
+r 0x1000cc40
+w 0x1066e000
+r 0x107ce5c0
+r 0x10428980
+w 0x1047d900
+r 0x10234e00
+r 0x106960c0
+r 0x103a4040
+r 0x104f4940
+w 0x101b2280
+w 0x106b50c0
+r 0x10159c80
+r 0x10637f00
+r 0x10405840
+r 0x1013b340
+r 0x105b5d00
+w 0x10407c00
+r 0x101ab280
+w 0x1064c440
+r 0x101b9d00
+w 0x106e0ac0
+r 0x10087f40
+r 0x1014dc00
+r 0x103cc580
+w 0x106f9cc0
+r 0x101b8880
+r 0x103c27c0
+r 0x10334c40
+r 0x100edb40
+r 0x106d9280
+w 0x101d3100
+r 0x1056fdc0
+w 0x10486f40
+r 0x10183b80
@@ -0,0 +1,16000 @@
+0 w 0x20002180
+1 r 0x10108600
+2 r 0x20002dc0
+3 w 0x103222c0
+4 w 0x10408d80
+5 w 0x20002bc0
+6 r 0x106111c0
+7 r 0x10716c40
+8 r 0x10806e40
+9 r 0x1092a7c0
+10 w 0x10a031c0
+11 w 0x20003c40
+12 r 0x10c01a40
+13 r 0x10d3f3c0
+14 r 0x10e00d80
+15 r 0x10f21b00
+0 w 0x20002f80
+1 w 0x1013cdc0
+2 r 0x1022aa00
+3 w 0x10328c00
+4 w 0x10401280
+5 r 0x1053c940
+6 r 0x20001700
+7 r 0x107002c0
+8 w 0x200029c0
+9 w 0x10930e40
+10 w 0x20000500
+11 r 0x10b040c0
+12 r 0x10c21280
+13 r 0x10d3fdc0
+14 r 0x10e0e680
+15 w 0x20001740
+0 w 0x100176c0
+1 r 0x101098c0
+2 r 0x20002d80
+3 w 0x1030d680
+4 r 0x20003f80
+5 r 0x1050df80
+6 r 0x106178c0
+7 r 0x10736f40
+8 w 0x10806480
+9 r 0x10906e00
+10 r 0x10a3d680
+11 r 0x10b23100
+12 r 0x10c2e6c0
+13 r 0x10d3fec0
+14 r 0x10e18740
+15 r 0x10f0e5c0
+0 r 0x10028a40
+1 r 0x10100880
+2 r 0x10236080
+3 r 0x10311b80
+4 r 0x10426b80
+5 r 0x1053f700
+6 w 0x10634080
+7 r 0x1072d2c0
+8 r 0x10829080
+9 r 0x10917980
+10 w 0x10a1d840
+11 r 0x10b087c0
+12 w 0x10c33c80
+13 r 0x10d26d00
+14 w 0x10e28ac0
+15 w 0x10f38a40
+0 w 0x10011480
+1 r 0x101338c0
+2 r 0x102131c0
+3 r 0x1033cb40
+4 w 0x1040a100
+5 r 0x20001a40
+6 r 0x10620640
+7 r 0x1071e880
+8 r 0x10834dc0
+9 w 0x200022c0
+10 r 0x10a10b00
+11 r 0x10b2aec0
+12 r 0x10c2aa80
+13 r 0x10d0b400
+14 r 0x10e3d440
+15 w 0x10f10d00
+0 r 0x10030900
+1 r 0x1011d780
+2 r 0x10227500
+3 w 0x10300240
+4 w 0x20003a00
+5 r 0x1052eb40
+6 r 0x106161c0
+7 r 0x10718340
+8 r 0x20002100
+9 r 0x10914c00
+10 r 0x10a32900
+11 w 0x20003100
+12 r 0x20000880
+13 w 0x20003180
+14 r 0x10e3bb40
+15 r 0x10f22ec0
+0 r 0x1002d480
+1 w 0x1013ce80
+2 r 0x1021a040
+3 w 0x103322c0
+4 r 0x10400c00
+5 r 0x1050e700
+6 r 0x10611980
+7 w 0x10703340
+8 r 0x10816840
+9 r 0x109249c0
+10 w 0x10a1c340
+11 w 0x10b3d2c0
+12 w 0x10c074c0
+13 r 0x10d04a00
+14 r 0x20001ec0
+15 r 0x10f39d40
+0 w 0x20001400
+1 r 0x20002bc0
+2 r 0x20003a80
+3 r 0x10335f00
+4 w 0x10435dc0
+5 r 0x10526dc0
+6 r 0x10626800
+7 w 0x1070aac0
+8 w 0x10803d00
+9 r 0x1090bcc0
+10 r 0x20003840
+11 r 0x10b31a80
+12 r 0x10c05a40
+13 r 0x10d35340
+14 r 0x10e00700
+15 w 0x10f078c0
+0 r 0x10001140
+1 r 0x10129bc0
+2 r 0x20003f00
+3 w 0x20001580
+4 r 0x1040b440
+5 r 0x10522c00
+6 w 0x10635940
+7 w 0x200010c0
+8 w 0x1080f640
+9 w 0x109055c0
+10 w 0x10a0e240
+11 w 0x10b39480
+12 r 0x10c3a500
+13 r 0x20003240
+14 r 0x20001540
+15 r 0x10f2e600
+0 w 0x1003ca40
+1 w 0x20001b00
+2 r 0x1023d580
+3 w 0x1032de80
+4 r 0x20001f40
+5 r 0x10519f00
+6 w 0x106203c0
+7 r 0x1071b5c0
+8 w 0x108024c0
+9 r 0x10910200
+10 r 0x10a02b40
+11 r 0x10b037c0
+12 r 0x10c35a40
+13 r 0x20000180
+14 r 0x10e2e900
+15 r 0x10f20140
+0 w 0x100392c0
+1 w 0x1013e840
+2 r 0x10200080
+3 r 0x20003fc0
+4 w 0x1042e800
+5 r 0x20003b00
+6 r 0x10627100
+7 r 0x107398c0
+8 r 0x1082a780
+9 r 0x1090c300
+10 r 0x10a32f80
+11 w 0x10b29fc0
+12 r 0x10c38cc0
+13 w 0x10d310c0
+14 r 0x20001080
+15 r 0x10f37bc0
+0 r 0x1003e440
+1 r 0x1011f5c0
+2 w 0x10201440
+3 r 0x10306bc0
+4 w 0x20001ac0
+5 r 0x1052c840
+6 r 0x10613a40
+7 r 0x20001600
+8 r 0x1082f680
+9 r 0x1090a1c0
+10 r 0x10a3d8c0
+11 w 0x10b38ec0
+12 w 0x10c37640
+13 w 0x20002b00
+14 w 0x10e36280
+15 r 0x10f14bc0
+0 r 0x1000b9c0
+1 r 0x20000400
+2 r 0x1022fd00
+3 r 0x1030bbc0
+4 w 0x1041b200
+5 w 0x1050adc0
+6 r 0x10615940
+7 r 0x1070d540
+8 r 0x20000a80
+9 w 0x20000fc0
+10 r 0x10a38700
+11 r 0x10b331c0
+12 r 0x10c03000
+13 r 0x10d335c0
+14 r 0x10e38300
+15 w 0x10f31cc0
+0 w 0x20000800
+1 r 0x10112a80
+2 r 0x10209580
+3 r 0x1033cc00
+4 w 0x1041e140
+5 r 0x1053f600
+6 r 0x1062e900
+7 w 0x1070aa00
+8 w 0x10831f80
+9 r 0x1090a800
+10 w 0x10a18b40
+11 w 0x20000f80
+12 r 0x20002c80
+13 r 0x10d05d40
+14 w 0x10e18880
+15 r 0x10f2bcc0
+0 r 0x10016040
+1 w 0x200030c0
+2 r 0x10213c80
+3 r 0x1032e000
+4 r 0x200014c0
+5 w 0x105394c0
+6 r 0x10629500
+7 w 0x10705f00
+8 r 0x1082ac00
+9 r 0x20001c40
+10 r 0x10a12500
+11 w 0x10b26b40
+12 w 0x10c08180
+13 w 0x20001200
+14 r 0x10e1b700
+15 r 0x10f18e00
+0 w 0x10005a00
+1 r 0x101266c0
+2 r 0x1023ca00
+3 w 0x10308c00
+4 r 0x10407b40
+5 r 0x20003000
+6 w 0x10618f40
+7 w 0x1072e740
+8 r 0x20003ac0
+9 r 0x109005c0
+10 w 0x20002f80
+11 r 0x10b07640
+12 r 0x20001f40
+13 r 0x10d2fbc0
+14 r 0x20001980
+15 w 0x10f0c0c0
+0 w 0x10014ac0
+1 r 0x1013c380
+2 r 0x102396c0
+3 w 0x1031e0c0
+4 w 0x10428d80
+5 r 0x10537d40
+6 r 0x1062c940
+7 w 0x1070eec0
+8 r 0x10825cc0
+9 r 0x10905200
+10 w 0x10a08080
+11 w 0x20001c80
+12 r 0x10c163c0
+13 r 0x10d06900
+14 r 0x10e14700
+15 r 0x10f168c0
+0 r 0x10038080
+1 r 0x10135c80
+2 r 0x10217000
+3 r 0x10318ac0
+4 r 0x10410200
+5 r 0x20002280
+6 r 0x1063c880
+7 r 0x10721f00
+8 r 0x10813a80
+9 r 0x10935640
+10 r 0x10a39d00
+11 r 0x10b289c0
+12 r 0x10c0b540
+13 r 0x10d3fa40
+14 r 0x10e3fe80
+15 r 0x10f0cd40
+0 r 0x100148c0
+1 r 0x1013d080
+2 r 0x10232b40
+3 r 0x10316d00
+4 r 0x10415ec0
+5 r 0x10521dc0
+6 r 0x10626140
+7 r 0x10732b40
+8 w 0x10811cc0
+9 r 0x10902740
+10 r 0x10a25800
+11 w 0x20002080
+12 r 0x10c15940
+13 r 0x10d0aa00
+14 r 0x10e10900
+15 r 0x10f016c0
+0 r 0x10004380
+1 w 0x20000a40
+2 w 0x10222740
+3 r 0x10320740
+4 w 0x20002a40
+5 w 0x20000f80
+6 w 0x10612100
+7 r 0x10717900
+8 w 0x1081f940
+9 w 0x10933d00
+10 r 0x10a2c2c0
+11 w 0x20002e40
+12 r 0x10c16e40
+13 r 0x10d20b80
+14 r 0x10e0cec0
+15 r 0x10f3f900
+0 r 0x1001ac40
+1 r 0x10114cc0
+2 r 0x10204d40
+3 w 0x10337bc0
+4 w 0x20003840
+5 r 0x10515ac0
+6 r 0x106249c0
+7 w 0x20002a00
+8 r 0x108313c0
+9 w 0x20003380
+10 r 0x10a161c0
+11 w 0x10b06b00
+12 r 0x10c2e0c0
+13 r 0x10d31000
+14 r 0x10e3f380
+15 r 0x10f29b40
+0 r 0x1001f8c0
+1 r 0x101243c0
+2 w 0x1021d980
+3 r 0x10320f40
+4 r 0x10408400
+5 r 0x1051eec0
+6 r 0x1060f580
+7 r 0x20003140
+8 r 0x10825b00
+9 r 0x10908700
+10 r 0x10a11c00
+11 r 0x10b30440
+12 r 0x10c05bc0
+13 r 0x10d34080
+14 r 0x10e36200
+15 w 0x10f01c80
+0 r 0x10035c40
+1 r 0x10123180
+2 r 0x10200780
+3 w 0x200006c0
+4 w 0x1042b3c0
+5 r 0x10524380
+6 r 0x1061f980
+7 r 0x10733800
+8 r 0x20001b00
+9 r 0x10907940
+10 r 0x10a14b80
+11 r 0x10b0ac40
+12 r 0x10c2bdc0
+13 r 0x10d14500
+14 r 0x10e33180
+15 w 0x20001940
+0 w 0x20002b80
+1 w 0x1013fac0
+2 r 0x1022a200
+3 r 0x20003680
+4 w 0x20002dc0
+5 w 0x20003b40
+6 w 0x200036c0
+7 r 0x10735440
+8 w 0x20001dc0
+9 r 0x10928680
+10 r 0x10a0a880
+11 w 0x20003f40
+12 r 0x10c27940
+13 r 0x10d370c0
+14 w 0x20002a00
+15 r 0x10f3ae00
+0 r 0x100212c0
+1 r 0x1011cb80
+2 w 0x10212640
+3 w 0x1033e480
+4 r 0x1042f740
+5 r 0x10508100
+6 r 0x1063e9c0
+7 w 0x20000080
+8 r 0x10810880
+9 r 0x1091fa80
+10 r 0x20002040
+11 r 0x20001200
+12 r 0x10c3c100
+13 r 0x10d14d00
+14 w 0x10e1ec00
+15 w 0x10f0ba40
+0 w 0x10024240
+1 r 0x10126300
+2 r 0x1020dc00
+3 w 0x10329e00
+4 r 0x10439740
+5 r 0x10515980
+6 r 0x10616f40
+7 r 0x10700640
+8 w 0x1082ed80
+9 w 0x20002040
+10 w 0x20001c00
+11 r 0x10b27640
+12 r 0x20000680
+13 w 0x10d246c0
+14 r 0x10e1ee40
+15 w 0x10f15f40
+0 r 0x10022f80
+1 w 0x10119cc0
+2 r 0x10229b80
+3 w 0x10310300
+4 r 0x10432dc0
+5 r 0x10510d40
+6 r 0x10626cc0
+7 w 0x10720e00
+8 r 0x10826340
+9 r 0x109355c0
+10 r 0x200028c0
+11 r 0x20000dc0
+12 r 0x10c065c0
+13 r 0x10d08f80
+14 w 0x10e22080
+15 w 0x20002080
+0 w 0x1003e000
+1 r 0x1011ba00
+2 r 0x102230c0
+3 w 0x10334f40
+4 r 0x20003640
+5 r 0x1053dd80
+6 w 0x200032c0
+7 r 0x20000040
+8 r 0x10803840
+9 w 0x1093d580
+10 r 0x10a258c0
+11 w 0x20003f00
+12 w 0x10c2dbc0
+13 r 0x10d20500
+14 r 0x10e3e780
+15 w 0x10f15c40
+0 r 0x1001d4c0
+1 w 0x10101a00
+2 w 0x10217ec0
+3 r 0x1031c580
+4 r 0x1043af80
+5 r 0x10520500
+6 r 0x1062b0c0
+7 w 0x1072f640
+8 r 0x10808240
+9 r 0x10939b00
+10 r 0x10a0cac0
+11 w 0x10b39980
+12 r 0x10c2b000
+13 w 0x10d3f440
+14 r 0x10e18a80
+15 r 0x10f28000
+0 r 0x10028c80
+1 w 0x20003900
+2 r 0x10210180
+3 w 0x10337740
+4 r 0x1042e480
+5 w 0x10522800
+6 r 0x1062c380
+7 r 0x10710600
+8 r 0x1082bc00
+9 r 0x20002d00
+10 r 0x10a2b100
+11 r 0x200012c0
+12 r 0x10c17f80
+13 r 0x10d25d40
+14 r 0x10e21e00
+15 w 0x10f2b980
+0 r 0x1001bec0
+1 r 0x10136bc0
+2 r 0x20000780
+3 w 0x10329c80
+4 w 0x1043cac0
+5 w 0x10515400
+6 r 0x10600d80
+7 r 0x10703500
+8 w 0x108378c0
+9 r 0x109345c0
+10 r 0x10a00140
+11 r 0x10b2c440
+12 w 0x10c06b80
+13 w 0x10d27580
+14 r 0x20000ec0
+15 r 0x20001ec0
+0 r 0x10027780
+1 r 0x101087c0
+2 w 0x10228b40
+3 r 0x10310a40
+4 w 0x10415640
+5 w 0x10529b00
+6 r 0x10624300
+7 w 0x200015c0
+8 w 0x20003d80
+9 r 0x20003040
+10 r 0x10a006c0
+11 r 0x10b11800
+12 r 0x10c2a580
+13 r 0x10d0ab80
+14 w 0x20003840
+15 r 0x20003000
+0 r 0x20000c80
+1 w 0x1012ba00
+2 w 0x200026c0
+3 r 0x20003bc0
+4 w 0x20002000
+5 w 0x1053de80
+6 r 0x10624440
+7 r 0x1072e8c0
+8 r 0x20002e40
+9 r 0x20002100
+10 w 0x20001480
+11 w 0x10b39ac0
+12 w 0x10c08440
+13 r 0x10d383c0
+14 r 0x10e18d00
+15 w 0x20001580
+0 w 0x20003540
+1 r 0x10112540
+2 r 0x20003fc0
+3 r 0x10331d40
+4 w 0x1042bd40
+5 r 0x20003b40
+6 r 0x10626380
+7 w 0x10735c40
+8 w 0x108035c0
+9 r 0x10928ac0
+10 w 0x200033c0
+11 w 0x10b05900
+12 r 0x10c0ab00
+13 w 0x10d0b140
+14 r 0x10e28200
+15 r 0x10f36bc0
+0 r 0x10006c00
+1 r 0x10130380
+2 w 0x200026c0
+3 r 0x1030dc00
+4 w 0x1040bc80
+5 r 0x1052be40
+6 w 0x20001280
+7 r 0x1073b3c0
+8 r 0x1080f200
+9 w 0x10916f00
+10 r 0x20002300
+11 w 0x10b0de40
+12 r 0x10c295c0
+13 r 0x10d04040
+14 w 0x10e25ec0
+15 r 0x10f384c0
+0 r 0x1003e440
+1 r 0x10130300
+2 r 0x10224600
+3 r 0x1030d340
+4 w 0x104139c0
+5 r 0x10501ac0
+6 r 0x10615240
+7 r 0x107229c0
+8 w 0x20002a00
+9 w 0x10924b00
+10 w 0x10a00300
+11 w 0x20003800
+12 r 0x10c1a140
+13 r 0x10d05380
+14 r 0x10e11900
+15 w 0x10f16700
+0 w 0x1000b1c0
+1 r 0x101131c0
+2 w 0x10235080
+3 w 0x1030af80
+4 r 0x1043c200
+5 r 0x10505840
+6 r 0x1062e800
+7 r 0x107334c0
+8 w 0x20003280
+9 r 0x1090a080
+10 w 0x10a3f3c0
+11 w 0x20002440
+12 w 0x10c18c00
+13 w 0x10d34500
+14 w 0x20002f80
+15 r 0x10f04b40
+0 w 0x1002b880
+1 w 0x10130d40
+2 r 0x1020b740
+3 r 0x103260c0
+4 w 0x200036c0
+5 w 0x10517800
+6 r 0x1062ae80
+7 w 0x1073b600
+8 w 0x20000140
+9 r 0x1092d400
+10 w 0x200000c0
+11 r 0x10b0bbc0
+12 r 0x10c2c4c0
+13 r 0x20000080
+14 r 0x10e39500
+15 w 0x200025c0
+0 r 0x100391c0
+1 r 0x101034c0
+2 w 0x20000540
+3 r 0x1032b2c0
+4 r 0x1043df00
+5 r 0x20000780
+6 r 0x10609a40
+7 r 0x1072cc80
+8 r 0x10831dc0
+9 r 0x1090c6c0
+10 w 0x10a14240
+11 r 0x10b18100
+12 w 0x20003440
+13 w 0x10d03100
+14 r 0x10e2adc0
+15 r 0x10f1be00
+0 r 0x10034340
+1 r 0x10126300
+2 w 0x1022ab40
+3 r 0x10335600
+4 r 0x1041a740
+5 w 0x1053d340
+6 r 0x10621500
+7 r 0x107140c0
+8 w 0x1082e440
+9 r 0x109342c0
+10 r 0x10a12dc0
+11 r 0x10b377c0
+12 r 0x20003540
+13 r 0x10d31f80
+14 w 0x200016c0
+15 w 0x10f2b900
+0 w 0x10015f80
+1 r 0x10122380
+2 w 0x10239a80
+3 r 0x10309c40
+4 w 0x1042f8c0
+5 r 0x10514740
+6 w 0x1060b6c0
+7 w 0x10703400
+8 r 0x10838640
+9 r 0x1091e4c0
+10 w 0x20000740
+11 r 0x10b25dc0
+12 w 0x10c2e940
+13 r 0x200019c0
+14 r 0x10e3c3c0
+15 w 0x10f0d300
+0 r 0x1001e2c0
+1 r 0x20000140
+2 r 0x1021af00
+3 w 0x10320fc0
+4 w 0x104267c0
+5 r 0x10505ac0
+6 w 0x106144c0
+7 r 0x10707c40
+8 w 0x10827b00
+9 r 0x10913040
+10 w 0x10a08f00
+11 w 0x10b067c0
+12 r 0x10c0d880
+13 r 0x10d1f4c0
+14 w 0x10e27880
+15 r 0x10f32480
+0 r 0x10035740
+1 w 0x10113ec0
+2 r 0x1020e340
+3 r 0x10311280
+4 r 0x1043a780
+5 r 0x200031c0
+6 r 0x200015c0
+7 r 0x10706840
+8 r 0x108086c0
+9 r 0x20000200
+10 r 0x10a29980
+11 r 0x20003140
+12 r 0x20003240
+13 r 0x10d09e80
+14 r 0x10e15c40
+15 w 0x10f2e700
+0 w 0x10024ec0
+1 r 0x1013ce00
+2 w 0x20001dc0
+3 w 0x1032a640
+4 w 0x20000a40
+5 w 0x10521cc0
+6 w 0x200034c0
+7 r 0x10739c40
+8 r 0x10821d40
+9 w 0x1093d1c0
+10 r 0x10a33400
+11 r 0x10b0cec0
+12 w 0x10c3be80
+13 w 0x20001f00
+14 r 0x10e2cb00
+15 w 0x10f1b6c0
+0 r 0x1000d440
+1 r 0x1012c880
+2 r 0x10205b00
+3 w 0x20003c40
+4 w 0x104083c0
+5 w 0x20001ac0
+6 w 0x20002040
+7 w 0x10713b80
+8 r 0x10810740
+9 r 0x1092fc00
+10 w 0x200010c0
+11 r 0x10b11c40
+12 r 0x10c1db80
+13 r 0x10d16b00
+14 r 0x10e0dc40
+15 w 0x10f0c3c0
+0 r 0x10017840
+1 w 0x1011d1c0
+2 r 0x10228a80
+3 w 0x1030a2c0
+4 w 0x20002f80
+5 r 0x1052ec00
+6 w 0x10618280
+7 r 0x10705d00
+8 r 0x10829840
+9 w 0x1090fcc0
+10 r 0x20002680
+11 w 0x10b3d980
+12 w 0x20000600
+13 r 0x10d2f500
+14 r 0x10e22ac0
+15 r 0x10f01ac0
+0 w 0x10039cc0
+1 w 0x101386c0
+2 r 0x1022edc0
+3 w 0x1033eb00
+4 r 0x1041a0c0
+5 w 0x10515140
+6 w 0x1063e780
+7 r 0x10722540
+8 r 0x1080a0c0
+9 r 0x1093f400
+10 w 0x20002f00
+11 w 0x20000f00
+12 r 0x10c12a80
+13 r 0x10d30b80
+14 w 0x10e04100
+15 w 0x20003bc0
+0 w 0x20003b00
+1 r 0x10120980
+2 r 0x20002bc0
+3 r 0x10324e40
+4 w 0x10432240
+5 w 0x1051e680
+6 r 0x10612280
+7 r 0x1070e440
+8 w 0x1083e7c0
+9 w 0x10900f80
+10 r 0x10a2d000
+11 r 0x20002880
+12 r 0x10c35780
+13 w 0x10d2f5c0
+14 r 0x10e18bc0
+15 r 0x10f3afc0
+0 r 0x10036800
+1 r 0x10121f80
+2 w 0x20000b40
+3 r 0x10319dc0
+4 w 0x10418cc0
+5 r 0x105342c0
+6 r 0x106145c0
+7 r 0x10716f00
+8 w 0x10810880
+9 r 0x10901b80
+10 w 0x10a3b9c0
+11 r 0x10b0b6c0
+12 w 0x10c27d80
+13 r 0x10d2b680
+14 r 0x10e2bec0
+15 r 0x10f34e00
+0 r 0x1001f800
+1 r 0x10125880
+2 r 0x1022bec0
+3 w 0x20003900
+4 r 0x20002fc0
+5 r 0x10522340
+6 w 0x10618dc0
+7 r 0x10708f00
+8 w 0x1082e680
+9 w 0x10928340
+10 r 0x10a16340
+11 w 0x10b2e300
+12 w 0x10c28a80
+13 r 0x10d01340
+14 w 0x10e0f400
+15 w 0x10f1b880
+0 r 0x20001e00
+1 w 0x1011f880
+2 r 0x1020b400
+3 r 0x20001780
+4 w 0x10402140
+5 w 0x200008c0
+6 r 0x20002580
+7 r 0x107280c0
+8 r 0x10839e40
+9 r 0x10932dc0
+10 w 0x10a15140
+11 r 0x10b2f8c0
+12 w 0x10c1b900
+13 r 0x10d3a880
+14 w 0x10e308c0
+15 w 0x20003a40
+0 r 0x1003c500
+1 r 0x10110240
+2 w 0x1020de40
+3 r 0x1032eec0
+4 w 0x10412680
+5 r 0x105371c0
+6 r 0x1063c5c0
+7 r 0x107291c0
+8 r 0x10807180
+9 r 0x1093f180
+10 r 0x10a17400
+11 r 0x10b20f00
+12 w 0x10c05ec0
+13 r 0x10d01680
+14 w 0x10e27bc0
+15 r 0x10f21600
+0 w 0x10005100
+1 w 0x20000700
+2 r 0x10210ec0
+3 r 0x1030f380
+4 w 0x10438380
+5 w 0x20001f80
+6 r 0x10630ec0
+7 r 0x10704840
+8 w 0x20000640
+9 r 0x10936380
+10 r 0x10a36940
+11 r 0x10b18040
+12 w 0x10c11440
+13 r 0x10d05780
+14 w 0x10e13680
+15 w 0x10f0d380
+0 w 0x10026940
+1 w 0x1013be40
+2 w 0x1023d800
+3 r 0x20003fc0
+4 w 0x20000c00
+5 w 0x10527880
+6 w 0x1060e5c0
+7 r 0x107177c0
+8 r 0x10828d40
+9 w 0x10932cc0
+10 r 0x20001f00
+11 w 0x20002b40
+12 r 0x10c19b40
+13 r 0x10d2f580
+14 w 0x10e10f00
+15 r 0x10f06100
+0 r 0x1003e6c0
+1 r 0x1011d7c0
+2 r 0x1022e780
+3 r 0x10314400
+4 w 0x1042d000
+5 w 0x20002740
+6 r 0x20003b00
+7 w 0x1071e380
+8 r 0x10800840
+9 w 0x1092acc0
+10 r 0x10a38f40
+11 w 0x10b2a780
+12 w 0x20000d80
+13 w 0x10d27680
+14 r 0x10e33c80
+15 r 0x10f3c700
+0 r 0x1002ddc0
+1 r 0x10105080
+2 r 0x20001a80
+3 r 0x1032ff40
+4 w 0x20002300
+5 r 0x10537c40
+6 r 0x20000240
+7 r 0x10727bc0
+8 r 0x10827f40
+9 r 0x10906d80
+10 r 0x10a1a140
+11 r 0x10b3e240
+12 w 0x20000540
+13 r 0x10d0de00
+14 r 0x20001c00
+15 r 0x10f01980
+0 r 0x10026dc0
+1 w 0x10103c00
+2 w 0x10213d40
+3 r 0x10313840
+4 r 0x1041f540
+5 r 0x10504080
+6 r 0x10622e00
+7 r 0x10734880
+8 w 0x1081dd40
+9 w 0x109063c0
+10 r 0x10a1dfc0
+11 w 0x20003640
+12 r 0x10c13dc0
+13 w 0x10d2be40
+14 r 0x10e0c680
+15 w 0x20003ac0
+0 r 0x1003c280
+1 w 0x20002300
+2 r 0x1021bac0
+3 r 0x10325b80
+4 r 0x1043d600
+5 r 0x10518a80
+6 w 0x10631d40
+7 r 0x10703ec0
+8 w 0x10810e80
+9 w 0x109009c0
+10 r 0x10a1d580
+11 r 0x20001cc0
+12 r 0x10c3f040
+13 r 0x10d12d80
+14 r 0x20000500
+15 r 0x10f356c0
+0 w 0x1002fbc0
+1 w 0x10132fc0
+2 w 0x1022c140
+3 w 0x200009c0
+4 r 0x10400800
+5 w 0x20001bc0
+6 r 0x10626ac0
+7 r 0x1070ca00
+8 r 0x10833f00
+9 r 0x1090e4c0
+10 r 0x10a1b780
+11 r 0x10b19b40
+12 r 0x10c20c40
+13 r 0x10d07a00
+14 r 0x10e09f00
+15 r 0x10f0e900
+0 r 0x20001140
+1 r 0x10110140
+2 w 0x102242c0
+3 r 0x1032f480
+4 w 0x1043fac0
+5 r 0x1050a1c0
+6 w 0x10639c40
+7 w 0x1071e500
+8 r 0x1081c9c0
+9 w 0x1093ecc0
+10 w 0x20003240
+11 r 0x20001100
+12 r 0x10c26e00
+13 r 0x10d01c00
+14 r 0x10e05040
+15 r 0x10f24700
+0 r 0x20001d80
+1 r 0x1013fa80
+2 r 0x10204c40
+3 w 0x103010c0
+4 w 0x20002a80
+5 r 0x10513640
+6 w 0x20003080
+7 w 0x10706bc0
+8 r 0x1082bbc0
+9 r 0x109233c0
+10 r 0x10a1a2c0
+11 r 0x10b2e240
+12 r 0x10c21ec0
+13 r 0x20003940
+14 w 0x10e10f00
+15 r 0x10f372c0
+0 r 0x10039a00
+1 w 0x10126d00
+2 r 0x1023a900
+3 r 0x10311280
+4 w 0x20003240
+5 r 0x20003000
+6 w 0x20002500
+7 r 0x107152c0
+8 r 0x10803c40
+9 r 0x200028c0
+10 r 0x10a1c140
+11 r 0x20000700
+12 r 0x20002740
+13 r 0x10d24b40
+14 r 0x10e1a280
+15 r 0x10f10440
+0 r 0x100333c0
+1 r 0x10100840
+2 w 0x1022cc00
+3 w 0x10310680
+4 w 0x20003c40
+5 w 0x20000840
+6 w 0x10628840
+7 r 0x10702bc0
+8 w 0x10802d00
+9 r 0x1091c280
+10 w 0x10a3da40
+11 w 0x10b2b2c0
+12 w 0x10c10880
+13 r 0x10d25840
+14 r 0x20001e80
+15 w 0x10f29d80
+0 r 0x1001b9c0
+1 r 0x1012ee40
+2 w 0x10222180
+3 r 0x10309e40
+4 r 0x200014c0
+5 r 0x10536f80
+6 w 0x10615b80
+7 r 0x10736b40
+8 r 0x10806dc0
+9 w 0x1093fc00
+10 r 0x10a3f5c0
+11 w 0x10b2d880
+12 r 0x10c00d80
+13 w 0x10d18140
+14 r 0x10e33e40
+15 r 0x10f18500
+0 w 0x20000d40
+1 r 0x10108500
+2 w 0x20000b80
+3 r 0x1031fc00
+4 r 0x1041dc40
+5 w 0x10506280
+6 r 0x1061ed00
+7 r 0x1070dd00
+8 r 0x10802000
+9 r 0x1092c140
+10 w 0x10a18b40
+11 w 0x10b0e400
+12 w 0x10c16dc0
+13 r 0x10d26200
+14 r 0x10e3ea40
+15 w 0x10f13440
+0 r 0x1002e380
+1 w 0x1012cc40
+2 r 0x102388c0
+3 w 0x10306680
+4 r 0x20001bc0
+5 r 0x20001ec0
+6 w 0x20000100
+7 w 0x20001b80
+8 r 0x20002f00
+9 w 0x1092d800
+10 w 0x10a3e880
+11 r 0x10b20400
+12 r 0x20003500
+13 w 0x200026c0
+14 r 0x20001dc0
+15 r 0x10f1ec80
+0 w 0x10018900
+1 r 0x10102ac0
+2 r 0x1021c680
+3 r 0x103132c0
+4 w 0x1041df40
+5 w 0x20001800
+6 r 0x10631280
+7 r 0x10725880
+8 r 0x1080fa80
+9 w 0x10902a00
+10 w 0x10a03c40
+11 w 0x10b263c0
+12 w 0x10c29ec0
+13 r 0x10d08a00
+14 w 0x10e1a7c0
+15 r 0x10f33080
+0 w 0x1001bb40
+1 w 0x10118d80
+2 w 0x1021a780
+3 r 0x103284c0
+4 r 0x10401c80
+5 r 0x1050abc0
+6 r 0x20003dc0
+7 r 0x20001f40
+8 r 0x108125c0
+9 w 0x109334c0
+10 r 0x10a3b480
+11 w 0x10b125c0
+12 r 0x10c063c0
+13 r 0x10d31100
+14 r 0x10e057c0
+15 r 0x10f2fc40
+0 w 0x10018300
+1 r 0x10123e40
+2 r 0x10209a40
+3 r 0x10333b80
+4 r 0x10404dc0
+5 r 0x105132c0
+6 r 0x20002780
+7 r 0x1070a680
+8 w 0x1080cd00
+9 r 0x1090e940
+10 r 0x10a2dac0
+11 r 0x10b0c2c0
+12 r 0x10c39dc0
+13 r 0x10d03600
+14 r 0x10e21640
+15 r 0x10f31800
+0 r 0x1000f440
+1 r 0x1011df00
+2 w 0x20001080
+3 r 0x20001600
+4 r 0x104372c0
+5 r 0x10506440
+6 w 0x10638740
+7 w 0x107100c0
+8 r 0x10838940
+9 r 0x1093fd80
+10 r 0x10a30880
+11 w 0x20001e40
+12 r 0x10c0c0c0
+13 w 0x10d2d4c0
+14 w 0x10e13640
+15 w 0x20002540
+0 r 0x10023e00
+1 w 0x10124f80
+2 r 0x102027c0
+3 w 0x10322d00
+4 r 0x20003400
+5 r 0x10503440
+6 w 0x20002940
+7 r 0x1072cf80
+8 r 0x1080aa40
+9 w 0x1090ba80
+10 r 0x10a2f300
+11 r 0x10b02480
+12 r 0x10c132c0
+13 r 0x10d2a300
+14 r 0x10e0e480
+15 r 0x10f05d00
+0 r 0x10024080
+1 w 0x1011acc0
+2 r 0x20001f00
+3 r 0x20003ec0
+4 w 0x20001180
+5 r 0x1053b8c0
+6 r 0x10610900
+7 r 0x1072b380
+8 r 0x20002140
+9 w 0x10904880
+10 w 0x20000780
+11 r 0x200009c0
+12 w 0x10c10340
+13 r 0x10d0ae80
+14 r 0x20001b80
+15 r 0x200012c0
+0 r 0x10033200
+1 w 0x10107800
+2 w 0x10236ac0
+3 w 0x103027c0
+4 r 0x10433c00
+5 r 0x105171c0
+6 r 0x1060db80
+7 r 0x10712a40
+8 r 0x10823980
+9 r 0x109302c0
+10 r 0x10a10340
+11 w 0x10b0ccc0
+12 w 0x10c1d140
+13 w 0x20002fc0
+14 w 0x10e16580
+15 r 0x200034c0
+0 r 0x10015600
+1 w 0x1012e9c0
+2 w 0x1020ec80
+3 r 0x10308a00
+4 r 0x1043d4c0
+5 r 0x1050f880
+6 r 0x1062e800
+7 r 0x10703ec0
+8 r 0x10816900
+9 r 0x10931dc0
+10 r 0x10a328c0
+11 w 0x10b317c0
+12 w 0x10c30600
+13 r 0x10d318c0
+14 r 0x200015c0
+15 r 0x10f2a180
+0 w 0x20002540
+1 r 0x1010af00
+2 r 0x1022c440
+3 w 0x103288c0
+4 r 0x1041dbc0
+5 r 0x1052ba00
+6 w 0x10639a40
+7 w 0x10715c00
+8 r 0x200007c0
+9 w 0x20000600
+10 r 0x20003840
+11 w 0x10b05b00
+12 r 0x10c08ac0
+13 r 0x10d2ec80
+14 r 0x10e0ee80
+15 r 0x20001bc0
+0 w 0x100112c0
+1 w 0x20000400
+2 r 0x200008c0
+3 w 0x1030ac00
+4 r 0x20000480
+5 r 0x1050d100
+6 r 0x10619e40
+7 w 0x1071e440
+8 w 0x10807240
+9 r 0x20000340
+10 w 0x10a1a480
+11 r 0x10b04e80
+12 w 0x10c1a300
+13 r 0x10d00ac0
+14 r 0x10e37780
+15 r 0x10f3c600
+0 w 0x10011b40
+1 r 0x10131c40
+2 r 0x20001340
+3 r 0x20001880
+4 r 0x10409a40
+5 r 0x10539500
+6 r 0x20003d80
+7 r 0x10718700
+8 r 0x10815ac0
+9 r 0x1090c800
+10 r 0x10a3f640
+11 r 0x10b3aa00
+12 r 0x10c31a80
+13 r 0x10d38440
+14 r 0x20000740
+15 r 0x20002f80
+0 r 0x10011000
+1 w 0x20001240
+2 r 0x20003280
+3 r 0x10315740
+4 r 0x10405e40
+5 w 0x1051f7c0
+6 w 0x10634b00
+7 r 0x10726180
+8 w 0x200017c0
+9 w 0x1090e580
+10 r 0x20003e80
+11 w 0x20003c80
+12 r 0x10c1a140
+13 r 0x10d04a80
+14 r 0x10e33240
+15 r 0x10f32900
+0 r 0x10033600
+1 w 0x10101dc0
+2 r 0x10239100
+3 r 0x1033ff80
+4 r 0x104161c0
+5 r 0x1052ba40
+6 w 0x1062f500
+7 r 0x10733980
+8 w 0x1083ce00
+9 w 0x20002800
+10 r 0x10a05cc0
+11 r 0x10b26000
+12 r 0x20001e40
+13 w 0x10d08bc0
+14 r 0x10e28e40
+15 r 0x20003680
+0 w 0x200011c0
+1 r 0x1010f580
+2 r 0x20001bc0
+3 r 0x1033e200
+4 r 0x1041f780
+5 r 0x10534780
+6 w 0x1060c700
+7 r 0x10714440
+8 w 0x10818dc0
+9 r 0x10905880
+10 w 0x10a358c0
+11 w 0x10b14c80
+12 w 0x10c32a40
+13 r 0x10d206c0
+14 r 0x10e2d980
+15 r 0x20000480
+0 r 0x1001c680
+1 w 0x20002c80
+2 r 0x102056c0
+3 w 0x10334040
+4 r 0x10401000
+5 r 0x10504080
+6 r 0x1061c280
+7 r 0x10720e00
+8 r 0x20000380
+9 r 0x10906c00
+10 r 0x10a15fc0
+11 r 0x10b3cdc0
+12 r 0x10c1b880
+13 r 0x10d3f140
+14 w 0x20003ac0
+15 r 0x10f1bc40
+0 w 0x20001200
+1 w 0x20001980
+2 w 0x1020a800
+3 r 0x10311c80
+4 w 0x1043f980
+5 w 0x10537080
+6 r 0x20002200
+7 r 0x107314c0
+8 r 0x10812480
+9 r 0x1091b300
+10 w 0x10a24840
+11 r 0x10b3b980
+12 r 0x10c0d100
+13 r 0x10d03900
+14 r 0x10e1a9c0
+15 r 0x20003140
+0 r 0x100000c0
+1 r 0x10107640
+2 w 0x10224280
+3 r 0x200007c0
+4 r 0x1041c680
+5 w 0x20003800
+6 r 0x10636cc0
+7 r 0x1073a900
+8 r 0x20000480
+9 r 0x10920ec0
+10 w 0x10a3b0c0
+11 r 0x10b25e80
+12 r 0x10c3dd80
+13 w 0x200023c0
+14 r 0x10e25200
+15 r 0x10f2ebc0
+0 w 0x10016680
+1 r 0x10113ac0
+2 r 0x10236000
+3 r 0x1033b4c0
+4 w 0x20000600
+5 w 0x10523240
+6 w 0x1060c6c0
+7 r 0x10702940
+8 r 0x10827680
+9 w 0x1090dc40
+10 r 0x10a2b240
+11 w 0x20003240
+12 r 0x10c31c80
+13 r 0x20003a80
+14 w 0x10e2c680
+15 r 0x20002880
+0 r 0x1001fac0
+1 r 0x101000c0
+2 w 0x20001c00
+3 r 0x10320480
+4 r 0x1040a200
+5 w 0x1053ca80
+6 w 0x200011c0
+7 r 0x20003540
+8 r 0x10827b80
+9 w 0x1092f380
+10 r 0x10a12c80
+11 r 0x10b2b980
+12 r 0x10c38a80
+13 r 0x10d15dc0
+14 w 0x10e37800
+15 w 0x200033c0
+0 r 0x10026880
+1 w 0x101306c0
+2 w 0x20003600
+3 r 0x10323cc0
+4 w 0x1040a700
+5 w 0x1051d940
+6 r 0x10624d80
+7 r 0x10706280
+8 r 0x20000c80
+9 w 0x10905700
+10 r 0x10a19f80
+11 r 0x10b39980
+12 r 0x10c07740
+13 r 0x10d37080
+14 r 0x10e04340
+15 r 0x10f0d300
+0 r 0x1001a240
+1 r 0x10125c80
+2 r 0x10209b80
+3 w 0x1033eec0
+4 r 0x104253c0
+5 r 0x10513540
+6 r 0x20003540
+7 r 0x1071ab40
+8 w 0x10812bc0
+9 r 0x10924fc0
+10 w 0x10a2af40
+11 r 0x20001180
+12 r 0x10c03700
+13 r 0x10d081c0
+14 r 0x10e0a3c0
+15 w 0x10f20cc0
+0 r 0x1003e8c0
+1 r 0x10121d80
+2 r 0x10233580
+3 r 0x103392c0
+4 w 0x1043b980
+5 r 0x1050e200
+6 r 0x10626ac0
+7 r 0x10716cc0
+8 r 0x10806840
+9 w 0x20003400
+10 w 0x20003540
+11 r 0x10b30d40
+12 w 0x20003280
+13 r 0x10d2d140
+14 r 0x10e08740
+15 r 0x10f23e40
+0 r 0x20001640
+1 w 0x1011f940
+2 r 0x1023b6c0
+3 r 0x10312380
+4 w 0x20003ec0
+5 r 0x10521b80
+6 w 0x10629100
+7 w 0x10735040
+8 w 0x10839bc0
+9 w 0x10927140
+10 r 0x20002600
+11 r 0x10b1f700
+12 r 0x10c26b80
+13 r 0x10d09740
+14 w 0x10e3cf00
+15 r 0x10f056c0
+0 r 0x1000e080
+1 r 0x20001e80
+2 r 0x1021e180
+3 r 0x10324200
+4 r 0x10420180
+5 r 0x10507980
+6 w 0x20000380
+7 r 0x10737880
+8 r 0x10810840
+9 r 0x10917300
+10 r 0x10a3c700
+11 r 0x20002400
+12 w 0x10c02200
+13 w 0x10d39000
+14 r 0x10e3d100
+15 w 0x10f11640
+0 w 0x1002ec00
+1 r 0x10101840
+2 w 0x20003f40
+3 w 0x1031fb80
+4 r 0x10408f40
+5 r 0x20003d00
+6 r 0x1063f080
+7 r 0x1070b740
+8 r 0x10803140
+9 w 0x1090e840
+10 r 0x10a16780
+11 w 0x10b26f80
+12 r 0x10c34c00
+13 r 0x10d24040
+14 w 0x20001c00
+15 r 0x10f0a4c0
+0 r 0x1001d700
+1 r 0x1011d840
+2 w 0x20001680
+3 w 0x20003ac0
+4 r 0x1043a6c0
+5 r 0x10538100
+6 w 0x1063ad80
+7 r 0x10708940
+8 w 0x1081cc80
+9 r 0x10902340
+10 w 0x10a35b40
+11 r 0x10b08f00
+12 r 0x10c3c440
+13 r 0x10d16d80
+14 w 0x10e06a40
+15 r 0x10f0e100
+0 w 0x1000a1c0
+1 w 0x10122ec0
+2 r 0x102392c0
+3 r 0x1031c300
+4 r 0x10404700
+5 r 0x1050e300
+6 r 0x10636980
+7 r 0x1071f440
+8 r 0x10818840
+9 r 0x10927a40
+10 r 0x10a0e140
+11 r 0x10b33840
+12 w 0x10c2f5c0
+13 r 0x10d29c80
+14 r 0x10e21600
+15 w 0x10f28980
+0 r 0x10022b80
+1 w 0x20002440
+2 r 0x1021ecc0
+3 w 0x10328200
+4 w 0x1040d400
+5 r 0x1051de00
+6 r 0x10609a80
+7 r 0x1071fe40
+8 w 0x1080f900
+9 w 0x20002c00
+10 r 0x10a07cc0
+11 w 0x10b39700
+12 r 0x10c3d340
+13 r 0x10d26940
+14 r 0x10e0f140
+15 w 0x10f0a380
+0 r 0x1002bb40
+1 w 0x101010c0
+2 w 0x10216380
+3 r 0x1033fc00
+4 w 0x1041ecc0
+5 r 0x10530ac0
+6 r 0x1063ce00
+7 w 0x10700b00
+8 r 0x20003c40
+9 w 0x1092fc40
+10 r 0x10a22180
+11 r 0x10b34e00
+12 r 0x10c01a40
+13 r 0x10d2dc40
+14 r 0x10e01180
+15 w 0x200022c0
+0 r 0x1002de80
+1 r 0x1012bc00
+2 r 0x10203200
+3 r 0x103038c0
+4 r 0x20001940
+5 w 0x200008c0
+6 r 0x1063c740
+7 w 0x10721580
+8 w 0x1080f600
+9 r 0x1090b440
+10 r 0x10a0ed40
+11 r 0x10b0b240
+12 w 0x10c074c0
+13 w 0x10d30440
+14 w 0x10e24e40
+15 r 0x10f0dcc0
+0 r 0x1003ac00
+1 r 0x10108180
+2 w 0x10237980
+3 w 0x1031e1c0
+4 w 0x10411b80
+5 r 0x10514800
+6 w 0x1062ef00
+7 r 0x1072e140
+8 r 0x10804d40
+9 w 0x1093e700
+10 r 0x10a292c0
+11 r 0x10b2b640
+12 w 0x10c393c0
+13 r 0x10d1ba00
+14 r 0x10e10980
+15 w 0x10f00a00
+0 r 0x10034640
+1 r 0x1010a780
+2 r 0x102384c0
+3 r 0x10335cc0
+4 r 0x1040b800
+5 w 0x20003dc0
+6 w 0x20003e40
+7 r 0x1071e600
+8 w 0x10839480
+9 w 0x10915880
+10 r 0x10a03d40
+11 r 0x20003940
+12 r 0x10c1e6c0
+13 r 0x10d2c340
+14 r 0x10e36e80
+15 w 0x10f1ce40
+0 r 0x10035e80
+1 r 0x1010f980
+2 w 0x10221040
+3 w 0x10306b40
+4 w 0x1041ca80
+5 w 0x1052b2c0
+6 r 0x1061a3c0
+7 r 0x10730140
+8 w 0x200010c0
+9 r 0x10938a00
+10 r 0x10a03f40
+11 r 0x10b3e980
+12 r 0x10c294c0
+13 r 0x20002ec0
+14 r 0x10e31c80
+15 w 0x10f02640
+0 r 0x1000acc0
+1 w 0x10128600
+2 r 0x1020e9c0
+3 r 0x10331b00
+4 w 0x1043da40
+5 w 0x10514280
+6 r 0x10619b80
+7 r 0x10739480
+8 w 0x1081f0c0
+9 r 0x20000c00
+10 w 0x10a06640
+11 r 0x10b089c0
+12 w 0x20000c40
+13 r 0x10d1ef80
+14 w 0x10e2a880
+15 r 0x10f27580
+0 r 0x10033500
+1 w 0x10112080
+2 r 0x20000340
+3 r 0x1031f040
+4 r 0x10414a00
+5 r 0x1050f000
+6 r 0x10620dc0
+7 r 0x1070be80
+8 r 0x10815e80
+9 r 0x20003880
+10 w 0x10a34c00
+11 r 0x20002d40
+12 r 0x10c38300
+13 r 0x10d05540
+14 r 0x10e27c80
+15 r 0x10f17480
+0 r 0x10013440
+1 w 0x20001340
+2 w 0x20000b00
+3 r 0x10319900
+4 r 0x1042cf80
+5 w 0x1050f7c0
+6 r 0x10609d00
+7 r 0x1072f700
+8 w 0x1081f940
+9 r 0x10905c40
+10 r 0x10a3a1c0
+11 r 0x10b20ac0
+12 w 0x200023c0
+13 r 0x20002a80
+14 r 0x10e3e0c0
+15 r 0x10f3eac0
+0 r 0x1002b900
+1 r 0x20001100
+2 w 0x20000c00
+3 r 0x1033eb80
+4 r 0x200023c0
+5 r 0x105375c0
+6 r 0x10628940
+7 r 0x1072fe40
+8 r 0x108200c0
+9 w 0x1091f900
+10 r 0x200013c0
+11 r 0x20000380
+12 r 0x10c08c00
+13 r 0x10d03440
+14 w 0x10e2d440
+15 r 0x10f17380
+0 w 0x10005bc0
+1 r 0x10120e00
+2 r 0x10230b00
+3 r 0x1031c680
+4 w 0x10424440
+5 r 0x1053a500
+6 r 0x106326c0
+7 r 0x10704740
+8 r 0x1081db40
+9 r 0x10920080
+10 w 0x10a06dc0
+11 w 0x20000800
+12 w 0x10c2c640
+13 r 0x10d2dec0
+14 w 0x10e14fc0
+15 r 0x10f05340
+0 r 0x1002f700
+1 r 0x1013f4c0
+2 r 0x1023f880
+3 r 0x1032c740
+4 r 0x10420600
+5 r 0x1050a380
+6 r 0x10631780
+7 w 0x20000140
+8 r 0x10807240
+9 r 0x109146c0
+10 r 0x20003a40
+11 w 0x10b1e8c0
+12 w 0x20003bc0
+13 r 0x10d22480
+14 w 0x20003e80
+15 r 0x20002580
+0 w 0x10002680
+1 r 0x1012d580
+2 w 0x102221c0
+3 w 0x10313640
+4 r 0x20001600
+5 w 0x10538240
+6 r 0x10627140
+7 w 0x107239c0
+8 r 0x10801d80
+9 r 0x1093a840
+10 w 0x200038c0
+11 w 0x20000e80
+12 w 0x10c1eec0
+13 w 0x20002a00
+14 r 0x10e07b00
+15 r 0x10f1e980
+0 r 0x10007ec0
+1 r 0x10138980
+2 w 0x1020a940
+3 w 0x10337ec0
+4 r 0x104001c0
+5 w 0x1052b380
+6 w 0x1060acc0
+7 r 0x10724d00
+8 r 0x10818440
+9 w 0x1093c180
+10 r 0x200037c0
+11 w 0x10b1b780
+12 r 0x10c10880
+13 r 0x10d3b700
+14 r 0x20003dc0
+15 r 0x10f3b9c0
+0 r 0x10015140
+1 w 0x1010ca80
+2 w 0x1020d900
+3 r 0x10315940
+4 r 0x10429280
+5 r 0x1051fe00
+6 r 0x1063e940
+7 r 0x20000980
+8 r 0x1082d140
+9 w 0x1090bd00
+10 w 0x10a2b0c0
+11 w 0x10b3c5c0
+12 r 0x10c19c40
+13 w 0x10d12500
+14 w 0x20002fc0
+15 r 0x10f08b80
+0 w 0x20002ac0
+1 r 0x10105c00
+2 w 0x1022a980
+3 r 0x20000700
+4 r 0x20002b00
+5 r 0x1050cc00
+6 r 0x10629600
+7 w 0x1073cbc0
+8 r 0x1082fd80
+9 r 0x1092e580
+10 w 0x10a0ee80
+11 w 0x10b17180
+12 r 0x10c28bc0
+13 r 0x10d36940
+14 r 0x10e2df80
+15 r 0x10f33c80
+0 w 0x1003e440
+1 r 0x10114300
+2 w 0x10221380
+3 r 0x103305c0
+4 r 0x10427680
+5 r 0x1053a480
+6 r 0x10625cc0
+7 r 0x1071d4c0
+8 w 0x108286c0
+9 r 0x10920000
+10 w 0x10a1dbc0
+11 r 0x10b2aec0
+12 r 0x10c361c0
+13 r 0x10d2cc40
+14 w 0x10e13b00
+15 r 0x10f3dc40
+0 r 0x10011680
+1 r 0x10138cc0
+2 w 0x10230d40
+3 r 0x1032c740
+4 r 0x104128c0
+5 w 0x10517900
+6 w 0x106145c0
+7 w 0x10706d40
+8 w 0x1081fdc0
+9 r 0x20003980
+10 r 0x20001240
+11 w 0x10b1dac0
+12 r 0x10c14a80
+13 r 0x10d231c0
+14 r 0x10e02ac0
+15 r 0x10f32a40
+0 r 0x100205c0
+1 r 0x1012fb80
+2 r 0x20002bc0
+3 w 0x20002000
+4 w 0x20001080
+5 r 0x105250c0
+6 r 0x10638c00
+7 r 0x10733440
+8 r 0x1081f280
+9 w 0x10927d00
+10 r 0x10a02780
+11 r 0x10b1a000
+12 w 0x10c10840
+13 r 0x10d3fa00
+14 w 0x10e1a200
+15 r 0x10f3bbc0
+0 w 0x1003e140
+1 w 0x101129c0
+2 r 0x102169c0
+3 r 0x10318e80
+4 w 0x10434200
+5 r 0x105092c0
+6 w 0x1060e980
+7 w 0x20000580
+8 r 0x108070c0
+9 r 0x20000340
+10 w 0x10a17c00
+11 w 0x10b0cb00
+12 r 0x10c35900
+13 r 0x10d3be40
+14 w 0x10e084c0
+15 r 0x200039c0
+0 r 0x10025dc0
+1 r 0x1011e600
+2 w 0x1020fe00
+3 r 0x10318540
+4 r 0x10405400
+5 r 0x105265c0
+6 r 0x20001f80
+7 r 0x107188c0
+8 w 0x20003c00
+9 w 0x109203c0
+10 r 0x20003d00
+11 r 0x20000cc0
+12 w 0x20002480
+13 r 0x20000140
+14 r 0x10e3c500
+15 r 0x10f087c0
+0 r 0x10000400
+1 r 0x10130180
+2 w 0x10212440
+3 r 0x1031b900
+4 w 0x10422fc0
+5 r 0x10527940
+6 r 0x10628dc0
+7 r 0x1073be00
+8 r 0x10816440
+9 r 0x1093e940
+10 r 0x10a180c0
+11 w 0x10b39b80
+12 r 0x10c2b6c0
+13 r 0x10d0c040
+14 r 0x10e2d080
+15 r 0x10f04bc0
+0 r 0x1001f880
+1 w 0x10117300
+2 w 0x20001280
+3 r 0x1032b300
+4 r 0x1043c740
+5 w 0x10518140
+6 w 0x10630b80
+7 w 0x10712180
+8 r 0x1083e840
+9 w 0x10906340
+10 w 0x10a38280
+11 w 0x10b23880
+12 r 0x10c38f00
+13 r 0x10d15340
+14 r 0x20000a80
+15 r 0x10f37000
+0 r 0x100013c0
+1 w 0x101336c0
+2 r 0x10235a00
+3 r 0x103229c0
+4 r 0x1040a380
+5 r 0x10524440
+6 r 0x1061fdc0
+7 w 0x1071bf00
+8 r 0x108210c0
+9 r 0x10933900
+10 r 0x20000e80
+11 r 0x10b17700
+12 w 0x10c14d40
+13 r 0x10d03840
+14 r 0x20003d80
+15 r 0x10f1cbc0
+0 w 0x1002d040
+1 w 0x10109700
+2 w 0x1022b540
+3 w 0x10313680
+4 w 0x1041e980
+5 r 0x1050f940
+6 r 0x1060e940
+7 r 0x1073da80
+8 w 0x1081fec0
+9 w 0x20003000
+10 r 0x10a0d800
+11 r 0x10b305c0
+12 w 0x10c0f500
+13 r 0x10d19500
+14 r 0x10e2ab80
+15 w 0x10f112c0
+0 w 0x10016d80
+1 w 0x20001880
+2 r 0x1022d1c0
+3 r 0x10338e40
+4 r 0x10413e40
+5 r 0x200027c0
+6 r 0x1061f040
+7 r 0x10708640
+8 r 0x10809980
+9 w 0x10906cc0
+10 r 0x10a17500
+11 r 0x10b15a40
+12 r 0x10c1ca80
+13 r 0x10d35040
+14 r 0x10e3ffc0
+15 w 0x10f29680
+0 r 0x10032a80
+1 r 0x10130780
+2 r 0x10225e40
+3 r 0x1033cb40
+4 r 0x1041f240
+5 r 0x1052b300
+6 r 0x1062c780
+7 r 0x10717bc0
+8 r 0x10839900
+9 r 0x1093cbc0
+10 r 0x10a10d00
+11 r 0x10b02d40
+12 w 0x10c14b00
+13 w 0x10d235c0
+14 r 0x200008c0
+15 r 0x20001e80
+0 r 0x20002780
+1 r 0x1010a400
+2 r 0x1020ff40
+3 r 0x1031f2c0
+4 r 0x104195c0
+5 w 0x10504280
+6 r 0x106017c0
+7 r 0x1070b340
+8 w 0x20001100
+9 r 0x20003d40
+10 r 0x10a351c0
+11 r 0x10b1eb40
+12 r 0x10c0b700
+13 r 0x20003100
+14 r 0x10e04b40
+15 r 0x10f36240
+0 r 0x10037ac0
+1 r 0x20000440
+2 r 0x10203e00
+3 r 0x10329380
+4 r 0x1041d040
+5 w 0x20003200
+6 r 0x10606640
+7 r 0x1072e740
+8 r 0x1081bf00
+9 w 0x1090ae40
+10 r 0x10a30dc0
+11 r 0x10b2a3c0
+12 r 0x10c2e9c0
+13 w 0x200021c0
+14 r 0x10e1a100
+15 r 0x10f0cf40
+0 r 0x10009600
+1 r 0x101005c0
+2 w 0x10201ac0
+3 r 0x10301140
+4 r 0x1042c680
+5 w 0x10532540
+6 r 0x1062cb40
+7 r 0x107152c0
+8 w 0x10823f00
+9 w 0x1093b400
+10 w 0x10a03200
+11 r 0x10b1b140
+12 w 0x20002240
+13 r 0x200007c0
+14 w 0x20002340
+15 w 0x10f07800
+0 w 0x10033400
+1 w 0x10130a40
+2 r 0x1021f600
+3 r 0x10307980
+4 w 0x1043e900
+5 r 0x1051fd80
+6 w 0x10614840
+7 w 0x1070d740
+8 w 0x10819880
+9 r 0x109374c0
+10 r 0x10a35900
+11 r 0x10b39900
+12 r 0x10c1ed80
+13 r 0x20000f00
+14 r 0x10e34300
+15 w 0x10f176c0
+0 r 0x10016440
+1 r 0x1010f980
+2 r 0x1023a780
+3 w 0x1033a280
+4 r 0x10436880
+5 w 0x20000180
+6 r 0x10601800
+7 r 0x1073d680
+8 r 0x1081e9c0
+9 w 0x10908840
+10 w 0x20002bc0
+11 w 0x10b36440
+12 r 0x10c3b880
+13 r 0x10d09c00
+14 r 0x10e3e080
+15 r 0x20000300
+0 r 0x20003500
+1 r 0x10136c80
+2 w 0x10236f00
+3 r 0x1031d280
+4 w 0x104282c0
+5 w 0x20001200
+6 r 0x1062d640
+7 r 0x10708f40
+8 w 0x10834c80
+9 r 0x20000200
+10 r 0x10a2e500
+11 w 0x10b1c540
+12 r 0x10c35280
+13 w 0x20001600
+14 w 0x20001640
+15 r 0x10f33b80
+0 w 0x10021600
+1 w 0x10108e40
+2 r 0x1023f540
+3 r 0x1032fd80
+4 r 0x1042a080
+5 r 0x1051a780
+6 r 0x106346c0
+7 r 0x20002040
+8 r 0x20003c00
+9 w 0x109106c0
+10 r 0x10a1c180
+11 r 0x10b17e40
+12 r 0x20000a00
+13 r 0x10d2e840
+14 r 0x10e332c0
+15 r 0x10f1aac0
+0 w 0x10017b40
+1 r 0x1011a1c0
+2 r 0x10237540
+3 r 0x20003940
+4 w 0x1042bbc0
+5 r 0x20003f00
+6 r 0x20001300
+7 r 0x1072b900
+8 w 0x200031c0
+9 r 0x10927040
+10 w 0x20003380
+11 r 0x10b1ba40
+12 r 0x10c19f80
+13 w 0x20001240
+14 r 0x10e09900
+15 r 0x20001880
+0 r 0x1002ec00
+1 r 0x200008c0
+2 w 0x200014c0
+3 w 0x10338b00
+4 r 0x10432e40
+5 w 0x105041c0
+6 w 0x1062f140
+7 w 0x20003400
+8 w 0x10829880
+9 r 0x1091e1c0
+10 r 0x20003ac0
+11 w 0x20000d40
+12 r 0x10c00a40
+13 r 0x10d30bc0
+14 r 0x10e21800
+15 r 0x10f2a480
+0 r 0x20003040
+1 r 0x10138b40
+2 r 0x10224cc0
+3 r 0x10321880
+4 w 0x10418680
+5 r 0x10502600
+6 r 0x106394c0
+7 r 0x10738a40
+8 w 0x200012c0
+9 r 0x10930300
+10 r 0x20002880
+11 w 0x10b1cc00
+12 r 0x10c0c7c0
+13 w 0x10d3a8c0
+14 w 0x20003100
+15 r 0x20003e40
+0 r 0x1001cf40
+1 w 0x10108f80
+2 r 0x10203680
+3 r 0x1033b680
+4 r 0x10439b00
+5 w 0x10525580
+6 w 0x200018c0
+7 r 0x1072fe80
+8 w 0x1081fe80
+9 r 0x10910940
+10 r 0x10a12700
+11 r 0x10b26080
+12 w 0x10c3ae80
+13 r 0x10d09e00
+14 w 0x10e3b940
+15 w 0x20002300
+0 r 0x10003880
+1 r 0x10121f40
+2 r 0x10230ec0
+3 r 0x1033d980
+4 r 0x20002380
+5 r 0x10500c80
+6 w 0x10611540
+7 r 0x10735980
+8 r 0x1081af00
+9 r 0x10914300
+10 r 0x10a1d900
+11 r 0x10b14900
+12 r 0x10c2aa40
+13 w 0x10d03080
+14 w 0x10e3de00
+15 r 0x10f02780
+0 w 0x10027f00
+1 w 0x1011f380
+2 r 0x10236580
+3 r 0x1031ee40
+4 r 0x10428640
+5 w 0x10527800
+6 w 0x10633a00
+7 r 0x1070a8c0
+8 w 0x10835dc0
+9 r 0x109399c0
+10 r 0x20000f80
+11 r 0x10b0a500
+12 r 0x10c1b900
+13 w 0x10d28ac0
+14 r 0x10e3a940
+15 w 0x10f02440
+0 w 0x1001d700
+1 r 0x1013bd80
+2 w 0x20002640
+3 w 0x10303880
+4 r 0x10422d40
+5 w 0x20002780
+6 r 0x1061af00
+7 r 0x10734d00
+8 r 0x10827f80
+9 r 0x20003240
+10 r 0x10a29800
+11 w 0x10b1a600
+12 w 0x20001000
+13 w 0x20000000
+14 r 0x10e04480
+15 r 0x10f25900
+0 r 0x1000c040
+1 w 0x20000200
+2 r 0x10211000
+3 r 0x20002fc0
+4 r 0x1043ca80
+5 r 0x10532ec0
+6 r 0x10603980
+7 r 0x1071a080
+8 r 0x20003740
+9 w 0x109191c0
+10 r 0x10a0d380
+11 w 0x10b24e00
+12 r 0x20001dc0
+13 r 0x10d129c0
+14 r 0x20002400
+15 r 0x10f3dc80
+0 w 0x10026440
+1 r 0x10111a40
+2 r 0x10231f40
+3 r 0x103022c0
+4 r 0x1040b5c0
+5 w 0x20001ec0
+6 r 0x10623540
+7 r 0x10732cc0
+8 r 0x10812780
+9 r 0x200001c0
+10 r 0x10a37980
+11 w 0x10b00480
+12 w 0x20003a00
+13 r 0x10d10a40
+14 w 0x10e00000
+15 r 0x10f3d480
+0 r 0x10008ec0
+1 w 0x1010ab00
+2 r 0x10204740
+3 r 0x1032b3c0
+4 r 0x10408ac0
+5 r 0x10508f00
+6 r 0x10619600
+7 w 0x10731100
+8 r 0x10814ac0
+9 r 0x20002480
+10 r 0x10a16640
+11 r 0x10b1dcc0
+12 w 0x10c38100
+13 r 0x10d2e200
+14 r 0x10e3ff40
+15 r 0x10f06940
+0 r 0x20000b40
+1 w 0x10139a80
+2 r 0x10235f40
+3 r 0x10313540
+4 w 0x20000180
+5 r 0x1051b900
+6 w 0x106037c0
+7 r 0x20001f40
+8 w 0x1081aa00
+9 r 0x10917a80
+10 w 0x20001200
+11 r 0x10b05240
+12 r 0x10c269c0
+13 w 0x10d0f900
+14 r 0x10e1d080
+15 w 0x10f2fc80
+0 r 0x1000d200
+1 r 0x10122700
+2 w 0x10216f00
+3 r 0x20000a00
+4 r 0x1040d600
+5 r 0x10514c40
+6 w 0x1061f280
+7 w 0x10725480
+8 r 0x1082ae80
+9 r 0x109334c0
+10 w 0x10a353c0
+11 w 0x10b08dc0
+12 r 0x10c04e80
+13 r 0x10d21640
+14 w 0x10e345c0
+15 w 0x10f20080
+0 r 0x10037a80
+1 w 0x10104280
+2 r 0x200029c0
+3 r 0x10328740
+4 r 0x1042d840
+5 r 0x1051e800
+6 w 0x1060ff00
+7 r 0x10700e00
+8 r 0x10835e00
+9 r 0x109213c0
+10 w 0x10a17480
+11 r 0x10b21e80
+12 w 0x10c2d5c0
+13 r 0x10d0d840
+14 r 0x10e2d980
+15 r 0x10f3c800
+0 r 0x1003f9c0
+1 r 0x1013a1c0
+2 r 0x1021c300
+3 w 0x1033d6c0
+4 r 0x1040cfc0
+5 r 0x20001800
+6 r 0x20003ac0
+7 w 0x1070de80
+8 w 0x10838280
+9 w 0x20001e80
+10 r 0x10a1e240
+11 w 0x10b31c40
+12 w 0x10c1f240
+13 w 0x10d0df80
+14 r 0x200023c0
+15 r 0x10f11a40
+0 r 0x10029d40
+1 r 0x10122140
+2 w 0x1021e600
+3 w 0x1032a6c0
+4 r 0x10426ac0
+5 w 0x10521a80
+6 r 0x10634d40
+7 r 0x10739080
+8 r 0x20000140
+9 w 0x20002480
+10 r 0x10a10d00
+11 w 0x10b3b080
+12 w 0x20001d00
+13 w 0x10d28200
+14 w 0x10e23780
+15 w 0x200018c0
+0 w 0x10018440
+1 w 0x200011c0
+2 r 0x1020e280
+3 w 0x103176c0
+4 w 0x104199c0
+5 r 0x105364c0
+6 r 0x1063dcc0
+7 r 0x10717e40
+8 r 0x1082d940
+9 r 0x20001b40
+10 r 0x200016c0
+11 r 0x10b2c840
+12 r 0x10c0c080
+13 r 0x10d2aa40
+14 w 0x10e30680
+15 r 0x10f0c180
+0 r 0x10024e40
+1 r 0x10132540
+2 r 0x20002300
+3 r 0x1033aac0
+4 r 0x10413e00
+5 r 0x20002f40
+6 w 0x10632700
+7 r 0x107333c0
+8 w 0x20001140
+9 w 0x1091d2c0
+10 w 0x200010c0
+11 r 0x10b0ee00
+12 r 0x10c17100
+13 r 0x10d05780
+14 r 0x10e21a00
+15 r 0x10f20d40
+0 w 0x1001fb00
+1 r 0x1010e700
+2 r 0x20002780
+3 w 0x20001e40
+4 r 0x1043a940
+5 r 0x10518f80
+6 r 0x10638080
+7 r 0x1071c380
+8 w 0x108346c0
+9 r 0x10921d00
+10 r 0x10a2fb40
+11 w 0x10b235c0
+12 w 0x10c0fc40
+13 r 0x20000740
+14 w 0x10e3d580
+15 r 0x20002180
+0 w 0x10016440
+1 r 0x20000ec0
+2 r 0x10206380
+3 w 0x10323ec0
+4 r 0x10436d40
+5 r 0x10524b00
+6 r 0x1060e580
+7 r 0x1070e4c0
+8 w 0x20003700
+9 w 0x20003b00
+10 r 0x10a2a580
+11 w 0x20003140
+12 r 0x10c31340
+13 r 0x10d26fc0
+14 r 0x10e2b680
+15 r 0x10f2ec00
+0 r 0x20003180
+1 r 0x10102f40
+2 w 0x10239ec0
+3 r 0x10301200
+4 w 0x1043cb00
+5 r 0x1050b900
+6 r 0x20000900
+7 r 0x10713600
+8 r 0x1083dd80
+9 r 0x20002280
+10 r 0x20002dc0
+11 r 0x10b18cc0
+12 r 0x10c3e2c0
+13 r 0x10d29500
+14 r 0x10e3a300
+15 r 0x10f204c0
+0 r 0x10037d00
+1 r 0x1011eb80
+2 r 0x20003a00
+3 r 0x20002e80
+4 r 0x10426080
+5 r 0x10501680
+6 r 0x10619480
+7 r 0x10704240
+8 r 0x1081f300
+9 r 0x10901ec0
+10 r 0x10a1cbc0
+11 w 0x10b12840
+12 r 0x10c2acc0
+13 r 0x20000940
+14 r 0x10e30f80
+15 w 0x10f2dd80
+0 r 0x10016200
+1 r 0x10110d40
+2 w 0x10231100
+3 w 0x1031da00
+4 r 0x20003700
+5 r 0x200005c0
+6 r 0x106124c0
+7 w 0x1073d940
+8 w 0x10811a00
+9 w 0x10919d80
+10 r 0x200003c0
+11 r 0x10b1a180
+12 w 0x20003300
+13 r 0x10d15900
+14 w 0x10e0f540
+15 w 0x10f1b100
+0 w 0x20001c00
+1 r 0x1011fc40
+2 r 0x1021a840
+3 r 0x1032fb00
+4 r 0x1041fb00
+5 w 0x1053f300
+6 r 0x10616480
+7 w 0x20003d80
+8 w 0x10802cc0
+9 w 0x20002040
+10 r 0x10a31440
+11 r 0x20003c80
+12 r 0x10c26580
+13 r 0x10d361c0
+14 w 0x10e25640
+15 w 0x10f15500
+0 r 0x1003a900
+1 r 0x1011f240
+2 w 0x1022dc80
+3 w 0x10334d80
+4 w 0x10419580
+5 r 0x10506dc0
+6 w 0x106347c0
+7 w 0x10706e80
+8 r 0x1080de40
+9 w 0x10926000
+10 w 0x10a11ac0
+11 r 0x10b33f00
+12 w 0x10c27600
+13 r 0x10d2cd00
+14 r 0x10e30980
+15 r 0x10f39480
+0 r 0x20002a40
+1 r 0x20000500
+2 r 0x10221a80
+3 r 0x103189c0
+4 w 0x10421880
+5 r 0x10528980
+6 w 0x1062df80
+7 r 0x10701140
+8 r 0x10825740
+9 w 0x10908dc0
+10 r 0x20003a80
+11 w 0x10b10400
+12 r 0x10c2ca80
+13 r 0x10d20580
+14 r 0x20002340
+15 r 0x10f25880
+0 r 0x10028040
+1 r 0x101057c0
+2 w 0x10214940
+3 r 0x20002400
+4 r 0x10423ac0
+5 w 0x20001fc0
+6 w 0x1062c9c0
+7 r 0x10719dc0
+8 w 0x200008c0
+9 r 0x20000b40
+10 r 0x10a008c0
+11 r 0x10b2d8c0
+12 r 0x10c31500
+13 r 0x10d15380
+14 r 0x10e3c5c0
+15 r 0x10f037c0
+0 r 0x10028b00
+1 w 0x10128440
+2 r 0x10233380
+3 w 0x20002180
+4 r 0x1040f780
+5 r 0x1051eec0
+6 w 0x20003700
+7 w 0x1070d140
+8 r 0x10810e80
+9 r 0x109336c0
+10 w 0x10a00180
+11 r 0x10b3eac0
+12 w 0x20000e40
+13 w 0x10d07e40
+14 w 0x10e0ed80
+15 w 0x10f04b00
+0 w 0x1002c040
+1 r 0x20003180
+2 w 0x1022b300
+3 r 0x1030f600
+4 w 0x10429780
+5 r 0x20000200
+6 r 0x1062b200
+7 r 0x1072c380
+8 r 0x20003bc0
+9 w 0x1092dd80
+10 r 0x10a1cc80
+11 r 0x10b1a940
+12 r 0x10c01b00
+13 r 0x10d18a00
+14 r 0x10e10600
+15 r 0x10f12180
+0 w 0x10038ec0
+1 w 0x20003b00
+2 r 0x1022eb80
+3 r 0x10329380
+4 r 0x1040a540
+5 r 0x1050f780
+6 r 0x1063a880
+7 r 0x10702d00
+8 r 0x1080f180
+9 w 0x20002f80
+10 r 0x10a23440
+11 w 0x10b2a8c0
+12 r 0x10c17740
+13 r 0x10d2db40
+14 r 0x10e19980
+15 r 0x10f07200
+0 r 0x1003d640
+1 r 0x10135040
+2 r 0x1022a980
+3 w 0x20001040
+4 r 0x10416680
+5 r 0x1051a200
+6 r 0x20000dc0
+7 w 0x10711e80
+8 r 0x20000dc0
+9 r 0x1092f380
+10 r 0x10a2c040
+11 r 0x20000840
+12 w 0x10c14840
+13 w 0x10d2b900
+14 r 0x10e29c80
+15 r 0x10f24940
+0 r 0x10038ec0
+1 r 0x10116500
+2 r 0x102380c0
+3 r 0x20003940
+4 r 0x1043a9c0
+5 r 0x10520cc0
+6 w 0x20002dc0
+7 r 0x10733d40
+8 w 0x10814580
+9 r 0x20001ac0
+10 w 0x10a137c0
+11 r 0x10b34c80
+12 r 0x10c09380
+13 w 0x10d09780
+14 r 0x10e3c040
+15 w 0x10f23740
+0 w 0x20000440
+1 r 0x20000e80
+2 w 0x20000600
+3 w 0x10300b80
+4 r 0x10415800
+5 w 0x10524cc0
+6 w 0x20001cc0
+7 r 0x10713b00
+8 r 0x10816e80
+9 r 0x20002100
+10 r 0x10a25240
+11 r 0x10b25440
+12 r 0x200035c0
+13 r 0x10d0b0c0
+14 r 0x10e18c80
+15 r 0x20001940
+0 r 0x1002ebc0
+1 w 0x1012c000
+2 w 0x1021ef80
+3 w 0x20003580
+4 w 0x20002040
+5 w 0x20002640
+6 r 0x10618e00
+7 r 0x1071f880
+8 w 0x10800040
+9 r 0x10932600
+10 r 0x10a19800
+11 w 0x20001980
+12 w 0x20003780
+13 w 0x10d18340
+14 w 0x10e24600
+15 w 0x20002e40
+0 r 0x20001280
+1 r 0x10101880
+2 w 0x200010c0
+3 r 0x20003380
+4 w 0x104389c0
+5 r 0x105289c0
+6 r 0x106214c0
+7 r 0x10717000
+8 r 0x10825fc0
+9 r 0x20003780
+10 w 0x200012c0
+11 w 0x20000ac0
+12 r 0x20001040
+13 r 0x10d22900
+14 w 0x10e2df00
+15 w 0x20003080
+0 r 0x1000b480
+1 w 0x1012f880
+2 w 0x20002680
+3 r 0x1030f400
+4 w 0x20003980
+5 w 0x20000d40
+6 w 0x10606500
+7 r 0x1070bd80
+8 w 0x10806e40
+9 w 0x10902900
+10 r 0x10a2b680
+11 w 0x10b1e980
+12 r 0x10c33a80
+13 r 0x20001c80
+14 w 0x20001e40
+15 r 0x10f02300
+0 r 0x10009780
+1 w 0x101033c0
+2 w 0x10210400
+3 r 0x1032f180
+4 r 0x20003f80
+5 r 0x10527bc0
+6 w 0x200000c0
+7 r 0x1071bcc0
+8 r 0x10803200
+9 w 0x10918d40
+10 r 0x10a35140
+11 w 0x10b3d7c0
+12 r 0x20003b40
+13 w 0x10d21000
+14 w 0x10e22500
+15 r 0x10f0d540
+0 w 0x1001ed80
+1 r 0x1012d140
+2 r 0x200033c0
+3 r 0x20003fc0
+4 w 0x1043a4c0
+5 r 0x10534d00
+6 r 0x10627980
+7 w 0x10739e40
+8 r 0x10828bc0
+9 r 0x20001140
+10 r 0x10a32e40
+11 r 0x10b00100
+12 r 0x10c03e40
+13 w 0x10d21f00
+14 r 0x20001c00
+15 w 0x10f19100
+0 r 0x20003f40
+1 w 0x101171c0
+2 r 0x10218680
+3 r 0x10304300
+4 w 0x10404200
+5 r 0x105241c0
+6 r 0x1061fd00
+7 w 0x1070d540
+8 r 0x1083d040
+9 r 0x1093d7c0
+10 w 0x20000180
+11 r 0x10b2b540
+12 r 0x10c0d280
+13 r 0x10d2e900
+14 r 0x20000740
+15 r 0x10f09d00
+0 w 0x1002b000
+1 w 0x1013fd80
+2 w 0x10231c00
+3 r 0x10317ec0
+4 r 0x10417f40
+5 r 0x1050c940
+6 r 0x10623dc0
+7 w 0x1071a8c0
+8 w 0x10832680
+9 w 0x1092eb40
+10 r 0x10a16680
+11 r 0x200020c0
+12 r 0x20001a80
+13 r 0x10d0d8c0
+14 r 0x200000c0
+15 r 0x10f20480
+0 w 0x1003ab00
+1 w 0x10106d00
+2 r 0x1021d500
+3 r 0x10305d00
+4 r 0x1043bb80
+5 r 0x10506180
+6 w 0x1061d840
+7 w 0x1070d800
+8 r 0x1082adc0
+9 w 0x1091fe40
+10 r 0x10a2dd80
+11 r 0x10b05900
+12 r 0x10c19440
+13 w 0x20001600
+14 r 0x10e2f1c0
+15 r 0x10f32c40
+0 r 0x10022100
+1 r 0x10131bc0
+2 w 0x1021e680
+3 w 0x10317180
+4 w 0x10415f00
+5 r 0x1052be40
+6 r 0x1062b280
+7 w 0x10739980
+8 r 0x10829440
+9 r 0x1091c300
+10 r 0x10a16280
+11 r 0x10b1b0c0
+12 w 0x10c31680
+13 w 0x20000c00
+14 r 0x10e28d80
+15 r 0x10f16b00
+0 r 0x20003280
+1 w 0x10122b00
+2 r 0x1022a680
+3 r 0x1033ba00
+4 w 0x104013c0
+5 r 0x1050b140
+6 r 0x1060d800
+7 r 0x1073c600
+8 w 0x10806bc0
+9 r 0x10938a00
+10 r 0x10a3f840
+11 w 0x10b0f4c0
+12 r 0x10c279c0
+13 w 0x10d25780
+14 w 0x10e35140
+15 r 0x20002080
+0 r 0x20003e80
+1 r 0x10108c00
+2 r 0x102111c0
+3 r 0x1032d540
+4 w 0x1042dd80
+5 r 0x1053f900
+6 r 0x10631e40
+7 r 0x20001480
+8 w 0x10821900
+9 w 0x20002480
+10 w 0x10a25180
+11 r 0x10b3e880
+12 r 0x10c2c5c0
+13 r 0x20001800
+14 w 0x10e263c0
+15 r 0x20001d80
+0 r 0x100137c0
+1 w 0x20000b00
+2 w 0x1022d780
+3 r 0x10310480
+4 r 0x10404dc0
+5 r 0x20000840
+6 r 0x10630b00
+7 r 0x20000e80
+8 r 0x10829b40
+9 r 0x1093e780
+10 r 0x20000d40
+11 w 0x10b24100
+12 r 0x10c07280
+13 r 0x10d2da40
+14 r 0x10e07e40
+15 w 0x10f22a80
+0 w 0x10002000
+1 r 0x1010bb80
+2 r 0x10204200
+3 w 0x10301d80
+4 r 0x1041e400
+5 r 0x10522fc0
+6 r 0x200033c0
+7 r 0x107107c0
+8 r 0x108036c0
+9 w 0x20003380
+10 r 0x20002e00
+11 w 0x10b1b780
+12 w 0x20003540
+13 r 0x10d3e600
+14 r 0x10e2c800
+15 r 0x10f22340
+0 r 0x10038bc0
+1 w 0x20001b00
+2 r 0x10236f80
+3 r 0x10333500
+4 w 0x10436f80
+5 r 0x10528cc0
+6 r 0x10607980
+7 w 0x1072da40
+8 r 0x108383c0
+9 r 0x10926240
+10 r 0x10a1f5c0
+11 r 0x10b3fc00
+12 r 0x10c05680
+13 w 0x10d0dd40
+14 r 0x10e29440
+15 w 0x20000e40
+0 r 0x10018a00
+1 r 0x20003400
+2 r 0x20001480
+3 w 0x10314040
+4 r 0x1040fec0
+5 r 0x1050c5c0
+6 r 0x20002840
+7 r 0x1073ffc0
+8 r 0x1083d780
+9 w 0x1093e740
+10 w 0x10a012c0
+11 r 0x200017c0
+12 r 0x10c36c00
+13 w 0x10d39480
+14 w 0x20001c40
+15 w 0x20003f00
+0 w 0x10001f80
+1 r 0x10113340
+2 r 0x10207680
+3 w 0x10321a80
+4 r 0x1041c900
+5 r 0x10534a40
+6 r 0x10612e80
+7 w 0x10726940
+8 r 0x10824240
+9 w 0x200002c0
+10 w 0x20001cc0
+11 r 0x10b09a80
+12 r 0x10c1f3c0
+13 w 0x20001d00
+14 r 0x10e20500
+15 w 0x200039c0
+0 r 0x20001bc0
+1 r 0x1011adc0
+2 r 0x10209680
+3 r 0x1030f400
+4 r 0x1043a000
+5 w 0x20003800
+6 r 0x1061ee00
+7 r 0x10704580
+8 r 0x108120c0
+9 r 0x10911980
+10 r 0x10a1fe00
+11 r 0x10b34080
+12 w 0x10c17f00
+13 r 0x10d03280
+14 w 0x200009c0
+15 w 0x10f06bc0
+0 r 0x1002bd40
+1 w 0x10118e80
+2 w 0x20003940
+3 r 0x1030d200
+4 w 0x1043c300
+5 w 0x105072c0
+6 r 0x1061a540
+7 r 0x20003ac0
+8 w 0x10823f40
+9 w 0x10923580
+10 r 0x20001d00
+11 w 0x20002600
+12 r 0x10c1e140
+13 w 0x10d3b400
+14 r 0x10e17e40
+15 w 0x20002b80
+0 w 0x20003d80
+1 w 0x1011eb00
+2 r 0x1023a200
+3 r 0x1030d680
+4 w 0x10417940
+5 r 0x20003580
+6 r 0x106232c0
+7 r 0x107011c0
+8 r 0x1080c6c0
+9 w 0x10903dc0
+10 r 0x10a23d00
+11 r 0x10b37bc0
+12 r 0x10c1e2c0
+13 w 0x10d345c0
+14 r 0x10e07900
+15 r 0x10f3d7c0
+0 w 0x20003700
+1 r 0x10127380
+2 r 0x10231680
+3 w 0x10339f00
+4 r 0x1040a200
+5 r 0x10511940
+6 r 0x10637ac0
+7 r 0x20003ec0
+8 w 0x20001800
+9 r 0x20000e00
+10 r 0x10a1ad80
+11 r 0x10b2b740
+12 r 0x10c02380
+13 r 0x10d05b00
+14 r 0x10e3b280
+15 r 0x10f3c340
+0 r 0x100229c0
+1 r 0x10103c40
+2 r 0x10217dc0
+3 w 0x1033d500
+4 r 0x1043ca40
+5 r 0x20001cc0
+6 w 0x10603bc0
+7 r 0x1072c7c0
+8 w 0x1081bc80
+9 r 0x10914e80
+10 r 0x10a0cf00
+11 r 0x10b08580
+12 r 0x200007c0
+13 r 0x20003380
+14 r 0x10e21e40
+15 r 0x10f3f1c0
+0 r 0x1001c5c0
+1 r 0x200026c0
+2 r 0x10221a40
+3 r 0x103252c0
+4 r 0x1042ba00
+5 r 0x1050f740
+6 w 0x10600c80
+7 r 0x10709c00
+8 r 0x10837980
+9 r 0x20003c40
+10 r 0x20003cc0
+11 w 0x10b3fd40
+12 r 0x10c11b00
+13 r 0x10d15780
+14 r 0x10e32940
+15 r 0x10f34000
+0 r 0x10018d80
+1 r 0x10101c80
+2 r 0x1022b600
+3 r 0x10305a80
+4 w 0x1041fcc0
+5 w 0x1050dac0
+6 r 0x20000540
+7 r 0x20002dc0
+8 r 0x10806c00
+9 r 0x10934bc0
+10 w 0x10a3e900
+11 w 0x10b35100
+12 r 0x10c34d00
+13 r 0x20001900
+14 r 0x10e39200
+15 r 0x10f33d00
+0 r 0x20003300
+1 r 0x1013b2c0
+2 w 0x102171c0
+3 r 0x10314480
+4 r 0x1040ba40
+5 r 0x105335c0
+6 r 0x1063c600
+7 w 0x20001340
+8 r 0x20001100
+9 r 0x109115c0
+10 w 0x10a3c140
+11 r 0x10b3a080
+12 r 0x10c38140
+13 r 0x10d27640
+14 r 0x10e33300
+15 r 0x10f04840
+0 r 0x10038840
+1 w 0x1011f100
+2 r 0x1020a300
+3 w 0x103268c0
+4 w 0x10404480
+5 r 0x1052d780
+6 w 0x20003880
+7 r 0x10732340
+8 r 0x1080f480
+9 r 0x10918bc0
+10 r 0x10a28400
+11 w 0x10b33700
+12 r 0x10c21280
+13 w 0x10d29c00
+14 r 0x10e19700
+15 w 0x10f0dcc0
+0 w 0x100009c0
+1 r 0x101329c0
+2 w 0x10201480
+3 w 0x20000f80
+4 r 0x1042c100
+5 r 0x10534ec0
+6 r 0x10622440
+7 r 0x10719e00
+8 r 0x10804480
+9 w 0x1092fc40
+10 r 0x10a22940
+11 w 0x10b33d00
+12 r 0x10c03240
+13 w 0x10d06e80
+14 w 0x10e14a40
+15 r 0x10f2bb00
+0 r 0x10014ec0
+1 r 0x10111ec0
+2 r 0x10234e80
+3 r 0x20000d40
+4 r 0x1042e240
+5 w 0x20000900
+6 r 0x10628580
+7 r 0x20002bc0
+8 r 0x1082b980
+9 r 0x20000100
+10 r 0x10a13180
+11 w 0x20002380
+12 r 0x10c13e00
+13 r 0x10d1e600
+14 w 0x10e39300
+15 w 0x20002b00
+0 w 0x1001d1c0
+1 r 0x1010de40
+2 r 0x1023d580
+3 w 0x103048c0
+4 r 0x1043e980
+5 r 0x105114c0
+6 w 0x20000f00
+7 w 0x10736880
+8 w 0x200039c0
+9 r 0x1090b840
+10 w 0x10a1fc80
+11 r 0x10b39180
+12 r 0x200035c0
+13 r 0x10d3d400
+14 w 0x10e2c080
+15 w 0x20003140
+0 r 0x10019040
+1 w 0x10107a40
+2 w 0x10207000
+3 r 0x103041c0
+4 r 0x20000600
+5 r 0x10505940
+6 r 0x1060cc40
+7 r 0x1070cf40
+8 r 0x1080d7c0
+9 w 0x10918dc0
+10 r 0x10a191c0
+11 r 0x10b28040
+12 w 0x10c13d00
+13 r 0x10d08980
+14 r 0x10e04e40
+15 r 0x10f2dc00
+0 r 0x100075c0
+1 w 0x10106940
+2 r 0x10215500
+3 r 0x20002e00
+4 w 0x20003b80
+5 r 0x10521b00
+6 r 0x10635740
+7 r 0x10731e40
+8 r 0x108162c0
+9 r 0x10925e80
+10 w 0x10a3d540
+11 w 0x20002280
+12 w 0x10c21840
+13 r 0x10d1f180
+14 r 0x10e16340
+15 r 0x20001440
+0 w 0x10022a80
+1 r 0x10117040
+2 w 0x1023d080
+3 r 0x10301300
+4 r 0x10400780
+5 w 0x10535140
+6 r 0x10608800
+7 w 0x10721d40
+8 r 0x10827940
+9 r 0x1092bc00
+10 w 0x10a3e000
+11 r 0x10b21d80
+12 r 0x20002640
+13 w 0x20001400
+14 r 0x10e3ea00
+15 w 0x10f32e80
+0 r 0x20002280
+1 w 0x20002480
+2 r 0x1020b800
+3 w 0x10332300
+4 w 0x20003580
+5 r 0x10504b40
+6 r 0x10611e00
+7 w 0x10738480
+8 r 0x1080d700
+9 r 0x200014c0
+10 r 0x10a10000
+11 w 0x10b0f100
+12 r 0x10c04740
+13 w 0x20000980
+14 w 0x10e17580
+15 w 0x20002f80
+0 r 0x10036f00
+1 r 0x1013c4c0
+2 r 0x20001d80
+3 r 0x10335340
+4 w 0x10423300
+5 r 0x105115c0
+6 r 0x106071c0
+7 r 0x1072f4c0
+8 r 0x10819c40
+9 r 0x20002080
+10 r 0x10a21f80
+11 r 0x10b159c0
+12 r 0x10c35140
+13 w 0x10d19180
+14 w 0x10e23bc0
+15 r 0x10f0f980
+0 r 0x1001cf40
+1 r 0x101084c0
+2 r 0x20002680
+3 r 0x10336280
+4 r 0x1040c7c0
+5 r 0x20000300
+6 r 0x10611300
+7 r 0x10733880
+8 w 0x20002840
+9 r 0x10924e00
+10 r 0x10a0b680
+11 r 0x10b3ecc0
+12 r 0x10c376c0
+13 r 0x10d28740
+14 w 0x20001540
+15 r 0x10f17300
+0 r 0x10015680
+1 r 0x1012e5c0
+2 w 0x1021ba40
+3 w 0x103219c0
+4 r 0x1041eb00
+5 r 0x200026c0
+6 w 0x20002840
+7 r 0x10735f00
+8 r 0x1081d540
+9 r 0x10930200
+10 r 0x10a3c680
+11 w 0x20001ec0
+12 r 0x10c21900
+13 r 0x10d12840
+14 r 0x20000b80
+15 r 0x10f38e40
+0 w 0x10039300
+1 w 0x1010c540
+2 w 0x10238300
+3 r 0x200025c0
+4 w 0x1043ea40
+5 w 0x1050f140
+6 w 0x106360c0
+7 r 0x10738580
+8 r 0x10808640
+9 r 0x1090ebc0
+10 r 0x20001c00
+11 r 0x10b307c0
+12 r 0x10c26740
+13 r 0x20000cc0
+14 r 0x20003840
+15 r 0x10f35500
+0 r 0x1003d540
+1 r 0x1011b500
+2 r 0x10202700
+3 r 0x1033d400
+4 r 0x10438000
+5 w 0x20000b00
+6 r 0x10606840
+7 r 0x10707840
+8 r 0x1083a440
+9 w 0x1092f0c0
+10 r 0x10a39b80
+11 r 0x10b20840
+12 r 0x20002440
+13 w 0x20003200
+14 r 0x10e16fc0
+15 r 0x10f36e00
+0 w 0x10011880
+1 r 0x1010c200
+2 r 0x20000480
+3 w 0x200031c0
+4 r 0x10401a00
+5 r 0x10526240
+6 r 0x10608400
+7 w 0x1073dc40
+8 r 0x10834880
+9 w 0x109392c0
+10 r 0x20003200
+11 r 0x10b24240
+12 r 0x10c28880
+13 r 0x10d094c0
+14 w 0x200031c0
+15 r 0x10f2f5c0
+0 r 0x10029700
+1 r 0x10126180
+2 r 0x10209600
+3 r 0x1032bb80
+4 r 0x10405dc0
+5 r 0x1052bb40
+6 r 0x1063e040
+7 w 0x200024c0
+8 r 0x1081e180
+9 w 0x1090bb80
+10 w 0x10a29600
+11 r 0x10b2f700
+12 r 0x10c17040
+13 r 0x20001900
+14 w 0x10e305c0
+15 r 0x10f26a40
+0 r 0x200027c0
+1 r 0x20000140
+2 r 0x10211180
+3 r 0x1032bec0
+4 w 0x20000a80
+5 w 0x200017c0
+6 w 0x1062fac0
+7 r 0x10720140
+8 w 0x10829340
+9 w 0x10909f00
+10 r 0x10a25340
+11 r 0x10b04540
+12 w 0x10c077c0
+13 w 0x20003240
+14 w 0x200027c0
+15 r 0x10f25000
+0 w 0x1000c700
+1 r 0x1011a580
+2 r 0x1023b940
+3 r 0x10315c80
+4 w 0x1043fcc0
+5 r 0x10509ac0
+6 r 0x20002f00
+7 w 0x10717680
+8 w 0x20003e80
+9 w 0x200015c0
+10 r 0x10a02380
+11 w 0x20000e00
+12 r 0x10c117c0
+13 r 0x10d032c0
+14 w 0x20003680
+15 w 0x10f09940
+0 r 0x1001bd40
+1 r 0x1010c040
+2 w 0x1023ac40
+3 r 0x1030d200
+4 w 0x1043e2c0
+5 r 0x10517340
+6 w 0x106179c0
+7 r 0x10729200
+8 w 0x1082ce40
+9 w 0x20000780
+10 r 0x10a25140
+11 r 0x10b34f40
+12 w 0x200001c0
+13 r 0x10d24380
+14 r 0x10e334c0
+15 r 0x10f37d80
+0 r 0x100212c0
+1 r 0x1012fcc0
+2 r 0x1020b100
+3 r 0x1032ec00
+4 w 0x20002a40
+5 w 0x1051a9c0
+6 r 0x20000ac0
+7 w 0x10723c80
+8 r 0x1083f840
+9 r 0x1090d000
+10 w 0x10a256c0
+11 w 0x10b2d8c0
+12 r 0x20000380
+13 w 0x10d1e1c0
+14 r 0x10e2c900
+15 w 0x10f34e00
+0 w 0x1001f040
+1 r 0x10118900
+2 r 0x10206980
+3 w 0x1031a780
+4 w 0x1043b900
+5 w 0x20001e80
+6 r 0x10613700
+7 r 0x20003b40
+8 r 0x10816ac0
+9 w 0x10937440
+10 r 0x10a19d40
+11 w 0x20000100
+12 w 0x20000740
+13 w 0x20001240
+14 w 0x20000640
+15 r 0x10f0db00
+0 w 0x1002ab40
+1 r 0x20002580
+2 w 0x10210f40
+3 w 0x20003840
+4 w 0x10432800
+5 r 0x10522b40
+6 w 0x10636280
+7 r 0x107070c0
+8 r 0x1080bb80
+9 r 0x1093a080
+10 r 0x10a3fc40
+11 r 0x10b11240
+12 r 0x10c06a00
+13 r 0x10d33ec0
+14 r 0x10e3be40
+15 r 0x10f0fb00
+0 r 0x1002c280
+1 r 0x20001e00
+2 r 0x10225e40
+3 w 0x1032bd00
+4 r 0x10431c40
+5 w 0x10505480
+6 r 0x10617a00
+7 w 0x10728cc0
+8 r 0x1082b800
+9 r 0x1090f700
+10 w 0x10a34b00
+11 r 0x10b0f100
+12 r 0x20003e80
+13 r 0x10d1eb80
+14 r 0x20003e80
+15 w 0x10f04c40
+0 w 0x1003e1c0
+1 r 0x10113680
+2 w 0x10205e00
+3 w 0x103111c0
+4 r 0x10422ec0
+5 r 0x10513900
+6 r 0x10638f80
+7 r 0x1071c040
+8 r 0x1083ec40
+9 w 0x10927ec0
+10 w 0x10a07e40
+11 w 0x20000440
+12 w 0x10c0c800
+13 r 0x10d13500
+14 w 0x20001e80
+15 w 0x10f14640
+0 r 0x1000f600
+1 r 0x20003e00
+2 r 0x1022ae00
+3 w 0x20003000
+4 r 0x10436e80
+5 r 0x10510780
+6 r 0x10609f00
+7 r 0x1072e8c0
+8 r 0x10837540
+9 r 0x10904ec0
+10 r 0x10a303c0
+11 w 0x10b0db80
+12 w 0x10c16fc0
+13 r 0x10d28b80
+14 r 0x10e06c40
+15 r 0x10f23340
+0 w 0x10037180
+1 r 0x10120f00
+2 w 0x10216600
+3 r 0x103239c0
+4 r 0x10425d00
+5 r 0x10525440
+6 r 0x10618cc0
+7 r 0x10700b00
+8 w 0x20002700
+9 w 0x20003b00
+10 r 0x10a3ecc0
+11 r 0x10b23980
+12 r 0x10c14540
+13 r 0x10d0e840
+14 w 0x10e1e100
+15 r 0x20002b00
+0 r 0x100135c0
+1 r 0x20003b40
+2 r 0x10204080
+3 r 0x10314bc0
+4 r 0x20002e40
+5 r 0x1053d840
+6 r 0x20003080
+7 r 0x10717a80
+8 w 0x1082e540
+9 r 0x10917800
+10 w 0x10a0c6c0
+11 r 0x10b08100
+12 r 0x10c2b200
+13 w 0x10d30880
+14 r 0x10e19e40
+15 w 0x10f25100
+0 w 0x10033a40
+1 r 0x10110280
+2 w 0x1021cc00
+3 w 0x1031c080
+4 w 0x20000400
+5 r 0x10512140
+6 r 0x1062ee40
+7 w 0x107069c0
+8 r 0x1080ecc0
+9 r 0x109385c0
+10 w 0x10a3a140
+11 r 0x10b23680
+12 r 0x10c2b300
+13 w 0x10d036c0
+14 r 0x10e22000
+15 r 0x10f05880
+0 r 0x10033800
+1 w 0x20001580
+2 r 0x20002540
+3 r 0x1030c700
+4 r 0x10433000
+5 r 0x20002280
+6 w 0x20002b00
+7 w 0x10722040
+8 r 0x20000840
+9 w 0x1090e140
+10 r 0x10a25880
+11 w 0x10b19400
+12 w 0x10c3f100
+13 r 0x10d12a00
+14 r 0x10e09c40
+15 w 0x20000140
+0 w 0x1002fdc0
+1 r 0x10138ac0
+2 w 0x20001480
+3 w 0x10338180
+4 w 0x1043e440
+5 r 0x105393c0
+6 w 0x10610d80
+7 r 0x1072b080
+8 r 0x1081e240
+9 w 0x10907200
+10 r 0x10a03a40
+11 w 0x10b38900
+12 r 0x10c05500
+13 r 0x10d0df40
+14 r 0x10e1a200
+15 r 0x10f13780
+0 r 0x10004980
+1 r 0x10113240
+2 r 0x1021d440
+3 r 0x10324000
+4 r 0x20003340
+5 r 0x10504e80
+6 r 0x10620040
+7 r 0x10705ac0
+8 r 0x1083efc0
+9 w 0x10917800
+10 w 0x20001a40
+11 r 0x10b37f80
+12 r 0x10c1c6c0
+13 w 0x10d3e800
+14 r 0x10e09b40
+15 w 0x10f18d80
+0 r 0x10019040
+1 r 0x20003dc0
+2 w 0x1023c180
+3 r 0x10316300
+4 w 0x104024c0
+5 w 0x20000e80
+6 w 0x20003340
+7 w 0x20003340
+8 r 0x1082f3c0
+9 r 0x109217c0
+10 w 0x10a29180
+11 w 0x10b31580
+12 r 0x10c09a80
+13 w 0x10d0d500
+14 r 0x10e07d00
+15 r 0x10f19480
+0 r 0x10020840
+1 r 0x10119b00
+2 r 0x1023efc0
+3 w 0x1030be80
+4 r 0x1041edc0
+5 r 0x10528bc0
+6 r 0x20000900
+7 r 0x20001280
+8 w 0x10822400
+9 r 0x1092cec0
+10 r 0x10a37500
+11 w 0x20003700
+12 r 0x10c1fa00
+13 r 0x10d237c0
+14 r 0x10e3a940
+15 r 0x20001e00
+0 r 0x1001d100
+1 w 0x200004c0
+2 r 0x10219700
+3 r 0x10308240
+4 r 0x10403dc0
+5 w 0x20002940
+6 r 0x10604200
+7 w 0x20001680
+8 r 0x20001d80
+9 r 0x10900b80
+10 r 0x10a3c280
+11 w 0x10b06600
+12 r 0x10c24440
+13 r 0x10d32a40
+14 r 0x10e11780
+15 w 0x10f34440
+0 r 0x1000f540
+1 r 0x1010f800
+2 r 0x102279c0
+3 r 0x20002e80
+4 w 0x104396c0
+5 r 0x1050af80
+6 r 0x10610bc0
+7 r 0x20001780
+8 r 0x10834b40
+9 r 0x10908840
+10 w 0x10a32580
+11 r 0x10b24d40
+12 r 0x10c2ad80
+13 w 0x10d0f440
+14 r 0x20002b40
+15 w 0x10f27540
+0 r 0x10028500
+1 r 0x1012a980
+2 r 0x1022a500
+3 r 0x1031e380
+4 r 0x1042e100
+5 r 0x1050f8c0
+6 w 0x20002580
+7 r 0x10709900
+8 r 0x10800bc0
+9 r 0x10929140
+10 w 0x10a1cc00
+11 r 0x10b24d00
+12 r 0x10c3f580
+13 w 0x10d28240
+14 r 0x10e158c0
+15 r 0x10f3e940
+0 w 0x20002c40
+1 r 0x10139e80
+2 w 0x1021d940
+3 r 0x1032ae00
+4 r 0x10434a80
+5 w 0x1051a000
+6 r 0x1062bd40
+7 r 0x1071b8c0
+8 r 0x10823a00
+9 r 0x20000d80
+10 r 0x10a21100
+11 r 0x20000580
+12 r 0x10c0fd00
+13 r 0x10d13000
+14 r 0x10e2c080
+15 w 0x10f1b6c0
+0 w 0x10034dc0
+1 r 0x10131a40
+2 r 0x10220900
+3 w 0x20000d00
+4 r 0x1042de00
+5 r 0x105213c0
+6 r 0x1063c380
+7 w 0x10735740
+8 w 0x10834200
+9 r 0x10917700
+10 r 0x20001880
+11 w 0x10b35e80
+12 r 0x20002540
+13 r 0x10d2b1c0
+14 r 0x10e0a000
+15 r 0x10f14740
+0 w 0x20000a80
+1 r 0x20002300
+2 w 0x1022ac80
+3 r 0x20001700
+4 w 0x1043c9c0
+5 w 0x1050be40
+6 w 0x1063c880
+7 w 0x10739800
+8 r 0x108038c0
+9 w 0x10918380
+10 r 0x10a27c40
+11 w 0x10b34d40
+12 w 0x20000e40
+13 r 0x10d35880
+14 w 0x10e30d80
+15 r 0x10f1fe80
+0 w 0x20000100
+1 r 0x10109a00
+2 r 0x1021ba40
+3 w 0x20003240
+4 r 0x104378c0
+5 r 0x10516380
+6 w 0x10628440
+7 r 0x10709f40
+8 r 0x1080edc0
+9 r 0x1091c4c0
+10 r 0x10a2a540
+11 r 0x10b00d40
+12 r 0x10c37f40
+13 w 0x10d31500
+14 r 0x10e12a00
+15 r 0x10f0ca00
+0 w 0x10007300
+1 w 0x20001200
+2 r 0x102233c0
+3 w 0x1032b380
+4 r 0x10416a40
+5 r 0x10534d00
+6 w 0x1061e000
+7 r 0x10724740
+8 w 0x20003e80
+9 r 0x1091f740
+10 r 0x10a3d900
+11 w 0x10b0b580
+12 w 0x10c16940
+13 w 0x10d17c40
+14 w 0x10e2da00
+15 w 0x10f17bc0
+0 r 0x10004280
+1 w 0x10107800
+2 r 0x102089c0
+3 r 0x10314b40
+4 r 0x10420b00
+5 r 0x1050d580
+6 w 0x20003fc0
+7 w 0x10731ec0
+8 r 0x10824e40
+9 r 0x10902900
+10 w 0x20003700
+11 r 0x10b025c0
+12 r 0x10c02d00
+13 r 0x10d32400
+14 r 0x10e17180
+15 w 0x10f03f80
+0 r 0x1001e600
+1 r 0x10122240
+2 w 0x102083c0
+3 w 0x1031a340
+4 r 0x20000940
+5 w 0x10538080
+6 w 0x1063b5c0
+7 r 0x20000040
+8 w 0x20003040
+9 r 0x10916f00
+10 w 0x10a30b80
+11 r 0x10b24940
+12 r 0x10c08980
+13 r 0x10d1b880
+14 w 0x20003040
+15 r 0x10f3fcc0
+0 r 0x1003fe40
+1 r 0x20001180
+2 r 0x1021cbc0
+3 r 0x10315240
+4 r 0x1043d6c0
+5 r 0x1052a500
+6 w 0x1061a680
+7 r 0x20003f40
+8 w 0x200018c0
+9 r 0x1093cbc0
+10 w 0x10a23c00
+11 r 0x10b251c0
+12 r 0x10c35700
+13 r 0x10d14200
+14 r 0x10e3f040
+15 r 0x20002380
+0 r 0x10009200
+1 r 0x1011a240
+2 r 0x1023a0c0
+3 r 0x10336ac0
+4 r 0x1043b700
+5 w 0x20001d00
+6 r 0x1060e680
+7 w 0x20000000
+8 r 0x108215c0
+9 w 0x10916000
+10 w 0x20001d00
+11 r 0x10b191c0
+12 r 0x10c23600
+13 w 0x10d22700
+14 w 0x10e0f340
+15 r 0x10f3d680
+0 r 0x10015380
+1 r 0x10112680
+2 r 0x1020f4c0
+3 w 0x1033a000
+4 r 0x104281c0
+5 r 0x20002380
+6 w 0x1060d100
+7 r 0x1071ed00
+8 w 0x20000bc0
+9 r 0x109130c0
+10 r 0x10a3bbc0
+11 w 0x10b0d380
+12 w 0x10c1c380
+13 r 0x10d28740
+14 r 0x10e13fc0
+15 r 0x10f31e40
+0 r 0x10001340
+1 r 0x10133000
+2 r 0x10215b80
+3 r 0x1033fe80
+4 w 0x104317c0
+5 r 0x10536fc0
+6 r 0x10616540
+7 w 0x20003b40
+8 w 0x200010c0
+9 r 0x10914440
+10 r 0x10a2fd00
+11 r 0x10b183c0
+12 w 0x10c09200
+13 w 0x20003740
+14 w 0x20001b80
+15 w 0x20000a80
+0 w 0x1001b380
+1 r 0x1011f900
+2 w 0x1021a540
+3 r 0x1030eb00
+4 r 0x10409b80
+5 r 0x20003200
+6 w 0x1061d240
+7 w 0x20000200
+8 w 0x20000180
+9 r 0x10902080
+10 r 0x20001940
+11 w 0x10b2f780
+12 r 0x10c1a840
+13 w 0x10d38ac0
+14 w 0x10e33740
+15 w 0x10f0ac00
+0 r 0x10005ec0
+1 r 0x10129f80
+2 r 0x102217c0
+3 r 0x10312b40
+4 r 0x1040b540
+5 r 0x105260c0
+6 w 0x10639200
+7 r 0x20000f80
+8 w 0x10830a80
+9 w 0x1091cec0
+10 r 0x20000640
+11 w 0x10b34f00
+12 r 0x10c0d100
+13 r 0x10d30680
+14 w 0x10e33500
+15 r 0x10f1a140
+0 w 0x1003b080
+1 r 0x1013e1c0
+2 r 0x10238700
+3 r 0x1031c440
+4 r 0x10422900
+5 r 0x1053c900
+6 w 0x106202c0
+7 w 0x10714380
+8 w 0x10824300
+9 w 0x10931940
+10 r 0x10a19fc0
+11 w 0x10b0aac0
+12 w 0x20000240
+13 r 0x10d08b00
+14 w 0x10e3fac0
+15 w 0x10f1fcc0
+0 w 0x1002b100
+1 w 0x10121b00
+2 r 0x10212fc0
+3 r 0x10319040
+4 r 0x10416e00
+5 r 0x10519b40
+6 r 0x10634200
+7 w 0x107150c0
+8 w 0x1083edc0
+9 r 0x1092cfc0
+10 r 0x10a21580
+11 r 0x20002dc0
+12 r 0x10c0c900
+13 w 0x10d0dd80
+14 r 0x10e287c0
+15 r 0x10f2ca80
+0 w 0x10009200
+1 r 0x20001440
+2 r 0x1023f700
+3 w 0x103149c0
+4 r 0x104020c0
+5 r 0x20000800
+6 r 0x1061f900
+7 w 0x10710b80
+8 r 0x1082d840
+9 r 0x1091d9c0
+10 w 0x10a08dc0
+11 w 0x20003d80
+12 r 0x10c288c0
+13 r 0x10d2ca40
+14 r 0x10e05080
+15 w 0x10f23400
+0 r 0x10008640
+1 r 0x10114580
+2 w 0x1020b740
+3 r 0x1032de40
+4 r 0x1040ac00
+5 r 0x10508b00
+6 w 0x10612500
+7 w 0x1071afc0
+8 w 0x1081bec0
+9 w 0x1091c040
+10 r 0x10a1c700
+11 r 0x10b01e80
+12 r 0x10c2ef80
+13 r 0x10d06840
+14 r 0x10e3fcc0
+15 r 0x10f0acc0
+0 r 0x1001f180
+1 w 0x10108800
+2 r 0x1022a700
+3 w 0x10320200
+4 r 0x20003200
+5 r 0x10539dc0
+6 r 0x1061aac0
+7 r 0x1072aac0
+8 w 0x1081aac0
+9 w 0x20000680
+10 r 0x10a1ec80
+11 r 0x10b37640
+12 w 0x10c07340
+13 w 0x20000080
+14 r 0x10e18a40
+15 w 0x10f1db40
+0 w 0x10017680
+1 r 0x10135540
+2 r 0x10200ec0
+3 w 0x20000480
+4 r 0x20003380
+5 r 0x10518d00
+6 r 0x1062c1c0
+7 r 0x10737a40
+8 w 0x1080b940
+9 r 0x1092de80
+10 r 0x10a0de40
+11 r 0x10b3f140
+12 r 0x20003f80
+13 r 0x10d09c00
+14 w 0x20003540
+15 r 0x10f2e5c0
+0 r 0x100348c0
+1 r 0x1012e2c0
+2 w 0x10232c40
+3 r 0x10317380
+4 r 0x20003dc0
+5 r 0x10529d00
+6 w 0x1062d840
+7 r 0x10715dc0
+8 r 0x20001bc0
+9 w 0x10922cc0
+10 w 0x10a09bc0
+11 r 0x10b3cec0
+12 r 0x10c158c0
+13 r 0x10d2bf80
+14 r 0x10e1ee80
+15 r 0x10f3ce80
+0 r 0x1000df00
+1 r 0x20002c00
+2 w 0x20000e40
+3 r 0x10312cc0
+4 w 0x1041e240
+5 w 0x1050eac0
+6 w 0x20001180
+7 w 0x107336c0
+8 w 0x10814f00
+9 w 0x10908080
+10 r 0x20000f40
+11 r 0x20001cc0
+12 r 0x10c3ff40
+13 w 0x20001600
+14 r 0x10e04180
+15 r 0x10f19500
+0 r 0x1001d580
+1 w 0x10117080
+2 r 0x1022d280
+3 w 0x10328c40
+4 w 0x1042ce80
+5 r 0x1052a440
+6 r 0x10613240
+7 r 0x1073c4c0
+8 w 0x1082fbc0
+9 r 0x10902240
+10 w 0x20000640
+11 r 0x10b3d400
+12 r 0x20002cc0
+13 r 0x10d35bc0
+14 r 0x10e19940
+15 w 0x20000e40
+0 r 0x200022c0
+1 r 0x1011ed40
+2 w 0x1022d940
+3 w 0x103196c0
+4 r 0x1043cdc0
+5 w 0x105294c0
+6 r 0x1062f980
+7 r 0x20000480
+8 w 0x10830c80
+9 r 0x109351c0
+10 r 0x10a25cc0
+11 r 0x10b35280
+12 r 0x10c03540
+13 w 0x10d176c0
+14 w 0x10e13a80
+15 r 0x10f20d00
+0 r 0x100241c0
+1 r 0x1011f080
+2 r 0x10237380
+3 r 0x10334f00
+4 r 0x1040a480
+5 r 0x10504000
+6 r 0x1061a7c0
+7 w 0x20003480
+8 w 0x1081ab00
+9 w 0x10902b40
+10 w 0x10a0a780
+11 r 0x10b2b180
+12 r 0x200003c0
+13 r 0x10d39500
+14 r 0x10e23fc0
+15 w 0x10f2e080
+0 w 0x200009c0
+1 r 0x10129c40
+2 w 0x20002b80
+3 r 0x10334540
+4 r 0x10423040
+5 w 0x10513400
+6 r 0x10612540
+7 r 0x107382c0
+8 w 0x1080e200
+9 r 0x1093e9c0
+10 r 0x10a03c40
+11 r 0x10b20600
+12 r 0x10c09400
+13 r 0x200015c0
+14 w 0x10e2bc40
+15 w 0x10f3d800
+0 w 0x20001c40
+1 r 0x10110400
+2 w 0x20000c40
+3 w 0x103150c0
+4 r 0x10410680
+5 r 0x1050db80
+6 r 0x10638f40
+7 r 0x1070bf80
+8 r 0x1081ec80
+9 r 0x10939800
+10 w 0x200006c0
+11 w 0x10b29e40
+12 r 0x10c09e40
+13 w 0x10d1d140
+14 r 0x10e23880
+15 r 0x10f2ea80
+0 w 0x20000e40
+1 w 0x10114e40
+2 w 0x10215080
+3 r 0x10310800
+4 r 0x1042d5c0
+5 r 0x1053ba40
+6 w 0x20003280
+7 r 0x10712940
+8 r 0x1080d400
+9 r 0x10920400
+10 r 0x20003340
+11 w 0x10b2adc0
+12 w 0x10c29540
+13 r 0x10d29280
+14 r 0x10e21f40
+15 w 0x20003780
+0 r 0x100117c0
+1 r 0x1010bac0
+2 w 0x20000ec0
+3 w 0x1033bb80
+4 w 0x20002400
+5 r 0x105173c0
+6 r 0x20000240
+7 w 0x10718ac0
+8 r 0x108116c0
+9 r 0x10922d80
+10 r 0x200037c0
+11 r 0x10b22800
+12 r 0x10c02d40
+13 r 0x10d1b180
+14 r 0x20001dc0
+15 r 0x10f03b00
+0 r 0x100292c0
+1 r 0x10114100
+2 w 0x102236c0
+3 r 0x1030b840
+4 w 0x20001140
+5 r 0x20000bc0
+6 r 0x10600f80
+7 w 0x1073e3c0
+8 w 0x10811a80
+9 w 0x20003600
+10 r 0x10a305c0
+11 w 0x10b34dc0
+12 r 0x200005c0
+13 r 0x10d20600
+14 r 0x10e1fb80
+15 r 0x10f19480
+0 w 0x20001280
+1 r 0x101158c0
+2 r 0x102371c0
+3 r 0x10336c80
+4 r 0x20003a40
+5 r 0x10526a80
+6 r 0x10622940
+7 w 0x1071c5c0
+8 w 0x10804a80
+9 r 0x20000880
+10 w 0x10a1c7c0
+11 w 0x10b11840
+12 r 0x10c31880
+13 r 0x20002300
+14 r 0x10e062c0
+15 w 0x10f39fc0
+0 w 0x20000fc0
+1 r 0x10100540
+2 w 0x1023dec0
+3 r 0x1031d080
+4 r 0x10409c80
+5 r 0x1053c2c0
+6 r 0x10622b00
+7 w 0x200038c0
+8 r 0x10838d40
+9 w 0x10913800
+10 w 0x10a2cec0
+11 r 0x10b00500
+12 r 0x10c3d580
+13 w 0x10d04040
+14 r 0x10e2d380
+15 r 0x10f11040
+0 w 0x1001efc0
+1 r 0x200023c0
+2 w 0x10227980
+3 w 0x20000e40
+4 r 0x10407140
+5 w 0x1053df80
+6 r 0x1063fec0
+7 r 0x10707800
+8 r 0x1082a5c0
+9 r 0x1093da80
+10 r 0x20001140
+11 r 0x10b27240
+12 w 0x10c3aa80
+13 r 0x10d1c300
+14 w 0x10e3e400
+15 r 0x10f19280
+0 r 0x1001ba40
+1 r 0x10104900
+2 r 0x1023a540
+3 w 0x10313440
+4 w 0x1043dc00
+5 r 0x1051c740
+6 w 0x20001940
+7 r 0x10717a00
+8 r 0x1081e000
+9 r 0x1092f380
+10 r 0x10a338c0
+11 r 0x20000740
+12 r 0x10c20ec0
+13 r 0x10d074c0
+14 r 0x10e15f80
+15 w 0x20000d00
+0 w 0x1002d180
+1 r 0x20003880
+2 r 0x10239dc0
+3 r 0x10307d80
+4 r 0x10431f00
+5 r 0x1053ab40
+6 w 0x10605fc0
+7 r 0x107041c0
+8 r 0x1081ea40
+9 w 0x1090a3c0
+10 r 0x10a1b140
+11 r 0x10b18a80
+12 r 0x10c20600
+13 r 0x20001f00
+14 r 0x10e19900
+15 r 0x10f2c180
+0 w 0x20002b80
+1 r 0x10119f00
+2 r 0x10206200
+3 r 0x20001fc0
+4 r 0x10416200
+5 r 0x1050b280
+6 r 0x10602880
+7 w 0x10739380
+8 w 0x200029c0
+9 w 0x20002940
+10 r 0x10a11f80
+11 r 0x10b08240
+12 r 0x200009c0
+13 r 0x10d036c0
+14 w 0x200039c0
+15 w 0x10f0b3c0
+0 w 0x1002e640
+1 r 0x10109140
+2 r 0x10220d00
+3 r 0x10330e40
+4 r 0x104105c0
+5 r 0x1051c540
+6 r 0x20002700
+7 r 0x10731cc0
+8 r 0x10839cc0
+9 r 0x10910c40
+10 r 0x10a3f640
+11 r 0x10b37b40
+12 r 0x10c28680
+13 w 0x10d20f00
+14 r 0x10e06d40
+15 r 0x10f00600
+0 r 0x1001f080
+1 r 0x10137f80
+2 r 0x10224240
+3 r 0x20001b00
+4 r 0x1042c300
+5 r 0x10522200
+6 r 0x106279c0
+7 r 0x10710c40
+8 r 0x10837240
+9 r 0x10912080
+10 w 0x10a0d440
+11 w 0x10b13800
+12 w 0x10c09bc0
+13 r 0x10d23100
+14 r 0x10e1cc40
+15 r 0x10f2ec40
+0 w 0x20000240
+1 r 0x10135e40
+2 w 0x1022a180
+3 r 0x10330840
+4 r 0x10424600
+5 r 0x105338c0
+6 w 0x10622e80
+7 r 0x10727600
+8 r 0x10809740
+9 r 0x109127c0
+10 r 0x10a14ec0
+11 r 0x10b20fc0
+12 w 0x10c26580
+13 w 0x10d23c80
+14 r 0x20001080
+15 r 0x10f15200
+0 w 0x10003580
+1 r 0x20001c00
+2 w 0x20002380
+3 r 0x200035c0
+4 r 0x1042c680
+5 r 0x10529900
+6 r 0x10631480
+7 w 0x10711740
+8 r 0x10816c40
+9 w 0x20001700
+10 w 0x10a10e00
+11 r 0x10b0b080
+12 r 0x10c07200
+13 w 0x10d0fa00
+14 r 0x10e13000
+15 r 0x10f3d700
+0 r 0x1003c240
+1 r 0x1013a880
+2 w 0x20001080
+3 r 0x1032eec0
+4 w 0x20001f80
+5 r 0x10510180
+6 w 0x20003a00
+7 r 0x10713200
+8 r 0x20000640
+9 r 0x1091d100
+10 r 0x10a02700
+11 r 0x10b1be40
+12 w 0x10c27340
+13 r 0x10d33240
+14 w 0x10e23cc0
+15 r 0x10f1cc00
+0 w 0x20000200
+1 w 0x10113bc0
+2 r 0x1020f240
+3 r 0x20003f80
+4 w 0x1042d980
+5 r 0x1053ea80
+6 r 0x20001980
+7 r 0x1072d1c0
+8 r 0x10830800
+9 r 0x10915500
+10 r 0x10a0d400
+11 r 0x10b2a800
+12 r 0x10c15e80
+13 r 0x10d1a300
+14 r 0x200007c0
+15 r 0x20003900
+0 r 0x10028740
+1 r 0x1012a780
+2 w 0x20000ec0
+3 r 0x10325880
+4 w 0x10416b00
+5 r 0x1053c800
+6 r 0x1063b340
+7 r 0x10724d00
+8 r 0x20002880
+9 r 0x10921ec0
+10 r 0x10a1a200
+11 w 0x10b20b00
+12 r 0x10c35280
+13 r 0x10d02b80
+14 r 0x10e1c340
+15 r 0x200023c0
+0 w 0x1002f880
+1 w 0x20000d80
+2 w 0x20003840
+3 r 0x10326cc0
+4 w 0x10403240
+5 r 0x1051d240
+6 r 0x1063e3c0
+7 w 0x10700c00
+8 r 0x10828d80
+9 r 0x10911240
+10 r 0x10a1f380
+11 r 0x10b31f00
+12 r 0x10c2c540
+13 r 0x10d1ef40
+14 r 0x10e14540
+15 r 0x10f3ab00
+0 w 0x10017880
+1 r 0x1011ee80
+2 w 0x20000400
+3 w 0x10336e80
+4 w 0x20000580
+5 r 0x10531d80
+6 r 0x10607000
+7 r 0x1070e4c0
+8 r 0x200033c0
+9 r 0x1091f5c0
+10 r 0x10a100c0
+11 w 0x10b33a00
+12 w 0x200004c0
+13 r 0x10d18c40
+14 w 0x10e0d540
+15 w 0x10f1ba80
+0 r 0x10021600
+1 r 0x10136980
+2 r 0x20000a80
+3 r 0x10316a40
+4 r 0x1041a200
+5 r 0x10528bc0
+6 r 0x10624b40
+7 r 0x10703800
+8 r 0x1082fd00
+9 w 0x10907f40
+10 r 0x20000780
+11 w 0x20002980
+12 r 0x10c288c0
+13 r 0x10d29440
+14 r 0x10e08980
+15 w 0x10f0c700
+0 w 0x200025c0
+1 w 0x20003b80
+2 w 0x10235940
+3 w 0x10314140
+4 r 0x10408cc0
+5 w 0x10524380
+6 w 0x20001480
+7 r 0x10713f00
+8 w 0x1082c180
+9 r 0x10910900
+10 r 0x10a01980
+11 r 0x20000300
+12 r 0x10c08d40
+13 w 0x10d3fb80
+14 r 0x10e32500
+15 w 0x10f33d00
+0 r 0x10029500
+1 r 0x1011d2c0
+2 r 0x10213dc0
+3 w 0x20001180
+4 r 0x1043e300
+5 r 0x10530100
+6 r 0x10612840
+7 r 0x1073da40
+8 w 0x10839bc0
+9 r 0x10903e80
+10 w 0x10a0d240
+11 w 0x10b1f340
+12 r 0x10c18240
+13 r 0x10d2a480
+14 r 0x10e3a340
+15 r 0x20001600
+0 w 0x10023700
+1 r 0x1013b800
+2 r 0x10212600
+3 r 0x1033e500
+4 w 0x10425280
+5 w 0x1052da40
+6 r 0x1063d840
+7 w 0x20000440
+8 r 0x1083b600
+9 r 0x10917440
+10 r 0x10a18a40
+11 w 0x10b10580
+12 r 0x10c318c0
+13 r 0x10d02f40
+14 r 0x10e1a940
+15 w 0x20003f00
+0 r 0x10026340
+1 w 0x10103fc0
+2 w 0x10236800
+3 r 0x10324e00
+4 r 0x20000780
+5 r 0x10533500
+6 w 0x1060f140
+7 r 0x10708740
+8 r 0x10806d00
+9 w 0x20002680
+10 w 0x10a18fc0
+11 r 0x200012c0
+12 r 0x10c2cfc0
+13 w 0x20001e40
+14 r 0x10e06040
+15 w 0x10f10200
+0 w 0x1003ea40
+1 r 0x10132700
+2 w 0x20002580
+3 r 0x103289c0
+4 r 0x10409280
+5 r 0x10500840
+6 w 0x106065c0
+7 w 0x107172c0
+8 r 0x10839a80
+9 w 0x1092c340
+10 r 0x10a089c0
+11 r 0x20002f00
+12 r 0x10c24ac0
+13 w 0x10d25040
+14 r 0x10e2f180
+15 r 0x10f1df40
+0 w 0x20002900
+1 r 0x1013c440
+2 r 0x10222f40
+3 r 0x10316e80
+4 r 0x1041ff00
+5 r 0x200021c0
+6 w 0x10630280
+7 r 0x1073a480
+8 w 0x10802080
+9 r 0x10917040
+10 r 0x10a2ea40
+11 w 0x10b3f300
+12 r 0x10c1ca40
+13 r 0x200027c0
+14 r 0x10e06400
+15 w 0x10f3ff00
+0 r 0x10038980
+1 w 0x1010c980
+2 w 0x10206080
+3 r 0x10331800
+4 r 0x10422a80
+5 r 0x10508540
+6 w 0x20001280
+7 r 0x10738880
+8 w 0x10808480
+9 r 0x109220c0
+10 w 0x20000680
+11 r 0x10b31500
+12 r 0x10c0bcc0
+13 r 0x10d17c40
+14 r 0x10e20840
+15 r 0x10f0a600
+0 r 0x10014380
+1 w 0x1010e3c0
+2 w 0x1021ddc0
+3 r 0x10329f00
+4 r 0x104204c0
+5 w 0x10518c00
+6 r 0x106218c0
+7 w 0x10726100
+8 r 0x200034c0
+9 r 0x10910cc0
+10 r 0x10a07d40
+11 r 0x10b30700
+12 r 0x10c12740
+13 r 0x10d0d340
+14 r 0x10e30d00
+15 w 0x10f2a8c0
+0 w 0x10003400
+1 r 0x10104340
+2 r 0x10212180
+3 w 0x10325100
+4 r 0x1041af00
+5 r 0x1053da80
+6 r 0x10607c00
+7 r 0x10736fc0
+8 r 0x10804c40
+9 r 0x109320c0
+10 w 0x10a38380
+11 r 0x10b09900
+12 r 0x10c14840
+13 r 0x20003ec0
+14 r 0x20002140
+15 r 0x10f06080
+0 r 0x100129c0
+1 w 0x20000480
+2 r 0x20001980
+3 r 0x1031d500
+4 r 0x20000640
+5 r 0x10512940
+6 r 0x10634ec0
+7 r 0x10700bc0
+8 w 0x20003040
+9 r 0x1091b900
+10 r 0x10a37040
+11 w 0x20002ac0
+12 r 0x10c11a00
+13 w 0x10d19fc0
+14 r 0x10e360c0
+15 r 0x10f30780
+0 w 0x20001dc0
+1 w 0x20003780
+2 r 0x102388c0
+3 r 0x10339600
+4 r 0x10413180
+5 w 0x10517c00
+6 r 0x10627e00
+7 r 0x10731b00
+8 w 0x10808180
+9 r 0x10928c40
+10 w 0x20001640
+11 r 0x10b0eec0
+12 r 0x10c0c040
+13 r 0x20003e40
+14 w 0x20002bc0
+15 r 0x20001540
+0 r 0x1000c000
+1 r 0x1011f5c0
+2 r 0x200012c0
+3 r 0x1031efc0
+4 r 0x1040a340
+5 r 0x20001c40
+6 r 0x20003b80
+7 r 0x10707440
+8 r 0x1082cf80
+9 w 0x1090ea00
+10 r 0x10a3bd80
+11 r 0x10b14100
+12 r 0x20002580
+13 w 0x10d23c00
+14 w 0x10e1a280
+15 w 0x20001640
+0 w 0x1000f840
+1 r 0x20000e00
+2 r 0x102079c0
+3 w 0x20003300
+4 w 0x20003840
+5 r 0x1050d7c0
+6 r 0x106183c0
+7 r 0x20003000
+8 w 0x200016c0
+9 r 0x20001140
+10 w 0x20003b00
+11 w 0x20000740
+12 r 0x10c3df00
+13 r 0x20003e80
+14 r 0x10e29e00
+15 r 0x10f24fc0
+0 r 0x1001abc0
+1 r 0x101330c0
+2 r 0x1022c9c0
+3 w 0x103016c0
+4 r 0x10409140
+5 r 0x20003440
+6 r 0x20003d80
+7 r 0x1070da00
+8 r 0x10836200
+9 r 0x200009c0
+10 w 0x20002a00
+11 r 0x200007c0
+12 w 0x200018c0
+13 r 0x10d0df80
+14 w 0x20000fc0
+15 w 0x10f23300
+0 r 0x100025c0
+1 r 0x1012bac0
+2 r 0x1023a340
+3 r 0x20000a80
+4 r 0x10418c00
+5 r 0x10538640
+6 w 0x20002d80
+7 w 0x10711600
+8 w 0x10804dc0
+9 r 0x10903a40
+10 r 0x10a1a3c0
+11 r 0x10b04c40
+12 w 0x20000ac0
+13 r 0x200027c0
+14 r 0x10e191c0
+15 r 0x10f242c0
+0 r 0x1002ba80
+1 r 0x10114000
+2 w 0x10231000
+3 r 0x1030a3c0
+4 w 0x1041a080
+5 w 0x1050f540
+6 r 0x1060a0c0
+7 r 0x10706cc0
+8 w 0x20003080
+9 r 0x1091da40
+10 r 0x10a24e00
+11 r 0x10b09880
+12 r 0x10c22f00
+13 w 0x20001c40
+14 r 0x10e1bb80
+15 r 0x10f39b80
+0 r 0x10012b40
+1 w 0x10113740
+2 r 0x10219340
+3 w 0x10329840
+4 r 0x10403d40
+5 w 0x1053fe40
+6 w 0x1063ed80
+7 w 0x20003800
+8 w 0x108112c0
+9 r 0x20003940
+10 r 0x10a31c40
+11 w 0x10b19ac0
+12 w 0x20001140
+13 r 0x10d39800
+14 r 0x10e37bc0
+15 r 0x10f1ac40
+0 r 0x1000e780
+1 r 0x10109e00
+2 r 0x10233000
+3 r 0x1030f8c0
+4 r 0x10428640
+5 r 0x1053a600
+6 r 0x10622940
+7 w 0x10720980
+8 r 0x10817980
+9 w 0x10915c40
+10 r 0x10a28e00
+11 r 0x20000000
+12 r 0x10c2de40
+13 r 0x10d0ef80
+14 w 0x10e26e40
+15 r 0x10f05900
+0 w 0x10001500
+1 r 0x10130080
+2 r 0x20001300
+3 r 0x10327c00
+4 w 0x10412b00
+5 w 0x1052ec00
+6 r 0x10622540
+7 w 0x20001e40
+8 r 0x10827100
+9 r 0x10938a80
+10 r 0x10a09180
+11 r 0x20000c00
+12 r 0x10c26b00
+13 r 0x10d032c0
+14 r 0x10e14240
+15 r 0x20003cc0
+0 r 0x20002880
+1 r 0x20001500
+2 r 0x1021cb80
+3 r 0x20003540
+4 r 0x1040ef80
+5 w 0x105366c0
+6 r 0x10613b80
+7 r 0x1072be00
+8 r 0x10802e80
+9 r 0x10903680
+10 r 0x10a24300
+11 r 0x10b2e300
+12 r 0x10c274c0
+13 r 0x10d37580
+14 w 0x10e1ed40
+15 r 0x10f05080
+0 w 0x1000c280
+1 w 0x1011edc0
+2 r 0x10207c00
+3 r 0x20000300
+4 r 0x1042d6c0
+5 r 0x1053b440
+6 r 0x10638340
+7 r 0x10727200
+8 r 0x1080e9c0
+9 r 0x10920bc0
+10 r 0x10a294c0
+11 r 0x10b2a340
+12 r 0x10c15c40
+13 r 0x10d2e300
+14 w 0x10e114c0
+15 w 0x10f18f40
+0 r 0x100005c0
+1 r 0x10105580
+2 r 0x20002a40
+3 w 0x10322ac0
+4 r 0x10428f00
+5 r 0x1053e5c0
+6 w 0x10639300
+7 w 0x10701780
+8 r 0x1083b6c0
+9 w 0x1092e180
+10 r 0x10a340c0
+11 r 0x10b1c280
+12 r 0x10c14900
+13 w 0x10d279c0
+14 r 0x10e13fc0
+15 r 0x10f23bc0
+0 w 0x1001b440
+1 r 0x1013ab40
+2 r 0x10211f40
+3 r 0x10306dc0
+4 r 0x10437680
+5 r 0x1053cfc0
+6 r 0x1060e780
+7 r 0x10722e40
+8 w 0x1081e980
+9 w 0x10916500
+10 w 0x10a1bc80
+11 w 0x20002900
+12 r 0x10c0e580
+13 w 0x20000580
+14 r 0x10e177c0
+15 r 0x20003e00
+0 w 0x1003dd00
+1 r 0x10112a00
+2 r 0x10221200
+3 r 0x10333640
+4 w 0x200027c0
+5 r 0x1052b3c0
+6 r 0x10600d40
+7 r 0x10701940
+8 r 0x1083ccc0
+9 r 0x10938340
+10 r 0x10a15300
+11 r 0x10b2b680
+12 r 0x20001100
+13 w 0x10d17500
+14 w 0x10e1fd40
+15 r 0x10f28400
+0 r 0x1002f480
+1 r 0x10129400
+2 r 0x102034c0
+3 w 0x10337e80
+4 r 0x10438840
+5 w 0x10535f00
+6 w 0x20000840
+7 r 0x10727e80
+8 w 0x1082a9c0
+9 w 0x10913200
+10 r 0x10a0adc0
+11 w 0x10b0c480
+12 r 0x10c28680
+13 w 0x20003dc0
+14 w 0x10e3b7c0
+15 r 0x10f19940
+0 r 0x1001d9c0
+1 r 0x10128c00
+2 r 0x10238d00
+3 r 0x10309000
+4 w 0x104269c0
+5 r 0x10516200
+6 w 0x1063e580
+7 w 0x20002000
+8 r 0x1081de00
+9 r 0x10938b40
+10 w 0x20002840
+11 w 0x20001200
+12 r 0x10c04200
+13 r 0x10d07d80
+14 r 0x10e09200
+15 w 0x10f3a380
+0 r 0x10019bc0
+1 r 0x1013d540
+2 w 0x10206a80
+3 r 0x10335680
+4 r 0x10437500
+5 r 0x1051f3c0
+6 w 0x10603100
+7 r 0x20003480
+8 r 0x20003c40
+9 w 0x10928a80
+10 r 0x10a0ac00
+11 w 0x10b1d0c0
+12 r 0x20002940
+13 r 0x10d14ec0
+14 r 0x10e23d00
+15 r 0x10f3d380
+0 w 0x10030ac0
+1 r 0x1011fe00
+2 r 0x1020cb80
+3 w 0x1031a740
+4 w 0x1041b800
+5 r 0x20000e80
+6 r 0x10633840
+7 r 0x10738dc0
+8 r 0x10825d40
+9 w 0x10901f40
+10 w 0x10a15640
+11 r 0x10b21b40
+12 w 0x10c36000
+13 w 0x20000380
+14 r 0x10e3eb80
+15 w 0x10f07140
+0 r 0x1000ed80
+1 r 0x1013fac0
+2 r 0x1021f3c0
+3 r 0x10331fc0
+4 r 0x10405640
+5 r 0x20000700
+6 r 0x10606e40
+7 r 0x1073ed80
+8 w 0x10806c00
+9 w 0x10911a40
+10 w 0x20003740
+11 r 0x10b1ba80
+12 w 0x10c10640
+13 w 0x20001580
+14 w 0x10e39ac0
+15 r 0x10f0aac0
+0 w 0x1001b300
+1 w 0x20000e40
+2 r 0x10216600
+3 r 0x20002040
+4 r 0x1043f5c0
+5 r 0x1052fe80
+6 r 0x10609b40
+7 r 0x1072c080
+8 r 0x10802a80
+9 w 0x109299c0
+10 r 0x10a11100
+11 r 0x20001fc0
+12 r 0x10c0fe80
+13 r 0x10d180c0
+14 w 0x20003340
+15 w 0x20001540
+0 w 0x10017300
+1 w 0x20000b80
+2 r 0x102295c0
+3 w 0x10333a00
+4 r 0x1042d640
+5 r 0x1052f140
+6 r 0x10631080
+7 w 0x20000d80
+8 r 0x10808cc0
+9 r 0x10918380
+10 w 0x20003e80
+11 w 0x10b29d40
+12 r 0x20002b00
+13 r 0x20002800
+14 r 0x10e31780
+15 r 0x10f2ce40
+0 w 0x1003d000
+1 w 0x1011dc40
+2 w 0x10232280
+3 r 0x10305d40
+4 r 0x10430dc0
+5 r 0x1051cbc0
+6 w 0x20002480
+7 r 0x10737a80
+8 r 0x10819340
+9 w 0x10918d80
+10 r 0x10a03b40
+11 r 0x10b1dc00
+12 r 0x10c3ec80
+13 w 0x10d1f8c0
+14 r 0x10e38080
+15 r 0x20001840
+0 r 0x1002b2c0
+1 r 0x10120480
+2 r 0x10239240
+3 r 0x10328f40
+4 r 0x1042ca00
+5 r 0x1051a240
+6 r 0x10630200
+7 r 0x200028c0
+8 r 0x1081d840
+9 r 0x10906680
+10 r 0x10a22240
+11 w 0x10b2d0c0
+12 r 0x10c17480
+13 r 0x10d12ac0
+14 w 0x10e11580
+15 r 0x10f1d9c0
+0 r 0x1001e0c0
+1 r 0x10105a00
+2 r 0x10230f80
+3 r 0x1032a800
+4 w 0x10407040
+5 w 0x20001980
+6 r 0x1060ac00
+7 r 0x10703cc0
+8 r 0x108117c0
+9 r 0x1090aa80
+10 r 0x20003980
+11 r 0x10b1a640
+12 r 0x10c20fc0
+13 r 0x10d3f300
+14 r 0x10e11640
+15 w 0x10f3ee40
+0 r 0x100269c0
+1 r 0x10125cc0
+2 r 0x10239e40
+3 w 0x10302980
+4 r 0x1040bfc0
+5 w 0x20001540
+6 w 0x20000b40
+7 r 0x10736b00
+8 r 0x1083eac0
+9 r 0x1091bdc0
+10 w 0x10a07700
+11 w 0x20000b40
+12 r 0x10c00700
+13 w 0x10d14180
+14 r 0x10e234c0
+15 r 0x10f338c0
+0 r 0x1000b980
+1 r 0x10122cc0
+2 w 0x10204340
+3 w 0x10320140
+4 r 0x104373c0
+5 r 0x10506a80
+6 r 0x106185c0
+7 r 0x1070d080
+8 r 0x10833d40
+9 r 0x10909980
+10 w 0x10a0fd40
+11 r 0x10b3bc40
+12 w 0x20001500
+13 w 0x20001700
+14 w 0x20001140
+15 w 0x10f04fc0
+0 r 0x1002a7c0
+1 r 0x101339c0
+2 r 0x10200b40
+3 r 0x10315dc0
+4 w 0x10403400
+5 r 0x1050f940
+6 r 0x20002e80
+7 r 0x1072a4c0
+8 w 0x200036c0
+9 w 0x20001ec0
+10 r 0x10a14740
+11 r 0x20000400
+12 w 0x20002a40
+13 r 0x10d094c0
+14 r 0x10e01a80
+15 r 0x200011c0
+0 w 0x20001d40
+1 r 0x10101b80
+2 w 0x20003840
+3 w 0x20000240
+4 r 0x10409600
+5 w 0x20003e80
+6 w 0x10619700
+7 r 0x1071f6c0
+8 w 0x1083fc00
+9 r 0x20001900
+10 r 0x10a3c080
+11 r 0x20002d80
+12 r 0x20003b00
+13 r 0x10d14dc0
+14 r 0x10e06380
+15 r 0x10f152c0
+0 r 0x1003c980
+1 w 0x20000e00
+2 w 0x200006c0
+3 w 0x20001100
+4 r 0x1040a1c0
+5 r 0x1050fd40
+6 r 0x10608f00
+7 r 0x10733580
+8 r 0x10835740
+9 r 0x1091fd00
+10 r 0x10a32180
+11 w 0x10b31d80
+12 w 0x10c34d80
+13 r 0x10d1e840
+14 w 0x20001e40
+15 r 0x10f221c0
+0 r 0x10027b00
+1 r 0x1013e840
+2 r 0x1020b500
+3 w 0x10324d40
+4 r 0x1040e180
+5 r 0x10536940
+6 r 0x106101c0
+7 r 0x1070bb00
+8 r 0x10814780
+9 r 0x20002900
+10 r 0x10a23080
+11 w 0x10b033c0
+12 r 0x10c28e80
+13 r 0x20003000
+14 r 0x20002840
+15 w 0x10f2d400
+0 w 0x10036d80
+1 r 0x1012ed40
+2 r 0x10225b80
+3 r 0x20000580
+4 r 0x1043c700
+5 w 0x10521cc0
+6 r 0x1061d0c0
+7 w 0x10708940
+8 w 0x20001a40
+9 r 0x10922c80
+10 w 0x200010c0
+11 w 0x20000580
+12 r 0x20001240
+13 r 0x10d38a80
+14 w 0x10e0ce80
+15 w 0x20003380
+0 r 0x10037640
+1 r 0x200030c0
+2 r 0x1022a280
+3 r 0x10315c00
+4 r 0x1040cac0
+5 r 0x1052cf00
+6 w 0x10635800
+7 w 0x1071f1c0
+8 r 0x10822e80
+9 w 0x20000840
+10 r 0x10a32900
+11 r 0x10b0b340
+12 r 0x20001fc0
+13 r 0x10d0a940
+14 w 0x10e19200
+15 r 0x10f1bf40
+0 r 0x100163c0
+1 w 0x1011dc80
+2 w 0x102351c0
+3 r 0x1031e740
+4 r 0x1041a8c0
+5 r 0x10537700
+6 r 0x1062f700
+7 w 0x1070b080
+8 r 0x1081bf00
+9 r 0x10933d00
+10 r 0x10a0d980
+11 r 0x10b311c0
+12 r 0x20002a00
+13 r 0x10d3b6c0
+14 r 0x10e10f00
+15 r 0x10f0a000
+0 r 0x1002cc80
+1 r 0x1012a900
+2 r 0x20002140
+3 r 0x20002f00
+4 r 0x104181c0
+5 r 0x10504a40
+6 r 0x1062eb00
+7 r 0x10713740
+8 r 0x1082f600
+9 w 0x20000340
+10 r 0x10a0ae80
+11 w 0x10b047c0
+12 w 0x10c13f80
+13 r 0x10d37580
+14 r 0x10e3b000
+15 w 0x200031c0
+0 w 0x20001d40
+1 w 0x10127640
+2 w 0x102306c0
+3 w 0x1033e280
+4 w 0x20001e80
+5 r 0x1052fe00
+6 r 0x10606480
+7 r 0x20002240
+8 r 0x20003340
+9 r 0x10932500
+10 w 0x10a0ac40
+11 w 0x20001400
+12 w 0x20003940
+13 w 0x20000d80
+14 w 0x10e22940
+15 r 0x10f39740
+0 w 0x20002ac0
+1 w 0x10133f40
+2 r 0x10237600
+3 w 0x10320980
+4 r 0x1043a600
+5 r 0x10526b40
+6 r 0x1063aac0
+7 r 0x1071e980
+8 r 0x1083bd80
+9 w 0x10907080
+10 r 0x10a10740
+11 w 0x20003040
+12 r 0x10c036c0
+13 r 0x10d0b300
+14 w 0x20001200
+15 r 0x10f208c0
+0 r 0x10004a80
+1 r 0x10137e80
+2 r 0x20000f00
+3 r 0x1031e1c0
+4 r 0x104233c0
+5 r 0x1051fd00
+6 w 0x20002e80
+7 r 0x20003c80
+8 r 0x10804140
+9 r 0x109376c0
+10 w 0x10a15900
+11 w 0x10b0f080
+12 r 0x10c1d680
+13 r 0x20002d40
+14 w 0x10e33dc0
+15 w 0x20001900
+0 w 0x20001200
+1 r 0x10130380
+2 r 0x1022a5c0
+3 r 0x10307540
+4 r 0x10437300
+5 r 0x1053c300
+6 r 0x10603c40
+7 r 0x1073c740
+8 r 0x1081b980
+9 w 0x10929ac0
+10 w 0x10a25200
+11 r 0x10b07c00
+12 r 0x10c04140
+13 r 0x10d20ec0
+14 w 0x20002a80
+15 r 0x10f07e40
+0 w 0x20001e80
+1 r 0x10121ec0
+2 r 0x102112c0
+3 w 0x10327d00
+4 r 0x20002fc0
+5 w 0x10515d80
+6 r 0x10613040
+7 r 0x10716640
+8 w 0x108091c0
+9 r 0x20003140
+10 r 0x20003c80
+11 r 0x10b15bc0
+12 r 0x10c149c0
+13 r 0x10d130c0
+14 r 0x10e1c7c0
+15 w 0x200029c0
+0 r 0x20003cc0
+1 r 0x1012eb80
+2 w 0x20000bc0
+3 r 0x10331a00
+4 r 0x1040d200
+5 w 0x10524b80
+6 r 0x20002580
+7 w 0x20001bc0
+8 r 0x10822d00
+9 r 0x10924bc0
+10 r 0x10a1c2c0
+11 w 0x10b30940
+12 w 0x20002f80
+13 r 0x10d22b80
+14 w 0x20002340
+15 r 0x10f28340
+0 r 0x1002b800
+1 w 0x1013e700
+2 r 0x1023cac0
+3 r 0x20001b40
+4 r 0x10416e00
+5 w 0x20003d80
+6 w 0x20000e40
+7 r 0x1073d2c0
+8 w 0x10835b40
+9 w 0x10923f00
+10 w 0x200027c0
+11 r 0x10b1e340
+12 r 0x10c07cc0
+13 w 0x10d33280
+14 r 0x10e07180
+15 w 0x10f26180
+0 w 0x100135c0
+1 r 0x10136380
+2 r 0x1022e600
+3 w 0x10312440
+4 r 0x10401c80
+5 r 0x20001240
+6 r 0x1060ef40
+7 r 0x10701540
+8 r 0x108294c0
+9 r 0x20002380
+10 r 0x10a0eec0
+11 r 0x10b3ba00
+12 r 0x10c2a100
+13 r 0x10d31040
+14 r 0x10e14b00
+15 r 0x10f13080
+0 r 0x1002da80
+1 r 0x20003000
+2 r 0x1022d300
+3 r 0x1030b500
+4 w 0x104276c0
+5 r 0x10513f40
+6 r 0x10608680
+7 r 0x10700640
+8 r 0x1082a840
+9 r 0x1093f880
+10 w 0x20003940
+11 w 0x10b3e5c0
+12 r 0x10c297c0
+13 w 0x10d34b00
+14 r 0x20000e00
+15 r 0x10f33180
+0 r 0x100007c0
+1 r 0x101200c0
+2 r 0x200031c0
+3 r 0x1031d340
+4 r 0x1041d180
+5 w 0x10515d00
+6 w 0x10634880
+7 r 0x1073bcc0
+8 r 0x1080b980
+9 r 0x1092f980
+10 r 0x20001800
+11 r 0x10b1bf80
+12 r 0x10c2dc80
+13 w 0x20001840
+14 r 0x20001380
+15 r 0x10f20240
+0 r 0x20001500
+1 r 0x10103840
+2 r 0x102038c0
+3 r 0x10304040
+4 w 0x10400e00
+5 r 0x10530780
+6 r 0x1060d4c0
+7 r 0x1073bd00
+8 r 0x108034c0
+9 w 0x10909c40
+10 r 0x10a1cb80
+11 w 0x10b266c0
+12 r 0x10c3a980
+13 r 0x20001a40
+14 w 0x10e1bf40
+15 r 0x10f0d6c0
+0 w 0x1003a6c0
+1 r 0x10107640
+2 w 0x200026c0
+3 r 0x10314700
+4 r 0x1040a480
+5 w 0x105058c0
+6 r 0x10624800
+7 r 0x10717640
+8 w 0x20001840
+9 r 0x1090e8c0
+10 r 0x200004c0
+11 w 0x10b20280
+12 r 0x200005c0
+13 r 0x10d30bc0
+14 w 0x10e002c0
+15 w 0x10f312c0
+0 r 0x10037c80
+1 w 0x101116c0
+2 w 0x20002700
+3 r 0x1031c500
+4 r 0x10429380
+5 r 0x20002d00
+6 w 0x10609200
+7 r 0x1071b3c0
+8 w 0x1081c840
+9 r 0x10908880
+10 w 0x20000a40
+11 r 0x10b1a2c0
+12 w 0x20000ac0
+13 r 0x10d0b800
+14 r 0x10e23f80
+15 r 0x10f04500
+0 r 0x100135c0
+1 r 0x1010a7c0
+2 r 0x10219d40
+3 r 0x1032c300
+4 w 0x1041ec00
+5 r 0x1053cec0
+6 r 0x106017c0
+7 r 0x10701440
+8 w 0x1081b200
+9 r 0x1092d800
+10 r 0x10a2ac80
+11 w 0x10b07d00
+12 r 0x10c130c0
+13 r 0x10d02240
+14 r 0x10e05840
+15 r 0x10f22c80
+0 r 0x1000b340
+1 r 0x10136180
+2 r 0x10209b40
+3 w 0x10314680
+4 r 0x10428640
+5 r 0x1051aac0
+6 r 0x10602280
+7 r 0x10705200
+8 r 0x1081b880
+9 r 0x1091bf80
+10 r 0x20003940
+11 r 0x10b1e900
+12 w 0x20000740
+13 w 0x10d12c40
+14 r 0x10e3e180
+15 r 0x10f112c0
+0 w 0x10003bc0
+1 r 0x20000bc0
+2 r 0x20003300
+3 r 0x1031af80
+4 r 0x200032c0
+5 r 0x1052f200
+6 r 0x1061e500
+7 w 0x20001b40
+8 r 0x108307c0
+9 r 0x10906600
+10 r 0x200026c0
+11 r 0x20003080
+12 r 0x10c3f900
+13 r 0x10d1ef40
+14 r 0x20001780
+15 r 0x10f07600
+0 r 0x10015180
+1 w 0x10132140
+2 w 0x10209f40
+3 r 0x103229c0
+4 r 0x10414f00
+5 w 0x105211c0
+6 w 0x106336c0
+7 r 0x1070de80
+8 w 0x20003c40
+9 r 0x109107c0
+10 r 0x10a31c00
+11 r 0x20001f40
+12 r 0x10c06b80
+13 w 0x20001340
+14 r 0x10e2ba00
+15 w 0x20002f40
+0 r 0x1000a280
+1 r 0x1010da00
+2 r 0x20001cc0
+3 w 0x20001e40
+4 r 0x104006c0
+5 r 0x10500a00
+6 w 0x1061ec00
+7 w 0x107034c0
+8 r 0x10813100
+9 w 0x10911c00
+10 r 0x10a1d680
+11 r 0x10b15d40
+12 r 0x10c38080
+13 r 0x10d19040
+14 r 0x10e1ff00
+15 w 0x10f213c0
+0 r 0x10019600
+1 r 0x1010ce00
+2 r 0x10223b00
+3 w 0x10300040
+4 r 0x20002380
+5 r 0x1053dd40
+6 w 0x20003a80
+7 w 0x20001840
+8 r 0x10835880
+9 r 0x10937f80
+10 r 0x20003a80
+11 r 0x10b36180
+12 r 0x20001740
+13 r 0x10d02e00
+14 r 0x10e26980
+15 r 0x10f134c0
+0 r 0x10029a40
+1 w 0x1012d280
+2 r 0x10213e00
+3 r 0x1032ee40
+4 r 0x1043ce00
+5 w 0x1053e980
+6 r 0x1061cec0
+7 r 0x1072d7c0
+8 r 0x10818280
+9 r 0x10906b40
+10 r 0x10a30100
+11 r 0x20001640
+12 r 0x10c14580
+13 r 0x20002740
+14 w 0x10e3b6c0
+15 w 0x10f3b1c0
+0 r 0x100177c0
+1 w 0x10109440
+2 r 0x10208880
+3 r 0x1033ed00
+4 r 0x1042b980
+5 w 0x20003ec0
+6 w 0x20003780
+7 r 0x20000080
+8 r 0x10826180
+9 w 0x1093fdc0
+10 w 0x10a2c9c0
+11 w 0x10b38d80
+12 w 0x10c02380
+13 r 0x10d1b5c0
+14 w 0x10e2b3c0
+15 w 0x10f0bac0
+0 r 0x1000f000
+1 r 0x10135e80
+2 w 0x1020bec0
+3 r 0x1032e100
+4 r 0x10427400
+5 r 0x10509a80
+6 r 0x10620fc0
+7 w 0x20002980
+8 w 0x10836540
+9 r 0x1092aec0
+10 r 0x10a12380
+11 r 0x10b31f80
+12 r 0x10c3c040
+13 r 0x10d06600
+14 r 0x20001440
+15 r 0x10f0c540
+0 r 0x10028700
+1 r 0x1010cd40
+2 r 0x1022b780
+3 r 0x10336980
+4 r 0x20000a80
+5 r 0x200002c0
+6 r 0x1062afc0
+7 r 0x1071e0c0
+8 w 0x1080f1c0
+9 r 0x1091b740
+10 r 0x10a04980
+11 r 0x10b31c40
+12 w 0x10c32cc0
+13 w 0x20003980
+14 w 0x200017c0
+15 r 0x10f1ef40
+0 r 0x10007280
+1 r 0x20003640
+2 w 0x10239340
+3 r 0x1032fa00
+4 r 0x1043e7c0
+5 r 0x10524ec0
+6 r 0x10606f00
+7 r 0x10727180
+8 w 0x20003640
+9 w 0x1091b7c0
+10 w 0x10a2ebc0
+11 w 0x200014c0
+12 w 0x10c1cbc0
+13 w 0x10d16b80
+14 r 0x10e3d280
+15 w 0x10f0cdc0
+0 r 0x10039940
+1 r 0x20002b40
+2 w 0x20001380
+3 r 0x10326140
+4 r 0x20001700
+5 w 0x10525180
+6 w 0x10626280
+7 r 0x10725c40
+8 r 0x10823b00
+9 r 0x10901500
+10 r 0x200022c0
+11 r 0x200000c0
+12 w 0x10c263c0
+13 r 0x10d2e080
+14 r 0x10e348c0
+15 r 0x10f16a40
+0 r 0x1002c3c0
+1 r 0x200007c0
+2 r 0x10233d00
+3 w 0x1031c940
+4 w 0x10414a80
+5 w 0x1052b540
+6 w 0x10601300
+7 r 0x1072e680
+8 w 0x10831a40
+9 w 0x10938140
+10 w 0x10a20580
+11 r 0x10b3f700
+12 r 0x10c003c0
+13 w 0x10d15dc0
+14 w 0x10e042c0
+15 r 0x20001680
+0 w 0x1003ef00
+1 r 0x1011bb40
+2 r 0x10211b80
+3 r 0x200012c0
+4 r 0x10436b80
+5 w 0x10533a00
+6 w 0x20003600
+7 r 0x1071a580
+8 r 0x10817c40
+9 w 0x109124c0
+10 w 0x20002440
+11 r 0x10b16ec0
+12 w 0x10c2f6c0
+13 w 0x10d07440
+14 w 0x10e38700
+15 w 0x10f0dd80
+0 w 0x10037200
+1 r 0x200031c0
+2 r 0x1022aec0
+3 r 0x103032c0
+4 w 0x10419540
+5 r 0x10525600
+6 w 0x10625680
+7 r 0x1070da40
+8 r 0x10815b00
+9 r 0x1092a3c0
+10 r 0x10a0ddc0
+11 r 0x10b27380
+12 r 0x20002b40
+13 r 0x10d3a340
+14 w 0x200031c0
+15 w 0x20001e40
+0 r 0x1001f180
+1 w 0x1013ba80
+2 r 0x200013c0
+3 w 0x20001400
+4 w 0x10436780
+5 r 0x10519340
+6 r 0x10633c80
+7 r 0x10727400
+8 r 0x10839d80
+9 w 0x1090ba80
+10 r 0x10a351c0
+11 r 0x10b29cc0
+12 r 0x10c23100
+13 r 0x10d20b00
+14 w 0x10e0ec80
+15 w 0x10f0a2c0
+0 r 0x20001080
+1 r 0x10132200
+2 w 0x20002cc0
+3 r 0x1030d5c0
+4 r 0x20003f40
+5 r 0x10522240
+6 w 0x20002940
+7 r 0x10719200
+8 w 0x20001a00
+9 r 0x10908800
+10 r 0x10a14400
+11 r 0x10b147c0
+12 w 0x20000fc0
+13 r 0x10d25640
+14 r 0x10e22640
+15 r 0x10f39900
+0 w 0x20002f80
+1 w 0x1012c4c0
+2 r 0x102302c0
+3 r 0x1033fac0
+4 w 0x20001640
+5 w 0x10508680
+6 w 0x200024c0
+7 w 0x1070de80
+8 r 0x20002cc0
+9 w 0x20003e00
+10 r 0x10a3a340
+11 r 0x10b09f00
+12 w 0x10c1a680
+13 w 0x20003d40
+14 w 0x10e1c740
+15 w 0x10f2d280
+0 w 0x20003b40
+1 r 0x10125d00
+2 r 0x20001380
+3 r 0x10321980
+4 r 0x1042bb00
+5 w 0x20001840
+6 w 0x106200c0
+7 r 0x10737840
+8 r 0x10834e80
+9 r 0x10900200
+10 r 0x10a19bc0
+11 r 0x10b20d00
+12 w 0x10c1a3c0
+13 w 0x20001d80
+14 r 0x10e12940
+15 w 0x10f3f9c0
+0 r 0x10025900
+1 r 0x10129080
+2 r 0x1021cf00
+3 r 0x10316ac0
+4 r 0x1040b340
+5 r 0x10536280
+6 r 0x106136c0
+7 w 0x1071ce40
+8 r 0x10802580
+9 w 0x1090d380
+10 r 0x10a1bf40
+11 r 0x10b36740
+12 r 0x10c13f00
+13 r 0x10d39280
+14 r 0x10e1a480
+15 r 0x10f3b7c0
+0 r 0x1003bf40
+1 w 0x1011ed80
+2 r 0x10203b00
+3 w 0x1032e880
+4 r 0x10407a40
+5 r 0x10509f00
+6 w 0x20003400
+7 r 0x10701500
+8 w 0x1080d180
+9 r 0x10922240
+10 r 0x10a1e100
+11 r 0x10b38580
+12 r 0x10c07d80
+13 r 0x10d29f00
+14 r 0x10e37040
+15 r 0x20002e00
+0 r 0x1000f000
+1 w 0x20003600
+2 w 0x102116c0
+3 r 0x10308d80
+4 w 0x1043c180
+5 r 0x1053a480
+6 r 0x1062e5c0
+7 r 0x1073c5c0
+8 w 0x10837a00
+9 r 0x10930200
+10 r 0x10a33ec0
+11 w 0x20003780
+12 w 0x10c25a80
+13 r 0x10d09380
+14 w 0x10e1a040
+15 r 0x10f3b400
+0 r 0x1003b600
+1 r 0x10130680
+2 r 0x200009c0
+3 w 0x1031f8c0
+4 w 0x10420500
+5 r 0x1050e740
+6 r 0x106284c0
+7 r 0x10705440
+8 r 0x1081f400
+9 r 0x10922580
+10 w 0x20003400
+11 r 0x10b30880
+12 r 0x10c11a40
+13 r 0x10d3aac0
+14 r 0x10e34900
+15 w 0x10f3ddc0
+0 w 0x1003c800
+1 r 0x10132580
+2 r 0x1021e900
+3 w 0x103162c0
+4 w 0x20001740
+5 w 0x10507880
+6 w 0x10638e00
+7 r 0x1072a700
+8 w 0x10804280
+9 r 0x10911140
+10 r 0x10a1cd40
+11 r 0x10b30940
+12 w 0x10c262c0
+13 r 0x10d3e1c0
+14 r 0x10e2e900
+15 r 0x10f0abc0
+0 r 0x100139c0
+1 w 0x10100540
+2 w 0x20003c80
+3 r 0x20001180
+4 r 0x20002e40
+5 w 0x10527440
+6 r 0x10627b40
+7 w 0x10723440
+8 w 0x1082e0c0
+9 r 0x109190c0
+10 r 0x10a09600
+11 r 0x10b393c0
+12 w 0x10c25480
+13 r 0x10d01400
+14 w 0x10e12740
+15 r 0x20003bc0
+0 w 0x10015400
+1 w 0x10132180
+2 r 0x10204e80
+3 w 0x10313f00
+4 r 0x20002a00
+5 r 0x10507080
+6 w 0x10625c00
+7 r 0x20002780
+8 r 0x1083c340
+9 w 0x10916fc0
+10 r 0x20003bc0
+11 r 0x10b35100
+12 r 0x10c25e00
+13 r 0x10d2cd80
+14 w 0x10e27740
+15 w 0x10f0ea00
+0 r 0x1002ca80
+1 w 0x1010e240
+2 r 0x1022a6c0
+3 w 0x1032b940
+4 w 0x104371c0
+5 r 0x10538180
+6 w 0x1061a2c0
+7 r 0x1070c4c0
+8 w 0x20002ac0
+9 w 0x10911f40
+10 w 0x10a07e00
+11 r 0x10b1bc00
+12 r 0x10c28180
+13 w 0x10d129c0
+14 r 0x10e21680
+15 r 0x10f059c0
+0 r 0x100225c0
+1 w 0x20000f40
+2 r 0x10208c40
+3 r 0x20003240
+4 r 0x1040a680
+5 w 0x10539000
+6 w 0x1063e300
+7 w 0x1070a940
+8 w 0x1083a0c0
+9 w 0x10910980
+10 r 0x10a23b80
+11 r 0x10b13c80
+12 w 0x10c2c880
+13 r 0x10d33d40
+14 r 0x10e21280
+15 w 0x10f1c000
+0 r 0x100343c0
+1 w 0x1011cdc0
+2 r 0x102071c0
+3 r 0x1033ee00
+4 r 0x20003b80
+5 r 0x1052ba40
+6 w 0x1063c3c0
+7 w 0x20001940
+8 r 0x1083fe00
+9 r 0x10931000
+10 w 0x20002940
+11 w 0x20000500
+12 r 0x10c2d340
+13 r 0x20000600
+14 r 0x10e11e80
+15 w 0x10f0c1c0
+0 w 0x10026840
+1 r 0x10127c00
+2 w 0x1023f280
+3 r 0x1031b580
+4 w 0x10436ac0
+5 r 0x20000dc0
+6 r 0x200021c0
+7 r 0x10723400
+8 w 0x200005c0
+9 r 0x10929780
+10 r 0x10a25540
+11 r 0x10b03880
+12 w 0x10c22d80
+13 w 0x10d06b40
+14 w 0x10e1bf80
+15 r 0x10f20c40
+0 r 0x10033780
+1 r 0x10131a80
+2 r 0x10237a40
+3 w 0x10319cc0
+4 w 0x104282c0
+5 w 0x10530240
+6 r 0x1060e040
+7 w 0x20003d40
+8 r 0x10810f40
+9 w 0x10902400
+10 r 0x10a3ddc0
+11 w 0x10b318c0
+12 w 0x20003240
+13 w 0x10d20640
+14 r 0x20000680
+15 r 0x10f34280
+0 r 0x1003a880
+1 r 0x20003300
+2 r 0x20003ac0
+3 r 0x1033a800
+4 r 0x1043ff40
+5 r 0x10525180
+6 r 0x10612540
+7 w 0x10730340
+8 r 0x20003a00
+9 w 0x1090dd40
+10 r 0x20003680
+11 r 0x10b10a40
+12 r 0x10c00f40
+13 r 0x10d1c700
+14 r 0x10e34280
+15 r 0x10f2cb00
+0 r 0x1001b080
+1 r 0x1011bb00
+2 w 0x10229900
+3 w 0x200006c0
+4 w 0x104301c0
+5 r 0x105000c0
+6 r 0x10629740
+7 r 0x10713740
+8 w 0x20003cc0
+9 w 0x1091ca00
+10 r 0x10a3aa00
+11 r 0x10b3b6c0
+12 w 0x10c3d3c0
+13 r 0x10d3cb00
+14 w 0x20002240
+15 r 0x10f36c80
+0 r 0x1003c240
+1 r 0x10126840
+2 r 0x10230f00
+3 r 0x200002c0
+4 w 0x104012c0
+5 w 0x20002000
+6 r 0x20000900
+7 w 0x20003e00
+8 r 0x108006c0
+9 w 0x10929a00
+10 w 0x20002200
+11 w 0x10b24f00
+12 r 0x10c221c0
+13 r 0x10d0c6c0
+14 r 0x10e35b80
+15 r 0x10f37dc0
+0 r 0x10014380
+1 r 0x10107880
+2 w 0x20002000
+3 w 0x10311f80
+4 r 0x104369c0
+5 r 0x1051ac00
+6 r 0x20000c40
+7 r 0x10721040
+8 r 0x10809980
+9 r 0x1093e500
+10 r 0x10a39dc0
+11 r 0x200002c0
+12 w 0x10c2fc00
+13 r 0x10d3bdc0
+14 r 0x10e0ef80
+15 w 0x200007c0
+0 w 0x1003c8c0
+1 r 0x1013d8c0
+2 r 0x10218880
+3 w 0x10327480
+4 r 0x10434c40
+5 w 0x10533c80
+6 w 0x10612600
+7 w 0x10718080
+8 r 0x10820880
+9 r 0x10936580
+10 r 0x10a1e840
+11 r 0x10b0ca40
+12 r 0x10c25a80
+13 w 0x10d202c0
+14 w 0x10e0c280
+15 r 0x10f3e900
+0 r 0x20001b00
+1 r 0x1010d4c0
+2 r 0x1021b440
+3 r 0x1030a2c0
+4 r 0x104297c0
+5 r 0x1052c580
+6 w 0x20002fc0
+7 r 0x20000d40
+8 w 0x10801e80
+9 w 0x20002100
+10 r 0x10a32140
+11 r 0x10b04340
+12 r 0x10c20dc0
+13 r 0x10d27200
+14 r 0x10e0ee40
+15 r 0x10f2ad80
+0 r 0x10032000
+1 w 0x1013a0c0
+2 r 0x10224a80
+3 r 0x10336c00
+4 w 0x10438300
+5 w 0x20000080
+6 r 0x10629f80
+7 w 0x10712a80
+8 w 0x1082b200
+9 w 0x1092f840
+10 w 0x10a04dc0
+11 w 0x10b19a80
+12 r 0x10c081c0
+13 w 0x10d23400
+14 r 0x20000b00
+15 w 0x10f11640
+0 w 0x1000b400
+1 w 0x10139dc0
+2 r 0x102349c0
+3 w 0x10308b00
+4 r 0x20002b40
+5 r 0x10528980
+6 r 0x1060f200
+7 w 0x1070d880
+8 w 0x1083e200
+9 r 0x10901a80
+10 r 0x10a2f600
+11 r 0x10b35080
+12 r 0x10c22b80
+13 r 0x10d13700
+14 w 0x20002780
+15 r 0x10f26600
+0 w 0x20001a40
+1 r 0x1012c940
+2 r 0x10223000
+3 w 0x1032f680
+4 r 0x1043bf80
+5 w 0x10534c40
+6 r 0x200028c0
+7 r 0x10704c40
+8 w 0x1080bf80
+9 r 0x20002300
+10 w 0x10a1d880
+11 r 0x10b362c0
+12 w 0x10c37b80
+13 w 0x10d00d40
+14 w 0x10e15640
+15 w 0x10f17740
+0 w 0x10001280
+1 w 0x10123640
+2 w 0x10217f80
+3 r 0x1031a7c0
+4 r 0x10434000
+5 w 0x20003ac0
+6 w 0x10630b80
+7 r 0x10738780
+8 r 0x1082f100
+9 r 0x10933700
+10 r 0x10a19c40
+11 w 0x10b3ce00
+12 r 0x10c0fc80
+13 w 0x10d397c0
+14 r 0x200034c0
+15 w 0x10f37a80
+0 r 0x1001b440
+1 r 0x10102b00
+2 w 0x200033c0
+3 r 0x20002cc0
+4 r 0x10439000
+5 r 0x105051c0
+6 r 0x10629980
+7 w 0x20000bc0
+8 r 0x1080ed80
+9 w 0x10905240
+10 r 0x10a0ec00
+11 r 0x10b0b200
+12 w 0x10c11100
+13 r 0x10d2b500
+14 r 0x10e1c2c0
+15 r 0x10f36ec0
+0 r 0x10038f40
+1 w 0x20001940
+2 r 0x10220600
+3 w 0x10318a40
+4 r 0x10405940
+5 r 0x10528440
+6 r 0x10636180
+7 w 0x20000700
+8 r 0x1081c240
+9 w 0x109111c0
+10 w 0x10a144c0
+11 r 0x20000900
+12 w 0x20003680
+13 r 0x10d08b40
+14 w 0x200036c0
+15 w 0x10f2dc00
+0 r 0x1000e780
+1 r 0x1011bd40
+2 r 0x20002f00
+3 r 0x20000c80
+4 r 0x10422500
+5 r 0x10536540
+6 r 0x10609080
+7 w 0x10720200
+8 r 0x10830800
+9 w 0x1090ce40
+10 r 0x10a06500
+11 w 0x200035c0
+12 w 0x10c1c080
+13 w 0x20002fc0
+14 r 0x10e25440
+15 w 0x10f12b40
+0 w 0x10036b80
+1 r 0x10109d40
+2 r 0x1020e180
+3 w 0x200028c0
+4 w 0x20002980
+5 r 0x1052bd40
+6 r 0x1062c080
+7 r 0x1072ae80
+8 r 0x10824800
+9 w 0x1091fc40
+10 r 0x10a30340
+11 r 0x10b05740
+12 r 0x10c325c0
+13 r 0x10d2c980
+14 w 0x10e16340
+15 w 0x10f1f2c0
+0 r 0x1003e140
+1 w 0x20000780
+2 r 0x10234a80
+3 r 0x1031a880
+4 r 0x10408300
+5 w 0x105133c0
+6 w 0x20001c80
+7 w 0x20001d40
+8 r 0x10806000
+9 w 0x20003380
+10 w 0x10a29cc0
+11 r 0x10b3a680
+12 w 0x10c16a00
+13 r 0x200005c0
+14 w 0x10e30cc0
+15 w 0x10f16840
+0 w 0x10020180
+1 w 0x1011b2c0
+2 r 0x10214b00
+3 r 0x10313b80
+4 w 0x1042c240
+5 r 0x10539a00
+6 r 0x10627600
+7 r 0x200021c0
+8 r 0x10838440
+9 r 0x1092b2c0
+10 r 0x20003440
+11 r 0x20003280
+12 r 0x10c28880
+13 w 0x20002e40
+14 r 0x10e01600
+15 w 0x20001540
+0 r 0x10012580
+1 r 0x101357c0
+2 w 0x20001800
+3 w 0x103167c0
+4 r 0x1040a340
+5 r 0x10514100
+6 w 0x20000480
+7 w 0x200012c0
+8 r 0x10829b00
+9 r 0x10908440
+10 r 0x10a3e040
+11 w 0x10b1a2c0
+12 r 0x10c272c0
+13 r 0x10d10000
+14 r 0x10e06440
+15 r 0x10f1f580
+0 r 0x10036cc0
+1 r 0x10131040
+2 r 0x1023da80
+3 r 0x10310e40
+4 r 0x20000e40
+5 w 0x10532940
+6 r 0x10603d40
+7 r 0x10719b40
+8 w 0x20003dc0
+9 r 0x10903c80
+10 w 0x10a16c00
+11 r 0x10b3cd00
+12 w 0x20002480
+13 r 0x10d0a5c0
+14 w 0x20003000
+15 r 0x10f37fc0
+0 r 0x10004f80
+1 r 0x1012f480
+2 r 0x20001100
+3 r 0x10336140
+4 r 0x10425880
+5 w 0x20001700
+6 r 0x10610700
+7 r 0x1070bf80
+8 w 0x10834480
+9 r 0x1091a2c0
+10 w 0x10a31fc0
+11 w 0x10b3cf00
+12 w 0x10c1cc40
+13 w 0x10d16980
+14 w 0x10e2fd00
+15 w 0x10f28a40
+0 r 0x10001a80
+1 w 0x10100a40
+2 r 0x10228e80
+3 r 0x1032d380
+4 w 0x200036c0
+5 w 0x10514900
+6 r 0x1062f580
+7 r 0x10726880
+8 w 0x10833c00
+9 w 0x1092c7c0
+10 r 0x10a15d00
+11 w 0x10b39f40
+12 w 0x10c04b00
+13 r 0x10d1c4c0
+14 r 0x10e01500
+15 w 0x10f2edc0
+0 w 0x1003b3c0
+1 r 0x10132600
+2 w 0x10219dc0
+3 w 0x10326380
+4 w 0x10421c00
+5 r 0x1051c1c0
+6 r 0x200019c0
+7 r 0x1073a740
+8 r 0x1083b080
+9 r 0x10939c80
+10 r 0x20003380
+11 r 0x10b014c0
+12 r 0x20000480
+13 r 0x10d20f00
+14 w 0x10e25fc0
+15 r 0x10f004c0
+0 r 0x10010280
+1 r 0x20001ac0
+2 r 0x1022eb40
+3 r 0x10322180
+4 r 0x10428fc0
+5 r 0x1051dc00
+6 r 0x20000d00
+7 r 0x10706b80
+8 r 0x10836300
+9 w 0x10925480
+10 w 0x20001000
+11 r 0x200023c0
+12 r 0x10c07100
+13 r 0x20003780
+14 r 0x10e154c0
+15 r 0x10f20c80
+0 r 0x10034ac0
+1 r 0x10115040
+2 w 0x1022e040
+3 r 0x1031f4c0
+4 r 0x1041ed80
+5 r 0x10502340
+6 w 0x106176c0
+7 r 0x107065c0
+8 w 0x1083f8c0
+9 w 0x10907480
+10 r 0x10a149c0
+11 r 0x10b22980
+12 r 0x10c2c640
+13 r 0x10d1f400
+14 r 0x10e1bd40
+15 r 0x10f2e640
+0 r 0x20002b40
+1 r 0x20001440
+2 w 0x102114c0
+3 r 0x1031c280
+4 r 0x10435280
+5 r 0x20002dc0
+6 r 0x20001240
+7 w 0x10706740
+8 r 0x10822f00
+9 r 0x10907f00
+10 r 0x20002a80
+11 r 0x10b11580
+12 r 0x10c34c80
+13 r 0x10d324c0
+14 r 0x10e39f80
+15 r 0x10f0f780
+0 r 0x20000800
+1 r 0x101118c0
+2 w 0x20000280
+3 r 0x20003840
+4 r 0x1040e380
+5 r 0x20001480
+6 r 0x1062b2c0
+7 r 0x10706900
+8 r 0x10801100
+9 r 0x10934f00
+10 w 0x20003940
+11 r 0x10b34480
+12 r 0x10c38bc0
+13 r 0x10d0e440
+14 r 0x10e0a500
+15 w 0x10f05e80
+0 w 0x10027f80
+1 w 0x20000400
+2 r 0x1022f440
+3 w 0x10321d00
+4 r 0x10403340
+5 w 0x20000a80
+6 r 0x1063c7c0
+7 r 0x10721980
+8 r 0x1081c080
+9 w 0x10938540
+10 r 0x10a00b40
+11 r 0x10b2be00
+12 r 0x20000640
+13 r 0x10d0b4c0
+14 r 0x10e340c0
+15 r 0x10f14440
+0 r 0x100255c0
+1 w 0x20003440
+2 r 0x10234ac0
+3 w 0x20001200
+4 r 0x10425d80
+5 r 0x1052d7c0
+6 r 0x1063f600
+7 w 0x20000880
+8 r 0x1080e640
+9 r 0x20000a40
+10 w 0x20002e40
+11 r 0x10b24800
+12 w 0x10c38940
+13 r 0x10d11300
+14 r 0x10e39840
+15 r 0x10f37d00
+0 r 0x1000b640
+1 r 0x101285c0
+2 w 0x20001140
+3 r 0x10337e40
+4 r 0x1041d080
+5 r 0x10538c00
+6 r 0x1060b0c0
+7 w 0x20000700
+8 r 0x1083dd80
+9 w 0x20000500
+10 r 0x10a30f00
+11 r 0x10b30dc0
+12 r 0x10c27540
+13 r 0x20003100
+14 r 0x10e3a500
+15 r 0x10f37480
+0 r 0x20003400
+1 w 0x200010c0
+2 r 0x1021c100
+3 w 0x20001dc0
+4 r 0x1043f2c0
+5 w 0x20003f40
+6 r 0x20003380
+7 r 0x20002a80
+8 r 0x10815b00
+9 r 0x10932580
+10 r 0x10a398c0
+11 r 0x200035c0
+12 r 0x10c2f040
+13 r 0x10d2af80
+14 w 0x10e07700
+15 w 0x10f2e000
+0 w 0x10011480
+1 w 0x10100940
+2 r 0x1023e8c0
+3 r 0x1032dd80
+4 w 0x1042bb80
+5 w 0x1053e6c0
+6 r 0x1060bc00
+7 r 0x10711f00
+8 r 0x10832b00
+9 r 0x20003740
+10 r 0x10a2fc00
+11 r 0x10b18700
+12 w 0x20001f00
+13 r 0x10d0efc0
+14 r 0x10e22880
+15 r 0x10f16d00
+0 r 0x200002c0
+1 w 0x1010a780
+2 r 0x1021ddc0
+3 r 0x10327900
+4 r 0x1042eb40
+5 w 0x20001500
+6 r 0x20001500
+7 r 0x20002340
+8 w 0x20001b40
+9 w 0x109010c0
+10 w 0x20002080
+11 w 0x10b27f00
+12 r 0x10c099c0
+13 r 0x10d26740
+14 r 0x10e03580
+15 r 0x10f07680
+0 r 0x1002cd80
+1 w 0x1011bd80
+2 r 0x1021f680
+3 r 0x10336640
+4 r 0x104341c0
+5 w 0x10510180
+6 w 0x1061bc40
+7 r 0x107223c0
+8 r 0x10832300
+9 w 0x10916d80
+10 w 0x20000800
+11 r 0x10b2bac0
+12 w 0x10c1ae40
+13 r 0x10d00d00
+14 r 0x10e1e880
+15 r 0x20002b00
+0 r 0x100045c0
+1 r 0x1012fa80
+2 r 0x1022bc80
+3 r 0x1033c900
+4 r 0x10425cc0
+5 r 0x20000040
+6 r 0x10639880
+7 w 0x20002400
+8 r 0x10823640
+9 r 0x10932d80
+10 r 0x200027c0
+11 w 0x200007c0
+12 w 0x10c2c480
+13 r 0x10d22a40
+14 r 0x10e3b2c0
+15 r 0x10f0da00
+0 w 0x10016a40
+1 r 0x1011ad00
+2 r 0x10204fc0
+3 w 0x10300a80
+4 w 0x10415080
+5 r 0x10517200
+6 w 0x10631780
+7 w 0x20002300
+8 r 0x1082fdc0
+9 r 0x20000900
+10 w 0x200004c0
+11 w 0x10b3ab80
+12 w 0x10c0a2c0
+13 r 0x10d33bc0
+14 r 0x20003800
+15 r 0x10f0a840
+0 w 0x1001ec40
+1 r 0x10111e80
+2 r 0x200006c0
+3 r 0x1032f9c0
+4 w 0x1041dc40
+5 r 0x20002540
+6 r 0x10606a80
+7 r 0x10728f00
+8 r 0x20000f40
+9 r 0x10918800
+10 r 0x10a1a780
+11 r 0x10b24e40
+12 w 0x20001d80
+13 r 0x200017c0
+14 w 0x10e3f980
+15 w 0x10f07480
+0 r 0x10036a40
+1 w 0x10103a00
+2 r 0x1022f8c0
+3 w 0x1030b400
+4 w 0x1041b4c0
+5 r 0x105032c0
+6 w 0x1060bb80
+7 r 0x10723cc0
+8 w 0x10803200
+9 r 0x10912fc0
+10 w 0x10a159c0
+11 w 0x10b3e940
+12 r 0x10c168c0
+13 r 0x20001380
+14 r 0x20001340
+15 w 0x10f1c940
+0 r 0x20003340
+1 r 0x10100480
+2 w 0x20001f00
+3 r 0x1030e4c0
+4 w 0x1041e7c0
+5 w 0x20003980
+6 w 0x10636880
+7 r 0x10723480
+8 r 0x1083e200
+9 w 0x20002f80
+10 w 0x10a1c900
+11 r 0x10b2c900
+12 r 0x10c29900
+13 r 0x10d2c540
+14 w 0x20003040
+15 r 0x10f12800
+0 r 0x10029340
+1 r 0x10117c40
+2 r 0x20003340
+3 r 0x20003ec0
+4 w 0x10406e40
+5 w 0x10524040
+6 w 0x106067c0
+7 r 0x10708900
+8 r 0x108341c0
+9 r 0x1092b140
+10 r 0x10a2eec0
+11 w 0x10b25540
+12 r 0x10c27140
+13 r 0x10d054c0
+14 r 0x20002a40
+15 w 0x10f0f3c0
+0 r 0x10035580
+1 w 0x10104940
+2 r 0x20001f00
+3 w 0x1033b840
+4 r 0x1041b880
+5 r 0x1052fdc0
+6 r 0x1060ec00
+7 r 0x200013c0
+8 r 0x108151c0
+9 r 0x10937ac0
+10 r 0x10a3fc00
+11 r 0x10b3b700
+12 r 0x10c06480
+13 r 0x10d3f880
+14 r 0x20003dc0
+15 r 0x10f0c400
+0 r 0x1001a440
+1 w 0x10102f00
+2 r 0x1020cac0
+3 w 0x10318e40
+4 w 0x10403d00
+5 r 0x1052fe40
+6 w 0x10622c00
+7 w 0x200027c0
+8 r 0x20000180
+9 r 0x10932900
+10 w 0x10a20cc0
+11 r 0x10b28400
+12 r 0x10c31140
+13 r 0x10d05940
+14 w 0x10e28500
+15 w 0x10f22c00
+0 r 0x10015080
+1 r 0x20000b40
+2 r 0x10216240
+3 r 0x1031b940
+4 w 0x10406300
+5 r 0x10534740
+6 r 0x1060ab80
+7 w 0x1071bac0
+8 r 0x10836900
+9 r 0x1091ff80
+10 r 0x10a22780
+11 r 0x10b0ad40
+12 r 0x10c0e500
+13 r 0x10d35600
+14 w 0x20001a00
+15 r 0x10f27ec0
+0 w 0x10005e80
+1 r 0x20002e40
+2 r 0x10209bc0
+3 r 0x1032fc40
+4 w 0x1041e400
+5 w 0x1051ee80
+6 w 0x1063ddc0
+7 w 0x20002200
+8 w 0x1083a480
+9 w 0x200009c0
+10 w 0x10a08bc0
+11 r 0x10b11a00
+12 r 0x10c3b800
+13 w 0x20000700
+14 r 0x10e28440
+15 r 0x10f0e4c0
+0 r 0x20000840
+1 r 0x1013ed40
+2 r 0x10214c40
+3 w 0x10323480
+4 r 0x1040c100
+5 r 0x10534280
+6 w 0x20002e40
+7 w 0x1071fcc0
+8 w 0x1080f000
+9 w 0x1093f780
+10 w 0x10a22c40
+11 r 0x10b27600
+12 r 0x10c30440
+13 r 0x10d3fa00
+14 w 0x10e2f300
+15 w 0x10f0bc40
+0 r 0x10012e40
+1 w 0x20002180
+2 w 0x1023dfc0
+3 r 0x1031f800
+4 r 0x20000f40
+5 r 0x1052e980
+6 r 0x10603c40
+7 w 0x10714900
+8 w 0x1080f880
+9 w 0x10920340
+10 w 0x200027c0
+11 w 0x10b23300
+12 r 0x10c31d80
+13 r 0x10d1a7c0
+14 r 0x10e3f700
+15 r 0x10f25040
+0 r 0x10023240
+1 r 0x1013fd40
+2 w 0x1023ffc0
+3 r 0x10328a80
+4 r 0x1040b5c0
+5 w 0x1052a780
+6 r 0x10609e40
+7 r 0x1070e780
+8 r 0x10816ec0
+9 r 0x10938200
+10 r 0x10a13300
+11 r 0x10b02d00
+12 r 0x10c19840
+13 r 0x10d2ec00
+14 r 0x10e08200
+15 r 0x10f309c0
+0 r 0x10031780
+1 w 0x1012d100
+2 r 0x1020d440
+3 w 0x20003a40
+4 w 0x10420540
+5 r 0x1053e840
+6 w 0x10612140
+7 w 0x20000680
+8 r 0x1083eb80
+9 r 0x1093d380
+10 r 0x10a02b40
+11 w 0x10b0be80
+12 r 0x20001200
+13 w 0x10d0f080
+14 w 0x10e22880
+15 r 0x10f19800
+0 r 0x10021c40
+1 r 0x10137200
+2 w 0x10202480
+3 r 0x103145c0
+4 w 0x10414f80
+5 r 0x1053f180
+6 r 0x10635380
+7 w 0x107366c0
+8 w 0x10801dc0
+9 w 0x1092a280
+10 w 0x20002e80
+11 r 0x10b0ad40
+12 r 0x10c09340
+13 r 0x10d0c180
+14 r 0x20001780
+15 w 0x20001c00
+0 r 0x1003d580
+1 w 0x1011ecc0
+2 r 0x1022c740
+3 r 0x10327340
+4 w 0x10402b80
+5 r 0x20002840
+6 w 0x20002c00
+7 w 0x10707580
+8 r 0x1082df40
+9 w 0x109340c0
+10 r 0x10a02fc0
+11 w 0x10b01b40
+12 r 0x10c01e40
+13 r 0x10d3ec00
+14 r 0x20001040
+15 r 0x10f19000
+0 w 0x10028280
+1 r 0x1011c580
+2 r 0x200012c0
+3 w 0x200009c0
+4 r 0x1041d400
+5 w 0x20002d00
+6 r 0x10606080
+7 w 0x10715380
+8 w 0x1080cd80
+9 r 0x1092d800
+10 r 0x10a04140
+11 r 0x10b11d00
+12 w 0x10c34180
+13 r 0x20003140
+14 r 0x20001a00
+15 r 0x10f2e040
+0 w 0x1003f9c0
+1 r 0x1010c580
+2 w 0x102029c0
+3 w 0x10317e40
+4 w 0x20002480
+5 w 0x10520640
+6 w 0x10638e80
+7 r 0x10724d00
+8 r 0x10811280
+9 r 0x10904e00
+10 r 0x10a3ea80
+11 w 0x10b22dc0
+12 r 0x10c1d000
+13 w 0x10d348c0
+14 w 0x10e32800
+15 w 0x10f29340
+0 w 0x10012b80
+1 r 0x10120e00
+2 r 0x20001600
+3 w 0x20002340
+4 r 0x10438e00
+5 r 0x1050f200
+6 w 0x20003900
+7 r 0x107292c0
+8 r 0x1083c440
+9 w 0x20002980
+10 w 0x10a2df40
+11 r 0x10b22240
+12 r 0x10c133c0
+13 r 0x10d2a800
+14 w 0x10e25740
+15 r 0x10f3a8c0
+0 r 0x10023340
+1 w 0x20001400
+2 w 0x10235880
+3 w 0x1033b400
+4 r 0x1043c740
+5 r 0x1050f3c0
+6 r 0x1060b5c0
+7 r 0x20000b80
+8 w 0x20002c00
+9 r 0x1090e640
+10 w 0x10a32c80
+11 r 0x10b2e4c0
+12 r 0x10c056c0
+13 w 0x10d04900
+14 w 0x10e02680
+15 r 0x200035c0
+0 r 0x20000d80
+1 r 0x10109f00
+2 r 0x102089c0
+3 r 0x103120c0
+4 r 0x200012c0
+5 r 0x105239c0
+6 r 0x1061f600
+7 w 0x10713600
+8 r 0x1082d680
+9 r 0x1090bb40
+10 r 0x10a36180
+11 r 0x10b16f40
+12 r 0x10c06000
+13 r 0x10d0ae00
+14 w 0x10e39100
+15 w 0x10f2e140
+0 r 0x20001e40
+1 r 0x1011bd00
+2 r 0x102202c0
+3 w 0x10329b00
+4 r 0x20001080
+5 r 0x10511d80
+6 w 0x20000000
+7 r 0x107217c0
+8 r 0x1083f080
+9 r 0x10918e80
+10 w 0x10a22040
+11 r 0x10b081c0
+12 w 0x20000d80
+13 w 0x10d39180
+14 w 0x20000180
+15 w 0x10f026c0
+0 w 0x10034f80
+1 r 0x1011b780
+2 w 0x10235340
+3 w 0x1032f300
+4 w 0x10435780
+5 r 0x10515100
+6 r 0x10635e00
+7 w 0x10722e40
+8 w 0x1082b980
+9 r 0x10916a80
+10 r 0x10a08d80
+11 w 0x20003cc0
+12 r 0x10c007c0
+13 w 0x10d39600
+14 w 0x10e34d80
+15 w 0x10f12cc0
+0 r 0x20001b80
+1 r 0x1012d380
+2 w 0x102333c0
+3 r 0x10312d00
+4 r 0x104335c0
+5 w 0x1051ec80
+6 r 0x1061f800
+7 r 0x10708180
+8 r 0x10802e80
+9 r 0x1091f400
+10 w 0x10a06f40
+11 r 0x10b29d80
+12 w 0x10c3be80
+13 w 0x10d2adc0
+14 w 0x10e2fa00
+15 w 0x20002b80
+0 r 0x1000ec40
+1 r 0x200030c0
+2 w 0x10206c40
+3 r 0x1031f740
+4 r 0x20002680
+5 w 0x1052afc0
+6 r 0x1063b800
+7 w 0x10727200
+8 w 0x108387c0
+9 r 0x1092f400
+10 r 0x10a35840
+11 r 0x10b2bc40
+12 r 0x10c1d740
+13 w 0x10d08140
+14 w 0x10e22540
+15 r 0x10f1ca80
+0 w 0x1002c2c0
+1 r 0x1012e240
+2 w 0x102353c0
+3 r 0x10318f80
+4 r 0x10429bc0
+5 w 0x10539c40
+6 r 0x1063fe80
+7 w 0x20003740
+8 r 0x108116c0
+9 w 0x10916640
+10 r 0x10a28600
+11 w 0x10b32640
+12 r 0x10c3ff80
+13 r 0x10d15c40
+14 r 0x10e052c0
+15 w 0x20000400
+0 r 0x10025dc0
+1 w 0x200023c0
+2 r 0x20001340
+3 r 0x20003a40
+4 r 0x10423c80
+5 r 0x1052cbc0
+6 r 0x10620580
+7 r 0x107031c0
+8 r 0x10819580
+9 r 0x200021c0
+10 r 0x200033c0
+11 r 0x20002980
+12 r 0x10c3b640
+13 w 0x10d00fc0
+14 w 0x20002580
+15 r 0x10f1b100
+0 r 0x200034c0
+1 r 0x10110080
+2 r 0x10221540
+3 w 0x20002980
+4 r 0x10429c80
+5 w 0x105050c0
+6 w 0x20002600
+7 w 0x10727a00
+8 w 0x1080d240
+9 r 0x1091f500
+10 w 0x20002100
+11 r 0x10b2e280
+12 r 0x10c2b6c0
+13 w 0x10d351c0
+14 r 0x200035c0
+15 w 0x20002ec0
+0 w 0x10029f40
+1 r 0x1012ec00
+2 r 0x1020ccc0
+3 r 0x20002e80
+4 w 0x200011c0
+5 w 0x20003c80
+6 r 0x10619a80
+7 w 0x1073c040
+8 w 0x10832a80
+9 r 0x10937000
+10 r 0x10a053c0
+11 r 0x10b14440
+12 r 0x10c15180
+13 r 0x10d0fc00
+14 w 0x10e25b00
+15 r 0x10f148c0
+0 w 0x20002340
+1 r 0x10123b80
+2 w 0x20000e00
+3 w 0x10315a00
+4 r 0x1043c240
+5 w 0x1050dfc0
+6 r 0x10622dc0
+7 r 0x1071ac00
+8 w 0x1082c940
+9 r 0x10903100
+10 w 0x10a10f40
+11 r 0x10b3b280
+12 w 0x10c32b40
+13 r 0x20003c80
+14 w 0x10e255c0
+15 w 0x10f00dc0
+0 r 0x10008500
+1 w 0x20000f40
+2 r 0x1022b600
+3 w 0x1032ec40
+4 w 0x10431a00
+5 w 0x1053c080
+6 r 0x1061b6c0
+7 r 0x10734780
+8 r 0x10825c00
+9 r 0x10920c80
+10 r 0x10a0f640
+11 w 0x10b2f600
+12 r 0x10c06a40
+13 r 0x10d15400
+14 w 0x10e253c0
+15 r 0x10f33d40
+0 w 0x10024300
+1 r 0x10108340
+2 r 0x10222f40
+3 w 0x10331e80
+4 w 0x20000cc0
+5 r 0x105377c0
+6 w 0x1061dd00
+7 w 0x10723e80
+8 r 0x10805200
+9 r 0x1092eb00
+10 r 0x10a24480
+11 w 0x20000a00
+12 r 0x20000200
+13 r 0x10d17bc0
+14 r 0x10e35780
+15 r 0x10f0dc00
+0 w 0x1000dec0
+1 r 0x1012a6c0
+2 r 0x10228580
+3 w 0x20000a80
+4 r 0x1041c840
+5 w 0x10513400
+6 w 0x1063a200
+7 r 0x20000200
+8 w 0x1080c200
+9 r 0x1091f840
+10 w 0x10a2cd00
+11 r 0x20000e40
+12 r 0x10c1d640
+13 w 0x20002240
+14 r 0x10e3a6c0
+15 r 0x20003c40
+0 r 0x10015480
+1 w 0x20000940
+2 w 0x10218d40
+3 w 0x103132c0
+4 r 0x20001780
+5 w 0x200012c0
+6 w 0x1062b440
+7 r 0x20003380
+8 w 0x10806840
+9 r 0x20000580
+10 r 0x10a103c0
+11 w 0x10b0fe40
+12 r 0x10c3f4c0
+13 r 0x20002e00
+14 r 0x20000480
+15 w 0x20001c40
+0 r 0x10010e40
+1 w 0x10125f00
+2 r 0x10235bc0
+3 w 0x20002b00
+4 w 0x200031c0
+5 r 0x200018c0
+6 r 0x1062af40
+7 w 0x10701140
+8 r 0x20003800
+9 r 0x10904e00
+10 r 0x10a0b4c0
+11 r 0x10b00580
+12 r 0x10c222c0
+13 w 0x10d39b00
+14 r 0x10e16740
+15 w 0x10f22f00
+0 r 0x10001fc0
+1 r 0x101026c0
+2 r 0x10237d80
+3 w 0x1033a800
+4 w 0x20000080
+5 w 0x10536d80
+6 w 0x20000c40
+7 r 0x10736340
+8 w 0x1083f840
+9 w 0x20003180
+10 r 0x10a3b180
+11 r 0x10b23e00
+12 w 0x20003480
+13 r 0x10d05b40
+14 w 0x10e02340
+15 w 0x20001fc0
+0 w 0x10016dc0
+1 r 0x10102080
+2 r 0x102107c0
+3 w 0x20001ec0
+4 w 0x10428a40
+5 r 0x10511f00
+6 r 0x10607140
+7 w 0x20001640
+8 r 0x1081a5c0
+9 w 0x20000a00
+10 r 0x10a3d340
+11 r 0x10b38280
+12 w 0x200006c0
+13 r 0x10d16e40
+14 r 0x20003ec0
+15 r 0x10f093c0
+0 w 0x20000300
+1 r 0x10108d40
+2 r 0x10209640
+3 r 0x20003f80
+4 r 0x10404900
+5 r 0x10526280
+6 r 0x10606d00
+7 r 0x10716840
+8 w 0x10802800
+9 r 0x200007c0
+10 r 0x10a1d040
+11 w 0x10b32cc0
+12 r 0x10c17880
+13 r 0x10d32b00
+14 w 0x10e3c800
+15 w 0x10f3f000
+0 r 0x20002700
+1 r 0x1011f6c0
+2 r 0x20002a00
+3 w 0x1031d4c0
+4 r 0x1042a240
+5 w 0x1052fc00
+6 r 0x1060ee00
+7 r 0x10729a40
+8 r 0x10838800
+9 r 0x10913d80
+10 r 0x10a22dc0
+11 w 0x10b09d00
+12 w 0x10c2d4c0
+13 r 0x10d35540
+14 w 0x10e276c0
+15 r 0x10f34580
+0 r 0x1000df80
+1 r 0x10128bc0
+2 r 0x1023fac0
+3 w 0x1033fc00
+4 w 0x20003840
+5 w 0x105123c0
+6 r 0x10612c80
+7 w 0x10700d40
+8 r 0x108137c0
+9 r 0x10918b40
+10 r 0x10a01640
+11 r 0x10b03b40
+12 w 0x20002fc0
+13 w 0x10d1b5c0
+14 r 0x10e11380
+15 r 0x10f0d940
+0 r 0x20003800
+1 r 0x20002ec0
+2 w 0x10210600
+3 w 0x10310340
+4 w 0x10439340
+5 w 0x105155c0
+6 r 0x20001380
+7 r 0x1073b700
+8 w 0x1080ff00
+9 w 0x10918d80
+10 r 0x10a2c100
+11 w 0x10b0d580
+12 w 0x20000680
+13 r 0x20001380
+14 r 0x20000200
+15 r 0x10f05300
+0 w 0x10019d40
+1 w 0x200003c0
+2 w 0x1022ea80
+3 w 0x10319140
+4 w 0x20003000
+5 r 0x20003240
+6 r 0x10604200
+7 r 0x200036c0
+8 w 0x108048c0
+9 r 0x20003ec0
+10 w 0x10a278c0
+11 r 0x10b22500
+12 w 0x10c16d00
+13 r 0x10d27e40
+14 w 0x10e24500
+15 r 0x10f24540
+0 r 0x10017280
+1 r 0x10113f00
+2 w 0x10203d40
+3 r 0x103010c0
+4 w 0x1043ff40
+5 w 0x20003400
+6 r 0x10609ec0
+7 r 0x1071aa00
+8 r 0x1083ac40
+9 w 0x20000380
+10 r 0x10a2a5c0
+11 r 0x200003c0
+12 w 0x20002b40
+13 r 0x10d2d500
+14 r 0x10e29a40
+15 w 0x200024c0
+0 w 0x1003a100
+1 w 0x10124240
+2 w 0x20000f80
+3 r 0x1031e040
+4 r 0x1042bd80
+5 r 0x1050c2c0
+6 w 0x106270c0
+7 r 0x1073b680
+8 r 0x1080f640
+9 r 0x1093edc0
+10 r 0x10a0f440
+11 r 0x10b04540
+12 r 0x200020c0
+13 w 0x10d2d980
+14 w 0x10e20680
+15 r 0x10f26080
+0 r 0x1002cd00
+1 r 0x10123780
+2 r 0x10213900
+3 r 0x10323c40
+4 w 0x20002600
+5 w 0x20002c80
+6 w 0x10627b40
+7 r 0x10710080
+8 r 0x1082c240
+9 r 0x1092a1c0
+10 w 0x10a12ac0
+11 r 0x10b35100
+12 w 0x10c10540
+13 r 0x20003880
+14 r 0x10e09900
+15 r 0x10f1ab40
+0 r 0x100329c0
+1 r 0x20001ac0
+2 w 0x10230380
+3 r 0x20001c40
+4 r 0x10414080
+5 r 0x10503880
+6 r 0x200019c0
+7 w 0x10705240
+8 r 0x10801380
+9 w 0x10939640
+10 r 0x10a23b80
+11 w 0x10b27500
+12 w 0x10c17600
+13 r 0x10d30e00
+14 r 0x10e1e800
+15 r 0x10f2be40
+0 r 0x10007600
+1 r 0x10108200
+2 r 0x1023db80
+3 w 0x103072c0
+4 r 0x10436f80
+5 w 0x1050be00
+6 r 0x20001cc0
+7 r 0x1073e400
+8 r 0x10826400
+9 r 0x20001a00
+10 r 0x10a18640
+11 r 0x20001900
+12 r 0x10c03d40
+13 r 0x10d07100
+14 r 0x10e39140
+15 r 0x10f3d180
+0 r 0x100040c0
+1 r 0x1010aa00
+2 r 0x1022ddc0
+3 w 0x200027c0
+4 r 0x1041c700
+5 w 0x10517400
+6 r 0x1063e100
+7 r 0x20001940
+8 r 0x20001180
+9 w 0x10934280
+10 r 0x10a1cb80
+11 w 0x200007c0
+12 r 0x10c37140
+13 w 0x10d2c400
+14 r 0x10e31d00
+15 r 0x10f3b5c0
+0 r 0x10017a00
+1 w 0x10107fc0
+2 r 0x102123c0
+3 r 0x103244c0
+4 r 0x1041eb00
+5 r 0x1053fb00
+6 r 0x10624940
+7 r 0x1072c080
+8 w 0x1081ab00
+9 w 0x10900dc0
+10 w 0x20002940
+11 r 0x10b2f7c0
+12 r 0x10c12740
+13 r 0x10d2fcc0
+14 r 0x10e361c0
+15 r 0x10f16080
+0 r 0x10011d40
+1 w 0x20001040
+2 w 0x10220bc0
+3 r 0x10339800
+4 w 0x10426980
+5 w 0x1053f200
+6 w 0x1060c3c0
+7 w 0x107234c0
+8 r 0x20001e00
+9 w 0x10905540
+10 r 0x10a34040
+11 w 0x10b15cc0
+12 r 0x20002f80
+13 r 0x10d3dd40
+14 w 0x10e3a700
+15 r 0x10f3db00
+0 r 0x1001dd40
+1 r 0x10106480
+2 r 0x1023fa80
+3 r 0x1030ce00
+4 w 0x1043a500
+5 w 0x10533d40
+6 r 0x10600f40
+7 w 0x10707440
+8 r 0x10838bc0
+9 r 0x10938dc0
+10 r 0x10a0bb80
+11 r 0x10b39d00
+12 r 0x10c149c0
+13 r 0x20002e00
+14 w 0x10e15b40
+15 w 0x200017c0
+0 w 0x20000980
+1 r 0x10119f00
+2 r 0x102144c0
+3 r 0x1032af40
+4 r 0x1043aac0
+5 r 0x1050dbc0
+6 r 0x20002200
+7 w 0x1072e200
+8 r 0x1083f000
+9 r 0x109051c0
+10 r 0x200004c0
+11 r 0x10b08780
+12 r 0x10c03ec0
+13 r 0x10d26f80
+14 w 0x10e16700
+15 w 0x20000000
+0 w 0x1002a480
+1 r 0x200026c0
+2 r 0x10215a80
+3 w 0x20003140
+4 r 0x10402580
+5 r 0x1053b200
+6 r 0x10617680
+7 r 0x20001fc0
+8 r 0x20002ec0
+9 r 0x10915340
+10 r 0x10a12fc0
+11 w 0x20000a00
+12 w 0x10c33800
+13 r 0x20001980
+14 w 0x10e18e80
+15 r 0x10f33ac0
+0 w 0x20002a80
+1 r 0x10102100
+2 r 0x10222780
+3 w 0x10327100
+4 r 0x20002a40
+5 r 0x10516b80
+6 r 0x10608940
+7 w 0x20000240
+8 r 0x1083eb80
+9 w 0x10908c00
+10 r 0x10a3a500
+11 r 0x10b17240
+12 r 0x10c167c0
+13 w 0x20000380
+14 w 0x20002e00
+15 w 0x10f3d440
+0 r 0x10021580
+1 w 0x10116900
+2 r 0x20000c00
+3 r 0x103364c0
+4 w 0x20003b00
+5 r 0x200010c0
+6 w 0x1063b340
+7 w 0x10725000
+8 r 0x1081fd00
+9 r 0x1090fe40
+10 r 0x10a35d40
+11 w 0x20002b80
+12 r 0x10c0a140
+13 r 0x10d0b900
+14 r 0x10e0e780
+15 r 0x10f30e00
+0 r 0x10015400
+1 r 0x10111500
+2 r 0x1022d840
+3 w 0x10313f80
+4 w 0x10408740
+5 r 0x1053d100
+6 r 0x1060f680
+7 r 0x200031c0
+8 r 0x20002d40
+9 r 0x20002e40
+10 r 0x10a0cec0
+11 r 0x10b1fc80
+12 r 0x10c0c940
+13 r 0x10d0ad80
+14 r 0x10e13740
+15 r 0x20002080
+0 w 0x1000fd40
+1 w 0x10131080
+2 w 0x1021ca40
+3 r 0x1032bbc0
+4 r 0x1042f000
+5 w 0x1053e240
+6 r 0x10610440
+7 w 0x20002100
+8 w 0x20003200
+9 r 0x1093f3c0
+10 r 0x10a288c0
+11 r 0x20003380
+12 r 0x10c1fd00
+13 w 0x10d0c4c0
+14 w 0x10e1c980
+15 r 0x20001140
+0 w 0x100316c0
+1 r 0x10106600
+2 r 0x1020aa00
+3 r 0x10312340
+4 w 0x1041c180
+5 r 0x1053a1c0
+6 r 0x20001080
+7 r 0x20001800
+8 r 0x1080e4c0
+9 w 0x20000340
+10 w 0x10a0b440
+11 r 0x10b12200
+12 r 0x10c38e80
+13 r 0x20002380
+14 r 0x10e25480
+15 w 0x20000540
+0 r 0x20000840
+1 r 0x1013c0c0
+2 r 0x1021d8c0
+3 w 0x1031f800
+4 r 0x10403500
+5 r 0x10519e00
+6 w 0x20000800
+7 r 0x10728300
+8 r 0x10821d00
+9 w 0x20003680
+10 r 0x10a1b800
+11 r 0x10b3c540
+12 w 0x10c39a00
+13 r 0x10d2cbc0
+14 w 0x10e17e40
+15 r 0x10f0e900
+0 r 0x10030dc0
+1 r 0x1013d3c0
+2 w 0x20003ec0
+3 r 0x20000480
+4 r 0x10404280
+5 w 0x10530200
+6 r 0x20000600
+7 w 0x10736a80
+8 w 0x20003200
+9 r 0x10913a00
+10 w 0x20000500
+11 r 0x10b28a40
+12 r 0x10c00680
+13 w 0x200000c0
+14 r 0x10e37300
+15 r 0x10f30740
+0 w 0x10038b00
+1 w 0x20002d80
+2 r 0x10221cc0
+3 r 0x10306140
+4 w 0x1041a040
+5 r 0x1051a5c0
+6 r 0x10602080
+7 r 0x1073f000
+8 w 0x20000ec0
+9 w 0x200004c0
+10 w 0x10a3e980
+11 w 0x10b24a80
+12 r 0x10c11080
+13 w 0x20000ac0
+14 r 0x10e33ac0
+15 r 0x10f23580
+0 r 0x1000cac0
+1 r 0x1010fc40
+2 r 0x10222040
+3 w 0x20002e80
+4 r 0x1042e600
+5 r 0x10516ec0
+6 w 0x1060f1c0
+7 w 0x10725b40
+8 r 0x1083b140
+9 r 0x1092f1c0
+10 r 0x10a3f380
+11 r 0x10b09380
+12 r 0x10c01340
+13 r 0x10d1cb00
+14 w 0x10e09700
+15 r 0x10f21700
+0 w 0x10017a80
+1 w 0x200003c0
+2 w 0x1021a7c0
+3 r 0x10312bc0
+4 w 0x1042a480
+5 r 0x10519700
+6 w 0x10625f40
+7 r 0x10730800
+8 w 0x20003c40
+9 r 0x10929680
+10 r 0x10a25500
+11 w 0x10b20cc0
+12 w 0x10c30480
+13 w 0x10d36c00
+14 w 0x20003600
+15 r 0x10f383c0
+0 r 0x1003d100
+1 r 0x10126140
+2 r 0x20002900
+3 r 0x1033fb40
+4 r 0x1040dc40
+5 w 0x10523c40
+6 r 0x10613c80
+7 w 0x10706900
+8 r 0x20003680
+9 r 0x20001400
+10 r 0x10a1ec80
+11 w 0x10b0a340
+12 w 0x10c1cc40
+13 w 0x10d0d2c0
+14 r 0x10e35300
+15 w 0x10f03840
+0 r 0x1000d900
+1 w 0x101229c0
+2 w 0x1021fa80
+3 r 0x20003600
+4 w 0x1040fa40
+5 r 0x10516fc0
+6 r 0x1063fb80
+7 r 0x20003e40
+8 r 0x20002200
+9 r 0x1092e040
+10 r 0x10a346c0
+11 w 0x10b280c0
+12 r 0x10c0be40
+13 r 0x10d1db00
+14 r 0x10e269c0
+15 w 0x10f1a280
+0 r 0x1003a840
+1 r 0x101150c0
+2 r 0x10206f00
+3 w 0x10315e80
+4 r 0x104324c0
+5 r 0x10505f40
+6 w 0x20000200
+7 r 0x10723340
+8 w 0x10839600
+9 r 0x109277c0
+10 r 0x20001c40
+11 w 0x10b02500
+12 r 0x10c20480
+13 w 0x10d24380
+14 w 0x10e00b80
+15 r 0x10f33700
+0 w 0x1000cc00
+1 r 0x10138580
+2 r 0x10215c00
+3 r 0x10322d40
+4 r 0x10406e00
+5 r 0x1052a400
+6 r 0x1060a380
+7 r 0x10724500
+8 w 0x1081c2c0
+9 r 0x1092ae40
+10 r 0x10a3ba00
+11 r 0x10b3c640
+12 w 0x20001f00
+13 r 0x10d2bbc0
+14 w 0x10e0ddc0
+15 w 0x10f1d1c0
+0 r 0x20001180
+1 w 0x1010db80
+2 r 0x1021a300
+3 w 0x10331600
+4 r 0x10417ac0
+5 r 0x1051bd00
+6 r 0x10637100
+7 r 0x10713980
+8 r 0x108278c0
+9 r 0x10912a80
+10 w 0x20001140
+11 w 0x10b14580
+12 r 0x10c10cc0
+13 r 0x10d067c0
+14 r 0x10e3d340
+15 w 0x10f08140
+0 r 0x200032c0
+1 r 0x101366c0
+2 r 0x10222a40
+3 r 0x10306280
+4 r 0x200024c0
+5 r 0x1050ae00
+6 w 0x1060a100
+7 r 0x1071a400
+8 w 0x10822440
+9 w 0x200025c0
+10 r 0x20002ac0
+11 r 0x10b208c0
+12 w 0x20002200
+13 r 0x10d2f940
+14 r 0x10e374c0
+15 r 0x10f12d40
+0 r 0x10033640
+1 r 0x10129240
+2 w 0x1022c940
+3 w 0x1030ac40
+4 w 0x200008c0
+5 r 0x10500640
+6 w 0x20003640
+7 w 0x107031c0
+8 r 0x10805d80
+9 r 0x10905380
+10 r 0x10a28a00
+11 w 0x10b00800
+12 r 0x10c2ea80
+13 r 0x10d1db40
+14 r 0x10e1cb80
+15 r 0x20000d40
+0 r 0x20003c00
+1 r 0x20001980
+2 w 0x200036c0
+3 r 0x10320ec0
+4 r 0x1040dd80
+5 r 0x20002f40
+6 w 0x20001f00
+7 w 0x20002d80
+8 r 0x10825c40
+9 w 0x10921d00
+10 r 0x10a3b200
+11 r 0x20000e40
+12 r 0x10c14c40
+13 w 0x200005c0
+14 r 0x20000400
+15 r 0x10f13600
+0 r 0x200009c0
+1 r 0x20001e80
+2 w 0x20001680
+3 r 0x20000fc0
+4 w 0x10402fc0
+5 r 0x10530ac0
+6 w 0x1062d800
+7 r 0x10722240
+8 r 0x1080ac00
+9 r 0x10904100
+10 r 0x10a0e740
+11 w 0x10b02180
+12 r 0x10c3b200
+13 w 0x20003e40
+14 r 0x10e2b380
+15 w 0x10f09ac0
+0 r 0x10033bc0
+1 w 0x200018c0
+2 r 0x10223bc0
+3 w 0x10329300
+4 r 0x20002540
+5 r 0x20001040
+6 r 0x200016c0
+7 r 0x10725940
+8 r 0x1081bf40
+9 r 0x1092c500
+10 r 0x20002580
+11 r 0x20000740
+12 r 0x10c2a440
+13 w 0x10d31800
+14 w 0x10e3e4c0
+15 r 0x10f0f140
+0 w 0x20002f80
+1 r 0x10127c40
+2 w 0x200018c0
+3 r 0x1032cc40
+4 w 0x1041bd80
+5 r 0x10527140
+6 r 0x10610a80
+7 r 0x107078c0
+8 r 0x1083ec80
+9 r 0x10917700
+10 r 0x20001cc0
+11 r 0x10b1d480
+12 w 0x20000a00
+13 r 0x10d29300
+14 w 0x10e29740
+15 r 0x10f327c0
+0 w 0x10017d40
+1 r 0x20000300
+2 w 0x20000bc0
+3 r 0x10321840
+4 r 0x1040f780
+5 w 0x10529b40
+6 w 0x1062e7c0
+7 r 0x10737140
+8 r 0x1082ac00
+9 r 0x20001c00
+10 r 0x10a35f00
+11 r 0x10b20400
+12 w 0x20000bc0
+13 r 0x10d00300
+14 r 0x10e1ccc0
+15 w 0x10f3c440
+0 w 0x100227c0
+1 w 0x20000a80
+2 r 0x10231e00
+3 r 0x20002d40
+4 r 0x10419280
+5 w 0x1050a100
+6 w 0x20002180
+7 w 0x1073be80
+8 w 0x1080bc80
+9 r 0x10917780
+10 w 0x10a237c0
+11 r 0x10b2bb40
+12 w 0x10c0c040
+13 r 0x10d27780
+14 r 0x10e1c280
+15 w 0x20003f00
+0 r 0x1003aac0
+1 r 0x10121c40
+2 r 0x10216740
+3 r 0x1033ac80
+4 r 0x10402b00
+5 w 0x20002a80
+6 w 0x20001540
+7 w 0x1072a740
+8 r 0x10830e40
+9 r 0x10902240
+10 r 0x10a24940
+11 w 0x10b34b00
+12 r 0x20003fc0
+13 w 0x10d15280
+14 w 0x20001480
+15 r 0x20002d40
+0 r 0x1001e2c0
+1 r 0x10133780
+2 r 0x1023be00
+3 r 0x10303ec0
+4 r 0x1040b540
+5 w 0x20003b80
+6 r 0x106275c0
+7 w 0x10726980
+8 r 0x1082a540
+9 r 0x10913780
+10 r 0x20000280
+11 r 0x10b0fd40
+12 r 0x10c34300
+13 w 0x10d0a100
+14 w 0x10e3a980
+15 w 0x10f2fb00
+0 w 0x1000c300
+1 r 0x101281c0
+2 r 0x10213e00
+3 r 0x20002a00
+4 r 0x10422d40
+5 w 0x105314c0
+6 w 0x1063f140
+7 r 0x1070bf00
+8 r 0x10809000
+9 r 0x109299c0
+10 w 0x10a05740
+11 w 0x10b072c0
+12 r 0x10c18740
+13 r 0x10d337c0
+14 w 0x20002dc0
+15 w 0x20000680
+0 r 0x10028780
+1 w 0x10137700
+2 r 0x10216900
+3 r 0x10313f40
+4 r 0x20003300
+5 r 0x10517000
+6 r 0x1061af80
+7 r 0x1072eb80
+8 r 0x1081dd00
+9 r 0x1092e580
+10 r 0x20003480
+11 r 0x10b24dc0
+12 r 0x10c18940
+13 r 0x10d34000
+14 w 0x20002380
+15 r 0x10f25a80
+0 r 0x10035a40
+1 w 0x10128500
+2 r 0x10221240
+3 r 0x20003640
+4 w 0x104158c0
+5 r 0x105318c0
+6 r 0x10610480
+7 r 0x20002080
+8 r 0x20000b40
+9 w 0x1090fc40
+10 r 0x10a34680
+11 w 0x10b1cd40
+12 r 0x10c38140
+13 w 0x10d13580
+14 w 0x10e08640
+15 r 0x10f13180
+0 r 0x10002940
+1 w 0x1010fa00
+2 r 0x10211480
+3 r 0x1031cc80
+4 r 0x1043bc40
+5 r 0x10524140
+6 w 0x10605cc0
+7 r 0x20003840
+8 r 0x20002480
+9 r 0x1092d6c0
+10 r 0x10a15e80
+11 r 0x20002b80
+12 w 0x10c3bb40
+13 w 0x10d15780
+14 w 0x10e0af40
+15 r 0x10f1b400
+0 r 0x10030fc0
+1 r 0x1012db40
+2 r 0x10202180
+3 r 0x1032fd80
+4 w 0x20001940
+5 r 0x20001dc0
+6 r 0x10627980
+7 r 0x1071e680
+8 w 0x10832400
+9 r 0x20002b00
+10 w 0x10a14580
+11 r 0x10b04a40
+12 r 0x10c30280
+13 r 0x10d33300
+14 w 0x10e39500
+15 w 0x10f242c0
+0 w 0x20001800
+1 r 0x1010c480
+2 r 0x10214b80
+3 w 0x1032f540
+4 r 0x10435300
+5 r 0x10512c80
+6 r 0x10607800
+7 w 0x107055c0
+8 w 0x1082ea40
+9 w 0x200033c0
+10 w 0x10a177c0
+11 r 0x10b203c0
+12 r 0x10c38d80
+13 r 0x10d09980
+14 r 0x10e18880
+15 r 0x10f203c0
+0 r 0x20001140
+1 r 0x10115740
+2 r 0x1022bc80
+3 w 0x1030a8c0
+4 r 0x1041e480
+5 r 0x105197c0
+6 r 0x1061b780
+7 r 0x1072e200
+8 w 0x20003f40
+9 r 0x10903900
+10 r 0x10a2a740
+11 w 0x10b045c0
+12 r 0x10c12b80
+13 r 0x20000580
+14 r 0x10e357c0
+15 w 0x20002380
+0 r 0x10008bc0
+1 r 0x10135400
+2 r 0x1020e240
+3 r 0x1031b480
+4 r 0x10407580
+5 r 0x1052cd00
+6 r 0x10608e00
+7 r 0x20001b80
+8 w 0x20003800
+9 w 0x1093e640
+10 w 0x10a05740
+11 r 0x10b0b200
+12 r 0x10c09b00
+13 r 0x10d2bf80
+14 r 0x10e33040
+15 r 0x10f094c0
+0 r 0x10028400
+1 r 0x20002200
+2 r 0x10239680
+3 r 0x1032bb00
+4 w 0x20002580
+5 r 0x1051be80
+6 r 0x1063fd80
+7 r 0x1070f5c0
+8 r 0x1082f540
+9 w 0x20001c80
+10 r 0x10a30300
+11 r 0x10b34680
+12 r 0x10c3b100
+13 r 0x10d10f80
+14 r 0x10e1b340
+15 r 0x10f214c0
+0 w 0x10013f40
+1 r 0x10110040
+2 r 0x1020c240
+3 r 0x1033e2c0
+4 w 0x1040b640
+5 w 0x1050f840
+6 w 0x10614100
+7 r 0x1072e340
+8 w 0x1083dcc0
+9 r 0x10936080
+10 w 0x10a0e440
+11 w 0x10b14300
+12 r 0x10c33d00
+13 w 0x10d3a340
+14 r 0x10e00b40
+15 w 0x10f22e80
+0 w 0x20002380
+1 w 0x101084c0
+2 r 0x20001cc0
+3 w 0x20001500
+4 w 0x1043c180
+5 r 0x10501480
+6 r 0x1061a100
+7 w 0x10715600
+8 r 0x10826000
+9 r 0x1093b800
+10 r 0x10a1c2c0
+11 r 0x10b26c80
+12 w 0x10c29900
+13 w 0x10d39700
+14 w 0x10e26d40
+15 r 0x10f1a540
+0 r 0x20001140
+1 w 0x10132d40
+2 w 0x1023e880
+3 r 0x20003800
+4 r 0x10418980
+5 w 0x10506a80
+6 r 0x10602380
+7 r 0x1073ed40
+8 w 0x20000100
+9 r 0x10915b00
+10 r 0x10a38a80
+11 r 0x10b0cd00
+12 w 0x10c04580
+13 w 0x10d19600
+14 r 0x20003c40
+15 r 0x10f16180
+0 r 0x10022ec0
+1 r 0x20001f40
+2 r 0x1022f980
+3 r 0x20003280
+4 r 0x10404700
+5 r 0x10514bc0
+6 w 0x20003e40
+7 w 0x10725700
+8 r 0x20002180
+9 w 0x20000180
+10 r 0x10a09900
+11 r 0x20000800
+12 w 0x10c051c0
+13 r 0x10d09d00
+14 r 0x10e22f80
+15 r 0x20000c40
+0 r 0x1001fa00
+1 r 0x10136c80
+2 r 0x10206a00
+3 r 0x10324740
+4 r 0x10426e40
+5 r 0x1051a000
+6 r 0x10610a40
+7 w 0x20002680
+8 r 0x20003d40
+9 r 0x20002840
+10 w 0x10a14400
+11 r 0x20001f40
+12 r 0x20003180
+13 r 0x10d15640
+14 r 0x20002540
+15 w 0x10f3d400
+0 r 0x1001a480
+1 w 0x20001b40
+2 r 0x1020bf40
+3 w 0x103009c0
+4 w 0x104255c0
+5 r 0x1053b380
+6 w 0x10634f00
+7 r 0x107198c0
+8 w 0x108123c0
+9 w 0x10934880
+10 r 0x10a0d4c0
+11 w 0x10b13300
+12 r 0x10c0bac0
+13 r 0x10d3fa80
+14 w 0x10e1a380
+15 r 0x10f2b680
+0 r 0x10032040
+1 w 0x1011ebc0
+2 r 0x10215cc0
+3 r 0x1032b240
+4 w 0x20003080
+5 w 0x10538940
+6 r 0x10636640
+7 r 0x10724000
+8 r 0x10837300
+9 r 0x10920c00
+10 r 0x10a1af00
+11 w 0x10b1dbc0
+12 w 0x10c0b100
+13 r 0x10d3a5c0
+14 r 0x20000f80
+15 r 0x10f3a080
+0 r 0x10021f00
+1 r 0x10119480
+2 w 0x1022e240
+3 w 0x10337200
+4 r 0x1040da00
+5 w 0x20000480
+6 w 0x200007c0
+7 w 0x10720cc0
+8 r 0x10820200
+9 w 0x20000540
+10 w 0x10a24880
+11 r 0x20000b00
+12 w 0x10c1e400
+13 r 0x10d14240
+14 w 0x10e0a440
+15 w 0x10f1bd40
+0 r 0x10007700
+1 r 0x10122580
+2 w 0x1020e400
+3 r 0x20000280
+4 r 0x10416880
+5 r 0x1053d500
+6 w 0x20001600
+7 r 0x1070cdc0
+8 r 0x108358c0
+9 r 0x10911280
+10 w 0x10a10b80
+11 r 0x10b30840
+12 r 0x10c1a740
+13 w 0x10d38dc0
+14 w 0x10e1bc00
+15 r 0x20001400
+0 r 0x20003f80
+1 r 0x1010ef00
+2 r 0x10230c80
+3 r 0x10330100
+4 r 0x200036c0
+5 w 0x10535b80
+6 r 0x1061b680
+7 r 0x20000c40
+8 r 0x1081e4c0
+9 r 0x10930200
+10 w 0x10a120c0
+11 w 0x10b23840
+12 w 0x10c17040
+13 r 0x10d198c0
+14 r 0x10e20e40
+15 w 0x10f16040
+0 w 0x20000480
+1 r 0x1011bb80
+2 r 0x20000940
+3 r 0x1033b100
+4 r 0x1043e600
+5 r 0x10501400
+6 r 0x1061dac0
+7 r 0x10724680
+8 r 0x108138c0
+9 r 0x10939940
+10 r 0x10a11680
+11 r 0x10b2a080
+12 r 0x20000e40
+13 r 0x10d22d80
+14 r 0x10e2cfc0
+15 r 0x10f33c00
+0 r 0x1002ed00
+1 r 0x10116140
+2 w 0x1020bb00
+3 r 0x1031cf40
+4 r 0x10436dc0
+5 r 0x10507100
+6 r 0x1061e600
+7 w 0x10731fc0
+8 w 0x20000300
+9 w 0x20002400
+10 r 0x10a30500
+11 r 0x10b21680
+12 r 0x10c05ec0
+13 r 0x10d1f780
+14 r 0x10e27080
+15 w 0x20003240
+0 w 0x1000c900
+1 r 0x10135300
+2 w 0x10238f40
+3 r 0x1032a0c0
+4 w 0x1041d8c0
+5 r 0x1050df00
+6 w 0x20002e80
+7 r 0x1070d440
+8 r 0x10814e40
+9 r 0x109050c0
+10 w 0x10a18b40
+11 w 0x10b2b7c0
+12 w 0x10c38ac0
+13 r 0x10d156c0
+14 r 0x10e2b7c0
+15 r 0x10f2e280
+0 r 0x10023400
+1 r 0x10118480
+2 w 0x20001080
+3 r 0x20000400
+4 r 0x10429880
+5 r 0x1052ec80
+6 r 0x10639e00
+7 r 0x1073b7c0
+8 r 0x10836b80
+9 r 0x10921300
+10 r 0x10a0a4c0
+11 r 0x10b33780
+12 r 0x20001440
+13 r 0x10d0ba40
+14 r 0x10e20600
+15 w 0x10f26a40
+0 r 0x1003a680
+1 w 0x20002ac0
+2 w 0x10215200
+3 w 0x10336800
+4 r 0x1041e880
+5 r 0x10532c80
+6 w 0x10608bc0
+7 w 0x10729980
+8 r 0x20001000
+9 w 0x1093cf80
+10 w 0x10a19580
+11 w 0x10b2e1c0
+12 r 0x10c09440
+13 r 0x10d1fa80
+14 r 0x10e0df00
+15 r 0x10f0dbc0
+0 r 0x10021d40
+1 r 0x10119a80
+2 w 0x10229380
+3 w 0x20003280
+4 w 0x1042ff80
+5 w 0x20001ec0
+6 r 0x1062db00
+7 r 0x20002600
+8 r 0x10822e40
+9 r 0x10918680
+10 w 0x10a306c0
+11 w 0x10b05380
+12 w 0x10c19dc0
+13 w 0x20002900
+14 r 0x10e1d780
+15 r 0x10f2b8c0
+0 w 0x10032180
+1 r 0x20000dc0
+2 r 0x1021c700
+3 r 0x1033db40
+4 r 0x1041d940
+5 r 0x10528e40
+6 w 0x20003280
+7 w 0x10712e40
+8 r 0x1081cbc0
+9 r 0x20000700
+10 w 0x20002580
+11 r 0x20001540
+12 w 0x200001c0
+13 r 0x10d17300
+14 r 0x10e072c0
+15 r 0x10f2bc00
+0 w 0x1001f6c0
+1 r 0x1010d540
+2 r 0x102293c0
+3 r 0x1032c780
+4 r 0x104341c0
+5 r 0x10512fc0
+6 r 0x20002cc0
+7 r 0x1071d500
+8 w 0x20003840
+9 r 0x1091cd40
+10 r 0x10a2d380
+11 r 0x10b28c40
+12 w 0x10c015c0
+13 w 0x10d10c00
+14 r 0x10e2c600
+15 r 0x10f027c0
+0 r 0x10012a80
+1 w 0x10119840
+2 r 0x10230700
+3 w 0x10331d80
+4 w 0x10422ec0
+5 r 0x1053a000
+6 r 0x10613000
+7 w 0x20003d00
+8 r 0x1082c7c0
+9 r 0x10936580
+10 r 0x10a29680
+11 r 0x10b29700
+12 w 0x200016c0
+13 w 0x20002b80
+14 r 0x10e23fc0
+15 r 0x10f060c0
+0 r 0x1003f3c0
+1 w 0x1012a880
+2 r 0x1022a500
+3 w 0x10332dc0
+4 r 0x10432d40
+5 w 0x10529300
+6 r 0x20001f80
+7 r 0x10705f00
+8 r 0x10834180
+9 r 0x1091b440
+10 w 0x10a12cc0
+11 r 0x10b066c0
+12 r 0x10c14580
+13 r 0x10d3c4c0
+14 w 0x10e3fa40
+15 r 0x10f2f040
+0 r 0x1000bf40
+1 w 0x1011c440
+2 r 0x1022f6c0
+3 w 0x10312b00
+4 w 0x1042f7c0
+5 r 0x20003000
+6 w 0x20003a00
+7 r 0x1073b700
+8 r 0x1082a900
+9 w 0x1093b580
+10 r 0x10a0bb00
+11 r 0x10b1ef80
+12 r 0x10c050c0
+13 w 0x20000bc0
+14 w 0x200019c0
+15 w 0x10f3f540
+0 w 0x1002fb00
+1 r 0x101165c0
+2 r 0x1023b8c0
+3 r 0x10331e00
+4 w 0x200018c0
+5 r 0x10513600
+6 r 0x10629c40
+7 r 0x10729e00
+8 r 0x10833d80
+9 r 0x20002a40
+10 w 0x10a26880
+11 r 0x10b1ec40
+12 w 0x10c2f080
+13 r 0x10d20180
+14 w 0x10e2a080
+15 r 0x10f12840
+0 r 0x1003fac0
+1 r 0x10131b80
+2 w 0x20000540
+3 r 0x10308480
+4 w 0x10426740
+5 r 0x1050d080
+6 r 0x10608c40
+7 r 0x1070ce40
+8 w 0x10810740
+9 r 0x10936740
+10 r 0x10a2c400
+11 w 0x10b0e980
+12 r 0x10c38400
+13 r 0x10d39400
+14 r 0x20002700
+15 r 0x10f06f00
+0 r 0x100254c0
+1 r 0x1012d240
+2 w 0x1020d380
+3 r 0x20000780
+4 r 0x1041ac00
+5 r 0x10516cc0
+6 r 0x1062ed00
+7 r 0x1071be40
+8 w 0x1080dbc0
+9 r 0x10925b00
+10 r 0x10a3bcc0
+11 w 0x10b18540
+12 r 0x10c111c0
+13 r 0x10d1bf00
+14 r 0x10e3ad40
+15 w 0x10f1b680
+0 r 0x10024380
+1 w 0x1013d400
+2 w 0x10226240
+3 r 0x10321b40
+4 r 0x10423180
+5 w 0x10517340
+6 r 0x20000600
+7 r 0x10728dc0
+8 r 0x10837e40
+9 r 0x10905f80
+10 w 0x10a32b80
+11 r 0x10b0d800
+12 r 0x10c17f00
+13 r 0x10d00e80
+14 w 0x10e21cc0
+15 w 0x10f02a40
+0 r 0x10005bc0
+1 r 0x10103dc0
+2 r 0x1023c080
+3 r 0x10303340
+4 w 0x10425b00
+5 r 0x105098c0
+6 w 0x1061dc00
+7 r 0x10716b00
+8 w 0x20002340
+9 w 0x20002c00
+10 r 0x10a30200
+11 r 0x10b38d00
+12 w 0x10c05a40
+13 w 0x10d07400
+14 w 0x200039c0
+15 w 0x10f06840
+0 w 0x100350c0
+1 w 0x1011a800
+2 r 0x10213300
+3 w 0x10320fc0
+4 r 0x10408ec0
+5 r 0x10502c80
+6 w 0x10614ec0
+7 r 0x1073c640
+8 r 0x10834340
+9 r 0x10928bc0
+10 r 0x20001a40
+11 r 0x10b115c0
+12 w 0x200008c0
+13 w 0x20000c00
+14 r 0x200008c0
+15 r 0x10f29a80
+0 r 0x20003f40
+1 w 0x1013c340
+2 w 0x20000ec0
+3 w 0x20002b40
+4 r 0x10428c80
+5 r 0x20003440
+6 r 0x1063de00
+7 w 0x1073f1c0
+8 r 0x10812c00
+9 w 0x20001540
+10 w 0x10a36900
+11 r 0x20002700
+12 w 0x20000fc0
+13 w 0x10d3f340
+14 w 0x10e032c0
+15 w 0x10f07ec0
+0 r 0x100190c0
+1 w 0x10104b40
+2 r 0x20001ec0
+3 r 0x20002e40
+4 r 0x1042d680
+5 r 0x10526140
+6 r 0x1063c180
+7 w 0x200021c0
+8 r 0x108327c0
+9 w 0x20000500
+10 w 0x10a2b480
+11 r 0x20002fc0
+12 r 0x10c100c0
+13 w 0x10d06d80
+14 r 0x10e09140
+15 w 0x20003bc0
+0 w 0x1002be40
+1 w 0x1012a140
+2 w 0x10237ac0
+3 w 0x10327ac0
+4 r 0x10410300
+5 w 0x20002540
+6 r 0x10637540
+7 r 0x10729180
+8 w 0x1081b4c0
+9 r 0x1091a900
+10 r 0x10a3aec0
+11 r 0x10b3d6c0
+12 r 0x10c079c0
+13 w 0x20003e00
+14 w 0x20002c00
+15 w 0x10f13640
+0 r 0x10030c40
+1 r 0x10107e80
+2 r 0x1023ef00
+3 r 0x20002ac0
+4 r 0x1043c440
+5 r 0x20002b80
+6 r 0x1060ee40
+7 r 0x1072ea80
+8 r 0x10819240
+9 r 0x1093bc40
+10 r 0x10a19180
+11 r 0x10b2e480
+12 w 0x10c088c0
+13 w 0x20000040
+14 r 0x20000980
+15 r 0x10f2aa40
+0 w 0x20000840
+1 r 0x20002e80
+2 r 0x1020bf40
+3 r 0x10327680
+4 r 0x10419ec0
+5 r 0x1052a3c0
+6 r 0x1062c200
+7 w 0x1073e480
+8 r 0x1083ab40
+9 r 0x20002040
+10 w 0x10a37440
+11 w 0x10b34080
+12 r 0x10c05c00
+13 w 0x10d25100
+14 r 0x10e2f340
+15 r 0x10f11f80
+0 w 0x1003ef40
+1 r 0x10138300
+2 w 0x1020d200
+3 r 0x1030ec40
+4 w 0x1043ee80
+5 r 0x10516300
+6 r 0x20001f40
+7 r 0x10714c80
+8 w 0x10838cc0
+9 w 0x20001140
+10 r 0x10a29380
+11 w 0x10b03280
+12 r 0x10c2aec0
+13 r 0x10d3c100
+14 w 0x20003080
+15 r 0x10f39380
+0 r 0x1000e100
+1 r 0x10135d40
+2 r 0x10227c80
+3 r 0x1031e380
+4 r 0x10413fc0
+5 r 0x10516040
+6 r 0x20001240
+7 r 0x1071f640
+8 r 0x10832400
+9 r 0x109370c0
+10 w 0x20001c40
+11 w 0x20001980
+12 r 0x10c2ed80
+13 r 0x10d3cf00
+14 r 0x10e285c0
+15 r 0x10f0adc0
+0 r 0x10005a40
+1 w 0x1013cb00
+2 w 0x1020dd00
+3 r 0x10326780
+4 r 0x10433740
+5 r 0x1051f100
+6 r 0x1060a440
+7 r 0x10717280
+8 r 0x10803e00
+9 w 0x109126c0
+10 r 0x10a21080
+11 r 0x200029c0
+12 r 0x200022c0
+13 r 0x10d30980
+14 r 0x10e02740
+15 w 0x20003180
+0 r 0x1002e400
+1 r 0x1010a000
+2 r 0x1021ee40
+3 w 0x10318980
+4 r 0x200022c0
+5 w 0x10520bc0
+6 r 0x1062f3c0
+7 r 0x1070a100
+8 r 0x10802f40
+9 w 0x10909a40
+10 r 0x10a373c0
+11 r 0x10b3d7c0
+12 r 0x10c2a940
+13 r 0x10d3bb40
+14 r 0x20003980
+15 w 0x10f2bec0
+0 w 0x10003480
+1 r 0x10103600
+2 r 0x1023b380
+3 w 0x20002c80
+4 r 0x1041bf00
+5 r 0x1052f780
+6 r 0x1063a880
+7 w 0x10724580
+8 r 0x108382c0
+9 w 0x1091ca40
+10 w 0x200026c0
+11 w 0x10b13b00
+12 r 0x10c2ff80
+13 w 0x10d045c0
+14 r 0x10e31380
+15 w 0x200010c0
+0 r 0x10026ac0
+1 w 0x10110d40
+2 r 0x1022b780
+3 r 0x10318680
+4 w 0x10405680
+5 r 0x1051a540
+6 w 0x20002ec0
+7 r 0x10734900
+8 r 0x1083ca80
+9 r 0x1093b000
+10 r 0x10a2dd00
+11 w 0x10b0c900
+12 r 0x10c00000
+13 w 0x10d22f40
+14 r 0x10e27780
+15 w 0x20001c00
+0 w 0x100331c0
+1 r 0x1013d040
+2 w 0x20003540
+3 w 0x1031d8c0
+4 w 0x1040c440
+5 r 0x10508a40
+6 r 0x1063ea40
+7 w 0x107335c0
+8 w 0x10820180
+9 w 0x20002400
+10 r 0x10a0c040
+11 r 0x10b3b480
+12 w 0x20001900
+13 w 0x10d0fe40
+14 r 0x10e140c0
+15 r 0x200019c0
+0 w 0x20001cc0
+1 r 0x1010ff00
+2 r 0x1023c000
+3 r 0x1030f400
+4 w 0x104200c0
+5 r 0x20000d40
+6 r 0x10626380
+7 r 0x1072fbc0
+8 w 0x10831c40
+9 r 0x1091b580
+10 w 0x10a2d880
+11 r 0x10b1ef00
+12 w 0x10c3ce40
+13 w 0x10d072c0
+14 r 0x10e36500
+15 w 0x20000d00
+0 r 0x1000a940
+1 r 0x20001040
+2 r 0x1020af40
+3 r 0x1030b940
+4 w 0x10415a80
+5 w 0x10505a80
+6 w 0x1063f500
+7 w 0x20003440
+8 w 0x1082fcc0
+9 w 0x1092d500
+10 r 0x10a0cc80
+11 r 0x10b05980
+12 w 0x20000a80
+13 r 0x10d34480
+14 w 0x10e35a00
+15 w 0x10f15280
+0 r 0x1002c140
+1 r 0x1010f940
+2 r 0x10239840
+3 w 0x103136c0
+4 r 0x1043bf80
+5 w 0x10508a80
+6 r 0x20002000
+7 w 0x1072be80
+8 r 0x1080d340
+9 r 0x10928900
+10 r 0x20003cc0
+11 w 0x10b09c40
+12 w 0x10c26940
+13 r 0x10d2bc80
+14 r 0x10e1e3c0
+15 r 0x10f03d00
+0 r 0x1001a3c0
+1 r 0x20000cc0
+2 r 0x10227a80
+3 r 0x1032dc40
+4 r 0x104065c0
+5 r 0x1052a940
+6 r 0x1061e780
+7 r 0x10711d00
+8 r 0x20001140
+9 r 0x10903940
+10 r 0x20000d40
+11 r 0x10b0aa80
+12 r 0x10c34400
+13 r 0x10d2f740
+14 r 0x10e2f580
+15 r 0x20000e80
+0 r 0x10021f00
+1 r 0x10107b40
+2 r 0x10214680
+3 w 0x10325400
+4 r 0x10402d80
+5 r 0x1050c280
+6 r 0x1063e880
+7 w 0x1071c880
+8 w 0x20000a00
+9 r 0x10918d40
+10 r 0x20003700
+11 r 0x10b17840
+12 r 0x10c2fb40
+13 w 0x10d3a2c0
+14 r 0x10e062c0
+15 r 0x10f33400
+0 r 0x10007080
+1 w 0x20002300
+2 r 0x20003c80
+3 r 0x1033f8c0
+4 r 0x1042cbc0
+5 w 0x105026c0
+6 r 0x10634d40
+7 r 0x10710680
+8 r 0x10818800
+9 r 0x10923240
+10 r 0x10a24b80
+11 r 0x20002a40
+12 r 0x20003700
+13 r 0x20003e40
+14 r 0x10e2f100
+15 w 0x10f02480
+0 r 0x10005d80
+1 r 0x10121500
+2 r 0x200028c0
+3 r 0x10323900
+4 r 0x1041fc00
+5 r 0x1050b400
+6 w 0x20002fc0
+7 r 0x1070bd40
+8 r 0x108295c0
+9 r 0x1092cd80
+10 r 0x10a36980
+11 r 0x10b223c0
+12 w 0x20000fc0
+13 r 0x10d16bc0
+14 r 0x10e1f940
+15 r 0x20003b00
+0 r 0x100385c0
+1 r 0x10128280
+2 r 0x102028c0
+3 r 0x20003000
+4 w 0x20000140
+5 r 0x10517fc0
+6 r 0x10639e80
+7 r 0x107126c0
+8 w 0x10833d80
+9 r 0x10936300
+10 r 0x20001540
+11 w 0x200029c0
+12 r 0x10c0e340
+13 r 0x10d23a00
+14 r 0x20002380
+15 r 0x10f3b340
+0 r 0x200015c0
+1 r 0x10107f80
+2 r 0x1022cf40
+3 w 0x10328f80
+4 r 0x10430c80
+5 w 0x10515040
+6 w 0x20002f80
+7 r 0x10703080
+8 r 0x10806ac0
+9 r 0x20003a40
+10 r 0x10a28480
+11 r 0x10b2d800
+12 w 0x10c0fb00
+13 w 0x10d36500
+14 r 0x10e1b3c0
+15 r 0x10f33c00
+0 w 0x20003640
+1 r 0x10135f00
+2 r 0x10224640
+3 r 0x1030b240
+4 r 0x1040db80
+5 r 0x10524380
+6 r 0x1061d740
+7 r 0x20000340
+8 r 0x10824d00
+9 r 0x10932f40
+10 w 0x10a36c40
+11 r 0x10b12e00
+12 r 0x10c05cc0
+13 w 0x10d00ac0
+14 r 0x10e10b80
+15 r 0x10f09b40
+0 r 0x20000dc0
+1 w 0x1012edc0
+2 r 0x10233f40
+3 r 0x200033c0
+4 r 0x1041aa00
+5 r 0x10524780
+6 r 0x10638300
+7 r 0x107042c0
+8 r 0x1083ee40
+9 r 0x10911a00
+10 w 0x10a18280
+11 w 0x10b067c0
+12 r 0x10c27bc0
+13 w 0x10d0b400
+14 r 0x10e12440
+15 r 0x10f31b00
+0 w 0x200021c0
+1 r 0x101028c0
+2 r 0x1020d340
+3 r 0x1030a340
+4 r 0x1041a1c0
+5 w 0x20001900
+6 w 0x1060b9c0
+7 r 0x10702400
+8 r 0x108167c0
+9 r 0x20002040
+10 r 0x10a2b680
+11 r 0x10b08300
+12 r 0x10c1c1c0
+13 w 0x10d06380
+14 r 0x10e2b680
+15 r 0x200025c0
+0 w 0x10039d40
+1 r 0x1013f0c0
+2 w 0x10215740
+3 r 0x10316340
+4 r 0x20001380
+5 r 0x10516080
+6 r 0x1063df00
+7 w 0x10735ec0
+8 r 0x10839880
+9 r 0x10918440
+10 r 0x10a3c200
+11 w 0x20003c00
+12 r 0x10c3acc0
+13 r 0x20002c80
+14 r 0x10e0b180
+15 w 0x10f02f00
+0 r 0x10020c80
+1 r 0x10126ec0
+2 r 0x102159c0
+3 r 0x1032df00
+4 r 0x1040d580
+5 r 0x10525300
+6 w 0x1063ec40
+7 r 0x1070c5c0
+8 w 0x1080b300
+9 r 0x20002b40
+10 r 0x10a2c600
+11 r 0x10b03f00
+12 w 0x20003740
+13 r 0x10d03000
+14 r 0x10e0b440
+15 r 0x10f30d80
+0 r 0x10000bc0
+1 r 0x101306c0
+2 w 0x200036c0
+3 r 0x103076c0
+4 w 0x20000b80
+5 r 0x200035c0
+6 r 0x1063c340
+7 w 0x1070de00
+8 r 0x1080cd00
+9 r 0x10934d00
+10 w 0x10a3cc00
+11 w 0x10b04a00
+12 w 0x200021c0
+13 w 0x10d16dc0
+14 r 0x10e09e40
+15 r 0x10f14b00
+0 r 0x20002140
+1 r 0x1013e480
+2 r 0x10201780
+3 w 0x10303c80
+4 w 0x20001f40
+5 w 0x10502d80
+6 w 0x200037c0
+7 r 0x107099c0
+8 w 0x20002240
+9 r 0x10904680
+10 w 0x20003a80
+11 r 0x10b35a40
+12 r 0x10c26e00
+13 r 0x10d3fa40
+14 r 0x10e072c0
+15 w 0x10f060c0
+0 w 0x100389c0
+1 r 0x1010f980
+2 w 0x1021bc40
+3 r 0x20000f00
+4 w 0x10428c40
+5 r 0x10525840
+6 w 0x1061e640
+7 r 0x107030c0
+8 w 0x10806a40
+9 w 0x20002b00
+10 w 0x10a3e300
+11 r 0x10b04740
+12 r 0x10c331c0
+13 r 0x10d1fc00
+14 r 0x10e337c0
+15 w 0x10f21900
+0 r 0x20001a80
+1 w 0x10139080
+2 r 0x200024c0
+3 r 0x10322800
+4 r 0x10420240
+5 w 0x1051c340
+6 r 0x1062e7c0
+7 w 0x10704940
+8 w 0x10805a80
+9 r 0x10928f00
+10 w 0x10a128c0
+11 w 0x20002c80
+12 r 0x10c1fd40
+13 r 0x10d20640
+14 w 0x10e355c0
+15 r 0x10f0c9c0
+0 r 0x10029b80
+1 w 0x1010bac0
+2 r 0x10225780
+3 w 0x20003c00
+4 r 0x10435d00
+5 w 0x10527200
+6 w 0x20002a80
+7 r 0x20003a00
+8 r 0x20001b80
+9 w 0x10930380
+10 w 0x10a36f40
+11 w 0x10b00980
+12 r 0x10c1bc00
+13 r 0x10d1b5c0
+14 r 0x10e2a640
+15 r 0x10f20e00
+0 r 0x100070c0
+1 r 0x1011fdc0
+2 r 0x1021ec80
+3 r 0x10330b00
+4 r 0x20002cc0
+5 w 0x1053c140
+6 r 0x10612f40
+7 w 0x10714900
+8 r 0x10824c80
+9 r 0x1093ff80
+10 w 0x20001c80
+11 r 0x10b00940
+12 w 0x10c07240
+13 r 0x10d25480
+14 w 0x10e118c0
+15 r 0x20003440
+0 w 0x1002c4c0
+1 w 0x10124d80
+2 r 0x10233540
+3 r 0x1031bbc0
+4 w 0x1041b8c0
+5 r 0x10538780
+6 r 0x106094c0
+7 r 0x1070d5c0
+8 r 0x1080e4c0
+9 r 0x1093ea80
+10 w 0x20003200
+11 w 0x20000a00
+12 w 0x10c14040
+13 w 0x10d01e40
+14 w 0x10e1e880
+15 r 0x10f11540
+0 r 0x10011b00
+1 r 0x20000b40
+2 r 0x10208900
+3 r 0x20003cc0
+4 w 0x10412040
+5 r 0x10520040
+6 w 0x1061bdc0
+7 r 0x10738140
+8 r 0x1080d480
+9 r 0x10931680
+10 r 0x10a04dc0
+11 r 0x10b2f880
+12 r 0x200004c0
+13 w 0x20003980
+14 r 0x10e0d5c0
+15 r 0x10f1d980
+0 r 0x1001a480
+1 w 0x20000580
+2 r 0x10222000
+3 r 0x103363c0
+4 r 0x10414080
+5 r 0x10530c00
+6 w 0x20003fc0
+7 r 0x1073cf00
+8 r 0x10810f00
+9 w 0x20002f40
+10 r 0x10a2c100
+11 r 0x10b177c0
+12 r 0x10c00200
+13 r 0x10d3dbc0
+14 r 0x20002580
+15 r 0x10f085c0
+0 w 0x1003d940
+1 r 0x101249c0
+2 w 0x1023af80
+3 w 0x10323440
+4 w 0x10402740
+5 r 0x1050ae00
+6 r 0x10636580
+7 r 0x1073fe00
+8 w 0x10819f00
+9 w 0x10927d40
+10 r 0x10a2a840
+11 r 0x10b18500
+12 r 0x10c30580
+13 w 0x10d27a40
+14 r 0x20002080
+15 r 0x10f37300
+0 r 0x200022c0
+1 w 0x10134ec0
+2 r 0x10231740
+3 w 0x10321cc0
+4 w 0x20001800
+5 r 0x200002c0
+6 w 0x10637540
+7 r 0x20002a40
+8 w 0x10803d00
+9 r 0x10915d00
+10 w 0x20003d80
+11 w 0x20003980
+12 r 0x10c07a80
+13 w 0x10d0b080
+14 w 0x10e04740
+15 w 0x20002240
+0 w 0x10013d40
+1 r 0x10102600
+2 r 0x10206340
+3 r 0x10331900
+4 r 0x10419500
+5 w 0x10538980
+6 w 0x1061ea00
+7 w 0x1070cb40
+8 r 0x1082f600
+9 w 0x1090b600
+10 w 0x10a10400
+11 w 0x10b39740
+12 w 0x10c2ebc0
+13 r 0x200002c0
+14 r 0x10e02600
+15 r 0x10f3d100
+0 r 0x1000dc80
+1 r 0x1013f280
+2 w 0x10229680
+3 r 0x1031be00
+4 r 0x10401e00
+5 r 0x20001700
+6 w 0x10618ac0
+7 r 0x1070b040
+8 r 0x1081adc0
+9 r 0x20003040
+10 r 0x10a14800
+11 w 0x10b1cec0
+12 w 0x10c39f00
+13 w 0x10d33640
+14 r 0x10e13200
+15 r 0x10f0ca00
+0 w 0x10022780
+1 r 0x101279c0
+2 w 0x1020b4c0
+3 w 0x1032a5c0
+4 r 0x1043d500
+5 r 0x1052c700
+6 w 0x10605b40
+7 r 0x1070e940
+8 r 0x10816500
+9 r 0x10939140
+10 w 0x10a34d40
+11 r 0x10b2e240
+12 r 0x20001e00
+13 r 0x10d32340
+14 r 0x10e1ae40
+15 w 0x20001d00
+0 r 0x1003ac00
+1 w 0x10127e00
+2 w 0x1023fc40
+3 r 0x10322900
+4 r 0x20000d80
+5 r 0x105340c0
+6 w 0x106061c0
+7 r 0x20000900
+8 w 0x1083f980
+9 w 0x1092fcc0
+10 r 0x10a2e280
+11 w 0x20000e00
+12 w 0x20000c40
+13 w 0x20001600
+14 r 0x10e36300
+15 r 0x10f34480
+0 w 0x200035c0
+1 r 0x1012b700
+2 r 0x1020e280
+3 r 0x10333240
+4 r 0x10429bc0
+5 r 0x200005c0
+6 w 0x1062f540
+7 r 0x1072fe40
+8 r 0x10832ac0
+9 r 0x10912a80
+10 r 0x10a13080
+11 r 0x10b29b80
+12 r 0x10c19280
+13 r 0x10d03dc0
+14 w 0x20001e80
+15 r 0x10f2acc0
+0 r 0x10012040
+1 r 0x10104c80
+2 r 0x10228e40
+3 r 0x1030b7c0
+4 r 0x10405680
+5 r 0x1051c480
+6 r 0x10629ac0
+7 r 0x10707a40
+8 r 0x10801c40
+9 w 0x1091d400
+10 w 0x10a33e80
+11 w 0x10b31240
+12 r 0x10c2cfc0
+13 w 0x10d1acc0
+14 w 0x10e20740
+15 w 0x20002a00
+0 w 0x1002b040
+1 r 0x200011c0
+2 w 0x20003e00
+3 r 0x20000bc0
+4 w 0x20002280
+5 r 0x1051db00
+6 r 0x106014c0
+7 r 0x10700880
+8 w 0x20001e00
+9 r 0x10935c80
+10 r 0x10a3c680
+11 r 0x20002a00
+12 r 0x10c12240
+13 r 0x20002200
+14 r 0x10e3f4c0
+15 r 0x10f08540
+0 w 0x100170c0
+1 w 0x200021c0
+2 w 0x10223c00
+3 r 0x10333a80
+4 r 0x10405d00
+5 w 0x1050f100
+6 w 0x10623a00
+7 r 0x1073cc80
+8 r 0x10832d80
+9 r 0x10939740
+10 r 0x10a254c0
+11 r 0x20000e40
+12 w 0x20001040
+13 r 0x200024c0
+14 r 0x10e13900
+15 r 0x20001b80
+0 r 0x1000a500
+1 r 0x10139cc0
+2 r 0x10202000
+3 r 0x1032bbc0
+4 r 0x10436d80
+5 r 0x10519400
+6 r 0x106277c0
+7 r 0x10703ec0
+8 w 0x10821880
+9 r 0x1091ca40
+10 r 0x10a26d40
+11 w 0x10b00040
+12 w 0x10c22fc0
+13 r 0x10d00f80
+14 w 0x20002d80
+15 r 0x10f01580
+0 r 0x1003c1c0
+1 r 0x10102dc0
+2 r 0x102314c0
+3 r 0x103308c0
+4 w 0x10438980
+5 r 0x10534fc0
+6 r 0x1060c540
+7 r 0x10718880
+8 r 0x108343c0
+9 r 0x1091d4c0
+10 w 0x10a21280
+11 r 0x10b02d00
+12 w 0x10c270c0
+13 w 0x20000100
+14 w 0x10e321c0
+15 w 0x10f144c0
+0 r 0x20000100
+1 r 0x20001000
+2 r 0x1021a940
+3 w 0x10317d80
+4 r 0x1042ae80
+5 r 0x10522680
+6 r 0x10622280
+7 w 0x1071fc40
+8 w 0x1082f080
+9 w 0x10924ac0
+10 r 0x10a38b00
+11 r 0x10b28340
+12 w 0x10c1ebc0
+13 r 0x10d39d80
+14 r 0x10e13240
+15 r 0x10f3f1c0
+0 r 0x10020a80
+1 r 0x10123940
+2 r 0x10223ac0
+3 r 0x10328380
+4 w 0x20000b40
+5 r 0x10529e00
+6 r 0x1060db80
+7 w 0x20000100
+8 r 0x10831e40
+9 w 0x200007c0
+10 w 0x10a15900
+11 r 0x10b26440
+12 r 0x10c3c500
+13 r 0x20001000
+14 r 0x10e27ac0
+15 r 0x10f2f100
+0 r 0x20003180
+1 r 0x1011e940
+2 r 0x10231b80
+3 w 0x1032bb80
+4 r 0x1041a240
+5 r 0x10536f40
+6 r 0x10603480
+7 r 0x10734000
+8 r 0x1080b400
+9 w 0x20002f00
+10 r 0x10a38d00
+11 r 0x10b08b80
+12 r 0x10c1b480
+13 r 0x10d3f380
+14 r 0x20000200
+15 r 0x10f0cc00
+0 r 0x1000f380
+1 w 0x20003d40
+2 r 0x10225600
+3 w 0x10337bc0
+4 w 0x1043b280
+5 r 0x1051b300
+6 r 0x10618400
+7 r 0x10703880
+8 r 0x1081f900
+9 w 0x1092a400
+10 w 0x20001dc0
+11 r 0x20003c80
+12 r 0x10c39bc0
+13 w 0x20000ec0
+14 r 0x20000640
+15 r 0x10f13440
+0 w 0x10009880
+1 r 0x101026c0
+2 r 0x20002e80
+3 r 0x10314300
+4 w 0x200024c0
+5 r 0x1050b800
+6 r 0x20002cc0
+7 r 0x10707380
+8 r 0x10830680
+9 r 0x10924d00
+10 r 0x200003c0
+11 r 0x10b2e440
+12 r 0x10c10400
+13 r 0x10d2dc00
+14 r 0x10e00a00
+15 r 0x10f010c0
+0 r 0x1000cac0
+1 r 0x1011ab40
+2 w 0x102009c0
+3 r 0x10337880
+4 r 0x1042a0c0
+5 w 0x105245c0
+6 w 0x1061b740
+7 r 0x200034c0
+8 r 0x1082e680
+9 r 0x10933180
+10 r 0x10a25d80
+11 r 0x10b0e1c0
+12 r 0x200025c0
+13 r 0x10d2e2c0
+14 w 0x10e186c0
+15 r 0x10f23540
+0 w 0x100361c0
+1 w 0x1011f100
+2 w 0x200023c0
+3 r 0x10323680
+4 r 0x1041da80
+5 r 0x1052a5c0
+6 r 0x1060d980
+7 r 0x20001b80
+8 r 0x10822cc0
+9 w 0x20003940
+10 r 0x10a1afc0
+11 w 0x20003740
+12 r 0x10c35dc0
+13 w 0x10d31640
+14 r 0x10e11840
+15 w 0x10f37d40
+0 r 0x10025f80
+1 r 0x20001b40
+2 r 0x10224440
+3 w 0x10304000
+4 w 0x1041ef40
+5 r 0x10516400
+6 w 0x10606800
+7 r 0x107152c0
+8 r 0x200008c0
+9 r 0x10907480
+10 r 0x20003580
+11 r 0x10b32e80
+12 r 0x10c25340
+13 r 0x10d28d80
+14 r 0x20000000
+15 r 0x10f3cd00
+0 r 0x10031800
+1 r 0x20002100
+2 r 0x10229440
+3 r 0x1033fdc0
+4 w 0x10402080
+5 w 0x10518700
+6 r 0x1062d940
+7 w 0x20002ac0
+8 r 0x1082bd40
+9 r 0x20000640
+10 w 0x10a002c0
+11 w 0x10b39b00
+12 w 0x20001d40
+13 r 0x10d3d140
+14 w 0x10e2ec80
+15 r 0x10f11440
+0 r 0x1003a040
+1 w 0x10115c00
+2 r 0x1021bc80
+3 r 0x20002a40
+4 r 0x10409b40
+5 r 0x1052dd80
+6 w 0x200027c0
+7 w 0x10711e40
+8 w 0x1081cec0
+9 r 0x1092f300
+10 r 0x10a36d00
+11 r 0x10b2e400
+12 w 0x20002b80
+13 r 0x10d2f7c0
+14 r 0x10e32a00
+15 r 0x10f17040
+0 r 0x10011180
+1 r 0x10113580
+2 w 0x102124c0
+3 r 0x10311b40
+4 r 0x10408c00
+5 w 0x200016c0
+6 w 0x10634b40
+7 r 0x200004c0
+8 w 0x20000f80
+9 r 0x1091d5c0
+10 w 0x10a05480
+11 r 0x10b30140
+12 r 0x10c36ec0
+13 r 0x10d34540
+14 r 0x10e26780
+15 r 0x10f17c00
+0 r 0x1003a200
+1 r 0x1012c680
+2 w 0x10219d80
+3 r 0x200009c0
+4 w 0x20001940
+5 r 0x1050e2c0
+6 r 0x1060ed80
+7 r 0x1070d480
+8 w 0x20002ec0
+9 w 0x109381c0
+10 r 0x10a05a00
+11 r 0x10b27f40
+12 r 0x10c2d500
+13 r 0x10d14900
+14 w 0x10e01d40
+15 w 0x10f0f840
+0 w 0x1003c280
+1 r 0x10101e80
+2 r 0x1021b300
+3 r 0x1030b1c0
+4 r 0x1040b440
+5 r 0x1052c900
+6 r 0x1060dd80
+7 r 0x1073d4c0
+8 r 0x1082dc40
+9 r 0x10903a80
+10 r 0x10a28180
+11 w 0x10b08780
+12 r 0x10c31b80
+13 w 0x10d04a00
+14 r 0x10e1b4c0
+15 r 0x10f04a80
+0 r 0x10031a40
+1 r 0x1012dd40
+2 r 0x10223ec0
+3 r 0x1032a400
+4 r 0x10424f80
+5 r 0x1053afc0
+6 w 0x1061e100
+7 r 0x1071df40
+8 r 0x10827500
+9 w 0x20001440
+10 r 0x10a3cec0
+11 r 0x10b1f6c0
+12 r 0x10c15480
+13 w 0x10d3ae40
+14 r 0x10e1b200
+15 r 0x10f0ab00
+0 r 0x10036140
+1 r 0x1013eb80
+2 r 0x20002a40
+3 w 0x200031c0
+4 r 0x10416580
+5 r 0x20001640
+6 r 0x106261c0
+7 w 0x10717040
+8 r 0x1082bcc0
+9 r 0x1092b440
+10 r 0x10a28d00
+11 r 0x10b112c0
+12 r 0x10c22800
+13 r 0x10d12100
+14 r 0x10e15240
+15 w 0x10f088c0
+0 r 0x1001bb80
+1 w 0x1012fb80
+2 r 0x10206380
+3 w 0x10337d40
+4 r 0x10435500
+5 r 0x10517980
+6 r 0x106286c0
+7 w 0x107070c0
+8 r 0x20000340
+9 w 0x10921b00
+10 r 0x10a11300
+11 w 0x20001ec0
+12 w 0x10c0cfc0
+13 w 0x20003e00
+14 r 0x20003300
+15 r 0x10f3b680
+0 w 0x1003b5c0
+1 w 0x20001680
+2 r 0x10208380
+3 w 0x10336040
+4 w 0x20003cc0
+5 r 0x10535fc0
+6 r 0x10603a00
+7 w 0x10715d00
+8 r 0x1082ec80
+9 w 0x10905a80
+10 w 0x10a3f7c0
+11 r 0x10b2c740
+12 r 0x20000380
+13 r 0x10d04600
+14 r 0x10e1d800
+15 r 0x10f15c80
+0 r 0x10027580
+1 r 0x10107d40
+2 r 0x1023f5c0
+3 w 0x200039c0
+4 w 0x1042cfc0
+5 r 0x10502840
+6 w 0x1062b7c0
+7 w 0x20002ec0
+8 r 0x10809b40
+9 w 0x10906b40
+10 w 0x10a1a3c0
+11 r 0x20001ec0
+12 r 0x10c3de40
+13 r 0x20000740
+14 r 0x10e17280
+15 r 0x10f22a40
+0 r 0x10036c80
+1 w 0x20001140
+2 r 0x20002400
+3 r 0x20002b40
+4 w 0x10413840
+5 r 0x10501040
+6 r 0x10621dc0
+7 r 0x1073bd00
+8 r 0x1081d580
+9 r 0x109255c0
+10 w 0x10a3d3c0
+11 r 0x10b11240
+12 w 0x10c02240
+13 r 0x10d13440
+14 r 0x20002280
+15 w 0x10f34940
+0 r 0x10023b80
+1 w 0x20003e40
+2 r 0x10236140
+3 w 0x10314740
+4 r 0x10406f80
+5 r 0x10521880
+6 r 0x1060b8c0
+7 r 0x20002140
+8 r 0x1080ce00
+9 r 0x20003640
+10 r 0x10a1c680
+11 r 0x10b29580
+12 w 0x200023c0
+13 r 0x10d239c0
+14 r 0x10e214c0
+15 w 0x20000e80
+0 r 0x10017700
+1 w 0x20001300
+2 w 0x1023f940
+3 r 0x1030fd80
+4 r 0x1041a100
+5 r 0x200020c0
+6 r 0x1062ce40
+7 w 0x107197c0
+8 r 0x10814fc0
+9 r 0x10906c00
+10 r 0x10a28d00
+11 r 0x10b3afc0
+12 r 0x10c16ac0
+13 w 0x10d2ed00
+14 r 0x10e16240
+15 w 0x10f14300
+0 w 0x20001700
+1 w 0x10124500
+2 r 0x10235100
+3 r 0x10332100
+4 r 0x1040ed40
+5 r 0x20002000
+6 w 0x10610940
+7 w 0x20001580
+8 w 0x20001280
+9 w 0x20001640
+10 r 0x10a10c80
+11 w 0x10b0dc00
+12 w 0x20000b80
+13 r 0x10d09600
+14 w 0x20000a40
+15 w 0x20001fc0
+0 r 0x10017480
+1 r 0x10118c80
+2 r 0x1023fb80
+3 w 0x1031c800
+4 w 0x1041b800
+5 r 0x10514f00
+6 r 0x106139c0
+7 r 0x10737300
+8 r 0x1080bc80
+9 r 0x20000bc0
+10 r 0x20002e40
+11 w 0x10b1d300
+12 r 0x10c08d00
+13 w 0x10d32040
+14 w 0x10e3d540
+15 w 0x200039c0
+0 r 0x20003b80
+1 r 0x1011ce80
+2 w 0x1021a9c0
+3 r 0x1030b140
+4 r 0x10422800
+5 r 0x10501d00
+6 r 0x1061ac80
+7 w 0x10718bc0
+8 w 0x1081aec0
+9 r 0x10915680
+10 r 0x10a0c140
+11 r 0x10b29100
+12 r 0x10c010c0
+13 w 0x20001640
+14 r 0x10e20480
+15 r 0x10f204c0
+0 r 0x10030640
+1 w 0x200006c0
+2 r 0x1023fc40
+3 r 0x10310940
+4 w 0x10438680
+5 r 0x1050dbc0
+6 w 0x1062f140
+7 r 0x1070cfc0
+8 w 0x108168c0
+9 r 0x20001d00
+10 r 0x10a2b300
+11 r 0x20001b00
+12 r 0x10c35540
+13 w 0x10d35f80
+14 r 0x200035c0
+15 r 0x10f19700
+0 r 0x1002ee80
+1 w 0x1010ebc0
+2 r 0x10209300
+3 r 0x10322280
+4 r 0x20002d80
+5 r 0x10512440
+6 r 0x1060eb80
+7 r 0x20001680
+8 w 0x1082e140
+9 r 0x20002540
+10 w 0x10a0eb40
+11 r 0x10b1a380
+12 r 0x10c38600
+13 r 0x20000e00
+14 w 0x10e057c0
+15 w 0x20002640
+0 r 0x1003c6c0
+1 r 0x10124e40
+2 r 0x1020ec80
+3 r 0x10318800
+4 w 0x10424180
+5 r 0x10502900
+6 r 0x106340c0
+7 r 0x10728b40
+8 r 0x10800880
+9 r 0x1091a9c0
+10 w 0x10a3cd00
+11 r 0x10b29600
+12 r 0x10c20d40
+13 r 0x10d14400
+14 r 0x10e39700
+15 r 0x10f38180
+0 r 0x10039600
+1 r 0x1010d940
+2 r 0x1020a640
+3 w 0x20000980
+4 r 0x1040d180
+5 w 0x105093c0
+6 r 0x1062ed80
+7 r 0x10733340
+8 r 0x20003080
+9 r 0x1090dfc0
+10 r 0x10a27d80
+11 r 0x10b04880
+12 w 0x200019c0
+13 r 0x20002f40
+14 r 0x10e20700
+15 w 0x10f0e840
+0 r 0x10006c00
+1 w 0x20001100
+2 w 0x20000880
+3 r 0x10312dc0
+4 w 0x20002700
+5 w 0x10533280
+6 r 0x20001fc0
+7 r 0x107154c0
+8 r 0x10806900
+9 r 0x1090e4c0
+10 r 0x10a067c0
+11 r 0x10b08500
+12 r 0x10c2f600
+13 w 0x10d23440
+14 r 0x10e2bc00
+15 r 0x10f3a780
+0 r 0x10028740
+1 w 0x10129f00
+2 w 0x20002f00
+3 w 0x10305cc0
+4 r 0x1042bec0
+5 r 0x1053a6c0
+6 r 0x10624900
+7 w 0x10736d00
+8 r 0x1082f440
+9 r 0x10926700
+10 r 0x20001840
+11 r 0x10b01b00
+12 w 0x10c2e300
+13 r 0x20002600
+14 w 0x20002500
+15 r 0x10f00a80
+0 r 0x1000adc0
+1 r 0x10122ac0
+2 w 0x200019c0
+3 r 0x103159c0
+4 w 0x104383c0
+5 r 0x10519980
+6 r 0x10636000
+7 r 0x1070fe80
+8 w 0x1083d980
+9 r 0x10930ec0
+10 r 0x10a2d840
+11 w 0x10b01800
+12 r 0x10c26280
+13 w 0x20003140
+14 r 0x10e19a80
+15 w 0x10f01480
+0 r 0x10000c40
+1 r 0x10116580
+2 w 0x1023c5c0
+3 w 0x103150c0
+4 r 0x104049c0
+5 r 0x1052e4c0
+6 w 0x200025c0
+7 w 0x107247c0
+8 r 0x20001a00
+9 r 0x1090b880
+10 w 0x10a09d80
+11 r 0x10b27600
+12 r 0x10c38e80
+13 r 0x10d10300
+14 w 0x10e10900
+15 r 0x10f38380
+0 r 0x20000740
+1 r 0x10122700
+2 w 0x10203380
+3 r 0x10336080
+4 r 0x10406300
+5 r 0x20000140
+6 w 0x10625040
+7 r 0x10737f80
+8 r 0x10815380
+9 r 0x10931d40
+10 r 0x10a05ec0
+11 r 0x10b0f180
+12 w 0x10c08b40
+13 r 0x10d38640
+14 r 0x10e17c80
+15 r 0x10f188c0
+0 w 0x20001b00
+1 w 0x1011c040
+2 r 0x200013c0
+3 r 0x1032ec80
+4 w 0x1043d1c0
+5 r 0x1053aa00
+6 r 0x1062c640
+7 r 0x1070c080
+8 w 0x20003400
+9 w 0x1090e980
+10 r 0x10a0d340
+11 w 0x10b163c0
+12 r 0x20003a00
+13 w 0x10d3a640
+14 r 0x10e379c0
+15 r 0x10f058c0
+0 r 0x10028540
+1 r 0x200016c0
+2 r 0x1021e700
+3 r 0x1030f400
+4 w 0x200032c0
+5 r 0x20000b00
+6 w 0x20002540
+7 w 0x20000fc0
+8 r 0x1082e640
+9 r 0x200037c0
+10 r 0x10a2ac80
+11 r 0x20000c80
+12 r 0x10c27a80
+13 r 0x10d019c0
+14 r 0x10e32980
+15 r 0x10f3a040
+0 r 0x1002eb80
+1 r 0x10124080
+2 w 0x1023d7c0
+3 w 0x10330fc0
+4 r 0x104317c0
+5 r 0x105106c0
+6 r 0x10631a80
+7 w 0x1070c780
+8 r 0x10810300
+9 r 0x20001380
+10 w 0x10a2c140
+11 r 0x10b18d40
+12 w 0x10c12880
+13 r 0x10d23700
+14 r 0x10e0e780
+15 r 0x10f2ab80
+0 r 0x1001a8c0
+1 r 0x1012c7c0
+2 r 0x10212980
+3 w 0x1030ce80
+4 w 0x1042c740
+5 r 0x10535b00
+6 w 0x10624600
+7 r 0x10729440
+8 r 0x20000280
+9 r 0x10919dc0
+10 r 0x10a39580
+11 r 0x10b39240
+12 r 0x10c24540
+13 w 0x10d250c0
+14 w 0x10e1d8c0
+15 r 0x10f28540
+0 r 0x1000a340
+1 w 0x200030c0
+2 r 0x1023b7c0
+3 w 0x20000e40
+4 w 0x10410fc0
+5 r 0x1053f740
+6 w 0x1063ae80
+7 r 0x10734340
+8 w 0x20003a00
+9 r 0x10907c00
+10 r 0x10a1fb80
+11 r 0x20001c80
+12 w 0x10c10680
+13 r 0x10d2e3c0
+14 r 0x10e322c0
+15 r 0x10f19e80
+0 w 0x20003580
+1 r 0x1011c480
+2 r 0x20000880
+3 w 0x10310f00
+4 r 0x1043c940
+5 r 0x10529300
+6 r 0x10620a80
+7 w 0x10708ac0
+8 w 0x1083b540
+9 r 0x1093a880
+10 r 0x10a13300
+11 r 0x10b04dc0
+12 r 0x10c3b080
+13 r 0x10d04dc0
+14 w 0x10e11d00
+15 r 0x10f32ec0
+0 w 0x200023c0
+1 r 0x10137440
+2 r 0x20002d00
+3 w 0x20002a80
+4 r 0x104369c0
+5 r 0x1053da00
+6 r 0x10621a80
+7 r 0x1072d080
+8 r 0x10836e00
+9 w 0x109249c0
+10 r 0x10a0dc40
+11 w 0x20003940
+12 r 0x10c384c0
+13 r 0x20000300
+14 r 0x10e17180
+15 r 0x10f14400
+0 w 0x10028380
+1 r 0x10137ac0
+2 r 0x20002700
+3 r 0x1031fc40
+4 r 0x10423a00
+5 w 0x10501080
+6 r 0x1063b100
+7 r 0x20003740
+8 r 0x10819f00
+9 w 0x1093ee80
+10 r 0x10a04e80
+11 w 0x20002080
+12 r 0x20002d00
+13 r 0x10d2f140
+14 w 0x10e03d40
+15 r 0x10f23480
+0 r 0x20000300
+1 w 0x20001b40
+2 r 0x10210ac0
+3 r 0x103348c0
+4 w 0x200026c0
+5 r 0x1053ec80
+6 r 0x200013c0
+7 r 0x1070fbc0
+8 r 0x20002e80
+9 w 0x1091ea80
+10 r 0x20001900
+11 r 0x10b3afc0
+12 r 0x10c11c80
+13 w 0x10d26800
+14 r 0x10e24200
+15 r 0x10f01440
+0 r 0x10037200
+1 w 0x1011c600
+2 r 0x10210540
+3 w 0x1032a700
+4 r 0x1041fc00
+5 r 0x20003040
+6 r 0x1061ee40
+7 r 0x1072e840
+8 w 0x10833600
+9 w 0x20001640
+10 w 0x10a0e480
+11 w 0x10b2da00
+12 w 0x20000cc0
+13 r 0x10d31940
+14 r 0x10e3ac00
+15 w 0x10f34700
+0 r 0x10034300
+1 w 0x1011d300
+2 r 0x10222700
+3 r 0x1031ddc0
+4 w 0x10413600
+5 w 0x10518980
+6 w 0x10632640
+7 r 0x10705400
+8 r 0x20000580
+9 r 0x20002880
+10 r 0x10a08240
+11 w 0x10b1adc0
+12 r 0x20001c40
+13 r 0x10d0ca80
+14 r 0x10e2f1c0
+15 r 0x10f3a340
+0 r 0x20001a80
+1 r 0x1010fc00
+2 r 0x20000340
+3 r 0x20002080
+4 w 0x104212c0
+5 r 0x1052af00
+6 r 0x10633280
+7 w 0x20000880
+8 r 0x108103c0
+9 r 0x1091d040
+10 w 0x10a1b480
+11 w 0x10b0b680
+12 r 0x10c072c0
+13 r 0x10d18d80
+14 r 0x10e35300
+15 r 0x10f1b340
+0 r 0x20000c40
+1 r 0x101337c0
+2 w 0x10227300
+3 r 0x10300500
+4 w 0x1040d400
+5 r 0x1052cb80
+6 r 0x10625b80
+7 w 0x20002d40
+8 r 0x10825a80
+9 w 0x10927400
+10 w 0x10a09d40
+11 r 0x10b26a40
+12 r 0x10c24b00
+13 w 0x10d334c0
+14 r 0x10e11a40
+15 r 0x10f00200
+0 w 0x1003a380
+1 w 0x10106d00
+2 w 0x20000440
+3 r 0x1030ccc0
+4 r 0x1042ca80
+5 r 0x105100c0
+6 r 0x10603080
+7 r 0x1073ed80
+8 r 0x20003a00
+9 w 0x10917740
+10 r 0x10a0d800
+11 r 0x10b038c0
+12 r 0x20002a00
+13 r 0x10d28e40
+14 r 0x10e25440
+15 w 0x10f20a00
+0 r 0x10003000
+1 r 0x1013e6c0
+2 r 0x1021c600
+3 r 0x10328e80
+4 w 0x20001c80
+5 r 0x20002080
+6 r 0x10621e00
+7 w 0x107308c0
+8 w 0x10811bc0
+9 r 0x1092ef40
+10 r 0x10a1ec40
+11 w 0x20002840
+12 r 0x10c32940
+13 w 0x10d3c600
+14 w 0x10e2fbc0
+15 w 0x10f00680
+0 r 0x20000400
+1 w 0x20003880
+2 r 0x20000940
+3 r 0x200036c0
+4 r 0x10419f00
+5 w 0x20003880
+6 w 0x1060ba40
+7 r 0x10734040
+8 r 0x1080f140
+9 r 0x10907440
+10 r 0x10a30c00
+11 r 0x10b3c380
+12 w 0x20002c40
+13 w 0x10d19900
+14 r 0x20000f80
+15 r 0x10f23980
+0 w 0x10004780
+1 r 0x10134580
+2 w 0x20003f80
+3 w 0x10314240
+4 r 0x1040eb00
+5 r 0x10532b00
+6 r 0x10604d40
+7 w 0x20001f80
+8 r 0x10814540
+9 r 0x10909e00
+10 r 0x10a03280
+11 r 0x10b1d340
+12 r 0x10c3d540
+13 r 0x200027c0
+14 r 0x10e11940
+15 r 0x20003180
+0 r 0x10005b00
+1 w 0x10101b40
+2 r 0x10215880
+3 r 0x10334ac0
+4 r 0x10404540
+5 r 0x10504e40
+6 r 0x10625400
+7 r 0x1072fec0
+8 w 0x108395c0
+9 w 0x20001dc0
+10 r 0x10a2c780
+11 r 0x10b1bd40
+12 r 0x20000980
+13 r 0x10d0c900
+14 r 0x10e0be40
+15 w 0x10f06100
+0 w 0x10023400
+1 w 0x10105a80
+2 w 0x20001600
+3 r 0x1031dc40
+4 w 0x1041d840
+5 r 0x20001240
+6 r 0x106231c0
+7 r 0x1071a3c0
+8 w 0x1083b6c0
+9 r 0x10930c40
+10 r 0x20000580
+11 r 0x10b29940
+12 r 0x10c1c1c0
+13 r 0x10d07280
+14 r 0x10e06d40
+15 w 0x10f2d480
+0 w 0x10034d40
+1 r 0x20001480
+2 w 0x1020a8c0
+3 w 0x20002440
+4 w 0x200038c0
+5 r 0x20003e40
+6 r 0x20001100
+7 r 0x10714900
+8 r 0x10804bc0
+9 r 0x10913600
+10 r 0x10a38500
+11 w 0x10b13400
+12 w 0x10c0a040
+13 w 0x10d1d640
+14 r 0x10e1d700
+15 w 0x10f15f80
+0 r 0x20001d40
+1 r 0x101340c0
+2 r 0x10214140
+3 w 0x103036c0
+4 r 0x10423ac0
+5 r 0x1051dec0
+6 w 0x20000780
+7 r 0x1070d4c0
+8 w 0x10824700
+9 w 0x109245c0
+10 r 0x10a15100
+11 r 0x10b29c00
+12 r 0x10c0cb40
+13 r 0x200001c0
+14 r 0x20003000
+15 r 0x10f30580
+0 r 0x1003f280
+1 w 0x1011f9c0
+2 r 0x20001140
+3 w 0x20003840
+4 r 0x10413e00
+5 w 0x1053f0c0
+6 r 0x10618740
+7 r 0x10709b40
+8 r 0x10829580
+9 w 0x10910f80
+10 w 0x10a0f7c0
+11 w 0x20000480
+12 w 0x10c0b900
+13 r 0x10d38400
+14 w 0x10e29280
+15 r 0x10f32080
+0 w 0x200030c0
+1 w 0x20000ec0
+2 r 0x10207580
+3 r 0x1030d180
+4 r 0x1042b2c0
+5 r 0x200030c0
+6 r 0x20000380
+7 w 0x107199c0
+8 r 0x10834380
+9 w 0x20000480
+10 r 0x10a10100
+11 r 0x20000ec0
+12 r 0x10c18300
+13 w 0x10d063c0
+14 r 0x20000480
+15 r 0x10f0e900
+0 r 0x1003a940
+1 r 0x10107b40
+2 r 0x10203640
+3 r 0x1032cd00
+4 w 0x20000000
+5 w 0x20002b40
+6 r 0x1063ed80
+7 r 0x10723c80
+8 r 0x1081e3c0
+9 r 0x10918200
+10 r 0x10a06d00
+11 w 0x10b2d0c0
+12 r 0x10c28140
+13 r 0x10d14340
+14 r 0x10e14a80
+15 r 0x200033c0
+0 r 0x1003b140
+1 r 0x101115c0
+2 r 0x10202f40
+3 w 0x20002780
+4 r 0x10432440
+5 r 0x10513f00
+6 r 0x10608e00
+7 r 0x10701980
+8 r 0x10833880
+9 w 0x20000480
+10 r 0x10a27040
+11 r 0x10b074c0
+12 r 0x10c0ab40
+13 r 0x10d16a80
+14 r 0x10e13f40
+15 w 0x20001f00
+0 w 0x10011700
+1 w 0x10134ac0
+2 w 0x1021ad80
+3 w 0x1031f140
+4 w 0x1042b200
+5 w 0x10525880
+6 w 0x1061ed80
+7 w 0x20002600
+8 r 0x10836140
+9 r 0x10928b80
+10 r 0x10a05400
+11 r 0x10b16900
+12 r 0x10c36f80
+13 r 0x10d1fa80
+14 r 0x20000540
+15 r 0x10f09b00
+0 r 0x10027680
+1 r 0x101353c0
+2 w 0x102288c0
+3 w 0x1033e680
+4 r 0x10405c40
+5 r 0x20002540
+6 r 0x10623f40
+7 r 0x10709540
+8 w 0x10803640
+9 w 0x10930e40
+10 w 0x10a27a80
+11 r 0x10b39200
+12 w 0x20002280
+13 w 0x10d21d80
+14 r 0x10e2bb80
+15 r 0x10f10b40
+0 r 0x10029040
+1 w 0x1010cd00
+2 r 0x10231b00
+3 w 0x20003800
+4 w 0x10420000
+5 r 0x105299c0
+6 r 0x1060cd40
+7 w 0x20003dc0
+8 r 0x20000c40
+9 r 0x1090eb80
+10 r 0x10a2e280
+11 r 0x10b21ac0
+12 r 0x10c0b100
+13 r 0x10d21380
+14 w 0x10e21700
+15 w 0x10f03e80
+0 r 0x1002bd80
+1 r 0x10121a00
+2 r 0x10209a80
+3 r 0x1030cc40
+4 r 0x1043bac0
+5 r 0x10539980
+6 r 0x106150c0
+7 w 0x10734f80
+8 w 0x108162c0
+9 r 0x10924dc0
+10 r 0x20002900
+11 r 0x10b14e40
+12 r 0x10c00340
+13 w 0x10d39080
+14 w 0x10e35080
+15 r 0x10f1d0c0
+0 w 0x200010c0
+1 r 0x10107880
+2 w 0x200004c0
+3 r 0x10312180
+4 r 0x200034c0
+5 r 0x10514200
+6 r 0x1062ae00
+7 w 0x10723740
+8 r 0x1080d340
+9 w 0x20001300
+10 r 0x10a0dd40
+11 r 0x10b3f200
+12 r 0x10c18cc0
+13 r 0x10d297c0
+14 r 0x10e204c0
+15 r 0x10f06a00
+0 r 0x1003f980
+1 r 0x20001900
+2 w 0x10230100
+3 r 0x10330a40
+4 r 0x104245c0
+5 r 0x105382c0
+6 r 0x10616340
+7 r 0x10712600
+8 r 0x10825240
+9 w 0x10919f40
+10 r 0x10a2a9c0
+11 r 0x10b03540
+12 r 0x20000b40
+13 r 0x200018c0
+14 r 0x10e071c0
+15 r 0x10f03fc0
+0 w 0x1001ad80
+1 r 0x20000940
+2 r 0x102367c0
+3 r 0x20001ac0
+4 r 0x10439100
+5 w 0x1051f940
+6 r 0x10612d00
+7 r 0x1070ad00
+8 r 0x10806080
+9 r 0x1090d700
+10 w 0x10a3df80
+11 r 0x10b0e880
+12 r 0x10c18480
+13 w 0x20002dc0
+14 w 0x10e3b800
+15 r 0x10f1f5c0
+0 r 0x1003c3c0
+1 r 0x10110180
+2 r 0x20000b00
+3 w 0x10303040
+4 w 0x10401a80
+5 w 0x1052c680
+6 r 0x1062dd40
+7 r 0x1071f380
+8 r 0x20001280
+9 r 0x1090c700
+10 w 0x10a15380
+11 r 0x10b32f80
+12 w 0x10c11340
+13 w 0x10d1d880
+14 r 0x10e39840
+15 r 0x10f0d140
+0 r 0x1000ba00
+1 w 0x20003f80
+2 w 0x1020b340
+3 r 0x1032d0c0
+4 w 0x1042c0c0
+5 w 0x1053f580
+6 r 0x10634440
+7 r 0x20003f80
+8 w 0x108364c0
+9 w 0x10901100
+10 w 0x10a12240
+11 r 0x10b3e4c0
+12 w 0x10c16b00
+13 r 0x10d21780
+14 r 0x10e27e80
+15 r 0x10f01680
+0 r 0x1000ba00
+1 r 0x1013d5c0
+2 r 0x10217500
+3 r 0x10307a40
+4 r 0x10411300
+5 r 0x20000600
+6 r 0x200004c0
+7 r 0x10738fc0
+8 r 0x1081a640
+9 w 0x20001a00
+10 w 0x10a07d00
+11 w 0x20003ac0
+12 r 0x20001a00
+13 w 0x10d3eac0
+14 r 0x10e3dd00
+15 r 0x10f06480
+0 r 0x10001bc0
+1 r 0x10106380
+2 r 0x1022a640
+3 w 0x10303940
+4 w 0x10402e00
+5 w 0x10522c80
+6 r 0x10621300
+7 w 0x20003080
+8 r 0x1082fd80
+9 r 0x1091f440
+10 r 0x20000bc0
+11 r 0x20000c40
+12 w 0x10c1dc80
+13 w 0x10d18a80
+14 r 0x10e1ba40
+15 w 0x10f243c0
+0 r 0x100055c0
+1 w 0x10131300
+2 r 0x1020cc40
+3 r 0x1031fc00
+4 w 0x20002c00
+5 r 0x10503f80
+6 r 0x10623bc0
+7 r 0x10719380
+8 r 0x10804780
+9 r 0x1091b400
+10 w 0x10a17ec0
+11 r 0x10b3f740
+12 r 0x10c2b3c0
+13 r 0x10d37580
+14 r 0x20001bc0
+15 r 0x10f06a40
+0 r 0x10012540
+1 r 0x1011f0c0
+2 r 0x10208ec0
+3 w 0x20002040
+4 r 0x1043c8c0
+5 r 0x10519080
+6 r 0x10605400
+7 r 0x107244c0
+8 r 0x10836ec0
+9 r 0x10936b00
+10 w 0x10a197c0
+11 r 0x20002a80
+12 r 0x10c1da00
+13 r 0x10d2fcc0
+14 r 0x10e0cb80
+15 r 0x10f0e900
+0 r 0x100131c0
+1 r 0x1011eac0
+2 r 0x20000200
+3 r 0x10326700
+4 w 0x1041ff80
+5 r 0x20003380
+6 r 0x1061bfc0
+7 r 0x107351c0
+8 w 0x108304c0
+9 r 0x10936c00
+10 r 0x10a099c0
+11 r 0x10b11880
+12 w 0x10c14540
+13 w 0x10d23cc0
+14 r 0x10e19400
+15 r 0x10f22f00
+0 w 0x10013300
+1 r 0x1013eac0
+2 r 0x1023d080
+3 r 0x10325a40
+4 r 0x20002b80
+5 r 0x10525cc0
+6 r 0x1062abc0
+7 w 0x20003e00
+8 w 0x1081ab40
+9 r 0x1093ebc0
+10 r 0x10a3b8c0
+11 r 0x10b280c0
+12 r 0x10c30500
+13 r 0x10d2ea80
+14 r 0x10e35d80
+15 r 0x10f0a740
+0 r 0x1003d400
+1 w 0x1011ee40
+2 w 0x10201780
+3 w 0x1033ffc0
+4 r 0x10430940
+5 w 0x20001e40
+6 w 0x20002840
+7 r 0x10737840
+8 r 0x10832340
+9 r 0x10902400
+10 r 0x10a3a000
+11 r 0x10b1f140
+12 w 0x10c04540
+13 r 0x10d2d240
+14 r 0x10e1e7c0
+15 r 0x20002140
+0 r 0x10024140
+1 r 0x10130540
+2 r 0x10238340
+3 w 0x1031c1c0
+4 r 0x10436d80
+5 r 0x10522e40
+6 r 0x10636440
+7 w 0x200023c0
+8 w 0x10835680
+9 r 0x10906ec0
+10 w 0x200002c0
+11 r 0x10b25c80
+12 r 0x20003f00
+13 w 0x200035c0
+14 w 0x10e384c0
+15 r 0x10f0da40
+0 r 0x10038b80
+1 r 0x10113dc0
+2 w 0x20002300
+3 w 0x20001d40
+4 r 0x10410300
+5 r 0x10528600
+6 r 0x106105c0
+7 r 0x10701100
+8 r 0x1082cbc0
+9 w 0x20003dc0
+10 r 0x10a23ec0
+11 w 0x10b39a00
+12 r 0x10c2d7c0
+13 w 0x10d2a740
+14 w 0x10e33f80
+15 r 0x10f27980
+0 w 0x10035d40
+1 r 0x101279c0
+2 r 0x1022ab00
+3 r 0x20003640
+4 w 0x20001d40
+5 w 0x10538840
+6 w 0x10607040
+7 r 0x1072a400
+8 r 0x1081e580
+9 r 0x109179c0
+10 r 0x10a07e00
+11 r 0x10b0e480
+12 r 0x10c39100
+13 w 0x10d08f80
+14 w 0x10e05d00
+15 r 0x10f11340
+0 r 0x20000380
+1 w 0x10135480
+2 w 0x1023c880
+3 r 0x10308e00
+4 r 0x10436d00
+5 r 0x20002a40
+6 r 0x10638bc0
+7 r 0x1073e140
+8 r 0x10820780
+9 w 0x200008c0
+10 r 0x10a07540
+11 r 0x10b1d840
+12 r 0x10c08140
+13 r 0x10d016c0
+14 r 0x10e3eec0
+15 r 0x10f19240
+0 r 0x10022bc0
+1 r 0x101213c0
+2 r 0x1020e8c0
+3 r 0x1031bc00
+4 w 0x10400340
+5 w 0x20000600
+6 r 0x1062ea40
+7 r 0x1072ca00
+8 w 0x10802d80
+9 r 0x1091ed40
+10 w 0x10a21500
+11 r 0x10b160c0
+12 r 0x10c1c540
+13 r 0x10d11f40
+14 w 0x10e27000
+15 r 0x10f33a00
+0 w 0x20002740
+1 r 0x101021c0
+2 r 0x102015c0
+3 w 0x10327380
+4 w 0x1043a200
+5 w 0x20000f00
+6 r 0x200026c0
+7 r 0x20003740
+8 w 0x20000080
+9 r 0x1092ee80
+10 w 0x20000a40
+11 r 0x20003900
+12 r 0x10c2e100
+13 r 0x10d19ec0
+14 r 0x10e37780
+15 r 0x10f3b980
+0 r 0x10006a40
+1 r 0x20003440
+2 r 0x1022cf40
+3 w 0x10327f40
+4 r 0x1040a580
+5 w 0x105236c0
+6 r 0x1062a2c0
+7 r 0x107268c0
+8 w 0x10832dc0
+9 r 0x109146c0
+10 w 0x10a2fec0
+11 w 0x10b10e00
+12 w 0x10c37f00
+13 w 0x10d3bd00
+14 r 0x10e05100
+15 r 0x10f34380
+0 r 0x100133c0
+1 r 0x1013d5c0
+2 w 0x10224280
+3 w 0x1033f4c0
+4 r 0x10416b80
+5 r 0x20002040
+6 r 0x1062cb40
+7 w 0x200016c0
+8 r 0x200001c0
+9 w 0x1093de40
+10 w 0x10a2df00
+11 r 0x10b2a800
+12 w 0x10c18e40
+13 w 0x10d03f40
+14 r 0x10e0eb80
+15 r 0x20003a00
+0 w 0x20001dc0
+1 r 0x10102600
+2 r 0x10201540
+3 r 0x10318880
+4 w 0x20001280
+5 r 0x105188c0
+6 w 0x200008c0
+7 r 0x1072ba00
+8 w 0x20001100
+9 r 0x1092f700
+10 r 0x10a1c040
+11 r 0x10b147c0
+12 r 0x10c24140
+13 r 0x10d15000
+14 r 0x10e1d100
+15 r 0x10f37880
+0 r 0x10035e00
+1 w 0x20000980
+2 r 0x1022b100
+3 r 0x1031e300
+4 r 0x10425ac0
+5 r 0x10534a80
+6 r 0x10600d40
+7 r 0x107363c0
+8 r 0x10831680
+9 w 0x109238c0
+10 r 0x10a23b00
+11 r 0x20000480
+12 w 0x200007c0
+13 w 0x20000b80
+14 r 0x20001140
+15 w 0x10f297c0
+0 r 0x10016680
+1 w 0x10116300
+2 r 0x10217dc0
+3 w 0x10322240
+4 w 0x20003fc0
+5 r 0x10539ac0
+6 r 0x10621100
+7 w 0x10728a40
+8 r 0x1083ff00
+9 r 0x10937c40
+10 w 0x10a358c0
+11 r 0x10b38b80
+12 w 0x10c055c0
+13 r 0x10d25700
+14 r 0x10e2f100
+15 r 0x10f11180
+0 r 0x10030cc0
+1 r 0x10125300
+2 w 0x1023bd00
+3 r 0x10335600
+4 w 0x200018c0
+5 r 0x10518d80
+6 r 0x10621200
+7 r 0x10714e40
+8 r 0x1082a340
+9 w 0x10934940
+10 r 0x10a3d700
+11 r 0x10b04ac0
+12 w 0x10c36300
+13 r 0x10d3e580
+14 w 0x10e0c6c0
+15 w 0x10f1e880
+0 r 0x10005280
+1 w 0x10116180
+2 r 0x10227640
+3 r 0x10314740
+4 w 0x1041b740
+5 r 0x105244c0
+6 r 0x10620200
+7 w 0x1071ec00
+8 r 0x10837400
+9 r 0x10922880
+10 w 0x10a0a840
+11 w 0x10b35540
+12 w 0x20000500
+13 w 0x10d34f80
+14 r 0x10e17c80
+15 w 0x10f07640
+0 w 0x1001cf00
+1 r 0x20000300
+2 r 0x10228fc0
+3 r 0x1032fd40
+4 r 0x1042d540
+5 r 0x105296c0
+6 r 0x10631280
+7 r 0x1073c1c0
+8 r 0x10803540
+9 r 0x1093fa80
+10 r 0x10a25180
+11 r 0x10b2e580
+12 w 0x10c29f40
+13 r 0x10d29540
+14 r 0x200012c0
+15 w 0x20001400
+0 w 0x20003d00
+1 r 0x1013c880
+2 w 0x10231980
+3 w 0x10317d80
+4 r 0x1043abc0
+5 r 0x10520d40
+6 w 0x200001c0
+7 r 0x1071f2c0
+8 w 0x10837040
+9 r 0x10935800
+10 w 0x10a26980
+11 w 0x10b36340
+12 r 0x10c3f200
+13 w 0x200033c0
+14 r 0x10e0bc40
+15 r 0x10f27c40
+0 w 0x10007140
+1 r 0x10127140
+2 r 0x10227c80
+3 w 0x10338040
+4 r 0x104161c0
+5 r 0x1050e240
+6 r 0x106149c0
+7 r 0x10706780
+8 r 0x1080d180
+9 r 0x10915700
+10 r 0x10a21480
+11 r 0x200011c0
+12 r 0x10c2ea40
+13 w 0x10d04680
+14 r 0x10e1d740
+15 r 0x10f3b580
+0 w 0x20002480
+1 r 0x10103440
+2 w 0x10233800
+3 r 0x1031c980
+4 r 0x1043eb00
+5 w 0x20002e80
+6 r 0x10613880
+7 r 0x10737b00
+8 r 0x108342c0
+9 w 0x10906340
+10 r 0x20000a80
+11 w 0x10b30200
+12 w 0x10c2c1c0
+13 r 0x10d2b2c0
+14 r 0x10e3bdc0
+15 r 0x10f2fd40
+0 w 0x20003c40
+1 r 0x10117600
+2 r 0x10231f80
+3 r 0x10306200
+4 r 0x10430b00
+5 w 0x10514680
+6 r 0x20000680
+7 r 0x1070f080
+8 w 0x1081a040
+9 r 0x10924900
+10 w 0x10a30b40
+11 w 0x10b39500
+12 r 0x10c18340
+13 w 0x10d03e40
+14 r 0x10e27a00
+15 r 0x10f2a880
+0 r 0x10028d40
+1 r 0x1013e7c0
+2 r 0x10235f80
+3 r 0x10309a40
+4 r 0x10409200
+5 r 0x10533580
+6 r 0x10634f00
+7 w 0x107340c0
+8 r 0x10821a40
+9 r 0x20003ec0
+10 r 0x10a20280
+11 w 0x10b3b180
+12 r 0x10c1a000
+13 r 0x10d07280
+14 r 0x10e1cc00
+15 r 0x10f21500
+0 r 0x100272c0
+1 w 0x101335c0
+2 r 0x1021dec0
+3 w 0x1032f380
+4 w 0x10411940
+5 r 0x10539b00
+6 w 0x200021c0
+7 w 0x1072b1c0
+8 r 0x10815500
+9 r 0x1090a180
+10 r 0x10a0be00
+11 w 0x10b0fc80
+12 r 0x10c2fe80
+13 r 0x10d24240
+14 r 0x10e03d40
+15 r 0x10f07a00
+0 r 0x10004440
+1 r 0x10136d80
+2 r 0x20001400
+3 r 0x10329a80
+4 r 0x1041b700
+5 r 0x1053b180
+6 r 0x10631040
+7 r 0x1072e4c0
+8 r 0x200007c0
+9 w 0x10935a40
+10 r 0x10a00fc0
+11 w 0x20003f40
+12 r 0x10c2cf40
+13 r 0x20000980
+14 w 0x10e24ec0
+15 r 0x10f34a00
+0 r 0x10009400
+1 r 0x200031c0
+2 r 0x10218b40
+3 r 0x20003cc0
+4 r 0x200025c0
+5 r 0x10535180
+6 r 0x1062e4c0
+7 r 0x1070a100
+8 r 0x10820c80
+9 r 0x10931ec0
+10 r 0x10a3c5c0
+11 r 0x10b358c0
+12 r 0x10c01500
+13 r 0x10d11f40
+14 w 0x10e15240
+15 w 0x10f25e40
+0 w 0x10022380
+1 w 0x20000140
+2 r 0x10213c40
+3 r 0x10338580
+4 r 0x104141c0
+5 r 0x10512400
+6 r 0x200035c0
+7 r 0x10735c40
+8 r 0x1081bc40
+9 w 0x1090cc40
+10 w 0x200031c0
+11 r 0x10b0e440
+12 w 0x20001140
+13 r 0x10d38a80
+14 w 0x10e25940
+15 w 0x20002900
+0 r 0x1003e7c0
+1 r 0x20002700
+2 r 0x1022c100
+3 r 0x20002440
+4 w 0x20003d00
+5 r 0x10530640
+6 r 0x1062e3c0
+7 w 0x10734700
+8 w 0x10814480
+9 r 0x109104c0
+10 w 0x10a28200
+11 r 0x20001dc0
+12 w 0x10c0cd00
+13 r 0x10d1bf00
+14 w 0x20003800
+15 r 0x10f338c0
+0 r 0x10034b80
+1 r 0x10112240
+2 r 0x10216640
+3 w 0x1033c5c0
+4 w 0x10426340
+5 r 0x10516640
+6 w 0x10619b00
+7 r 0x10709880
+8 r 0x10814840
+9 r 0x20000300
+10 w 0x10a152c0
+11 r 0x10b10bc0
+12 w 0x20002e00
+13 w 0x20001bc0
+14 r 0x10e30f40
+15 w 0x20002500
+0 r 0x1000cd40
+1 r 0x10109980
+2 r 0x10206680
+3 w 0x1030ebc0
+4 r 0x1042a8c0
+5 w 0x20000cc0
+6 r 0x10619080
+7 w 0x20001840
+8 r 0x10830c40
+9 w 0x10902c00
+10 r 0x10a1de00
+11 w 0x10b21f00
+12 r 0x10c0db80
+13 w 0x10d24e00
+14 w 0x10e12080
+15 r 0x10f03400
+0 w 0x1001a840
+1 r 0x1011acc0
+2 w 0x20001a40
+3 w 0x10318640
+4 w 0x20000240
+5 w 0x1053e880
+6 r 0x1063ef00
+7 r 0x10714f80
+8 w 0x20000180
+9 w 0x1093c240
+10 w 0x10a36240
+11 r 0x10b36880
+12 w 0x10c17700
+13 r 0x20003f00
+14 w 0x10e3a100
+15 r 0x10f367c0
+0 r 0x1002a4c0
+1 r 0x10108600
+2 r 0x1020b640
+3 w 0x1032e180
+4 w 0x20001940
+5 r 0x10526d80
+6 w 0x200019c0
+7 r 0x10707880
+8 r 0x10801e40
+9 r 0x109258c0
+10 r 0x10a30200
+11 w 0x10b27680
+12 w 0x10c3a180
+13 r 0x10d0b700
+14 w 0x10e1be80
+15 r 0x10f28b80
+0 w 0x20002000
+1 w 0x10126380
+2 r 0x20001240
+3 w 0x1033d040
+4 r 0x10411540
+5 w 0x1050c900
+6 r 0x10600300
+7 r 0x10714380
+8 r 0x1083d9c0
+9 r 0x10928f40
+10 w 0x200032c0
+11 r 0x10b153c0
+12 w 0x10c03380
+13 w 0x10d3a7c0
+14 r 0x10e3d140
+15 r 0x10f38080
+0 r 0x10022f80
+1 w 0x10122f80
+2 r 0x102025c0
+3 r 0x200031c0
+4 r 0x1040ea00
+5 r 0x1051a640
+6 w 0x1060b840
+7 r 0x200027c0
+8 w 0x20002080
+9 r 0x10937280
+10 w 0x10a23e80
+11 r 0x10b10f80
+12 r 0x20001ac0
+13 r 0x10d3fa40
+14 r 0x10e0c340
+15 w 0x10f2cd40
+0 r 0x10006580
+1 r 0x10123500
+2 w 0x20002dc0
+3 r 0x20001c00
+4 r 0x10432bc0
+5 w 0x1051e500
+6 r 0x20001a80
+7 r 0x10711680
+8 r 0x1083a040
+9 r 0x20002800
+10 r 0x10a04380
+11 w 0x200009c0
+12 w 0x20001dc0
+13 w 0x10d08280
+14 w 0x20002d00
+15 w 0x20002cc0
+0 w 0x1001ff80
+1 r 0x10115e00
+2 w 0x20001ac0
+3 w 0x1033d080
+4 r 0x1041ae80
+5 r 0x10501000
+6 w 0x10630b80
+7 w 0x107278c0
+8 w 0x1082bdc0
+9 w 0x10926b00
+10 r 0x10a3c300
+11 r 0x20001c80
+12 w 0x10c06940
+13 r 0x10d35ec0
+14 r 0x10e06f40
+15 r 0x10f267c0
+0 w 0x10001cc0
+1 w 0x20002880
+2 r 0x1021d200
+3 r 0x20001340
+4 r 0x1041ac40
+5 r 0x10534d00
+6 r 0x1060b0c0
+7 r 0x10721840
+8 w 0x20003a40
+9 r 0x10927b00
+10 r 0x10a2b900
+11 r 0x10b2e9c0
+12 r 0x10c204c0
+13 r 0x10d370c0
+14 r 0x10e3d1c0
+15 r 0x10f3e040
+0 r 0x10012d00
+1 r 0x10120b00
+2 r 0x10200cc0
+3 w 0x20001d40
+4 r 0x1043ed40
+5 r 0x1053cc40
+6 r 0x1063a840
+7 r 0x1071fe40
+8 r 0x10824080
+9 r 0x109100c0
+10 r 0x10a31440
+11 w 0x10b229c0
+12 w 0x10c07340
+13 r 0x10d32f00
+14 r 0x10e3e380
+15 w 0x10f08d80
+0 r 0x10019c00
+1 r 0x10126240
+2 r 0x10224ec0
+3 r 0x103342c0
+4 w 0x104156c0
+5 r 0x10508100
+6 r 0x106308c0
+7 r 0x1071c800
+8 r 0x10810580
+9 r 0x10934440
+10 w 0x200012c0
+11 r 0x10b3d740
+12 r 0x10c22880
+13 r 0x10d2c8c0
+14 w 0x10e343c0
+15 r 0x10f2e2c0
+0 r 0x1003c580
+1 w 0x200037c0
+2 r 0x10233a40
+3 r 0x103133c0
+4 r 0x1042bd80
+5 r 0x1052f7c0
+6 r 0x1062c040
+7 r 0x20002400
+8 r 0x10822280
+9 w 0x10909940
+10 w 0x10a1f1c0
+11 r 0x10b07d00
+12 w 0x20003b00
+13 r 0x10d07b80
+14 r 0x20003f40
+15 r 0x20000c80
+0 r 0x10037500
+1 w 0x10126000
+2 r 0x1023abc0
+3 r 0x10313fc0
+4 r 0x10414e00
+5 r 0x105156c0
+6 w 0x106306c0
+7 r 0x1073c300
+8 r 0x200011c0
+9 w 0x1092d000
+10 w 0x10a23700
+11 r 0x10b1f840
+12 w 0x10c2c480
+13 r 0x10d1c040
+14 w 0x10e23900
+15 w 0x10f13c40
+0 r 0x10020b00
+1 r 0x10133440
+2 r 0x10234340
+3 w 0x1032dc00
+4 r 0x10432780
+5 w 0x105175c0
+6 r 0x10630ac0
+7 r 0x1072ff00
+8 r 0x10806900
+9 w 0x10902180
+10 r 0x20001d40
+11 r 0x10b03e00
+12 r 0x10c14940
+13 w 0x200006c0
+14 w 0x10e3a4c0
+15 r 0x10f3b8c0
+0 r 0x1000b400
+1 w 0x10110b00
+2 r 0x102089c0
+3 r 0x20002bc0
+4 w 0x1043f5c0
+5 w 0x10522240
+6 r 0x20002500
+7 r 0x20002540
+8 r 0x1080f5c0
+9 r 0x1092cec0
+10 r 0x10a3d0c0
+11 w 0x10b3d180
+12 w 0x10c08180
+13 r 0x10d1ee80
+14 r 0x10e2b600
+15 r 0x20002800
+0 r 0x20002180
+1 r 0x10132380
+2 r 0x1023ef00
+3 r 0x20001d80
+4 w 0x10428d40
+5 w 0x10529480
+6 w 0x1063c240
+7 w 0x10726140
+8 r 0x20003b40
+9 r 0x1090e380
+10 r 0x10a0cd40
+11 r 0x10b30740
+12 r 0x10c10880
+13 r 0x10d35e80
+14 r 0x20001940
+15 r 0x10f3a980
+0 w 0x10014b80
+1 w 0x1012b880
+2 w 0x20003dc0
+3 r 0x10339180
+4 r 0x10425a00
+5 r 0x10522d40
+6 w 0x106222c0
+7 r 0x1072d5c0
+8 w 0x10813cc0
+9 r 0x10934b00
+10 r 0x200039c0
+11 w 0x10b399c0
+12 r 0x10c02bc0
+13 r 0x10d3d840
+14 r 0x10e26740
+15 w 0x10f2fec0
+0 w 0x20003e80
+1 w 0x1013c900
+2 r 0x10204bc0
+3 r 0x20003880
+4 r 0x10417c00
+5 r 0x10519cc0
+6 r 0x20001180
+7 r 0x10706ec0
+8 r 0x10831700
+9 r 0x10922a80
+10 r 0x10a1eb40
+11 w 0x10b22280
+12 r 0x10c1e5c0
+13 r 0x10d11840
+14 w 0x20000180
+15 r 0x20000140
+0 r 0x1002f200
+1 w 0x10124440
+2 w 0x102086c0
+3 r 0x20002980
+4 w 0x20003a80
+5 r 0x1050a440
+6 r 0x10609cc0
+7 r 0x10738500
+8 r 0x1081cd80
+9 r 0x10939a80
+10 r 0x10a16a00
+11 w 0x10b27e40
+12 r 0x10c113c0
+13 w 0x10d100c0
+14 w 0x10e08500
+15 r 0x10f29980
+0 w 0x1002ab40
+1 r 0x1011d840
+2 w 0x10200d80
+3 w 0x103275c0
+4 w 0x1041be80
+5 r 0x10532840
+6 r 0x106052c0
+7 w 0x10728440
+8 r 0x10809d80
+9 r 0x10917880
+10 r 0x10a1ff00
+11 r 0x10b25ac0
+12 r 0x20000380
+13 w 0x20001b80
+14 r 0x10e2f140
+15 r 0x10f3b140
+0 r 0x10030a40
+1 r 0x10102880
+2 w 0x20002f00
+3 r 0x1031f440
+4 r 0x10413b00
+5 r 0x1051f340
+6 w 0x200027c0
+7 w 0x1071a280
+8 r 0x10839740
+9 w 0x20003000
+10 r 0x10a3fe80
+11 r 0x10b34840
+12 w 0x20002f00
+13 r 0x10d34bc0
+14 r 0x10e2e040
+15 r 0x10f2cf40
+0 r 0x10006480
+1 r 0x10108040
+2 r 0x1023b340
+3 r 0x20000a40
+4 r 0x10439540
+5 r 0x1053e9c0
+6 r 0x1062e940
+7 w 0x10709f80
+8 w 0x20002140
+9 w 0x1091d380
+10 r 0x10a3a5c0
+11 r 0x10b02d80
+12 r 0x20002900
+13 r 0x10d00240
+14 r 0x10e05f40
+15 w 0x10f2c740
+0 w 0x10038640
+1 r 0x10136b80
+2 r 0x10201540
+3 r 0x10338680
+4 w 0x104268c0
+5 w 0x1053e500
+6 r 0x10639880
+7 r 0x1072f6c0
+8 r 0x1081a340
+9 r 0x10907380
+10 w 0x10a1c340
+11 w 0x10b2f200
+12 r 0x10c36d00
+13 r 0x200016c0
+14 r 0x10e2c280
+15 r 0x10f1d900
+0 w 0x10018940
+1 w 0x1010adc0
+2 r 0x1021de40
+3 r 0x103024c0
+4 w 0x1040a700
+5 w 0x10510e40
+6 w 0x10624ac0
+7 r 0x1071d480
+8 w 0x1081f240
+9 w 0x20001100
+10 r 0x200038c0
+11 w 0x200009c0
+12 r 0x10c04c80
+13 r 0x10d25c80
+14 r 0x10e30100
+15 r 0x10f0c080
+0 r 0x10016cc0
+1 r 0x1011fc80
+2 r 0x1021b040
+3 r 0x10304200
+4 r 0x10426b00
+5 w 0x20000e40
+6 r 0x10629140
+7 w 0x20000d80
+8 r 0x1082a3c0
+9 r 0x10917fc0
+10 w 0x20003040
+11 r 0x10b043c0
+12 r 0x10c2f640
+13 r 0x10d25380
+14 w 0x20001fc0
+15 r 0x10f25b00
+0 r 0x1003b000
+1 r 0x101265c0
+2 r 0x1021cb00
+3 r 0x20002a80
+4 r 0x104145c0
+5 w 0x1053e280
+6 r 0x1062bf80
+7 w 0x1070a480
+8 r 0x20003740
+9 w 0x10921bc0
+10 w 0x20003ac0
+11 w 0x10b1c0c0
+12 w 0x10c22fc0
+13 w 0x10d29f00
+14 r 0x20003640
+15 r 0x10f197c0
+0 r 0x10007600
+1 r 0x10116940
+2 r 0x102126c0
+3 r 0x10337c40
+4 r 0x10429b40
+5 r 0x1052fa00
+6 r 0x1063d6c0
+7 w 0x107074c0
+8 r 0x10839500
+9 r 0x10905140
+10 r 0x10a12a40
+11 r 0x10b0be40
+12 r 0x10c3c180
+13 w 0x20000e40
+14 r 0x10e1d040
+15 r 0x20001100
+0 w 0x1003a3c0
+1 r 0x10130b00
+2 r 0x10215e00
+3 r 0x1031eb40
+4 w 0x10422e40
+5 r 0x1051bc40
+6 r 0x10607580
+7 w 0x10719dc0
+8 r 0x10825d40
+9 r 0x109302c0
+10 r 0x10a19200
+11 r 0x10b1b340
+12 r 0x20002e00
+13 w 0x200032c0
+14 r 0x20000840
+15 w 0x10f26a00
+0 r 0x1002a740
+1 w 0x10110e00
+2 w 0x20002bc0
+3 r 0x10310780
+4 r 0x1042bc40
+5 w 0x20002f00
+6 r 0x10626a40
+7 r 0x10717bc0
+8 w 0x10812000
+9 w 0x10937f80
+10 w 0x20003180
+11 w 0x20002740
+12 r 0x10c3db80
+13 r 0x10d26bc0
+14 w 0x10e3fb40
+15 r 0x10f36100
+0 r 0x1001e780
+1 r 0x101072c0
+2 w 0x10209e40
+3 w 0x10313880
+4 r 0x10405480
+5 r 0x1053ae40
+6 r 0x1061b6c0
+7 r 0x10703340
+8 r 0x10831d80
+9 r 0x1092c980
+10 r 0x10a2a080
+11 r 0x10b3a880
+12 w 0x20003e40
+13 w 0x10d003c0
+14 r 0x10e3e8c0
+15 r 0x10f37280
+0 w 0x200009c0
+1 r 0x20002080
+2 r 0x200019c0
+3 w 0x1032fac0
+4 r 0x1040f080
+5 w 0x10514a80
+6 r 0x10632b80
+7 w 0x10715100
+8 w 0x20001cc0
+9 w 0x20003780
+10 w 0x10a25dc0
+11 r 0x10b0dcc0
+12 w 0x10c16500
+13 r 0x10d24940
+14 r 0x10e3bec0
+15 r 0x10f30680
+0 r 0x10023a00
+1 w 0x1012ca40
+2 w 0x20000fc0
+3 r 0x20001980
+4 r 0x1040c740
+5 w 0x10532d40
+6 r 0x1062e580
+7 w 0x20002840
+8 w 0x108187c0
+9 w 0x10925000
+10 w 0x10a0dd00
+11 r 0x20002a00
+12 w 0x20001600
+13 r 0x10d149c0
+14 w 0x10e30b00
+15 r 0x10f32800
+0 r 0x1001f400
+1 w 0x10109540
+2 r 0x1023ea00
+3 r 0x10312ec0
+4 w 0x1041b580
+5 r 0x10527400
+6 w 0x20002780
+7 r 0x1072e340
+8 r 0x1081ef00
+9 w 0x1091dc00
+10 r 0x20000980
+11 r 0x10b07500
+12 w 0x20002080
+13 r 0x10d2ca80
+14 w 0x10e00180
+15 w 0x20003a80
+0 r 0x1000e100
+1 r 0x101077c0
+2 r 0x10227f80
+3 r 0x20003780
+4 w 0x1042e300
+5 r 0x1051ff00
+6 w 0x1063e5c0
+7 w 0x10736cc0
+8 w 0x200001c0
+9 w 0x20000180
+10 w 0x10a02900
+11 r 0x10b3cd00
+12 w 0x20001c80
+13 r 0x10d34e80
+14 r 0x10e10c00
+15 w 0x10f16500
+0 w 0x1003a980
+1 w 0x10100580
+2 r 0x1020db40
+3 r 0x103197c0
+4 r 0x1042afc0
+5 w 0x10503480
+6 w 0x20001540
+7 r 0x10707300
+8 w 0x10818100
+9 w 0x1090d500
+10 r 0x10a0b980
+11 r 0x20002c80
+12 r 0x10c14380
+13 r 0x10d20340
+14 r 0x10e36c40
+15 r 0x10f39580
+0 r 0x10013b40
+1 r 0x10103600
+2 r 0x1020fa80
+3 r 0x103193c0
+4 r 0x1040e0c0
+5 r 0x1052f080
+6 r 0x10624cc0
+7 r 0x1070bc80
+8 r 0x1083d880
+9 r 0x1091d800
+10 w 0x10a10480
+11 r 0x10b3d100
+12 r 0x10c0f480
+13 r 0x20001840
+14 r 0x20000380
+15 r 0x10f01180
+0 w 0x10020780
+1 r 0x1011c200
+2 w 0x1020e840
+3 w 0x1030dc00
+4 r 0x10425c40
+5 r 0x10539800
+6 r 0x10630180
+7 r 0x10722cc0
+8 r 0x1083be40
+9 r 0x10907d80
+10 w 0x20003640
+11 w 0x10b3b080
+12 r 0x10c0afc0
+13 r 0x10d2bb80
+14 r 0x20003980
+15 w 0x10f2d2c0
+0 w 0x1000fcc0
+1 w 0x20003b40
+2 r 0x1022af00
+3 r 0x1030e740
+4 r 0x1043c700
+5 r 0x10514680
+6 r 0x106374c0
+7 r 0x10703d80
+8 r 0x1081a740
+9 r 0x10909880
+10 r 0x10a180c0
+11 r 0x10b3f400
+12 w 0x10c14a40
+13 w 0x10d16a80
+14 w 0x20000fc0
+15 r 0x20002c80
+0 w 0x200025c0
+1 w 0x1011a380
+2 r 0x1020ff40
+3 r 0x20001380
+4 r 0x10413840
+5 r 0x10527d80
+6 r 0x1062b640
+7 w 0x10719600
+8 r 0x10808700
+9 r 0x20002200
+10 w 0x10a3a280
+11 r 0x10b0dec0
+12 w 0x10c14980
+13 r 0x20000580
+14 w 0x10e281c0
+15 r 0x10f25bc0
+0 w 0x10034700
+1 r 0x1013fd00
+2 r 0x20000040
+3 r 0x1033a580
+4 w 0x104091c0
+5 r 0x1052ed40
+6 r 0x10607100
+7 r 0x10722500
+8 w 0x10831b00
+9 r 0x10908c40
+10 r 0x20000a80
+11 r 0x20000e80
+12 r 0x10c3a2c0
+13 r 0x10d2fe80
+14 r 0x10e1ad80
+15 w 0x10f2fe80
+0 r 0x10037e00
+1 w 0x1012e380
+2 r 0x1020c9c0
+3 r 0x10322a80
+4 r 0x20000980
+5 w 0x1052f640
+6 r 0x10605200
+7 r 0x10717c40
+8 w 0x200003c0
+9 w 0x109209c0
+10 w 0x20002880
+11 w 0x10b30540
+12 r 0x10c05940
+13 r 0x10d05b40
+14 r 0x10e0cec0
+15 r 0x10f303c0
+0 r 0x1003ccc0
+1 w 0x1012cc40
+2 r 0x1021cec0
+3 w 0x10315240
+4 r 0x104043c0
+5 w 0x20002580
+6 r 0x1062fdc0
+7 w 0x107183c0
+8 w 0x1081a480
+9 r 0x10909340
+10 r 0x10a07100
+11 r 0x10b2e4c0
+12 r 0x10c0b400
+13 r 0x10d08980
+14 r 0x200023c0
+15 r 0x10f15940
+0 r 0x100108c0
+1 r 0x10114e40
+2 r 0x1023de40
+3 r 0x10316b80
+4 r 0x10416200
+5 r 0x105043c0
+6 w 0x1063d5c0
+7 w 0x1073afc0
+8 w 0x20000f00
+9 w 0x1093f4c0
+10 w 0x20000b00
+11 w 0x20003e00
+12 r 0x10c3eb80
+13 r 0x10d17840
+14 r 0x10e0d880
+15 w 0x10f2eb80
+0 r 0x10009f80
+1 r 0x10102340
+2 w 0x200012c0
+3 r 0x1033b200
+4 r 0x10432a00
+5 w 0x1051c800
+6 r 0x10604cc0
+7 r 0x20003940
+8 r 0x10820a40
+9 r 0x10931d40
+10 w 0x10a379c0
+11 r 0x10b02a80
+12 r 0x20003080
+13 w 0x20000600
+14 w 0x10e1ff80
+15 r 0x10f05980
+0 r 0x200023c0
+1 w 0x10101980
+2 w 0x1021fd80
+3 r 0x10313180
+4 w 0x10408f00
+5 w 0x10511a40
+6 r 0x1060e640
+7 r 0x20001a40
+8 r 0x1080c940
+9 r 0x1093c8c0
+10 r 0x10a0e400
+11 r 0x10b01fc0
+12 r 0x10c1cf40
+13 w 0x10d18d80
+14 r 0x10e0b4c0
+15 r 0x10f15a80
+0 r 0x100046c0
+1 r 0x1013d7c0
+2 w 0x1020e6c0
+3 w 0x1030b2c0
+4 r 0x10424f40
+5 w 0x20002440
+6 r 0x1060fb40
+7 r 0x1072d780
+8 r 0x1082ce80
+9 r 0x10928f00
+10 w 0x20001800
+11 r 0x10b0f380
+12 r 0x10c3a440
+13 r 0x10d2d300
+14 r 0x10e1eb80
+15 w 0x10f3dc40
+0 w 0x1002c740
+1 r 0x1012ff40
+2 w 0x10239300
+3 r 0x1033a480
+4 r 0x10425c40
+5 r 0x20002600
+6 r 0x1061ebc0
+7 r 0x1071cec0
+8 w 0x1082a440
+9 w 0x20001a80
+10 w 0x20001ac0
+11 w 0x200026c0
+12 r 0x10c3fd40
+13 r 0x200008c0
+14 r 0x10e15800
+15 r 0x10f05880
+0 r 0x1002c940
+1 r 0x20002400
+2 w 0x10239780
+3 w 0x1032a440
+4 w 0x10439ec0
+5 w 0x10535200
+6 r 0x10619600
+7 r 0x107228c0
+8 w 0x108136c0
+9 r 0x200013c0
+10 r 0x10a1ad80
+11 w 0x20002140
+12 w 0x200024c0
+13 r 0x10d368c0
+14 w 0x200026c0
+15 r 0x10f0a600
+0 w 0x20003300
+1 r 0x20003180
+2 w 0x10219700
+3 r 0x103255c0
+4 w 0x10420b80
+5 r 0x10526bc0
+6 r 0x1061d740
+7 r 0x1072bdc0
+8 r 0x108112c0
+9 r 0x10905100
+10 w 0x10a202c0
+11 w 0x10b24980
+12 w 0x10c3a940
+13 r 0x10d20b40
+14 r 0x10e02940
+15 w 0x10f0de80
+0 r 0x10035700
+1 w 0x10113b40
+2 r 0x20002e00
+3 r 0x1030c540
+4 r 0x1041a740
+5 r 0x105328c0
+6 r 0x200033c0
+7 r 0x107252c0
+8 w 0x20002fc0
+9 r 0x10907f80
+10 w 0x200002c0
+11 w 0x10b2e340
+12 w 0x200001c0
+13 r 0x20001ec0
+14 r 0x20003980
+15 r 0x10f380c0
+0 w 0x200024c0
+1 w 0x10128900
+2 r 0x10227880
+3 r 0x1033cc40
+4 r 0x20001a40
+5 r 0x1051b440
+6 r 0x10612dc0
+7 r 0x10732f80
+8 r 0x108349c0
+9 r 0x109051c0
+10 r 0x10a18640
+11 r 0x10b21bc0
+12 r 0x20003a40
+13 r 0x10d22440
+14 r 0x20000080
+15 w 0x10f30800
+0 r 0x10004d00
+1 r 0x101146c0
+2 r 0x10220a40
+3 w 0x20003840
+4 w 0x20000b40
+5 r 0x1052b2c0
+6 r 0x10619140
+7 w 0x20000040
+8 w 0x10820d80
+9 r 0x10937500
+10 r 0x10a35d80
+11 r 0x10b22100
+12 r 0x10c1df40
+13 w 0x20001c80
+14 r 0x10e216c0
+15 w 0x10f0d280
+0 r 0x20001440
+1 r 0x10105080
+2 r 0x10220e00
+3 r 0x10306540
+4 r 0x1042acc0
+5 w 0x200002c0
+6 r 0x20001d80
+7 w 0x10700280
+8 w 0x1082e340
+9 r 0x10905780
+10 r 0x10a15400
+11 r 0x10b13980
+12 r 0x10c16600
+13 r 0x10d35080
+14 r 0x10e36540
+15 r 0x200012c0
+0 r 0x1000a400
+1 r 0x101240c0
+2 r 0x1023d800
+3 w 0x10316800
+4 r 0x10433a80
+5 w 0x10526e80
+6 r 0x10603580
+7 r 0x10726b00
+8 w 0x1083a5c0
+9 r 0x10919740
+10 r 0x10a2b780
+11 r 0x10b2a9c0
+12 r 0x10c30a40
+13 w 0x20000640
+14 w 0x10e31f00
+15 w 0x20000c40
+0 r 0x1001bb40
+1 r 0x20000380
+2 w 0x10231600
+3 w 0x10319600
+4 r 0x104012c0
+5 r 0x1051b600
+6 w 0x1062eec0
+7 w 0x10715740
+8 r 0x10815880
+9 r 0x1092f840
+10 r 0x10a29b80
+11 r 0x20002ac0
+12 r 0x10c07c40
+13 w 0x10d1b9c0
+14 r 0x10e2c000
+15 r 0x10f1cf00
+0 r 0x1002c2c0
+1 r 0x10112fc0
+2 w 0x10233c40
+3 w 0x20003e80
+4 r 0x1043e300
+5 r 0x10502f00
+6 r 0x10618e40
+7 w 0x10725180
+8 r 0x108084c0
+9 r 0x20002a80
+10 r 0x20002400
+11 r 0x20003d00
+12 w 0x10c3e780
+13 r 0x10d17840
+14 r 0x10e22280
+15 r 0x10f08500
+0 w 0x10031d80
+1 r 0x10107f00
+2 w 0x102310c0
+3 w 0x10322680
+4 r 0x10400440
+5 w 0x10531840
+6 r 0x1063ee80
+7 r 0x10703140
+8 w 0x10825e80
+9 r 0x10919b00
+10 r 0x10a0fa40
+11 r 0x10b11b00
+12 r 0x10c0ae00
+13 r 0x10d29080
+14 r 0x10e0a680
+15 r 0x10f33780
+0 r 0x1003a540
+1 w 0x101077c0
+2 r 0x10223300
+3 r 0x10327e40
+4 r 0x20000140
+5 r 0x10508cc0
+6 r 0x10632ac0
+7 r 0x10707940
+8 w 0x108260c0
+9 w 0x20002f40
+10 r 0x10a239c0
+11 w 0x20000300
+12 w 0x10c34bc0
+13 w 0x20002e80
+14 r 0x10e19cc0
+15 r 0x10f16900
+0 r 0x20003e80
+1 w 0x20002200
+2 r 0x1022c740
+3 w 0x10318d80
+4 r 0x1040fc00
+5 r 0x1051b580
+6 r 0x10603e80
+7 r 0x10711d80
+8 w 0x10823cc0
+9 w 0x1091af40
+10 r 0x200036c0
+11 r 0x10b3ef80
+12 w 0x20002680
+13 w 0x20002780
+14 w 0x10e3adc0
+15 r 0x10f3cec0
+0 r 0x10033700
+1 w 0x20003100
+2 w 0x10228f80
+3 r 0x10330080
+4 r 0x1041d300
+5 r 0x10516080
+6 r 0x10604700
+7 r 0x1071ec40
+8 r 0x1082c500
+9 w 0x20001bc0
+10 w 0x10a36d40
+11 r 0x10b0cc40
+12 r 0x10c0fd80
+13 r 0x10d3ae00
+14 r 0x10e03dc0
+15 r 0x10f1b800
+0 r 0x1002e600
+1 r 0x10139600
+2 r 0x10203280
+3 r 0x10334640
+4 r 0x1043da00
+5 r 0x105206c0
+6 r 0x1061ba00
+7 r 0x10723580
+8 w 0x200018c0
+9 r 0x109116c0
+10 r 0x10a06740
+11 r 0x10b3d000
+12 r 0x200029c0
+13 r 0x10d1e800
+14 r 0x20000000
+15 r 0x10f16400
+0 r 0x20003140
+1 w 0x1010e2c0
+2 r 0x10205340
+3 w 0x20002800
+4 w 0x10423680
+5 w 0x10532c80
+6 w 0x20001640
+7 r 0x107095c0
+8 r 0x10833440
+9 r 0x20000580
+10 w 0x10a02bc0
+11 w 0x20000800
+12 r 0x10c3e380
+13 r 0x20001880
+14 r 0x10e36bc0
+15 r 0x10f3d540
+0 r 0x1000c840
+1 w 0x10116980
+2 r 0x200026c0
+3 r 0x1032da00
+4 r 0x10403580
+5 w 0x200010c0
+6 r 0x10637ec0
+7 r 0x10726ec0
+8 r 0x1080f940
+9 r 0x10921d40
+10 w 0x10a2e940
+11 w 0x10b11f80
+12 w 0x10c28740
+13 w 0x20001d00
+14 w 0x10e214c0
+15 r 0x10f1dcc0
+0 w 0x10013b40
+1 r 0x10112940
+2 r 0x10201e40
+3 r 0x10326a40
+4 r 0x10400680
+5 r 0x10508780
+6 w 0x10600d40
+7 r 0x1072bac0
+8 w 0x108040c0
+9 w 0x10921ec0
+10 r 0x10a31940
+11 r 0x10b34dc0
+12 w 0x10c3a000
+13 r 0x10d1b840
+14 r 0x10e31b40
+15 w 0x10f21e80
+0 r 0x1003f000
+1 r 0x200004c0
+2 r 0x10230400
+3 r 0x10331ac0
+4 r 0x10406e00
+5 r 0x10515f00
+6 r 0x10619600
+7 w 0x20000980
+8 w 0x108328c0
+9 w 0x20001c00
+10 r 0x10a3f300
+11 w 0x10b30ec0
+12 r 0x20000100
+13 r 0x10d01b00
+14 r 0x10e2e1c0
+15 r 0x10f1a3c0
+0 r 0x20001600
+1 w 0x20002540
+2 w 0x20003a40
+3 r 0x1031c180
+4 w 0x20000e80
+5 r 0x10518540
+6 w 0x1061e2c0
+7 r 0x10704ec0
+8 r 0x10823700
+9 w 0x10926ac0
+10 r 0x20003200
+11 r 0x10b15140
+12 r 0x10c3f000
+13 r 0x10d2cd40
+14 r 0x10e0c880
+15 r 0x10f25100
+0 w 0x200030c0
+1 w 0x10129600
+2 r 0x10200dc0
+3 r 0x10312cc0
+4 w 0x104263c0
+5 r 0x1053c8c0
+6 r 0x20001440
+7 r 0x20001ec0
+8 r 0x1080ff40
+9 r 0x1091ed80
+10 r 0x20000780
+11 w 0x10b0bd00
+12 r 0x10c32840
+13 r 0x10d3b780
+14 w 0x200006c0
+15 r 0x10f30780
+0 r 0x10022240
+1 w 0x10123fc0
+2 r 0x10209d40
+3 w 0x20001580
+4 r 0x1040aa80
+5 w 0x20002d80
+6 w 0x1060e500
+7 w 0x20000840
+8 r 0x1080bbc0
+9 w 0x10920680
+10 r 0x10a06400
+11 w 0x10b2d2c0
+12 r 0x20003a00
+13 r 0x10d07700
+14 r 0x10e38300
+15 w 0x10f15640
+0 r 0x10019300
+1 w 0x101374c0
+2 r 0x10229440
+3 r 0x20002480
+4 r 0x10424740
+5 w 0x10531c00
+6 w 0x10636200
+7 r 0x10724d80
+8 r 0x1082a280
+9 r 0x10914700
+10 r 0x20003240
+11 r 0x10b10200
+12 w 0x10c03040
+13 r 0x10d16480
+14 r 0x200013c0
+15 r 0x20000bc0
+0 r 0x20000400
+1 r 0x10125740
+2 r 0x10219e80
+3 r 0x10332c00
+4 r 0x10437880
+5 r 0x10500800
+6 r 0x10607740
+7 r 0x200032c0
+8 r 0x10834780
+9 r 0x10939000
+10 r 0x10a14380
+11 r 0x10b31380
+12 w 0x10c04d00
+13 r 0x10d2f1c0
+14 w 0x10e11380
+15 r 0x10f2e900
+0 r 0x10024300
+1 r 0x20001400
+2 w 0x10218140
+3 w 0x1031d780
+4 r 0x20001400
+5 w 0x1053b380
+6 w 0x20003f80
+7 r 0x20003d80
+8 r 0x10834440
+9 w 0x20000e00
+10 r 0x20001580
+11 r 0x10b13200
+12 r 0x10c36180
+13 r 0x10d34000
+14 r 0x10e2a700
+15 r 0x10f0c180
+0 r 0x20000a00
+1 r 0x10133d40
+2 r 0x10236e40
+3 r 0x200002c0
+4 r 0x10436700
+5 r 0x1050a200
+6 w 0x10605780
+7 w 0x10710800
+8 w 0x108182c0
+9 w 0x20003300
+10 r 0x10a00f40
+11 w 0x10b390c0
+12 w 0x10c10500
+13 r 0x10d0bcc0
+14 r 0x10e0fe40
+15 r 0x10f0a500
+0 r 0x100181c0
+1 w 0x200020c0
+2 r 0x1023e180
+3 r 0x10320300
+4 r 0x1042f300
+5 r 0x1053d980
+6 w 0x106226c0
+7 r 0x10735680
+8 r 0x1082f840
+9 w 0x200000c0
+10 r 0x10a366c0
+11 w 0x10b21880
+12 w 0x10c248c0
+13 w 0x20002580
+14 r 0x10e333c0
+15 r 0x10f03000
+0 r 0x1001a340
+1 r 0x10118f40
+2 r 0x10205700
+3 w 0x10312f40
+4 r 0x10401780
+5 w 0x20001ac0
+6 r 0x20000480
+7 w 0x200014c0
+8 r 0x20001700
+9 w 0x10921d80
+10 r 0x10a03c00
+11 r 0x10b12b40
+12 w 0x20002400
+13 w 0x10d17840
+14 r 0x10e33dc0
+15 r 0x10f139c0
+0 r 0x10022d80
+1 r 0x10113200
+2 r 0x1022e280
+3 r 0x10301b00
+4 w 0x20003dc0
+5 r 0x1050bfc0
+6 r 0x20002e80
+7 r 0x20003480
+8 r 0x108185c0
+9 w 0x1093fa40
+10 w 0x10a2c1c0
+11 r 0x20003f80
+12 r 0x10c18800
+13 r 0x20003200
+14 r 0x10e3fb00
+15 r 0x10f157c0
+0 w 0x10028240
+1 r 0x101055c0
+2 w 0x20000780
+3 r 0x20001e40
+4 r 0x20000b00
+5 r 0x20000c00
+6 r 0x106055c0
+7 w 0x10737dc0
+8 r 0x10810840
+9 r 0x20002ac0
+10 r 0x20003180
+11 r 0x10b25cc0
+12 r 0x10c1ec80
+13 r 0x10d36500
+14 r 0x10e34bc0
+15 r 0x20002b40
+0 r 0x20002a00
+1 r 0x20003300
+2 r 0x20002dc0
+3 w 0x10313c40
+4 w 0x20003280
+5 w 0x105084c0
+6 r 0x106118c0
+7 w 0x10711340
+8 r 0x10829d00
+9 w 0x10902b80
+10 w 0x10a17c80
+11 r 0x10b0b500
+12 r 0x10c27440
+13 r 0x10d04600
+14 r 0x20002300
+15 w 0x20003c80
+0 r 0x1000f2c0
+1 r 0x10131a00
+2 r 0x10234900
+3 r 0x10316d40
+4 r 0x10418cc0
+5 w 0x10514680
+6 r 0x1061e4c0
+7 r 0x10715a40
+8 r 0x10836440
+9 r 0x20001280
+10 r 0x10a243c0
+11 r 0x10b33e80
+12 w 0x10c26580
+13 w 0x10d28f00
+14 r 0x10e2e880
+15 r 0x10f31880
+0 r 0x10035300
+1 w 0x1013f500
+2 r 0x10238540
+3 r 0x10333a00
+4 r 0x10404e40
+5 r 0x10510e40
+6 r 0x1063d600
+7 w 0x20003440
+8 r 0x1082a6c0
+9 w 0x109147c0
+10 r 0x10a2f180
+11 r 0x10b21b40
+12 w 0x20001000
+13 w 0x10d1dac0
+14 r 0x10e2f480
+15 r 0x10f18540
+0 r 0x1000fc00
+1 r 0x1012c340
+2 w 0x10206300
+3 r 0x103195c0
+4 r 0x20000840
+5 r 0x1053b980
+6 r 0x200037c0
+7 w 0x10719900
+8 w 0x10820c00
+9 r 0x1091a440
+10 w 0x10a2d700
+11 r 0x10b05c40
+12 r 0x10c2ddc0
+13 r 0x10d10100
+14 w 0x20000440
+15 w 0x10f1e9c0
+0 r 0x1001e500
+1 r 0x1011ac40
+2 r 0x10237200
+3 w 0x10321180
+4 r 0x10427740
+5 w 0x10519b00
+6 r 0x10629d80
+7 w 0x107207c0
+8 w 0x1080d6c0
+9 r 0x109174c0
+10 r 0x10a1d200
+11 w 0x10b3b040
+12 r 0x10c36880
+13 r 0x20000e00
+14 r 0x10e36e00
+15 w 0x20000c00
+0 r 0x1002f880
+1 r 0x10134300
+2 w 0x1021b340
+3 r 0x1031d780
+4 w 0x1042b5c0
+5 r 0x10532200
+6 r 0x1061c940
+7 r 0x1071fb80
+8 r 0x1083fd80
+9 r 0x10937440
+10 r 0x10a17b00
+11 r 0x10b3bb80
+12 r 0x10c07480
+13 r 0x10d3ce40
+14 r 0x10e37ec0
+15 r 0x10f18380
+0 w 0x20001680
+1 w 0x10139b40
+2 r 0x1023ba40
+3 r 0x1030f840
+4 r 0x10422240
+5 r 0x20003b80
+6 w 0x10624dc0
+7 w 0x10709700
+8 r 0x1082a640
+9 r 0x10911d80
+10 r 0x10a2a940
+11 r 0x10b37e00
+12 r 0x10c30480
+13 w 0x10d3cbc0
+14 w 0x20002600
+15 r 0x10f1cb00
+0 r 0x10003840
+1 w 0x101310c0
+2 r 0x200016c0
+3 w 0x10305c80
+4 r 0x1043ae00
+5 r 0x10528700
+6 r 0x10626d40
+7 w 0x10705b00
+8 r 0x10828980
+9 w 0x10920dc0
+10 w 0x10a0fc40
+11 w 0x20003d00
+12 r 0x20001ac0
+13 r 0x10d11480
+14 w 0x10e1b040
+15 r 0x10f29140
+0 r 0x1003a940
+1 w 0x10110d40
+2 r 0x10228280
+3 r 0x20000700
+4 w 0x1042d4c0
+5 r 0x10510300
+6 r 0x1061aac0
+7 r 0x1070c7c0
+8 r 0x20002b00
+9 w 0x10924880
+10 w 0x20000340
+11 w 0x20000900
+12 r 0x10c0f5c0
+13 r 0x10d00fc0
+14 r 0x20000a40
+15 w 0x10f1d080
+0 r 0x20001100
+1 r 0x101199c0
+2 r 0x1021efc0
+3 r 0x20000e00
+4 r 0x10406980
+5 r 0x10524740
+6 w 0x10603040
+7 r 0x1071abc0
+8 w 0x1083d500
+9 r 0x1091b700
+10 r 0x10a1c100
+11 w 0x20003a40
+12 r 0x10c29500
+13 r 0x10d07500
+14 r 0x10e08fc0
+15 w 0x10f17700
+0 w 0x20003640
+1 r 0x101031c0
+2 w 0x10208b80
+3 w 0x20001340
+4 r 0x10424ec0
+5 r 0x105306c0
+6 r 0x20003d00
+7 r 0x1072f680
+8 r 0x20003a80
+9 w 0x20000540
+10 r 0x10a032c0
+11 r 0x10b3be00
+12 w 0x10c0ea80
+13 r 0x10d29f40
+14 r 0x10e137c0
+15 r 0x10f26500
+0 r 0x100362c0
+1 r 0x10110600
+2 r 0x10211740
+3 r 0x1033f380
+4 w 0x10408340
+5 w 0x1053afc0
+6 r 0x20003fc0
+7 r 0x10711d00
+8 r 0x108026c0
+9 r 0x200012c0
+10 r 0x20000e40
+11 r 0x10b3ab00
+12 w 0x20003b80
+13 r 0x10d084c0
+14 r 0x10e197c0
+15 r 0x20001280
+0 r 0x1001ac80
+1 r 0x1010e600
+2 r 0x1022c500
+3 w 0x10336d00
+4 w 0x20002a00
+5 w 0x10512900
+6 r 0x20001340
+7 w 0x200022c0
+8 r 0x1081c1c0
+9 r 0x109337c0
+10 w 0x10a3d280
+11 w 0x10b18e40
+12 w 0x10c01880
+13 w 0x10d04140
+14 r 0x10e28a00
+15 r 0x10f01680
+0 w 0x10017f00
+1 w 0x1010e780
+2 r 0x10212b00
+3 w 0x10331040
+4 w 0x10435b40
+5 w 0x10514280
+6 w 0x10601600
+7 w 0x1072bcc0
+8 r 0x10812780
+9 w 0x1093a940
+10 r 0x10a1e340
+11 r 0x10b284c0
+12 r 0x10c1c1c0
+13 w 0x20003000
+14 r 0x10e2b780
+15 r 0x10f24d40
+0 w 0x1001a200
+1 r 0x1012b080
+2 w 0x102165c0
+3 r 0x10327d00
+4 r 0x1043eb80
+5 r 0x10510b40
+6 w 0x200013c0
+7 r 0x20002400
+8 r 0x1083d440
+9 r 0x10910040
+10 r 0x10a29700
+11 r 0x10b1f2c0
+12 w 0x10c35100
+13 w 0x10d29180
+14 w 0x20001f40
+15 r 0x10f08880
+0 w 0x1000aec0
+1 r 0x10136600
+2 w 0x10207f80
+3 r 0x10339cc0
+4 r 0x10421240
+5 r 0x10532f80
+6 w 0x1060f080
+7 w 0x10722240
+8 r 0x1083df40
+9 r 0x10920f40
+10 r 0x10a0e340
+11 r 0x20003fc0
+12 w 0x10c30740
+13 w 0x200016c0
+14 r 0x10e33b40
+15 r 0x20001d40
+0 r 0x200013c0
+1 r 0x10109480
+2 r 0x1023b8c0
+3 r 0x10319e00
+4 r 0x1041be40
+5 w 0x20002fc0
+6 r 0x106100c0
+7 r 0x10710c80
+8 r 0x10804300
+9 r 0x20001200
+10 r 0x10a38440
+11 w 0x10b126c0
+12 w 0x10c03b00
+13 r 0x10d30280
+14 w 0x10e39680
+15 w 0x20001580
+0 w 0x10031dc0
+1 r 0x10132f00
+2 w 0x20002f00
+3 r 0x10310b40
+4 r 0x20003480
+5 r 0x10524ec0
+6 r 0x10600400
+7 r 0x1071b740
+8 w 0x1083a800
+9 r 0x1092c340
+10 w 0x10a0ff80
+11 w 0x200004c0
+12 r 0x10c39480
+13 r 0x10d041c0
+14 r 0x10e04bc0
+15 r 0x20001780
+0 w 0x10024640
+1 w 0x1011bf40
+2 r 0x20000cc0
+3 w 0x20002000
+4 w 0x10407d40
+5 r 0x20000640
+6 w 0x10630680
+7 r 0x1070abc0
+8 r 0x10838300
+9 r 0x1092a1c0
+10 r 0x10a1dd40
+11 r 0x10b02900
+12 r 0x10c3a400
+13 w 0x10d2ea00
+14 w 0x20001040
+15 r 0x10f2a8c0
+0 w 0x10006e40
+1 w 0x10137700
+2 w 0x102203c0
+3 r 0x10309200
+4 r 0x1040d840
+5 r 0x10516380
+6 r 0x10630600
+7 r 0x1070bc00
+8 r 0x10833180
+9 r 0x10939bc0
+10 r 0x10a34e80
+11 w 0x10b395c0
+12 r 0x10c0cd00
+13 r 0x10d24280
+14 w 0x20003cc0
+15 r 0x10f30740
+0 w 0x10030880
+1 r 0x10120b00
+2 w 0x10225d80
+3 w 0x10337a40
+4 w 0x20001c00
+5 r 0x1052e900
+6 r 0x10606fc0
+7 w 0x20000140
+8 r 0x1083f800
+9 w 0x20001580
+10 w 0x200005c0
+11 r 0x10b1dec0
+12 r 0x200029c0
+13 r 0x10d38cc0
+14 r 0x10e2be80
+15 r 0x10f155c0
+0 r 0x10032140
+1 r 0x200010c0
+2 r 0x20002640
+3 w 0x10332000
+4 r 0x10425e00
+5 w 0x10519180
+6 r 0x10622140
+7 r 0x20001580
+8 w 0x10825000
+9 r 0x1092bcc0
+10 r 0x20002940
+11 w 0x10b35a80
+12 r 0x10c05100
+13 r 0x10d11100
+14 r 0x200021c0
+15 r 0x10f33780
+0 r 0x10013f00
+1 w 0x1013c100
+2 r 0x1022f8c0
+3 r 0x103038c0
+4 r 0x10404b80
+5 w 0x200020c0
+6 w 0x10602740
+7 w 0x1071f500
+8 r 0x10837d80
+9 r 0x10913980
+10 w 0x10a29500
+11 r 0x10b03d00
+12 w 0x10c04b00
+13 r 0x10d0af80
+14 w 0x10e0f3c0
+15 w 0x10f0ff00
+0 r 0x20002640
+1 w 0x1011abc0
+2 r 0x10226dc0
+3 r 0x1030c5c0
+4 r 0x104139c0
+5 r 0x105134c0
+6 r 0x1061a8c0
+7 w 0x1071c780
+8 w 0x10828ec0
+9 w 0x20001c80
+10 w 0x20001580
+11 w 0x20002540
+12 r 0x10c0c9c0
+13 r 0x10d37180
+14 w 0x200024c0
+15 w 0x10f15980
+0 w 0x1000d440
+1 r 0x20002ec0
+2 w 0x20003ec0
+3 r 0x10307600
+4 r 0x10422b40
+5 r 0x1051fb80
+6 r 0x10630900
+7 w 0x10708d00
+8 w 0x20002900
+9 r 0x109154c0
+10 r 0x10a11500
+11 r 0x10b24d00
+12 w 0x20001240
+13 w 0x10d108c0
+14 r 0x10e29700
+15 r 0x10f0b400
+0 r 0x10006580
+1 r 0x10124e40
+2 r 0x102170c0
+3 w 0x1033fd40
+4 r 0x1041c700
+5 r 0x10535a80
+6 r 0x10614280
+7 r 0x107149c0
+8 r 0x1083ba40
+9 w 0x10937940
+10 r 0x10a10580
+11 w 0x10b16dc0
+12 w 0x10c23740
+13 r 0x10d34bc0
+14 w 0x20002880
+15 r 0x20000180
+0 r 0x10027c80
+1 r 0x101258c0
+2 r 0x1023f3c0
+3 r 0x10323300
+4 w 0x104036c0
+5 r 0x1050dfc0
+6 r 0x20001140
+7 r 0x1070f180
+8 r 0x108031c0
+9 r 0x20003e80
+10 w 0x200006c0
+11 r 0x10b11a80
+12 r 0x10c2fe40
+13 r 0x10d03f00
+14 r 0x10e10a00
+15 r 0x10f02580
+0 r 0x1001e9c0
+1 r 0x1010d4c0
+2 r 0x102231c0
+3 w 0x20001940
+4 r 0x10411080
+5 r 0x10531600
+6 r 0x10608d40
+7 w 0x20003140
+8 r 0x1080a200
+9 r 0x10902c40
+10 r 0x10a3cf40
+11 r 0x10b0c340
+12 w 0x10c33500
+13 w 0x10d0c300
+14 r 0x10e03b80
+15 w 0x10f38180
+0 w 0x1001e0c0
+1 r 0x10134440
+2 r 0x102040c0
+3 r 0x10318cc0
+4 r 0x10412d40
+5 w 0x1051ff80
+6 r 0x10602540
+7 r 0x1072e200
+8 r 0x20002700
+9 r 0x200002c0
+10 r 0x10a3f6c0
+11 r 0x10b05540
+12 r 0x10c30f00
+13 r 0x10d28400
+14 w 0x10e12500
+15 r 0x20001400
+0 w 0x1003a200
+1 w 0x1011e740
+2 r 0x10231b40
+3 w 0x10329080
+4 r 0x1040d080
+5 r 0x10525300
+6 r 0x20000f40
+7 r 0x10738c80
+8 r 0x200019c0
+9 r 0x10908200
+10 r 0x200017c0
+11 w 0x10b30740
+12 r 0x10c3fac0
+13 r 0x10d07080
+14 r 0x10e36a00
+15 r 0x20002800
+0 w 0x10038dc0
+1 r 0x1012f700
+2 r 0x1020d300
+3 r 0x10312b80
+4 w 0x104391c0
+5 r 0x1051b600
+6 w 0x20003780
+7 w 0x10732280
+8 r 0x10801800
+9 r 0x20002c40
+10 r 0x10a3d680
+11 r 0x10b3bfc0
+12 w 0x10c2ab00
+13 r 0x10d28ac0
+14 w 0x10e17680
+15 w 0x200028c0
+0 w 0x10021940
+1 r 0x101381c0
+2 w 0x20003880
+3 r 0x10337200
+4 r 0x10420f80
+5 r 0x10503bc0
+6 w 0x1061d600
+7 r 0x107047c0
+8 r 0x10800900
+9 r 0x1091ee80
+10 r 0x10a1c040
+11 r 0x10b09180
+12 r 0x10c06b00
+13 r 0x10d2ad80
+14 r 0x10e305c0
+15 r 0x10f0ca80
+0 r 0x20000140
+1 w 0x10108cc0
+2 w 0x1021b140
+3 w 0x103214c0
+4 w 0x1040c1c0
+5 w 0x10535b00
+6 w 0x200019c0
+7 w 0x20002c00
+8 w 0x10825980
+9 r 0x1091a000
+10 r 0x10a09440
+11 r 0x10b0c3c0
+12 r 0x10c20400
+13 r 0x10d11800
+14 w 0x200033c0
+15 r 0x20000280
+0 r 0x100304c0
+1 w 0x10132bc0
+2 w 0x10227300
+3 w 0x103283c0
+4 r 0x10405880
+5 r 0x10535200
+6 r 0x10619300
+7 w 0x20003880
+8 r 0x10836b40
+9 r 0x10906640
+10 r 0x20003a80
+11 r 0x20000a80
+12 w 0x20003840
+13 w 0x10d09780
+14 r 0x20002940
+15 r 0x10f34d80
+0 r 0x20002d00
+1 r 0x1011dd00
+2 w 0x1023a700
+3 r 0x10330880
+4 r 0x1043f6c0
+5 r 0x10526c80
+6 r 0x106068c0
+7 r 0x10723ac0
+8 w 0x20001f80
+9 w 0x20001200
+10 r 0x10a2c3c0
+11 r 0x10b278c0
+12 r 0x10c2b180
+13 w 0x10d1a240
+14 r 0x10e1c480
+15 r 0x10f1b280
+0 w 0x20000580
+1 w 0x20001e40
+2 w 0x20002a40
+3 r 0x10301880
+4 r 0x10421880
+5 r 0x20003340
+6 r 0x1061f880
+7 r 0x20000dc0
+8 r 0x1083b100
+9 w 0x10938c40
+10 r 0x10a29f00
+11 r 0x10b28ec0
+12 w 0x20001700
+13 r 0x10d3fc40
+14 w 0x10e30c80
+15 w 0x10f38dc0
+0 r 0x10011f00
+1 r 0x101097c0
+2 w 0x1020db40
+3 r 0x1031a7c0
+4 r 0x104184c0
+5 r 0x10532a80
+6 r 0x20002500
+7 w 0x10734a00
+8 r 0x10823d00
+9 r 0x10902180
+10 w 0x20003a80
+11 r 0x10b22240
+12 w 0x10c21340
+13 r 0x10d37480
+14 w 0x20001040
+15 w 0x10f08980
+0 r 0x10004740
+1 r 0x10107140
+2 r 0x1022ed40
+3 r 0x1032ca80
+4 r 0x1041fd40
+5 w 0x200016c0
+6 w 0x10617280
+7 r 0x1070b800
+8 r 0x10838600
+9 r 0x10903d40
+10 r 0x10a0e400
+11 w 0x10b3f100
+12 w 0x10c04200
+13 r 0x10d2e200
+14 r 0x10e06100
+15 r 0x10f0ed00
+0 w 0x1001db00
+1 w 0x1011a640
+2 r 0x1023c880
+3 r 0x20002a00
+4 w 0x10422d40
+5 w 0x10532700
+6 w 0x20001400
+7 r 0x200016c0
+8 r 0x1081a340
+9 r 0x10906a80
+10 r 0x10a04c00
+11 w 0x10b1c680
+12 r 0x10c2d500
+13 r 0x20002640
+14 r 0x10e26f40
+15 r 0x10f33500
+0 r 0x10028380
+1 r 0x10130500
+2 r 0x20003bc0
+3 r 0x10332480
+4 w 0x1040a700
+5 w 0x1051c540
+6 r 0x1063b500
+7 r 0x10729f80
+8 w 0x10829bc0
+9 r 0x20002100
+10 w 0x10a161c0
+11 w 0x10b31300
+12 r 0x10c27ac0
+13 r 0x10d02a00
+14 r 0x10e2b240
+15 r 0x10f090c0
+0 r 0x100386c0
+1 r 0x1010d6c0
+2 r 0x200026c0
+3 r 0x103171c0
+4 r 0x1041bf00
+5 r 0x10526580
+6 w 0x10630100
+7 r 0x10706c00
+8 w 0x20000a00
+9 w 0x10929f40
+10 r 0x10a1d700
+11 r 0x20002040
+12 r 0x10c26640
+13 w 0x20002140
+14 r 0x10e34180
+15 r 0x10f0ffc0
+0 w 0x1003cd40
+1 r 0x10102f00
+2 r 0x10233340
+3 w 0x1030d6c0
+4 r 0x1040ef00
+5 r 0x10528c80
+6 r 0x1063fc80
+7 r 0x1071e2c0
+8 r 0x10835600
+9 w 0x109140c0
+10 r 0x10a2de80
+11 r 0x10b32a40
+12 r 0x10c20280
+13 r 0x10d3c780
+14 r 0x20003cc0
+15 w 0x10f38840
+0 r 0x1001f300
+1 r 0x101349c0
+2 r 0x1021f9c0
+3 r 0x10309540
+4 w 0x10422400
+5 w 0x1050bb40
+6 r 0x1061c040
+7 r 0x10723000
+8 r 0x1080edc0
+9 r 0x1093a680
+10 r 0x10a27280
+11 r 0x20002f00
+12 w 0x10c068c0
+13 w 0x10d2cd00
+14 r 0x20001140
+15 w 0x10f10380
+0 w 0x20000100
+1 r 0x1010b100
+2 r 0x10230b00
+3 r 0x200010c0
+4 r 0x10436640
+5 w 0x10506580
+6 r 0x1060b580
+7 r 0x107047c0
+8 r 0x10805a40
+9 r 0x1091c680
+10 r 0x10a08e00
+11 r 0x20003a40
+12 r 0x10c23a80
+13 r 0x10d19bc0
+14 r 0x10e15f00
+15 w 0x200000c0
+0 r 0x10026d80
+1 r 0x10112840
+2 w 0x1022dd80
+3 r 0x1033b380
+4 r 0x10436800
+5 r 0x10527340
+6 w 0x1062af40
+7 r 0x10732c40
+8 r 0x1082de00
+9 w 0x10934540
+10 r 0x10a04e80
+11 r 0x10b22980
+12 w 0x20000f40
+13 r 0x10d3c740
+14 r 0x10e37d00
+15 r 0x10f02ec0
+0 w 0x20000880
+1 w 0x20000a40
+2 r 0x10223200
+3 w 0x10319a40
+4 w 0x10406600
+5 w 0x10501200
+6 w 0x10614540
+7 r 0x1071d4c0
+8 r 0x1083d200
+9 w 0x20003240
+10 r 0x10a24900
+11 r 0x20001040
+12 w 0x10c22240
+13 r 0x10d08a40
+14 w 0x10e2a440
+15 w 0x10f3bc40
+0 w 0x10015e40
+1 w 0x10119580
+2 w 0x20001e80
+3 r 0x1030e480
+4 r 0x10438140
+5 w 0x10520580
+6 w 0x10620140
+7 r 0x200023c0
+8 r 0x1081cdc0
+9 w 0x10920200
+10 r 0x10a2e4c0
+11 w 0x10b13c80
+12 r 0x10c2c900
+13 w 0x10d18200
+14 w 0x10e15200
+15 r 0x10f06000
+0 r 0x10001600
+1 r 0x10130fc0
+2 r 0x1021cc80
+3 r 0x103294c0
+4 r 0x1040a3c0
+5 r 0x10501c40
+6 w 0x20002e80
+7 w 0x10718580
+8 w 0x10808900
+9 r 0x10933b80
+10 w 0x10a26540
+11 w 0x10b15300
+12 w 0x10c23000
+13 w 0x10d38640
+14 r 0x10e2d840
+15 w 0x200012c0
+0 w 0x20002fc0
+1 r 0x101020c0
+2 r 0x20000340
+3 r 0x10319a80
+4 w 0x20001200
+5 r 0x20000dc0
+6 r 0x10628000
+7 w 0x20001d80
+8 w 0x20001640
+9 r 0x200015c0
+10 r 0x10a207c0
+11 w 0x10b0d580
+12 r 0x20003800
+13 r 0x10d3bc40
+14 r 0x10e26f40
+15 w 0x10f34f00
+0 r 0x20002e40
+1 r 0x10133440
+2 r 0x10203180
+3 r 0x1031e980
+4 r 0x1042d7c0
+5 r 0x10536d00
+6 r 0x200007c0
+7 r 0x10733100
+8 r 0x10824500
+9 w 0x20001b00
+10 r 0x10a24540
+11 w 0x20002300
+12 r 0x10c0f9c0
+13 r 0x10d318c0
+14 r 0x20001d40
+15 r 0x10f05fc0
+0 r 0x10004100
+1 r 0x10120240
+2 r 0x10207200
+3 r 0x10318a40
+4 r 0x10405940
+5 r 0x1050e680
+6 r 0x10622940
+7 r 0x10723d00
+8 w 0x200024c0
+9 r 0x20001cc0
+10 r 0x10a3fd40
+11 r 0x10b370c0
+12 r 0x10c18580
+13 r 0x10d34d00
+14 r 0x10e10c40
+15 r 0x10f36140
+0 r 0x10003340
+1 w 0x10108600
+2 r 0x10207e40
+3 w 0x10310740
+4 r 0x104361c0
+5 r 0x20003c00
+6 r 0x1063a200
+7 r 0x1070e240
+8 w 0x20002780
+9 r 0x10905880
+10 w 0x10a1f680
+11 w 0x10b3d400
+12 w 0x20000000
+13 r 0x10d2bd00
+14 w 0x10e18d40
+15 r 0x10f273c0
+0 w 0x10010680
+1 r 0x1013a5c0
+2 r 0x10200400
+3 r 0x10337a00
+4 r 0x10425a00
+5 w 0x20001f40
+6 r 0x10608500
+7 r 0x20000e40
+8 w 0x20001240
+9 r 0x1091c000
+10 r 0x10a2eb00
+11 w 0x10b1cec0
+12 r 0x10c28c00
+13 r 0x10d39900
+14 w 0x20001000
+15 w 0x200017c0
+0 r 0x10024480
+1 r 0x1012f1c0
+2 r 0x102194c0
+3 r 0x10320740
+4 r 0x104396c0
+5 r 0x20003780
+6 w 0x1063c7c0
+7 r 0x10717900
+8 r 0x1080da40
+9 r 0x20003180
+10 w 0x10a28840
+11 r 0x10b14880
+12 r 0x10c27500
+13 r 0x10d15a00
+14 w 0x20002380
+15 w 0x10f22880
+0 r 0x1003f900
+1 w 0x1010b540
+2 r 0x200035c0
+3 r 0x10337440
+4 r 0x1042ec80
+5 r 0x1051fdc0
+6 w 0x10638b00
+7 r 0x20001600
+8 r 0x10837e40
+9 r 0x109080c0
+10 w 0x20001f00
+11 w 0x20003f80
+12 r 0x10c1d740
+13 r 0x10d27c40
+14 w 0x10e3dcc0
+15 w 0x10f20880
+0 w 0x20003740
+1 r 0x20003ec0
+2 r 0x10239240
+3 r 0x10310100
+4 r 0x10415000
+5 w 0x10521000
+6 r 0x10610500
+7 r 0x1072a100
+8 w 0x108025c0
+9 w 0x10937000
+10 w 0x10a03400
+11 r 0x10b30a40
+12 r 0x10c17c40
+13 r 0x10d024c0
+14 r 0x10e3f680
+15 r 0x20000280
+0 r 0x10014640
+1 w 0x101117c0
+2 w 0x20000280
+3 r 0x20003380
+4 r 0x1041b6c0
+5 r 0x105281c0
+6 r 0x20003280
+7 r 0x10738f40
+8 r 0x10827ec0
+9 r 0x10917c80
+10 r 0x10a24940
+11 w 0x20003d40
+12 r 0x10c03c80
+13 r 0x10d01340
+14 r 0x10e100c0
+15 r 0x10f3bbc0
+0 r 0x1000af80
+1 r 0x10124440
+2 r 0x1020ff40
+3 r 0x1033ea40
+4 w 0x104093c0
+5 r 0x1053bc40
+6 r 0x1063ff80
+7 w 0x10705040
+8 w 0x10804500
+9 w 0x1091db00
+10 r 0x10a17680
+11 r 0x10b079c0
+12 r 0x10c051c0
+13 r 0x10d10d80
+14 w 0x10e203c0
+15 r 0x10f2bf40
+0 r 0x20001000
+1 w 0x200027c0
+2 r 0x20001180
+3 r 0x103244c0
+4 r 0x10433e80
+5 r 0x10507880
+6 r 0x10611b00
+7 r 0x1071cd80
+8 r 0x108041c0
+9 r 0x1090df80
+10 w 0x10a0ebc0
+11 w 0x20002f00
+12 r 0x10c36f00
+13 r 0x10d3eb80
+14 w 0x10e3de40
+15 r 0x10f0d380
+0 r 0x10020540
+1 r 0x20003700
+2 r 0x20001480
+3 r 0x10315ec0
+4 w 0x10403cc0
+5 w 0x20002800
+6 w 0x106032c0
+7 r 0x1073acc0
+8 r 0x10828b00
+9 w 0x109025c0
+10 w 0x10a2c200
+11 r 0x10b0ac00
+12 r 0x10c33700
+13 r 0x10d365c0
+14 w 0x10e379c0
+15 w 0x10f0c0c0
+0 r 0x10034000
+1 r 0x10121900
+2 w 0x10210fc0
+3 r 0x103302c0
+4 r 0x1041ca80
+5 r 0x1051d780
+6 r 0x106011c0
+7 r 0x1073ccc0
+8 w 0x10803c40
+9 r 0x1093dcc0
+10 r 0x10a2ce00
+11 r 0x10b148c0
+12 w 0x20002580
+13 w 0x20003540
+14 r 0x10e19c00
+15 w 0x20002600
+0 r 0x200025c0
+1 r 0x10127100
+2 w 0x10234e00
+3 w 0x103340c0
+4 r 0x1040d880
+5 r 0x10513fc0
+6 r 0x1063c140
+7 r 0x20000380
+8 r 0x10800bc0
+9 r 0x10902480
+10 r 0x20002c00
+11 r 0x10b07280
+12 r 0x10c15ac0
+13 r 0x10d30b40
+14 r 0x10e3d000
+15 r 0x10f33e80
+0 r 0x200012c0
+1 w 0x20003840
+2 w 0x10226300
+3 w 0x1032f180
+4 r 0x10430780
+5 r 0x1053ee00
+6 w 0x20000040
+7 w 0x1070e400
+8 r 0x1080d980
+9 w 0x20000cc0
+10 r 0x10a34040
+11 r 0x10b36240
+12 r 0x10c39940
+13 r 0x10d3c1c0
+14 r 0x10e05d80
+15 r 0x10f3eb00
+0 r 0x10034240
+1 r 0x10139580
+2 r 0x1021a480
+3 r 0x10325080
+4 w 0x1043bb00
+5 w 0x1051f240
+6 w 0x10632f80
+7 w 0x1070a240
+8 r 0x1083f740
+9 r 0x1093bc40
+10 w 0x20000b00
+11 r 0x10b2c100
+12 r 0x10c26d80
+13 r 0x10d04640
+14 r 0x10e0cdc0
+15 r 0x10f34d00
+0 w 0x100063c0
+1 r 0x10133b80
+2 w 0x20003240
+3 r 0x1031ff40
+4 r 0x1041a180
+5 r 0x1053b580
+6 w 0x1060a240
+7 r 0x10706980
+8 r 0x200002c0
+9 w 0x10913540
+10 w 0x20001e80
+11 w 0x20000080
+12 r 0x10c09b40
+13 w 0x10d33800
+14 r 0x10e03c40
+15 r 0x10f09dc0
+0 r 0x1002c8c0
+1 w 0x20002000
+2 w 0x10219240
+3 r 0x1033f180
+4 r 0x104091c0
+5 r 0x1050bcc0
+6 r 0x10609800
+7 r 0x10711600
+8 r 0x10827380
+9 w 0x10937e80
+10 w 0x10a24f40
+11 r 0x10b16c80
+12 r 0x10c1aa00
+13 r 0x10d202c0
+14 r 0x10e3b200
+15 r 0x200018c0
+0 w 0x10020300
+1 r 0x10136dc0
+2 r 0x1021f840
+3 r 0x10318900
+4 r 0x1043f240
+5 r 0x10505c00
+6 r 0x1061b480
+7 r 0x10723e40
+8 w 0x10835c40
+9 w 0x10904480
+10 r 0x10a28ac0
+11 r 0x20001e00
+12 w 0x10c3b9c0
+13 r 0x200015c0
+14 w 0x10e3c3c0
+15 w 0x10f3ae00
+0 w 0x100355c0
+1 r 0x10105700
+2 w 0x1020f480
+3 r 0x20003200
+4 w 0x10424c00
+5 r 0x1052d500
+6 w 0x1062a9c0
+7 r 0x20002840
+8 r 0x200006c0
+9 w 0x10916a80
+10 r 0x10a1f980
+11 w 0x10b37280
+12 r 0x10c30e80
+13 w 0x10d2c800
+14 w 0x10e3d1c0
+15 r 0x10f27700
+0 w 0x10009fc0
+1 r 0x10119c40
+2 r 0x20001e80
+3 r 0x10324980
+4 r 0x10401340
+5 r 0x1052e200
+6 w 0x200029c0
+7 r 0x1070bcc0
+8 r 0x10829800
+9 r 0x10939a40
+10 r 0x200003c0
+11 w 0x200017c0
+12 r 0x10c13900
+13 r 0x20000ec0
+14 r 0x10e28ec0
+15 w 0x10f32780
+0 w 0x1000cf00
+1 r 0x1012c880
+2 w 0x10219300
+3 r 0x1032d000
+4 r 0x10422840
+5 r 0x1051c8c0
+6 r 0x20002900
+7 r 0x1072d480
+8 r 0x20000480
+9 r 0x20003940
+10 r 0x10a32180
+11 r 0x10b0d8c0
+12 r 0x10c223c0
+13 r 0x10d04000
+14 w 0x10e079c0
+15 r 0x10f00300
+0 r 0x100286c0
+1 r 0x101073c0
+2 r 0x10231bc0
+3 r 0x1031ec40
+4 r 0x10425580
+5 w 0x1050ae40
+6 w 0x1063bf80
+7 w 0x10730000
+8 r 0x10828e40
+9 w 0x200018c0
+10 w 0x20002000
+11 r 0x10b1b3c0
+12 w 0x10c37a80
+13 r 0x10d31880
+14 r 0x10e20980
+15 r 0x10f39780
+0 r 0x1000b180
+1 w 0x10117d00
+2 w 0x10216880
+3 w 0x1030db80
+4 r 0x10428d00
+5 r 0x105253c0
+6 r 0x1061b3c0
+7 r 0x10739a80
+8 w 0x1082a240
+9 r 0x1090c780
+10 r 0x10a3ad00
+11 r 0x10b09600
+12 r 0x10c3e480
+13 w 0x20003640
+14 w 0x10e08700
+15 r 0x20000580
+0 r 0x100128c0
+1 w 0x10107b40
+2 r 0x1021b440
+3 r 0x10335540
+4 r 0x1042b880
+5 w 0x20000bc0
+6 r 0x1063f780
+7 r 0x10714500
+8 w 0x10821640
+9 r 0x1091ac40
+10 w 0x10a3cc40
+11 w 0x10b098c0
+12 r 0x10c39680
+13 r 0x10d0d3c0
+14 r 0x10e285c0
+15 w 0x10f2dd40
+0 r 0x20001580
+1 r 0x10107680
+2 r 0x102141c0
+3 r 0x10318dc0
+4 r 0x1042b240
+5 r 0x105147c0
+6 r 0x106028c0
+7 w 0x10718dc0
+8 r 0x10806e00
+9 r 0x10916d80
+10 r 0x10a16980
+11 r 0x10b35f40
+12 r 0x10c3cf80
+13 r 0x10d2c040
+14 r 0x20003000
+15 w 0x200004c0
+0 r 0x100084c0
+1 w 0x1010ea80
+2 r 0x10210500
+3 r 0x1032c700
+4 r 0x10407900
+5 r 0x10520580
+6 r 0x1060c800
+7 r 0x10734480
+8 r 0x10809380
+9 r 0x1091c540
+10 w 0x10a316c0
+11 r 0x10b284c0
+12 w 0x10c37200
+13 r 0x10d1d2c0
+14 w 0x10e0f000
+15 w 0x10f21200
+0 w 0x10026240
+1 r 0x20002300
+2 w 0x10232000
+3 r 0x1031ed40
+4 r 0x10433400
+5 r 0x10513fc0
+6 w 0x10611f80
+7 r 0x1073e980
+8 r 0x1081e880
+9 r 0x10911c40
+10 r 0x10a3ca40
+11 w 0x10b1e7c0
+12 w 0x10c0bb00
+13 r 0x10d1a9c0
+14 w 0x10e17580
+15 r 0x10f06a00
+0 w 0x10033a40
+1 r 0x1011fa80
+2 r 0x102298c0
+3 r 0x20001800
+4 r 0x10402480
+5 r 0x10507cc0
+6 r 0x10604b40
+7 w 0x10718240
+8 w 0x10822640
+9 w 0x10923a40
+10 r 0x10a282c0
+11 r 0x10b3af00
+12 r 0x10c1cb00
+13 r 0x20000b00
+14 w 0x20003100
+15 r 0x10f09340
+0 w 0x20001cc0
+1 r 0x1012cc00
+2 r 0x1020c200
+3 r 0x1032edc0
+4 w 0x10409600
+5 r 0x10527340
+6 r 0x1062e480
+7 w 0x10704680
+8 r 0x200014c0
+9 r 0x10937a40
+10 r 0x10a37a80
+11 r 0x10b13200
+12 w 0x10c05580
+13 r 0x20000b00
+14 w 0x20002300
+15 r 0x10f12bc0
+0 r 0x1000e140
+1 r 0x101374c0
+2 r 0x10211740
+3 w 0x103263c0
+4 r 0x1043e4c0
+5 r 0x1050ac00
+6 r 0x10632cc0
+7 r 0x20002b00
+8 r 0x1080b340
+9 r 0x1093a5c0
+10 r 0x10a0b240
+11 w 0x10b28040
+12 r 0x10c16d40
+13 r 0x10d09f40
+14 r 0x10e3d800
+15 w 0x10f03bc0
+0 w 0x1003d940
+1 r 0x1013cc00
+2 r 0x10225640
+3 w 0x1033e940
+4 r 0x10437680
+5 w 0x10510280
+6 r 0x1060c940
+7 r 0x10721340
+8 r 0x1080a340
+9 r 0x10933300
+10 r 0x20001380
+11 r 0x10b3b6c0
+12 r 0x10c34280
+13 r 0x10d25940
+14 r 0x10e0f700
+15 r 0x10f17bc0
+0 r 0x10023580
+1 r 0x10108f40
+2 r 0x10229480
+3 r 0x200036c0
+4 r 0x10422000
+5 r 0x1050e300
+6 r 0x20002700
+7 r 0x10709700
+8 w 0x1080b400
+9 r 0x10939b80
+10 r 0x10a03240
+11 r 0x10b173c0
+12 w 0x10c117c0
+13 r 0x10d10440
+14 r 0x10e0dc80
+15 r 0x10f22b40
+0 r 0x10031780
+1 r 0x1012f500
+2 r 0x10232280
+3 w 0x20002980
+4 r 0x20001880
+5 w 0x10531080
+6 r 0x1061c7c0
+7 r 0x10722240
+8 r 0x10834e40
+9 w 0x1090d240
+10 r 0x10a0ffc0
+11 r 0x10b0ec40
+12 r 0x20003a00
+13 r 0x20002c00
+14 r 0x10e1a600
+15 r 0x10f319c0
+0 r 0x10022580
+1 r 0x10126a40
+2 r 0x1023adc0
+3 r 0x1033de80
+4 w 0x200000c0
+5 w 0x10535240
+6 w 0x106067c0
+7 w 0x1071af40
+8 r 0x10838100
+9 w 0x1093b500
+10 r 0x10a0bf80
+11 w 0x10b19f00
+12 r 0x10c2f140
+13 r 0x20002d80
+14 r 0x10e13380
+15 r 0x10f05d40
+0 w 0x20003580
+1 r 0x20003a00
+2 r 0x10234c00
+3 r 0x103042c0
+4 r 0x10419740
+5 r 0x10501c00
+6 r 0x106130c0
+7 r 0x10704700
+8 w 0x10811e40
+9 r 0x200012c0
+10 r 0x10a12400
+11 w 0x10b0f880
+12 r 0x10c30cc0
+13 r 0x10d28d80
+14 r 0x10e38a00
+15 r 0x10f2bb00
+0 r 0x20002ec0
+1 r 0x10107dc0
+2 r 0x200032c0
+3 r 0x103395c0
+4 w 0x1042de00
+5 r 0x10507380
+6 r 0x1060f600
+7 w 0x10703a80
+8 w 0x20001c80
+9 r 0x1090f600
+10 r 0x20002980
+11 w 0x10b02c00
+12 w 0x20003980
+13 r 0x10d0b100
+14 r 0x20000a80
+15 r 0x10f24040
+0 w 0x20000b80
+1 r 0x1012efc0
+2 r 0x1021d240
+3 r 0x10323d80
+4 r 0x200013c0
+5 r 0x10539440
+6 r 0x106331c0
+7 r 0x200002c0
+8 w 0x1080d340
+9 r 0x200039c0
+10 r 0x200015c0
+11 w 0x10b3b840
+12 w 0x20002d80
+13 r 0x20002180
+14 r 0x10e2a9c0
+15 r 0x10f12740
+0 w 0x20001b40
+1 r 0x10119940
+2 r 0x10213400
+3 w 0x103343c0
+4 w 0x20000240
+5 r 0x10518400
+6 r 0x10604dc0
+7 r 0x1072bcc0
+8 w 0x1080fdc0
+9 r 0x20000680
+10 r 0x10a14ec0
+11 w 0x20000f00
+12 r 0x10c1b240
+13 r 0x10d0e840
+14 w 0x10e2cb00
+15 w 0x10f00700
+0 r 0x1001f7c0
+1 w 0x10131040
+2 w 0x1021cac0
+3 r 0x1030d100
+4 r 0x10409e40
+5 r 0x1052f700
+6 r 0x106098c0
+7 r 0x1070c0c0
+8 r 0x1082bf40
+9 r 0x10902900
+10 w 0x10a23d40
+11 r 0x20003f00
+12 r 0x10c324c0
+13 r 0x10d0b080
+14 r 0x10e3e900
+15 r 0x10f2a200
+0 r 0x20002f40
+1 r 0x1013ec00
+2 w 0x1020ff00
+3 r 0x20001400
+4 w 0x20003300
+5 r 0x1050cf80
+6 r 0x1060b880
+7 w 0x10708e40
+8 r 0x10828c80
+9 r 0x1091df40
+10 r 0x10a312c0
+11 r 0x10b06200
+12 r 0x10c20880
+13 w 0x20002980
+14 r 0x10e36300
+15 r 0x20000c80
+0 r 0x100016c0
+1 w 0x1012d900
+2 r 0x1022df40
+3 r 0x1031be40
+4 r 0x10439380
+5 r 0x10524540
+6 r 0x10636740
+7 r 0x10731e40
+8 r 0x10827600
+9 r 0x109092c0
+10 r 0x10a01900
+11 r 0x10b21cc0
+12 r 0x10c0af00
+13 w 0x10d16500
+14 r 0x10e22140
+15 r 0x10f2c9c0
+0 r 0x10036040
+1 r 0x101272c0
+2 r 0x10201800
+3 w 0x20001900
+4 r 0x10418200
+5 r 0x20001e40
+6 r 0x10602ec0
+7 r 0x10717140
+8 w 0x10836c00
+9 w 0x109337c0
+10 r 0x10a22240
+11 r 0x10b27040
+12 r 0x10c26b00
+13 r 0x20003ec0
+14 w 0x10e299c0
+15 w 0x10f3e0c0
+0 w 0x100073c0
+1 w 0x10125b40
+2 r 0x20000200
+3 r 0x1032c240
+4 r 0x10410c00
+5 r 0x1052b040
+6 r 0x20000fc0
+7 r 0x10732980
+8 r 0x108054c0
+9 r 0x20002d00
+10 r 0x10a1b880
+11 r 0x10b27300
+12 r 0x10c02a40
+13 w 0x10d2e280
+14 r 0x10e3c640
+15 w 0x10f27800
+0 r 0x10000580
+1 r 0x10118bc0
+2 r 0x10228440
+3 w 0x1030a400
+4 r 0x104083c0
+5 w 0x10510580
+6 r 0x1062d080
+7 r 0x10719f00
+8 w 0x20002740
+9 w 0x1091e940
+10 w 0x10a25e00
+11 r 0x10b31140
+12 r 0x20001f40
+13 w 0x20003a00
+14 w 0x20002940
+15 r 0x10f00f80
+0 r 0x1002c800
+1 w 0x1012e580
+2 w 0x20002a40
+3 r 0x10334940
+4 w 0x1043c100
+5 r 0x1052a040
+6 r 0x106242c0
+7 r 0x10736a00
+8 r 0x1081e740
+9 r 0x10922fc0
+10 w 0x10a246c0
+11 r 0x10b22e40
+12 r 0x10c3b100
+13 w 0x200022c0
+14 r 0x10e0da00
+15 w 0x10f10f00
+0 r 0x10018e00
+1 w 0x20003bc0
+2 w 0x10221600
+3 r 0x10333e40
+4 r 0x10412180
+5 r 0x105121c0
+6 r 0x10607900
+7 w 0x10713500
+8 r 0x10813e80
+9 w 0x10917940
+10 r 0x10a36d00
+11 w 0x10b31080
+12 r 0x10c31fc0
+13 w 0x20001bc0
+14 w 0x20003b40
+15 r 0x10f2ea40
+0 r 0x10000b40
+1 r 0x10115c40
+2 w 0x10215940
+3 w 0x1030ec40
+4 r 0x1041fe80
+5 r 0x10539440
+6 r 0x20001280
+7 r 0x20002a40
+8 w 0x1082adc0
+9 w 0x10932e40
+10 w 0x10a17d80
+11 r 0x10b3ba80
+12 w 0x10c26a80
+13 r 0x10d30900
+14 w 0x20002000
+15 r 0x10f3d880
+0 r 0x10024900
+1 r 0x10122880
+2 r 0x20000b00
+3 w 0x20003380
+4 r 0x20002140
+5 r 0x10522f80
+6 r 0x10611d80
+7 w 0x200015c0
+8 r 0x1081b0c0
+9 r 0x20001ac0
+10 r 0x10a0fc40
+11 w 0x10b28280
+12 w 0x10c3a000
+13 r 0x10d27d40
+14 w 0x20003ec0
+15 r 0x10f0bf00
+0 w 0x1001ad80
+1 r 0x20003c00
+2 w 0x20002e40
+3 w 0x1030ce00
+4 r 0x10429380
+5 w 0x1052eb80
+6 w 0x106371c0
+7 w 0x10736400
+8 r 0x1080f1c0
+9 w 0x200012c0
+10 r 0x10a0f400
+11 r 0x10b126c0
+12 r 0x10c3e440
+13 r 0x20003700
+14 r 0x20003180
+15 w 0x10f38280
+0 r 0x10027b40
+1 w 0x20000740
+2 r 0x1020cd40
+3 r 0x1033afc0
+4 r 0x200034c0
+5 r 0x10538a40
+6 r 0x10635580
+7 r 0x10708e80
+8 r 0x10807800
+9 r 0x10900d80
+10 r 0x10a1f980
+11 r 0x10b27940
+12 w 0x10c1e540
+13 w 0x10d26fc0
+14 w 0x10e18f00
+15 w 0x10f18bc0
+0 w 0x1003ee00
+1 r 0x101069c0
+2 w 0x1021ae00
+3 r 0x1032c300
+4 r 0x1043bb40
+5 w 0x200016c0
+6 r 0x10601f00
+7 r 0x20002380
+8 r 0x10814ec0
+9 r 0x10905940
+10 r 0x10a1b1c0
+11 r 0x10b3c480
+12 r 0x20000a40
+13 w 0x10d1e140
+14 r 0x10e1d6c0
+15 r 0x10f35a00
+0 w 0x1002c140
+1 r 0x1013b100
+2 r 0x1023f780
+3 w 0x10335240
+4 r 0x1043b700
+5 w 0x1052ad40
+6 r 0x10623980
+7 r 0x10722880
+8 r 0x1083b500
+9 r 0x109336c0
+10 r 0x20003680
+11 r 0x10b17600
+12 r 0x10c3a900
+13 w 0x20002200
+14 r 0x10e25cc0
+15 r 0x10f01540
+0 r 0x1000cf40
+1 r 0x1011f2c0
+2 r 0x1020d5c0
+3 w 0x20002300
+4 w 0x1040c9c0
+5 w 0x20003d40
+6 r 0x1061bc00
+7 r 0x1071bb80
+8 w 0x20001c40
+9 w 0x20001280
+10 r 0x10a16d00
+11 w 0x10b14840
+12 r 0x20000ec0
+13 r 0x10d11100
+14 r 0x10e288c0
+15 r 0x10f1adc0
+0 r 0x1003c7c0
+1 w 0x10103c80
+2 w 0x102072c0
+3 r 0x103323c0
+4 r 0x1043d640
+5 r 0x10536600
+6 r 0x20000a80
+7 r 0x10716600
+8 w 0x10806b00
+9 r 0x200005c0
+10 w 0x10a31a40
+11 w 0x10b1a8c0
+12 w 0x10c23180
+13 w 0x10d29340
+14 w 0x20003280
+15 w 0x20000540
+0 r 0x1002eac0
+1 r 0x101343c0
+2 r 0x10230600
+3 w 0x1032b400
+4 r 0x1043f2c0
+5 r 0x10519540
+6 r 0x10626a80
+7 w 0x1072acc0
+8 w 0x108162c0
+9 w 0x10936c80
+10 r 0x10a37840
+11 w 0x10b1e240
+12 r 0x10c0f700
+13 r 0x10d2a400
+14 r 0x10e18f00
+15 w 0x10f0bac0
+0 w 0x1000ac00
+1 r 0x1013fdc0
+2 w 0x20003e80
+3 w 0x10301ac0
+4 r 0x10413880
+5 r 0x10529840
+6 r 0x106376c0
+7 r 0x10701200
+8 r 0x10802a80
+9 r 0x1093ff00
+10 w 0x10a3ba00
+11 w 0x20000700
+12 r 0x200000c0
+13 r 0x10d3d440
+14 r 0x10e07ec0
+15 w 0x10f06880
+0 w 0x20001380
+1 r 0x101126c0
+2 w 0x1022b280
+3 w 0x20001b40
+4 r 0x104012c0
+5 r 0x1051d4c0
+6 r 0x106301c0
+7 w 0x10717500
+8 r 0x20002b80
+9 r 0x109043c0
+10 r 0x10a1f4c0
+11 w 0x200039c0
+12 r 0x10c33140
+13 r 0x10d2b980
+14 r 0x10e0dc00
+15 w 0x10f32dc0
+0 r 0x20001c80
+1 r 0x10126900
+2 r 0x1023cb00
+3 r 0x10321f80
+4 r 0x20000d00
+5 r 0x10517800
+6 r 0x10638000
+7 w 0x20000dc0
+8 r 0x10824300
+9 r 0x10924880
+10 r 0x10a2d540
+11 w 0x10b0b540
+12 w 0x10c34380
+13 r 0x10d20300
+14 w 0x20000e00
+15 r 0x200017c0
+0 r 0x10011c80
+1 w 0x1011c3c0
+2 w 0x20003840
+3 r 0x1033fb40
+4 w 0x20003e40
+5 r 0x1053b300
+6 w 0x20002fc0
+7 w 0x1070aec0
+8 r 0x10825840
+9 r 0x10917000
+10 r 0x10a10840
+11 w 0x10b0d680
+12 r 0x10c39240
+13 r 0x10d26280
+14 r 0x10e17a80
+15 w 0x10f12b80
+0 r 0x10037900
+1 r 0x101131c0
+2 r 0x1021fd40
+3 w 0x10300980
+4 r 0x10404f40
+5 r 0x105152c0
+6 r 0x1060fb00
+7 r 0x107056c0
+8 r 0x20001580
+9 r 0x1091b840
+10 w 0x10a08480
+11 r 0x10b17240
+12 r 0x200005c0
+13 w 0x200007c0
+14 w 0x10e0b940
+15 w 0x10f01780
+0 r 0x1000e900
+1 w 0x200022c0
+2 w 0x10205d00
+3 r 0x1030b100
+4 w 0x10403a40
+5 r 0x1052fe00
+6 r 0x1063d0c0
+7 w 0x10713e40
+8 r 0x10831700
+9 r 0x1090d080
+10 r 0x10a2adc0
+11 r 0x20000e40
+12 r 0x10c088c0
+13 r 0x10d18680
+14 w 0x10e1f4c0
+15 w 0x10f13040
+0 r 0x1003e800
+1 w 0x1012aa80
+2 r 0x10217680
+3 r 0x1030a4c0
+4 r 0x1041af00
+5 r 0x1053ea00
+6 r 0x1062e7c0
+7 w 0x10717440
+8 r 0x20001b40
+9 r 0x200036c0
+10 r 0x10a33f40
+11 w 0x20001e40
+12 r 0x10c3ba80
+13 r 0x10d23700
+14 r 0x10e2ee80
+15 r 0x10f3aa00
+0 r 0x10035ac0
+1 w 0x10121d00
+2 w 0x1023c640
+3 r 0x103175c0
+4 r 0x10433080
+5 r 0x1053f700
+6 r 0x20003000
+7 w 0x10729ec0
+8 r 0x10800c40
+9 w 0x10934c00
+10 w 0x10a3a540
+11 r 0x10b07bc0
+12 r 0x10c177c0
+13 r 0x10d09c00
+14 r 0x10e08700
+15 w 0x10f26400
+0 r 0x10000180
+1 w 0x20001800
+2 r 0x1023bb40
+3 r 0x20003b80
+4 r 0x1042d8c0
+5 r 0x1052e700
+6 r 0x10635380
+7 w 0x1070ae40
+8 r 0x10800740
+9 r 0x1090c0c0
+10 r 0x10a0be00
+11 r 0x10b15b80
+12 w 0x10c319c0
+13 r 0x20000300
+14 r 0x10e12c80
+15 w 0x20000e00
+0 w 0x10006780
+1 r 0x1010a680
+2 w 0x10236d00
+3 r 0x10330440
+4 w 0x20002280
+5 r 0x10510800
+6 r 0x10627c80
+7 r 0x10706000
+8 r 0x10814700
+9 r 0x1092bd80
+10 r 0x20000140
+11 r 0x10b0c000
+12 r 0x10c27080
+13 r 0x20000f40
+14 r 0x20003a00
+15 w 0x20000400
+0 r 0x100238c0
+1 r 0x10133740
+2 w 0x1022ad80
+3 r 0x1033e9c0
+4 r 0x1040be00
+5 r 0x1053b280
+6 r 0x20000880
+7 w 0x10701b80
+8 w 0x20001400
+9 w 0x10903880
+10 w 0x20000040
+11 r 0x10b2bd00
+12 r 0x10c08d40
+13 r 0x10d14cc0
+14 r 0x10e161c0
+15 r 0x10f03440
+0 w 0x10022200
+1 r 0x10134780
+2 w 0x1023e900
+3 r 0x200025c0
+4 r 0x10429740
+5 r 0x20001000
+6 w 0x10610340
+7 r 0x10706700
+8 r 0x10829180
+9 r 0x10916b00
+10 r 0x10a1e600
+11 r 0x20000480
+12 r 0x10c37ac0
+13 w 0x20000480
+14 r 0x10e2ca00
+15 r 0x10f364c0
+0 w 0x20003900
+1 r 0x10101c80
+2 r 0x10231380
+3 r 0x20003080
+4 r 0x10412c00
+5 w 0x1051af80
+6 r 0x1061abc0
+7 r 0x1072c9c0
+8 r 0x20001b00
+9 w 0x10911a80
+10 r 0x10a093c0
+11 w 0x10b11ec0
+12 r 0x10c23540
+13 r 0x10d27500
+14 r 0x10e16a80
+15 w 0x200008c0
+0 r 0x1002e300
+1 r 0x20000980
+2 r 0x10222200
+3 w 0x1030e500
+4 r 0x104094c0
+5 w 0x200005c0
+6 w 0x1063fb40
+7 r 0x10711880
+8 r 0x108134c0
+9 w 0x109102c0
+10 w 0x200002c0
+11 r 0x10b2bf00
+12 r 0x10c0a740
+13 w 0x10d30d00
+14 r 0x10e2a980
+15 r 0x10f06700
+0 w 0x200010c0
+1 r 0x10136e40
+2 w 0x20003ec0
+3 r 0x10323840
+4 w 0x10420d40
+5 w 0x20003740
+6 w 0x20002980
+7 w 0x20000e00
+8 r 0x1083fa00
+9 r 0x10928b80
+10 r 0x10a01340
+11 r 0x20000e80
+12 r 0x10c126c0
+13 w 0x10d18e00
+14 w 0x10e119c0
+15 w 0x10f065c0
+0 r 0x1003d980
+1 r 0x1010ca40
+2 r 0x10214e40
+3 r 0x103217c0
+4 r 0x200019c0
+5 w 0x10517f80
+6 r 0x106091c0
+7 w 0x10700780
+8 w 0x10819f80
+9 r 0x109035c0
+10 r 0x10a16580
+11 r 0x10b169c0
+12 r 0x10c3dc00
+13 w 0x10d27980
+14 r 0x200023c0
+15 w 0x20001600
+0 w 0x200001c0
+1 r 0x1010e800
+2 r 0x1022eb80
+3 r 0x1030e480
+4 w 0x1040e500
+5 r 0x10514d00
+6 w 0x1063ee00
+7 r 0x1071a280
+8 r 0x1082ce00
+9 r 0x20000880
+10 w 0x10a35340
+11 w 0x20001b40
+12 w 0x10c3de00
+13 r 0x10d31e00
+14 w 0x10e25280
+15 r 0x20003ec0
+0 r 0x10030500
+1 w 0x20003b00
+2 r 0x1023cd80
+3 r 0x103123c0
+4 r 0x10411cc0
+5 r 0x1053a100
+6 w 0x1061f940
+7 r 0x1071ee00
+8 r 0x20003b00
+9 w 0x1090c3c0
+10 w 0x10a0afc0
+11 w 0x10b12940
+12 w 0x10c3e380
+13 r 0x10d39280
+14 r 0x10e0f800
+15 w 0x10f28a40
+0 w 0x10006f40
+1 r 0x10119880
+2 w 0x10224540
+3 r 0x10320300
+4 r 0x20001c00
+5 r 0x1052dac0
+6 r 0x10621980
+7 r 0x10738440
+8 r 0x1080e6c0
+9 w 0x20000a00
+10 w 0x10a0b600
+11 r 0x20001540
+12 r 0x10c07680
+13 r 0x10d137c0
+14 w 0x10e2f800
+15 r 0x10f30940
+0 w 0x100364c0
+1 w 0x1013a300
+2 r 0x1023d000
+3 r 0x20003600
+4 w 0x1041cf00
+5 r 0x1052eb00
+6 r 0x1061a180
+7 r 0x10734840
+8 r 0x20001d80
+9 r 0x109278c0
+10 r 0x10a26f40
+11 w 0x10b287c0
+12 r 0x10c094c0
+13 w 0x20003d80
+14 r 0x20000a00
+15 w 0x20001a00
+0 w 0x1000d940
+1 r 0x10136c00
+2 r 0x10233000
+3 w 0x10335680
+4 w 0x10416580
+5 r 0x10515d00
+6 w 0x20000800
+7 r 0x10735300
+8 r 0x10829200
+9 r 0x10912340
+10 r 0x10a13940
+11 w 0x200006c0
+12 w 0x10c2a500
+13 r 0x10d267c0
+14 r 0x10e33840
+15 w 0x10f160c0
+0 w 0x20002540
+1 r 0x101092c0
+2 w 0x1020ef40
+3 r 0x1033ad80
+4 r 0x1040d680
+5 r 0x10501100
+6 r 0x1062eec0
+7 r 0x1072fb00
+8 w 0x20000440
+9 w 0x10918000
+10 r 0x200014c0
+11 r 0x10b12a40
+12 w 0x10c36800
+13 r 0x10d19740
+14 r 0x10e1c640
+15 w 0x20002e40
+0 r 0x100105c0
+1 r 0x10101a40
+2 r 0x10215280
+3 w 0x10333240
+4 w 0x10409300
+5 w 0x10502440
+6 w 0x10600f00
+7 w 0x20001240
+8 r 0x1083a040
+9 r 0x200030c0
+10 r 0x10a2ac80
+11 r 0x20001e80
+12 w 0x20001c80
+13 r 0x10d04800
+14 r 0x10e38800
+15 r 0x10f36980
+0 r 0x1002ef40
+1 r 0x101175c0
+2 w 0x1021ebc0
+3 w 0x1032a000
+4 r 0x10432980
+5 w 0x20000540
+6 r 0x1063c9c0
+7 w 0x1073c400
+8 r 0x1082a540
+9 r 0x20001040
+10 w 0x200016c0
+11 r 0x10b1e2c0
+12 r 0x10c19280
+13 r 0x10d1f0c0
+14 r 0x20003140
+15 w 0x10f35d00
+0 r 0x10027f40
+1 w 0x10136280
+2 w 0x10213400
+3 w 0x1031f3c0
+4 r 0x10425980
+5 r 0x10520780
+6 w 0x1061e740
+7 r 0x10732080
+8 w 0x10820900
+9 w 0x10908900
+10 r 0x10a35300
+11 r 0x10b2cfc0
+12 r 0x10c30840
+13 r 0x20003140
+14 w 0x10e17e40
+15 r 0x10f29040
+0 r 0x10032a00
+1 w 0x20000000
+2 r 0x20000380
+3 w 0x10320580
+4 w 0x10414380
+5 r 0x10516980
+6 r 0x10607ec0
+7 w 0x1073f500
+8 w 0x1083c9c0
+9 w 0x1092e300
+10 w 0x10a1ab80
+11 r 0x10b351c0
+12 r 0x10c1bb00
+13 r 0x200037c0
+14 r 0x10e1a280
+15 r 0x10f3ff00
+0 r 0x10036ec0
+1 r 0x10118980
+2 r 0x10213940
+3 r 0x1030a600
+4 w 0x20001cc0
+5 r 0x10519180
+6 r 0x10614a80
+7 r 0x20001380
+8 r 0x10825f40
+9 r 0x1091f3c0
+10 r 0x10a04dc0
+11 r 0x10b3b380
+12 r 0x10c1af80
+13 r 0x10d32dc0
+14 r 0x10e2bf40
+15 r 0x200017c0
+0 r 0x10016640
+1 r 0x10100380
+2 r 0x1021ae00
+3 r 0x10331f00
+4 r 0x10435980
+5 r 0x10520e00
+6 w 0x1060e940
+7 r 0x10715880
+8 w 0x1083d9c0
+9 r 0x10925300
+10 w 0x10a2f100
+11 r 0x10b218c0
+12 r 0x10c3d6c0
+13 r 0x10d0a680
+14 r 0x10e05980
+15 w 0x10f3a140
+0 w 0x20000c80
+1 r 0x20001cc0
+2 r 0x1023c680
+3 r 0x10327b80
+4 r 0x10408940
+5 r 0x10510900
+6 w 0x10626540
+7 w 0x20003000
+8 w 0x10822e40
+9 w 0x20003700
+10 w 0x10a38480
+11 w 0x10b32a00
+12 r 0x10c2df00
+13 r 0x10d31280
+14 w 0x10e13800
+15 r 0x10f10380
+0 r 0x1003e280
+1 r 0x1011a6c0
+2 r 0x20003dc0
+3 w 0x103049c0
+4 w 0x10433cc0
+5 w 0x1050f9c0
+6 r 0x10606140
+7 r 0x1073f200
+8 w 0x1081a940
+9 w 0x200002c0
+10 r 0x10a19ec0
+11 w 0x10b1f4c0
+12 r 0x10c34880
+13 w 0x10d1a140
+14 w 0x10e30900
+15 r 0x10f351c0
+0 r 0x1001d700
+1 r 0x20001580
+2 r 0x10229b80
+3 r 0x1030ed80
+4 r 0x1042ca80
+5 r 0x10530b80
+6 w 0x10633480
+7 w 0x10700280
+8 r 0x10822140
+9 r 0x10932b00
+10 w 0x20002dc0
+11 w 0x10b014c0
+12 r 0x20000c80
+13 r 0x10d3eac0
+14 r 0x10e12480
+15 r 0x10f033c0
+0 r 0x1002c240
+1 w 0x1011b580
+2 r 0x200035c0
+3 w 0x10307ac0
+4 r 0x20000440
+5 r 0x105114c0
+6 w 0x20001700
+7 r 0x107127c0
+8 w 0x20003a80
+9 w 0x1093fd40
+10 r 0x10a26780
+11 r 0x10b237c0
+12 r 0x10c0ab00
+13 w 0x10d29cc0
+14 r 0x10e06d40
+15 r 0x10f3de00
+0 r 0x10003040
+1 w 0x101159c0
+2 r 0x20003500
+3 w 0x10300280
+4 r 0x10415740
+5 r 0x10525380
+6 r 0x10625640
+7 w 0x1071c880
+8 r 0x20003b00
+9 r 0x10917ec0
+10 w 0x10a0cc40
+11 r 0x10b16180
+12 r 0x10c3c540
+13 r 0x20001800
+14 w 0x20001780
+15 r 0x10f14200
+0 r 0x10005ec0
+1 r 0x10120000
+2 r 0x200030c0
+3 r 0x103100c0
+4 r 0x104218c0
+5 r 0x1052d440
+6 r 0x1062b540
+7 r 0x200024c0
+8 r 0x10815480
+9 w 0x1090a7c0
+10 r 0x10a1f280
+11 r 0x10b2fb80
+12 w 0x10c34fc0
+13 w 0x10d21e80
+14 r 0x10e1da80
+15 w 0x10f33b00
+0 w 0x10002700
+1 r 0x10137480
+2 w 0x10230fc0
+3 r 0x1033e7c0
+4 w 0x1042ee80
+5 r 0x1052cdc0
+6 r 0x1062cf40
+7 r 0x10721d40
+8 r 0x10829bc0
+9 r 0x10920180
+10 r 0x10a012c0
+11 w 0x10b39280
+12 r 0x10c00280
+13 w 0x10d25840
+14 w 0x10e18600
+15 w 0x10f10440
+0 r 0x1003eb80
+1 r 0x1011b940
+2 r 0x10214640
+3 w 0x20002c40
+4 r 0x1042adc0
+5 r 0x10534200
+6 w 0x106077c0
+7 r 0x20003080
+8 w 0x108030c0
+9 r 0x1091c3c0
+10 w 0x20003400
+11 w 0x20002140
+12 r 0x20001080
+13 w 0x20000a00
+14 w 0x10e09480
+15 r 0x10f1d9c0
+0 w 0x10028140
+1 w 0x10103e80
+2 r 0x1020d740
+3 r 0x1033bc40
+4 r 0x1041fa00
+5 w 0x20001100
+6 r 0x106082c0
+7 w 0x10728140
+8 r 0x10820680
+9 r 0x10915900
+10 w 0x20000540
+11 r 0x10b37d80
+12 r 0x10c07040
+13 w 0x20003bc0
+14 r 0x20002140
+15 r 0x10f1cb40
+0 r 0x1000e940
+1 r 0x1010fa80
+2 w 0x1020c100
+3 r 0x10323200
+4 r 0x104289c0
+5 r 0x20002380
+6 r 0x20002e80
+7 r 0x10716100
+8 r 0x10820d80
+9 r 0x1091e640
+10 w 0x10a302c0
+11 r 0x10b0bc00
+12 r 0x10c37c80
+13 r 0x10d18340
+14 r 0x10e25840
+15 w 0x10f0bdc0
+0 r 0x10025540
+1 r 0x1013e9c0
+2 r 0x10212340
+3 w 0x1033abc0
+4 w 0x10403b40
+5 w 0x10508c80
+6 r 0x20003840
+7 w 0x107258c0
+8 w 0x1081c900
+9 w 0x20003740
+10 w 0x10a29cc0
+11 w 0x10b27f40
+12 r 0x10c14440
+13 r 0x10d20340
+14 r 0x10e37d40
+15 w 0x20003b00
+0 r 0x1001ab40
+1 r 0x10104c40
+2 r 0x1022de40
+3 r 0x20000680
+4 r 0x104243c0
+5 r 0x1051d840
+6 w 0x1062fcc0
+7 r 0x10731b80
+8 w 0x200037c0
+9 r 0x20003f80
+10 r 0x10a06c80
+11 r 0x10b22780
+12 r 0x10c079c0
+13 r 0x10d3b940
+14 r 0x20003f80
+15 r 0x10f10100
+0 w 0x10020bc0
+1 w 0x1013cf80
+2 w 0x20002e40
+3 w 0x20003b80
+4 r 0x1042e4c0
+5 r 0x105118c0
+6 r 0x1061c680
+7 w 0x20000940
+8 r 0x10802240
+9 r 0x109091c0
+10 r 0x10a16540
+11 r 0x10b22540
+12 w 0x20000d80
+13 w 0x20000100
+14 w 0x10e2aa80
+15 w 0x10f3c880
+0 r 0x10017080
+1 r 0x10102cc0
+2 r 0x10221900
+3 r 0x10332ac0
+4 r 0x10413940
+5 w 0x200011c0
+6 r 0x10620000
+7 r 0x10705380
+8 r 0x10826d80
+9 r 0x1091f740
+10 w 0x10a25b40
+11 r 0x20002e00
+12 w 0x10c1d080
+13 r 0x20002b40
+14 r 0x10e0b180
+15 w 0x10f334c0
+0 r 0x10025900
+1 w 0x10125dc0
+2 r 0x1023a280
+3 r 0x10303940
+4 r 0x1041e3c0
+5 r 0x10516880
+6 r 0x10604a40
+7 w 0x10708600
+8 w 0x108126c0
+9 r 0x1093b780
+10 r 0x10a23440
+11 w 0x10b1e2c0
+12 r 0x10c09940
+13 r 0x20003a00
+14 r 0x10e39f80
+15 w 0x10f1ed80
+0 r 0x20000040
+1 r 0x10103540
+2 w 0x20000d80
+3 r 0x10333880
+4 r 0x10436600
+5 r 0x1051da80
+6 r 0x1062d9c0
+7 r 0x20001440
+8 r 0x10806580
+9 r 0x109022c0
+10 w 0x20001180
+11 r 0x10b01600
+12 w 0x10c242c0
+13 r 0x10d29900
+14 w 0x10e19000
+15 r 0x20002380
+0 w 0x10014d40
+1 r 0x10135140
+2 r 0x102253c0
+3 w 0x200028c0
+4 w 0x20003b40
+5 r 0x20001ac0
+6 r 0x10630140
+7 w 0x1072d280
+8 r 0x1083c700
+9 r 0x1092f000
+10 r 0x10a2f540
+11 w 0x10b2f680
+12 r 0x10c02180
+13 r 0x10d30a00
+14 w 0x10e34a00
+15 r 0x10f05980
+0 w 0x10014d00
+1 r 0x1010dc00
+2 r 0x10219200
+3 w 0x10339600
+4 r 0x10414280
+5 w 0x20001940
+6 w 0x20002dc0
+7 r 0x107088c0
+8 r 0x1082a3c0
+9 r 0x10902d40
+10 r 0x20000c40
+11 w 0x10b067c0
+12 r 0x10c3fd80
+13 r 0x10d35700
+14 w 0x20001f80
+15 w 0x10f18000
+0 r 0x200004c0
+1 r 0x10123b00
+2 r 0x1022a880
+3 r 0x10339140
+4 r 0x1043bcc0
+5 w 0x10524900
+6 r 0x106209c0
+7 r 0x1071ad40
+8 r 0x10800f80
+9 w 0x10922e00
+10 w 0x20001680
+11 r 0x10b2bb40
+12 w 0x10c329c0
+13 r 0x10d06600
+14 r 0x10e13680
+15 w 0x20001900
+0 w 0x10026380
+1 r 0x10109540
+2 w 0x10210500
+3 r 0x103258c0
+4 w 0x10433680
+5 r 0x10518540
+6 r 0x20003080
+7 r 0x10723a80
+8 r 0x1080c6c0
+9 w 0x1091ff40
+10 w 0x10a1d9c0
+11 w 0x20001980
+12 r 0x10c24bc0
+13 r 0x10d1bb40
+14 r 0x10e3fe80
+15 r 0x10f20080
+0 r 0x1001dc80
+1 w 0x101130c0
+2 w 0x20000f40
+3 r 0x10326e00
+4 r 0x104010c0
+5 w 0x20001a40
+6 r 0x20001680
+7 w 0x200037c0
+8 w 0x20001500
+9 w 0x1092b640
+10 r 0x10a03440
+11 r 0x10b3b700
+12 w 0x10c23480
+13 w 0x20001000
+14 w 0x20001ec0
+15 w 0x200015c0
+0 r 0x1000c900
+1 r 0x1010d240
+2 w 0x10237400
+3 w 0x10322240
+4 r 0x10403b00
+5 r 0x20001500
+6 w 0x10601780
+7 w 0x10728500
+8 w 0x10813380
+9 w 0x109161c0
+10 w 0x10a38a80
+11 w 0x10b12d80
+12 r 0x10c34100
+13 r 0x10d34dc0
+14 r 0x10e0f340
+15 r 0x10f1c380
+0 r 0x100130c0
+1 r 0x10139e00
+2 r 0x10235180
+3 w 0x200024c0
+4 r 0x10402bc0
+5 r 0x20003940
+6 r 0x10628c40
+7 r 0x10711f00
+8 r 0x10836740
+9 w 0x10912200
+10 w 0x10a1de40
+11 r 0x10b08dc0
+12 r 0x20003280
+13 r 0x10d11680
+14 w 0x10e19200
+15 w 0x10f18380
+0 r 0x10013fc0
+1 w 0x10119a00
+2 r 0x1022e700
+3 r 0x10325200
+4 r 0x1041d140
+5 w 0x200023c0
+6 w 0x10634f00
+7 r 0x10705b40
+8 w 0x20001700
+9 r 0x10936a40
+10 w 0x10a09240
+11 w 0x20003300
+12 w 0x20001280
+13 r 0x20003cc0
+14 r 0x10e1d340
+15 r 0x10f24740
+0 w 0x1001c4c0
+1 w 0x10103bc0
+2 r 0x10224cc0
+3 r 0x1032c1c0
+4 r 0x10429a00
+5 w 0x1050eac0
+6 r 0x10639b80
+7 r 0x1071aa80
+8 r 0x10816a80
+9 r 0x10915080
+10 w 0x10a015c0
+11 r 0x10b27ac0
+12 r 0x10c0e840
+13 r 0x10d09200
+14 r 0x200011c0
+15 w 0x10f23f00
+0 w 0x20002ec0
+1 r 0x20003280
+2 r 0x20003780
+3 r 0x10325dc0
+4 r 0x10406ac0
+5 w 0x1051b740
+6 w 0x1061af80
+7 w 0x10720500
+8 r 0x1080bb40
+9 w 0x10920300
+10 r 0x10a20680
+11 w 0x10b23dc0
+12 r 0x10c0f200
+13 r 0x20000cc0
+14 w 0x10e18400
+15 r 0x10f0ae00
+0 w 0x1002a680
+1 r 0x10107740
+2 r 0x10233f80
+3 r 0x103153c0
+4 r 0x20002080
+5 r 0x10519740
+6 r 0x10624d40
+7 r 0x10711000
+8 w 0x1081df40
+9 r 0x109359c0
+10 r 0x10a18b40
+11 w 0x20002340
+12 r 0x10c3d740
+13 r 0x10d140c0
+14 r 0x10e25880
+15 r 0x10f2bd80
+0 r 0x20000bc0
+1 r 0x1012ab40
+2 w 0x10208900
+3 r 0x10336800
+4 w 0x1042e580
+5 r 0x1050c600
+6 r 0x10637dc0
+7 r 0x1071f540
+8 r 0x10800400
+9 r 0x1091ca40
+10 r 0x10a3eb80
+11 r 0x10b21880
+12 w 0x10c29800
+13 r 0x10d30100
+14 w 0x10e0c0c0
+15 r 0x10f3f5c0
+0 r 0x1000e600
+1 w 0x1012e340
+2 r 0x102397c0
+3 r 0x10328f40
+4 r 0x20002640
+5 w 0x10515140
+6 r 0x10606940
+7 r 0x1072e940
+8 r 0x10829080
+9 r 0x10905e80
+10 w 0x10a2bfc0
+11 w 0x20003d40
+12 r 0x10c255c0
+13 w 0x10d34b00
+14 w 0x20002900
+15 r 0x10f01000
+0 r 0x100110c0
+1 w 0x101313c0
+2 r 0x20002e80
+3 r 0x1033cf00
+4 r 0x1042e840
+5 w 0x105292c0
+6 r 0x20002700
+7 r 0x20001740
+8 r 0x10804b00
+9 r 0x10903440
+10 r 0x10a2b800
+11 r 0x20000200
+12 r 0x20002c40
+13 w 0x20000ec0
+14 r 0x10e07800
+15 r 0x10f33ec0
+0 r 0x20002940
+1 w 0x20003e80
+2 r 0x10219740
+3 r 0x10336100
+4 r 0x20000880
+5 w 0x1053f340
+6 r 0x20001bc0
+7 r 0x20002040
+8 r 0x10805e40
+9 r 0x109389c0
+10 r 0x20002940
+11 w 0x10b0b040
+12 w 0x10c1f1c0
+13 r 0x10d387c0
+14 r 0x10e12880
+15 w 0x10f11900
+0 r 0x1002a5c0
+1 r 0x200027c0
+2 r 0x1020ec80
+3 r 0x20002600
+4 w 0x200035c0
+5 r 0x10521200
+6 r 0x10634c40
+7 w 0x20002b40
+8 w 0x1082ce00
+9 r 0x10906440
+10 r 0x10a21000
+11 w 0x20000dc0
+12 r 0x10c112c0
+13 r 0x10d2b500
+14 r 0x10e27f00
+15 r 0x10f35fc0
+0 r 0x1003ccc0
+1 w 0x10128480
+2 w 0x10214e80
+3 r 0x10301340
+4 r 0x1041fe80
+5 r 0x1050fe80
+6 r 0x1063e300
+7 r 0x10728680
+8 w 0x10839900
+9 w 0x1090bcc0
+10 r 0x10a3b900
+11 r 0x20001c80
+12 r 0x10c17640
+13 r 0x10d1a780
+14 r 0x10e3f640
+15 r 0x20002040
+0 w 0x1001ff00
+1 w 0x20003d40
+2 r 0x10222cc0
+3 r 0x1030f200
+4 r 0x10413100
+5 r 0x105252c0
+6 r 0x10632740
+7 r 0x20000cc0
+8 r 0x1082f100
+9 r 0x1093d740
+10 r 0x20002ac0
+11 w 0x20002100
+12 r 0x10c2b800
+13 w 0x10d16040
+14 r 0x20003380
+15 r 0x10f36ac0
+0 w 0x20001980
+1 w 0x1012d400
+2 r 0x1023fa80
+3 r 0x10334100
+4 r 0x1041f940
+5 r 0x10513400
+6 r 0x1063f840
+7 r 0x10702640
+8 w 0x1082cf40
+9 r 0x10914380
+10 r 0x10a207c0
+11 r 0x10b1b1c0
+12 r 0x10c2b780
+13 w 0x10d1e840
+14 w 0x10e34a80
+15 r 0x10f2bd00
+0 r 0x10023bc0
+1 r 0x10139c00
+2 r 0x20001b80
+3 w 0x10309b00
+4 r 0x10414cc0
+5 w 0x20001540
+6 w 0x1063ac00
+7 r 0x10726880
+8 w 0x1082a540
+9 w 0x1092ab80
+10 w 0x20000a80
+11 w 0x10b0a7c0
+12 w 0x10c16dc0
+13 r 0x10d10400
+14 r 0x10e3aa80
+15 r 0x10f16e80
+0 w 0x10030ac0
+1 r 0x10110c00
+2 r 0x10226b80
+3 w 0x20002b00
+4 r 0x1043d980
+5 r 0x10524380
+6 r 0x106268c0
+7 w 0x20000880
+8 r 0x200014c0
+9 w 0x10918640
+10 r 0x10a153c0
+11 r 0x10b11300
+12 r 0x10c3f5c0
+13 r 0x10d1cec0
+14 r 0x10e39e40
+15 r 0x10f2acc0
+0 r 0x1002b300
+1 r 0x10138a40
+2 r 0x10208300
+3 r 0x20003f40
+4 w 0x1041ff00
+5 w 0x20001580
+6 r 0x20002000
+7 w 0x10700280
+8 w 0x20002100
+9 w 0x10910c40
+10 r 0x10a04e80
+11 w 0x10b33a40
+12 w 0x20003ac0
+13 r 0x10d0e1c0
+14 r 0x10e32940
+15 r 0x10f0dd80
+0 r 0x10023ac0
+1 r 0x1010f800
+2 w 0x10228240
+3 w 0x20003340
+4 r 0x10437700
+5 w 0x200025c0
+6 w 0x10617000
+7 r 0x10733fc0
+8 r 0x10839bc0
+9 r 0x20001440
+10 w 0x10a1ec00
+11 w 0x10b17080
+12 w 0x10c37dc0
+13 w 0x10d3a840
+14 r 0x10e22140
+15 r 0x10f2c080
+0 r 0x10020380
+1 r 0x1010bf00
+2 r 0x102002c0
+3 r 0x10328380
+4 r 0x10437400
+5 w 0x10529900
+6 r 0x1061f200
+7 r 0x10738900
+8 r 0x1083bd80
+9 w 0x10904600
+10 w 0x20000bc0
+11 r 0x10b20dc0
+12 r 0x10c06180
+13 w 0x10d06b80
+14 r 0x10e1ec00
+15 w 0x10f21900
+0 r 0x10031400
+1 w 0x10107240
+2 w 0x1023ef40
+3 r 0x1032ae80
+4 w 0x20001080
+5 w 0x1050f300
+6 w 0x1063a240
+7 w 0x10709a40
+8 r 0x10809280
+9 r 0x10920700
+10 r 0x10a2c240
+11 r 0x10b3f100
+12 w 0x20002180
+13 w 0x10d24580
+14 w 0x10e3e340
+15 w 0x10f2a100
+0 w 0x20002700
+1 w 0x10117680
+2 w 0x1021aa80
+3 r 0x10338940
+4 r 0x10401700
+5 r 0x10538f40
+6 w 0x10616900
+7 r 0x10725b40
+8 r 0x1081ff40
+9 r 0x1090b280
+10 r 0x10a089c0
+11 r 0x10b23f40
+12 r 0x200032c0
+13 r 0x10d26680
+14 r 0x10e0c900
+15 r 0x200003c0
+0 w 0x20001240
+1 w 0x10127700
+2 r 0x1022e880
+3 w 0x1033a140
+4 r 0x104051c0
+5 w 0x20000a00
+6 w 0x20003cc0
+7 r 0x10710cc0
+8 r 0x10825540
+9 w 0x1091c080
+10 w 0x10a0ed00
+11 r 0x10b14b80
+12 w 0x20000bc0
+13 r 0x10d1e800
+14 w 0x10e03280
+15 r 0x20000a80
+0 r 0x1001edc0
+1 r 0x1011b840
+2 r 0x1022a340
+3 r 0x1032aa80
+4 r 0x1040fe80
+5 r 0x1050ec40
+6 r 0x10631340
+7 w 0x1071f5c0
+8 r 0x10807340
+9 w 0x10916d00
+10 w 0x10a196c0
+11 r 0x20003600
+12 r 0x20000980
+13 w 0x10d1ccc0
+14 w 0x200033c0
+15 r 0x10f0d6c0
+0 w 0x10004880
+1 w 0x1010be40
+2 r 0x10236100
+3 w 0x20002740
+4 w 0x200036c0
+5 r 0x10510940
+6 r 0x10604900
+7 r 0x1071cd80
+8 w 0x1083fb00
+9 r 0x1091c640
+10 w 0x10a05880
+11 w 0x10b39e80
+12 r 0x10c202c0
+13 r 0x20001c80
+14 w 0x10e37700
+15 r 0x10f31d00
+0 r 0x1000ed40
+1 w 0x10110580
+2 r 0x102088c0
+3 r 0x1032d0c0
+4 r 0x1041ed80
+5 w 0x1050c100
+6 r 0x10613e00
+7 r 0x10739180
+8 r 0x10821600
+9 r 0x10926700
+10 r 0x10a2e200
+11 r 0x10b38f40
+12 w 0x10c165c0
+13 r 0x10d0f5c0
+14 w 0x10e30f00
+15 w 0x10f03800
+0 w 0x10032180
+1 w 0x1010fbc0
+2 r 0x1021be00
+3 w 0x20003480
+4 r 0x10427900
+5 r 0x1052e500
+6 w 0x10605000
+7 r 0x1071aa80
+8 w 0x1083c6c0
+9 w 0x10934a80
+10 r 0x10a38540
+11 w 0x20003740
+12 r 0x10c16200
+13 w 0x10d1ed00
+14 r 0x10e04f80
+15 r 0x10f14340
+0 r 0x1001de80
+1 w 0x1011a600
+2 r 0x20003240
+3 r 0x10309c40
+4 r 0x1043b040
+5 r 0x1053fd00
+6 r 0x1061e680
+7 r 0x10710980
+8 r 0x20002180
+9 r 0x109050c0
+10 r 0x10a3ee40
+11 w 0x10b37080
+12 w 0x200028c0
+13 r 0x20002380
+14 r 0x10e16840
+15 w 0x10f046c0
+0 w 0x10010c80
+1 w 0x10101940
+2 r 0x10224040
+3 r 0x10306d40
+4 w 0x104081c0
+5 r 0x1050dfc0
+6 r 0x1060b480
+7 w 0x20003580
+8 r 0x108068c0
+9 r 0x20001340
+10 r 0x10a2f440
+11 r 0x10b14940
+12 w 0x10c3b640
+13 r 0x20000a80
+14 r 0x10e3b440
+15 r 0x10f13200
+0 r 0x10035700
+1 w 0x200027c0
+2 r 0x1020b280
+3 r 0x1031af40
+4 w 0x20003540
+5 r 0x20001d40
+6 r 0x10605400
+7 w 0x10730e00
+8 r 0x200007c0
+9 w 0x20000280
+10 r 0x10a3d200
+11 w 0x200006c0
+12 r 0x10c1f340
+13 r 0x10d12840
+14 r 0x10e08f40
+15 r 0x10f33fc0
+0 w 0x1003b5c0
+1 r 0x10118440
+2 w 0x20001b00
+3 w 0x1031cf80
+4 r 0x10406300
+5 w 0x10530c40
+6 r 0x10622b80
+7 r 0x107339c0
+8 r 0x1082c700
+9 w 0x10912e00
+10 r 0x10a04940
+11 r 0x200001c0
+12 r 0x10c29a00
+13 r 0x10d3b3c0
+14 r 0x10e3ce40
+15 r 0x10f1a0c0
+0 w 0x1001d400
+1 w 0x200004c0
+2 r 0x1021c200
+3 w 0x20000340
+4 w 0x1043abc0
+5 r 0x1052c940
+6 r 0x1060dc40
+7 w 0x10712f00
+8 r 0x20000180
+9 w 0x10922b40
+10 r 0x10a19980
+11 w 0x10b171c0
+12 r 0x20002b80
+13 r 0x10d3b5c0
+14 r 0x10e37b40
+15 w 0x10f21680
+0 r 0x10005700
+1 r 0x20002b80
+2 w 0x20001cc0
+3 r 0x10322380
+4 r 0x10436180
+5 r 0x20003f00
+6 r 0x10602a80
+7 r 0x10705280
+8 r 0x108180c0
+9 r 0x10938ec0
+10 w 0x10a0e9c0
+11 r 0x10b072c0
+12 r 0x20001a00
+13 r 0x10d325c0
+14 w 0x20002a00
+15 r 0x10f10340
+0 r 0x1003efc0
+1 r 0x10124d80
+2 w 0x20003680
+3 r 0x10302300
+4 r 0x10410e80
+5 r 0x10507940
+6 r 0x1061df40
+7 r 0x200031c0
+8 w 0x1081fb80
+9 r 0x1092c640
+10 r 0x10a35ec0
+11 w 0x10b0e7c0
+12 r 0x10c0a7c0
+13 r 0x10d2c780
+14 r 0x10e346c0
+15 r 0x10f0d800
+0 r 0x10001780
+1 r 0x10126000
+2 r 0x10229ac0
+3 r 0x20003dc0
+4 r 0x10420780
+5 r 0x1051f9c0
+6 r 0x10625e40
+7 w 0x1071d9c0
+8 r 0x1080c900
+9 w 0x1093f400
+10 r 0x10a231c0
+11 r 0x10b2f880
+12 w 0x10c0d500
+13 w 0x200021c0
+14 w 0x20000580
+15 r 0x10f143c0
+0 r 0x1000cac0
+1 r 0x10130540
+2 r 0x10238340
+3 w 0x10309640
+4 r 0x10409600
+5 r 0x20003ac0
+6 w 0x20000ec0
+7 r 0x10732880
+8 w 0x10830780
+9 w 0x20002580
+10 r 0x10a31b40
+11 r 0x10b03e00
+12 w 0x20002400
+13 r 0x10d27b00
+14 w 0x10e12bc0
+15 r 0x10f10b00
+0 r 0x200032c0
+1 w 0x10110cc0
+2 r 0x1021e740
+3 r 0x10329a80
+4 w 0x20000ac0
+5 w 0x200005c0
+6 r 0x1062f880
+7 r 0x1072acc0
+8 r 0x20002180
+9 w 0x1092b3c0
+10 r 0x10a16b80
+11 r 0x10b00140
+12 r 0x10c30500
+13 r 0x20002000
+14 r 0x10e04680
+15 r 0x10f09000
+0 w 0x10015e40
+1 r 0x10118780
+2 w 0x20003f00
+3 w 0x103190c0
+4 r 0x10437f80
+5 w 0x200008c0
+6 r 0x1061e900
+7 w 0x107371c0
+8 r 0x108004c0
+9 r 0x1091fec0
+10 r 0x10a1bc80
+11 r 0x10b1dec0
+12 r 0x20001640
+13 r 0x10d13c40
+14 w 0x20001900
+15 r 0x10f00580
+0 r 0x100012c0
+1 r 0x10125c00
+2 r 0x102279c0
+3 w 0x10318e00
+4 r 0x10408f40
+5 r 0x1050d380
+6 r 0x1062d9c0
+7 w 0x1070d000
+8 r 0x1082b040
+9 w 0x20001e40
+10 r 0x10a3cdc0
+11 r 0x10b15700
+12 w 0x20001900
+13 r 0x10d29640
+14 r 0x10e27ac0
+15 w 0x10f0a7c0
+0 w 0x200028c0
+1 r 0x101370c0
+2 r 0x1021f840
+3 w 0x10326f00
+4 r 0x10409c80
+5 w 0x105323c0
+6 r 0x1063ee80
+7 r 0x107066c0
+8 r 0x200032c0
+9 r 0x20000980
+10 r 0x10a0a100
+11 r 0x20001140
+12 r 0x10c30400
+13 w 0x200029c0
+14 w 0x10e276c0
+15 r 0x10f02a40
+0 r 0x20000880
+1 r 0x10125e80
+2 r 0x10201580
+3 r 0x200005c0
+4 r 0x10416780
+5 w 0x20000680
+6 r 0x1062e200
+7 r 0x1073a040
+8 w 0x108244c0
+9 r 0x1091bf40
+10 r 0x10a27b40
+11 w 0x10b23600
+12 r 0x10c385c0
+13 r 0x10d2b200
+14 r 0x10e271c0
+15 w 0x20001cc0
+0 r 0x1003dd40
+1 r 0x10109100
+2 w 0x20000580
+3 w 0x20001d00
+4 r 0x20003880
+5 r 0x1051ec00
+6 r 0x1063d380
+7 w 0x10727040
+8 r 0x10827500
+9 w 0x1092fec0
+10 r 0x10a06e00
+11 r 0x10b37480
+12 w 0x10c2a280
+13 r 0x10d21680
+14 r 0x20001540
+15 r 0x10f07000
+0 r 0x100373c0
+1 w 0x1010c400
+2 r 0x1022b980
+3 r 0x20002240
+4 r 0x10424dc0
+5 r 0x1050db40
+6 r 0x106139c0
+7 r 0x20002f00
+8 r 0x1081b5c0
+9 w 0x10912ec0
+10 r 0x10a06040
+11 r 0x10b1fb80
+12 r 0x10c09e80
+13 r 0x10d10e00
+14 r 0x10e23dc0
+15 w 0x10f2b680
+0 r 0x1003e180
+1 r 0x10123c80
+2 w 0x102224c0
+3 r 0x1032b700
+4 r 0x1041e640
+5 w 0x10531dc0
+6 w 0x106278c0
+7 r 0x10733ec0
+8 r 0x10801b00
+9 r 0x10916f80
+10 w 0x10a15780
+11 w 0x10b07900
+12 r 0x20002500
+13 r 0x10d07f00
+14 r 0x10e31c80
+15 r 0x10f1fd00
+0 w 0x10036140
+1 r 0x10109d00
+2 r 0x10223680
+3 r 0x103041c0
+4 r 0x1041ac40
+5 r 0x1052c740
+6 r 0x10614480
+7 r 0x10709e00
+8 r 0x10808e40
+9 r 0x10905dc0
+10 r 0x10a3c8c0
+11 r 0x10b27800
+12 r 0x10c2c7c0
+13 r 0x10d01540
+14 r 0x10e27140
+15 w 0x10f05cc0
+0 w 0x10017ec0
+1 r 0x10118340
+2 r 0x1021b100
+3 r 0x10314dc0
+4 r 0x1043a1c0
+5 r 0x10515cc0
+6 w 0x200039c0
+7 w 0x1070e000
+8 w 0x200001c0
+9 r 0x1091f800
+10 r 0x10a10000
+11 r 0x10b13e40
+12 w 0x10c30f00
+13 w 0x200015c0
+14 r 0x10e0c100
+15 r 0x10f10300
+0 r 0x20000f80
+1 r 0x1012f780
+2 r 0x1023aac0
+3 w 0x20000dc0
+4 w 0x1040b4c0
+5 r 0x20002640
+6 r 0x10615f80
+7 w 0x1072b880
+8 w 0x10805ec0
+9 r 0x200036c0
+10 w 0x10a2a8c0
+11 r 0x10b24200
+12 r 0x10c1d180
+13 r 0x10d20e00
+14 r 0x10e037c0
+15 w 0x20001580
+0 r 0x1001b2c0
+1 r 0x1013d140
+2 w 0x10234540
+3 r 0x1030ffc0
+4 r 0x1040a2c0
+5 r 0x1052e900
+6 w 0x10602d40
+7 r 0x10738040
+8 r 0x20000d00
+9 r 0x1093cb80
+10 r 0x20001d80
+11 r 0x10b26cc0
+12 w 0x10c21000
+13 r 0x10d18a40
+14 w 0x10e0cc00
+15 w 0x10f3e040
+0 w 0x20002bc0
+1 w 0x10102f40
+2 r 0x10207a40
+3 r 0x1030ff40
+4 r 0x1042fd80
+5 w 0x1053a200
+6 r 0x106243c0
+7 r 0x1072b100
+8 w 0x1081c2c0
+9 r 0x109177c0
+10 w 0x10a2fe40
+11 r 0x10b05600
+12 r 0x10c28e40
+13 r 0x10d04e40
+14 r 0x10e316c0
+15 r 0x20001840
+0 r 0x10034300
+1 r 0x10134d00
+2 r 0x10217c40
+3 r 0x20000e80
+4 r 0x20003200
+5 r 0x1052f200
+6 w 0x20002100
+7 r 0x1072a480
+8 r 0x1082d6c0
+9 w 0x1092e7c0
+10 r 0x10a27840
+11 r 0x10b25a80
+12 r 0x20002340
+13 r 0x10d15280
+14 r 0x10e0b180
+15 w 0x10f08c80
+0 r 0x1001bf00
+1 r 0x10117940
+2 w 0x1022dd40
+3 r 0x10311c80
+4 w 0x104325c0
+5 r 0x105039c0
+6 r 0x10607040
+7 r 0x10720340
+8 w 0x1082ac80
+9 w 0x1090a440
+10 r 0x10a0e5c0
+11 r 0x10b33ec0
+12 r 0x10c09700
+13 w 0x10d3ba00
+14 w 0x20002880
+15 r 0x10f3a840
+0 w 0x20003080
+1 r 0x1012fb40
+2 w 0x10233300
+3 r 0x1033dfc0
+4 r 0x104294c0
+5 r 0x10531d40
+6 r 0x1061b280
+7 r 0x20000080
+8 w 0x10832a00
+9 r 0x10928e40
+10 r 0x10a3b200
+11 w 0x20002e00
+12 w 0x10c2cec0
+13 r 0x10d23340
+14 w 0x10e22400
+15 w 0x10f3db80
+0 r 0x10001bc0
+1 w 0x20002b40
+2 r 0x1023d6c0
+3 r 0x1031fa00
+4 r 0x1042c400
+5 w 0x200006c0
+6 w 0x10616b40
+7 w 0x1071f780
+8 r 0x10814ec0
+9 r 0x109055c0
+10 r 0x10a07480
+11 r 0x10b3d0c0
+12 w 0x10c1fa40
+13 r 0x10d207c0
+14 r 0x10e14340
+15 w 0x10f197c0
+0 r 0x100305c0
+1 r 0x1011e200
+2 r 0x10208fc0
+3 w 0x10312880
+4 w 0x20002900
+5 r 0x1050bd40
+6 r 0x1061e4c0
+7 w 0x1071de80
+8 r 0x1081cb80
+9 w 0x10912a80
+10 r 0x10a027c0
+11 w 0x20003a80
+12 r 0x10c2b900
+13 w 0x20001e80
+14 r 0x10e22180
+15 r 0x20003900
+0 r 0x1002aac0
+1 r 0x20003800
+2 r 0x10208340
+3 r 0x1033e040
+4 r 0x20001700
+5 r 0x10532480
+6 w 0x1060bac0
+7 r 0x10736b80
+8 w 0x20001300
+9 r 0x10901640
+10 r 0x10a15040
+11 r 0x10b38b00
+12 w 0x10c3a200
+13 r 0x10d05f80
+14 w 0x10e36100
+15 r 0x10f3fb40
+0 r 0x1000f500
+1 w 0x10107380
+2 r 0x10220b00
+3 r 0x1030bf40
+4 w 0x1043eb40
+5 r 0x105246c0
+6 w 0x10607500
+7 r 0x1072d640
+8 w 0x10827380
+9 r 0x10911c00
+10 r 0x10a296c0
+11 w 0x10b235c0
+12 w 0x20002cc0
+13 w 0x10d079c0
+14 r 0x10e37dc0
+15 r 0x10f15100
+0 r 0x1002b480
+1 r 0x20001580
+2 r 0x10230a80
+3 w 0x10323c40
+4 r 0x104141c0
+5 w 0x105092c0
+6 r 0x1063cd40
+7 w 0x10731000
+8 r 0x10809340
+9 w 0x20001340
+10 w 0x200036c0
+11 w 0x10b1d440
+12 w 0x20001900
+13 r 0x10d223c0
+14 r 0x10e15c40
+15 r 0x10f0bd40
+0 r 0x10018140
+1 r 0x1011c580
+2 r 0x1021ad80
+3 r 0x20002fc0
+4 r 0x10430740
+5 r 0x105197c0
+6 w 0x20000000
+7 w 0x20002a40
+8 r 0x1081ee80
+9 w 0x10931000
+10 r 0x10a25880
+11 r 0x10b02d80
+12 w 0x10c1c1c0
+13 r 0x10d1b740
+14 w 0x20003240
+15 w 0x20002cc0
+0 r 0x1002f480
+1 r 0x10122c80
+2 w 0x10227500
+3 w 0x10327b00
+4 w 0x200031c0
+5 w 0x1053db80
+6 w 0x1060df40
+7 r 0x10700640
+8 r 0x200032c0
+9 r 0x10921f80
+10 w 0x10a0cc80
+11 r 0x10b020c0
+12 w 0x20002a40
+13 r 0x10d00dc0
+14 r 0x10e05b40
+15 r 0x10f26740
+0 r 0x20000700
+1 w 0x20000500
+2 r 0x1021a040
+3 r 0x10301bc0
+4 r 0x1041be00
+5 r 0x105093c0
+6 r 0x106082c0
+7 r 0x107225c0
+8 r 0x1083de80
+9 r 0x1093c240
+10 r 0x10a230c0
+11 r 0x10b0a940
+12 w 0x10c29380
+13 r 0x10d19700
+14 w 0x200033c0
+15 r 0x10f20200
+0 r 0x1003f140
+1 r 0x10126500
+2 r 0x1022cc40
+3 w 0x1032ca40
+4 r 0x10426c80
+5 r 0x10535bc0
+6 w 0x1060d980
+7 w 0x20003c80
+8 w 0x20000100
+9 w 0x10915ac0
+10 w 0x10a0fd40
+11 r 0x20002c80
+12 r 0x10c2cbc0
+13 r 0x10d20740
+14 r 0x10e21cc0
+15 r 0x10f10600
+0 r 0x1002fa80
+1 r 0x1013e700
+2 r 0x10217e00
+3 w 0x1033da40
+4 r 0x10421e40
+5 r 0x105142c0
+6 r 0x20000740
+7 r 0x1071d7c0
+8 r 0x20000040
+9 r 0x10908600
+10 w 0x20002c80
+11 r 0x10b13900
+12 r 0x10c13c40
+13 r 0x10d0e040
+14 r 0x10e160c0
+15 w 0x10f16e40
+0 r 0x10035500
+1 r 0x10135f00
+2 r 0x1021a840
+3 r 0x1033d1c0
+4 r 0x104147c0
+5 r 0x10500580
+6 r 0x10618a00
+7 r 0x10707100
+8 r 0x1083db80
+9 w 0x20003fc0
+10 r 0x10a09580
+11 w 0x10b09880
+12 r 0x10c19800
+13 w 0x10d09500
+14 r 0x10e32500
+15 r 0x10f395c0
+0 r 0x1003e0c0
+1 r 0x1012f800
+2 r 0x10202740
+3 w 0x10302a00
+4 r 0x10430000
+5 w 0x10526cc0
+6 r 0x10623000
+7 r 0x10732540
+8 r 0x1081fdc0
+9 w 0x109048c0
+10 r 0x10a1d780
+11 r 0x10b34f80
+12 w 0x10c1a000
+13 w 0x10d05740
+14 r 0x10e28980
+15 w 0x10f34440
+0 r 0x10035700
+1 r 0x1011b140
+2 r 0x10238680
+3 r 0x1033f340
+4 r 0x1042a700
+5 r 0x10514100
+6 r 0x10629240
+7 r 0x1072e580
+8 r 0x10826540
+9 r 0x109235c0
+10 r 0x10a3ce80
+11 w 0x10b25b00
+12 w 0x20000680
+13 w 0x20001cc0
+14 r 0x10e07600
+15 w 0x200028c0
+0 w 0x10030c00
+1 w 0x20001800
+2 r 0x10209bc0
+3 w 0x10326440
+4 r 0x10416a00
+5 w 0x10536e80
+6 r 0x106247c0
+7 r 0x1070b800
+8 r 0x1083a1c0
+9 w 0x20002fc0
+10 r 0x10a01a80
+11 r 0x10b138c0
+12 r 0x10c1a9c0
+13 r 0x10d01040
+14 r 0x10e04300
+15 r 0x10f2c040
+0 w 0x20000880
+1 r 0x20001b00
+2 r 0x1023d6c0
+3 r 0x10304800
+4 r 0x1043efc0
+5 r 0x20003600
+6 w 0x1060e380
+7 r 0x107370c0
+8 r 0x1081a780
+9 r 0x109109c0
+10 r 0x10a3c4c0
+11 r 0x10b3d180
+12 r 0x10c16ac0
+13 r 0x10d00540
+14 r 0x10e302c0
+15 w 0x10f2f0c0
+0 r 0x10015980
+1 r 0x10121a80
+2 r 0x1023c200
+3 r 0x10321dc0
+4 r 0x1040c600
+5 r 0x20001f00
+6 r 0x200012c0
+7 w 0x10723d00
+8 w 0x10808e00
+9 r 0x10910b40
+10 r 0x20003100
+11 r 0x10b18c00
+12 w 0x10c35c00
+13 r 0x20000c00
+14 r 0x10e14380
+15 r 0x10f01000
+0 r 0x10037f00
+1 r 0x10136200
+2 w 0x102351c0
+3 r 0x10307400
+4 w 0x1042e600
+5 w 0x1053b780
+6 r 0x10624600
+7 r 0x10701840
+8 r 0x10813bc0
+9 r 0x20001dc0
+10 w 0x10a10580
+11 r 0x10b02040
+12 r 0x20001100
+13 w 0x20002f40
+14 r 0x10e07f80
+15 r 0x10f21a80
+0 r 0x10031940
+1 r 0x10124bc0
+2 r 0x1021c100
+3 w 0x20001b00
+4 w 0x10412e40
+5 w 0x10538180
+6 r 0x10632f40
+7 r 0x1073e200
+8 r 0x108211c0
+9 r 0x1090b100
+10 r 0x10a08b80
+11 r 0x10b1ba00
+12 w 0x10c22600
+13 r 0x10d18980
+14 w 0x20002c80
+15 r 0x10f05c80
+0 r 0x1001f580
+1 r 0x10102580
+2 r 0x10219a00
+3 r 0x1033f200
+4 r 0x20001440
+5 r 0x1051c9c0
+6 w 0x10608200
+7 r 0x10735540
+8 r 0x10810980
+9 r 0x1093aa40
+10 r 0x10a27900
+11 w 0x10b13b80
+12 r 0x10c38580
+13 r 0x10d3c280
+14 w 0x10e16080
+15 r 0x10f04380
+0 r 0x10010f40
+1 r 0x10132940
+2 r 0x10226b40
+3 r 0x10330c40
+4 r 0x10414d00
+5 w 0x1053d400
+6 r 0x1060c5c0
+7 r 0x10733d80
+8 r 0x10822440
+9 r 0x1091e840
+10 w 0x20001980
+11 r 0x10b0f280
+12 w 0x10c056c0
+13 w 0x10d371c0
+14 r 0x10e17200
+15 w 0x10f0fe40
+0 r 0x20001900
+1 r 0x101168c0
+2 r 0x10225340
+3 r 0x1030abc0
+4 r 0x20001f00
+5 r 0x105288c0
+6 r 0x106078c0
+7 w 0x1073af80
+8 r 0x1080b7c0
+9 w 0x1092a900
+10 r 0x10a1f2c0
+11 r 0x10b3ab00
+12 r 0x10c27ac0
+13 r 0x10d21240
+14 r 0x10e38640
+15 r 0x10f3fb80
+0 r 0x1003c880
+1 r 0x20001200
+2 w 0x20002340
+3 w 0x10307dc0
+4 w 0x10428f00
+5 w 0x10533a80
+6 w 0x1063cac0
+7 r 0x10729880
+8 r 0x1083e980
+9 r 0x10921680
+10 r 0x10a20c80
+11 r 0x10b0b800
+12 r 0x10c05c00
+13 r 0x10d10280
+14 r 0x200028c0
+15 r 0x10f37400
+0 r 0x100210c0
+1 w 0x101111c0
+2 r 0x10218ec0
+3 r 0x1032b900
+4 r 0x1042ca00
+5 w 0x1052f2c0
+6 w 0x106128c0
+7 r 0x10709c40
+8 w 0x20000180
+9 r 0x109230c0
+10 r 0x10a26340
+11 w 0x10b37500
+12 r 0x10c1d940
+13 r 0x20000900
+14 r 0x20003c80
+15 r 0x20001fc0
+0 r 0x1002b680
+1 w 0x20000a40
+2 r 0x10215a40
+3 r 0x10337500
+4 w 0x10425b00
+5 w 0x10523c00
+6 w 0x10628b80
+7 r 0x10707e00
+8 r 0x20000400
+9 r 0x20001140
+10 w 0x10a27c00
+11 w 0x200013c0
+12 r 0x10c3bc80
+13 r 0x10d3ba40
+14 r 0x10e1b4c0
+15 w 0x20000b00
+0 w 0x1000fa40
+1 w 0x10137980
+2 w 0x10207b40
+3 r 0x1031a240
+4 w 0x1042a640
+5 r 0x10518b80
+6 w 0x20001000
+7 w 0x10739740
+8 r 0x1082a200
+9 r 0x1090cb80
+10 r 0x10a24080
+11 r 0x10b062c0
+12 r 0x10c15fc0
+13 w 0x10d2a780
+14 r 0x10e2e940
+15 w 0x200016c0
+0 w 0x1002f100
+1 r 0x200036c0
+2 w 0x102299c0
+3 w 0x103386c0
+4 w 0x104047c0
+5 r 0x10516f00
+6 w 0x1060f8c0
+7 w 0x1073b680
+8 r 0x20003100
+9 r 0x1092d440
+10 w 0x10a1c8c0
+11 r 0x20001200
+12 r 0x10c28040
+13 r 0x20001d00
+14 r 0x20001780
+15 r 0x10f3ca00
+0 r 0x100387c0
+1 r 0x10138a00
+2 r 0x1023a140
+3 r 0x20001540
+4 w 0x1043af80
+5 r 0x10537340
+6 r 0x10621500
+7 r 0x1070d080
+8 r 0x10828e40
+9 w 0x10908b00
+10 w 0x10a2bb80
+11 r 0x10b30ec0
+12 r 0x10c2c3c0
+13 w 0x10d0ec00
+14 w 0x10e37b80
+15 r 0x10f34400
+0 r 0x10024080
+1 w 0x20002380
+2 r 0x1020ba80
+3 w 0x10339b80
+4 w 0x104087c0
+5 w 0x105356c0
+6 r 0x10620280
+7 r 0x10729600
+8 w 0x1082ad80
+9 r 0x10931340
+10 w 0x10a20b80
+11 r 0x10b358c0
+12 r 0x10c3c3c0
+13 r 0x10d04700
+14 r 0x10e11540
+15 w 0x20003180
+0 w 0x10016540
+1 r 0x10129a40
+2 w 0x10207c80
+3 w 0x10317040
+4 r 0x20003200
+5 r 0x20001580
+6 r 0x200018c0
+7 w 0x1072cc00
+8 r 0x1081a040
+9 w 0x10923240
+10 r 0x200022c0
+11 r 0x10b04e40
+12 w 0x10c32980
+13 w 0x10d3ae40
+14 r 0x10e0b0c0
+15 r 0x10f1ee00
+0 w 0x20003240
+1 r 0x101026c0
+2 r 0x10215dc0
+3 r 0x1030b840
+4 w 0x10426b40
+5 r 0x105295c0
+6 r 0x10612740
+7 w 0x20000840
+8 r 0x20002440
+9 r 0x10905740
+10 r 0x10a35d80
+11 w 0x10b34bc0
+12 r 0x10c34080
+13 r 0x10d13e40
+14 r 0x20001e80
+15 w 0x200039c0
+0 r 0x1000e800
+1 r 0x10129140
+2 r 0x1020b880
+3 w 0x1033f8c0
+4 w 0x20002240
+5 w 0x1050e240
+6 r 0x1063a6c0
+7 r 0x1072f200
+8 w 0x10815480
+9 r 0x10914c40
+10 w 0x10a3e200
+11 w 0x10b2e000
+12 w 0x20002e00
+13 r 0x10d3a980
+14 r 0x10e34c40
+15 r 0x10f3ac80
+0 r 0x200038c0
+1 r 0x1012ac00
+2 r 0x20000cc0
+3 w 0x10330440
+4 r 0x10433200
+5 r 0x105225c0
+6 r 0x1063f840
+7 r 0x20003380
+8 r 0x20000ac0
+9 w 0x10921f80
+10 w 0x10a17700
+11 r 0x10b2e640
+12 r 0x10c0b000
+13 w 0x10d12ac0
+14 w 0x20002d40
+15 w 0x10f30700
+0 w 0x1003bec0
+1 w 0x1011d140
+2 w 0x20003c00
+3 r 0x103232c0
+4 r 0x10423940
+5 w 0x10516640
+6 r 0x106270c0
+7 r 0x107159c0
+8 r 0x10806c40
+9 w 0x1090a480
+10 r 0x10a33400
+11 r 0x10b28dc0
+12 r 0x10c00680
+13 w 0x20003e40
+14 r 0x10e0bd80
+15 w 0x10f3d280
+0 r 0x10034580
+1 r 0x20000300
+2 r 0x1020f540
+3 r 0x10336940
+4 r 0x10426340
+5 r 0x10512f40
+6 r 0x1063c740
+7 w 0x20002ec0
+8 w 0x200002c0
+9 r 0x10918840
+10 r 0x10a072c0
+11 w 0x20002c80
+12 w 0x200011c0
+13 r 0x10d37fc0
+14 r 0x10e1a500
+15 r 0x10f34300
+0 r 0x10011500
+1 r 0x1010fdc0
+2 r 0x20001b40
+3 w 0x10329ec0
+4 r 0x10412b00
+5 r 0x10501ac0
+6 w 0x10639c00
+7 w 0x10735500
+8 r 0x108357c0
+9 r 0x20001dc0
+10 w 0x20001000
+11 r 0x10b0b500
+12 w 0x10c2d240
+13 r 0x10d31c00
+14 r 0x10e3de00
+15 w 0x10f1dc80
+0 r 0x20003480
+1 r 0x10110f80
+2 r 0x10238900
+3 r 0x10339080
+4 r 0x104305c0
+5 w 0x20002a40
+6 r 0x10623ac0
+7 r 0x10736100
+8 r 0x20000440
+9 r 0x1092cc80
+10 w 0x10a25a80
+11 r 0x10b16280
+12 r 0x10c3e740
+13 r 0x10d2f040
+14 r 0x10e2d280
+15 r 0x10f13480
+0 r 0x1000f840
+1 r 0x20003940
+2 r 0x1020b6c0
+3 r 0x1032f7c0
+4 r 0x20001340
+5 r 0x20002780
+6 r 0x10634000
+7 r 0x1072d440
+8 r 0x108114c0
+9 w 0x10922ec0
+10 r 0x10a1aa00
+11 r 0x20001c80
+12 w 0x10c229c0
+13 w 0x20001680
+14 w 0x10e34440
+15 r 0x10f14fc0
+0 r 0x10021d40
+1 r 0x10109c00
+2 w 0x10225e00
+3 r 0x10301ac0
+4 r 0x1041f7c0
+5 r 0x10517380
+6 w 0x1060e400
+7 r 0x1073bf80
+8 r 0x20000e00
+9 r 0x10936ec0
+10 w 0x20001700
+11 w 0x20001680
+12 r 0x10c0b4c0
+13 r 0x10d06ec0
+14 r 0x10e0bd80
+15 w 0x10f04100
+0 r 0x1002c900
+1 r 0x10131180
+2 r 0x10206940
+3 w 0x200031c0
+4 w 0x104020c0
+5 r 0x10521080
+6 r 0x106394c0
+7 w 0x20002240
+8 w 0x20000dc0
+9 w 0x1093e300
+10 r 0x10a29f40
+11 r 0x10b22ec0
+12 r 0x10c30880
+13 r 0x20000fc0
+14 w 0x10e300c0
+15 r 0x10f246c0
+0 w 0x1003e080
+1 r 0x200037c0
+2 r 0x10206f40
+3 r 0x1031ad80
+4 r 0x200010c0
+5 w 0x10508180
+6 w 0x20003940
+7 r 0x1072fac0
+8 r 0x1081aac0
+9 r 0x109037c0
+10 r 0x10a26f00
+11 r 0x10b1a000
+12 r 0x10c3ef80
+13 w 0x10d20900
+14 w 0x20003a00
+15 r 0x10f25e00
+0 w 0x1002b5c0
+1 r 0x1010b480
+2 r 0x1022dc80
+3 r 0x103283c0
+4 r 0x1042f680
+5 w 0x10527b00
+6 r 0x1060b640
+7 w 0x10715680
+8 r 0x10829240
+9 r 0x1093f500
+10 r 0x10a1d680
+11 r 0x10b37700
+12 w 0x20000900
+13 w 0x10d2ab40
+14 w 0x10e18a00
+15 w 0x20003ec0
+0 r 0x100231c0
+1 r 0x1012f840
+2 w 0x10208d00
+3 w 0x103195c0
+4 w 0x1040db40
+5 r 0x10509a00
+6 w 0x10629700
+7 r 0x1072a280
+8 r 0x108353c0
+9 w 0x20003500
+10 w 0x10a3d780
+11 r 0x20000e00
+12 r 0x10c0d040
+13 r 0x20000000
+14 r 0x10e38d00
+15 r 0x10f2d200
+0 r 0x1000ff80
+1 w 0x10138d40
+2 w 0x20001880
+3 r 0x1032b900
+4 w 0x1042e700
+5 r 0x10537080
+6 r 0x1063f3c0
+7 r 0x20000040
+8 r 0x10827780
+9 w 0x20002400
+10 r 0x10a27c00
+11 r 0x10b3e100
+12 w 0x20000540
+13 r 0x10d39680
+14 r 0x10e2d540
+15 r 0x10f05000
+0 r 0x10008100
+1 w 0x20002400
+2 r 0x1023be80
+3 r 0x10314f80
+4 r 0x1040a340
+5 w 0x10526b40
+6 r 0x20003940
+7 w 0x20002f00
+8 w 0x20003540
+9 r 0x1093bb80
+10 r 0x20000d00
+11 w 0x10b04640
+12 w 0x10c0e7c0
+13 r 0x10d0dec0
+14 r 0x10e324c0
+15 r 0x10f18140
+0 r 0x10014c00
+1 w 0x20003e00
+2 r 0x1020c040
+3 r 0x10322540
+4 r 0x1043ee80
+5 w 0x10507b00
+6 w 0x10619a80
+7 r 0x10708440
+8 r 0x10829840
+9 r 0x10930940
+10 r 0x10a148c0
+11 r 0x10b29040
+12 r 0x10c19600
+13 w 0x10d3e380
+14 w 0x10e3b840
+15 r 0x10f0bd40
+0 w 0x1003b600
+1 r 0x1012b2c0
+2 r 0x1021a840
+3 r 0x103059c0
+4 w 0x20002000
+5 r 0x1050a840
+6 r 0x20002e40
+7 w 0x107225c0
+8 w 0x108253c0
+9 w 0x10910040
+10 r 0x10a08800
+11 w 0x10b10d80
+12 r 0x10c15180
+13 r 0x10d3a540
+14 w 0x10e2cc40
+15 w 0x20001240
+0 r 0x10010340
+1 w 0x101369c0
+2 r 0x1023c180
+3 w 0x10302d40
+4 r 0x10416680
+5 r 0x1050fd80
+6 w 0x20001340
+7 w 0x10735400
+8 r 0x108256c0
+9 r 0x1090ff00
+10 r 0x10a3d940
+11 r 0x10b25580
+12 r 0x10c00640
+13 w 0x10d376c0
+14 r 0x10e2af80
+15 r 0x10f18980
+0 r 0x10020e00
+1 r 0x20000980
+2 w 0x200006c0
+3 r 0x103057c0
+4 r 0x1040cac0
+5 r 0x1052b380
+6 r 0x10607440
+7 r 0x10724300
+8 w 0x20002280
+9 r 0x10917d00
+10 w 0x10a1f800
+11 r 0x10b12e00
+12 w 0x10c06f40
+13 w 0x20000b80
+14 w 0x10e35e00
+15 r 0x10f1ed40
+0 w 0x20002780
+1 w 0x101047c0
+2 r 0x1023a1c0
+3 w 0x10332a40
+4 r 0x10420740
+5 r 0x20001100
+6 r 0x20001380
+7 r 0x20003580
+8 r 0x10830380
+9 r 0x10931ac0
+10 r 0x10a16340
+11 r 0x10b010c0
+12 r 0x10c2cf40
+13 w 0x10d222c0
+14 r 0x10e1c7c0
+15 w 0x10f24580
+0 w 0x100084c0
+1 r 0x20002380
+2 r 0x1022cb40
+3 r 0x10307e40
+4 w 0x10436600
+5 r 0x10505740
+6 w 0x20003f40
+7 w 0x20003500
+8 w 0x108024c0
+9 r 0x10905c80
+10 r 0x10a1f6c0
+11 r 0x10b17e80
+12 w 0x10c11c80
+13 r 0x10d36cc0
+14 w 0x20001d40
+15 r 0x20002fc0
+0 r 0x1002f840
+1 r 0x10118700
+2 r 0x10226180
+3 r 0x10308540
+4 r 0x10403080
+5 r 0x10513300
+6 w 0x20001a40
+7 w 0x200030c0
+8 w 0x1082e000
+9 w 0x1092c3c0
+10 w 0x10a0c280
+11 r 0x10b0c980
+12 r 0x10c2e380
+13 r 0x10d2be40
+14 r 0x20001540
+15 w 0x10f3b700
+0 r 0x10003500
+1 r 0x10128a40
+2 w 0x102396c0
+3 w 0x10320400
+4 r 0x1043b480
+5 r 0x10528700
+6 r 0x1060df00
+7 r 0x10702580
+8 r 0x10826c00
+9 w 0x20000a80
+10 r 0x10a0bb00
+11 r 0x20002300
+12 r 0x10c37480
+13 r 0x10d28680
+14 w 0x10e3b200
+15 r 0x10f2bbc0
+0 r 0x10032bc0
+1 r 0x101099c0
+2 r 0x10200f40
+3 r 0x10324840
+4 r 0x104193c0
+5 w 0x1052c4c0
+6 w 0x10625880
+7 r 0x10723e00
+8 r 0x20002ec0
+9 r 0x10936ac0
+10 r 0x10a1a780
+11 w 0x10b33f00
+12 r 0x10c14ac0
+13 w 0x20000a80
+14 r 0x10e3bb00
+15 w 0x10f0fdc0
+0 r 0x10004b40
+1 r 0x1011c780
+2 r 0x10203900
+3 r 0x10301e40
+4 r 0x10406540
+5 w 0x10526c00
+6 w 0x10616140
+7 r 0x1072e480
+8 w 0x1080d300
+9 w 0x20000600
+10 r 0x10a3b3c0
+11 w 0x10b26400
+12 w 0x10c179c0
+13 r 0x10d38300
+14 w 0x20000f80
+15 w 0x10f2fa00
+0 r 0x10013900
+1 w 0x10133040
+2 w 0x20000fc0
+3 r 0x1033f480
+4 r 0x10412480
+5 w 0x1052b940
+6 w 0x106222c0
+7 w 0x10737c00
+8 r 0x10818540
+9 r 0x10927c80
+10 r 0x10a0b040
+11 r 0x10b2dd40
+12 r 0x10c00100
+13 r 0x10d15c00
+14 w 0x10e34600
+15 r 0x20002ac0
+0 r 0x1003c440
+1 r 0x10133980
+2 w 0x20003c80
+3 w 0x10324f80
+4 w 0x1043ae40
+5 w 0x10520600
+6 w 0x10620780
+7 r 0x10738200
+8 r 0x10810e40
+9 r 0x10905ac0
+10 w 0x10a01280
+11 w 0x20003740
+12 r 0x10c378c0
+13 r 0x10d349c0
+14 r 0x10e13440
+15 r 0x200026c0
+0 w 0x10008a40
+1 r 0x10111700
+2 r 0x10210ac0
+3 r 0x1033d000
+4 r 0x104025c0
+5 w 0x20003880
+6 r 0x10625d80
+7 r 0x10717300
+8 w 0x10807740
+9 r 0x10934e40
+10 r 0x10a022c0
+11 w 0x200021c0
+12 r 0x10c326c0
+13 r 0x10d39c80
+14 w 0x10e07240
+15 r 0x10f19440
+0 w 0x10019b00
+1 r 0x1012bb80
+2 r 0x1023bd40
+3 w 0x1032bc80
+4 w 0x10404580
+5 w 0x1052df80
+6 r 0x10622780
+7 w 0x10705a40
+8 r 0x108331c0
+9 w 0x10937680
+10 r 0x10a16700
+11 r 0x10b06180
+12 w 0x20002400
+13 r 0x10d1a4c0
+14 w 0x10e16000
+15 w 0x20001840
+0 r 0x20002700
+1 r 0x10120c80
+2 r 0x20003180
+3 r 0x10315800
+4 r 0x1041c000
+5 r 0x1053cdc0
+6 r 0x10620600
+7 r 0x1072a980
+8 r 0x108211c0
+9 w 0x109151c0
+10 w 0x10a2d0c0
+11 w 0x10b36ec0
+12 r 0x10c29d00
+13 w 0x10d0da40
+14 r 0x10e1b680
+15 w 0x20002000
+0 w 0x10039a80
+1 w 0x10102440
+2 w 0x20000980
+3 w 0x20003140
+4 w 0x1040cc80
+5 r 0x105174c0
+6 r 0x10612900
+7 r 0x1073d340
+8 r 0x1080ef80
+9 r 0x1091fec0
+10 r 0x20001980
+11 r 0x10b0cfc0
+12 r 0x10c349c0
+13 r 0x20002f00
+14 r 0x10e16640
+15 r 0x20000680
+0 w 0x1003b1c0
+1 r 0x10110940
+2 r 0x20000380
+3 r 0x10321040
+4 r 0x10408300
+5 r 0x10506800
+6 w 0x200019c0
+7 r 0x20000c80
+8 w 0x10804740
+9 r 0x1092efc0
+10 r 0x10a28140
+11 r 0x10b1b000
+12 r 0x10c0ea80
+13 r 0x10d27bc0
+14 w 0x20002340
+15 w 0x20003e40
+0 w 0x20000a80
+1 r 0x10124ac0
+2 r 0x200020c0
+3 w 0x20001280
+4 r 0x10419d80
+5 r 0x10527a00
+6 r 0x1060f040
+7 w 0x20001380
+8 w 0x10800880
+9 r 0x10907280
+10 r 0x10a3da80
+11 r 0x10b14500
+12 r 0x10c17740
+13 r 0x20000380
+14 r 0x10e32500
+15 r 0x10f36040
+0 r 0x1001f5c0
+1 r 0x20000a80
+2 w 0x10234ec0
+3 w 0x10334d00
+4 w 0x1043ff40
+5 r 0x10526440
+6 w 0x1060e180
+7 w 0x20001dc0
+8 r 0x10827b80
+9 r 0x200014c0
+10 r 0x10a01bc0
+11 r 0x10b16080
+12 r 0x20003f40
+13 w 0x10d0ec40
+14 w 0x10e33bc0
+15 w 0x10f2fb40
+0 r 0x100347c0
+1 r 0x10132b80
+2 r 0x10230900
+3 r 0x10309cc0
+4 w 0x20000240
+5 r 0x10536a80
+6 w 0x10633140
+7 r 0x10712840
+8 w 0x1083b180
+9 r 0x1093a640
+10 r 0x10a13840
+11 w 0x10b2f800
+12 r 0x10c3cb00
+13 r 0x10d28880
+14 w 0x10e2b900
+15 w 0x20002ec0
+0 w 0x20001000
+1 w 0x20001040
+2 w 0x1020c640
+3 r 0x10310dc0
+4 r 0x1043d000
+5 r 0x1052b200
+6 w 0x106137c0
+7 w 0x10715500
+8 w 0x20003cc0
+9 r 0x1093b300
+10 r 0x10a39340
+11 w 0x10b09a80
+12 r 0x20001300
+13 w 0x10d0d0c0
+14 r 0x10e1cd40
+15 w 0x10f0b1c0
+0 r 0x10000e40
+1 w 0x10121280
+2 r 0x20001cc0
+3 r 0x10321f00
+4 w 0x20002880
+5 r 0x1050e600
+6 r 0x10600f80
+7 r 0x10703ec0
+8 r 0x1081dc80
+9 w 0x10911d80
+10 r 0x10a07b00
+11 w 0x20000940
+12 r 0x10c35a80
+13 w 0x10d3cf80
+14 r 0x10e12380
+15 w 0x10f3c780
+0 w 0x1002c300
+1 w 0x10100c00
+2 r 0x10217040
+3 r 0x10339e40
+4 r 0x1043ef40
+5 r 0x105235c0
+6 w 0x20002880
+7 w 0x107188c0
+8 r 0x20001600
+9 r 0x109196c0
+10 w 0x200014c0
+11 r 0x10b01e40
+12 r 0x10c247c0
+13 r 0x200029c0
+14 w 0x10e2a280
+15 r 0x10f1a5c0
+0 r 0x10036500
+1 r 0x10136b00
+2 w 0x20003dc0
+3 r 0x10336cc0
+4 w 0x104164c0
+5 w 0x10519a40
+6 w 0x10622740
+7 r 0x10700100
+8 r 0x20000340
+9 r 0x10904640
+10 r 0x10a02940
+11 r 0x10b15540
+12 w 0x10c0b4c0
+13 r 0x10d1af40
+14 r 0x10e0edc0
+15 w 0x20002bc0
+0 r 0x20002000
+1 r 0x10114c40
+2 r 0x10225180
+3 w 0x10317540
+4 r 0x10408e80
+5 w 0x10517000
+6 r 0x10637e00
+7 w 0x10701bc0
+8 r 0x10801340
+9 w 0x10908e40
+10 r 0x10a23600
+11 r 0x10b37d00
+12 r 0x200024c0
+13 r 0x20001f40
+14 w 0x10e203c0
+15 r 0x10f24580
+0 r 0x1001cf40
+1 w 0x20001940
+2 w 0x20003c80
+3 r 0x10300e00
+4 r 0x1040c4c0
+5 r 0x10502cc0
+6 r 0x1063f3c0
+7 w 0x10722580
+8 w 0x10801340
+9 r 0x10934a40
+10 r 0x20000e80
+11 r 0x10b17500
+12 r 0x10c08040
+13 r 0x10d1bf40
+14 w 0x10e254c0
+15 r 0x10f3cac0
+0 r 0x20001f00
+1 r 0x10103700
+2 r 0x1023b240
+3 r 0x10334700
+4 r 0x1043b2c0
+5 r 0x10518900
+6 r 0x10616c40
+7 r 0x1071a000
+8 w 0x1083f040
+9 r 0x20001fc0
+10 r 0x10a35640
+11 w 0x20003d00
+12 r 0x10c17dc0
+13 w 0x10d03f00
+14 w 0x10e2fc40
+15 w 0x10f07640
+0 r 0x10002a80
+1 r 0x20002e40
+2 r 0x1022f500
+3 r 0x20003500
+4 r 0x10415580
+5 r 0x20001800
+6 r 0x10624cc0
+7 r 0x20000d80
+8 w 0x10831c00
+9 w 0x1093d340
+10 r 0x10a039c0
+11 r 0x20001f00
+12 w 0x10c00c80
+13 r 0x10d2f3c0
+14 r 0x10e3c4c0
+15 r 0x10f2ed40
+0 r 0x10028f80
+1 r 0x20000000
+2 r 0x1020e340
+3 r 0x10307c80
+4 r 0x10423b80
+5 r 0x20001740
+6 w 0x10630040
+7 r 0x1073aac0
+8 r 0x10835180
+9 r 0x1093f940
+10 r 0x10a3bc00
+11 w 0x10b37200
+12 r 0x10c2d6c0
+13 r 0x10d1f0c0
+14 w 0x10e3d2c0
+15 r 0x10f250c0
+0 w 0x1001c640
+1 r 0x10131000
+2 r 0x10211b80
+3 r 0x10337140
+4 r 0x1042f480
+5 r 0x10527a80
+6 w 0x1063fe80
+7 r 0x107050c0
+8 w 0x108365c0
+9 r 0x20001880
+10 r 0x200010c0
+11 r 0x10b3dbc0
+12 r 0x10c1da40
+13 r 0x10d0afc0
+14 r 0x10e063c0
+15 r 0x10f179c0
+0 r 0x20001280
+1 r 0x10112900
+2 w 0x102215c0
+3 r 0x103075c0
+4 r 0x10419580
+5 r 0x200018c0
+6 r 0x20002500
+7 r 0x1071ce80
+8 r 0x10803580
+9 r 0x10900640
+10 w 0x10a2a140
+11 r 0x10b33800
+12 r 0x10c194c0
+13 r 0x10d18940
+14 r 0x10e34e00
+15 r 0x10f39940
+0 r 0x10031b40
+1 r 0x10119600
+2 r 0x10207480
+3 r 0x10316040
+4 r 0x10406cc0
+5 r 0x1050c480
+6 r 0x106364c0
+7 w 0x200029c0
+8 r 0x1080d740
+9 r 0x1090b640
+10 r 0x10a3dc40
+11 w 0x10b17840
+12 w 0x10c39040
+13 w 0x10d24e80
+14 r 0x10e3d000
+15 w 0x20002fc0
+0 r 0x10004e00
+1 w 0x10120a40
+2 r 0x10203800
+3 w 0x10317940
+4 r 0x20000740
+5 w 0x1053d040
+6 r 0x10612940
+7 r 0x1073ce00
+8 r 0x1082c800
+9 r 0x20001ac0
+10 r 0x10a06980
+11 r 0x10b10380
+12 w 0x10c3ba80
+13 r 0x10d33c40
+14 r 0x10e1fcc0
+15 w 0x200001c0
+0 w 0x1002a4c0
+1 r 0x1012fd00
+2 w 0x1022af80
+3 r 0x10334d80
+4 w 0x104147c0
+5 r 0x10536f40
+6 w 0x1062cb40
+7 r 0x1073d080
+8 w 0x10839840
+9 r 0x1091ff40
+10 w 0x20000e00
+11 r 0x10b15cc0
+12 w 0x20000c40
+13 r 0x10d26900
+14 w 0x10e33240
+15 r 0x20003c00
@@ -19,15 +19,51 @@
 #define OFFSETBITS 6 // 6 bits (64 = 2^6)
 #define NPROCS  16   // 16 procs
 #define SQRTNPROCS  4 // Tiles will be in SQRTNPROCSxSQRTNPROCS matrix
+#define NDIRS   4    // 4 memory controllers (1 directory shard each)
 
 // Access time / hop delay macros
 #define HOPTIME    4  //   4 cycles per interconnect hop
 #define L1ATIME    3  //   3 cycles
 #define L2ATIME   10  //  10 cycles
-#define MEMATIME 150  // 150 cycles
+#define MEMATIME 150  // 150 cycles (flat memory model)
 
-#define DATAHOPDELAY(x) (x*HOPTIME + 3) // Latency for data block
-#define HOPDELAY(x)     (x*HOPTIME)     // Latency for request
+// DRAM timing (in cycles) for the dram memory model. Rows are kept
+// open after an access so the latency of a read is
+//     row hit:      MEMCTRLTIME + MEMTCAS                     + MEMTBURST
+//     row closed:   MEMCTRLTIME + MEMTRCD + MEMTCAS           + MEMTBURST
+//     row conflict: MEMCTRLTIME + MEMTRP + MEMTRCD + MEMTCAS  + MEMTBURST
+// plus any time spent waiting for the bank or the data bus.
+#define MEMBANKS     8   // Banks per memory controller
+#define MEMROWBLKS  32   // Blocks per DRAM row (2 KiB rows)
+#define MEMCTRLTIME 30   // Controller overhead
+#define MEMTRCD     40   // Activate (open a row)
+#define MEMTCAS     40   // Column access
+#define MEMTRP      40   // Precharge (close a row)
+#define MEMTBURST    8   // Transfer one block over the data bus
+
+// Write queue of each memory controller. Writes wait in the queue
+// while there are reads to do. Once it fills to MEMWQHIGH the
+// controller drains it down to MEMWQLOW before serving more reads.
+#define MEMWQSIZE 64
+#define MEMWQHIGH 48
+#define MEMWQLOW  16
+
+// Accesses each bank remembers after scheduling them. A read can be
+// served ahead of the reads still waiting in this queue (FR-FCFS).
+#define MEMBQSIZE 16
+
+// Messages are split into flits. Requests fit in one flit while a
+// data block takes BLKSIZE/FLITSIZE. With no contention the tail of
+// a data block arrives DATAFLITS-1 cycles after the head.
+#define FLITSIZE  16  // 16 bytes
+#define DATAFLITS (BLKSIZE / FLITSIZE)
+
+#define DATAHOPDELAY(x) (x*HOPTIME + DATAFLITS - 1) // Latency for data block
+#define HOPDELAY(x)     (x*HOPTIME)                 // Latency for request
+
+// Max records of a multi-threaded trace to read ahead while waiting
+// for a tile that has fallen behind (see Trace.h)
+#define TRACEWINDOW (1 << 16)
 
 // Use the following to randomize address interleaving. 
 #define ADDRHASH(x) ((x >> OFFSETBITS + INDEXBITS) ^ (x >> OFFSETBITS))
@@ -35,7 +71,22 @@
 // Use the following to calculate the block address
 #define BLKADDR(addr) (addr >> OFFSETBITS)
 
-// Macro to find max of two numbers
-#define MAX(x,y) ((x > y) ? x : y);
+// Pages (for placing memory on the controllers). Addresses are
+// 32 bits so there are at most NPAGES pages.
+#define PAGEBITS    12 // 4 KiB pages
+#define PAGEADDR(addr) (addr >> PAGEBITS)
+#define BLKSPERPAGE (1 << (PAGEBITS - OFFSETBITS))
+#define NPAGES      (1UL << (32 - PAGEBITS))
+
+// Most intervals (and most overlaps) in a sweep
+#define MAXSWEEP 16
+
+// Size of the state random() uses by default (glibc TYPE_3). It is
+// saved in checkpoints.
+#define RNGSTATESIZE 128
+
+// Macros to find the max/min of two numbers
+#define MAX(x,y) (((x) > (y)) ? (x) : (y))
+#define MIN(x,y) (((x) < (y)) ? (x) : (y))
 
 #endif
@@ -6,67 +6,818 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <getopt.h>
+#include <unistd.h>
+#include <sys/wait.h>
 #include <fstream>
 #include "BitVector.h"
 #include "Cache.h"
+#include "CCSM.h"
 #include "Dir.h"
 #include "Tile.h"
 #include "Net.h"
+#include "MemCtrl.h"
+#include "Event.h"
+#include "Trace.h"
+#include "Workload.h"
+#include "Sample.h"
+#include "SimPoint.h"
+#include "Parallel.h"
+#include "IntervalStats.h"
+#include "Stats.h"
+#include "Profile.h"
+#include "Checkpoint.h"
 #include "params.h"
 
 Net *NETWORK;
 
-ulong CURRENTDELAY    = 0;
-ulong CURRENTMEMDELAY = 0;
+// Event queue that all request timing goes through. Each simulation
+// thread has its own (see Parallel.h).
+thread_local EventQueue *EVENTQ;
 
 ulong PARTSHARING     = 0;
 
+// Coherence protocol (MESI, MOESI or MESIF). Set with --protocol.
+ulong PROTOCOL        = MESI;
+const char *PROTOCOLNAMES[] = { "MESI", "MOESI", "MESIF" };
+
+// Memory model (flat or dram) and how the dram model drains its
+// write queues. Set with --memory and --mem-drain.
+ulong MEMMODEL        = MEMFLAT;
+ulong MEMDRAIN        = DRAINWATERMARK;
+
+// Command line options. These must come before the positional
+// arguments (<interval> <overlap> <trace_file> <tabular>).
+static struct option longopts[] = {
+    { "protocol",   required_argument, NULL, 'p' },
+    { "dir-entries",required_argument, NULL, 'e' },
+    { "dir-assoc",  required_argument, NULL, 'a' },
+    { "dir-policy", required_argument, NULL, 'r' },
+    { "sharers",    required_argument, NULL, 's' },
+    { "sharer-ptrs",required_argument, NULL, 'i' },
+    { "dir-locks",  no_argument,       NULL, 'l' },
+    { "mt",         no_argument,       NULL, 'm' },
+    { "thread-map", required_argument, NULL, 't' },
+    { "workers",    required_argument, NULL, 'w' },
+    { "quantum",    required_argument, NULL, 'q' },
+    { "deterministic", no_argument,    NULL, 'd' },
+    { "network",    required_argument, NULL, 'n' },
+    { "net-stats",  required_argument, NULL, 'o' },
+    { "net-interval", required_argument, NULL, 'u' },
+    { "topology",   required_argument, NULL, 'g' },
+    { "memory",     required_argument, NULL, 'k' },
+    { "mem-drain",  required_argument, NULL, 'j' },
+    { "mem-map",    required_argument, NULL, 'c' },
+    { "interval-stats", required_argument, NULL, 'v' },
+    { "stats-every",required_argument, NULL, 'y' },
+    { "sample",     required_argument, NULL, 'S' },
+    { "sample-warm",required_argument, NULL, 'W' },
+    { "sample-error",required_argument,NULL, 'E' },
+    { "simpoint",   required_argument, NULL, 'P' },
+    { "simpoint-k", required_argument, NULL, 'K' },
+    { "simpoint-warm",required_argument,NULL,'U' },
+    { "fast-forward",required_argument,NULL, 'F' },
+    { "warmup",     required_argument, NULL, 'M' },
+    { "checkpoint", required_argument, NULL, 'C' },
+    { "checkpoint-at",required_argument,NULL,'T' },
+    { "restore",    required_argument, NULL, 'R' },
+    { NULL,         0,                 NULL,  0  }
+};
+
+/*
+ * usage
+ *     - Print out how to use the simulator and exit.
+ */
+static void usage() {
+    printf("input format: ");
+    printf("./sim [options] <interval> <overlap> <trace_file> <tabular>\n");
+    printf("  <trace_file> may be gen:<spec> to simulate a synthetic workload\n");
+    printf("  (e.g. gen:zipf,n=1M,fp=64M,w=30). See Workload.h.\n");
+    printf("  <interval> and <overlap> may be lists (e.g. 10000,100000 0,1000) to sweep\n");
+    printf("  every pair of them (with overlap <= interval) in one go.\n");
+    printf("options:\n");
+    printf("  --protocol <mesi|moesi|mesif>   coherence protocol (default mesi)\n");
+    printf("  --dir-entries <n>               sparse directory entries (default 0 = unbounded)\n");
+    printf("  --dir-assoc <n>                 sparse directory associativity (default 8)\n");
+    printf("  --dir-policy <lru|random>       sparse directory replacement (default lru)\n");
+    printf("  --sharers <full|ptr|cv|list>    directory sharer encoding (default full)\n");
+    printf("  --sharer-ptrs <n>               pointers for ptr/cv encodings (default 4)\n");
+    printf("  --dir-locks                     lock directory shards on each access\n");
+    printf("  --mt                            multi-threaded trace (<tid> <op> <addr>)\n");
+    printf("  --thread-map <t0,t1,..>         tile for each thread (default tid %% %d)\n", NPROCS);
+    printf("  --workers <n>                   host threads to run tiles on (--mt only)\n");
+    printf("  --quantum <cycles>              parallel quantum (default %d)\n", LOOKAHEAD);
+    printf("  --deterministic                 replay directory requests in cycle order\n");
+    printf("  --network <contention|zeroload> interconnect model (default contention)\n");
+    printf("  --topology <mesh|torus|ring|cmesh|fbfly>\n");
+    printf("                                  interconnect topology (default mesh)\n");
+    printf("  --net-stats <prefix>            write link traffic to <prefix>.links/.series\n");
+    printf("  --net-interval <cycles>         time series interval (default %d)\n", NETINTERVAL);
+    printf("  --memory <dram|flat>            memory model (default flat)\n");
+    printf("  --mem-drain <watermark|eager>   dram write queue draining (default watermark)\n");
+    printf("  --mem-map <block|page|firsttouch|migrate>\n");
+    printf("                                  address to memory controller mapping (default block)\n");
+    printf("  --interval-stats <file>         write per-tile counters to <file> (CSV) over time\n");
+    printf("  --stats-every <n>               records between snapshots (default %d, 0 = at\n", SNAPEVERY);
+    printf("                                  migrations only)\n");
+    printf("  --sample <n>                    sampled simulation, n records per measured unit\n");
+    printf("  --sample-warm <n>               detailed warming before each unit (default 2 units)\n");
+    printf("  --sample-error <pct>            target error of the average access time at 95%%\n");
+    printf("                                  confidence (default 3, 0 = fixed period)\n");
+    printf("  --simpoint <n>                  only simulate representative intervals of n records\n");
+    printf("  --simpoint-k <n>                most phases to look for (default %d)\n", 10);
+    printf("  --simpoint-warm <n>             warmup before each interval (default 1 interval)\n");
+    printf("  --fast-forward <n>              only warm the caches for the first n records\n");
+    printf("  --warmup <n>                    then simulate n records before counting (default 0)\n");
+    printf("  --checkpoint <file>             save the whole simulator to <file> ..\n");
+    printf("  --checkpoint-at <n>             .. after n records (default at the end)\n");
+    printf("  --restore <file>                start from a checkpoint (same configuration)\n");
+    exit(1);
+}
+
+/*
+ * readRecord
+ *     - Get the next record of a single-threaded trace, either from
+ *       the file or from the workload.
+ *
+ * Returns 0 at the end of the trace.
+ */
+static int readRecord(FILE *fp, Workload *work, uchar *op, ulong *addr) {
+    char buf[1024];
+    int tid, ok;
+
+    if (work)
+        return work->next(&tid, op, addr);
+
+    if (!fgets(buf, 1024, fp))
+        return 0;
+
+    // The "operation" is first on the line, then the mem addr
+    ok = parseRecord(buf, 0, &tid, op, addr);
+    assert(ok);
+    return 1;
+}
+
+/*
+ * estimateRecords
+ *     - Guess the # of records in a trace file from its size and the
+ *       length of the lines at the start of it.
+ *
+ * Returns 0 if it can't tell (not a regular file).
+ */
+static ulong estimateRecords(FILE *fp) {
+    char buf[65536];
+    ulong i, n, lines = 0;
+    long size;
+
+    if (fseek(fp, 0, SEEK_END) != 0 || (size = ftell(fp)) <= 0)
+        return 0;
+    rewind(fp);
+
+    n = fread(buf, 1, sizeof(buf), fp);
+    for (i=0; i < n; i++)
+        if (buf[i] == '\n')
+            lines++;
+    rewind(fp);
+
+    return lines ? (ulong)((double)size * lines / n) : 0;
+}
+
+/*
+ * profileTrace
+ *     - First pass of --simpoint. Give the address of every record to
+ *       sp and have it pick the representatives. The address is last
+ *       on the line in both trace formats.
+ */
+static void profileTrace(FILE *fp, const char *spec, SimPoint *sp) {
+    char buf[1024];
+    char delimit[4] = " \t\n";
+    char *token, *last;
+    Workload *work;
+    uchar op;
+    ulong addr;
+    int tid;
+
+    if (spec) {
+        work = Workload::create(spec);
+        while (work->next(&tid, &op, &addr))
+            sp->profile(addr);
+        delete work;
+    } else {
+        while (fgets(buf, 1024, fp)) {
+            last = NULL;
+            for (token = strtok(buf, delimit); token; token = strtok(NULL, delimit))
+                last = token;
+            assert(last != NULL);
+            sp->profile(strtoul(last, NULL, 16));
+        }
+        rewind(fp);
+    }
+    sp->select();
+}
+
+/*
+ * simulate
+ *     - Hand a record to its tile. When sampling it may only warm the
+ *       caches or (with --simpoint) be skipped altogether.
+ */
+static void simulate(Tile **tiles, int proc, ulong addr, uchar op,
+                     Sampler *sampler, SimPoint *simpoint) {
+    if (sampler && sampler->next(tiles)) {
+        tiles[proc]->Warm(addr, op);
+        return;
+    }
+    switch (simpoint ? simpoint->next(tiles) : SPMEASURE) {
+        case SPSKIP:
+            tiles[proc]->Skip();
+            break;
+        case SPWARM:
+            tiles[proc]->Warm(addr, op);
+            break;
+        default:
+            tiles[proc]->Access(addr, op);
+    }
+}
+
+/*
+ * warmedUp
+ *     - Called after each record while warming up. The fast-forward
+ *       ends after fastforward records and everything counted so far
+ *       is thrown away after warmup more.
+ */
+static void warmedUp(Tile **tiles, Dir *dir, ulong records,
+                     ulong fastforward, ulong warmup) {
+    ulong start = 0;
+    int i;
+
+    // The tiles did different amounts of work while fast-forwarding.
+    // Start their clocks together.
+    if (records == fastforward) {
+        EVENTQ->functional = 0;
+        for (i=0; i < NPROCS; i++)
+            start = MAX(start, tiles[i]->cycle);
+        for (i=0; i < NPROCS; i++)
+            tiles[i]->cycle = start;
+    }
+    if (records == fastforward + warmup) {
+        for (i=0; i < NPROCS; i++)
+            tiles[i]->resetStats();
+        dir->resetStats();
+        NETWORK->resetStats();
+        STAT_RESET();
+    }
+}
+
+/*
+ * privatePartitions
+ *     - With overlap the partitions are made up as the process
+ *       migrates so start with every tile but the first in no
+ *       partition at all.
+ */
+static void privatePartitions(Tile **tiles, Dir *dir) {
+    int i;
+
+    for (i=1; i < NPROCS; i++) {
+        tiles[i]->part->clearAllBits();
+        dir->parttable[i]->clearAllBits();
+    }
+}
+
+/*
+ * A sweep simulates every (interval, overlap) pair of the lists given.
+ * Until a run migrates for the first time it does exactly what the
+ * run that never migrates does, so one process simulates that shared
+ * prefix and forks off a copy-on-write child for each run right
+ * before its first migration. Runs that never migrate are forked at
+ * the end of the trace. Each child writes its output to its own
+ * temporary file and the first process prints them all, in order,
+ * once every child is done.
+ */
+class SweepRun {
+    public:
+        int   interval;
+        int   overlap;
+        pid_t pid;     // Process simulating the run (-1 = not started)
+        FILE *out;     // Its output
+};
+
+/*
+ * sweepFork
+ *     - Fork off the runs that migrate for the first time at the
+ *       next record (all that are left if end is set). The trace
+ *       file is opened again in both processes so they don't share
+ *       the file offset. A child takes on the interval and overlap
+ *       of its run.
+ *
+ * Returns 1 in a child and 0 in the parent.
+ */
+static int sweepFork(SweepRun *runs, int nruns, ulong records, int end,
+                     FILE **fp, const char *fname, Tile **tiles, Dir *dir,
+                     int *interval, int *overlap) {
+    int k;
+    long off;
+    pid_t pid;
+
+    for (k=0; k < nruns; k++) {
+        if (runs[k].pid != -1 || (!end && (ulong)runs[k].interval != records + 1))
+            continue;
+
+        off = *fp ? ftell(*fp) : 0;
+        fflush(stdout);
+        pid = fork();
+        if (pid < 0) {
+            printf("Sweep problem (can't fork)\n");
+            exit(1);
+        }
+        if (*fp) {
+            fclose(*fp);
+            *fp = fopen(fname, "r");
+            if (*fp == NULL || fseek(*fp, off, SEEK_SET) != 0) {
+                printf("Trace file problem\n");
+                exit(1);
+            }
+        }
+        if (pid == 0) {
+            dup2(fileno(runs[k].out), fileno(stdout));
+            *interval = runs[k].interval;
+            *overlap  = runs[k].overlap;
+            if (*overlap != 0)
+                privatePartitions(tiles, dir);
+            return 1;
+        }
+        runs[k].pid = pid;
+    }
+    return 0;
+}
+
+/*
+ * sweepStarted
+ *     - Has every run of a sweep been forked off?
+ */
+static int sweepStarted(SweepRun *runs, int nruns) {
+    int k;
+
+    for (k=0; k < nruns; k++)
+        if (runs[k].pid == -1)
+            return 0;
+    return 1;
+}
+
+/*
+ * sweepGather
+ *     - Wait for the runs of a sweep and print their output, each
+ *       under a line that says which run it is.
+ */
+static void sweepGather(SweepRun *runs, int nruns) {
+    char buf[4096];
+    size_t n;
+    int k, status;
+
+    for (k=0; k < nruns; k++) {
+        if (runs[k].pid > 0 && (waitpid(runs[k].pid, &status, 0) != runs[k].pid ||
+                                !WIFEXITED(status) || WEXITSTATUS(status) != 0)) {
+            printf("Sweep run %d/%d failed\n", runs[k].interval, runs[k].overlap);
+            exit(1);
+        }
+        printf("SWEEP (INTERVAL/OVERLAP):       %d/%d\n", runs[k].interval, runs[k].overlap);
+        fflush(stdout);
+        rewind(runs[k].out);
+        while ((n = fread(buf, 1, sizeof(buf), runs[k].out)) > 0)
+            fwrite(buf, 1, n, stdout);
+        fclose(runs[k].out);
+    }
+}
+
+/*
+ * checkpointSim
+ *     - Save (ck->saving) or restore the whole simulator: the
+ *       configuration, where we are in the trace, the state of the
+ *       main loop, random()'s state, the tiles, directory, network
+ *       and event queue. config says what the state depends on and
+ *       has to be the same when restoring. The network and memory
+ *       models aren't part of it so a warmed checkpoint can be run
+ *       on with either.
+ */
+static void checkpointSim(Checkpoint *ck, const char *config, Tile **tiles,
+                          Dir *dir, MTTrace *trace, FILE *fp, Workload *work,
+                          ulong *records, int *count, int *proc, int *oldproc,
+                          int *newproc) {
+    static char spare[RNGSTATESIZE];
+    char  saved[512];
+    char *rng;
+    ulong j, off;
+    int   tid, i;
+    uchar op;
+    ulong addr;
+
+    ck->section(CKSECTION('C','o','n','f'));
+    memset(saved, 0, sizeof(saved));
+    strncpy(saved, config, sizeof(saved) - 1);
+    CKIO(ck, saved);
+    if (strcmp(saved, config) != 0) {
+        printf("Checkpoint %s was saved with another configuration\n", ck->name);
+        printf("  saved: %s\n", saved);
+        printf("  now:   %s\n", config);
+        exit(1);
+    }
+
+    // Where we are in the trace (the MTTrace keeps its own)
+    ck->section(CKSECTION('M','a','i','n'));
+    CKIO(ck, *records);
+    CKIO(ck, *count);
+    CKIO(ck, *proc);
+    CKIO(ck, *oldproc);
+    CKIO(ck, *newproc);
+    if (trace) {
+        trace->checkpoint(ck);
+    } else {
+        off = fp ? ftell(fp) : 0;
+        CKIO(ck, off);
+        if (!ck->saving && fp && fseek(fp, off, SEEK_SET) != 0) {
+            printf("Trace file problem (can't seek to %lu)\n", off);
+            exit(1);
+        }
+        if (!ck->saving && work)
+            for (j=0; j < *records; j++)
+                if (!work->next(&tid, &op, &addr))
+                    break;
+    }
+
+    // random() picks the processor to migrate to. Switching to
+    // another state stores where the current one is up to in it, so
+    // it can be copied whole.
+    rng = initstate(1, spare, sizeof(spare));
+    ck->io(rng, RNGSTATESIZE);
+    setstate(rng);
+
+    for (i=0; i < NPROCS; i++)
+        tiles[i]->checkpoint(ck);
+    dir->checkpoint(ck);
+    NETWORK->checkpoint(ck);
+    EVENTQ->checkpoint(ck);
+    StatRegistry::checkpoint(ck);
+}
+
+/*
+ * saveCheckpoint
+ *     - Save a checkpoint if we are at the record it was asked for.
+ */
+static void saveCheckpoint(const char *file, ulong at, const char *config,
+                           Tile **tiles, Dir *dir, MTTrace *trace, FILE *fp,
+                           ulong *records, int *count, int *proc, int *oldproc,
+                           int *newproc) {
+    Checkpoint *ck;
+
+    if (!file || *records != at)
+        return;
+    ck = new Checkpoint(file, 1);
+    checkpointSim(ck, config, tiles, dir, trace, fp, NULL,
+                  records, count, proc, oldproc, newproc);
+    delete ck;
+}
+
 
 int main(int argc, char *argv[]) {
     
     int i;
-    FILE * fp;
-    char buf[256];
+    FILE * fp = NULL;
     char * token;
-    char * op;
+    uchar op;
     int   proc, oldproc, newproc;
     int   partscheme = 1;
     int   partid;
     int   tabular = 0;
     ulong addr;
     Cache ** cacheArray;
-    char delimit[4] = " \t\n"; // tokenize based on "space", "tab", eol
     char strHeader[2048];
     char strStats[2048];
     int count = 0;
     int interval = 0; // interval at which to migrate process
     int overlap = 0;  // how long should the partition be shared with the old tile
+    int opt;
+    ulong direntries = 0;       // sparse directory entries (0 = unbounded)
+    ulong dirassoc   = 8;       // sparse directory associativity
+    int   dirpolicy  = SDIRLRU; // sparse directory replacement policy
+    int   sharerenc  = SHRFULL; // directory sharer encoding
+    int   sharerptrs = 4;       // pointers for limited pointer encodings
+    int   dirlocks   = 0;       // lock directory shards on each access
+    int   mt         = 0;       // multi-threaded trace?
+    int   threadmap[NPROCS*16]; // thread -> tile mapping
+    int   nthreadmap = 0;
+    uchar mtop;
+    MTTrace *trace;
+    int   workers    = 1;       // host threads running tiles
+    ulong quantum    = LOOKAHEAD; // parallel quantum (cycles)
+    int   deterministic = 0;    // replay directory requests in order
+    int   netmodel   = NETCONTEND; // interconnect model
+    int   topology   = TOPOMESH;   // interconnect topology
+    char *netstats   = NULL;    // prefix of link traffic files
+    int   memmap     = MAPBLOCK; // address to controller mapping
+    char *statsfile  = NULL;    // interval statistics file
+    ulong statsevery = SNAPEVERY; // records between snapshots
+    ulong records    = 0;       // records simulated (single-threaded trace)
+    IntervalStats *istats = NULL;
+    ulong netinterval = NETINTERVAL; // cycles per time series interval
+    ParallelSim *psim;
+    Workload *work   = NULL;    // synthetic workload (gen:<spec>)
+    char  workdesc[256];
+    ulong sampleunit = 0;       // records per measured unit (0 = no sampling)
+    long  samplewarm = -1;      // detailed warming before each unit
+    double sampleerr = 0.03;    // target relative error
+    Sampler *sampler = NULL;
+    ulong spinterval = 0;       // records per interval (0 = no simpoints)
+    long  spwarm     = -1;      // warmup before each representative
+    int   spmaxk     = 10;      // most phases to look for
+    SimPoint *simpoint = NULL;
+    ulong fastforward = 0;      // records to only warm the caches with
+    ulong warmup     = 0;       // records simulated but not counted after
+    char *ckptfile   = NULL;    // checkpoint to save ..
+    ulong ckptat     = (ulong)-1; // .. after this many records (-1 = end)
+    char *restorefile = NULL;   // checkpoint to start from
+    char  config[512];          // what a checkpoint depends on
+    Checkpoint *ck;
+    int   intervals[MAXSWEEP], nintervals = 0; // sweep (see SweepRun)
+    int   overlaps[MAXSWEEP], noverlaps = 0;
+    SweepRun runs[MAXSWEEP*MAXSWEEP];
+    int   nruns      = 0;
+    int   sweeping   = 0;       // simulating the prefix of a sweep?
+    int   j, k;
+
+    // Process the options
+    while ((opt = getopt_long(argc, argv, "p:e:a:r:s:i:lmt:w:q:dn:o:u:g:k:j:c:v:y:S:W:E:P:K:U:F:M:C:T:R:", longopts, NULL)) != -1) {
+        switch (opt) {
+            case 'p':
+                for (i=0; i < 3; i++)
+                    if (strcasecmp(optarg, PROTOCOLNAMES[i]) == 0)
+                        break;
+                if (i == 3)
+                    usage();
+                PROTOCOL = i;
+                break;
+            case 'e':
+                direntries = strtoul(optarg, NULL, 0);
+                break;
+            case 'a':
+                dirassoc = strtoul(optarg, NULL, 0);
+                if (dirassoc == 0)
+                    usage();
+                break;
+            case 'r':
+                if (strcasecmp(optarg, "lru") == 0)
+                    dirpolicy = SDIRLRU;
+                else if (strcasecmp(optarg, "random") == 0)
+                    dirpolicy = SDIRRANDOM;
+                else
+                    usage();
+                break;
+            case 's':
+                for (i=0; i < 4; i++)
+                    if (strcasecmp(optarg, SHARERNAMES[i]) == 0)
+                        break;
+                if (i == 4)
+                    usage();
+                sharerenc = i;
+                break;
+            case 'i':
+                sharerptrs = atoi(optarg);
+                if (sharerptrs <= 0)
+                    usage();
+                break;
+            case 'l':
+                dirlocks = 1;
+                break;
+            case 'm':
+                mt = 1;
+                break;
+            case 't':
+                for (token = strtok(optarg, ","); token; token = strtok(NULL, ",")) {
+                    if (nthreadmap == NPROCS*16)
+                        usage();
+                    threadmap[nthreadmap] = atoi(token);
+                    if (threadmap[nthreadmap] < 0 || threadmap[nthreadmap] >= NPROCS)
+                        usage();
+                    nthreadmap++;
+                }
+                break;
+            case 'w':
+                workers = atoi(optarg);
+                if (workers < 1 || workers > NPROCS)
+                    usage();
+                break;
+            case 'q':
+                quantum = strtoul(optarg, NULL, 0);
+                if (quantum == 0)
+                    usage();
+                break;
+            case 'd':
+                deterministic = 1;
+                break;
+            case 'n':
+                for (i=0; i < 2; i++)
+                    if (strcasecmp(optarg, NETNAMES[i]) == 0)
+                        break;
+                if (i == 2)
+                    usage();
+                netmodel = i;
+                break;
+            case 'g':
+                for (i=0; i < 5; i++)
+                    if (strcasecmp(optarg, TOPONAMES[i]) == 0)
+                        break;
+                if (i == 5)
+                    usage();
+                topology = i;
+                break;
+            case 'k':
+                for (i=0; i < 2; i++)
+                    if (strcasecmp(optarg, MEMNAMES[i]) == 0)
+                        break;
+                if (i == 2)
+                    usage();
+                MEMMODEL = i;
+                break;
+            case 'j':
+                for (i=0; i < 2; i++)
+                    if (strcasecmp(optarg, DRAINNAMES[i]) == 0)
+                        break;
+                if (i == 2)
+                    usage();
+                MEMDRAIN = i;
+                break;
+            case 'c':
+                for (i=0; i < 4; i++)
+                    if (strcasecmp(optarg, MAPNAMES[i]) == 0)
+                        break;
+                if (i == 4)
+                    usage();
+                memmap = i;
+                break;
+            case 'v':
+                statsfile = optarg;
+                break;
+            case 'y':
+                statsevery = strtoul(optarg, NULL, 0);
+                break;
+            case 'o':
+                netstats = optarg;
+                break;
+            case 'u':
+                netinterval = strtoul(optarg, NULL, 0);
+                if (netinterval == 0)
+                    usage();
+                break;
+            case 'S':
+                sampleunit = strtoul(optarg, NULL, 0);
+                if (sampleunit == 0)
+                    usage();
+                break;
+            case 'W':
+                samplewarm = atol(optarg);
+                if (samplewarm < 0)
+                    usage();
+                break;
+            case 'E':
+                sampleerr = atof(optarg) / 100.0;
+                if (sampleerr < 0)
+                    usage();
+                break;
+            case 'P':
+                spinterval = strtoul(optarg, NULL, 0);
+                if (spinterval == 0)
+                    usage();
+                break;
+            case 'K':
+                spmaxk = atoi(optarg);
+                if (spmaxk <= 0)
+                    usage();
+                break;
+            case 'U':
+                spwarm = atol(optarg);
+                if (spwarm < 0)
+                    usage();
+                break;
+            case 'F':
+                fastforward = strtoul(optarg, NULL, 0);
+                break;
+            case 'M':
+                warmup = strtoul(optarg, NULL, 0);
+                break;
+            case 'C':
+                ckptfile = optarg;
+                break;
+            case 'T':
+                ckptat = strtoul(optarg, NULL, 0);
+                break;
+            case 'R':
+                restorefile = optarg;
+                break;
+            default:
+                usage();
+        }
+    }
+
+    // Skip over the options. What is left are the positional args.
+    argc -= optind;
+    argv += optind - 1;
 
     // Check input
-    if (argv[1] == NULL) {
-        printf("input format: ");
-        printf("./sim <interval> <overlap> <trace_file> <tabular>\n");
-        exit(1);
+    if (argc < 3)
+        usage();
+
+    //Convert the arguments to integer values. Each may be a
+    //list of values to sweep.
+    for (token = strtok(argv[1], ","); token; token = strtok(NULL, ",")) {
+        if (nintervals == MAXSWEEP)
+            usage();
+        sscanf(token, "%u", &intervals[nintervals++]);
+    }
+    for (token = strtok(argv[2], ","); token; token = strtok(NULL, ",")) {
+        if (noverlaps == MAXSWEEP)
+            usage();
+        sscanf(token, "%u", &overlaps[noverlaps++]);
     }
+    if (nintervals == 0 || noverlaps == 0)
+        usage();
+    interval = intervals[0];
+    overlap  = overlaps[0];
 
-    //Convert the arguments to integer values
-    sscanf(argv[1], "%u", &interval);
+    // Sweep every pair that makes sense (you can't share a partition
+    // longer than you stay, or at all without migrating)
+    if (nintervals > 1 || noverlaps > 1) {
+        for (j=0; j < nintervals; j++) {
+            for (k=0; k < noverlaps; k++) {
+                if (intervals[j] < overlaps[k] || (intervals[j] == 0 && overlaps[k]))
+                    continue;
+                runs[nruns].interval = intervals[j];
+                runs[nruns].overlap  = overlaps[k];
+                runs[nruns].pid      = -1;
+                runs[nruns].out      = NULL;
+                nruns++;
+            }
+        }
+        if (nruns == 0)
+            usage();
+        interval = 0; // The prefix doesn't migrate
+        overlap  = 0;
+        sweeping = 1;
+    }
 
-    //Convert the arguments to integer values
-    sscanf(argv[2], "%u", &overlap);
+    // Store the filename. gen:<spec> means make up the records.
+    char *fname;
+    fname = argv[3];
+    if (strncmp(fname, "gen:", 4) == 0) {
+        work = Workload::create(fname + 4);
+        work->describe(workdesc);
+        if (work->threads > 1)
+            mt = 1;
+    }
 
     // Error check the arguments
+    assert(direntries % (dirassoc * NDIRS) == 0);
     assert(interval >= overlap);
+    if (mt) // Threads don't migrate
+        assert(interval == 0);
     if (interval == 0)
         assert(overlap == 0);
+    if (mt && workers > 1 && !deterministic) // See Parallel.h
+        dirlocks = 1;
 
-    // Store the filename
-    char *fname;
-    fname = argv[3];
+    // Directory entries move with the pages. A finite directory would
+    // have to make room for them and a locked one has lock-free readers.
+    if (memmap == MAPMIGRATE && (direntries || dirlocks)) {
+        printf("--mem-map migrate can't be used with --dir-entries, --dir-locks or\n");
+        printf("--workers (without --deterministic)\n");
+        usage();
+    }
 
     if (argv[4] != NULL)
         tabular = 1;
 
+    // The runs of a sweep each finish in their own process. Only a
+    // single-threaded trace migrates.
+    if (sweeping)
+        assert(!mt && !statsfile && !netstats && !ckptfile && !restorefile);
+
+    // Checkpoints hold every tile, the directory and the network, so
+    // they only work for a single thread driving the whole run.
+    if (ckptfile || restorefile)
+        assert(!sampleunit && !spinterval && workers == 1 && !statsfile);
+
+    // Everything a checkpoint depends on
+    snprintf(config, sizeof(config),
+             "L1 %d/%d L2 %d/%d BLK %d PROCS %d %s PART %d/%lu "
+             "DIR %lu/%lu/%d %s/%d MAP %s NET %s TOPO %s MEM %s/%s "
+             "MIGRATE %d/%d TRACE %s",
+             L1SIZE, L1ASSOC, L2SIZE, L2ASSOC, BLKSIZE, NPROCS,
+             PROTOCOLNAMES[PROTOCOL], partscheme, PARTSHARING, direntries,
+             dirassoc, dirpolicy, SHARERNAMES[sharerenc], sharerptrs,
+             MAPNAMES[memmap], NETNAMES[netmodel], TOPONAMES[topology],
+             MEMNAMES[MEMMODEL], DRAINNAMES[MEMDRAIN], interval, overlap,
+             work ? fname : basename(fname));
+    for (i=0; mt && i < nthreadmap; i++)
+        snprintf(config + strlen(config), sizeof(config) - strlen(config),
+                 "%s%d", i ? "," : " MAP ", threadmap[i]);
+
 
     // Print out the simulator configuration (if not tabular)
     if (!tabular) {
@@ -77,16 +828,51 @@ int main(int argc, char *argv[]) {
         printf("L2_ASSOC:                       %d\n", L2ASSOC);
         printf("BLOCKSIZE:                      %d\n", BLKSIZE);
         printf("NUMBER OF PROCESSORS:           %d\n", NPROCS);
-        printf("COHERENCE PROTOCOL:             %s\n", "MESI");
+        printf("COHERENCE PROTOCOL:             %s\n", PROTOCOLNAMES[PROTOCOL]);
         printf("TILES PER PARTITION:            %d\n", partscheme);
         printf("ALLOW PARITION SHARING:         %d\n", PARTSHARING);
-        printf("TRACE FILE:                     %s\n", basename(fname));
+        if (direntries)
+            printf("DIRECTORY ENTRIES (ASSOC):      %lu (%lu)\n", direntries, dirassoc);
+        else
+            printf("DIRECTORY ENTRIES (ASSOC):      %s\n", "unbounded");
+        printf("DIRECTORY SHARER ENCODING:      %s\n", SHARERNAMES[sharerenc]);
+        printf("NETWORK MODEL:                  %s\n", NETNAMES[netmodel]);
+        printf("NETWORK TOPOLOGY:               %s\n", TOPONAMES[topology]);
+        if (MEMMODEL == MEMDRAM)
+            printf("MEMORY MODEL (DRAIN):           %s (%s)\n", MEMNAMES[MEMMODEL], DRAINNAMES[MEMDRAIN]);
+        else
+            printf("MEMORY MODEL:                   %s\n", MEMNAMES[MEMMODEL]);
+        printf("MEMORY MAPPING:                 %s\n", MAPNAMES[memmap]);
+        if (statsfile)
+            printf("INTERVAL STATS (EVERY):         %s (%lu)\n", statsfile, statsevery);
+        if (mt)
+            printf("TRACE FORMAT:                   %s\n", "multi-threaded");
+        if (mt && workers > 1)
+            printf("WORKERS (QUANTUM):              %d (%lu)\n", workers, quantum);
+        if (sampleunit)
+            printf("SAMPLING (UNIT/WARM/ERROR):     %lu/%lu/%.1f%%\n", sampleunit,
+                   samplewarm < 0 ? 2 * sampleunit : samplewarm, 100 * sampleerr);
+        if (spinterval)
+            printf("SIMPOINT (INTERVAL/WARM/MAXK):  %lu/%lu/%d\n", spinterval,
+                   spwarm < 0 ? spinterval : spwarm, spmaxk);
+        if (fastforward || warmup)
+            printf("FAST-FORWARD (WARMUP):          %lu (%lu)\n", fastforward, warmup);
+        if (restorefile)
+            printf("RESTORED FROM:                  %s\n", restorefile);
+        if (ckptfile && ckptat != (ulong)-1)
+            printf("CHECKPOINT (AT):                %s (%lu)\n", ckptfile, ckptat);
+        else if (ckptfile)
+            printf("CHECKPOINT (AT):                %s (end)\n", ckptfile);
+        if (work)
+            printf("WORKLOAD:                       %s\n", workdesc);
+        else
+            printf("TRACE FILE:                     %s\n", basename(fname));
     } 
 
-    // Create a new directory. Rather than have 4 directories (one 
-    // each corner tile) I am just going to use 1 directory and adjust
-    // the math accordingly.
-    Dir *dir = new Dir(partscheme);
+    // Create a new directory. It is split into NDIRS shards, one
+    // for each memory controller (attached to the corner tiles).
+    Dir *dir = new Dir(partscheme, direntries, dirassoc, dirpolicy,
+                       sharerenc, sharerptrs, dirlocks, memmap);
     assert(dir);
 
     // Create a 4x4 array of Tiles here
@@ -100,23 +886,111 @@ int main(int argc, char *argv[]) {
     // If we are going to have overlap then clean out the 
     // partition info for part > 0 because we are only using 
     // one partition at a time.
-    if (overlap != 0) {
-        for (i=1; i < NPROCS; i++) {
-            tiles[i]->part->clearAllBits();
-            dir->parttable[i]->clearAllBits();
-        }
-    }
+    if (overlap != 0)
+        privatePartitions(tiles, dir);
+
 
+    // Create the global event queue
+    EVENTQ = new EventQueue();
+    assert(EVENTQ);
 
     // Create the global network element
-    NETWORK = new Net(dir, tiles);
+    NETWORK = new Net(dir, tiles, netmodel, topology);
     assert(NETWORK);
+    NETWORK->locking = dirlocks;
+    if (netstats)
+        NETWORK->trackSeries(netinterval);
+
+    // Start the interval statistics writer
+    if (statsfile)
+        istats = new IntervalStats(statsfile, statsevery);
+
+    // Start profiling the simulator itself. Everything from here to
+    // the end of the trace that isn't in a more specific phase is
+    // charged to reading the trace.
+    PROF_START();
+    PROF_SCOPE(PHASEPARSE);
 
     // Open the trace file
-    fp = fopen(fname,"r");
-    if (fp == 0) {   
-        printf("Trace file problem\n");
-        exit(0);
+    if (!work) {
+        fp = fopen(fname,"r");
+        if (fp == 0) {   
+            printf("Trace file problem\n");
+            exit(0);
+        }
+    }
+
+    // Sample the trace rather than simulating all of it in detail.
+    // The period is picked based on how long the trace is.
+    if (sampleunit) {
+        assert(workers == 1); // Sampling drives the tiles one at a time
+        if (samplewarm < 0)
+            samplewarm = 2 * sampleunit;
+        sampler = new Sampler(sampleunit, samplewarm, sampleerr,
+                              work ? work->records : estimateRecords(fp));
+    }
+
+    // Only simulate the intervals that stand for each phase of the
+    // trace. Finding them takes a pass over the whole trace first.
+    if (spinterval) {
+        assert(!sampler && workers == 1 && !istats);
+        if (spwarm < 0)
+            spwarm = spinterval;
+        simpoint = new SimPoint(spinterval, spwarm, spmaxk);
+        profileTrace(fp, work ? fname + 4 : NULL, simpoint);
+    }
+
+    // Warm up before counting anything. The first fastforward records
+    // only update the caches and directory (see Tile::Warm()).
+    if (fastforward || warmup) {
+        assert(!sampler && !simpoint && workers == 1 && !istats);
+        EVENTQ->functional = (fastforward > 0);
+    }
+
+    // With a multi-threaded trace all tiles run at once. Keep
+    // handing the next access to the tile that is furthest behind.
+    // With more than one worker the tiles run in parallel in quanta.
+    if (mt) {
+        if (work)
+            trace = new MTTrace(work, threadmap, nthreadmap);
+        else
+            trace = new MTTrace(fp, threadmap, nthreadmap);
+        if (restorefile) {
+            ck = new Checkpoint(restorefile, 0);
+            checkpointSim(ck, config, tiles, dir, trace, fp, work,
+                          &records, &count, &proc, &oldproc, &newproc);
+            delete ck;
+            EVENTQ->functional = (records < fastforward);
+        }
+        if (workers > 1) {
+            psim = new ParallelSim(tiles, dir, trace, workers, quantum,
+                                   deterministic);
+            psim->istats = istats;
+            psim->run();
+            delete psim;
+        } else {
+            // While fast-forwarding there is no timing so the records
+            // are simply run in file order
+            while ((proc = (records < fastforward) ?
+                           trace->nextInOrder(&addr, &mtop) :
+                           trace->next(tiles, &addr, &mtop)) != -1) {
+                if (records < fastforward)
+                    tiles[proc]->Warm(addr, mtop);
+                else
+                    simulate(tiles, proc, addr, mtop, sampler, simpoint);
+                records++;
+                if (records <= fastforward + warmup)
+                    warmedUp(tiles, dir, records, fastforward, warmup);
+                if (istats)
+                    istats->tick(tiles, records);
+                saveCheckpoint(ckptfile, ckptat, config, tiles, dir, trace, fp,
+                               &records, &count, &proc, &oldproc, &newproc);
+            }
+            if (ckptfile && ckptat == (ulong)-1)
+                saveCheckpoint(ckptfile, records, config, tiles, dir, trace, fp,
+                               &records, &count, &proc, &oldproc, &newproc);
+        }
+        delete trace;
     }
 
     // Read each line of trace file and call Access() for each entry.
@@ -131,7 +1005,27 @@ int main(int argc, char *argv[]) {
     newproc = -1;
     oldproc = -1;
     proc = 0;
-    while (fgets(buf, 1024, fp)) {
+
+    // Start a sweep. Each run gets a file for its output.
+    if (sweeping) {
+        for (k=0; k < nruns; k++) {
+            runs[k].out = tmpfile();
+            assert(runs[k].out);
+        }
+        if (sweepFork(runs, nruns, records, 0, &fp, fname, tiles, dir,
+                      &interval, &overlap))
+            sweeping = 0;
+    }
+    if (!mt && restorefile) {
+        ck = new Checkpoint(restorefile, 0);
+        checkpointSim(ck, config, tiles, dir, NULL, fp, work,
+                      &records, &count, &proc, &oldproc, &newproc);
+        delete ck;
+        EVENTQ->functional = (records < fastforward);
+    }
+    // A sweep stops simulating once every run has been forked off
+    while (!mt && !(sweeping && sweepStarted(runs, nruns)) &&
+           readRecord(fp, work, &op, &addr)) {
         count++;
 
         if (overlap && (count == overlap)) {
@@ -150,6 +1044,10 @@ int main(int argc, char *argv[]) {
         if (interval && (count == interval)) {
             count = 0;
 
+            // Snapshot the tiles right before the migration
+            if (istats)
+                istats->take(tiles, records, SNAPMIGRATE);
+
             // Find a new random proc to migrate to. Loop 
             // until the newproc != proc
             while (1) {
@@ -188,28 +1086,69 @@ int main(int argc, char *argv[]) {
         assert(proc < NPROCS);
       //printf("processor is %d\n", proc);
 
-        // The "operation" is first on the line
-        token = strtok(buf, delimit);
-        assert(token != NULL);
-        op = token;
-      //printf("operation is: %s\n", op);
+        if (records < fastforward)
+            tiles[proc]->Warm(addr, op);
+        else
+            simulate(tiles, proc, addr, op, sampler, simpoint);
+        records++;
+        if (records <= fastforward + warmup)
+            warmedUp(tiles, dir, records, fastforward, warmup);
+        if (istats)
+            istats->tick(tiles, records);
+        saveCheckpoint(ckptfile, ckptat, config, tiles, dir, NULL, fp,
+                       &records, &count, &proc, &oldproc, &newproc);
 
-        // The mem addr is last
-        // NOTE: passing NULL to strtok here because
-        //       we want to operate on same string
-        token = strtok(NULL, delimit);
-        assert(token != NULL);
-        addr = strtoul(token, NULL, 16);
-      //printf("address is: %x\n", (uint) addr);
+        // Fork off the runs of a sweep that migrate next
+        if (sweeping && sweepFork(runs, nruns, records, 0, &fp, fname, tiles,
+                                  dir, &interval, &overlap))
+            sweeping = 0;
+    }
 
-        tiles[proc]->Access(addr, op[0]);
+    // The runs of a sweep that are left (if any) never migrate. Once
+    // they are started all that is left to do here is print everyone's
+    // output.
+    if (sweeping) {
+        if (!sweepFork(runs, nruns, records, 1, &fp, fname, tiles, dir,
+                       &interval, &overlap)) {
+            sweepGather(runs, nruns);
+            exit(0);
+        }
+        sweeping = 0;
+    }
+    if (!mt && ckptfile && ckptat == (ulong)-1)
+        saveCheckpoint(ckptfile, records, config, tiles, dir, NULL, fp,
+                       &records, &count, &proc, &oldproc, &newproc);
+    if (fp)
+        fclose(fp);
+    delete work;
+    if (sampler)
+        sampler->finish();
+    if (simpoint)
+        simpoint->finish(tiles);
+    PROF_STOP();
 
+    // Take the last snapshot and wait for the writer to finish
+    if (istats) {
+        for (i=0, records=0; i < NPROCS; i++)
+            records += tiles[i]->accesses;
+        istats->take(tiles, records, SNAPEND);
+        delete istats;
     }
-    fclose(fp);
 
 
-    // Print the output. Either tabular or normal
-    if (tabular) {
+    // Print the output. Either tabular or normal. When sampling the
+    // tile counters only cover part of the trace so the estimates
+    // are printed in their place. With simpoints the tile counters
+    // have been rebuilt for the whole trace.
+    if (sampler && tabular) {
+        sampler->PrintStatsTabular(tiles);
+    } else if (sampler) {
+        sampler->PrintStats(tiles);
+        if (dir->hasStats())
+            dir->PrintStats();
+        NETWORK->PrintStats();
+        STAT_PRINT();
+    } else if (tabular) {
     
         // Print the header first
         tiles[0]->PrintStatsTabular(1);
@@ -222,5 +1161,20 @@ int main(int argc, char *argv[]) {
         // Print it all out
         for (i=0; i < NPROCS; i++)
             tiles[i]->PrintStats();
+        if (dir->hasStats())
+            dir->PrintStats();
+        NETWORK->PrintStats();
+        STAT_PRINT();
+        if (simpoint)
+            simpoint->PrintStats();
     }
+
+    // Print how fast we went (with the tables so it is in every run)
+    for (i=0, records=0; i < NPROCS; i++)
+        records += tiles[i]->accesses;
+    PROF_PRINT(records);
+
+    // Write out the link traffic if asked to
+    if (netstats)
+        NETWORK->WriteStats(netstats);
 }